@@ -4,6 +4,55 @@
 
 int main()
 {
+	static auto frustumCullingTestResult = sk::frustumCullingTest();
+	std::cout << "Frustum culling test                : " << (sk::retLog(frustumCullingTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto queueFamilyTestResult = sk::queueFamilyTest();
+	std::cout << "Queue family test                   : " << (sk::retLog(queueFamilyTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto vertexWeldingTestResult = sk::vertexWeldingTest();
+	std::cout << "Vertex welding test                 : " << (sk::retLog(vertexWeldingTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto meshOptimizationTestResult = sk::meshOptimizationTest();
+	std::cout << "Mesh optimization test              : " << (sk::retLog(meshOptimizationTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto vertexQuantizationTestResult = sk::vertexQuantizationTest();
+	std::cout << "Vertex quantization test            : " << (sk::retLog(vertexQuantizationTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto meshletTestResult = sk::meshletTest();
+	std::cout << "Meshlet test                        : " << (sk::retLog(meshletTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto lodTestResult = sk::lodTest();
+	std::cout << "Level of detail test                : " << (sk::retLog(lodTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto instanceBatchingTestResult = sk::instanceBatchingTest();
+	std::cout << "Instance batching test              : " << (sk::retLog(instanceBatchingTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto meshFileTestResult = sk::meshFileTest();
+	std::cout << "Mesh file test                      : " << (sk::retLog(meshFileTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto importTestResult = sk::importTest();
+	std::cout << "Import test                         : " << (sk::retLog(importTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto shaderLoadingTestResult = sk::shaderLoadingTest();
+	std::cout << "Shader loading test                 : " << (sk::retLog(shaderLoadingTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto reflectionTestResult = sk::reflectionTest();
+	std::cout << "Shader reflection test              : " << (sk::retLog(reflectionTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto specializationTestResult = sk::specializationTest();
+	std::cout << "Specialization test                 : " << (sk::retLog(specializationTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto descriptorAllocatorTestResult = sk::descriptorAllocatorTest();
+	std::cout << "Descriptor allocator test           : " << (sk::retLog(descriptorAllocatorTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto bindlessTestResult = sk::bindlessTest();
+	std::cout << "Bindless test                       : " << (sk::retLog(bindlessTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto frameRingTestResult = sk::frameRingTest();
+	std::cout << "Frame ring test                     : " << (sk::retLog(frameRingTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto renderGraphTestResult = sk::renderGraphTest();
+	std::cout << "Render graph test                   : " << (sk::retLog(renderGraphTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto transientAliasingTestResult = sk::transientAliasingTest();
+	std::cout << "Transient aliasing test             : " << (sk::retLog(transientAliasingTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto renderTargetTestResult = sk::renderTargetTest();
+	std::cout << "Render target test                  : " << (sk::retLog(renderTargetTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto gpuProfilerTestResult = sk::gpuProfilerTest();
+	std::cout << "GPU profiler test                   : " << (sk::retLog(gpuProfilerTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto drawQueryTestResult = sk::drawQueryTest();
+	std::cout << "Draw query test                     : " << (sk::retLog(drawQueryTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto traceTestResult = sk::traceTest();
+	std::cout << "Trace test                          : " << (sk::retLog(traceTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto frameStatisticsTestResult = sk::frameStatisticsTest();
+	std::cout << "Frame statistics test               : " << (sk::retLog(frameStatisticsTestResult) ? "PASSED" : "FAILED") << std::endl;
+	static auto dynamicStateTestResult = sk::dynamicStateTest();
+	std::cout << "Dynamic state test                  : " << (sk::retLog(dynamicStateTestResult) ? "PASSED" : "FAILED") << std::endl;
+
 	static auto mainSoulkanTestResult = sk::mainSoulkanTest(DEBUG);
 	static sk::SkTestData testData    = sk::retLog(mainSoulkanTestResult);
 
@@ -12,6 +61,10 @@ int main()
 	std::cout << "Init time elapsed (in seconds)      : " << testData.initTimeElapsed << std::endl;
 	std::cout << "Average number of frames per second : " << testData.averageFramesPerSecond << std::endl;
 	std::cout << "Average frametime (in ms)           : " << testData.averageFrametime << std::endl;
+	std::cout << "Frames kept for frametime statistics: " << testData.statisticsFrames << " (last frames of the run)" << std::endl;
+	std::cout << "p50 / p95 / p99 frametime (in ms)   : " << testData.p50Frametime << " / " << testData.p95Frametime << " / " << testData.p99Frametime << std::endl;
+	std::cout << "Max frametime (in ms)               : " << testData.maxFrametime << std::endl;
+	std::cout << "Frames over budget (16.67 ms)       : " << testData.framesOverBudget << std::endl;
 	std::cout << "Debug mode is                       : " << (DEBUG ? "ON" : "OFF") << std::endl;
 
 	return 1;
@@ -9,10 +9,48 @@
 
 
 /*Includes from the std library or from needed tools*/
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <charconv>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
 #include <vulkan/vulkan.hpp>
+
+//Memory mapped files (MappedFile), NO_ERROR, near and far are macros of windows.h clashing with soulkan
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#undef NO_ERROR
+#undef near
+#undef far
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <GLFW/glfw3.h>
 #define GLFW_INCLUDE_VULKAN
 
@@ -352,6 +390,7 @@ namespace SOULKAN_MATHS_NAMESPACE
 			return *this;
 		}
 
+		//Matrices are stored as matrix[column][row] (the layout GLSL reads), *this = *this * rhs
 		Mat4& operator*=(const Mat4& rhs)
 		{
 			std::array<std::array<float, 4>, 4> matrixValues;
@@ -359,10 +398,10 @@ namespace SOULKAN_MATHS_NAMESPACE
 			{
 				for (uint32_t j = 0; j < 4; j++)
 				{
-					matrixValues[i][j] = matrix[i][0] * rhs.matrix[0][i] +
-						matrix[i][1] * rhs.matrix[1][i] +
-						matrix[i][2] * rhs.matrix[2][i] +
-						matrix[i][3] * rhs.matrix[3][i];
+					matrixValues[i][j] = matrix[0][j] * rhs.matrix[i][0] +
+						matrix[1][j] * rhs.matrix[i][1] +
+						matrix[2][j] * rhs.matrix[i][2] +
+						matrix[3][j] * rhs.matrix[i][3];
 
 				}
 			}
@@ -585,9 +624,9 @@ namespace SOULKAN_MATHS_NAMESPACE
 	{
 		Mat4 idMatrix(1.0f);
 
-		idMatrix.matrix[0][3] = xyz.x;
-		idMatrix.matrix[1][3] = xyz.y;
-		idMatrix.matrix[1][3] = xyz.z;
+		idMatrix.matrix[3][0] = xyz.x;
+		idMatrix.matrix[3][1] = xyz.y;
+		idMatrix.matrix[3][2] = xyz.z;
 
 		return idMatrix;
 	}
@@ -597,9 +636,9 @@ namespace SOULKAN_MATHS_NAMESPACE
 	{
 		Mat4 idMatrix(1.0f);
 
-		idMatrix.matrix[0][3] = x;
-		idMatrix.matrix[1][3] = y;
-		idMatrix.matrix[2][3] = z;
+		idMatrix.matrix[3][0] = x;
+		idMatrix.matrix[3][1] = y;
+		idMatrix.matrix[3][2] = z;
 
 		return idMatrix;
 	}
@@ -661,11 +700,272 @@ namespace SOULKAN_MATHS_NAMESPACE
 			projectionMatrix[2][2] = far / (far - near);
 			projectionMatrix[2][3] = 1.f;
 			projectionMatrix[3][2] = -(far * near) / (far - near);
+
+			result.value = projectionMatrix;
+		}
+
+		return result;
+	}
+
+	/*@brief Dot product of two Vec3*/
+	inline constexpr float dot(const Vec3& lhs, const Vec3& rhs) noexcept
+	{
+		return (lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z);
+	}
+
+	/*@brief Cross product of two Vec3*/
+	inline Vec3 cross(const Vec3& lhs, const Vec3& rhs) noexcept
+	{
+		return Vec3(lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z, lhs.x * rhs.y - lhs.y * rhs.x);
+	}
+
+	/*@brief Length of a Vec3*/
+	inline float length(const Vec3& vec) noexcept
+	{
+		return std::sqrt(dot(vec, vec));
+	}
+
+	/*Frustum described by its 6 planes (left, right, bottom, top, near, far)
+	* Each plane is stored as a Vec4 : (x, y, z) is the normal pointing inside the frustum and w is the distance to the origin
+	*/
+	struct Frustum
+	{
+		std::array<Vec4, 6> planes;
+	};
+
+	/*@brief Extracts the 6 normalized planes of the frustum described by a given view-projection matrix (Gribb/Hartmann method)
+	* The matrix must follow the layout of perspectiveProjection() (matrix[column][row]) and map depth to [0, 1] as vulkan does
+	*
+	* @param viewProjection The view-projection matrix from which the planes are extracted
+	*
+	* @return SkResult(extracted frustum, MathError)
+	*/
+	inline SkResult<Frustum, MathError> extractFrustum(const Mat4& viewProjection) noexcept
+	{
+		SkResult result(Frustum(), MathError::NO_ERROR);
+
+		const auto& m = viewProjection.matrix;
+		auto row = [&m](uint32_t r) { return Vec4(m[0][r], m[1][r], m[2][r], m[3][r]); };
+
+		Vec4 row0 = row(0);
+		Vec4 row1 = row(1);
+		Vec4 row2 = row(2);
+		Vec4 row3 = row(3);
+
+		Frustum frustum;
+		frustum.planes[0] = Vec4(row3.x + row0.x, row3.y + row0.y, row3.z + row0.z, row3.w + row0.w); //Left
+		frustum.planes[1] = Vec4(row3.x - row0.x, row3.y - row0.y, row3.z - row0.z, row3.w - row0.w); //Right
+		frustum.planes[2] = Vec4(row3.x + row1.x, row3.y + row1.y, row3.z + row1.z, row3.w + row1.w); //Bottom
+		frustum.planes[3] = Vec4(row3.x - row1.x, row3.y - row1.y, row3.z - row1.z, row3.w - row1.w); //Top
+		frustum.planes[4] = row2;                                                                     //Near (depth 0)
+		frustum.planes[5] = Vec4(row3.x - row2.x, row3.y - row2.y, row3.z - row2.z, row3.w - row2.w); //Far
+
+		for (auto& plane : frustum.planes)
+		{
+			float normalLength = length(Vec3(plane.x, plane.y, plane.z));
+			if (normalLength == 0.0f)
+			{
+				result.error = MathError::DIVIDING_BY_ZERO_ERROR;
+				continue;
+			}
+
+			plane *= (1.0f / normalLength);
+		}
+
+		result.value = frustum;
+		return result;
+	}
+
+	/*@brief Checks if a bounding sphere is at least partially inside a given frustum, CPU equivalent of the test done by the culling compute shader
+	*
+	* @param frustum The frustum (see extractFrustum())
+	* @param center The center of the bounding sphere
+	* @param radius The radius of the bounding sphere
+	*
+	* @return Boolean indicating if the sphere is visible(true) or not(false)
+	*/
+	inline bool isSphereInFrustum(const Frustum& frustum, const Vec3& center, const float radius) noexcept
+	{
+		for (const auto& plane : frustum.planes)
+		{
+			if (dot(Vec3(plane.x, plane.y, plane.z), center) + plane.w < -radius)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/*@brief Converts a float to an IEEE 754 half precision float (round to nearest even), as read by vk::Format::eR16G16B16A16Sfloat*/
+	inline uint16_t floatToHalf(const float value) noexcept
+	{
+		uint32_t bits = 0;
+		std::memcpy(&bits, &value, sizeof(float));
+
+		uint32_t sign = (bits >> 16) & 0x8000u;
+		uint32_t exponent = (bits >> 23) & 0xFFu;
+		uint32_t mantissa = bits & 0x7FFFFFu;
+
+		//Infinity and NaN (NaN keeps a non zero mantissa)
+		if (exponent == 0xFFu)
+		{
+			return static_cast<uint16_t>(sign | 0x7C00u | (mantissa != 0 ? 0x200u : 0u));
+		}
+
+		int32_t halfExponent = static_cast<int32_t>(exponent) - 127 + 15;
+
+		//Overflow to infinity
+		if (halfExponent >= 31)
+		{
+			return static_cast<uint16_t>(sign | 0x7C00u);
+		}
+
+		//Subnormal half or zero
+		if (halfExponent <= 0)
+		{
+			if (halfExponent < -10)
+			{
+				return static_cast<uint16_t>(sign);
+			}
+
+			mantissa |= 0x800000u;
+			uint32_t shift = static_cast<uint32_t>(14 - halfExponent);
+			uint32_t halfMantissa = mantissa >> shift;
+			uint32_t remainder = mantissa & ((1u << shift) - 1u);
+			uint32_t halfway = 1u << (shift - 1u);
+
+			if (remainder > halfway || (remainder == halfway && (halfMantissa & 1u)))
+			{
+				halfMantissa++;
+			}
+
+			return static_cast<uint16_t>(sign | halfMantissa);
+		}
+
+		uint32_t half = sign | (static_cast<uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+		uint32_t remainder = mantissa & 0x1FFFu;
+
+		//A carry into the exponent is the correct rounding, up to infinity
+		if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u)))
+		{
+			half++;
+		}
+
+		return static_cast<uint16_t>(half);
+	}
+
+	/*@brief Converts an IEEE 754 half precision float to a float*/
+	inline float halfToFloat(const uint16_t value) noexcept
+	{
+		uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+		uint32_t exponent = (value >> 10) & 0x1Fu;
+		uint32_t mantissa = value & 0x3FFu;
+
+		uint32_t bits = 0;
+		if (exponent == 0x1Fu)
+		{
+			bits = sign | 0x7F800000u | (mantissa << 13);
+		}
+		else if (exponent != 0)
+		{
+			bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+		}
+		else if (mantissa != 0)
+		{
+			//Subnormal half, normalized as a float
+			exponent = 127 - 15 + 1;
+			while ((mantissa & 0x400u) == 0)
+			{
+				mantissa <<= 1;
+				exponent--;
+			}
+
+			bits = sign | (exponent << 23) | ((mantissa & 0x3FFu) << 13);
+		}
+		else
+		{
+			bits = sign;
 		}
 
+		float result = 0.0f;
+		std::memcpy(&result, &bits, sizeof(float));
 		return result;
 	}
 
+	/*@brief Converts a float in [-1, 1] to a signed normalized 16 bits integer, as read by vk::Format::eR16G16Snorm*/
+	inline int16_t floatToSnorm16(const float value) noexcept
+	{
+		float clamped = std::max(-1.0f, std::min(1.0f, value));
+		return static_cast<int16_t>(std::lround(clamped * 32767.0f));
+	}
+
+	/*@brief Converts a float in [0, 1] to an unsigned normalized 8 bits integer, as read by vk::Format::eR8G8B8A8Unorm*/
+	inline uint8_t floatToUnorm8(const float value) noexcept
+	{
+		float clamped = std::max(0.0f, std::min(1.0f, value));
+		return static_cast<uint8_t>(std::lround(clamped * 255.0f));
+	}
+
+	/*@brief Converts a float in [0, 1] to an unsigned normalized 16 bits integer, as read by vk::Format::eR16G16B16A16Unorm*/
+	inline uint16_t floatToUnorm16(const float value) noexcept
+	{
+		float clamped = std::max(0.0f, std::min(1.0f, value));
+		return static_cast<uint16_t>(std::lround(clamped * 65535.0f));
+	}
+
+	/*@brief Encodes a unit normal on the octahedron unfolded onto [-1, 1]^2, 2 snorm16 values keep the error under 0.01 degree
+	*
+	* @param normal The normal to be encoded, does not need to be normalized (a zero normal is encoded as (0, 0, 1))
+	*
+	* @return The 2 snorm16 components of the encoded normal
+	*/
+	inline std::array<int16_t, 2> encodeOctahedral(const Vec3& normal) noexcept
+	{
+		float l1Norm = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+		if (l1Norm == 0.0f)
+		{
+			return { 0, 0 };
+		}
+
+		float x = normal.x / l1Norm;
+		float y = normal.y / l1Norm;
+
+		//The lower hemisphere is folded over the diagonals
+		if (normal.z < 0.0f)
+		{
+			float foldedX = (1.0f - std::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+			float foldedY = (1.0f - std::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+
+			x = foldedX;
+			y = foldedY;
+		}
+
+		return { floatToSnorm16(x), floatToSnorm16(y) };
+	}
+
+	/*@brief Decodes a normal encoded by encodeOctahedral(), shaders/compact_mesh.vert does the same on the GPU
+	*
+	* @param encodedNormal The 2 snorm16 components of the encoded normal
+	*
+	* @return The decoded unit normal
+	*/
+	inline Vec3 decodeOctahedral(const std::array<int16_t, 2>& encodedNormal) noexcept
+	{
+		float x = std::max(-1.0f, static_cast<float>(encodedNormal[0]) / 32767.0f);
+		float y = std::max(-1.0f, static_cast<float>(encodedNormal[1]) / 32767.0f);
+		float z = 1.0f - std::abs(x) - std::abs(y);
+
+		float t = std::max(-z, 0.0f);
+		x += (x >= 0.0f ? -t : t);
+		y += (y >= 0.0f ? -t : t);
+
+		Vec3 normal(x, y, z);
+		float normalLength = length(normal);
+
+		return Vec3(x / normalLength, y / normalLength, z / normalLength);
+	}
+
 	/*@brief Calculates the FPS given a number of frames elapsed in delta time
 	*
 	* @param frames The number of frames elapsed during delta time
@@ -864,8 +1164,19 @@ namespace SOULKAN_NAMESPACE
 		double averageFramesPerSecond;
 		double averageFrametime;
 
-		SkTestData(double totalF, double totalTime, double initTime, double averageFps, double averageFt)
-			: totalFrames(totalF), totalTimeElapsed(totalTime), initTimeElapsed(initTime), averageFramesPerSecond(averageFps), averageFrametime(averageFt)
+		//Frame time percentiles in ms, frame time SLAs being on p99 rather than on the mean. They cover the last statisticsFrames frames
+		//kept by the FrameStatistics, while the averages cover the whole run
+		double statisticsFrames;
+		double p50Frametime;
+		double p95Frametime;
+		double p99Frametime;
+		double maxFrametime;
+		double framesOverBudget;
+
+		SkTestData(double totalF, double totalTime, double initTime, double averageFps, double averageFt, double statisticsF, double p50Ft, double p95Ft, double p99Ft,
+			double maxFt, double overBudget)
+			: totalFrames(totalF), totalTimeElapsed(totalTime), initTimeElapsed(initTime), averageFramesPerSecond(averageFps), averageFrametime(averageFt),
+			statisticsFrames(statisticsF), p50Frametime(p50Ft), p95Frametime(p95Ft), p99Frametime(p99Ft), maxFrametime(maxFt), framesOverBudget(overBudget)
 		{
 		}
 
@@ -877,6 +1188,13 @@ namespace SOULKAN_NAMESPACE
 
 			averageFramesPerSecond = 0;
 			averageFrametime = 0;
+
+			statisticsFrames = 0;
+			p50Frametime = 0;
+			p95Frametime = 0;
+			p99Frametime = 0;
+			maxFrametime = 0;
+			framesOverBudget = 0;
 		}
 	};
 
@@ -979,7 +1297,31 @@ namespace SOULKAN_NAMESPACE
 	/*@brief Enum containing error messages concerning Tests*/
 	enum class TestError
 	{
-		NO_ERROR = 0
+		NO_ERROR = 0,
+		MESH_OPTIMIZATION_ERROR = 1,
+		VERTEX_QUANTIZATION_ERROR = 2,
+		MESHLET_ERROR = 3,
+		LOD_ERROR = 4,
+		INSTANCE_BATCHING_ERROR = 5,
+		MESH_FILE_ERROR = 6,
+		IMPORT_ERROR = 7,
+		SHADER_LOADING_ERROR = 8,
+		SHADER_REFLECTION_ERROR = 9,
+		SPECIALIZATION_ERROR = 10,
+		DESCRIPTOR_ALLOCATOR_ERROR = 11,
+		BINDLESS_ERROR = 12,
+		FRAME_RING_ERROR = 13,
+		RENDER_GRAPH_ERROR = 14,
+		TRANSIENT_ALIASING_ERROR = 15,
+		RENDER_TARGET_ERROR = 16,
+		GPU_PROFILER_ERROR = 17,
+		DRAW_QUERY_ERROR = 18,
+		TRACE_ERROR = 19,
+		FRAME_STATISTICS_ERROR = 20,
+		DYNAMIC_STATE_ERROR = 21,
+		VERTEX_WELDING_ERROR = 22,
+		FRUSTUM_CULLING_ERROR = 23,
+		QUEUE_FAMILY_ERROR = 24
 	};
 
 	/*@brief Enum containing error messages concerning GLFW*/
@@ -1020,7 +1362,9 @@ namespace SOULKAN_NAMESPACE
 		NO_PRESENT_MODES = 5,
 		NO_SURFACE_FORMATS = 6,
 		UNDEFINED_FORMAT = 7,
-		GLFW_FRAMEBUFFER_SIZE_ERROR = 8
+		GLFW_FRAMEBUFFER_SIZE_ERROR = 8,
+		EXTENSION_QUERY_ERROR = 9,
+		NO_SUPPORTED_DEPTH_FORMAT = 10
 	};
 
 	/*@brief Enum containing error messages concerning the logical device (device)*/
@@ -1105,7 +1449,10 @@ namespace SOULKAN_NAMESPACE
 	/*@brief Enum containing error messages concerning the drawing process*/
 	enum class DrawingError
 	{
-		NO_ERROR = 0
+		NO_ERROR = 0,
+		LOD_OUT_OF_RANGE_ERROR = 1,
+		INSTANCE_BUFFER_TOO_SMALL_ERROR = 2,
+		MESH_ID_OUT_OF_RANGE_ERROR = 3
 	};
 
 	/*@brief Enum containing error messages concerning the shaders*/
@@ -1114,7 +1461,46 @@ namespace SOULKAN_NAMESPACE
 		NO_ERROR = 0,
 		SHADER_FILE_OPENING_ERROR = 1,
 		SHADER_MODULE_CREATION_ERROR = 2,
-		SHADER_MODULE_DELETION_ERROR = 3
+		SHADER_MODULE_DELETION_ERROR = 3,
+		INVALID_SPIRV_ERROR = 4,
+		SHADER_MODULE_NOT_CACHED_ERROR = 5
+	};
+
+	/*@brief Enum containing error messages concerning files (mapping, mesh files)*/
+	enum class FileError
+	{
+		NO_ERROR = 0,
+		FILE_OPENING_ERROR = 1,
+		FILE_MAPPING_ERROR = 2,
+		FILE_WRITING_ERROR = 3,
+		INVALID_FORMAT_ERROR = 4,
+		UNSUPPORTED_VERSION_ERROR = 5,
+		CORRUPTED_FILE_ERROR = 6
+	};
+
+	/*@brief Enum containing error messages concerning asset import (OBJ, glTF, import cache)*/
+	enum class ImportError
+	{
+		NO_ERROR = 0,
+		FILE_OPENING_ERROR = 1,
+		UNSUPPORTED_FORMAT_ERROR = 2,
+		PARSING_ERROR = 3,
+		UNSUPPORTED_FEATURE_ERROR = 4,
+		INVALID_ACCESSOR_ERROR = 5,
+		INDEX_OUT_OF_RANGE_ERROR = 6,
+		CACHE_ERROR = 7
+	};
+
+	/*@brief Enum containing error messages concerning SPIR-V reflection*/
+	enum class ReflectionError
+	{
+		NO_ERROR = 0,
+		INVALID_SPIRV_ERROR = 1,
+		UNSUPPORTED_STAGE_ERROR = 2,
+		UNSUPPORTED_RESOURCE_ERROR = 3,
+		BINDING_CONFLICT_ERROR = 4,
+		UNKNOWN_SPECIALIZATION_CONSTANT_ERROR = 5,
+		SPECIALIZATION_CONSTANT_SIZE_ERROR = 6
 	};
 
 	/*@brief Enum containing error messages concerning the graphics pipeline*/
@@ -1136,7 +1522,10 @@ namespace SOULKAN_NAMESPACE
 		PIPELINE_LAYOUT_DESTRUCTION_ERROR = 13,
 		GRAPHICS_PIPELINE_CREATE_INFO_ERROR = 14,
 		PIPELINE_CREATION_ERROR = 15,
-		PIPELINE_DELETION_ERROR = 16
+		PIPELINE_DELETION_ERROR = 16,
+		PIPELINE_CACHE_DATA_ERROR = 17,
+		PIPELINE_CACHE_DESTRUCTION_ERROR = 18,
+		UNCACHED_SHADER_MODULE_ERROR = 19
 	};
 
 	/*@brief Enum containing error messages concerning the memory allocator and its allocations*/
@@ -1148,7 +1537,10 @@ namespace SOULKAN_NAMESPACE
 		MEMORY_ALLOCATION_ERROR = 3,
 		INSUFFICIENT_FREE_MEMORY_ERROR = 4,
 		BIND_BUFFER_MEMORY_ERROR = 5,
-		MAP_MEMORY_ERROR = 6
+		MAP_MEMORY_ERROR = 6,
+		BIND_IMAGE_MEMORY_ERROR = 7,
+		INVALID_TRANSIENT_LIFETIME_ERROR = 8,
+		INVALID_TRANSIENT_IMAGE_ERROR = 9
 	};
 
 	/*@brief Enum containing error messages concerning the buffers*/
@@ -1156,14 +1548,131 @@ namespace SOULKAN_NAMESPACE
 	{
 		NO_ERROR = 0,
 		BUFFER_CREATION_ERROR = 1,
-		BUFFER_DESTRUCTION_ERROR = 2
+		BUFFER_DESTRUCTION_ERROR = 2,
+		RING_BUFFER_FULL_ERROR = 3,
+		BUFFER_MEMORY_ERROR = 4,
+		RING_BUFFER_TOO_LARGE_ERROR = 5
 	};
 
 	/*@brief Enum containing error messages concerning meshes*/
 	enum class MeshError
 	{
 		NO_ERROR = 0,
-		TRIANGLE_MESH_LOADING_ERROR = 1
+		TRIANGLE_MESH_LOADING_ERROR = 1,
+		INDEX_OUT_OF_RANGE_ERROR = 2,
+		MESH_NOT_INDEXED_ERROR = 3,
+		INVALID_MESHLET_LIMITS_ERROR = 4,
+		INVALID_LOD_PARAMETERS_ERROR = 5
+	};
+
+	/*@brief Enum containing error messages concerning descriptors*/
+	enum class DescriptorError
+	{
+		NO_ERROR = 0,
+		DESCRIPTOR_SET_LAYOUT_CREATION_ERROR = 1,
+		DESCRIPTOR_SET_LAYOUT_DESTRUCTION_ERROR = 2,
+		DESCRIPTOR_POOL_CREATION_ERROR = 3,
+		DESCRIPTOR_POOL_DESTRUCTION_ERROR = 4,
+		DESCRIPTOR_SET_ALLOCATION_ERROR = 5,
+		PIPELINE_LAYOUT_CREATION_ERROR = 6,
+		PIPELINE_LAYOUT_DESTRUCTION_ERROR = 7,
+		DESCRIPTOR_POOL_RESET_ERROR = 8,
+		BINDLESS_SLOTS_EXHAUSTED_ERROR = 9,
+		INVALID_BINDLESS_INDEX_ERROR = 10,
+		INVALID_DESCRIPTOR_WRITE_ERROR = 11,
+		BINDLESS_SET_NOT_CREATED_ERROR = 12,
+		BINDLESS_LIMIT_EXCEEDED_ERROR = 13
+	};
+
+	/*@brief Enum containing error messages concerning the compute pipeline*/
+	enum class ComputePipelineError
+	{
+		NO_ERROR = 0,
+		PIPELINE_LAYOUT_CREATION_ERROR = 1,
+		COMPUTE_PIPELINE_CREATION_ERROR = 2,
+		SHADER_MODULE_CREATION_ERROR = 3,
+		UNCACHED_SHADER_MODULE_ERROR = 4
+	};
+
+	/*@brief Enum containing error messages concerning GPU culling*/
+	enum class CullingError
+	{
+		NO_ERROR = 0,
+		INSTANCE_COUNT_EXCEEDS_MAX_DRAW_COUNT = 1
+	};
+
+	/*@brief Enum containing error messages concerning the render graph*/
+	enum class RenderGraphError
+	{
+		NO_ERROR = 0,
+		INVALID_RESOURCE_ERROR = 1,
+		INVALID_PASS_ERROR = 2,
+		INVALID_USAGE_ERROR = 3,
+		DEPENDENCY_CYCLE_ERROR = 4,
+		ATTACHMENT_EXTENT_ERROR = 5,
+		NOT_COMPILED_ERROR = 6,
+		MISSING_RESOURCE_HANDLE_ERROR = 7,
+		RENDER_PASS_CREATION_ERROR = 8,
+		FRAMEBUFFER_CREATION_ERROR = 9,
+		RENDER_PASS_DESTRUCTION_ERROR = 10,
+		ALIASED_LIFETIME_ERROR = 11
+	};
+
+	/*@brief Enum containing error messages concerning the depth and multisampled render targets*/
+	enum class RenderTargetError
+	{
+		NO_ERROR = 0,
+		IMAGE_CREATION_ERROR = 1,
+		IMAGE_VIEW_CREATION_ERROR = 2,
+		IMAGE_ALLOCATION_ERROR = 3,
+		IMAGE_DESTRUCTION_ERROR = 4,
+		UNSUPPORTED_SAMPLE_COUNT_ERROR = 5
+	};
+
+	/*@brief Enum containing error messages concerning the GPU profiler*/
+	enum class GpuProfilerError
+	{
+		NO_ERROR = 0,
+		TIMESTAMPS_NOT_SUPPORTED_ERROR = 1,
+		QUERY_POOL_CREATION_ERROR = 2,
+		QUERY_POOL_DESTRUCTION_ERROR = 3,
+		QUERY_RESULTS_ERROR = 4,
+		RESULTS_NOT_AVAILABLE_ERROR = 5,
+		ZONE_OVERFLOW_ERROR = 6,
+		UNBALANCED_ZONE_ERROR = 7
+	};
+
+	/*@brief Enum containing error messages concerning the pipeline statistics and occlusion queries of groups of draws*/
+	enum class DrawQueryError
+	{
+		NO_ERROR = 0,
+		QUERY_POOL_CREATION_ERROR = 1,
+		QUERY_POOL_DESTRUCTION_ERROR = 2,
+		QUERY_RESULTS_ERROR = 3,
+		RESULTS_NOT_AVAILABLE_ERROR = 4,
+		GROUP_OVERFLOW_ERROR = 5,
+		UNBALANCED_GROUP_ERROR = 6
+	};
+
+	/*@brief Enum containing error messages concerning the CPU / GPU traces*/
+	enum class TraceError
+	{
+		NO_ERROR = 0,
+		INVALID_FRAME_RANGE_ERROR = 1,
+		FILE_WRITE_ERROR = 2,
+		CALIBRATION_ERROR = 3,
+		CALIBRATION_NOT_SUPPORTED_ERROR = 4,
+		CALIBRATION_EXTENSION_NOT_ENABLED_ERROR = 5
+	};
+
+	/*@brief Enum containing error messages concerning the frame statistics*/
+	enum class FrameStatisticsError
+	{
+		NO_ERROR = 0,
+		NO_FRAME_ERROR = 1,
+		INVALID_PERCENTILE_ERROR = 2,
+		INVALID_HISTOGRAM_ERROR = 3,
+		FILE_WRITE_ERROR = 4
 	};
 
 	/*toString() implementation for every enum class, inspired by vulkan.hpp*/
@@ -1195,7 +1704,31 @@ namespace SOULKAN_NAMESPACE
 	{
 		switch (value)
 		{
-		case TestError::NO_ERROR: return "NO_ERROR";
+		case TestError::NO_ERROR:                   return "NO_ERROR";
+		case TestError::MESH_OPTIMIZATION_ERROR:    return "MESH_OPTIMIZATION_ERROR";
+		case TestError::VERTEX_QUANTIZATION_ERROR:  return "VERTEX_QUANTIZATION_ERROR";
+		case TestError::MESHLET_ERROR:              return "MESHLET_ERROR";
+		case TestError::LOD_ERROR:                  return "LOD_ERROR";
+		case TestError::INSTANCE_BATCHING_ERROR:    return "INSTANCE_BATCHING_ERROR";
+		case TestError::MESH_FILE_ERROR:            return "MESH_FILE_ERROR";
+		case TestError::IMPORT_ERROR:               return "IMPORT_ERROR";
+		case TestError::SHADER_LOADING_ERROR:       return "SHADER_LOADING_ERROR";
+		case TestError::SHADER_REFLECTION_ERROR:    return "SHADER_REFLECTION_ERROR";
+		case TestError::SPECIALIZATION_ERROR:       return "SPECIALIZATION_ERROR";
+		case TestError::DESCRIPTOR_ALLOCATOR_ERROR: return "DESCRIPTOR_ALLOCATOR_ERROR";
+		case TestError::BINDLESS_ERROR:             return "BINDLESS_ERROR";
+		case TestError::FRAME_RING_ERROR:           return "FRAME_RING_ERROR";
+		case TestError::RENDER_GRAPH_ERROR:         return "RENDER_GRAPH_ERROR";
+		case TestError::TRANSIENT_ALIASING_ERROR:   return "TRANSIENT_ALIASING_ERROR";
+		case TestError::RENDER_TARGET_ERROR:        return "RENDER_TARGET_ERROR";
+		case TestError::GPU_PROFILER_ERROR:         return "GPU_PROFILER_ERROR";
+		case TestError::DRAW_QUERY_ERROR:           return "DRAW_QUERY_ERROR";
+		case TestError::TRACE_ERROR:                return "TRACE_ERROR";
+		case TestError::FRAME_STATISTICS_ERROR:     return "FRAME_STATISTICS_ERROR";
+		case TestError::DYNAMIC_STATE_ERROR:        return "DYNAMIC_STATE_ERROR";
+		case TestError::VERTEX_WELDING_ERROR:       return "VERTEX_WELDING_ERROR";
+		case TestError::FRUSTUM_CULLING_ERROR:      return "FRUSTUM_CULLING_ERROR";
+		case TestError::QUEUE_FAMILY_ERROR:         return "QUEUE_FAMILY_ERROR";
 		default: return "Invalid enum value";
 		}
 	}
@@ -1247,6 +1780,8 @@ namespace SOULKAN_NAMESPACE
 		case PhysicalDeviceError::NO_SURFACE_FORMATS:                return "NO_SURFACE_FORMATS";
 		case PhysicalDeviceError::UNDEFINED_FORMAT:                  return "UNDEFINED_FORMAT";
 		case PhysicalDeviceError::GLFW_FRAMEBUFFER_SIZE_ERROR:       return "GLFW_FRAMEBUFFER_SIZE_ERROR";
+		case PhysicalDeviceError::EXTENSION_QUERY_ERROR:             return "EXTENSION_QUERY_ERROR";
+		case PhysicalDeviceError::NO_SUPPORTED_DEPTH_FORMAT:         return "NO_SUPPORTED_DEPTH_FORMAT";
 		default: return "Invalid enum value";
 		}
 	}
@@ -1360,7 +1895,56 @@ namespace SOULKAN_NAMESPACE
 	{
 		switch (value)
 		{
-		case DrawingError::NO_ERROR: return "NO_ERROR";
+		case DrawingError::NO_ERROR:                        return "NO_ERROR";
+		case DrawingError::LOD_OUT_OF_RANGE_ERROR:          return "LOD_OUT_OF_RANGE_ERROR";
+		case DrawingError::INSTANCE_BUFFER_TOO_SMALL_ERROR: return "INSTANCE_BUFFER_TOO_SMALL_ERROR";
+		case DrawingError::MESH_ID_OUT_OF_RANGE_ERROR:      return "MESH_ID_OUT_OF_RANGE_ERROR";
+		default: return "Invalid enum value";
+		}
+	}
+								 
+	inline std::string toString(const FileError value)
+	{
+		switch (value)
+		{
+		case FileError::NO_ERROR:                  return "NO_ERROR";
+		case FileError::FILE_OPENING_ERROR:        return "FILE_OPENING_ERROR";
+		case FileError::FILE_MAPPING_ERROR:        return "FILE_MAPPING_ERROR";
+		case FileError::FILE_WRITING_ERROR:        return "FILE_WRITING_ERROR";
+		case FileError::INVALID_FORMAT_ERROR:      return "INVALID_FORMAT_ERROR";
+		case FileError::UNSUPPORTED_VERSION_ERROR: return "UNSUPPORTED_VERSION_ERROR";
+		case FileError::CORRUPTED_FILE_ERROR:      return "CORRUPTED_FILE_ERROR";
+		default: return "Invalid enum value";
+		}
+	}
+								 
+	inline std::string toString(const ImportError value)
+	{
+		switch (value)
+		{
+		case ImportError::NO_ERROR:                  return "NO_ERROR";
+		case ImportError::FILE_OPENING_ERROR:        return "FILE_OPENING_ERROR";
+		case ImportError::UNSUPPORTED_FORMAT_ERROR:  return "UNSUPPORTED_FORMAT_ERROR";
+		case ImportError::PARSING_ERROR:             return "PARSING_ERROR";
+		case ImportError::UNSUPPORTED_FEATURE_ERROR: return "UNSUPPORTED_FEATURE_ERROR";
+		case ImportError::INVALID_ACCESSOR_ERROR:    return "INVALID_ACCESSOR_ERROR";
+		case ImportError::INDEX_OUT_OF_RANGE_ERROR:  return "INDEX_OUT_OF_RANGE_ERROR";
+		case ImportError::CACHE_ERROR:               return "CACHE_ERROR";
+		default: return "Invalid enum value";
+		}
+	}
+								 
+	inline std::string toString(const ReflectionError value)
+	{
+		switch (value)
+		{
+		case ReflectionError::NO_ERROR:                              return "NO_ERROR";
+		case ReflectionError::INVALID_SPIRV_ERROR:                   return "INVALID_SPIRV_ERROR";
+		case ReflectionError::UNSUPPORTED_STAGE_ERROR:               return "UNSUPPORTED_STAGE_ERROR";
+		case ReflectionError::UNSUPPORTED_RESOURCE_ERROR:            return "UNSUPPORTED_RESOURCE_ERROR";
+		case ReflectionError::BINDING_CONFLICT_ERROR:                return "BINDING_CONFLICT_ERROR";
+		case ReflectionError::UNKNOWN_SPECIALIZATION_CONSTANT_ERROR: return "UNKNOWN_SPECIALIZATION_CONSTANT_ERROR";
+		case ReflectionError::SPECIALIZATION_CONSTANT_SIZE_ERROR:    return "SPECIALIZATION_CONSTANT_SIZE_ERROR";
 		default: return "Invalid enum value";
 		}
 	}
@@ -1370,8 +1954,11 @@ namespace SOULKAN_NAMESPACE
 		switch (value)
 		{
 		case ShaderError::NO_ERROR: return "NO_ERROR";
+		case ShaderError::SHADER_FILE_OPENING_ERROR: return "SHADER_FILE_OPENING_ERROR";
 		case ShaderError::SHADER_MODULE_CREATION_ERROR: return "SHADER_MODULE_CREATION_ERROR";
 		case ShaderError::SHADER_MODULE_DELETION_ERROR: return "SHADER_MODULE_DELETION_ERROR";
+		case ShaderError::INVALID_SPIRV_ERROR: return "INVALID_SPIRV_ERROR";
+		case ShaderError::SHADER_MODULE_NOT_CACHED_ERROR: return "SHADER_MODULE_NOT_CACHED_ERROR";
 		default: return "Invalid enum value";
 		}
 	}
@@ -1406,6 +1993,10 @@ namespace SOULKAN_NAMESPACE
 		case GraphicsPipelineError::PIPELINE_LAYOUT_DESTRUCTION_ERROR: return "PIPELINE_LAYOUT_DESTRUCTION_ERROR";
 		case GraphicsPipelineError::GRAPHICS_PIPELINE_CREATE_INFO_ERROR: return "GRAPHICS_PIPELINE_CREATE_INFO_ERROR";
 		case GraphicsPipelineError::PIPELINE_CREATION_ERROR: return "PIPELINE_CREATION_ERROR";
+		case GraphicsPipelineError::PIPELINE_DELETION_ERROR: return "PIPELINE_DELETION_ERROR";
+		case GraphicsPipelineError::PIPELINE_CACHE_DATA_ERROR: return "PIPELINE_CACHE_DATA_ERROR";
+		case GraphicsPipelineError::PIPELINE_CACHE_DESTRUCTION_ERROR: return "PIPELINE_CACHE_DESTRUCTION_ERROR";
+		case GraphicsPipelineError::UNCACHED_SHADER_MODULE_ERROR: return "UNCACHED_SHADER_MODULE_ERROR";
 		default: return "Invalid enum value";
 		}
 	}
@@ -1421,6 +2012,9 @@ namespace SOULKAN_NAMESPACE
 		case AllocationError::INSUFFICIENT_FREE_MEMORY_ERROR:        return "INSUFFICIENT_FREE_MEMORY_ERROR";
 		case AllocationError::BIND_BUFFER_MEMORY_ERROR:              return "BIND_BUFFER_MEMORY_ERROR";
 		case AllocationError::MAP_MEMORY_ERROR:                      return "MAP_MEMORY_ERROR";
+		case AllocationError::BIND_IMAGE_MEMORY_ERROR:               return "BIND_IMAGE_MEMORY_ERROR";
+		case AllocationError::INVALID_TRANSIENT_LIFETIME_ERROR:      return "INVALID_TRANSIENT_LIFETIME_ERROR";
+		case AllocationError::INVALID_TRANSIENT_IMAGE_ERROR:         return "INVALID_TRANSIENT_IMAGE_ERROR";
 		default: return "Invalid enum value";
 		}
 	}
@@ -1429,9 +2023,12 @@ namespace SOULKAN_NAMESPACE
 	{
 		switch (value)
 		{
-		case BufferError::NO_ERROR:                 return "NO_ERROR";
-		case BufferError::BUFFER_CREATION_ERROR:    return "BUFFER_CREATION_ERROR";
-		case BufferError::BUFFER_DESTRUCTION_ERROR: return "BUFFER_DESTRUCTION_ERROR";
+		case BufferError::NO_ERROR:                    return "NO_ERROR";
+		case BufferError::BUFFER_CREATION_ERROR:       return "BUFFER_CREATION_ERROR";
+		case BufferError::BUFFER_DESTRUCTION_ERROR:    return "BUFFER_DESTRUCTION_ERROR";
+		case BufferError::RING_BUFFER_FULL_ERROR:      return "RING_BUFFER_FULL_ERROR";
+		case BufferError::BUFFER_MEMORY_ERROR:         return "BUFFER_MEMORY_ERROR";
+		case BufferError::RING_BUFFER_TOO_LARGE_ERROR: return "RING_BUFFER_TOO_LARGE_ERROR";
 		default: return "Invalid enum value";
 		}
 	}
@@ -1440,71 +2037,212 @@ namespace SOULKAN_NAMESPACE
 	{
 		switch (value)
 		{
-		case MeshError::NO_ERROR:                    return "NO_ERROR";
-		case MeshError::TRIANGLE_MESH_LOADING_ERROR: return "TRIANGLE_MESH_LOADING_ERROR";
+		case MeshError::NO_ERROR:                     return "NO_ERROR";
+		case MeshError::TRIANGLE_MESH_LOADING_ERROR:  return "TRIANGLE_MESH_LOADING_ERROR";
+		case MeshError::INDEX_OUT_OF_RANGE_ERROR:     return "INDEX_OUT_OF_RANGE_ERROR";
+		case MeshError::MESH_NOT_INDEXED_ERROR:       return "MESH_NOT_INDEXED_ERROR";
+		case MeshError::INVALID_MESHLET_LIMITS_ERROR: return "INVALID_MESHLET_LIMITS_ERROR";
+		case MeshError::INVALID_LOD_PARAMETERS_ERROR: return "INVALID_LOD_PARAMETERS_ERROR";
 		default: return "Invalid enum value";
 		}
 	}
 
-	/*Debug / Util functions*/
-
-	/*@brief Checks if a given SkResult contains an error
-	*@param result SkResult, containing value and error, returned from a function
-	*@return Boolean indicating if result contains an error
-	*/
-	template<class V, class E>
-	constexpr inline bool error(const SkResult<V, E>& result) noexcept
+	inline std::string toString(const DescriptorError value)
 	{
-		if (result.error != E::NO_ERROR)
+		switch (value)
 		{
-			return true;
+		case DescriptorError::NO_ERROR:                                return "NO_ERROR";
+		case DescriptorError::DESCRIPTOR_SET_LAYOUT_CREATION_ERROR:    return "DESCRIPTOR_SET_LAYOUT_CREATION_ERROR";
+		case DescriptorError::DESCRIPTOR_SET_LAYOUT_DESTRUCTION_ERROR: return "DESCRIPTOR_SET_LAYOUT_DESTRUCTION_ERROR";
+		case DescriptorError::DESCRIPTOR_POOL_CREATION_ERROR:          return "DESCRIPTOR_POOL_CREATION_ERROR";
+		case DescriptorError::DESCRIPTOR_POOL_DESTRUCTION_ERROR:       return "DESCRIPTOR_POOL_DESTRUCTION_ERROR";
+		case DescriptorError::DESCRIPTOR_SET_ALLOCATION_ERROR:         return "DESCRIPTOR_SET_ALLOCATION_ERROR";
+		case DescriptorError::PIPELINE_LAYOUT_CREATION_ERROR:          return "PIPELINE_LAYOUT_CREATION_ERROR";
+		case DescriptorError::PIPELINE_LAYOUT_DESTRUCTION_ERROR:       return "PIPELINE_LAYOUT_DESTRUCTION_ERROR";
+		case DescriptorError::DESCRIPTOR_POOL_RESET_ERROR:             return "DESCRIPTOR_POOL_RESET_ERROR";
+		case DescriptorError::BINDLESS_SLOTS_EXHAUSTED_ERROR:          return "BINDLESS_SLOTS_EXHAUSTED_ERROR";
+		case DescriptorError::INVALID_BINDLESS_INDEX_ERROR:            return "INVALID_BINDLESS_INDEX_ERROR";
+		case DescriptorError::INVALID_DESCRIPTOR_WRITE_ERROR:          return "INVALID_DESCRIPTOR_WRITE_ERROR";
+		case DescriptorError::BINDLESS_SET_NOT_CREATED_ERROR:          return "BINDLESS_SET_NOT_CREATED_ERROR";
+		case DescriptorError::BINDLESS_LIMIT_EXCEEDED_ERROR:           return "BINDLESS_LIMIT_EXCEEDED_ERROR";
+		default: return "Invalid enum value";
 		}
+	}
 
-		else
+	inline std::string toString(const ComputePipelineError value)
+	{
+		switch (value)
 		{
-			return false;
+		case ComputePipelineError::NO_ERROR:                        return "NO_ERROR";
+		case ComputePipelineError::PIPELINE_LAYOUT_CREATION_ERROR:  return "PIPELINE_LAYOUT_CREATION_ERROR";
+		case ComputePipelineError::COMPUTE_PIPELINE_CREATION_ERROR: return "COMPUTE_PIPELINE_CREATION_ERROR";
+		case ComputePipelineError::SHADER_MODULE_CREATION_ERROR:    return "SHADER_MODULE_CREATION_ERROR";
+		case ComputePipelineError::UNCACHED_SHADER_MODULE_ERROR:    return "UNCACHED_SHADER_MODULE_ERROR";
+		default: return "Invalid enum value";
 		}
 	}
 
-	/*@brief Returns a formatted error message containing error type and result value and error types
-	*@param result  SkResult, containing value and error, returned from a function
-	*@return Formatted error message as std::string
-	*/
-	template<class V, class E>
-	constexpr inline std::string returnError(const SkResult<V, E>& result) noexcept
+	inline std::string toString(const CullingError value)
 	{
-		return std::string("ERROR : " + toString(static_cast<E>(result.error)) + " when returning SkResult(" + typeid(V).name() + ", " + typeid(E).name() + ")\n");
+		switch (value)
+		{
+		case CullingError::NO_ERROR:                              return "NO_ERROR";
+		case CullingError::INSTANCE_COUNT_EXCEEDS_MAX_DRAW_COUNT: return "INSTANCE_COUNT_EXCEEDS_MAX_DRAW_COUNT";
+		default: return "Invalid enum value";
+		}
 	}
 
-	/*@brief Checks if a given SkResult contains an error using error() and then logs it
-	*@param result  SkResult, containing value and error, returned from a function
-	*@return Boolean indicating if result contains an error
-	*/
-	template<class V, class E>
-	constexpr inline bool logError(const SkResult<V, E>& result) noexcept
+	inline std::string toString(const RenderGraphError value)
 	{
-		if (error(result))
+		switch (value)
 		{
-			std::cout << returnError(result) << std::endl;
-			return 1;
+		case RenderGraphError::NO_ERROR:                      return "NO_ERROR";
+		case RenderGraphError::INVALID_RESOURCE_ERROR:        return "INVALID_RESOURCE_ERROR";
+		case RenderGraphError::INVALID_PASS_ERROR:            return "INVALID_PASS_ERROR";
+		case RenderGraphError::INVALID_USAGE_ERROR:           return "INVALID_USAGE_ERROR";
+		case RenderGraphError::DEPENDENCY_CYCLE_ERROR:        return "DEPENDENCY_CYCLE_ERROR";
+		case RenderGraphError::ATTACHMENT_EXTENT_ERROR:       return "ATTACHMENT_EXTENT_ERROR";
+		case RenderGraphError::NOT_COMPILED_ERROR:            return "NOT_COMPILED_ERROR";
+		case RenderGraphError::MISSING_RESOURCE_HANDLE_ERROR: return "MISSING_RESOURCE_HANDLE_ERROR";
+		case RenderGraphError::RENDER_PASS_CREATION_ERROR:    return "RENDER_PASS_CREATION_ERROR";
+		case RenderGraphError::FRAMEBUFFER_CREATION_ERROR:    return "FRAMEBUFFER_CREATION_ERROR";
+		case RenderGraphError::RENDER_PASS_DESTRUCTION_ERROR: return "RENDER_PASS_DESTRUCTION_ERROR";
+		case RenderGraphError::ALIASED_LIFETIME_ERROR:        return "ALIASED_LIFETIME_ERROR";
+		default: return "Invalid enum value";
 		}
-
-		return 0;
 	}
 
-	/*@brief Calls logError() on result and then returns the value of the result
-	*@param result  SkResult, containing value and error, returned from a function
-	*@return The value of result
-	*/
-	template<class V, class E>
-	inline V retLog(const SkResult<V, E>& result) noexcept
+	inline std::string toString(const RenderTargetError value)
 	{
-		logError(result);
+		switch (value)
+		{
+		case RenderTargetError::NO_ERROR:                       return "NO_ERROR";
+		case RenderTargetError::IMAGE_CREATION_ERROR:           return "IMAGE_CREATION_ERROR";
+		case RenderTargetError::IMAGE_VIEW_CREATION_ERROR:      return "IMAGE_VIEW_CREATION_ERROR";
+		case RenderTargetError::IMAGE_ALLOCATION_ERROR:         return "IMAGE_ALLOCATION_ERROR";
+		case RenderTargetError::IMAGE_DESTRUCTION_ERROR:        return "IMAGE_DESTRUCTION_ERROR";
+		case RenderTargetError::UNSUPPORTED_SAMPLE_COUNT_ERROR: return "UNSUPPORTED_SAMPLE_COUNT_ERROR";
+		default: return "Invalid enum value";
+		}
+	}
 
-		return result.value;
+	inline std::string toString(const GpuProfilerError value)
+	{
+		switch (value)
+		{
+		case GpuProfilerError::NO_ERROR:                       return "NO_ERROR";
+		case GpuProfilerError::TIMESTAMPS_NOT_SUPPORTED_ERROR: return "TIMESTAMPS_NOT_SUPPORTED_ERROR";
+		case GpuProfilerError::QUERY_POOL_CREATION_ERROR:      return "QUERY_POOL_CREATION_ERROR";
+		case GpuProfilerError::QUERY_POOL_DESTRUCTION_ERROR:   return "QUERY_POOL_DESTRUCTION_ERROR";
+		case GpuProfilerError::QUERY_RESULTS_ERROR:            return "QUERY_RESULTS_ERROR";
+		case GpuProfilerError::RESULTS_NOT_AVAILABLE_ERROR:    return "RESULTS_NOT_AVAILABLE_ERROR";
+		case GpuProfilerError::ZONE_OVERFLOW_ERROR:            return "ZONE_OVERFLOW_ERROR";
+		case GpuProfilerError::UNBALANCED_ZONE_ERROR:          return "UNBALANCED_ZONE_ERROR";
+		default: return "Invalid enum value";
+		}
 	}
 
-	/*@brief Checks if result contains an error using error() and then returns it if it does, else return the current error
+	inline std::string toString(const DrawQueryError value)
+	{
+		switch (value)
+		{
+		case DrawQueryError::NO_ERROR:                     return "NO_ERROR";
+		case DrawQueryError::QUERY_POOL_CREATION_ERROR:    return "QUERY_POOL_CREATION_ERROR";
+		case DrawQueryError::QUERY_POOL_DESTRUCTION_ERROR: return "QUERY_POOL_DESTRUCTION_ERROR";
+		case DrawQueryError::QUERY_RESULTS_ERROR:          return "QUERY_RESULTS_ERROR";
+		case DrawQueryError::RESULTS_NOT_AVAILABLE_ERROR:  return "RESULTS_NOT_AVAILABLE_ERROR";
+		case DrawQueryError::GROUP_OVERFLOW_ERROR:         return "GROUP_OVERFLOW_ERROR";
+		case DrawQueryError::UNBALANCED_GROUP_ERROR:       return "UNBALANCED_GROUP_ERROR";
+		default: return "Invalid enum value";
+		}
+	}
+
+	inline std::string toString(const TraceError value)
+	{
+		switch (value)
+		{
+		case TraceError::NO_ERROR:                                return "NO_ERROR";
+		case TraceError::INVALID_FRAME_RANGE_ERROR:               return "INVALID_FRAME_RANGE_ERROR";
+		case TraceError::FILE_WRITE_ERROR:                        return "FILE_WRITE_ERROR";
+		case TraceError::CALIBRATION_ERROR:                       return "CALIBRATION_ERROR";
+		case TraceError::CALIBRATION_NOT_SUPPORTED_ERROR:         return "CALIBRATION_NOT_SUPPORTED_ERROR";
+		case TraceError::CALIBRATION_EXTENSION_NOT_ENABLED_ERROR: return "CALIBRATION_EXTENSION_NOT_ENABLED_ERROR";
+		default: return "Invalid enum value";
+		}
+	}
+
+	inline std::string toString(const FrameStatisticsError value)
+	{
+		switch (value)
+		{
+		case FrameStatisticsError::NO_ERROR:                 return "NO_ERROR";
+		case FrameStatisticsError::NO_FRAME_ERROR:           return "NO_FRAME_ERROR";
+		case FrameStatisticsError::INVALID_PERCENTILE_ERROR: return "INVALID_PERCENTILE_ERROR";
+		case FrameStatisticsError::INVALID_HISTOGRAM_ERROR:  return "INVALID_HISTOGRAM_ERROR";
+		case FrameStatisticsError::FILE_WRITE_ERROR:         return "FILE_WRITE_ERROR";
+		default: return "Invalid enum value";
+		}
+	}
+
+	/*Debug / Util functions*/
+
+	/*@brief Checks if a given SkResult contains an error
+	*@param result SkResult, containing value and error, returned from a function
+	*@return Boolean indicating if result contains an error
+	*/
+	template<class V, class E>
+	constexpr inline bool error(const SkResult<V, E>& result) noexcept
+	{
+		if (result.error != E::NO_ERROR)
+		{
+			return true;
+		}
+
+		else
+		{
+			return false;
+		}
+	}
+
+	/*@brief Returns a formatted error message containing error type and result value and error types
+	*@param result  SkResult, containing value and error, returned from a function
+	*@return Formatted error message as std::string
+	*/
+	template<class V, class E>
+	constexpr inline std::string returnError(const SkResult<V, E>& result) noexcept
+	{
+		return std::string("ERROR : " + toString(static_cast<E>(result.error)) + " when returning SkResult(" + typeid(V).name() + ", " + typeid(E).name() + ")\n");
+	}
+
+	/*@brief Checks if a given SkResult contains an error using error() and then logs it
+	*@param result  SkResult, containing value and error, returned from a function
+	*@return Boolean indicating if result contains an error
+	*/
+	template<class V, class E>
+	constexpr inline bool logError(const SkResult<V, E>& result) noexcept
+	{
+		if (error(result))
+		{
+			std::cout << returnError(result) << std::endl;
+			return 1;
+		}
+
+		return 0;
+	}
+
+	/*@brief Calls logError() on result and then returns the value of the result
+	*@param result  SkResult, containing value and error, returned from a function
+	*@return The value of result
+	*/
+	template<class V, class E>
+	inline V retLog(const SkResult<V, E>& result) noexcept
+	{
+		logError(result);
+
+		return result.value;
+	}
+
+	/*@brief Checks if result contains an error using error() and then returns it if it does, else return the current error
 	*@param result SkResult, containing value and error, returned from a function
 	*@param err the current error to be compared against result.error
 	*@return The error of result if result contains an error, else returns err
@@ -1598,21 +2336,21 @@ namespace SOULKAN_NAMESPACE
 			vk::VertexInputAttributeDescription positionAttribute = {};
 			positionAttribute.binding = bindingIndex;
 			positionAttribute.location = 0;
-			positionAttribute.format = vk::Format::eR32G32B32Sfloat;
+			positionAttribute.format = attributeFormat;
 			positionAttribute.offset = offsetof(Vertex, position);
 			vertexInputAttributeDescriptons.emplace_back(positionAttribute);
 
 			vk::VertexInputAttributeDescription normalAttribute = {};
 			normalAttribute.binding = bindingIndex;
 			normalAttribute.location = 1;
-			normalAttribute.format = vk::Format::eR32G32B32Sfloat;
+			normalAttribute.format = attributeFormat;
 			normalAttribute.offset = offsetof(Vertex, normal);
 			vertexInputAttributeDescriptons.emplace_back(normalAttribute);
 
 			vk::VertexInputAttributeDescription colorAttribute = {};
 			colorAttribute.binding = bindingIndex;
 			colorAttribute.location = 2;
-			colorAttribute.format = vk::Format::eR32G32B32Sfloat;
+			colorAttribute.format = attributeFormat;
 			colorAttribute.offset = offsetof(Vertex, color);
 			vertexInputAttributeDescriptons.emplace_back(colorAttribute);
 
@@ -1625,7 +2363,7 @@ namespace SOULKAN_NAMESPACE
 		SOULKAN_MATHS_NAMESPACE::Vec3 color;
 	};
 
-	/*Typical Mesh holding a list of Vertices*/
+	/*Typical Mesh holding a list of Vertices and, if it is indexed, a list of indices (3 per triangle) referring to these vertices*/
 	struct Mesh
 	{
 		Mesh(std::vector<Vertex> vert)
@@ -1633,11 +2371,36 @@ namespace SOULKAN_NAMESPACE
 			vertices = vert;
 		}
 
+		Mesh(std::vector<Vertex> vert, std::vector<uint32_t> ind)
+		{
+			vertices = vert;
+			indices = ind;
+		}
+
 		Mesh()
 		{
 			vertices = {};
 		}
 
+		/*Returns true if the mesh has to be drawn with an index buffer*/
+		bool isIndexed() const
+		{
+			return !indices.empty();
+		}
+
+		/*Returns the smallest index type able to address every vertex of the mesh,
+		* 0xFFFF is left out of the 16 bits range as it is the primitive restart value*/
+		vk::IndexType getIndexType() const
+		{
+			return (vertices.size() < std::numeric_limits<uint16_t>::max() ? vk::IndexType::eUint16 : vk::IndexType::eUint32);
+		}
+
+		/*Returns the size in bytes of the index buffer of the mesh, indices are stored using getIndexType()*/
+		vk::DeviceSize getIndexBufferSize() const
+		{
+			return static_cast<vk::DeviceSize>(indices.size()) * (getIndexType() == vk::IndexType::eUint16 ? sizeof(uint16_t) : sizeof(uint32_t));
+		}
+
 		//inline SkResult<std::vector<Vertex>, UndefinedError> getVertices()
 		//{
 		//	SkResult result(static_cast<std::vector<Vertex>>(std::vector<Vertex>()), static_cast<UndefinedError>(UndefinedError::NO_ERROR));
@@ -1647,3402 +2410,16798 @@ namespace SOULKAN_NAMESPACE
 		//}
 
 		std::vector<Vertex> vertices;
-	};
 
-	/*GLFW
-	* Main functions concerning init and terminate, window creation.
-	*/
+		//Always kept as uint32_t on the CPU side, narrowed to getIndexType() when written into an index buffer
+		std::vector<uint32_t> indices;
+	};
 
-	/**
-		* @brief Initializes GLFW, must be called before any GLFW operation.
-		*
-		* @return SkResult(Result from glfwInit(), GLFWError)
-		*/
-	inline SkResult<uint32_t, GLFWError> initGlfw() noexcept
+	/*@brief Returns the bits of a float, -0.0f being turned into 0.0f so that both are welded together*/
+	inline uint32_t getCanonicalFloatBits(const float value) noexcept
 	{
-		SkResult result(static_cast<uint32_t>(glfwInit()), static_cast<GLFWError>(GLFWError::NO_ERROR));
-
-		if (!result.value)
-		{
-			result.error = GLFWError::INIT_ERROR;
-
-		}
-		else
+		if (value == 0.0f)
 		{
-			glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+			return 0;
 		}
 
-		return result;
+		uint32_t bits = 0;
+		std::memcpy(&bits, &value, sizeof(float));
+		return bits;
 	}
 
-	/**
-		* @brief Terminates glfw.
-		*
-		* @return SkResult(bool signaling if the operation worked or not, GLFWError)
-		*/
-	inline SkResult<bool, GLFWError> terminateGlfw() noexcept
+	/*Hash of every attribute of a vertex, used to weld identical vertices*/
+	struct VertexBitwiseHash
 	{
-		SkResult result(static_cast<bool>(true), static_cast<GLFWError>(GLFWError::NO_ERROR));
+		size_t operator()(const Vertex& vertex) const noexcept
+		{
+			const float attributes[9] = { vertex.position.x, vertex.position.y, vertex.position.z,
+			                              vertex.normal.x,   vertex.normal.y,   vertex.normal.z,
+			                              vertex.color.x,    vertex.color.y,    vertex.color.z };
 
-		glfwTerminate();
+			//FNV-1a over the canonical bits of the attributes
+			uint64_t hash = 14695981039346656037ull;
+			for (const float attribute : attributes)
+			{
+				hash ^= getCanonicalFloatBits(attribute);
+				hash *= 1099511628211ull;
+			}
 
-		return result;
-	}
+			return static_cast<size_t>(hash);
+		}
+	};
 
-	/**
-		* @brief Creates a GLFW Window, must be called after init().
-		*
-		* @param width : Sets the width in pixel
-		* @param height : Sets the height in pixel
-		* @param title : Sets the title of the GLFW window
-		* @param resizable : Sets if the window should be resizable or not
-		*
-		* @return inline SkResult<Pointer to the GLFW window, GLFWError>
-		*
-		*/
-	inline SkResult<GLFWwindow*, GLFWError> createGlfwWindow(const uint32_t width, const uint32_t height, std::string_view title, bool resizable) noexcept
+	/*Bitwise equality of every attribute of two vertices, used to weld identical vertices*/
+	struct VertexBitwiseEqual
 	{
-		SkResult result(static_cast<GLFWwindow*>(nullptr), static_cast<GLFWError>(GLFWError::NO_ERROR));
-
-		if (resizable)
-		{
-			glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
-		}
-		else
-		{
-			glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+		bool operator()(const Vertex& lhs, const Vertex& rhs) const noexcept
+		{
+			return (getCanonicalFloatBits(lhs.position.x) == getCanonicalFloatBits(rhs.position.x) &&
+			        getCanonicalFloatBits(lhs.position.y) == getCanonicalFloatBits(rhs.position.y) &&
+			        getCanonicalFloatBits(lhs.position.z) == getCanonicalFloatBits(rhs.position.z) &&
+			        getCanonicalFloatBits(lhs.normal.x)   == getCanonicalFloatBits(rhs.normal.x)   &&
+			        getCanonicalFloatBits(lhs.normal.y)   == getCanonicalFloatBits(rhs.normal.y)   &&
+			        getCanonicalFloatBits(lhs.normal.z)   == getCanonicalFloatBits(rhs.normal.z)   &&
+			        getCanonicalFloatBits(lhs.color.x)    == getCanonicalFloatBits(rhs.color.x)    &&
+			        getCanonicalFloatBits(lhs.color.y)    == getCanonicalFloatBits(rhs.color.y)    &&
+			        getCanonicalFloatBits(lhs.color.z)    == getCanonicalFloatBits(rhs.color.z));
 		}
+	};
 
-		result.value = glfwCreateWindow(width, height, std::string(title).c_str(), 0, nullptr);
+	/*@brief Welds the identical vertices of a mesh and returns the equivalent indexed mesh.
+	* A non indexed mesh is read as a triangle list, an indexed mesh keeps its triangles but gets its duplicate vertices merged.
+	* The order of the vertices follows their first use, which keeps the vertex fetches mostly sequential
+	*
+	* @param mesh The mesh to be welded
+	*
+	* @return SkResult(welded indexed mesh, MeshError)
+	*/
+	inline SkResult<Mesh, MeshError> weldVertices(const Mesh& mesh)
+	{
+		SkResult result(static_cast<Mesh>(Mesh()), static_cast<MeshError>(MeshError::NO_ERROR));
 
-		if (result.value == nullptr)
-		{
-			result.error = std::move(GLFWError::WINDOW_CREATION_ERROR);
-		}
+		size_t indexCount = (mesh.isIndexed() ? mesh.indices.size() : mesh.vertices.size());
 
-		return result;
-	}
+		std::unordered_map<Vertex, uint32_t, VertexBitwiseHash, VertexBitwiseEqual> uniqueVertices;
+		uniqueVertices.reserve(mesh.vertices.size());
 
-	inline SkResult<GLFWwindow*, GLFWError> createWindow(const uint32_t width, const uint32_t height, std::string_view title, bool resizable) noexcept
-	{
-		SkResult result(static_cast<GLFWwindow*>(nullptr), static_cast<GLFWError>(GLFWError::NO_ERROR));
+		Mesh weldedMesh;
+		weldedMesh.vertices.reserve(mesh.vertices.size());
+		weldedMesh.indices.reserve(indexCount);
 
-		auto initGlfwResult = initGlfw();
-		result.error = affectError(initGlfwResult, result.error);
+		for (size_t i = 0; i < indexCount; i++)
+		{
+			uint32_t sourceIndex = (mesh.isIndexed() ? mesh.indices[i] : static_cast<uint32_t>(i));
+			if (sourceIndex >= mesh.vertices.size())
+			{
+				result.error = MeshError::INDEX_OUT_OF_RANGE_ERROR;
+				return result;
+			}
 
-		auto createGlfwWindowResult = createGlfwWindow(width, height, title, resizable);
-		result.error = affectError(createGlfwWindowResult, result.error);
-		result.value = retLog(createGlfwWindowResult);
+			const Vertex& vertex = mesh.vertices[sourceIndex];
+
+			auto insertResult = uniqueVertices.emplace(vertex, static_cast<uint32_t>(weldedMesh.vertices.size()));
+			if (insertResult.second)
+			{
+				weldedMesh.vertices.emplace_back(vertex);
+			}
+
+			weldedMesh.indices.emplace_back(insertResult.first->second);
+		}
 
+		result.value = std::move(weldedMesh);
 		return result;
 	}
 
-	/*DEBUG UTILS
-	 *Useful functions concerning the debug utils messenger from vulkan.
-	 * @TODO : Clean up all that ugly stuff
-	 */
+	/*MESH OPTIMIZATION*/
 
-	 /*
-	 * @brief Override of a vulkan function to print vulkan messages directly to a file. Is the default debugCallback if none are given at instance creation time.
-	 */
-	inline static VKAPI_ATTR VkBool32 VKAPI_CALL debugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
-		VkDebugUtilsMessageTypeFlagsEXT messageType,
-		const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData,
-		void* pUserData)
+	/*Statistics of a simulated FIFO post-transform vertex cache :
+	* acmr = average cache miss ratio, transformed vertices per triangle (0.5 at best on regular grids, 3 at worst)
+	* atvr = average transform to vertex ratio, transformed vertices per unique vertex (1 at best)
+	*/
+	struct VertexCacheStatistics
 	{
-		std::ofstream debugFile;
-		debugFile.open("debugCallbackOutput.txt", std::ios::app);
+		uint32_t vertexTransformCount = 0;
 
-		switch (messageSeverity)
-		{
-		case VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT:
-			debugFile << "VERB : " << pCallbackData->pMessage << "\n";
-			break;
+		float acmr = 0.0f;
+		float atvr = 0.0f;
+	};
 
-		case VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT:
-			debugFile << "INFO : " << pCallbackData->pMessage << "\n";
-			break;
+	/*Mesh returned by optimizeMesh() along with the vertex cache statistics of the mesh before and after optimization*/
+	struct OptimizedMesh
+	{
+		Mesh mesh;
 
-		case VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT:
-			debugFile << "WARN : " << pCallbackData->pMessage << "\n";
-			break;
+		VertexCacheStatistics statisticsBefore;
+		VertexCacheStatistics statisticsAfter;
+	};
 
-		case VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT:
-			debugFile << "ERRO : " << pCallbackData->pMessage << "\n";
-			break;
+	/*@brief Simulates a FIFO post-transform vertex cache of a given size over a triangle list
+	*
+	* @param indices The indices of the triangle list (3 per triangle)
+	* @param vertexCount The number of vertices referred to by the indices
+	* @param cacheSize The number of entries of the simulated cache (default is 16)
+	*
+	* @return SkResult(statistics of the simulated cache, MeshError)
+	*/
+	inline SkResult<VertexCacheStatistics, MeshError> analyzeVertexCache(const std::vector<uint32_t>& indices, const size_t vertexCount, const uint32_t cacheSize = 16)
+	{
+		SkResult result(static_cast<VertexCacheStatistics>(VertexCacheStatistics()), static_cast<MeshError>(MeshError::NO_ERROR));
 
+		//A vertex is in the cache if it was transformed less than cacheSize transforms ago, which is exactly a FIFO cache
+		std::vector<uint32_t> cacheTimestamps(vertexCount, 0);
+		std::vector<bool> usedVertices(vertexCount, false);
+		uint32_t timestamp = cacheSize + 1;
+		uint32_t uniqueVertexCount = 0;
 
-		}
+		for (const uint32_t index : indices)
+		{
+			if (index >= vertexCount)
+			{
+				result.error = MeshError::INDEX_OUT_OF_RANGE_ERROR;
+				return result;
+			}
 
-		return VK_FALSE;
-	}
+			if (timestamp - cacheTimestamps[index] > cacheSize)
+			{
+				cacheTimestamps[index] = timestamp++;
+				result.value.vertexTransformCount++;
+			}
 
-	/*
-	* @brief Calls a vulkan function via a function pointer to create the debugUtilsMessenger
-	*/
-	inline VkResult CreateDebugUtilsMessengerEXT(VkInstance instance, const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugUtilsMessengerEXT* pCallback) noexcept
-	{
-		auto func = (PFN_vkCreateDebugUtilsMessengerEXT)vkGetInstanceProcAddr(instance, "vkCreateDebugUtilsMessengerEXT");
-		if (func != nullptr) {
-			return func(instance, pCreateInfo, pAllocator, pCallback);
-		}
-		else {
-			return VK_ERROR_EXTENSION_NOT_PRESENT;
+			if (!usedVertices[index])
+			{
+				usedVertices[index] = true;
+				uniqueVertexCount++;
+			}
 		}
+
+		size_t triangleCount = indices.size() / 3;
+		result.value.acmr = (triangleCount == 0 ? 0.0f : static_cast<float>(result.value.vertexTransformCount) / static_cast<float>(triangleCount));
+		result.value.atvr = (uniqueVertexCount == 0 ? 0.0f : static_cast<float>(result.value.vertexTransformCount) / static_cast<float>(uniqueVertexCount));
+
+		return result;
 	}
 
-	/*
-	* @brief Calls a vulkan function via a function pointer to destroy the debugUtilsMessenger
+	/*@brief Simulates a FIFO post-transform vertex cache of a given size over an indexed mesh, see analyzeVertexCache()
+	*
+	* @param mesh The indexed mesh to be analyzed
+	* @param cacheSize The number of entries of the simulated cache (default is 16)
+	*
+	* @return SkResult(statistics of the simulated cache, MeshError)
 	*/
-	inline void DestroyDebugUtilsMessengerEXT(VkInstance instance, VkDebugUtilsMessengerEXT callback, const VkAllocationCallbacks* pAllocator) noexcept
+	inline SkResult<VertexCacheStatistics, MeshError> analyzeVertexCache(const Mesh& mesh, const uint32_t cacheSize = 16)
 	{
-		auto func = (PFN_vkDestroyDebugUtilsMessengerEXT)vkGetInstanceProcAddr(instance, "vkDestroyDebugUtilsMessengerEXT");
-		if (func != nullptr) {
-			func(instance, callback, pAllocator);
-		}
+		return analyzeVertexCache(mesh.indices, mesh.vertices.size(), cacheSize);
 	}
 
-	/*
-	* @brief Creates a DebugUtilsMessengerCreateInfo with the basic information including the messageSeverity and MessageType Flags
+	/*@brief Reorders the triangles of a triangle list for post-transform vertex cache locality using Tipsify (Sander, Nehab and Barczak 2007).
+	* Triangles are emitted as fans around vertices chosen among the ones still in the cache, which runs in linear time
 	*
-	* @param debugCallback The debug callback to be used in the the debug utils messenger
+	* @param indices The indices of the triangle list (3 per triangle)
+	* @param vertexCount The number of vertices referred to by the indices
+	* @param cacheSize The number of entries of the targeted cache (default is 16)
+	* @param pClusters If not nullptr, receives the index of the first triangle of every cluster,
+	* a new cluster starting every time Tipsify reaches a dead end (used by optimizeOverdraw())
 	*
-	* @return DebugUtilsMessengerCreateInfo
+	* @return SkResult(reordered indices, MeshError)
 	*/
-	inline SkResult<vk::DebugUtilsMessengerCreateInfoEXT, DebugUtilsError> createDebugUtilsMessengerCreateInfo(PFN_vkDebugUtilsMessengerCallbackEXT debugCallback)
+	inline SkResult<std::vector<uint32_t>, MeshError> optimizeVertexCache(const std::vector<uint32_t>& indices, const size_t vertexCount, const uint32_t cacheSize = 16,
+		std::vector<uint32_t>* pClusters = nullptr)
 	{
-		SkResult result(static_cast<vk::DebugUtilsMessengerCreateInfoEXT>(vk::DebugUtilsMessengerCreateInfoEXT{}), static_cast<DebugUtilsError>(DebugUtilsError::NO_ERROR));
+		SkResult result(static_cast<std::vector<uint32_t>>(std::vector<uint32_t>()), static_cast<MeshError>(MeshError::NO_ERROR));
 
-		try
+		size_t triangleCount = indices.size() / 3;
+
+		//Vertex-triangle adjacency stored as offsets into a single array
+		std::vector<uint32_t> liveTriangleCounts(vertexCount, 0);
+		for (size_t i = 0; i < triangleCount * 3; i++)
 		{
-			result.value = vk::DebugUtilsMessengerCreateInfoEXT(vk::DebugUtilsMessengerCreateFlagsEXT(),
-				vk::DebugUtilsMessageSeverityFlagBitsEXT::eVerbose | vk::DebugUtilsMessageSeverityFlagBitsEXT::eWarning | vk::DebugUtilsMessageSeverityFlagBitsEXT::eError,
-				vk::DebugUtilsMessageTypeFlagBitsEXT::eGeneral | vk::DebugUtilsMessageTypeFlagBitsEXT::eValidation | vk::DebugUtilsMessageTypeFlagBitsEXT::ePerformance,
-				debugCallback,
-				nullptr);
-		}
-		catch (vk::SystemError err)
-		{
-			result.error = std::move(DebugUtilsError::DEBUG_CALLBACK_CI_ERROR);
-		}
-
-		return result;
-	}
+			if (indices[i] >= vertexCount)
+			{
+				result.error = MeshError::INDEX_OUT_OF_RANGE_ERROR;
+				return result;
+			}
 
-	/*@brief Creates a debug utils messenger via CreateDebugUtilsMessengerEXT()
-	*
-	* @param instance The vulkan instance used to create the debug utils messenger
-	* @param debugUtilsMessengerCreateInfo The create info to be used for creating the debug utils messenger
-	*
-	* @return SkResult(boolean indicating if the operation worked(true) or not(false), DebugUtilsError)
-	*/
-	inline SkResult<bool, DebugUtilsError> createDebugUtilsMessenger(vk::Instance instance, VkDebugUtilsMessengerCreateInfoEXT* debugUtilsMessengerCreateInfo)
-	{
-		SkResult result(static_cast<bool>(true), static_cast<DebugUtilsError>(DebugUtilsError::NO_ERROR));
+			liveTriangleCounts[indices[i]]++;
+		}
 
-		try
+		std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+		for (size_t v = 0; v < vertexCount; v++)
 		{
-			CreateDebugUtilsMessengerEXT(instance, debugUtilsMessengerCreateInfo, nullptr, nullptr);
+			adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveTriangleCounts[v];
 		}
-		catch (vk::SystemError err)
+
+		std::vector<uint32_t> adjacency(triangleCount * 3);
+		std::vector<uint32_t> adjacencyFill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for (size_t t = 0; t < triangleCount; t++)
 		{
-			result.value = false;
-			result.error = DebugUtilsError::DEBUG_CALLBACK_CREATION_ERROR;
+			for (size_t k = 0; k < 3; k++)
+			{
+				adjacency[adjacencyFill[indices[t * 3 + k]]++] = static_cast<uint32_t>(t);
+			}
 		}
 
-		return result;
-	}
+		std::vector<uint32_t> cacheTimestamps(vertexCount, 0);
+		std::vector<bool> emittedTriangles(triangleCount, false);
+		std::vector<uint32_t> deadEndStack;
+		std::vector<uint32_t> candidates;
 
-	/*Instance*/
+		std::vector<uint32_t> optimizedIndices;
+		optimizedIndices.reserve(triangleCount * 3);
 
-	/*
-	* @brief Gets the required extensions from glfwGetRequiredInstanceExtensions()
-	*
-	* @param validationEnabled Are the validation layers enabled or not, if they are then the DebugUtils extension is added to the list of required extensions
-	*
-	* @return SkResult(List of extension names, InstanceError)
-	*/
-	inline SkResult<std::vector<const char*>, InstanceError> getRequiredInstanceExtensions(bool validationEnabled) noexcept
-	{
-		SkResult result(static_cast<std::vector<const char*>>(std::vector<const char*>()), static_cast<InstanceError>(InstanceError::NO_ERROR));
+		uint32_t timestamp = cacheSize + 1;
+		size_t cursor = 0;
 
-		uint32_t glfwExtensionCount = 0;
-		const char** ppGlfwExtensions = nullptr;
+		const int64_t noVertex = -1;
+		int64_t fanningVertex = (triangleCount > 0 ? static_cast<int64_t>(indices[0]) : noVertex);
 
-		ppGlfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-		if (glfwExtensionCount == 0 || ppGlfwExtensions == nullptr)
+		if (pClusters != nullptr)
 		{
-			result.error = InstanceError::GET_REQUIRED_INSTANCE_EXTENSIONS_ERROR;
+			pClusters->clear();
+			if (triangleCount > 0)
+			{
+				pClusters->emplace_back(0);
+			}
 		}
 
-		auto extensions = std::vector<const char*>(ppGlfwExtensions, ppGlfwExtensions + glfwExtensionCount);
-		if (validationEnabled)
+		while (fanningVertex != noVertex)
 		{
-			extensions.emplace_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+			candidates.clear();
+
+			//Emits every remaining triangle around the fanning vertex
+			for (uint32_t a = adjacencyOffsets[fanningVertex]; a < adjacencyOffsets[fanningVertex + 1]; a++)
+			{
+				uint32_t triangle = adjacency[a];
+				if (emittedTriangles[triangle])
+				{
+					continue;
+				}
+
+				for (size_t k = 0; k < 3; k++)
+				{
+					uint32_t vertex = indices[triangle * 3 + k];
+
+					optimizedIndices.emplace_back(vertex);
+					deadEndStack.emplace_back(vertex);
+					candidates.emplace_back(vertex);
+
+					liveTriangleCounts[vertex]--;
+
+					if (timestamp - cacheTimestamps[vertex] > cacheSize)
+					{
+						cacheTimestamps[vertex] = timestamp++;
+					}
+				}
+
+				emittedTriangles[triangle] = true;
+			}
+
+			//Next fanning vertex : the candidate that will stay in the cache the longest while its remaining triangles are emitted
+			int64_t nextVertex = noVertex;
+			int64_t bestPriority = -1;
+			for (const uint32_t candidate : candidates)
+			{
+				if (liveTriangleCounts[candidate] == 0)
+				{
+					continue;
+				}
+
+				int64_t priority = 0;
+				if (timestamp - cacheTimestamps[candidate] + 2 * liveTriangleCounts[candidate] <= cacheSize)
+				{
+					priority = timestamp - cacheTimestamps[candidate];
+				}
+
+				if (priority > bestPriority)
+				{
+					bestPriority = priority;
+					nextVertex = candidate;
+				}
+			}
+
+			//Dead end : falls back to recently used vertices, then to the next vertex in input order with remaining triangles
+			if (nextVertex == noVertex)
+			{
+				while (!deadEndStack.empty() && nextVertex == noVertex)
+				{
+					uint32_t vertex = deadEndStack.back();
+					deadEndStack.pop_back();
+
+					if (liveTriangleCounts[vertex] > 0)
+					{
+						nextVertex = vertex;
+					}
+				}
+
+				while (cursor < triangleCount * 3 && nextVertex == noVertex)
+				{
+					uint32_t vertex = indices[cursor++];
+					if (liveTriangleCounts[vertex] > 0)
+					{
+						nextVertex = vertex;
+					}
+				}
+
+				if (pClusters != nullptr && nextVertex != noVertex)
+				{
+					pClusters->emplace_back(static_cast<uint32_t>(optimizedIndices.size() / 3));
+				}
+			}
+
+			fanningVertex = nextVertex;
 		}
 
-		result.value = std::move(extensions);
+		result.value = std::move(optimizedIndices);
 		return result;
 	}
 
-	/*
-	* @brief Creates a vulkan ApplicationInfo.
-	*
-	* Any error is stored in the instanceError variable
+	/*@brief Reorders the clusters of a vertex cache optimized triangle list to reduce overdraw (Sander, Nehab and Barczak 2007).
+	* Clusters are first split further wherever their own cache miss ratio falls below threshold * the global one,
+	* then sorted so that clusters facing away from the center of the mesh, which tend to occlude the others, are drawn first
 	*
-	* @param pApplicationName Application name
-	* @param pEngineName Engine name
+	* @param indices The vertex cache optimized indices (3 per triangle)
+	* @param positions The position of every vertex
+	* @param clusters The first triangle of every cluster, as returned by optimizeVertexCache()
+	* @param cacheSize The number of entries of the targeted cache (default is 16)
+	* @param threshold How much the cache miss ratio may degrade to reduce overdraw (default is 1.05, 1 keeps the vertex cache efficiency)
 	*
-	* @return SkResult(application info, InstanceError)
+	* @return SkResult(reordered indices, MeshError)
 	*/
-	inline SkResult<vk::ApplicationInfo, InstanceError> createApplicationInfo(const std::string_view appName, const std::string_view engineName) noexcept
+	inline SkResult<std::vector<uint32_t>, MeshError> optimizeOverdraw(const std::vector<uint32_t>& indices, const std::vector<SOULKAN_MATHS_NAMESPACE::Vec3>& positions,
+		const std::vector<uint32_t>& clusters, const uint32_t cacheSize = 16, const float threshold = 1.05f)
 	{
-		SkResult result(static_cast<vk::ApplicationInfo>(vk::ApplicationInfo{}), static_cast<InstanceError>(InstanceError::NO_ERROR));
+		SkResult result(static_cast<std::vector<uint32_t>>(std::vector<uint32_t>()), static_cast<MeshError>(MeshError::NO_ERROR));
 
-		try
+		size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0)
 		{
-			result.value = vk::ApplicationInfo(std::string(appName).c_str(),
-				                               VK_MAKE_VERSION(1, 0, 0),
-				                               std::string(engineName).c_str(),
-				                               VK_MAKE_VERSION(1, 0, 0),
-				                               VK_API_VERSION_1_0);
+			return result;
 		}
-		catch (vk::SystemError err)
+
+		auto analyzeVertexCacheResult = analyzeVertexCache(indices, positions.size(), cacheSize);
+		if (logError(analyzeVertexCacheResult))
 		{
-			result.error = InstanceError::APPLICATION_INFO_CREATION_ERROR;
+			result.error = analyzeVertexCacheResult.error;
+			return result;
 		}
+		float clusterThreshold = threshold * analyzeVertexCacheResult.value.acmr;
 
-		return result;
-	}
-
-	/*
-	* @brief Creates a vulkan Instance.
-	*
-	* Any error is stored in the instanceError variable
-	*
-	* @param applicationInfo A vulkan applicationInfo
-	* @param extensions List of extension names (default is an empty vector of char*)
-	* @param validationLayers List of validation layer names (default is an empty vector of char*)
-	* @param debugCallback debugCallback (default is nullptr)
-	*
-	* @return SkResult(vulkan instance, InstanceError)
-	*/
-	inline SkResult<vk::Instance, InstanceError> createInstance(const vk::ApplicationInfo& applicationInfo, std::vector<const char*> extensions = std::vector<const char*>(), const std::vector<const char*>& validationLayers = std::vector<const char*>(),
-		const PFN_vkDebugUtilsMessengerCallbackEXT debugUtilsMessenger = nullptr)
-	{
-		SkResult result(static_cast<vk::Instance>(vk::Instance(nullptr)), static_cast<InstanceError>(InstanceError::NO_ERROR));
+		//Soft clusters, each one restarting from an empty cache
+		std::vector<uint32_t> softClusters;
+		std::vector<uint32_t> cacheTimestamps(positions.size(), 0);
+		uint32_t timestamp = cacheSize + 1;
 
-		if (extensions.empty())
+		for (size_t c = 0; c < clusters.size(); c++)
 		{
-			if (!validationLayers.empty())
-			{
-				auto getRequiredExtensionsResult = getRequiredInstanceExtensions(true);
-				result.error = std::move(affectError(getRequiredExtensionsResult, result.error));
+			size_t clusterStart = clusters[c];
+			size_t clusterEnd = (c + 1 < clusters.size() ? clusters[c + 1] : triangleCount);
 
-				extensions = retLog(getRequiredExtensionsResult);
-			}
-			else
+			size_t softClusterStart = clusterStart;
+			uint32_t softClusterMisses = 0;
+			timestamp += cacheSize + 1;
+
+			softClusters.emplace_back(static_cast<uint32_t>(clusterStart));
+
+			for (size_t t = clusterStart; t < clusterEnd; t++)
 			{
-				auto getRequiredExtensionsResult = getRequiredInstanceExtensions(false);
-				result.error = std::move(affectError(getRequiredExtensionsResult, result.error));
+				for (size_t k = 0; k < 3; k++)
+				{
+					uint32_t vertex = indices[t * 3 + k];
+					if (timestamp - cacheTimestamps[vertex] > cacheSize)
+					{
+						cacheTimestamps[vertex] = timestamp++;
+						softClusterMisses++;
+					}
+				}
 
-				extensions = retLog(getRequiredExtensionsResult);
+				float softClusterAcmr = static_cast<float>(softClusterMisses) / static_cast<float>(t - softClusterStart + 1);
+				if (t + 1 < clusterEnd && softClusterAcmr <= clusterThreshold)
+				{
+					softClusterStart = t + 1;
+					softClusterMisses = 0;
+					timestamp += cacheSize + 1;
+
+					softClusters.emplace_back(static_cast<uint32_t>(softClusterStart));
+				}
 			}
 		}
 
-		auto instanceCreateInfo = std::move(vk::InstanceCreateInfo(vk::InstanceCreateFlags(),
-			&applicationInfo,
-			static_cast<uint32_t>(validationLayers.size()),
-			validationLayers.data(),
-			static_cast<uint32_t>(extensions.size()),
-			extensions.data()));
+		//Area weighted centroid of the mesh, then sort key of every soft cluster
+		SOULKAN_MATHS_NAMESPACE::Vec3 meshCentroid(0.0f, 0.0f, 0.0f);
+		float meshArea = 0.0f;
 
+		std::vector<SOULKAN_MATHS_NAMESPACE::Vec3> clusterCentroids(softClusters.size(), SOULKAN_MATHS_NAMESPACE::Vec3(0.0f, 0.0f, 0.0f));
+		std::vector<SOULKAN_MATHS_NAMESPACE::Vec3> clusterNormals(softClusters.size(), SOULKAN_MATHS_NAMESPACE::Vec3(0.0f, 0.0f, 0.0f));
 
-		vk::DebugUtilsMessengerCreateInfoEXT debugUtilsMessengerCreateInfo = {};
+		for (size_t c = 0; c < softClusters.size(); c++)
+		{
+			size_t clusterStart = softClusters[c];
+			size_t clusterEnd = (c + 1 < softClusters.size() ? softClusters[c + 1] : triangleCount);
 
-		auto createDebugUtilsMessengerCreateInfoResult = std::move(createDebugUtilsMessengerCreateInfo(debugCallback));
-		debugUtilsMessengerCreateInfo = std::move(retLog(createDebugUtilsMessengerCreateInfoResult));
+			float clusterArea = 0.0f;
+			for (size_t t = clusterStart; t < clusterEnd; t++)
+			{
+				const SOULKAN_MATHS_NAMESPACE::Vec3& p0 = positions[indices[t * 3 + 0]];
+				const SOULKAN_MATHS_NAMESPACE::Vec3& p1 = positions[indices[t * 3 + 1]];
+				const SOULKAN_MATHS_NAMESPACE::Vec3& p2 = positions[indices[t * 3 + 2]];
 
-		//Doesn't work for now
-		//if (debugCallback == nullptr && !validationLayers.empty())
-		//{
-		//	auto createDebugUtilsMessengerCreateInfoResult = createDebugUtilsMessengerCreateInfo(debugCallback);
-		//	debugUtilsMessengerCreateInfo = retLog(createDebugUtilsMessengerCreateInfoResult);
-		//
-		//	debugUtilsMessengerCreateInfo.pfnUserCallback = debugCallback;
-		//}
-		//else if (debugCallback != nullptr && !validationLayers.empty())
-		//{
-		//	auto createDebugUtilsMessengerCreateInfoResult = createDebugUtilsMessengerCreateInfo(debugUtilsMessenger);
-		//	debugUtilsMessengerCreateInfo = retLog(createDebugUtilsMessengerCreateInfoResult);
-		//
-		//	debugUtilsMessengerCreateInfo.pfnUserCallback = debugUtilsMessenger;
-		//}
+				SOULKAN_MATHS_NAMESPACE::Vec3 normal = SOULKAN_MATHS_NAMESPACE::cross(SOULKAN_MATHS_NAMESPACE::Vec3(p1.x - p0.x, p1.y - p0.y, p1.z - p0.z),
+				                                                                     SOULKAN_MATHS_NAMESPACE::Vec3(p2.x - p0.x, p2.y - p0.y, p2.z - p0.z));
+				float area = SOULKAN_MATHS_NAMESPACE::length(normal);
 
-		debugUtilsMessengerCreateInfo.pfnUserCallback = debugCallback;
-		instanceCreateInfo.pNext = (VkDebugUtilsMessengerCreateInfoEXT*)&debugUtilsMessengerCreateInfo;
+				clusterCentroids[c].x += (p0.x + p1.x + p2.x) * (area / 3.0f);
+				clusterCentroids[c].y += (p0.y + p1.y + p2.y) * (area / 3.0f);
+				clusterCentroids[c].z += (p0.z + p1.z + p2.z) * (area / 3.0f);
 
-		vk::Instance instance;
-		try
-		{
-			instance = std::move(vk::createInstance(instanceCreateInfo));
+				clusterNormals[c].x += normal.x;
+				clusterNormals[c].y += normal.y;
+				clusterNormals[c].z += normal.z;
+
+				clusterArea += area;
+			}
+
+			meshCentroid.x += clusterCentroids[c].x;
+			meshCentroid.y += clusterCentroids[c].y;
+			meshCentroid.z += clusterCentroids[c].z;
+			meshArea += clusterArea;
+
+			if (clusterArea > 0.0f)
+			{
+				clusterCentroids[c].x /= clusterArea;
+				clusterCentroids[c].y /= clusterArea;
+				clusterCentroids[c].z /= clusterArea;
+			}
 		}
-		catch (vk::SystemError err)
+
+		if (meshArea > 0.0f)
 		{
-			result.error = InstanceError::INSTANCE_CREATION_ERROR;
+			meshCentroid.x /= meshArea;
+			meshCentroid.y /= meshArea;
+			meshCentroid.z /= meshArea;
 		}
 
-		result.value = std::move(instance);
-		return result;
-	}
+		std::vector<float> clusterKeys(softClusters.size(), 0.0f);
+		for (size_t c = 0; c < softClusters.size(); c++)
+		{
+			float normalLength = SOULKAN_MATHS_NAMESPACE::length(clusterNormals[c]);
+			if (normalLength > 0.0f)
+			{
+				SOULKAN_MATHS_NAMESPACE::Vec3 toCluster(clusterCentroids[c].x - meshCentroid.x, clusterCentroids[c].y - meshCentroid.y, clusterCentroids[c].z - meshCentroid.z);
+				clusterKeys[c] = SOULKAN_MATHS_NAMESPACE::dot(toCluster, clusterNormals[c]) / normalLength;
+			}
+		}
 
-	inline SkResult<vk::Instance, InstanceError> createInstance(const std::string_view appName, const std::string_view engineName, const std::vector<const char*>& extensions = std::vector<const char*>(),
-		const std::vector<const char*>& validationLayers = std::vector<const char*>(), const PFN_vkDebugUtilsMessengerCallbackEXT debugUtilsMessenger = nullptr) noexcept
-	{
-		SkResult result(vk::Instance(nullptr), InstanceError::NO_ERROR);
+		std::vector<uint32_t> clusterOrder(softClusters.size());
+		for (uint32_t c = 0; c < clusterOrder.size(); c++)
+		{
+			clusterOrder[c] = c;
+		}
+		std::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&](const uint32_t lhs, const uint32_t rhs) { return clusterKeys[lhs] > clusterKeys[rhs]; });
 
-		auto createApplicationInfoResult = createApplicationInfo(appName, engineName);
-		result.error = affectError(createApplicationInfoResult, result.error);
-		vk::ApplicationInfo applicationInfo = retLog(createApplicationInfoResult);
+		std::vector<uint32_t> optimizedIndices;
+		optimizedIndices.reserve(triangleCount * 3);
+		for (const uint32_t c : clusterOrder)
+		{
+			size_t clusterStart = softClusters[c];
+			size_t clusterEnd = (c + 1 < softClusters.size() ? softClusters[c + 1] : triangleCount);
 
-		auto createInstanceResult = createInstance(applicationInfo, extensions, validationLayers, debugUtilsMessenger);
-		result.error = std::move(affectError(createInstanceResult, result.error));
-		vk::Instance instance = retLog(createInstanceResult);
+			optimizedIndices.insert(optimizedIndices.end(), indices.begin() + clusterStart * 3, indices.begin() + clusterEnd * 3);
+		}
 
-		result.value = std::move(instance);
+		result.value = std::move(optimizedIndices);
 		return result;
 	}
 
-	/*
-	* @brief Creates a vulkan surface using glfwCreateWindowSurface()
-	*
-	* Any error is stored in the instanceError variable
+	/*@brief Returns the remap table ordering the vertices by first use in a triangle list, for vertex fetch locality.
+	* remap[oldIndex] = newIndex, unused vertices are mapped to std::numeric_limits<uint32_t>::max()
 	*
-	* @param instance A vulkan instance
-	* @param pWindow pointer to the GLFW window created with createGLFWWindow()
+	* @param indices The indices of the triangle list
+	* @param vertexCount The number of vertices referred to by the indices
 	*
-	* @return SkResult(
+	* @return SkResult(remap table, MeshError)
 	*/
-	inline SkResult<vk::SurfaceKHR, InstanceError> createGLFWWindowSurface(const vk::Instance& instance, GLFWwindow* pWindow) noexcept
+	inline SkResult<std::vector<uint32_t>, MeshError> getVertexFetchRemap(const std::vector<uint32_t>& indices, const size_t vertexCount)
 	{
-		SkResult result(static_cast<vk::SurfaceKHR>(vk::SurfaceKHR(nullptr)), static_cast<InstanceError>(InstanceError::NO_ERROR));
+		SkResult result(static_cast<std::vector<uint32_t>>(std::vector<uint32_t>()), static_cast<MeshError>(MeshError::NO_ERROR));
 
-		VkSurfaceKHR rawSurface;
-		VkResult res = glfwCreateWindowSurface(instance, pWindow, nullptr, &rawSurface);
+		std::vector<uint32_t> remap(vertexCount, std::numeric_limits<uint32_t>::max());
+		uint32_t nextVertex = 0;
 
-		if (res != VK_SUCCESS || rawSurface == VK_NULL_HANDLE)
+		for (const uint32_t index : indices)
 		{
-			result.error = InstanceError::SURFACE_CREATION_ERROR;
+			if (index >= vertexCount)
+			{
+				result.error = MeshError::INDEX_OUT_OF_RANGE_ERROR;
+				return result;
+			}
+
+			if (remap[index] == std::numeric_limits<uint32_t>::max())
+			{
+				remap[index] = nextVertex++;
+			}
 		}
 
-		result.value = std::move(rawSurface);
+		result.value = std::move(remap);
 		return result;
 	}
 
-	/*PHYSICAL DEVICE*/
-
-
-	/*@brief Returns all the available physical devices on the machine
+	/*@brief Reorders the vertices of an indexed mesh by first use so that vertex fetches are mostly sequential, unused vertices are removed.
+	* Should run last, after the triangle order is final
 	*
-	* @param instance a vulkan instance
+	* @param mesh The indexed mesh to be reordered
 	*
-	* @return SkResult(vector of physical devices, PhysicalDeviceError)
+	* @return SkResult(reordered mesh, MeshError)
 	*/
-	inline SkResult<std::vector<vk::PhysicalDevice>, PhysicalDeviceError> getAvailablePhysicalDevices(const vk::Instance& instance) noexcept
+	inline SkResult<Mesh, MeshError> optimizeVertexFetch(const Mesh& mesh)
 	{
-		SkResult result(static_cast<std::vector<vk::PhysicalDevice>>(std::vector<vk::PhysicalDevice>()), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
-
-		auto availablePhysicalDevices = instance.enumeratePhysicalDevices();
+		SkResult result(static_cast<Mesh>(Mesh()), static_cast<MeshError>(MeshError::NO_ERROR));
 
-		if (availablePhysicalDevices.size() == 0)
+		auto getVertexFetchRemapResult = getVertexFetchRemap(mesh.indices, mesh.vertices.size());
+		if (logError(getVertexFetchRemapResult))
 		{
-			result.error = PhysicalDeviceError::NO_PHYSICAL_DEVICE_FOUND;
+			result.error = getVertexFetchRemapResult.error;
+			return result;
 		}
+		const std::vector<uint32_t>& remap = getVertexFetchRemapResult.value;
 
-		result.value = std::move(availablePhysicalDevices);
-		return result;
-	}
+		Mesh optimizedMesh;
+		optimizedMesh.indices.reserve(mesh.indices.size());
+		for (const uint32_t index : mesh.indices)
+		{
+			optimizedMesh.indices.emplace_back(remap[index]);
+		}
 
-	/*@brief Reserved for later use
-	*
-	* @param physicalDevice a vulkan physicaldevice
-	*
-	* @return boolean indicating if a given vulkan device is suitable(true) or not(false)
-	*/
-	constexpr inline bool isDeviceSuitable(const vk::PhysicalDevice& physicalDevice) noexcept
-	{
-		return true;
-	}
-
-	/* @brief Returns all of the suitable vulkan physical devices filtered through isDeviceSuitable()
-	 *
-	 * @param availablePhysicalDevices vector of the available vulkan physical devices (getAvailablePhysicalDevices())
-	 *
-	 * @return SkResult(Vector of physical devices, PhysicalDeviceError)
-	 */
-	inline SkResult<std::vector<vk::PhysicalDevice>, PhysicalDeviceError> getSuitablePhysicalDevices(const std::vector<vk::PhysicalDevice>& availablePhysicalDevices)
-	{
-		SkResult result(static_cast<std::vector<vk::PhysicalDevice>>(std::vector<vk::PhysicalDevice>()), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+		size_t usedVertexCount = 0;
+		for (const uint32_t newIndex : remap)
+		{
+			if (newIndex != std::numeric_limits<uint32_t>::max())
+			{
+				usedVertexCount++;
+			}
+		}
 
-		std::vector<vk::PhysicalDevice> suitablePhysicalDevices;
-		suitablePhysicalDevices.reserve(availablePhysicalDevices.size());
-		for (int i = 0; i < availablePhysicalDevices.size(); i++)
+		optimizedMesh.vertices.resize(usedVertexCount);
+		for (size_t v = 0; v < remap.size(); v++)
 		{
-			if (isDeviceSuitable(availablePhysicalDevices[i]))
+			if (remap[v] != std::numeric_limits<uint32_t>::max())
 			{
-				suitablePhysicalDevices.emplace_back(availablePhysicalDevices[i]);
+				optimizedMesh.vertices[remap[v]] = mesh.vertices[v];
 			}
 		}
 
-		result.value = std::move(suitablePhysicalDevices);
+		result.value = std::move(optimizedMesh);
 		return result;
 	}
 
-	/* @brief Returns the best vulkan physical device filtered through a score system
-	 *
-	 * @param suitablePhysicalDevices vector of the suitable vulkan physical devices (getSuitablePhysicalDevices())
-	 *
-	 * @return SkResult(Vulkan physical device, PhysicalDeviceError)
-	 */
-	inline SkResult<vk::PhysicalDevice, PhysicalDeviceError> getBestPhysicalDeviceByScore(const std::vector<vk::PhysicalDevice>& suitablePhysicalDevices)
+	/*@brief Optimizes an indexed mesh for the GPU : triangles are reordered for the post-transform vertex cache (optimizeVertexCache()),
+	* then for overdraw (optimizeOverdraw()), and vertices are finally reordered for fetch locality (optimizeVertexFetch()).
+	* Non indexed meshes have to go through weldVertices() first
+	*
+	* @param mesh The indexed mesh to be optimized
+	* @param cacheSize The number of entries of the targeted vertex cache (default is 16)
+	* @param overdrawThreshold How much the cache miss ratio may degrade to reduce overdraw (default is 1.05)
+	*
+	* @return SkResult(optimized mesh with its vertex cache statistics before and after optimization, MeshError)
+	*/
+	inline SkResult<OptimizedMesh, MeshError> optimizeMesh(const Mesh& mesh, const uint32_t cacheSize = 16, const float overdrawThreshold = 1.05f)
 	{
-		SkResult result(static_cast<vk::PhysicalDevice>(vk::PhysicalDevice(nullptr)), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+		SkResult result(static_cast<OptimizedMesh>(OptimizedMesh()), static_cast<MeshError>(MeshError::NO_ERROR));
 
-		int i = -1;
-		int index = -1;
-		uint32_t hiscore = 0;
-
-		for (const auto& physicalDevice : suitablePhysicalDevices)
+		if (!mesh.isIndexed())
 		{
-			i += 1;
-			uint32_t score = 0;
-
-			auto physicalDeviceProperties = physicalDevice.getProperties();
-			auto physicalDeviceFeatures = physicalDevice.getFeatures();
-
-			// Discrete GPUs have a significant performance advantage
-			if (physicalDeviceProperties.deviceType == vk::PhysicalDeviceType::eDiscreteGpu)
-			{
-				score += 1000;
-			}
-
-			// Maximum possible size of textures affects graphics quality
-			score += physicalDeviceProperties.limits.maxImageDimension2D;
-
-			// Application can't function without geometry shaders
-			if (!physicalDeviceFeatures.geometryShader)
-			{
-				score = 0;
-			}
+			result.error = MeshError::MESH_NOT_INDEXED_ERROR;
+			return result;
+		}
 
-			if (score > hiscore) { hiscore = score; index = i; }
+		auto analyzeBeforeResult = analyzeVertexCache(mesh, cacheSize);
+		if (logError(analyzeBeforeResult))
+		{
+			result.error = analyzeBeforeResult.error;
+			return result;
 		}
 
-		if (suitablePhysicalDevices[index] != vk::PhysicalDevice(nullptr))
+		std::vector<uint32_t> clusters;
+		auto optimizeVertexCacheResult = optimizeVertexCache(mesh.indices, mesh.vertices.size(), cacheSize, &clusters);
+		if (logError(optimizeVertexCacheResult))
 		{
-			result.value = suitablePhysicalDevices[index];
+			result.error = optimizeVertexCacheResult.error;
+			return result;
 		}
-		else
+
+		std::vector<SOULKAN_MATHS_NAMESPACE::Vec3> positions;
+		positions.reserve(mesh.vertices.size());
+		for (const auto& vertex : mesh.vertices)
 		{
-			result.error = PhysicalDeviceError::NO_SUITABLE_PHYSICAL_DEVICE_FOUND;
+			positions.emplace_back(vertex.position);
 		}
 
+		auto optimizeOverdrawResult = optimizeOverdraw(optimizeVertexCacheResult.value, positions, clusters, cacheSize, overdrawThreshold);
+		result.error = affectError(optimizeOverdrawResult, result.error);
+
+		auto optimizeVertexFetchResult = optimizeVertexFetch(Mesh(mesh.vertices, retLog(optimizeOverdrawResult)));
+		result.error = affectError(optimizeVertexFetchResult, result.error);
+
+		result.value.mesh = retLog(optimizeVertexFetchResult);
+		result.value.statisticsBefore = analyzeBeforeResult.value;
+		result.value.statisticsAfter = retLog(analyzeVertexCache(result.value.mesh, cacheSize));
 
 		return result;
 	}
 
-	/*@brief Returns the best suitable vulkan physical device, if there are more than 1 suitable physical device, they are filtered through getBestPhysicalDeviceByScore().
-	*
-	* @param suitablePhysicalDevices vector of suitable vulkan physical devices
-	*
-	* @return SkResult(vulkan physical device, PhysicalDeviceError)
-	*/
-	inline SkResult<vk::PhysicalDevice, PhysicalDeviceError> getBestPhysicalDevice(const std::vector<vk::PhysicalDevice>& suitablePhysicalDevices)
+	/*COMPACT VERTICES*/
+
+	/*Position stored as 4 half floats in the [-1, 1] quantization space of its mesh (w is padding keeping the attribute 8 bytes long)*/
+	struct HalfPosition
 	{
-		SkResult result(static_cast<vk::PhysicalDevice>(vk::PhysicalDevice(nullptr)), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+		static constexpr vk::Format format = vk::Format::eR16G16B16A16Sfloat;
+		static constexpr bool isSigned = true;
 
-		if (suitablePhysicalDevices.size() == 0)
+		static HalfPosition encode(const SOULKAN_MATHS_NAMESPACE::Vec3& quantizedPosition) noexcept
 		{
-			result.error = PhysicalDeviceError::NO_SUITABLE_PHYSICAL_DEVICE_FOUND;
+			return { { SOULKAN_MATHS_NAMESPACE::floatToHalf(quantizedPosition.x), SOULKAN_MATHS_NAMESPACE::floatToHalf(quantizedPosition.y),
+			           SOULKAN_MATHS_NAMESPACE::floatToHalf(quantizedPosition.z), SOULKAN_MATHS_NAMESPACE::floatToHalf(1.0f) } };
 		}
 
-		else if (suitablePhysicalDevices.size() == 1)
+		SOULKAN_MATHS_NAMESPACE::Vec3 decode() const noexcept
 		{
-			result.value = std::move(suitablePhysicalDevices[0]);
+			return SOULKAN_MATHS_NAMESPACE::Vec3(SOULKAN_MATHS_NAMESPACE::halfToFloat(value[0]), SOULKAN_MATHS_NAMESPACE::halfToFloat(value[1]), SOULKAN_MATHS_NAMESPACE::halfToFloat(value[2]));
 		}
 
-		else
+		uint16_t value[4];
+	};
+
+	/*Position stored as 4 unorm16 values in the [0, 1] quantization space of its mesh (w is padding keeping the attribute 8 bytes long),
+	* the precision is uniform over the bounding box of the mesh unlike HalfPosition*/
+	struct QuantizedPosition
+	{
+		static constexpr vk::Format format = vk::Format::eR16G16B16A16Unorm;
+		static constexpr bool isSigned = false;
+
+		static QuantizedPosition encode(const SOULKAN_MATHS_NAMESPACE::Vec3& quantizedPosition) noexcept
 		{
-			auto bestPhysicalResult = getBestPhysicalDeviceByScore(suitablePhysicalDevices);
+			return { { SOULKAN_MATHS_NAMESPACE::floatToUnorm16(quantizedPosition.x), SOULKAN_MATHS_NAMESPACE::floatToUnorm16(quantizedPosition.y),
+			           SOULKAN_MATHS_NAMESPACE::floatToUnorm16(quantizedPosition.z), std::numeric_limits<uint16_t>::max() } };
+		}
 
-			result.value = retLog(bestPhysicalResult);
-			result.error = affectError(bestPhysicalResult, result.error);
+		SOULKAN_MATHS_NAMESPACE::Vec3 decode() const noexcept
+		{
+			return SOULKAN_MATHS_NAMESPACE::Vec3(value[0] / 65535.0f, value[1] / 65535.0f, value[2] / 65535.0f);
 		}
 
-		return result;
-	}
+		uint16_t value[4];
+	};
 
-	/*@brief Sorts through all available physical devices and returns the best (getAvailablePhysicalDevices() -> getSuitablePhysicalDevices() -> getBestPhysicalDevice())
+	/*Vertex of 16 bytes (against 36 for Vertex) : quantized position, octahedral snorm16 normal (see encodeOctahedral()) and unorm8 color (alpha set to 1),
+	* read by shaders/compact_mesh.vert*/
+	template<typename PositionT>
+	struct CompactVertex
+	{
+		PositionT position;
+		int16_t normal[2];
+		uint8_t color[4];
+	};
+
+	using HalfVertex = CompactVertex<HalfPosition>;
+	using QuantizedVertex = CompactVertex<QuantizedPosition>;
+
+	/*Location, format and offset of a vertex attribute, known at compile time*/
+	struct VertexAttributeLayout
+	{
+		uint32_t location;
+		vk::Format format;
+		uint32_t offset;
+	};
+
+	/*Compile time description of the attributes of a vertex type, specialized for every vertex type that can be bound to a pipeline*/
+	template<typename VertexT>
+	struct VertexLayout;
+
+	template<>
+	struct VertexLayout<Vertex>
+	{
+		static constexpr std::array<VertexAttributeLayout, 3> attributes = { {
+			{ 0, vk::Format::eR32G32B32Sfloat, static_cast<uint32_t>(offsetof(Vertex, position)) },
+			{ 1, vk::Format::eR32G32B32Sfloat, static_cast<uint32_t>(offsetof(Vertex, normal)) },
+			{ 2, vk::Format::eR32G32B32Sfloat, static_cast<uint32_t>(offsetof(Vertex, color)) } } };
+	};
+
+	template<typename PositionT>
+	struct VertexLayout<CompactVertex<PositionT>>
+	{
+		static constexpr std::array<VertexAttributeLayout, 3> attributes = { {
+			{ 0, PositionT::format,             static_cast<uint32_t>(offsetof(CompactVertex<PositionT>, position)) },
+			{ 1, vk::Format::eR16G16Snorm,      static_cast<uint32_t>(offsetof(CompactVertex<PositionT>, normal)) },
+			{ 2, vk::Format::eR8G8B8A8Unorm,    static_cast<uint32_t>(offsetof(CompactVertex<PositionT>, color)) } } };
+	};
+
+	static_assert(sizeof(HalfVertex) == 16 && sizeof(QuantizedVertex) == 16, "Compact vertices must stay 16 bytes long");
+	static_assert(VertexLayout<HalfVertex>::attributes[2].offset == 12, "Compact vertex attributes must be tightly packed");
+
+	/*@brief Returns the binding description of a vertex type, the stride being its size
 	*
-	* @param instance The vulkan instance used to get the available devices
+	* @param bindingIndex The binding the vertex buffer is bound to
+	* @param bindingInputRate Whether the buffer is read per vertex or per instance
 	*
-	* @return SkResult(vulkan physical device, PhysicalDeviceError)
+	* @return SkResult(binding description, UndefinedError)
 	*/
-	inline SkResult<vk::PhysicalDevice, PhysicalDeviceError> getPhysicalDevice(const vk::Instance& instance)
+	template<typename VertexT>
+	inline SkResult<vk::VertexInputBindingDescription, UndefinedError> getVertexInputBindingDescription(uint32_t bindingIndex = 0, vk::VertexInputRate bindingInputRate = vk::VertexInputRate::eVertex)
 	{
-		SkResult result(static_cast<vk::PhysicalDevice>(vk::PhysicalDevice(nullptr)), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
-
-		auto getAvailablePhysicalDevicesResult = getAvailablePhysicalDevices(instance);
-		result.error = std::move(affectError(getAvailablePhysicalDevicesResult, result.error));
-		std::vector<vk::PhysicalDevice> availablePhysicalDevices = std::move(retLog(getAvailablePhysicalDevicesResult));
+		SkResult result(static_cast<vk::VertexInputBindingDescription>(vk::VertexInputBindingDescription()), static_cast<UndefinedError>(UndefinedError::NO_ERROR));
 
-		auto getSuitablePhysicalDevicesResult = getSuitablePhysicalDevices(availablePhysicalDevices);
-		result.error = std::move(affectError(getSuitablePhysicalDevicesResult, result.error));
-		std::vector<vk::PhysicalDevice> suitablePhysicalDevices = std::move(retLog(getSuitablePhysicalDevicesResult));
-
-		auto getBestPhysicalDeviceResult = getBestPhysicalDevice(suitablePhysicalDevices);
-		result.error = std::move(affectError(getBestPhysicalDeviceResult, result.error));
-		vk::PhysicalDevice physicalDevice = std::move(retLog(getBestPhysicalDeviceResult));
+		result.value.binding = bindingIndex;
+		result.value.stride = static_cast<uint32_t>(sizeof(VertexT));
+		result.value.inputRate = bindingInputRate;
 
-		result.value = std::move(physicalDevice);
 		return result;
 	}
 
-	/*@brief Returns a vector of queue family indexes with the following information :
-	* In the vector, index 0 = generalFamily, 1 = graphicsFamily, 2 = presentFamily, 3 = computeFamily, 4 = transferFamily, 5 = debug/tmp.
-	* (See QueueFamilyType enum)
+	/*@brief Returns the attribute descriptions of a vertex type, generated from its VertexLayout
 	*
-	* @param physicalDevice a vulkan physical device
-	* @param surface a vulkan surface
+	* @param bindingIndex The binding the vertex buffer is bound to
 	*
-	* @return SkResult(vector of queue family indexes, PhysicalDeviceError)
+	* @return SkResult(attribute descriptions, UndefinedError)
 	*/
-	inline SkResult<std::array<uint32_t, 6>, PhysicalDeviceError> getQueueFamilyIndexes(const vk::PhysicalDevice& physicalDevice, const vk::SurfaceKHR& surface)
+	template<typename VertexT>
+	inline SkResult<std::vector<vk::VertexInputAttributeDescription>, UndefinedError> getVertexInputAttributeDescriptions(uint32_t bindingIndex = 0)
 	{
-		SkResult result(std::array<uint32_t, 6>(), PhysicalDeviceError::NO_ERROR);
+		SkResult result(static_cast<std::vector<vk::VertexInputAttributeDescription>>(std::vector<vk::VertexInputAttributeDescription>()), static_cast<UndefinedError>(UndefinedError::NO_ERROR));
 
-		uint32_t uint32_tMax = std::move(std::numeric_limits<uint32_t>::max());
-		std::array<uint32_t, 6> queueFamilyIndexes = { uint32_tMax, uint32_tMax, uint32_tMax, uint32_tMax, uint32_tMax, uint32_tMax };
+		result.value.reserve(VertexLayout<VertexT>::attributes.size());
+		for (const auto& attribute : VertexLayout<VertexT>::attributes)
+		{
+			result.value.emplace_back(attribute.location, bindingIndex, attribute.format, attribute.offset);
+		}
 
-		auto availableQueueFamilies = physicalDevice.getQueueFamilyProperties();
+		return result;
+	}
 
-		uint32_t i = 0;
-		for (const auto& queueFamily : availableQueueFamilies)
+	/*Transform bringing quantized positions back into mesh space : position = offset + scale * quantizedPosition*/
+	struct VertexQuantization
+	{
+		VertexQuantization()
+			: offset(0.0f, 0.0f, 0.0f), scale(1.0f, 1.0f, 1.0f)
+		{}
+
+		/*Returns the dequantization as a matrix to be multiplied into the model matrix (translation in the last column)*/
+		SOULKAN_MATHS_NAMESPACE::Mat4 getMatrix() const
 		{
-			if (queueFamily.queueFlags & vk::QueueFlagBits::eGraphics &&
-				queueFamily.queueFlags & vk::QueueFlagBits::eCompute &&
-				physicalDevice.getSurfaceSupportKHR(i, surface))
-			{
-				queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::GENERAL)] = i;
-			}
+			SOULKAN_MATHS_NAMESPACE::Mat4 dequantizationMatrix(1.0f);
 
-			i++;
-		}
+			dequantizationMatrix.matrix[0][0] = scale.x;
+			dequantizationMatrix.matrix[1][1] = scale.y;
+			dequantizationMatrix.matrix[2][2] = scale.z;
 
-		uint32_t j = 0;
-		for (const auto& queueFamily : availableQueueFamilies)
-		{
-			if (queueFamily.queueFlags & vk::QueueFlagBits::eGraphics)
-			{
-				queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::GRAPHICS)] = j;
-			}
+			dequantizationMatrix.matrix[3][0] = offset.x;
+			dequantizationMatrix.matrix[3][1] = offset.y;
+			dequantizationMatrix.matrix[3][2] = offset.z;
 
-			if (queueFamily.queueFlags & vk::QueueFlagBits::eTransfer &&
-				queueFamily.queueFlags & vk::QueueFlagBits::eCompute &&
-				!(queueFamily.queueFlags & vk::QueueFlagBits::eGraphics))
-			{
-				queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::COMPUTE)] = j;
-			}
+			return dequantizationMatrix;
+		}
 
+		SOULKAN_MATHS_NAMESPACE::Vec3 offset;
+		SOULKAN_MATHS_NAMESPACE::Vec3 scale;
+	};
 
-			if (queueFamily.queueFlags & vk::QueueFlagBits::eTransfer &&
-				!(queueFamily.queueFlags & vk::QueueFlagBits::eCompute) &&
-				!(queueFamily.queueFlags & vk::QueueFlagBits::eGraphics))
-			{
-				queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::TRANSFER)] = j;
-			}
+	/*Mesh made of compact vertices, dequantization has to be handed to the vertex shader (push constants of shaders/compact_mesh.vert)*/
+	template<typename VertexT>
+	struct CompactMesh
+	{
+		bool isIndexed() const
+		{
+			return !indices.empty();
+		}
 
-			if (physicalDevice.getSurfaceSupportKHR(j, surface))
-			{
-				queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::PRESENT)] = j;
-			}
+		/*Same rules as Mesh::getIndexType()*/
+		vk::IndexType getIndexType() const
+		{
+			return (vertices.size() < std::numeric_limits<uint16_t>::max() ? vk::IndexType::eUint16 : vk::IndexType::eUint32);
+		}
 
-			j++;
+		vk::DeviceSize getIndexBufferSize() const
+		{
+			return static_cast<vk::DeviceSize>(indices.size()) * (getIndexType() == vk::IndexType::eUint16 ? sizeof(uint16_t) : sizeof(uint32_t));
 		}
 
-		if (queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::GENERAL)] == uint32_tMax ||
-			queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::GRAPHICS)] == uint32_tMax)
+		vk::DeviceSize getVertexBufferSize() const
 		{
-			result.error = PhysicalDeviceError::NO_SUITABLE_QUEUES_FOUND;
+			return static_cast<vk::DeviceSize>(vertices.size()) * sizeof(VertexT);
 		}
 
-		result.value = std::move(queueFamilyIndexes);
-		return result;
-	}
+		std::vector<VertexT> vertices;
+		std::vector<uint32_t> indices;
+		VertexQuantization dequantization;
+	};
 
-	/*@brief Returns a vector of "concentrated" queue family indexes,
-	* meaning that duplicate indexes are removed and that only known correct indexes are left in the vector (no std::numeric_limits<uint32_t>::max(), nor debug/tmp)
+	/*@brief Quantizes the vertices of a mesh into compact vertices, positions are normalized over the bounding box of the mesh
+	* ([-1, 1] around its center for HalfPosition, [0, 1] from its minimum for QuantizedPosition), normals are octahedral encoded and colors clamped to [0, 1]
 	*
-	* @param queueFamilyIndexes a vector of queue family indexes
+	* @param mesh The mesh to be quantized, its indices are kept as they are
 	*
-	* @return SkResult(vector of concentrated queue family indexes, PhysicalDeviceError)
+	* @return SkResult(compact mesh and its dequantization transform, MeshError)
 	*/
-	inline SkResult<std::vector<uint32_t>, QueueError> concentrateQueueFamilyIndexes(const std::array<uint32_t, 6>& queueFamilyIndexes)
+	template<typename PositionT>
+	inline SkResult<CompactMesh<CompactVertex<PositionT>>, MeshError> quantizeMesh(const Mesh& mesh)
 	{
-		SkResult result(static_cast<std::vector<uint32_t>>(std::vector<uint32_t>()), static_cast<QueueError>(QueueError::NO_ERROR));
+		SkResult result(static_cast<CompactMesh<CompactVertex<PositionT>>>(CompactMesh<CompactVertex<PositionT>>()), static_cast<MeshError>(MeshError::NO_ERROR));
 
-		std::vector<uint32_t> concentratedQueueFamilyIndexes(queueFamilyIndexes.begin(), queueFamilyIndexes.end());
-		for (int k = 0; k < concentratedQueueFamilyIndexes.size(); k++)
+		for (const uint32_t index : mesh.indices)
 		{
-			if (concentratedQueueFamilyIndexes[k] == std::numeric_limits<uint32_t>::max())
+			if (index >= mesh.vertices.size())
 			{
-				concentratedQueueFamilyIndexes.erase(concentratedQueueFamilyIndexes.begin() + k);
+				result.error = MeshError::INDEX_OUT_OF_RANGE_ERROR;
+				return result;
 			}
 		}
-		for (int i = 0; i < concentratedQueueFamilyIndexes.size(); i++)
+
+		if (mesh.vertices.empty())
+		{
+			return result;
+		}
+
+		std::array<float, 3> minimum = { mesh.vertices[0].position.x, mesh.vertices[0].position.y, mesh.vertices[0].position.z };
+		std::array<float, 3> maximum = minimum;
+		for (const auto& vertex : mesh.vertices)
 		{
-			for (int j = 0; j < concentratedQueueFamilyIndexes.size(); j++)
+			const std::array<float, 3> position = { vertex.position.x, vertex.position.y, vertex.position.z };
+			for (size_t axis = 0; axis < 3; axis++)
 			{
-				if ((i != j) && (concentratedQueueFamilyIndexes[i] == concentratedQueueFamilyIndexes[j]))
-				{
-					concentratedQueueFamilyIndexes.erase(concentratedQueueFamilyIndexes.begin() + i);
-				}
+				minimum[axis] = std::min(minimum[axis], position[axis]);
+				maximum[axis] = std::max(maximum[axis], position[axis]);
 			}
 		}
 
-		if (concentratedQueueFamilyIndexes.size() == 0)
+		std::array<float, 3> offset = {};
+		std::array<float, 3> scale = {};
+		for (size_t axis = 0; axis < 3; axis++)
 		{
-			result.error = QueueError::EMPTY_CONCENTRATED_QUEUE_VECTOR;
+			float extent = maximum[axis] - minimum[axis];
+
+			//A flat axis keeps a unit scale so that the quantized coordinate stays finite
+			if (PositionT::isSigned)
+			{
+				offset[axis] = (minimum[axis] + maximum[axis]) * 0.5f;
+				scale[axis] = (extent > 0.0f ? extent * 0.5f : 1.0f);
+			}
+			else
+			{
+				offset[axis] = minimum[axis];
+				scale[axis] = (extent > 0.0f ? extent : 1.0f);
+			}
 		}
 
-		result.value = std::move(concentratedQueueFamilyIndexes);
+		CompactMesh<CompactVertex<PositionT>> compactMesh;
+		compactMesh.vertices.reserve(mesh.vertices.size());
+		compactMesh.indices = mesh.indices;
+		compactMesh.dequantization.offset = SOULKAN_MATHS_NAMESPACE::Vec3(offset[0], offset[1], offset[2]);
+		compactMesh.dequantization.scale = SOULKAN_MATHS_NAMESPACE::Vec3(scale[0], scale[1], scale[2]);
+
+		for (const auto& vertex : mesh.vertices)
+		{
+			CompactVertex<PositionT> compactVertex = {};
+
+			compactVertex.position = PositionT::encode(SOULKAN_MATHS_NAMESPACE::Vec3((vertex.position.x - offset[0]) / scale[0],
+			                                                                         (vertex.position.y - offset[1]) / scale[1],
+			                                                                         (vertex.position.z - offset[2]) / scale[2]));
+
+			std::array<int16_t, 2> encodedNormal = SOULKAN_MATHS_NAMESPACE::encodeOctahedral(vertex.normal);
+			compactVertex.normal[0] = encodedNormal[0];
+			compactVertex.normal[1] = encodedNormal[1];
+
+			compactVertex.color[0] = SOULKAN_MATHS_NAMESPACE::floatToUnorm8(vertex.color.x);
+			compactVertex.color[1] = SOULKAN_MATHS_NAMESPACE::floatToUnorm8(vertex.color.y);
+			compactVertex.color[2] = SOULKAN_MATHS_NAMESPACE::floatToUnorm8(vertex.color.z);
+			compactVertex.color[3] = std::numeric_limits<uint8_t>::max();
+
+			compactMesh.vertices.emplace_back(compactVertex);
+		}
+
+		result.value = std::move(compactMesh);
 		return result;
 	}
 
-	/*@brief Returns the best available present mode, the chosen present mode or the other preferred modes if it's not available :
-	* Mailbox > Fifo > FifoRelaxed > Immediate
-	*
-	* @param physicalDevice the vulkan physical device used from which to get the surface present modeds
-	* @param surface the vulkan surface used to get present modes from
-	* @param presentMode the chosen vulkan present mode
-	*
-	* @return SkResult(best available present mode, PhysicalDeviceError)
+	/*INSTANCING*/
+
+	/*Per instance data read from the instance vertex stream (binding 1, vk::VertexInputRate::eInstance) by shaders/instanced_mesh.vert.
+	* transform follows the layout of Mat4 (transform[column][row]), color multiplies the vertex color and custom is left to the user
 	*/
-	inline SkResult<vk::PresentModeKHR, PhysicalDeviceError> getBestAvailablePresentMode(const vk::PhysicalDevice& physicalDevice, const vk::SurfaceKHR& surface, const vk::PresentModeKHR& presentMode)
+	struct InstanceData
 	{
-		SkResult result(vk::PresentModeKHR::eImmediate, PhysicalDeviceError::NO_ERROR); //Could not find an acceptable default value for PresentModeKHR
+		InstanceData()
+			: transform({ { {1.0f, 0.0f, 0.0f, 0.0f},
+			                {0.0f, 1.0f, 0.0f, 0.0f},
+			                {0.0f, 0.0f, 1.0f, 0.0f},
+			                {0.0f, 0.0f, 0.0f, 1.0f} } }),
+			color(1.0f, 1.0f, 1.0f, 1.0f),
+			custom(0.0f, 0.0f, 0.0f, 0.0f)
+		{}
 
-		std::vector<vk::PresentModeKHR> presentModes = physicalDevice.getSurfacePresentModesKHR(surface);
-		if (presentModes.size() == 0)
-		{
-			result.error = PhysicalDeviceError::NO_PRESENT_MODES;
-		}
+		InstanceData(const SOULKAN_MATHS_NAMESPACE::Mat4& instanceTransform, const SOULKAN_MATHS_NAMESPACE::Vec4& instanceColor)
+			: transform(instanceTransform.matrix), color(instanceColor), custom(0.0f, 0.0f, 0.0f, 0.0f)
+		{}
 
-		bool isChoiceAvailable = false;
+		std::array<std::array<float, 4>, 4> transform;
+		SOULKAN_MATHS_NAMESPACE::Vec4 color;
+		SOULKAN_MATHS_NAMESPACE::Vec4 custom;
+	};
 
-		bool isImmediateAvailable = false;
-		bool isFifoAvailable = false;
-		bool isFifoRelaxedAvailable = false;
-		bool isMailboxAvailable = false;
+	static_assert(sizeof(InstanceData) == 96, "InstanceData must match the instance stream of shaders/instanced_mesh.vert");
 
-		//Checks if the chosen present mode is available, otherwise check if every present mode is available or not
-		for (const auto& mode : presentModes)
+	//A mat4 attribute takes one location per column, instance attributes start after the 3 locations of the vertex stream
+	template<>
+	struct VertexLayout<InstanceData>
+	{
+		static constexpr std::array<VertexAttributeLayout, 6> attributes = { {
+			{ 3, vk::Format::eR32G32B32A32Sfloat, static_cast<uint32_t>(offsetof(InstanceData, transform)) },
+			{ 4, vk::Format::eR32G32B32A32Sfloat, static_cast<uint32_t>(offsetof(InstanceData, transform) + 16) },
+			{ 5, vk::Format::eR32G32B32A32Sfloat, static_cast<uint32_t>(offsetof(InstanceData, transform) + 32) },
+			{ 6, vk::Format::eR32G32B32A32Sfloat, static_cast<uint32_t>(offsetof(InstanceData, transform) + 48) },
+			{ 7, vk::Format::eR32G32B32A32Sfloat, static_cast<uint32_t>(offsetof(InstanceData, color)) },
+			{ 8, vk::Format::eR32G32B32A32Sfloat, static_cast<uint32_t>(offsetof(InstanceData, custom)) } } };
+	};
+
+	/*@brief Returns true if no attribute location of VertexT is used by an attribute of InstanceT*/
+	template<typename VertexT, typename InstanceT>
+	inline constexpr bool areAttributeLocationsDisjoint() noexcept
+	{
+		for (const auto& vertexAttribute : VertexLayout<VertexT>::attributes)
 		{
-			if (mode == presentMode)
+			for (const auto& instanceAttribute : VertexLayout<InstanceT>::attributes)
 			{
-				isChoiceAvailable = true;
-				break;
+				if (vertexAttribute.location == instanceAttribute.location)
+				{
+					return false;
+				}
 			}
+		}
 
-			if (mode == vk::PresentModeKHR::eImmediate)
-			{
-				isImmediateAvailable = true;
-			}
+		return true;
+	}
 
-			if (mode == vk::PresentModeKHR::eFifo)
-			{
-				isFifoAvailable = true;
-			}
+	/*Bindings and attributes of a pipeline vertex input, ready to be handed to createGraphicsPipeline()*/
+	struct VertexInputDescription
+	{
+		std::vector<vk::VertexInputBindingDescription> bindings;
+		std::vector<vk::VertexInputAttributeDescription> attributes;
+	};
 
-			if (mode == vk::PresentModeKHR::eFifoRelaxed)
-			{
-				isFifoRelaxedAvailable = true;
-			}
+	/*@brief Returns the vertex input of a pipeline reading a per vertex stream of VertexT and a per instance stream of InstanceT
+	*
+	* @param vertexBindingIndex The binding the vertex buffer is bound to
+	* @param instanceBindingIndex The binding the instance buffer is bound to
+	*
+	* @return SkResult(bindings and attributes of both streams, UndefinedError)
+	*/
+	template<typename VertexT, typename InstanceT = InstanceData>
+	inline SkResult<VertexInputDescription, UndefinedError> getInstancedVertexInputDescription(uint32_t vertexBindingIndex = 0, uint32_t instanceBindingIndex = 1)
+	{
+		static_assert(areAttributeLocationsDisjoint<VertexT, InstanceT>(), "Vertex and instance attributes must use different locations");
 
-			if (mode == vk::PresentModeKHR::eMailbox)
-			{
-				isMailboxAvailable = true;
-			}
+		SkResult result(static_cast<VertexInputDescription>(VertexInputDescription()), static_cast<UndefinedError>(UndefinedError::NO_ERROR));
+
+		result.value.bindings.emplace_back(retLog(getVertexInputBindingDescription<VertexT>(vertexBindingIndex, vk::VertexInputRate::eVertex)));
+		result.value.bindings.emplace_back(retLog(getVertexInputBindingDescription<InstanceT>(instanceBindingIndex, vk::VertexInputRate::eInstance)));
+
+		result.value.attributes = retLog(getVertexInputAttributeDescriptions<VertexT>(vertexBindingIndex));
+		for (const auto& attribute : retLog(getVertexInputAttributeDescriptions<InstanceT>(instanceBindingIndex)))
+		{
+			result.value.attributes.emplace_back(attribute);
 		}
 
-		//Picks the chosen present mode if it's available, otherwise go through preferred present modes one by one
-		if (isChoiceAvailable)
+		return result;
+	}
+
+	/*Vertex and index buffers of a mesh uploaded to the GPU, with what is needed to draw it*/
+	struct MeshBuffers
+	{
+		vk::Buffer vertexBuffer;
+		vk::Buffer indexBuffer;
+		vk::IndexType indexType = vk::IndexType::eUint32;
+		uint32_t indexCount = 0;
+	};
+
+	/*Range of the instance buffer drawn by one instanced draw call, every instance of a batch sharing its pipeline and its mesh*/
+	struct InstanceBatch
+	{
+		vk::Pipeline pipeline;
+		uint32_t meshId = 0;
+		uint32_t firstInstance = 0;
+		uint32_t instanceCount = 0;
+	};
+
+	/*Collects the instances queued during a frame and merges the ones sharing a pipeline and a mesh into a single instanced draw,
+	* thousands of identical objects costing one draw call. Meshes are referred to by an id chosen by the user (usually an index in a vector of MeshBuffers)
+	*/
+	class InstanceBatcher
+	{
+	public:
+		InstanceBatcher()
 		{
-			result.value = presentMode;
+
 		}
-		else
+
+		/*Queues an instance of a mesh to be drawn with a pipeline*/
+		inline void add(const vk::Pipeline& pipeline, const uint32_t meshId, const InstanceData& instance)
 		{
-			if (isMailboxAvailable)
-			{
-				result.value = vk::PresentModeKHR::eMailbox;
-			}
+			queuedDraws.push_back({ pipeline, meshId, static_cast<uint32_t>(instances.size()) });
+			instances.emplace_back(instance);
+		}
 
-			else if (isFifoAvailable)
+		/*Returns the number of queued instances*/
+		inline uint32_t getInstanceCount() const
+		{
+			return static_cast<uint32_t>(instances.size());
+		}
+
+		/*@brief Sorts the queued instances by pipeline and mesh, writes them into mapped instance memory and returns one batch per (pipeline, mesh) pair.
+		* Batches sharing a pipeline are contiguous, so that recordInstanceBatches() binds every pipeline once
+		*
+		* @param pInstanceData Pointer to mapped memory of at least maxInstanceCount * sizeof(InstanceData) bytes
+		* @param maxInstanceCount The number of instances the instance buffer can hold
+		*
+		* @return SkResult(batches to be drawn, DrawingError)
+		*/
+		inline SkResult<std::vector<InstanceBatch>, DrawingError> build(void* pInstanceData, const uint32_t maxInstanceCount) const
+		{
+			SkResult result(static_cast<std::vector<InstanceBatch>>(std::vector<InstanceBatch>()), static_cast<DrawingError>(DrawingError::NO_ERROR));
+
+			if (instances.size() > maxInstanceCount)
 			{
-				result.value = vk::PresentModeKHR::eFifo;
+				result.error = DrawingError::INSTANCE_BUFFER_TOO_SMALL_ERROR;
+				return result;
 			}
 
-			else if (isFifoRelaxedAvailable)
+			//Stable, so that instances of a batch keep their queuing order
+			std::vector<QueuedDraw> sortedDraws = queuedDraws;
+			std::stable_sort(sortedDraws.begin(), sortedDraws.end(), [](const QueuedDraw& lhs, const QueuedDraw& rhs)
 			{
-				result.value = vk::PresentModeKHR::eFifo;
-			}
+				return (lhs.pipeline != rhs.pipeline ? lhs.pipeline < rhs.pipeline : lhs.meshId < rhs.meshId);
+			});
 
-			else
+			InstanceData* pInstances = static_cast<InstanceData*>(pInstanceData);
+			for (uint32_t i = 0; i < static_cast<uint32_t>(sortedDraws.size()); i++)
 			{
-				result.value = vk::PresentModeKHR::eImmediate;
+				std::memcpy(&pInstances[i], &instances[sortedDraws[i].instanceIndex], sizeof(InstanceData));
+
+				if (result.value.empty() || result.value.back().pipeline != sortedDraws[i].pipeline || result.value.back().meshId != sortedDraws[i].meshId)
+				{
+					InstanceBatch batch;
+					batch.pipeline = sortedDraws[i].pipeline;
+					batch.meshId = sortedDraws[i].meshId;
+					batch.firstInstance = i;
+					result.value.emplace_back(batch);
+				}
+
+				result.value.back().instanceCount++;
 			}
+
+			return result;
 		}
 
-		return result;
-	}
+		/*Forgets every queued instance, to be called once the batches of the frame are recorded*/
+		inline void clear()
+		{
+			queuedDraws.clear();
+			instances.clear();
+		}
 
-	/*@brief Returns the best available surface format from a given physical device for a given surface
+	private:
+		struct QueuedDraw
+		{
+			vk::Pipeline pipeline;
+			uint32_t meshId;
+			uint32_t instanceIndex;
+		};
+
+		std::vector<QueuedDraw> queuedDraws;
+		std::vector<InstanceData> instances;
+	};
+
+	/*Instance read by the frustum culling compute shader (std430 layout, 32 bytes, see shaders/frustum_culling.comp)
+	* boundingSphere holds the world space center (x, y, z) and the radius (w) of the instance,
+	* the other members are copied into the vk::DrawIndexedIndirectCommand written for the instance if it is visible
+	*/
+	struct CullingInstance
+	{
+		SOULKAN_MATHS_NAMESPACE::Vec4 boundingSphere;
+
+		uint32_t indexCount    = 0;
+		uint32_t firstIndex    = 0;
+		int32_t  vertexOffset  = 0;
+		uint32_t firstInstance = 0;
+	};
+
+	/*Push constants of the frustum culling compute shader (104 bytes, under the 128 bytes guaranteed by vulkan)*/
+	struct CullingPushConstants
+	{
+		std::array<SOULKAN_MATHS_NAMESPACE::Vec4, 6> frustumPlanes;
+
+		uint32_t instanceCount = 0;
+		uint32_t maxDrawCount  = 0;
+	};
+
+	/*MESHLETS*/
+
+	/*Cluster of at most a few dozen triangles of a mesh, read by the meshlet culling compute shader (std430 layout, 48 bytes, see shaders/meshlet_culling.comp).
+	* boundingSphere holds the mesh space center (x, y, z) and the radius (w) of the cluster,
+	* cone holds the axis (x, y, z) and the cutoff (w) of the normal cone of the cluster, a cutoff of 1 meaning the cluster can not be backface culled.
+	* The other members are copied into the vk::DrawIndexedIndirectCommand written for the cluster if it is visible
+	*/
+	struct Meshlet
+	{
+		SOULKAN_MATHS_NAMESPACE::Vec4 boundingSphere;
+		SOULKAN_MATHS_NAMESPACE::Vec4 cone;
+
+		uint32_t indexCount    = 0;
+		uint32_t firstIndex    = 0;
+		int32_t  vertexOffset  = 0;
+		uint32_t firstInstance = 0;
+	};
+
+	/*Push constants of the meshlet culling compute shader (120 bytes, under the 128 bytes guaranteed by vulkan)*/
+	struct MeshletCullingPushConstants
+	{
+		std::array<SOULKAN_MATHS_NAMESPACE::Vec4, 6> frustumPlanes;
+		SOULKAN_MATHS_NAMESPACE::Vec4 cameraPosition;
+
+		uint32_t meshletCount = 0;
+		uint32_t maxDrawCount = 0;
+	};
+
+	/*Mesh whose indices are sorted meshlet by meshlet, every meshlet drawing a contiguous range of mesh.indices*/
+	struct MeshletMesh
+	{
+		Mesh mesh;
+		std::vector<Meshlet> meshlets;
+	};
+
+	/*@brief Returns true if every triangle of a meshlet faces away from a camera, triangles facing the direction of cross(p1 - p0, p2 - p0).
+	* Conservative over the whole bounding sphere, mirrors the cone test of shaders/meshlet_culling.comp
 	*
-	* @param physicalDevice the vulkan physical device used to get the surface format from
-	* @param surface the vulkan surface used to get the surface format
+	* @param meshlet The meshlet to be tested
+	* @param cameraPosition The position of the camera, in the space of the mesh
+	*/
+	inline bool isMeshletBackfacing(const Meshlet& meshlet, const SOULKAN_MATHS_NAMESPACE::Vec3& cameraPosition) noexcept
+	{
+		SOULKAN_MATHS_NAMESPACE::Vec3 direction(meshlet.boundingSphere.x - cameraPosition.x, meshlet.boundingSphere.y - cameraPosition.y, meshlet.boundingSphere.z - cameraPosition.z);
+		SOULKAN_MATHS_NAMESPACE::Vec3 axis(meshlet.cone.x, meshlet.cone.y, meshlet.cone.z);
+
+		return (SOULKAN_MATHS_NAMESPACE::dot(direction, axis) >= meshlet.cone.w * SOULKAN_MATHS_NAMESPACE::length(direction) + meshlet.boundingSphere.w * (1.0f + meshlet.cone.w));
+	}
+
+	/*@brief Returns true if a meshlet is neither outside of the frustum nor backfacing, the CPU version of shaders/meshlet_culling.comp
 	*
-	* @return SkResult(best available surface format, PhysicalDeviceError)
+	* @param meshlet The meshlet to be tested
+	* @param frustum The frustum extracted from the model view projection matrix, so that its planes are in the space of the mesh
+	* @param cameraPosition The position of the camera, in the space of the mesh
 	*/
-	inline SkResult<vk::SurfaceFormatKHR, PhysicalDeviceError> getBestAvailableSurfaceFormat(const vk::PhysicalDevice& physicalDevice, const vk::SurfaceKHR& surface)
+	inline bool isMeshletVisible(const Meshlet& meshlet, const SOULKAN_MATHS_NAMESPACE::Frustum& frustum, const SOULKAN_MATHS_NAMESPACE::Vec3& cameraPosition) noexcept
 	{
-		SkResult result(static_cast<vk::SurfaceFormatKHR>(vk::SurfaceFormatKHR()), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR)); // No default value for vk::SurfaceFormatKHR
+		SOULKAN_MATHS_NAMESPACE::Vec3 center(meshlet.boundingSphere.x, meshlet.boundingSphere.y, meshlet.boundingSphere.z);
 
-		std::vector<vk::SurfaceFormatKHR> surfaceFormats = physicalDevice.getSurfaceFormatsKHR(surface);
+		return (SOULKAN_MATHS_NAMESPACE::isSphereInFrustum(frustum, center, meshlet.boundingSphere.w) && !isMeshletBackfacing(meshlet, cameraPosition));
+	}
 
-		if (surfaceFormats.size() == 0)
+	/*@brief Computes the bounding sphere and the normal cone of the triangles [firstIndex, firstIndex + indexCount) of a mesh
+	*
+	* @param mesh The mesh holding the triangles, its indices must be valid
+	* @param firstIndex The first index of the meshlet
+	* @param indexCount The number of indices of the meshlet (3 per triangle)
+	*
+	* @return The meshlet with its bounds, draw parameters other than firstIndex and indexCount left to 0
+	*/
+	inline Meshlet computeMeshletBounds(const Mesh& mesh, const uint32_t firstIndex, const uint32_t indexCount)
+	{
+		Meshlet meshlet;
+		meshlet.firstIndex = firstIndex;
+		meshlet.indexCount = indexCount;
+
+		if (indexCount == 0)
 		{
-			result.error = PhysicalDeviceError::NO_SURFACE_FORMATS;
+			return meshlet;
 		}
 
-		if (surfaceFormats.size() == 1 && surfaceFormats[0].format == vk::Format::eUndefined)
+		//Center of the bounding box, radius reaching the farthest vertex
+		std::array<float, 3> minimum = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+		std::array<float, 3> maximum = { -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max() };
+		for (uint32_t i = firstIndex; i < firstIndex + indexCount; i++)
 		{
-			result.error = PhysicalDeviceError::UNDEFINED_FORMAT;
-
-			result.value = std::move(vk::SurfaceFormatKHR{ vk::Format::eB8G8R8Unorm, vk::ColorSpaceKHR::eSrgbNonlinear });
+			const SOULKAN_MATHS_NAMESPACE::Vec3& position = mesh.vertices[mesh.indices[i]].position;
+			const std::array<float, 3> coordinates = { position.x, position.y, position.z };
+			for (size_t axis = 0; axis < 3; axis++)
+			{
+				minimum[axis] = std::min(minimum[axis], coordinates[axis]);
+				maximum[axis] = std::max(maximum[axis], coordinates[axis]);
+			}
 		}
 
-		else if (surfaceFormats.size() == 1)
+		SOULKAN_MATHS_NAMESPACE::Vec3 center((minimum[0] + maximum[0]) * 0.5f, (minimum[1] + maximum[1]) * 0.5f, (minimum[2] + maximum[2]) * 0.5f);
+
+		float radius = 0.0f;
+		for (uint32_t i = firstIndex; i < firstIndex + indexCount; i++)
 		{
-			result.value = std::move(surfaceFormats[0]);
+			const SOULKAN_MATHS_NAMESPACE::Vec3& position = mesh.vertices[mesh.indices[i]].position;
+			radius = std::max(radius, SOULKAN_MATHS_NAMESPACE::length(SOULKAN_MATHS_NAMESPACE::Vec3(position.x - center.x, position.y - center.y, position.z - center.z)));
 		}
 
-		else
+		meshlet.boundingSphere = SOULKAN_MATHS_NAMESPACE::Vec4(center, radius);
+
+		//Normal cone : the axis is the average of the triangle normals, the cutoff is the sine of the widest angle between the axis and a normal
+		std::vector<SOULKAN_MATHS_NAMESPACE::Vec3> normals;
+		normals.reserve(indexCount / 3);
+
+		float axisX = 0.0f;
+		float axisY = 0.0f;
+		float axisZ = 0.0f;
+		for (uint32_t i = firstIndex; i + 2 < firstIndex + indexCount; i += 3)
 		{
-			for (const auto& surfaceFormat : surfaceFormats)
+			const SOULKAN_MATHS_NAMESPACE::Vec3& p0 = mesh.vertices[mesh.indices[i]].position;
+			const SOULKAN_MATHS_NAMESPACE::Vec3& p1 = mesh.vertices[mesh.indices[i + 1]].position;
+			const SOULKAN_MATHS_NAMESPACE::Vec3& p2 = mesh.vertices[mesh.indices[i + 2]].position;
+
+			SOULKAN_MATHS_NAMESPACE::Vec3 normal = SOULKAN_MATHS_NAMESPACE::cross(SOULKAN_MATHS_NAMESPACE::Vec3(p1.x - p0.x, p1.y - p0.y, p1.z - p0.z),
+			                                                                      SOULKAN_MATHS_NAMESPACE::Vec3(p2.x - p0.x, p2.y - p0.y, p2.z - p0.z));
+
+			//Degenerate triangles are never rasterized, they do not constrain the cone
+			float normalLength = SOULKAN_MATHS_NAMESPACE::length(normal);
+			if (normalLength == 0.0f)
 			{
-				if (surfaceFormat.format == vk::Format::eB8G8R8A8Unorm && surfaceFormat.colorSpace == vk::ColorSpaceKHR::eSrgbNonlinear)
-				{
-					result.value = surfaceFormat;
-				}
+				continue;
 			}
+
+			normals.emplace_back(normal.x / normalLength, normal.y / normalLength, normal.z / normalLength);
+			axisX += normals.back().x;
+			axisY += normals.back().y;
+			axisZ += normals.back().z;
 		}
 
-		return result;
+		float axisLength = std::sqrt(axisX * axisX + axisY * axisY + axisZ * axisZ);
+
+		//Cutoff of 1 = disabled cone
+		meshlet.cone = SOULKAN_MATHS_NAMESPACE::Vec4(0.0f, 0.0f, 0.0f, 1.0f);
+		if (axisLength == 0.0f)
+		{
+			return meshlet;
+		}
+
+		SOULKAN_MATHS_NAMESPACE::Vec3 axis(axisX / axisLength, axisY / axisLength, axisZ / axisLength);
+
+		float minimumDot = 1.0f;
+		for (const auto& normal : normals)
+		{
+			minimumDot = std::min(minimumDot, SOULKAN_MATHS_NAMESPACE::dot(axis, normal));
+		}
+
+		//A cone wider than ~84 degrees is almost never entirely backfacing, testing it is a waste of time
+		if (minimumDot <= 0.1f)
+		{
+			return meshlet;
+		}
+
+		meshlet.cone = SOULKAN_MATHS_NAMESPACE::Vec4(axis, std::sqrt(1.0f - minimumDot * minimumDot));
+		return meshlet;
 	}
 
-	/*@brief Returns the swapchain 2D extent for a given physical device, surface and GLFW window
+	/*@brief Splits an indexed mesh into meshlets holding at most maxVertices unique vertices and maxTriangles triangles.
+	* Meshlets are grown greedily from a seed triangle, always adding the adjacent triangle bringing the fewest new vertices
+	* and then the closest to their centroid, which keeps them compact and their normal cones narrow
 	*
-	* @param physicalDevice the vulkan physical device from which to get the surface capabilities
-	* @param surface the vulkan surface used to get its capabilities
-	* @param pWindow the glfw window from which the framebuffer size is returned
+	* @param mesh The indexed mesh to be split
+	* @param maxVertices The maximum number of unique vertices of a meshlet (64 is a good fit for culling and mesh shaders)
+	* @param maxTriangles The maximum number of triangles of a meshlet (124 keeps the local index list under 512 bytes)
 	*
-	* @return SkResult(2D extent of the swapchain, PhysicalDeviceError)
+	* @return SkResult(mesh with indices sorted by meshlet and the bounded meshlets, MeshError)
 	*/
-	inline SkResult<vk::Extent2D, PhysicalDeviceError> getSwapchainExtent(const vk::PhysicalDevice& physicalDevice, const vk::SurfaceKHR& surface, GLFWwindow* pWindow)
+	inline SkResult<MeshletMesh, MeshError> buildMeshlets(const Mesh& mesh, const uint32_t maxVertices = 64, const uint32_t maxTriangles = 124)
 	{
-		SkResult result(static_cast<vk::Extent2D>(vk::Extent2D()), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
-
-		vk::SurfaceCapabilitiesKHR surfaceCapabilities = physicalDevice.getSurfaceCapabilitiesKHR(surface);
+		SkResult result(static_cast<MeshletMesh>(MeshletMesh()), static_cast<MeshError>(MeshError::NO_ERROR));
 
-		if (surfaceCapabilities.currentExtent.width != std::numeric_limits<uint32_t>::max())
+		if (!mesh.isIndexed())
 		{
-			result.value = surfaceCapabilities.currentExtent;
+			result.error = MeshError::MESH_NOT_INDEXED_ERROR;
+			return result;
 		}
-		else
+
+		if (maxVertices < 3 || maxTriangles < 1)
 		{
-			int width, height;
-			glfwGetFramebufferSize(pWindow, &width, &height);
+			result.error = MeshError::INVALID_MESHLET_LIMITS_ERROR;
+			return result;
+		}
 
-			if (width == NULL && height == NULL)
+		for (const uint32_t index : mesh.indices)
+		{
+			if (index >= mesh.vertices.size())
 			{
-				result.error = PhysicalDeviceError::GLFW_FRAMEBUFFER_SIZE_ERROR;
+				result.error = MeshError::INDEX_OUT_OF_RANGE_ERROR;
+				return result;
 			}
+		}
 
-			vk::Extent2D actualExtent = { static_cast<uint32_t>(width), static_cast<uint32_t>(height) };
+		const size_t triangleCount = mesh.indices.size() / 3;
+		const size_t vertexCount = mesh.vertices.size();
 
-			actualExtent.width = std::max(surfaceCapabilities.minImageExtent.width, std::min(surfaceCapabilities.maxImageExtent.width, actualExtent.width));
-			actualExtent.height = std::max(surfaceCapabilities.minImageExtent.height, std::min(surfaceCapabilities.maxImageExtent.height, actualExtent.height));
+		//Triangles using each vertex, stored contiguously (offsets[v] to offsets[v + 1])
+		std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+		for (size_t i = 0; i < triangleCount * 3; i++)
+		{
+			adjacencyOffsets[mesh.indices[i] + 1]++;
+		}
+		for (size_t v = 0; v < vertexCount; v++)
+		{
+			adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+		}
 
-			result.value = std::move(actualExtent);
+		std::vector<uint32_t> adjacentTriangles(triangleCount * 3);
+		std::vector<uint32_t> adjacencyFill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for (size_t i = 0; i < triangleCount * 3; i++)
+		{
+			adjacentTriangles[adjacencyFill[mesh.indices[i]]++] = static_cast<uint32_t>(i / 3);
 		}
 
-		return result;
-	}
+		//Tags hold the id + 1 of the last meshlet a vertex or a candidate triangle was added to, avoiding any clearing between meshlets
+		std::vector<uint32_t> vertexTags(vertexCount, 0);
+		std::vector<uint32_t> candidateTags(triangleCount, 0);
+		std::vector<bool> emitted(triangleCount, false);
 
-	inline SkResult<std::string, PhysicalDeviceError> getMemoryInformations(const vk::PhysicalDevice& physicalDevice)
-	{
-		SkResult result(static_cast<std::string>(std::string()), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+		MeshletMesh meshletMesh;
+		meshletMesh.mesh.vertices = mesh.vertices;
+		meshletMesh.mesh.indices.reserve(triangleCount * 3);
 
-		uint64_t bytesToMbConversion = 1048576;
+		std::vector<uint32_t> candidates;
+		size_t nextSeed = 0;
+		size_t emittedCount = 0;
 
-		vk::PhysicalDeviceMemoryProperties memoryProperties = physicalDevice.getMemoryProperties();
+		while (emittedCount < triangleCount)
+		{
+			const uint32_t tag = static_cast<uint32_t>(meshletMesh.meshlets.size()) + 1;
+			const uint32_t firstIndex = static_cast<uint32_t>(meshletMesh.mesh.indices.size());
+			uint32_t meshletVertexCount = 0;
+			uint32_t meshletTriangleCount = 0;
 
-		std::string memoryInformations = std::string("");
-		memoryInformations.append("Heap count : " + std::to_string(memoryProperties.memoryHeapCount) + '\t');
-		memoryInformations.append("Type count : " + std::to_string(memoryProperties.memoryTypeCount) + '\n');
+			//Sum of the positions of the vertices of the meshlet, its centroid being the sum divided by meshletVertexCount
+			std::array<float, 3> positionSum = { 0.0f, 0.0f, 0.0f };
 
-		for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; i++)
-		{
-			uint32_t memoryTypeRelativeIndex = 0;
+			candidates.clear();
 
-			memoryInformations.append("Heap [" + std::to_string(i) + "] ");
+			auto addTriangle = [&](const uint32_t triangle)
+			{
+				emitted[triangle] = true;
+				emittedCount++;
+				meshletTriangleCount++;
 
-			if (memoryProperties.memoryHeaps[i].flags == vk::MemoryHeapFlagBits::eDeviceLocal)
+				for (uint32_t corner = 0; corner < 3; corner++)
+				{
+					uint32_t vertex = mesh.indices[triangle * 3 + corner];
+					meshletMesh.mesh.indices.emplace_back(vertex);
+
+					if (vertexTags[vertex] == tag)
+					{
+						continue;
+					}
+
+					vertexTags[vertex] = tag;
+					meshletVertexCount++;
+
+					positionSum[0] += mesh.vertices[vertex].position.x;
+					positionSum[1] += mesh.vertices[vertex].position.y;
+					positionSum[2] += mesh.vertices[vertex].position.z;
+
+					for (uint32_t a = adjacencyOffsets[vertex]; a < adjacencyOffsets[vertex + 1]; a++)
+					{
+						uint32_t adjacentTriangle = adjacentTriangles[a];
+						if (!emitted[adjacentTriangle] && candidateTags[adjacentTriangle] != tag)
+						{
+							candidateTags[adjacentTriangle] = tag;
+							candidates.emplace_back(adjacentTriangle);
+						}
+					}
+				}
+			};
+
+			while (emitted[nextSeed])
 			{
-				memoryInformations.append("(DEVICE MEMORY)");
+				nextSeed++;
 			}
+			addTriangle(static_cast<uint32_t>(nextSeed));
 
-			memoryInformations.append(" : \n");
+			while (meshletTriangleCount < maxTriangles)
+			{
+				size_t bestCandidate = candidates.size();
+				uint32_t bestNewVertices = 4;
+				float bestDistance = std::numeric_limits<float>::max();
 
-			memoryInformations.append("\tSize : " + std::to_string(memoryProperties.memoryHeaps[i].size) + " bytes (" + std::to_string(memoryProperties.memoryHeaps[i].size / bytesToMbConversion) + " MB) \n");
+				const std::array<float, 3> centroid = { positionSum[0] / meshletVertexCount, positionSum[1] / meshletVertexCount, positionSum[2] / meshletVertexCount };
 
-			for (uint32_t j = 0; j < memoryProperties.memoryTypeCount; j++)
-			{
-				if (memoryProperties.memoryTypes[j].heapIndex == i)
+				for (size_t c = 0; c < candidates.size();)
 				{
-					memoryInformations.append("\tMemory type [" + std::to_string(memoryTypeRelativeIndex) + "] : ");
-					memoryInformations.append(vk::to_string(memoryProperties.memoryTypes[j].propertyFlags));
-					memoryInformations.append("\n");
+					uint32_t triangle = candidates[c];
+					if (emitted[triangle])
+					{
+						candidates[c] = candidates.back();
+						candidates.pop_back();
+						continue;
+					}
 
-					memoryTypeRelativeIndex++;
+					uint32_t newVertices = 0;
+					std::array<float, 3> triangleCentroid = { 0.0f, 0.0f, 0.0f };
+					for (uint32_t corner = 0; corner < 3; corner++)
+					{
+						const uint32_t vertex = mesh.indices[triangle * 3 + corner];
+						newVertices += (vertexTags[vertex] != tag ? 1 : 0);
+
+						triangleCentroid[0] += mesh.vertices[vertex].position.x / 3.0f;
+						triangleCentroid[1] += mesh.vertices[vertex].position.y / 3.0f;
+						triangleCentroid[2] += mesh.vertices[vertex].position.z / 3.0f;
+					}
+
+					//Ties go to the triangle closest to the centroid of the meshlet, growing it as a disc rather than as a strip
+					float distance = (triangleCentroid[0] - centroid[0]) * (triangleCentroid[0] - centroid[0]) +
+					                 (triangleCentroid[1] - centroid[1]) * (triangleCentroid[1] - centroid[1]) +
+					                 (triangleCentroid[2] - centroid[2]) * (triangleCentroid[2] - centroid[2]);
+
+					if (meshletVertexCount + newVertices <= maxVertices &&
+					    (newVertices < bestNewVertices || (newVertices == bestNewVertices && distance < bestDistance)))
+					{
+						bestCandidate = c;
+						bestNewVertices = newVertices;
+						bestDistance = distance;
+					}
+
+					c++;
 				}
+
+				if (bestCandidate == candidates.size())
+				{
+					break;
+				}
+
+				uint32_t triangle = candidates[bestCandidate];
+				candidates[bestCandidate] = candidates.back();
+				candidates.pop_back();
+
+				addTriangle(triangle);
 			}
+
+			meshletMesh.meshlets.emplace_back(computeMeshletBounds(meshletMesh.mesh, firstIndex, meshletTriangleCount * 3));
 		}
 
-		result.value = std::move(memoryInformations);
+		result.value = std::move(meshletMesh);
 		return result;
 	}
 
-	inline SkResult<uint32_t, PhysicalDeviceError> getHeapIndexByTypeIndex(const vk::PhysicalDevice& physicalDevice, const uint32_t& memoryTypeIndex)
+	/*LEVEL OF DETAIL*/
+
+	/*Error quadric of Garland and Heckbert : symmetric 4x4 matrix (10 coefficients) summing the weighted squared distances to a set of planes*/
+	struct Quadric
 	{
-		uint32_t value = std::numeric_limits<uint32_t>::max();
-		PhysicalDeviceError error = PhysicalDeviceError::NO_ERROR;
+		Quadric()
+			: coefficients{}, weight(0.0)
+		{}
 
-		vk::PhysicalDeviceMemoryProperties memoryProperties = physicalDevice.getMemoryProperties();
+		/*Quadric of the plane ax + by + cz + d = 0, (a, b, c) being normalized*/
+		static Quadric fromPlane(const double a, const double b, const double c, const double d, const double planeWeight) noexcept
+		{
+			Quadric quadric;
+			quadric.coefficients = { a * a, a * b, a * c, a * d, b * b, b * c, b * d, c * c, c * d, d * d };
+			for (auto& coefficient : quadric.coefficients)
+			{
+				coefficient *= planeWeight;
+			}
 
-		uint32_t heapIndex = std::numeric_limits<uint32_t>::max();
-		for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++)
+			quadric.weight = planeWeight;
+			return quadric;
+		}
+
+		Quadric& operator+=(const Quadric& other) noexcept
 		{
-			if (i == memoryTypeIndex)
+			for (size_t i = 0; i < coefficients.size(); i++)
 			{
-				heapIndex = memoryProperties.memoryTypes[i].heapIndex;
+				coefficients[i] += other.coefficients[i];
 			}
+
+			weight += other.weight;
+			return *this;
 		}
 
-		value = heapIndex;
-		return SkResult(value, error);
-	}
+		/*Returns the weighted sum of the squared distances between a point and the planes of the quadric*/
+		double evaluate(const SOULKAN_MATHS_NAMESPACE::Vec3& point) const noexcept
+		{
+			const double x = point.x;
+			const double y = point.y;
+			const double z = point.z;
 
-	/*LOGICAL DEVICE*/
+			const auto& q = coefficients;
+			return q[0] * x * x + 2.0 * q[1] * x * y + 2.0 * q[2] * x * z + 2.0 * q[3] * x
+			     + q[4] * y * y + 2.0 * q[5] * y * z + 2.0 * q[6] * y
+			     + q[7] * z * z + 2.0 * q[8] * z
+			     + q[9];
+		}
 
-	/*@brief Returns a vulkan device from a given vulkan physical device
+		std::array<double, 10> coefficients;
+		double weight;
+	};
+
+	/*@brief Simplifies an indexed mesh with quadric error metrics edge collapses until it holds targetIndexCount indices or any further collapse
+	* would move the surface by more than targetError. Vertices collapse onto existing vertices, so the simplified mesh keeps the vertex array
+	* of the original mesh and only gets new indices, which lets every level of detail share one vertex buffer.
+	* Borders are kept in place by perpendicular border planes, vertices sharing their position with another vertex (attribute seams) are locked
 	*
-	* @param physicalDevice a vulkan physical device
-	* @param queueFamilyIndexes a vector of queue family indexes to be included in the device creation
-	* @param deviceExtensions a vector of extension (names) to be enabled on the device
-	* @param physicalDeviceFeatures vulkan physical device features to be enabled on the dedvice
-	* @param specificQueueFamilyIndex the index of the queue family to be enabled on the device (default is -1), -1 value means all the indexes from queueFamilyIndexes are used for device creation
+	* @param mesh The indexed mesh to be simplified
+	* @param targetIndexCount The number of indices to reach (3 per triangle)
+	* @param targetError The largest error accepted for a collapse, in mesh units (area weighted RMS distance to the original planes)
+	* @param pResultError If not nullptr, receives the largest error of the collapses that were performed
+	*
+	* @return SkResult(simplified mesh with the vertices of mesh, MeshError)
 	*/
-	inline SkResult<vk::Device, DeviceError> createDevice(const vk::PhysicalDevice& physicalDevice, const std::array<uint32_t, 6>& queueFamilyIndexes, const std::vector<const char*>& deviceExtensions,
-		vk::PhysicalDeviceFeatures physicalDeviceFeatures = vk::PhysicalDeviceFeatures{}, uint32_t specificQueueFamilyIndex = std::numeric_limits<uint32_t>::max())
+	inline SkResult<Mesh, MeshError> simplifyMesh(const Mesh& mesh, const size_t targetIndexCount, const float targetError = std::numeric_limits<float>::max(), float* pResultError = nullptr)
 	{
-		SkResult result(static_cast<vk::Device>(vk::Device(nullptr)), static_cast<DeviceError>(DeviceError::NO_ERROR));
+		SkResult result(static_cast<Mesh>(Mesh()), static_cast<MeshError>(MeshError::NO_ERROR));
 
-		//DeviceQueueCreateInfos
-		auto concentrateQueueFamilyIndexesResult = concentrateQueueFamilyIndexes(queueFamilyIndexes);
-		std::vector<uint32_t> concentratedQueueFamilyIndexes = retLog(concentrateQueueFamilyIndexesResult);
+		if (!mesh.isIndexed())
+		{
+			result.error = MeshError::MESH_NOT_INDEXED_ERROR;
+			return result;
+		}
 
-		std::vector<vk::DeviceQueueCreateInfo> deviceQueueCreateInfos;
-		deviceQueueCreateInfos.reserve(concentratedQueueFamilyIndexes.size());
+		for (const uint32_t index : mesh.indices)
+		{
+			if (index >= mesh.vertices.size())
+			{
+				result.error = MeshError::INDEX_OUT_OF_RANGE_ERROR;
+				return result;
+			}
+		}
 
-		float queuePriority = 1.0f;
+		const size_t vertexCount = mesh.vertices.size();
+		const size_t triangleCount = mesh.indices.size() / 3;
 
-		if (specificQueueFamilyIndex == std::numeric_limits<uint32_t>::max())
+		std::vector<uint32_t> triangles(mesh.indices.begin(), mesh.indices.begin() + triangleCount * 3);
+		std::vector<bool> aliveTriangles(triangleCount, true);
+
+		std::vector<std::vector<uint32_t>> vertexTriangles(vertexCount);
+		for (size_t i = 0; i < triangles.size(); i++)
 		{
-			for (const auto queueFamilyIndex : concentratedQueueFamilyIndexes)
+			vertexTriangles[triangles[i]].emplace_back(static_cast<uint32_t>(i / 3));
+		}
+
+		auto getPosition = [&](const uint32_t vertex) -> const SOULKAN_MATHS_NAMESPACE::Vec3&
+		{
+			return mesh.vertices[vertex].position;
+		};
+
+		auto getTriangleNormal = [&](const uint32_t v0, const uint32_t v1, const uint32_t v2)
+		{
+			const SOULKAN_MATHS_NAMESPACE::Vec3& p0 = getPosition(v0);
+			const SOULKAN_MATHS_NAMESPACE::Vec3& p1 = getPosition(v1);
+			const SOULKAN_MATHS_NAMESPACE::Vec3& p2 = getPosition(v2);
+
+			return SOULKAN_MATHS_NAMESPACE::cross(SOULKAN_MATHS_NAMESPACE::Vec3(p1.x - p0.x, p1.y - p0.y, p1.z - p0.z), SOULKAN_MATHS_NAMESPACE::Vec3(p2.x - p0.x, p2.y - p0.y, p2.z - p0.z));
+		};
+
+		/*LOCKED VERTICES*/
+		//Collapsing one vertex of an attribute seam without its twins would open a crack
+		std::vector<bool> lockedVertices(vertexCount, false);
+		{
+			auto getPositionBits = [&](const uint32_t vertex)
 			{
-				uint32_t index = static_cast<uint32_t>(queueFamilyIndex);
-				deviceQueueCreateInfos.emplace_back(vk::DeviceQueueCreateFlags(), index, 1, &(queuePriority));
+				const SOULKAN_MATHS_NAMESPACE::Vec3& position = getPosition(vertex);
+				return std::make_tuple(getCanonicalFloatBits(position.x), getCanonicalFloatBits(position.y), getCanonicalFloatBits(position.z));
+			};
+
+			std::vector<uint32_t> sortedVertices(vertexCount);
+			for (uint32_t v = 0; v < vertexCount; v++)
+			{
+				sortedVertices[v] = v;
+			}
+
+			std::sort(sortedVertices.begin(), sortedVertices.end(), [&](const uint32_t lhs, const uint32_t rhs) { return getPositionBits(lhs) < getPositionBits(rhs); });
+
+			for (size_t i = 1; i < sortedVertices.size(); i++)
+			{
+				if (getPositionBits(sortedVertices[i - 1]) == getPositionBits(sortedVertices[i]))
+				{
+					lockedVertices[sortedVertices[i - 1]] = true;
+					lockedVertices[sortedVertices[i]] = true;
+				}
 			}
 		}
 
-		else
+		/*QUADRICS*/
+		std::vector<Quadric> quadrics(vertexCount);
+
+		//Number of triangles using each edge, keyed by (smallest vertex << 32 | largest vertex)
+		std::unordered_map<uint64_t, uint32_t> edgeUseCounts;
+		edgeUseCounts.reserve(triangles.size());
+
+		auto getEdgeKey = [](const uint32_t a, const uint32_t b)
 		{
-			if ((specificQueueFamilyIndex > queueFamilyIndexes.size() && specificQueueFamilyIndex < queueFamilyIndexes.size()))
+			return (static_cast<uint64_t>(std::min(a, b)) << 32) | static_cast<uint64_t>(std::max(a, b));
+		};
+
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			const uint32_t* pTriangle = &triangles[t * 3];
+
+			for (uint32_t corner = 0; corner < 3; corner++)
 			{
-				result.error = DeviceError::WRONG_QUEUE_FAMILY_INDEX;
+				edgeUseCounts[getEdgeKey(pTriangle[corner], pTriangle[(corner + 1) % 3])]++;
 			}
 
-			else
+			SOULKAN_MATHS_NAMESPACE::Vec3 normal = getTriangleNormal(pTriangle[0], pTriangle[1], pTriangle[2]);
+			float normalLength = SOULKAN_MATHS_NAMESPACE::length(normal);
+			if (normalLength == 0.0f)
 			{
-				uint32_t index = static_cast<uint32_t>(queueFamilyIndexes[specificQueueFamilyIndex]);
-				deviceQueueCreateInfos.emplace_back(vk::DeviceQueueCreateFlags(), index, 1, &(queuePriority));
+				continue;
+			}
+
+			const SOULKAN_MATHS_NAMESPACE::Vec3& p0 = getPosition(pTriangle[0]);
+			SOULKAN_MATHS_NAMESPACE::Vec3 unitNormal(normal.x / normalLength, normal.y / normalLength, normal.z / normalLength);
+
+			//Planes weighted by the area of their triangle
+			Quadric planeQuadric = Quadric::fromPlane(unitNormal.x, unitNormal.y, unitNormal.z, -SOULKAN_MATHS_NAMESPACE::dot(unitNormal, p0), normalLength * 0.5f);
+			for (uint32_t corner = 0; corner < 3; corner++)
+			{
+				quadrics[pTriangle[corner]] += planeQuadric;
 			}
 		}
 
-		//DeviceCreateInfo
-		vk::DeviceCreateInfo deviceCreateInfo = vk::DeviceCreateInfo(vk::DeviceCreateFlags(), static_cast<uint32_t>(deviceQueueCreateInfos.size()), deviceQueueCreateInfos.data());
+		//Border edges get a heavily weighted plane perpendicular to their triangle, keeping the silhouette of open meshes
+		const float borderWeight = 10.0f;
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			const uint32_t* pTriangle = &triangles[t * 3];
 
-		if (deviceExtensions.size() == 0)
+			SOULKAN_MATHS_NAMESPACE::Vec3 normal = getTriangleNormal(pTriangle[0], pTriangle[1], pTriangle[2]);
+			float normalLength = SOULKAN_MATHS_NAMESPACE::length(normal);
+			if (normalLength == 0.0f)
+			{
+				continue;
+			}
+
+			for (uint32_t corner = 0; corner < 3; corner++)
+			{
+				uint32_t a = pTriangle[corner];
+				uint32_t b = pTriangle[(corner + 1) % 3];
+				if (edgeUseCounts[getEdgeKey(a, b)] != 1)
+				{
+					continue;
+				}
+
+				const SOULKAN_MATHS_NAMESPACE::Vec3& pa = getPosition(a);
+				const SOULKAN_MATHS_NAMESPACE::Vec3& pb = getPosition(b);
+				SOULKAN_MATHS_NAMESPACE::Vec3 edge(pb.x - pa.x, pb.y - pa.y, pb.z - pa.z);
+
+				SOULKAN_MATHS_NAMESPACE::Vec3 borderNormal = SOULKAN_MATHS_NAMESPACE::cross(edge, SOULKAN_MATHS_NAMESPACE::Vec3(normal.x / normalLength, normal.y / normalLength, normal.z / normalLength));
+				float borderNormalLength = SOULKAN_MATHS_NAMESPACE::length(borderNormal);
+				if (borderNormalLength == 0.0f)
+				{
+					continue;
+				}
+
+				SOULKAN_MATHS_NAMESPACE::Vec3 unitBorderNormal(borderNormal.x / borderNormalLength, borderNormal.y / borderNormalLength, borderNormal.z / borderNormalLength);
+				float edgeLength = SOULKAN_MATHS_NAMESPACE::length(edge);
+
+				Quadric borderQuadric = Quadric::fromPlane(unitBorderNormal.x, unitBorderNormal.y, unitBorderNormal.z, -SOULKAN_MATHS_NAMESPACE::dot(unitBorderNormal, pa), borderWeight * edgeLength * edgeLength);
+				quadrics[a] += borderQuadric;
+				quadrics[b] += borderQuadric;
+			}
+		}
+
+		/*COLLAPSES*/
+		struct Collapse
 		{
-			result.error = DeviceError::DEVICE_EXTENSIONS_EMPTY;
+			float error;
+			uint32_t removedVertex;
+			uint32_t keptVertex;
+			uint32_t removedVersion;
+			uint32_t keptVersion;
+
+			bool operator>(const Collapse& other) const
+			{
+				return error > other.error;
+			}
+		};
+
+		//A collapse is outdated as soon as the quadric of one of its vertices changed
+		std::vector<uint32_t> versions(vertexCount, 0);
+		std::vector<bool> removedVertices(vertexCount, false);
+
+		std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> collapses;
+
+		auto pushCollapse = [&](const uint32_t a, const uint32_t b)
+		{
+			Quadric quadric = quadrics[a];
+			quadric += quadrics[b];
+
+			if (quadric.weight <= 0.0)
+			{
+				return;
+			}
+
+			double errorAToB = (lockedVertices[a] ? std::numeric_limits<double>::max() : quadric.evaluate(getPosition(b)));
+			double errorBToA = (lockedVertices[b] ? std::numeric_limits<double>::max() : quadric.evaluate(getPosition(a)));
+			if (lockedVertices[a] && lockedVertices[b])
+			{
+				return;
+			}
+
+			Collapse collapse = {};
+			collapse.removedVertex = (errorAToB <= errorBToA ? a : b);
+			collapse.keptVertex = (errorAToB <= errorBToA ? b : a);
+			collapse.error = static_cast<float>(std::sqrt(std::max(0.0, std::min(errorAToB, errorBToA)) / quadric.weight));
+			collapse.removedVersion = versions[collapse.removedVertex];
+			collapse.keptVersion = versions[collapse.keptVertex];
+
+			collapses.push(collapse);
+		};
+
+		for (const auto& edgeUseCount : edgeUseCounts)
+		{
+			pushCollapse(static_cast<uint32_t>(edgeUseCount.first >> 32), static_cast<uint32_t>(edgeUseCount.first & 0xFFFFFFFFu));
 		}
 
-		physicalDeviceFeatures.samplerAnisotropy = VK_TRUE;
+		size_t aliveTriangleCount = triangleCount;
+		float resultError = 0.0f;
 
-		deviceCreateInfo.pEnabledFeatures = &(physicalDeviceFeatures);
-		deviceCreateInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
-		deviceCreateInfo.ppEnabledExtensionNames = deviceExtensions.data();
+		while (aliveTriangleCount * 3 > targetIndexCount && !collapses.empty())
+		{
+			Collapse collapse = collapses.top();
+			collapses.pop();
 
-		vk::Device device;
+			const uint32_t removed = collapse.removedVertex;
+			const uint32_t kept = collapse.keptVertex;
 
-		try
+			if (removedVertices[removed] || removedVertices[kept] || versions[removed] != collapse.removedVersion || versions[kept] != collapse.keptVersion)
+			{
+				continue;
+			}
+
+			//Every outdated collapse has been pushed again with its new error, so the queue is sorted and no cheaper collapse is left
+			if (collapse.error > targetError)
+			{
+				break;
+			}
+
+			//Collapses flipping a triangle around the removed vertex fold the surface onto itself
+			bool flips = false;
+			for (const uint32_t t : vertexTriangles[removed])
+			{
+				const uint32_t* pTriangle = &triangles[t * 3];
+				if (!aliveTriangles[t] || pTriangle[0] == kept || pTriangle[1] == kept || pTriangle[2] == kept)
+				{
+					continue;
+				}
+
+				SOULKAN_MATHS_NAMESPACE::Vec3 oldNormal = getTriangleNormal(pTriangle[0], pTriangle[1], pTriangle[2]);
+				SOULKAN_MATHS_NAMESPACE::Vec3 newNormal = getTriangleNormal((pTriangle[0] == removed ? kept : pTriangle[0]), (pTriangle[1] == removed ? kept : pTriangle[1]), (pTriangle[2] == removed ? kept : pTriangle[2]));
+
+				if (SOULKAN_MATHS_NAMESPACE::dot(oldNormal, newNormal) <= 0.0f)
+				{
+					flips = true;
+					break;
+				}
+			}
+
+			if (flips)
+			{
+				continue;
+			}
+
+			for (const uint32_t t : vertexTriangles[removed])
+			{
+				uint32_t* pTriangle = &triangles[t * 3];
+				if (!aliveTriangles[t])
+				{
+					continue;
+				}
+
+				//Triangles using the collapsed edge vanish, the others move their corner onto the kept vertex
+				if (pTriangle[0] == kept || pTriangle[1] == kept || pTriangle[2] == kept)
+				{
+					aliveTriangles[t] = false;
+					aliveTriangleCount--;
+					continue;
+				}
+
+				for (uint32_t corner = 0; corner < 3; corner++)
+				{
+					if (pTriangle[corner] == removed)
+					{
+						pTriangle[corner] = kept;
+					}
+				}
+
+				vertexTriangles[kept].emplace_back(t);
+			}
+
+			removedVertices[removed] = true;
+			vertexTriangles[removed].clear();
+
+			quadrics[kept] += quadrics[removed];
+			versions[kept]++;
+
+			resultError = std::max(resultError, collapse.error);
+
+			auto& keptTriangles = vertexTriangles[kept];
+			keptTriangles.erase(std::remove_if(keptTriangles.begin(), keptTriangles.end(), [&](const uint32_t t) { return !aliveTriangles[t]; }), keptTriangles.end());
+
+			for (const uint32_t t : keptTriangles)
+			{
+				for (uint32_t corner = 0; corner < 3; corner++)
+				{
+					if (triangles[t * 3 + corner] != kept)
+					{
+						pushCollapse(kept, triangles[t * 3 + corner]);
+					}
+				}
+			}
+		}
+
+		Mesh simplifiedMesh;
+		simplifiedMesh.vertices = mesh.vertices;
+		simplifiedMesh.indices.reserve(aliveTriangleCount * 3);
+		for (size_t t = 0; t < triangleCount; t++)
 		{
-			device = physicalDevice.createDevice(deviceCreateInfo);
+			if (aliveTriangles[t])
+			{
+				simplifiedMesh.indices.insert(simplifiedMesh.indices.end(), { triangles[t * 3], triangles[t * 3 + 1], triangles[t * 3 + 2] });
+			}
 		}
-		catch (vk::SystemError err)
+
+		if (pResultError != nullptr)
 		{
-			result.error = DeviceError::DEVICE_CREATION_ERROR;
+			*pResultError = resultError;
 		}
 
-		result.value = std::move(device);
+		result.value = std::move(simplifiedMesh);
 		return result;
 	}
 
-	/*@brief Destroys a given vulkan device
+	/*Range of the indices of a LodMesh drawing one level of detail, error being the simplification error of the level in mesh units*/
+	struct MeshLod
+	{
+		uint32_t firstIndex = 0;
+		uint32_t indexCount = 0;
+		float error = 0.0f;
+	};
+
+	/*Mesh holding the indices of every level of detail one after the other, all of them sharing the vertices of the mesh.
+	* lods[0] is the original mesh, each following level holding fewer triangles*/
+	struct LodMesh
+	{
+		Mesh mesh;
+		std::vector<MeshLod> lods;
+	};
+
+	/*@brief Generates a chain of levels of detail, each level being simplified from the previous one by simplifyMesh().
+	* The chain stops after maxLodCount levels or as soon as a level can not be reduced anymore (locked vertices, flips)
 	*
-	* @param device the vulkan device to be destroyed
+	* @param mesh The indexed mesh to generate the levels of detail of
+	* @param maxLodCount The maximum number of levels, the original mesh included
+	* @param reductionRatio The ratio between the index counts of two consecutive levels, in ]0, 1[
 	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), DeviceError)
+	* @return SkResult(mesh holding every level of detail, MeshError)
 	*/
-	inline SkResult<bool, DeviceError> destroyDevice(vk::Device& device)
+	inline SkResult<LodMesh, MeshError> generateLodChain(const Mesh& mesh, const uint32_t maxLodCount = 6, const float reductionRatio = 0.5f)
 	{
-		SkResult result(static_cast<bool>(true), static_cast<DeviceError>(DeviceError::NO_ERROR));
+		SkResult result(static_cast<LodMesh>(LodMesh()), static_cast<MeshError>(MeshError::NO_ERROR));
 
-		try
+		if (!mesh.isIndexed())
 		{
-			device.destroy();
+			result.error = MeshError::MESH_NOT_INDEXED_ERROR;
+			return result;
 		}
-		catch (vk::SystemError err)
+
+		if (reductionRatio <= 0.0f || reductionRatio >= 1.0f || maxLodCount == 0)
 		{
-			result.value = false;
-			result.error = DeviceError::DEVICE_DESTRUCTION_ERROR;
+			result.error = MeshError::INVALID_LOD_PARAMETERS_ERROR;
+			return result;
+		}
+
+		LodMesh lodMesh;
+		lodMesh.mesh = mesh;
+
+		MeshLod baseLod;
+		baseLod.indexCount = static_cast<uint32_t>(mesh.indices.size());
+		lodMesh.lods.emplace_back(baseLod);
+
+		Mesh currentMesh = mesh;
+		while (lodMesh.lods.size() < maxLodCount)
+		{
+			size_t targetIndexCount = static_cast<size_t>(currentMesh.indices.size() / 3 * reductionRatio) * 3;
+
+			float simplificationError = 0.0f;
+			auto simplifyMeshResult = simplifyMesh(currentMesh, targetIndexCount, std::numeric_limits<float>::max(), &simplificationError);
+			if (logError(simplifyMeshResult))
+			{
+				result.error = simplifyMeshResult.error;
+				return result;
+			}
+
+			//A level saving less than 10% of the triangles of the previous one is not worth its memory
+			if (simplifyMeshResult.value.indices.empty() || simplifyMeshResult.value.indices.size() * 10 > currentMesh.indices.size() * 9)
+			{
+				break;
+			}
+
+			//Errors add up along the chain as every level is simplified from the previous one
+			MeshLod lod;
+			lod.firstIndex = static_cast<uint32_t>(lodMesh.mesh.indices.size());
+			lod.indexCount = static_cast<uint32_t>(simplifyMeshResult.value.indices.size());
+			lod.error = lodMesh.lods.back().error + simplificationError;
+
+			lodMesh.mesh.indices.insert(lodMesh.mesh.indices.end(), simplifyMeshResult.value.indices.begin(), simplifyMeshResult.value.indices.end());
+			lodMesh.lods.emplace_back(lod);
+
+			currentMesh = std::move(simplifyMeshResult.value);
 		}
 
+		result.value = std::move(lodMesh);
 		return result;
 	}
 
-	/*@brief Returns a vulkan queue from a given queue family index and a given queue index
+	/*@brief Selects the coarsest level of detail whose error, projected on screen, stays under pixelThreshold pixels.
+	* The error is projected at the point of the bounding sphere closest to the camera, the finest level being used when the camera is inside the sphere
 	*
-	* @param device a vulkan device
-	* @param queueFamilyIndex the index of the queueFamily from which the queue will stem from
-	* @param queueIndex the index of the queue from the queueFamily
+	* @param lods The levels of detail of the mesh, from the finest to the coarsest
+	* @param boundingSphere The world space center (x, y, z) and radius (w) of the mesh
+	* @param worldScale The largest scale applied by the model matrix, the errors being in mesh units
+	* @param view The world to view matrix, the camera looking toward +z as perspectiveProjection() expects
+	* @param projection The projection matrix created by perspectiveProjection()
+	* @param viewportHeight The height of the viewport in pixels
+	* @param pixelThreshold The largest error accepted on screen, in pixels
+	*
+	* @return The index of the selected level in lods
 	*/
-	inline SkResult<vk::Queue, DeviceError> getQueue(const vk::Device& device, uint32_t queueFamilyIndex, uint32_t queueIndex)
+	inline uint32_t selectLod(const std::vector<MeshLod>& lods, const SOULKAN_MATHS_NAMESPACE::Vec4& boundingSphere, const float worldScale, const SOULKAN_MATHS_NAMESPACE::Mat4& view,
+		const SOULKAN_MATHS_NAMESPACE::Mat4& projection, const float viewportHeight, const float pixelThreshold = 1.0f) noexcept
 	{
-		SkResult result(static_cast<vk::Queue>(vk::Queue(nullptr)), static_cast<DeviceError>(DeviceError::NO_ERROR));
+		if (lods.empty())
+		{
+			return 0;
+		}
 
-		try
+		//View space depth of the center of the sphere (matrix[column][row])
+		float depth = view.matrix[0][2] * boundingSphere.x + view.matrix[1][2] * boundingSphere.y + view.matrix[2][2] * boundingSphere.z + view.matrix[3][2];
+		float distance = depth - boundingSphere.w;
+		if (distance <= 0.0f)
 		{
-			result.value = device.getQueue(queueFamilyIndex, queueIndex);
+			return 0;
 		}
-		catch (vk::SystemError err)
+
+		//projection[1][1] = 1 / tan(fovy / 2), the pixel size of a unit at a given distance
+		float pixelsPerUnit = std::abs(projection.matrix[1][1]) * viewportHeight * 0.5f / distance;
+
+		for (size_t lod = lods.size(); lod > 1; lod--)
 		{
-			result.error = DeviceError::QUEUE_CREATION_ERROR;
+			if (lods[lod - 1].error * worldScale * pixelsPerUnit <= pixelThreshold)
+			{
+				return static_cast<uint32_t>(lod - 1);
+			}
 		}
 
-		return result;
+		return 0;
 	}
 
-	/*QUEUE*/
+	/*MESH FILES*/
 
-	/*@brief Submits a given command buffer from a given queue, infos such as semaphores and fences must be included to ensure synchronization
-	*
-	* @param queue the queue which to submit from
-	* @param commandBuffer vector of command buffers holding the commands to be submitted
-	* @param waitSemaphore vector of semaphores on which to wait before submitting
-	* @param signalSemaphore vector of semaphores to signal after submitting
-	* @param renderFence the fence to signal after submitting
-	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), DeviceError)
+	/*Location of a section of a mesh file : offset in bytes from the start of the file and number of elements*/
+	struct MeshFileSection
+	{
+		uint64_t offset = 0;
+		uint64_t count = 0;
+	};
+
+	/*Header of the binary mesh files written by writeMeshFile() (little endian, 128 bytes).
+	* Every section starts on a meshFileSectionAlignment boundary and holds data exactly as it is laid out in GPU buffers :
+	* Vertex array, indices narrowed to indexSize bytes, MeshLod array and Meshlet array
 	*/
-	inline SkResult<bool, DeviceError> queueSubmit(const vk::Queue& queue, const std::vector<vk::CommandBuffer>& commandBuffer, std::vector<vk::Semaphore>& waitSemaphores, std::vector<vk::Semaphore>& signalSemaphore, vk::Fence& renderFence)
+	struct MeshFileHeader
 	{
-		SkResult result(static_cast<bool>(true), static_cast<DeviceError>(DeviceError::NO_ERROR));
+		uint32_t magic = 0;
+		uint32_t version = 0;
+		uint32_t vertexStride = 0;
+		uint32_t indexSize = 0;
+		uint64_t fileSize = 0;
+
+		MeshFileSection vertices;
+		MeshFileSection indices;
+		MeshFileSection lods;
+		MeshFileSection meshlets;
+
+		std::array<float, 3> boundsMin = {};
+		std::array<float, 3> boundsMax = {};
+		std::array<float, 4> boundingSphere = {};
+	};
 
-		vk::SubmitInfo submitInfo = {};
+	constexpr uint32_t meshFileMagic = 0x48534D53; //"SMSH"
+	constexpr uint32_t meshFileVersion = 1;
 
-		vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eColorAttachmentOutput;
+	//256 = the largest minStorageBufferOffsetAlignment allowed by vulkan, a whole file can be uploaded into one buffer and bound by section
+	constexpr uint64_t meshFileSectionAlignment = 256;
 
-		submitInfo.pWaitDstStageMask = &waitStage;
+	static_assert(sizeof(MeshFileHeader) == 128, "MeshFileHeader is read straight from the files, its layout must not change");
+	static_assert(sizeof(MeshLod) == 12 && sizeof(Meshlet) == 48 && sizeof(Vertex) == 36, "Mesh file sections are read straight from the files, their layout must not change");
 
-		submitInfo.waitSemaphoreCount = static_cast<uint32_t>(waitSemaphores.size());
-		submitInfo.pWaitSemaphores = waitSemaphores.data();
+	/*Validated view over the content of a mesh file held in memory (usually a MappedFile), nothing is copied*/
+	struct MeshFileView
+	{
+		const MeshFileHeader* pHeader = nullptr;
+		const uint8_t* pFileData = nullptr;
 
-		submitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphore.size());
-		submitInfo.pSignalSemaphores = signalSemaphore.data();
+		vk::IndexType getIndexType() const
+		{
+			return (pHeader->indexSize == sizeof(uint16_t) ? vk::IndexType::eUint16 : vk::IndexType::eUint32);
+		}
 
-		submitInfo.commandBufferCount = static_cast<uint32_t>(commandBuffer.size());
-		submitInfo.pCommandBuffers = commandBuffer.data();
+		const void* getVertexData() const
+		{
+			return pFileData + pHeader->vertices.offset;
+		}
 
-		try
+		const void* getIndexData() const
 		{
-			queue.submit(submitInfo, renderFence);
+			return pFileData + pHeader->indices.offset;
 		}
-		catch (vk::SystemError err)
+
+		const MeshLod* getLods() const
 		{
-			result.value = false;
-			result.error = DeviceError::QUEUE_SUBMIT_ERROR;
+			return reinterpret_cast<const MeshLod*>(pFileData + pHeader->lods.offset);
 		}
 
-		return result;
-	}
+		const Meshlet* getMeshlets() const
+		{
+			return reinterpret_cast<const Meshlet*>(pFileData + pHeader->meshlets.offset);
+		}
 
-	/*@brief Submits a given command buffer from a given queue, infos such as semaphores and fences must be included to ensure synchronization
-	*
-	* @param queue the queue which to submit from
-	* @param commandBuffer the command buffer holding the commands to be submitted
-	* @param waitSemaphore the semaphore on which to wait before submitting
-	* @param signalSemaphore the semaphore to signal after submitting
-	* @param renderFence the fence to signal after submitting
-	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), DeviceError)
-	*/
-	inline SkResult<bool, DeviceError> queueSubmit(const vk::Queue& queue, const vk::CommandBuffer& commandBuffer, vk::Semaphore& waitSemaphores, vk::Semaphore& signalSemaphore, vk::Fence& renderFence)
-	{
-		SkResult result(static_cast<bool>(true), static_cast<DeviceError>(DeviceError::NO_ERROR));
+		vk::DeviceSize getVertexDataSize() const
+		{
+			return pHeader->vertices.count * pHeader->vertexStride;
+		}
 
-		vk::SubmitInfo submitInfo = {};
+		vk::DeviceSize getIndexDataSize() const
+		{
+			return pHeader->indices.count * pHeader->indexSize;
+		}
 
-		vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eColorAttachmentOutput;
+		vk::DeviceSize getMeshletDataSize() const
+		{
+			return pHeader->meshlets.count * sizeof(Meshlet);
+		}
 
-		submitInfo.pWaitDstStageMask = &waitStage;
+		/*Offset of the first section, everything from there to the end of the file is GPU ready data*/
+		vk::DeviceSize getDataOffset() const
+		{
+			return pHeader->vertices.offset;
+		}
 
-		submitInfo.waitSemaphoreCount = 1;
-		submitInfo.pWaitSemaphores = &waitSemaphores;
+		/*Size of the GPU ready data of the file, the size of the staging memory needed by recordMeshFileUpload()*/
+		vk::DeviceSize getDataSize() const
+		{
+			return pHeader->fileSize - pHeader->vertices.offset;
+		}
+	};
 
-		submitInfo.signalSemaphoreCount = 1;
-		submitInfo.pSignalSemaphores = &signalSemaphore;
+	/*Read only memory mapping of a whole file (mmap or CreateFileMapping), the pages being read from disk on first access.
+	* The mapping is released by close() or by the destructor*/
+	class MappedFile
+	{
+	public:
+		MappedFile()
+		{
 
-		submitInfo.commandBufferCount = 1;
-		submitInfo.pCommandBuffers = &commandBuffer;
+		}
 
-		try
+		~MappedFile()
 		{
-			queue.submit(submitInfo, renderFence);
+			close();
 		}
-		catch (vk::SystemError err)
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/*@brief Maps a file in memory, closing the previously mapped file if any
+		*
+		* @param filename The name of the file to be mapped
+		*
+		* @return SkResult(bool signaling if the operation worked(1) or not(0), FileError)
+		*/
+		inline SkResult<bool, FileError> open(const std::string_view filename)
 		{
-			result.value = false;
-			result.error = DeviceError::QUEUE_SUBMIT_ERROR;
-		}
+			SkResult result(static_cast<bool>(false), static_cast<FileError>(FileError::NO_ERROR));
 
-		return result;
-	}
+			close();
 
-	/*@brief Presents from a given queue a given swapchain image using a given swapchain image index, semaphore must be included to ensure synchronization
-	*
-	* @param queue a vulkan queue to present from
-	* @param swapchain a vulkan swapchain from which the presented image stems from
-	* @param waitSemaphore the semaphore on which to wait before presenting
-	* @param swapchainImageIndex the index of the image to be rendered from the swapchain
-	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), DeviceError)
-	*/
-	inline SkResult<bool, DeviceError> queuePresent(const vk::Queue& queue, const vk::SwapchainKHR& swapchain, vk::Semaphore& waitSemaphore, uint32_t swapchainImageIndex)
-	{
-		SkResult result(static_cast<bool>(true), static_cast<DeviceError>(DeviceError::NO_ERROR));
+#ifdef _WIN32
+			fileHandle = CreateFileA(std::string(filename).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+			if (fileHandle == INVALID_HANDLE_VALUE)
+			{
+				result.error = FileError::FILE_OPENING_ERROR;
+				return result;
+			}
 
-		vk::PresentInfoKHR presentInfo = {};
+			LARGE_INTEGER fileSize = {};
+			if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+			{
+				close();
+				result.error = FileError::FILE_MAPPING_ERROR;
+				return result;
+			}
 
-		presentInfo.pSwapchains = &swapchain;
-		presentInfo.swapchainCount = 1;
+			mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mappingHandle == nullptr)
+			{
+				close();
+				result.error = FileError::FILE_MAPPING_ERROR;
+				return result;
+			}
 
-		presentInfo.pWaitSemaphores = &waitSemaphore;
-		presentInfo.waitSemaphoreCount = 1;
+			pData = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+			size = static_cast<size_t>(fileSize.QuadPart);
+#else
+			fileDescriptor = ::open(std::string(filename).c_str(), O_RDONLY);
+			if (fileDescriptor < 0)
+			{
+				result.error = FileError::FILE_OPENING_ERROR;
+				return result;
+			}
 
-		presentInfo.pImageIndices = &swapchainImageIndex;
+			struct stat fileStatus = {};
+			if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size == 0)
+			{
+				close();
+				result.error = FileError::FILE_MAPPING_ERROR;
+				return result;
+			}
 
-		try
-		{
-			auto res = queue.presentKHR(presentInfo);
-			if (res != vk::Result::eSuccess)
+			size = static_cast<size_t>(fileStatus.st_size);
+			pData = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (pData == MAP_FAILED)
 			{
-				result.error = DeviceError::QUEUE_PRESENT_ERROR;
+				pData = nullptr;
+			}
+			else
+			{
+				//Files are mostly read from start to end when uploaded
+				madvise(pData, size, MADV_SEQUENTIAL);
+			}
+#endif
+
+			if (pData == nullptr)
+			{
+				close();
+				result.error = FileError::FILE_MAPPING_ERROR;
+				return result;
 			}
+
+			result.value = true;
+			return result;
 		}
-		catch (vk::SystemError err)
+
+		/*Releases the mapping and the file*/
+		inline void close()
 		{
-			result.value = false;
-			result.error = DeviceError::QUEUE_PRESENT_ERROR;
-		}
+#ifdef _WIN32
+			if (pData != nullptr)
+			{
+				UnmapViewOfFile(pData);
+			}
 
-		return result;
-	}
+			if (mappingHandle != nullptr)
+			{
+				CloseHandle(mappingHandle);
+				mappingHandle = nullptr;
+			}
 
-	/*Swapchain*/
+			if (fileHandle != INVALID_HANDLE_VALUE)
+			{
+				CloseHandle(fileHandle);
+				fileHandle = INVALID_HANDLE_VALUE;
+			}
+#else
+			if (pData != nullptr)
+			{
+				munmap(pData, size);
+			}
 
-	inline SkResult<vk::SwapchainCreateInfoKHR, DeviceError> createSwapchainCreateInfo(const vk::PhysicalDevice& physicalDevice, const vk::SurfaceKHR& surface, GLFWwindow* pWindow, const vk::PresentModeKHR& presentMode,
-		const vk::SurfaceFormatKHR& surfaceFormat, const vk::Extent2D& extent, const std::array<uint32_t, 6>& queueFamilyIndices)
-	{
-		SkResult result(vk::SwapchainCreateInfoKHR{}, DeviceError::NO_ERROR);
+			if (fileDescriptor >= 0)
+			{
+				::close(fileDescriptor);
+				fileDescriptor = -1;
+			}
+#endif
 
-		vk::SurfaceCapabilitiesKHR surfaceCapabilities = physicalDevice.getSurfaceCapabilitiesKHR(surface);
-		uint32_t swapchainImageCount = surfaceCapabilities.minImageCount + 1;
-		if (surfaceCapabilities.maxImageCount > 0 && swapchainImageCount > surfaceCapabilities.maxImageCount)
-		{
-			swapchainImageCount = surfaceCapabilities.maxImageCount;
+			pData = nullptr;
+			size = 0;
 		}
 
-		vk::SwapchainCreateInfoKHR swapchainCreateInfo = vk::SwapchainCreateInfoKHR(vk::SwapchainCreateFlagsKHR(),
-			                                                                        surface,
-			                                                                        swapchainImageCount,
-			                                                                        surfaceFormat.format,
-			                                                                        surfaceFormat.colorSpace,
-			                                                                        extent,
-			                                                                        1,
-			                                                                        vk::ImageUsageFlagBits::eColorAttachment);
-
-		swapchainCreateInfo.queueFamilyIndexCount = static_cast<uint32_t>(queueFamilyIndices.size());
-		swapchainCreateInfo.pQueueFamilyIndices = queueFamilyIndices.data();
-
-		if (queueFamilyIndices.size() > 1)
+		/*Returns a pointer to the mapped content of the file, nullptr if no file is mapped*/
+		inline const void* getData() const
 		{
-			swapchainCreateInfo.imageSharingMode = vk::SharingMode::eConcurrent;
+			return pData;
 		}
 
-		else
+		/*Returns the size of the mapped file in bytes*/
+		inline size_t getSize() const
 		{
-			swapchainCreateInfo.imageSharingMode = vk::SharingMode::eExclusive;
+			return size;
 		}
 
-		swapchainCreateInfo.preTransform = surfaceCapabilities.currentTransform;
-		swapchainCreateInfo.compositeAlpha = vk::CompositeAlphaFlagBitsKHR::eOpaque;
-
-		swapchainCreateInfo.presentMode = presentMode;
-
-		swapchainCreateInfo.clipped = VK_TRUE;
-		swapchainCreateInfo.oldSwapchain = vk::SwapchainKHR(nullptr);
-
-		result.value = std::move(swapchainCreateInfo);
+	private:
+#ifdef _WIN32
+		HANDLE fileHandle = INVALID_HANDLE_VALUE;
+		HANDLE mappingHandle = nullptr;
+#else
+		int fileDescriptor = -1;
+#endif
+
+		void* pData = nullptr;
+		size_t size = 0;
+	};
 
-		return result;
-	}
+	/*Axis aligned bounding box and bounding sphere (center, radius) of a mesh*/
+	struct MeshBounds
+	{
+		std::array<float, 3> boundsMin = {};
+		std::array<float, 3> boundsMax = {};
+		std::array<float, 4> boundingSphere = {};
+	};
 
-	inline SkResult<vk::SwapchainKHR, DeviceError> createVkSwapchain(const vk::Device& device, const vk::SwapchainCreateInfoKHR& swapchainCreateInfo)
+	/*@brief Computes the bounds of the vertices of a mesh, the bounding sphere being centered on the bounding box
+	*
+	* @param mesh The mesh whose bounds are computed
+	*
+	* @return The bounds of the mesh, all zeros for an empty mesh
+	*/
+	inline MeshBounds computeMeshBounds(const Mesh& mesh) noexcept
 	{
-		SkResult result(vk::SwapchainKHR(nullptr), DeviceError::NO_ERROR);
+		MeshBounds bounds;
+		if (mesh.vertices.empty())
+		{
+			return bounds;
+		}
 
-		try
+		const SOULKAN_MATHS_NAMESPACE::Vec3& firstPosition = mesh.vertices[0].position;
+		bounds.boundsMin = { firstPosition.x, firstPosition.y, firstPosition.z };
+		bounds.boundsMax = bounds.boundsMin;
+
+		for (const auto& vertex : mesh.vertices)
 		{
-			result.value = device.createSwapchainKHR(swapchainCreateInfo);
+			const std::array<float, 3> position = { vertex.position.x, vertex.position.y, vertex.position.z };
+			for (size_t axis = 0; axis < 3; axis++)
+			{
+				bounds.boundsMin[axis] = std::min(bounds.boundsMin[axis], position[axis]);
+				bounds.boundsMax[axis] = std::max(bounds.boundsMax[axis], position[axis]);
+			}
 		}
-		catch (vk::SystemError err)
+
+		SOULKAN_MATHS_NAMESPACE::Vec3 center((bounds.boundsMin[0] + bounds.boundsMax[0]) * 0.5f, (bounds.boundsMin[1] + bounds.boundsMax[1]) * 0.5f, (bounds.boundsMin[2] + bounds.boundsMax[2]) * 0.5f);
+
+		float radius = 0.0f;
+		for (const auto& vertex : mesh.vertices)
 		{
-			result.error = DeviceError::SWAPCHAIN_CREATION_ERROR;
+			radius = std::max(radius, SOULKAN_MATHS_NAMESPACE::length(SOULKAN_MATHS_NAMESPACE::Vec3(vertex.position.x - center.x, vertex.position.y - center.y, vertex.position.z - center.z)));
 		}
 
-		return result;
+		bounds.boundingSphere = { center.x, center.y, center.z, radius };
+		return bounds;
 	}
 
-	/*@brief (The recommended way to create a swapchain)
-	* Creates a vulkan swapchain from a given vulkan device using a given vulkan physicalDevice, surface, present mode, a GLFW window and a vector of allowed queue family indices
+	/*@brief Writes a mesh, its levels of detail and its meshlets into a binary mesh file to be read by readMeshFile().
+	* Indices are narrowed to the index type of the mesh, bounds are computed from the vertices
 	*
-	* @param physicalDevice the vulkan physical device used to query surface capabilities
-	* @param device the vulkan device from which the swapchain is created
-	* @param surface the vulkan surface used to get its capabilities
-	* @param pWindow the GLFW window used to query the swapchain 2D extent
-	* @param presentMode the present mode to be used during swapchain creation
-	* @param surfaceFormat the surface format to be used during swapchain creation
-	* @param extent the 2D extent to be used during swapchain creation
-	* @param allowedQueueIndices a vector of all the allowed queue indices for swapchain creation
+	* @param filename The name of the file to be written
+	* @param mesh The indexed mesh to be written
+	* @param lods The levels of detail, as ranges of mesh.indices (a single level covering every index is written if empty)
+	* @param meshlets The meshlets, as ranges of mesh.indices
 	*
-	* @return SkResult(created swapchain, SwapchainError)
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), FileError)
 	*/
-	inline SkResult<vk::SwapchainKHR, SwapchainError> createVkSwapchain(const vk::PhysicalDevice& physicalDevice, const vk::Device& device, const vk::SurfaceKHR surface, 
-		const GLFWwindow* pWindow, const vk::PresentModeKHR& presentMode, const vk::SurfaceFormatKHR& surfaceFormat, const vk::Extent2D& extent, const std::array<uint32_t, 6>& queueFamilyIndices)
+	inline SkResult<bool, FileError> writeMeshFile(const std::string_view filename, const Mesh& mesh, const std::vector<MeshLod>& lods = {}, const std::vector<Meshlet>& meshlets = {})
 	{
-		SkResult result(static_cast<vk::SwapchainKHR>(vk::SwapchainKHR(nullptr)), static_cast<SwapchainError>(SwapchainError::NO_ERROR));
+		SkResult result(static_cast<bool>(false), static_cast<FileError>(FileError::NO_ERROR));
 
-		vk::SurfaceCapabilitiesKHR surfaceCapabilities = physicalDevice.getSurfaceCapabilitiesKHR(surface);
-		uint32_t swapchainImageCount = surfaceCapabilities.minImageCount + 1;
-		if (surfaceCapabilities.maxImageCount > 0 && swapchainImageCount > surfaceCapabilities.maxImageCount)
+		auto alignSection = [](const uint64_t offset)
 		{
-			swapchainImageCount = surfaceCapabilities.maxImageCount;
+			return (offset + meshFileSectionAlignment - 1) / meshFileSectionAlignment * meshFileSectionAlignment;
+		};
+
+		std::vector<MeshLod> fileLods = lods;
+		if (fileLods.empty())
+		{
+			MeshLod lod;
+			lod.indexCount = static_cast<uint32_t>(mesh.indices.size());
+			fileLods.emplace_back(lod);
 		}
 
-		vk::SwapchainCreateInfoKHR swapchainCreateInfo = vk::SwapchainCreateInfoKHR(vk::SwapchainCreateFlagsKHR(),
-			                                                                        surface,
-			                                                                        swapchainImageCount,
-			                                                                        surfaceFormat.format,
-			                                                                        surfaceFormat.colorSpace,
-			                                                                        extent,
-			                                                                        1,
-			                                                                        vk::ImageUsageFlagBits::eColorAttachment);
+		MeshFileHeader header;
+		header.magic = meshFileMagic;
+		header.version = meshFileVersion;
+		header.vertexStride = sizeof(Vertex);
+		header.indexSize = static_cast<uint32_t>(mesh.getIndexType() == vk::IndexType::eUint16 ? sizeof(uint16_t) : sizeof(uint32_t));
 
-		swapchainCreateInfo.queueFamilyIndexCount = std::move(static_cast<uint32_t>(queueFamilyIndices.size()));
-		swapchainCreateInfo.pQueueFamilyIndices = std::move(queueFamilyIndices.data());
+		header.vertices = { alignSection(sizeof(MeshFileHeader)), mesh.vertices.size() };
+		header.indices = { alignSection(header.vertices.offset + header.vertices.count * header.vertexStride), mesh.indices.size() };
+		header.lods = { alignSection(header.indices.offset + header.indices.count * header.indexSize), fileLods.size() };
+		header.meshlets = { alignSection(header.lods.offset + header.lods.count * sizeof(MeshLod)), meshlets.size() };
+		header.fileSize = header.meshlets.offset + header.meshlets.count * sizeof(Meshlet);
 
-		if (queueFamilyIndices.size() > 1)
+		const MeshBounds bounds = computeMeshBounds(mesh);
+		header.boundsMin = bounds.boundsMin;
+		header.boundsMax = bounds.boundsMax;
+		header.boundingSphere = bounds.boundingSphere;
+
+		/*FILE CONTENT*/
+		std::vector<uint8_t> fileContent(static_cast<size_t>(header.fileSize), 0);
+
+		std::memcpy(fileContent.data(), &header, sizeof(MeshFileHeader));
+		std::memcpy(fileContent.data() + header.vertices.offset, mesh.vertices.data(), mesh.vertices.size() * sizeof(Vertex));
+		if (header.indexSize == sizeof(uint16_t))
 		{
-			swapchainCreateInfo.imageSharingMode = vk::SharingMode::eConcurrent;
+			uint16_t* pIndices = reinterpret_cast<uint16_t*>(fileContent.data() + header.indices.offset);
+			for (size_t i = 0; i < mesh.indices.size(); i++)
+			{
+				pIndices[i] = static_cast<uint16_t>(mesh.indices[i]);
+			}
 		}
-
 		else
 		{
-			swapchainCreateInfo.imageSharingMode = vk::SharingMode::eExclusive;
+			std::memcpy(fileContent.data() + header.indices.offset, mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+		}
+		std::memcpy(fileContent.data() + header.lods.offset, fileLods.data(), fileLods.size() * sizeof(MeshLod));
+		if (!meshlets.empty())
+		{
+			std::memcpy(fileContent.data() + header.meshlets.offset, meshlets.data(), meshlets.size() * sizeof(Meshlet));
 		}
 
-		swapchainCreateInfo.preTransform = surfaceCapabilities.currentTransform;
-		swapchainCreateInfo.compositeAlpha = vk::CompositeAlphaFlagBitsKHR::eOpaque;
-
-		swapchainCreateInfo.presentMode = std::move(presentMode);
-
-		swapchainCreateInfo.clipped = VK_TRUE;
-		swapchainCreateInfo.oldSwapchain = vk::SwapchainKHR(nullptr);
-
-		try
+		std::ofstream meshFile(std::string(filename), std::ios::binary | std::ios::trunc);
+		if (!meshFile.is_open())
 		{
-			result.value = device.createSwapchainKHR(swapchainCreateInfo);
+			result.error = FileError::FILE_OPENING_ERROR;
+			return result;
 		}
-		catch (vk::SystemError err)
+
+		meshFile.write(reinterpret_cast<const char*>(fileContent.data()), static_cast<std::streamsize>(fileContent.size()));
+		if (!meshFile.good())
 		{
-			result.error = SwapchainError::SWAPCHAIN_CREATION_ERROR;
+			result.error = FileError::FILE_WRITING_ERROR;
+			return result;
 		}
 
+		result.value = true;
 		return result;
 	}
 
-	/*@brief Destroys the given swapchain using the given device
+	/*@brief Validates the header and the sections of a mesh file held in memory and returns a view over them, nothing is parsed nor copied
 	*
-	* @param device the vulkan device used to destroy the swapchain
-	* @param swapchain the vulkan swapchain to be destroyed
+	* @param pFileData Pointer to the content of the file (MappedFile::getData()), aligned on at least 8 bytes
+	* @param fileSize The size of the content in bytes
 	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), SwapchainError)
+	* @return SkResult(view over the sections of the file, FileError), CORRUPTED_FILE_ERROR if a section or a level of detail or meshlet range is out of bounds
 	*/
-	inline SkResult<bool, SwapchainError> destroySwapchain(const vk::Device& device, vk::SwapchainKHR& swapchain)
+	inline SkResult<MeshFileView, FileError> readMeshFile(const void* pFileData, const size_t fileSize)
 	{
-		SkResult result(static_cast<bool>(true), static_cast<SwapchainError>(SwapchainError::NO_ERROR));
+		SkResult result(static_cast<MeshFileView>(MeshFileView()), static_cast<FileError>(FileError::NO_ERROR));
 
-		try
+		if (pFileData == nullptr || fileSize < sizeof(MeshFileHeader))
 		{
-			device.destroySwapchainKHR(swapchain);
+			result.error = FileError::CORRUPTED_FILE_ERROR;
+			return result;
 		}
-		catch (vk::SystemError err)
+
+		const MeshFileHeader* pHeader = static_cast<const MeshFileHeader*>(pFileData);
+		if (pHeader->magic != meshFileMagic)
 		{
-			result.value = false;
-			result.error = SwapchainError::SWAPCHAIN_DESTRUCTION_ERROR;
+			result.error = FileError::INVALID_FORMAT_ERROR;
+			return result;
 		}
 
-		return result;
-	}
-
-	/*@brief Returns the swapchain images from a given swapchain by a given device
-	*
-	* @param device the vulkan device used to get the swapchain images
-	* @param swapchain the vulkan swapchain from which the images are returned
-	*
-	* @return SkResult(vector of swapchain images, SwapchainError)
-	*/
-	inline SkResult<std::vector<vk::Image>, SwapchainError> getSwapchainImages(const vk::Device& device, const vk::SwapchainKHR& swapchain)
-	{
-		SkResult result(static_cast<std::vector<vk::Image>>(std::vector<vk::Image>()), static_cast<SwapchainError>(SwapchainError::NO_ERROR));
+		if (pHeader->version != meshFileVersion)
+		{
+			result.error = FileError::UNSUPPORTED_VERSION_ERROR;
+			return result;
+		}
 
-		std::vector<vk::Image> swapchainImages;
-		try
+		bool isValid = (pHeader->fileSize == fileSize && pHeader->vertexStride == sizeof(Vertex) &&
+		                (pHeader->indexSize == sizeof(uint16_t) || pHeader->indexSize == sizeof(uint32_t)));
+
+		const std::array<std::pair<const MeshFileSection*, uint64_t>, 4> sections = { {
+			{ &pHeader->vertices, pHeader->vertexStride },
+			{ &pHeader->indices,  pHeader->indexSize },
+			{ &pHeader->lods,     sizeof(MeshLod) },
+			{ &pHeader->meshlets, sizeof(Meshlet) } } };
+
+		//Sections are ordered, aligned and inside the file (counts are bounded first so that count * size can not overflow)
+		uint64_t sectionsEnd = sizeof(MeshFileHeader);
+		for (const auto& section : sections)
 		{
-			swapchainImages = device.getSwapchainImagesKHR(swapchain);
+			isValid = isValid && (section.first->offset % meshFileSectionAlignment == 0 && section.first->offset >= sectionsEnd && section.first->offset <= fileSize);
+			isValid = isValid && (section.first->count <= (fileSize - std::min<uint64_t>(section.first->offset, fileSize)) / std::max<uint64_t>(section.second, 1));
+
+			sectionsEnd = section.first->offset + section.first->count * section.second;
 		}
-		catch (vk::SystemError err)
+
+		if (!isValid)
 		{
-			result.error = SwapchainError::GET_SWAPCHAIN_IMAGES_ERROR;
+			result.error = FileError::CORRUPTED_FILE_ERROR;
+			return result;
 		}
 
-		result.value = std::move(swapchainImages);
-		return result;
-	}
+		result.value.pHeader = pHeader;
+		result.value.pFileData = static_cast<const uint8_t*>(pFileData);
 
-	/*@brief Creates swapchain image views from given swapchain images using a given vulkan device and a given vulkan surface format
-	*
-	* @param device the vulkan device used to create these image views
-	* @param swapchainImages the vulkan swapchain images from which the image views are created
-	* @param surfaceFormat the vulkan surface format used for created image views
-	*
-	* @return SkResult(vector of created image views, SwapchainError)
-	*/
-	inline SkResult<std::vector<vk::ImageView>, SwapchainError> createSwapchainImageViews(const vk::Device& device, const std::vector<vk::Image>& swapchainImages, const vk::SurfaceFormatKHR& surfaceFormat)
-	{
-		SkResult result(static_cast<std::vector<vk::ImageView>>(std::vector<vk::ImageView>()), static_cast<SwapchainError>(SwapchainError::NO_ERROR));
+		//Levels of detail and meshlets are drawn straight from the file, their ranges must stay inside the index and vertex sections
+		const MeshLod* pLods = result.value.getLods();
+		for (uint64_t i = 0; isValid && i < pHeader->lods.count; i++)
+		{
+			isValid = (static_cast<uint64_t>(pLods[i].firstIndex) + pLods[i].indexCount <= pHeader->indices.count);
+		}
 
-		uint32_t swapchainImageCount = static_cast<uint32_t>(swapchainImages.size());
-		std::vector<vk::ImageView> swapchainImageViews;
-		swapchainImageViews.reserve(swapchainImageCount);
+		const Meshlet* pMeshlets = result.value.getMeshlets();
+		for (uint64_t i = 0; isValid && i < pHeader->meshlets.count; i++)
+		{
+			isValid = (static_cast<uint64_t>(pMeshlets[i].firstIndex) + pMeshlets[i].indexCount <= pHeader->indices.count);
+			isValid = isValid && (pMeshlets[i].vertexOffset >= 0 && static_cast<uint64_t>(pMeshlets[i].vertexOffset) <= pHeader->vertices.count);
+		}
 
-		for (uint32_t i = 0; i < swapchainImageCount; i++)
+		if (!isValid)
 		{
-			vk::ImageViewCreateInfo imageViewCreateInfo = {};
+			result.value = MeshFileView();
+			result.error = FileError::CORRUPTED_FILE_ERROR;
+			return result;
+		}
 
-			imageViewCreateInfo.image = swapchainImages[i];
-			imageViewCreateInfo.viewType = vk::ImageViewType::e2D;
-			imageViewCreateInfo.format = surfaceFormat.format;
+		return result;
+	}
 
-			imageViewCreateInfo.components.r = vk::ComponentSwizzle::eIdentity;
-			imageViewCreateInfo.components.g = vk::ComponentSwizzle::eIdentity;
-			imageViewCreateInfo.components.g = vk::ComponentSwizzle::eIdentity;
+	/*THREAD POOL*/
 
-			imageViewCreateInfo.subresourceRange.aspectMask = vk::ImageAspectFlagBits::eColor;
-			imageViewCreateInfo.subresourceRange.baseMipLevel = 0;
-			imageViewCreateInfo.subresourceRange.levelCount = 1;
-			imageViewCreateInfo.subresourceRange.baseArrayLayer = 0;
-			imageViewCreateInfo.subresourceRange.layerCount = 1;
+	/*Fixed set of worker threads executing queued tasks, used to spread CPU work (asset import...) over every core.
+	* Tasks must not throw, the destructor waits for the queued tasks before joining the workers*/
+	class ThreadPool
+	{
+	public:
+		/*threadCount = 0 creates one worker per hardware thread, minus the calling thread which takes part in parallelFor()*/
+		explicit ThreadPool(uint32_t threadCount = 0)
+		{
+			if (threadCount == 0)
+			{
+				threadCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+			}
 
-			try
+			workers.reserve(threadCount);
+			for (uint32_t i = 0; i < threadCount; i++)
 			{
-				swapchainImageViews.emplace_back(device.createImageView(imageViewCreateInfo));
+				workers.emplace_back([this]() { workerLoop(); });
 			}
-			catch (vk::SystemError err)
+		}
+
+		~ThreadPool()
+		{
 			{
-				result.error = SwapchainError::SWAPCHAIN_IMAGE_VIEW_CREATION_ERROR;
+				std::lock_guard<std::mutex> lock(queueMutex);
+				isStopping = true;
+			}
+
+			queueCondition.notify_all();
+			for (auto& worker : workers)
+			{
+				worker.join();
 			}
 		}
 
-		result.value = std::move(swapchainImageViews);
-		return result;
-	}
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
 
-	/*@brief Destroys a given vector of swapchain image views using a given device
-	*
-	* @param device the vulkan device used to destroy the swapchain image views
-	* @param swapchainImageViews the vulkan swapchain image views to be destroyed
-	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), SwapchainError>
-	*/
-	inline SkResult<bool, SwapchainError> destroySwapchainImageViews(const vk::Device& device, std::vector<vk::ImageView>& swapchainImageViews)
-	{
-		SkResult result(static_cast<bool>(true), static_cast<SwapchainError>(SwapchainError::NO_ERROR));
+		/*Returns the number of worker threads*/
+		inline uint32_t getThreadCount() const
+		{
+			return static_cast<uint32_t>(workers.size());
+		}
 
-		for (uint32_t i = 0; i < swapchainImageViews.size(); i++)
+		/*@brief Queues a task to be executed by one of the worker threads
+		*
+		* @param task The task to be executed
+		*/
+		inline void submit(std::function<void()> task)
 		{
-			try
 			{
-				device.destroyImageView(swapchainImageViews[i]);
+				std::lock_guard<std::mutex> lock(queueMutex);
+				tasks.emplace_back(std::move(task));
 			}
-			catch (vk::SystemError err)
+
+			queueCondition.notify_one();
+		}
+
+		/*@brief Calls function(i) for every i in [0, count) on the worker threads and on the calling thread, returning once every call is done.
+		* Indices are handed out one at a time so that uneven items (meshes of different sizes) stay balanced.
+		* Can be called from a task : the calling thread never waits on work it could do itself
+		*
+		* @param count The number of items
+		* @param function The function called for each item
+		*/
+		inline void parallelFor(const size_t count, const std::function<void(size_t)>& function)
+		{
+			if (count == 0)
 			{
-				result.value = false;
-				result.error = SwapchainError::SWAPCHAIN_IMAGE_VIEW_DESTRUCTION_ERROR;
+				return;
+			}
+
+			struct ParallelForState
+			{
+				std::atomic<size_t> nextIndex{ 0 };
+				size_t doneCount = 0;
+				std::mutex doneMutex;
+				std::condition_variable doneCondition;
+			};
+
+			//Shared with the helpers : a helper started after every item is done finds no index left and only touches the state
+			auto pState = std::make_shared<ParallelForState>();
+			auto runItems = [pState, count, &function]()
+			{
+				size_t index = 0;
+				while ((index = pState->nextIndex.fetch_add(1)) < count)
+				{
+					function(index);
+
+					std::lock_guard<std::mutex> lock(pState->doneMutex);
+					if (++pState->doneCount == count)
+					{
+						pState->doneCondition.notify_all();
+					}
+				}
+			};
+
+			size_t helperCount = std::min(workers.size(), count - 1);
+			for (size_t i = 0; i < helperCount; i++)
+			{
+				submit(runItems);
 			}
+
+			runItems();
+
+			std::unique_lock<std::mutex> lock(pState->doneMutex);
+			pState->doneCondition.wait(lock, [&pState, count]() { return pState->doneCount == count; });
 		}
 
+	private:
+		inline void workerLoop()
+		{
+			while (true)
+			{
+				std::function<void()> task;
+				{
+					std::unique_lock<std::mutex> lock(queueMutex);
+					queueCondition.wait(lock, [this]() { return isStopping || !tasks.empty(); });
 
+					if (tasks.empty())
+					{
+						return;
+					}
 
-		return result;
-	}
+					task = std::move(tasks.front());
+					tasks.pop_front();
+				}
 
-	/*Command Pool*/
+				task();
+			}
+		}
 
-	/*@brief Creates a command pool using a given device from a particular queue family type (see QueueFamilyType enum)
+		std::vector<std::thread> workers;
+		std::deque<std::function<void()>> tasks;
+		std::mutex queueMutex;
+		std::condition_variable queueCondition;
+		bool isStopping = false;
+	};
+
+	/*ASSET IMPORT*/
+
+	/*Mesh imported from an asset file*/
+	struct ImportedMesh
+	{
+		std::string name;
+		Mesh mesh;
+		MeshBounds bounds;
+	};
+
+	/*@brief FNV-1a hash of a block of memory, chained by passing the previous hash as seed
 	*
-	* @param device The vulkan device used to create the command pool
-	* @param queueFamilyIndexes the queue family indexes from which a particular queue family will be used in the command pool
-	* @param queueFamilyType the specific type of queue family to be used in the command pool creation
+	* @param pData Pointer to the data to be hashed
+	* @param size The size of the data in bytes
+	* @param seed The hash to start from (FNV offset basis by default)
 	*
-	* @return SkResult(created command pool, CommandPoolError)
+	* @return The 64 bits hash of the data
 	*/
-	inline SkResult<vk::CommandPool, CommandPoolError> createCommandPool(const vk::Device& device, const std::array<uint32_t, 6>& queueFamilyIndexes, QueueFamilyType queueFamilyType)
+	inline uint64_t hashBytes(const void* pData, const size_t size, const uint64_t seed = 14695981039346656037ull) noexcept
 	{
-		SkResult result(static_cast<vk::CommandPool>(vk::CommandPool(nullptr)), static_cast<CommandPoolError>(CommandPoolError::NO_ERROR));
-
-		vk::CommandPoolCreateInfo commandPoolCreateInfo = {};
-		commandPoolCreateInfo.flags = vk::CommandPoolCreateFlagBits::eResetCommandBuffer;
+		const uint8_t* pBytes = static_cast<const uint8_t*>(pData);
 
-		if (queueFamilyIndexes[static_cast<uint32_t>(queueFamilyType)] != std::numeric_limits<uint32_t>::max())
+		uint64_t hash = seed;
+		for (size_t i = 0; i < size; i++)
 		{
-			commandPoolCreateInfo.queueFamilyIndex = queueFamilyIndexes[static_cast<uint32_t>(queueFamilyType)];
+			hash ^= pBytes[i];
+			hash *= 1099511628211ull;
 		}
-		else
+
+		return hash;
+	}
+
+	/*Hasher of the word keys identifying cached vulkan objects (layouts, pipelines), keys being compared word by word on collision*/
+	struct WordKeyHash
+	{
+		inline size_t operator()(const std::vector<uint32_t>& key) const noexcept
 		{
-			result.error = CommandPoolError::WRONG_QUEUE_INDEX;
+			return static_cast<size_t>(hashBytes(key.data(), key.size() * sizeof(uint32_t)));
 		}
+	};
 
-		try
+	/*@brief Computes smooth vertex normals of a range of an indexed mesh, each triangle weighting the normals of its vertices by its area
+	*
+	* @param mesh The mesh whose normals are computed
+	* @param firstVertex The first vertex whose normal is computed, the following ones being computed as well
+	* @param firstIndex The first index of the triangles used, every index from there on referencing vertices >= firstVertex
+	*/
+	inline void computeVertexNormals(Mesh& mesh, const size_t firstVertex = 0, const size_t firstIndex = 0)
+	{
+		std::vector<SOULKAN_MATHS_NAMESPACE::Vec3> normals(mesh.vertices.size() - firstVertex, SOULKAN_MATHS_NAMESPACE::Vec3(0.0f, 0.0f, 0.0f));
+
+		for (size_t i = firstIndex; i + 2 < mesh.indices.size(); i += 3)
 		{
-			result.value = device.createCommandPool(commandPoolCreateInfo);
+			const SOULKAN_MATHS_NAMESPACE::Vec3& p0 = mesh.vertices[mesh.indices[i]].position;
+			const SOULKAN_MATHS_NAMESPACE::Vec3& p1 = mesh.vertices[mesh.indices[i + 1]].position;
+			const SOULKAN_MATHS_NAMESPACE::Vec3& p2 = mesh.vertices[mesh.indices[i + 2]].position;
+
+			//Not normalized : its length is twice the area of the triangle
+			SOULKAN_MATHS_NAMESPACE::Vec3 faceNormal = SOULKAN_MATHS_NAMESPACE::cross(SOULKAN_MATHS_NAMESPACE::Vec3(p1.x - p0.x, p1.y - p0.y, p1.z - p0.z),
+			                                                                      SOULKAN_MATHS_NAMESPACE::Vec3(p2.x - p0.x, p2.y - p0.y, p2.z - p0.z));
+
+			for (size_t corner = 0; corner < 3; corner++)
+			{
+				SOULKAN_MATHS_NAMESPACE::Vec3& normal = normals[mesh.indices[i + corner] - firstVertex];
+				normal = SOULKAN_MATHS_NAMESPACE::Vec3(normal.x + faceNormal.x, normal.y + faceNormal.y, normal.z + faceNormal.z);
+			}
 		}
-		catch (vk::SystemError err)
+
+		for (size_t i = 0; i < normals.size(); i++)
 		{
-			result.error = CommandPoolError::COMMAND_POOL_CREATION_ERROR;
-		}
+			const SOULKAN_MATHS_NAMESPACE::Vec3& normal = normals[i];
+			float normalLength = SOULKAN_MATHS_NAMESPACE::length(normal);
 
-		return result;
+			mesh.vertices[firstVertex + i].normal = (normalLength > 0.0f ? SOULKAN_MATHS_NAMESPACE::Vec3(normal.x / normalLength, normal.y / normalLength, normal.z / normalLength)
+			                                                             : SOULKAN_MATHS_NAMESPACE::Vec3(0.0f, 0.0f, 1.0f));
+		}
 	}
 
-	/*@brief Creates a vector of command pools using a given device from a given vector of queueFamilyIndexes (following the QueueFamilyType ordering, see QueueFamilyType)
-	*
-	* @param device The vulkan device used to create the vector of command pools
-	* @param queueFamilyIndexes the queue family indexes from which the command pools will be created
-	*
-	* @return SkResult(vector of created command pools, CommandPoolError)
-	*/
-	inline SkResult<std::vector<vk::CommandPool>, CommandPoolError> createCommandPools(const vk::Device& device, const std::array<uint32_t, 6>& queueFamilyIndexes)
-	{
-		SkResult result(static_cast<std::vector<vk::CommandPool>>(std::vector<vk::CommandPool>()), static_cast<CommandPoolError>(CommandPoolError::NO_ERROR));
+	/*OBJ*/
 
-		std::vector<vk::CommandPool> commandPools;
-		commandPools.reserve(queueFamilyIndexes.size());
+	/*Object or group of an OBJ file : the text range of its lines and the number of positions and normals declared before it*/
+	struct ObjObject
+	{
+		std::string name;
+		size_t begin = 0;
+		size_t end = 0;
+		size_t positionCount = 0;
+		size_t normalCount = 0;
+		size_t faceCount = 0;
+	};
 
-		//Implying use of the QueueFamilyType ordering, see QueueFamilyType
-		for (int i = 0; i < queueFamilyIndexes.size(); i++)
+	/*@brief Returns the next line of a text, without its line ending, and moves the position to the start of the following line*/
+	inline std::string_view readLine(const std::string_view text, size_t& position) noexcept
+	{
+		size_t lineEnd = text.find('\n', position);
+		if (lineEnd == std::string_view::npos)
 		{
-			auto createCommandPoolResult = createCommandPool(device, queueFamilyIndexes, static_cast<QueueFamilyType>(i));
-			result.error = affectError(createCommandPoolResult, result.error);
-			vk::CommandPool commandPool = retLog(createCommandPoolResult);
+			lineEnd = text.size();
+		}
 
-			commandPools.emplace_back(commandPool);
+		std::string_view line = text.substr(position, lineEnd - position);
+		position = std::min(lineEnd + 1, text.size());
+
+		if (!line.empty() && line.back() == '\r')
+		{
+			line.remove_suffix(1);
 		}
 
-		result.value = commandPools;
-		return result;
+		return line;
 	}
 
-	/*@brief Destroys the given vulkan command pool using the given vulkan device
-	*
-	* @param device the vulkan device used to destroy the command pool
-	* @param commandPool the vulkan command pool to be destroyed
-	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), CommandPoolError)
-	*/
-	inline SkResult<bool, CommandPoolError> destroyCommandPool(const vk::Device& device, vk::CommandPool& commandPool)
+	/*@brief Returns the next whitespace separated token of a line and removes it from the line*/
+	inline std::string_view readToken(std::string_view& line) noexcept
 	{
-		SkResult result(static_cast<bool>(true), static_cast<CommandPoolError>(CommandPoolError::NO_ERROR));
-
-		try
+		size_t tokenBegin = line.find_first_not_of(" \t");
+		if (tokenBegin == std::string_view::npos)
 		{
-			device.destroyCommandPool(commandPool);
+			line = {};
+			return {};
 		}
-		catch (vk::SystemError err)
+
+		size_t tokenEnd = std::min(line.find_first_of(" \t", tokenBegin), line.size());
+
+		std::string_view token = line.substr(tokenBegin, tokenEnd - tokenBegin);
+		line.remove_prefix(tokenEnd);
+		return token;
+	}
+
+	/*@brief Parses a float (with an optional leading '+'), returns false if the text is not a number*/
+	inline bool parseFloat(std::string_view text, float& value) noexcept
+	{
+		if (!text.empty() && text.front() == '+')
 		{
-			result.value = false;
-			result.error = CommandPoolError::COMMAND_POOL_DESTRUCTION_ERROR;
+			text.remove_prefix(1);
 		}
 
-		return result;
+		auto parseResult = std::from_chars(text.data(), text.data() + text.size(), value);
+		return (parseResult.ec == std::errc() && parseResult.ptr == text.data() + text.size());
 	}
 
-	/*@brief Destroys the given vulkan command pools using the given vulkan device
-	*
-	* @param device the vulkan device used to destroy the command pools
-	* @param commandPools the vulkan command pools to be destroyed
-	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), CommandPoolError)
-	*/
-	inline SkResult<bool, CommandPoolError> destroyCommandPools(const vk::Device& device, std::vector<vk::CommandPool>& commandPools)
+	/*@brief Resolves a 1 based (or negative, relative to the last declared element) OBJ index into a 0 based index*/
+	inline bool resolveObjIndex(const std::string_view text, const size_t declaredCount, size_t& index) noexcept
 	{
-		SkResult result(static_cast<bool>(true), static_cast<CommandPoolError>(CommandPoolError::NO_ERROR));
-
-		for (auto& commandPool : commandPools)
+		int64_t objIndex = 0;
+		auto parseResult = std::from_chars(text.data(), text.data() + text.size(), objIndex);
+		if (parseResult.ec != std::errc() || parseResult.ptr != text.data() + text.size() || objIndex == 0)
 		{
-			auto destroyResult = destroyCommandPool(device, commandPool);
-			result.error = affectError(destroyResult, result.error);
+			return false;
 		}
 
-		if (error(result))
+		int64_t resolvedIndex = (objIndex > 0 ? objIndex - 1 : static_cast<int64_t>(declaredCount) + objIndex);
+		if (resolvedIndex < 0)
 		{
-			result.value = true;
+			return false;
 		}
 
-		return result;
+		index = static_cast<size_t>(resolvedIndex);
+		return true;
 	}
 
-	/*COMMAND BUFFER*/
-
-	/*@brief Allocates a single vulkan command buffer given a vulkan command pool
+	/*@brief Builds the welded mesh of an object of an OBJ file from its faces, polygons being triangulated as fans
 	*
-	* @param device The vulkan device allocating the command buffer
-	* @param commandPool The vulkan command pool used for allocating the command buffer
+	* @param text The whole OBJ file
+	* @param object The object to be built
+	* @param positions The positions of the whole file
+	* @param colors The vertex colors of the whole file (one per position)
+	* @param normals The normals of the whole file
 	*
-	* @return SkResult(vulkan command buffer, CommandBufferError)
+	* @return SkResult(imported mesh, ImportError)
 	*/
-	inline SkResult<vk::CommandBuffer, CommandBufferError> allocateCommandBuffer(const vk::Device& device, const vk::CommandPool& commandPool)
+	inline SkResult<ImportedMesh, ImportError> importObjObject(const std::string_view text, const ObjObject& object, const std::vector<SOULKAN_MATHS_NAMESPACE::Vec3>& positions,
+		const std::vector<SOULKAN_MATHS_NAMESPACE::Vec3>& colors, const std::vector<SOULKAN_MATHS_NAMESPACE::Vec3>& normals)
 	{
-		SkResult result(static_cast<vk::CommandBuffer>(vk::CommandBuffer(nullptr)), static_cast<CommandBufferError>(CommandBufferError::NO_ERROR));
+		SkResult result(static_cast<ImportedMesh>(ImportedMesh()), static_cast<ImportError>(ImportError::NO_ERROR));
 
-		vk::CommandBufferAllocateInfo commandBufferAllocateInfo = {};
-		commandBufferAllocateInfo.commandPool = commandPool;
-		commandBufferAllocateInfo.commandBufferCount = 1;
-		commandBufferAllocateInfo.level = vk::CommandBufferLevel::ePrimary;
+		Mesh triangleMesh;
+		triangleMesh.vertices.reserve(object.faceCount * 3);
 
-		try
-		{
-			result.value = device.allocateCommandBuffers(commandBufferAllocateInfo)[0];
-		}
-		catch (vk::SystemError err)
+		//Relative indices refer to the elements declared before the face, not to the whole file
+		size_t positionCount = object.positionCount;
+		size_t normalCount = object.normalCount;
+		bool hasNormals = false;
+
+		std::vector<Vertex> polygon;
+		size_t position = object.begin;
+		while (position < object.end)
 		{
-			result.error = CommandBufferError::COMMAND_BUFFER_ALLOCATION_ERROR;
-		}
+			std::string_view line = readLine(text.substr(0, object.end), position);
+			std::string_view keyword = readToken(line);
 
-		return result;
-	}
+			if (keyword == "v")
+			{
+				positionCount++;
+			}
+			else if (keyword == "vn")
+			{
+				normalCount++;
+			}
+			else if (keyword == "f")
+			{
+				polygon.clear();
 
-	/*@brief Allocates a number of vulkan command buffer given a vulkan command pool
-	*
-	* @param device The vulkan device allocating the command buffer
-	* @param commandPool The vulkan command pool used for allocating the command buffers
-	* @param commandBufferCount The number of vulkan command buffers to be allocated
-	*
-	* @return SkResult(vector of vulkan command buffers, CommandBufferError)
-	*/
-	inline SkResult<std::vector<vk::CommandBuffer>, CommandBufferError> allocateCommandBuffers(const vk::Device& device, const vk::CommandPool& commandPool, const uint32_t commandBufferCount)
-	{
-		SkResult result(static_cast<std::vector<vk::CommandBuffer>>(std::vector<vk::CommandBuffer>()), static_cast<CommandBufferError>(CommandBufferError::NO_ERROR));
+				for (std::string_view corner = readToken(line); !corner.empty(); corner = readToken(line))
+				{
+					//v, v/vt, v//vn or v/vt/vn, texture coordinates are not part of Vertex
+					size_t firstSlash = corner.find('/');
+					size_t secondSlash = (firstSlash == std::string_view::npos ? std::string_view::npos : corner.find('/', firstSlash + 1));
 
-		vk::CommandBufferAllocateInfo commandBufferAllocateInfo = {};
-		commandBufferAllocateInfo.commandPool = commandPool;
-		commandBufferAllocateInfo.commandBufferCount = commandBufferCount;
-		commandBufferAllocateInfo.level = vk::CommandBufferLevel::ePrimary;
+					size_t positionIndex = 0;
+					if (!resolveObjIndex(corner.substr(0, firstSlash), positionCount, positionIndex))
+					{
+						result.error = ImportError::PARSING_ERROR;
+						return result;
+					}
 
-		try
+					if (positionIndex >= positions.size())
+					{
+						result.error = ImportError::INDEX_OUT_OF_RANGE_ERROR;
+						return result;
+					}
+
+					Vertex vertex(positions[positionIndex], SOULKAN_MATHS_NAMESPACE::Vec3(0.0f, 0.0f, 0.0f), colors[positionIndex]);
+
+					if (secondSlash != std::string_view::npos)
+					{
+						size_t normalIndex = 0;
+						if (!resolveObjIndex(corner.substr(secondSlash + 1), normalCount, normalIndex))
+						{
+							result.error = ImportError::PARSING_ERROR;
+							return result;
+						}
+
+						if (normalIndex >= normals.size())
+						{
+							result.error = ImportError::INDEX_OUT_OF_RANGE_ERROR;
+							return result;
+						}
+
+						vertex.normal = normals[normalIndex];
+						hasNormals = true;
+					}
+
+					polygon.emplace_back(vertex);
+				}
+
+				for (size_t i = 2; i < polygon.size(); i++)
+				{
+					triangleMesh.vertices.emplace_back(polygon[0]);
+					triangleMesh.vertices.emplace_back(polygon[i - 1]);
+					triangleMesh.vertices.emplace_back(polygon[i]);
+				}
+			}
+		}
+
+		auto weldVerticesResult = weldVertices(triangleMesh);
+		if (error(weldVerticesResult))
 		{
-			result.value = device.allocateCommandBuffers(commandBufferAllocateInfo);
+			result.error = ImportError::INDEX_OUT_OF_RANGE_ERROR;
+			return result;
 		}
-		catch (vk::SystemError err)
+
+		result.value.name = object.name;
+		result.value.mesh = std::move(weldVerticesResult.value);
+
+		//Without normals, vertices were welded by position and color : the computed normals come out smooth
+		if (!hasNormals)
 		{
-			result.error = CommandBufferError::COMMAND_BUFFER_ALLOCATION_ERROR;
+			computeVertexNormals(result.value.mesh);
 		}
 
+		result.value.bounds = computeMeshBounds(result.value.mesh);
 		return result;
 	}
 
-	/*@brief "Begins" a given vulkan command buffer
+	/*@brief Imports every object (o) and group (g) of a Wavefront OBJ file held in memory as a welded indexed mesh.
+	* Positions, normals and vertex colors (v x y z r g b) are read in a first pass, the faces of the objects are then built in parallel.
+	* Materials and texture coordinates are ignored, missing normals are computed
 	*
-	* @param commandBuffer The vulkan command buffer to be "beginned"
+	* @param pData Pointer to the content of the file (MappedFile::getData())
+	* @param size The size of the content in bytes
+	* @param threadPool The thread pool building the objects
 	*
-	* @return SkResult(bool, CommandBufferError)
+	* @return SkResult(imported meshes, one per object holding faces, ImportError)
 	*/
-	inline SkResult<bool, CommandBufferError> beginCommandBuffer(const vk::CommandBuffer& commandBuffer)
+	inline SkResult<std::vector<ImportedMesh>, ImportError> importObj(const void* pData, const size_t size, ThreadPool& threadPool)
 	{
-		SkResult result(static_cast<bool>(true), static_cast<CommandBufferError>(CommandBufferError::NO_ERROR));
+		SkResult result(static_cast<std::vector<ImportedMesh>>(std::vector<ImportedMesh>()), static_cast<ImportError>(ImportError::NO_ERROR));
 
-		vk::CommandBufferBeginInfo commandBufferBeginInfo = {};
-		commandBufferBeginInfo.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
+		const std::string_view text(static_cast<const char*>(pData), size);
 
-		try
-		{
-			commandBuffer.begin(commandBufferBeginInfo);
-		}
-		catch (vk::SystemError err)
+		std::vector<SOULKAN_MATHS_NAMESPACE::Vec3> positions;
+		std::vector<SOULKAN_MATHS_NAMESPACE::Vec3> colors;
+		std::vector<SOULKAN_MATHS_NAMESPACE::Vec3> normals;
+
+		std::vector<ObjObject> objects(1);
+		objects.back().name = "default";
+
+		/*DECLARATIONS*/
+		size_t position = 0;
+		while (position < text.size())
 		{
-			result.value = false;
-			result.error = CommandBufferError::COMMAND_BUFFER_BEGIN_ERROR;
+			size_t lineBegin = position;
+			std::string_view line = readLine(text, position);
+			std::string_view keyword = readToken(line);
+
+			if (keyword == "v" || keyword == "vn")
+			{
+				std::array<float, 6> values = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+
+				size_t valueCount = 0;
+				for (std::string_view token = readToken(line); !token.empty() && valueCount < values.size(); token = readToken(line))
+				{
+					if (!parseFloat(token, values[valueCount++]))
+					{
+						result.error = ImportError::PARSING_ERROR;
+						return result;
+					}
+				}
+
+				if (valueCount < 3)
+				{
+					result.error = ImportError::PARSING_ERROR;
+					return result;
+				}
+
+				if (keyword == "vn")
+				{
+					normals.emplace_back(values[0], values[1], values[2]);
+				}
+				else
+				{
+					//A 4th value alone is the optional w of the position, not a color
+					positions.emplace_back(values[0], values[1], values[2]);
+					colors.emplace_back((valueCount >= 6 ? SOULKAN_MATHS_NAMESPACE::Vec3(values[3], values[4], values[5]) : SOULKAN_MATHS_NAMESPACE::Vec3(1.0f, 1.0f, 1.0f)));
+				}
+			}
+			else if (keyword == "f")
+			{
+				objects.back().faceCount++;
+			}
+			else if (keyword == "o" || keyword == "g")
+			{
+				objects.back().end = lineBegin;
+
+				ObjObject object;
+				object.name = std::string(readToken(line));
+				object.begin = position;
+				object.positionCount = positions.size();
+				object.normalCount = normals.size();
+				objects.emplace_back(object);
+			}
 		}
 
-		return result;
-	}
+		objects.back().end = text.size();
 
-	/*@brief "Ends" a given vulkan command buffer
-	*
-	* @param commandBuffer The vulkan command buffer to be "Ended"
-	*
-	* @return SkResult(bool, CommandBufferError)
-	*/
-	inline SkResult<bool, CommandBufferError> endCommandBuffer(const vk::CommandBuffer& commandBuffer)
-	{
-		SkResult result(static_cast<bool>(true), static_cast<CommandBufferError>(CommandBufferError::NO_ERROR));
+		objects.erase(std::remove_if(objects.begin(), objects.end(), [](const ObjObject& object) { return object.faceCount == 0; }), objects.end());
 
-		try
+		/*FACES*/
+		std::vector<ImportedMesh> meshes(objects.size());
+		std::vector<ImportError> errors(objects.size(), ImportError::NO_ERROR);
+
+		threadPool.parallelFor(objects.size(), [&](const size_t objectIndex)
 		{
-			commandBuffer.end();
-		}
-		catch (vk::SystemError err)
+			auto importObjObjectResult = importObjObject(text, objects[objectIndex], positions, colors, normals);
+
+			errors[objectIndex] = importObjObjectResult.error;
+			meshes[objectIndex] = std::move(importObjObjectResult.value);
+		});
+
+		for (const ImportError objectError : errors)
 		{
-			result.value = true;
-			result.error = CommandBufferError::COMMAND_BUFFER_END_ERROR;
+			if (objectError != ImportError::NO_ERROR)
+			{
+				result.error = objectError;
+				return result;
+			}
 		}
 
+		result.value = std::move(meshes);
 		return result;
 	}
 
-	/*RENDER PASS*/
+	/*JSON*/
 
-	/*@brief Creates an attachment description from a given vulkan surfaceFormat, initial image layout (default is undefined), final image layout (default is present src)
-	*
-	* @param surfaceFormat the surface format used for the attachment description
-	* @param initialImageLayout Initial image layout of incoming images
-	* @param finalImageLayout Final image layout of outgoing images
-	*
-	* @return SkResult(created attachment description, RenderPassError)
-	*/
-	inline SkResult<vk::AttachmentDescription, RenderPassError> createAttachmentDescription(const vk::SurfaceFormatKHR& surfaceFormat, const vk::ImageLayout initialImageLayout = vk::ImageLayout::eUndefined, const vk::ImageLayout finalImageLayout = vk::ImageLayout::ePresentSrcKHR) noexcept
+	/*Value of a JSON document, objects keep their members in order (keys[i] names elements[i])*/
+	struct JsonValue
 	{
-		SkResult result(static_cast<vk::AttachmentDescription>(vk::AttachmentDescription{}), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+		enum class Type
+		{
+			eNull,
+			eBoolean,
+			eNumber,
+			eString,
+			eArray,
+			eObject
+		};
+
+		Type type = Type::eNull;
+		bool boolean = false;
+		double number = 0.0;
+		std::string string;
+		std::vector<std::string> keys;
+		std::vector<JsonValue> elements;
+
+		/*Returns the member of an object named key, nullptr if there is none*/
+		const JsonValue* find(const std::string_view key) const
+		{
+			for (size_t i = 0; i < keys.size(); i++)
+			{
+				if (keys[i] == key)
+				{
+					return &elements[i];
+				}
+			}
 
-		vk::AttachmentDescription colorAttachment = {};
+			return nullptr;
+		}
 
-		colorAttachment.format = surfaceFormat.format;
-		colorAttachment.samples = vk::SampleCountFlagBits::e1;
-		colorAttachment.loadOp = vk::AttachmentLoadOp::eClear;
-		colorAttachment.storeOp = vk::AttachmentStoreOp::eStore;
+		/*Returns the number member of an object named key, defaultValue if there is none*/
+		double getNumber(const std::string_view key, const double defaultValue) const
+		{
+			const JsonValue* pMember = find(key);
+			return (pMember != nullptr && pMember->type == Type::eNumber ? pMember->number : defaultValue);
+		}
 
-		colorAttachment.stencilLoadOp = vk::AttachmentLoadOp::eDontCare;
-		colorAttachment.stencilStoreOp = vk::AttachmentStoreOp::eDontCare;
+		/*Returns the value of a number used as index or size, SIZE_MAX if it is not a positive integer that fits in a size_t*/
+		size_t toSize() const
+		{
+			bool isSize = (type == Type::eNumber && number >= 0.0 && number < 9007199254740992.0 && std::floor(number) == number);
+			return (isSize ? static_cast<size_t>(number) : std::numeric_limits<size_t>::max());
+		}
 
-		colorAttachment.initialLayout = initialImageLayout;
-		colorAttachment.finalLayout = finalImageLayout;
+		/*Returns the index or size member of an object named key (see toSize()), defaultValue if there is none*/
+		size_t getSize(const std::string_view key, const size_t defaultValue) const
+		{
+			const JsonValue* pMember = find(key);
+			return (pMember != nullptr ? pMember->toSize() : defaultValue);
+		}
 
-		result.value = std::move(colorAttachment);
-		return result;
-	}
+		/*Returns the string member of an object named key, defaultValue if there is none*/
+		std::string getString(const std::string_view key, const std::string& defaultValue = {}) const
+		{
+			const JsonValue* pMember = find(key);
+			return (pMember != nullptr && pMember->type == Type::eString ? pMember->string : defaultValue);
+		}
+	};
 
-	/*@brief Creates an attachment reference from a given attachmentIndex (default is 0) and a given vulkan image layout (default is color attachment optimal)
-	*
-	* @param attachmentIndex the index corresponding to the attachment description at this index
-	* @param imageLayout the image layout of the attachment reference
-	*
-	* @return SkResult(created attachment reference, RenderPassError)
-	*/
-	inline SkResult<vk::AttachmentReference, RenderPassError> createAttachmentReference(const uint32_t attachmentIndex = 0, const vk::ImageLayout imageLayout = vk::ImageLayout::eColorAttachmentOptimal) noexcept
+	/*@brief Appends a unicode code point to a string, encoded as UTF-8*/
+	inline void appendUtf8(std::string& string, const uint32_t codePoint)
 	{
-		SkResult result(static_cast<vk::AttachmentReference>(vk::AttachmentReference()), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+		if (codePoint < 0x80)
+		{
+			string += static_cast<char>(codePoint);
+		}
+		else if (codePoint < 0x800)
+		{
+			string += static_cast<char>(0xC0 | (codePoint >> 6));
+			string += static_cast<char>(0x80 | (codePoint & 0x3F));
+		}
+		else if (codePoint < 0x10000)
+		{
+			string += static_cast<char>(0xE0 | (codePoint >> 12));
+			string += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+			string += static_cast<char>(0x80 | (codePoint & 0x3F));
+		}
+		else
+		{
+			string += static_cast<char>(0xF0 | (codePoint >> 18));
+			string += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+			string += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+			string += static_cast<char>(0x80 | (codePoint & 0x3F));
+		}
+	}
 
-		vk::AttachmentReference colorAttachmentReference = {};
+	/*@brief Parses the JSON value starting at a given position of a text (recursive descent), returns false on malformed input*/
+	inline bool parseJsonValue(const std::string_view text, size_t& position, JsonValue& value, const uint32_t depth)
+	{
+		auto skipWhitespace = [&text, &position]()
+		{
+			while (position < text.size() && (text[position] == ' ' || text[position] == '\t' || text[position] == '\n' || text[position] == '\r'))
+			{
+				position++;
+			}
+		};
 
-		colorAttachmentReference.attachment = attachmentIndex;
-		colorAttachmentReference.layout = imageLayout;
+		auto parseString = [&text, &position](std::string& string)
+		{
+			//Opening quote already checked
+			position++;
+			while (position < text.size() && text[position] != '"')
+			{
+				char character = text[position++];
+				if (character != '\\')
+				{
+					string += character;
+					continue;
+				}
 
-		result.value = std::move(colorAttachmentReference);
-		return result;
-	}
+				if (position >= text.size())
+				{
+					return false;
+				}
 
-	/*@brief Creates a subpass description from given vulkan attachment references, pipeline bind point (default is graphics) and color attachment count (default is 1)
-	*
-	* @param colorAttachments Vector of attachment references
-	* @param pipelineBindPoint a specific pipeline bind point used in the subpass description creation
-	*
-	* @return SkResult(created subpass description, RenderPassError)
-	*/
-	inline SkResult<vk::SubpassDescription, RenderPassError> createSubpassDescription(std::vector<vk::AttachmentReference>& colorAttachments, const vk::PipelineBindPoint pipelineBindPoint = vk::PipelineBindPoint::eGraphics) noexcept
-	{
-		SkResult result(static_cast<vk::SubpassDescription>(vk::SubpassDescription()), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+				char escaped = text[position++];
+				switch (escaped)
+				{
+				case '"':  string += '"';  break;
+				case '\\': string += '\\'; break;
+				case '/':  string += '/';  break;
+				case 'b':  string += '\b'; break;
+				case 'f':  string += '\f'; break;
+				case 'n':  string += '\n'; break;
+				case 'r':  string += '\r'; break;
+				case 't':  string += '\t'; break;
+				case 'u':
+				{
+					auto parseHex = [&text, &position](uint32_t& codeUnit)
+					{
+						if (position + 4 > text.size())
+						{
+							return false;
+						}
+
+						auto parseResult = std::from_chars(text.data() + position, text.data() + position + 4, codeUnit, 16);
+						position += 4;
+						return (parseResult.ec == std::errc() && parseResult.ptr == text.data() + position);
+					};
+
+					uint32_t codePoint = 0;
+					if (!parseHex(codePoint))
+					{
+						return false;
+					}
 
-		vk::SubpassDescription subpassDescription = {};
+					//Surrogate pair
+					if (codePoint >= 0xD800 && codePoint < 0xDC00 && position + 2 <= text.size() && text[position] == '\\' && text[position + 1] == 'u')
+					{
+						position += 2;
 
-		subpassDescription.pipelineBindPoint = pipelineBindPoint;
-		subpassDescription.colorAttachmentCount = static_cast<uint32_t>(colorAttachments.size());
-		subpassDescription.pColorAttachments = colorAttachments.data();
+						uint32_t lowSurrogate = 0;
+						if (!parseHex(lowSurrogate) || lowSurrogate < 0xDC00 || lowSurrogate >= 0xE000)
+						{
+							return false;
+						}
 
-		result.value = std::move(subpassDescription);
-		return result;
-	}
+						codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+					}
 
-	/*@brief Creates a render pass from a device with a given array of vulkan attachment descriptions, subpass descriptions and count of attachment descriptions and subpasses
-	*
-	* @param device the vulkan device used to create the render pass
-	* @param attachmentDescriptions Vector of vulkan attachment descriptions used in the render pass
-	* @param subpassDescriptions Vector of subpass descriptions used in the render pass
-	*
-	* @return SkResult(created vulkan renderPass, RenderPassError)
-	*/
-	inline SkResult<vk::RenderPass, RenderPassError> createRenderPass(const vk::Device& device, const std::vector<vk::AttachmentDescription>& attachmentDescriptions, const std::vector<vk::SubpassDescription>& subpassDescriptions)
-	{
-		SkResult result(static_cast<vk::RenderPass>(vk::RenderPass(nullptr)), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+					appendUtf8(string, codePoint);
+					break;
+				}
+				default: return false;
+				}
+			}
 
-		vk::RenderPassCreateInfo renderPassCreateInfo = {};
-		renderPassCreateInfo.attachmentCount = static_cast<uint32_t>(attachmentDescriptions.size());
-		renderPassCreateInfo.pAttachments = attachmentDescriptions.data();
+			if (position >= text.size())
+			{
+				return false;
+			}
 
-		renderPassCreateInfo.subpassCount = static_cast<uint32_t>(subpassDescriptions.size());
-		renderPassCreateInfo.pSubpasses = subpassDescriptions.data();
+			position++;
+			return true;
+		};
 
-		try
+		//Keeps malicious files from overflowing the stack
+		if (depth > 128)
 		{
-			result.value = device.createRenderPass(renderPassCreateInfo);
+			return false;
 		}
-		catch (vk::SystemError err)
+
+		skipWhitespace();
+		if (position >= text.size())
 		{
-			result.error = RenderPassError::RENDER_PASS_CREATION_ERROR;
+			return false;
 		}
 
-		return result;
-	}
-
-	/*@brief Creates a basic vulkan render pass with default parameters
-	*
-	* @param device The vulkan device used to create the basic vulkan renderpass
-	* @param surfaceFormat The vulkan surface format to be used in the creation of the basic vulkan render pass
-	*
-	* @return SkResult(created vulkan render pass, RenderPassError)
-	*/
-	inline SkResult<vk::RenderPass, RenderPassError> createBasicRenderPass(const vk::Device& device, const vk::SurfaceFormatKHR& surfaceFormat)
-	{
-		SkResult result(static_cast<vk::RenderPass>(vk::RenderPass(nullptr)), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+		char character = text[position];
+		if (character == '{' || character == '[')
+		{
+			bool isObject = (character == '{');
+			char closingCharacter = (isObject ? '}' : ']');
 
-		auto createAttachmentDescriptionResult = createAttachmentDescription(surfaceFormat);
-		result.error = affectError(createAttachmentDescriptionResult, result.error);
-		vk::AttachmentDescription attachmentDescription = retLog(createAttachmentDescriptionResult);
-		std::vector<vk::AttachmentDescription> attachmentDescriptions = { std::move(attachmentDescription) };
+			value.type = (isObject ? JsonValue::Type::eObject : JsonValue::Type::eArray);
+			position++;
 
-		auto  createAttachmentReferenceResult = createAttachmentReference();
-		result.error = affectError(createAttachmentReferenceResult, result.error);
-		vk::AttachmentReference attachmentReference = retLog(createAttachmentReferenceResult);
-		std::vector<vk::AttachmentReference> attachmentReferences = { std::move(attachmentReference) };
+			skipWhitespace();
+			if (position < text.size() && text[position] == closingCharacter)
+			{
+				position++;
+				return true;
+			}
 
-		auto createSubpassDescriptionResult = createSubpassDescription(attachmentReferences);
-		result.error = affectError(createSubpassDescriptionResult, result.error);
-		vk::SubpassDescription subpassDescription = retLog(createSubpassDescriptionResult);
-		std::vector<vk::SubpassDescription> subpassDescriptions = { std::move(subpassDescription) };
+			while (true)
+			{
+				if (isObject)
+				{
+					skipWhitespace();
+					if (position >= text.size() || text[position] != '"')
+					{
+						return false;
+					}
 
-		auto createRenderPassResult = createRenderPass(device, attachmentDescriptions, subpassDescriptions);
-		result.error = affectError(createRenderPassResult, result.error);
-		vk::RenderPass renderPass = retLog(createRenderPassResult);
+					value.keys.emplace_back();
+					if (!parseString(value.keys.back()))
+					{
+						return false;
+					}
 
-		result.value = std::move(renderPass);
-		return result;
-	}
-	/*@brief Destroys a given vulkan render pass from a given vulkan device
-	*
-	* @param device the vulkan device used to destroy the vulkan render pass
-	* @param the vulkan render pass to be destroyed
-	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), RenderPassError)
-	*/
-	inline SkResult<bool, RenderPassError> destroyRenderPass(const vk::Device& device, const vk::RenderPass& renderPass)
-	{
-		SkResult result(static_cast<bool>(true), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+					skipWhitespace();
+					if (position >= text.size() || text[position] != ':')
+					{
+						return false;
+					}
 
-		try
+					position++;
+				}
+
+				value.elements.emplace_back();
+				if (!parseJsonValue(text, position, value.elements.back(), depth + 1))
+				{
+					return false;
+				}
+
+				skipWhitespace();
+				if (position >= text.size())
+				{
+					return false;
+				}
+
+				if (text[position] == ',')
+				{
+					position++;
+				}
+				else if (text[position] == closingCharacter)
+				{
+					position++;
+					return true;
+				}
+				else
+				{
+					return false;
+				}
+			}
+		}
+		else if (character == '"')
 		{
-			device.destroyRenderPass(renderPass);
+			value.type = JsonValue::Type::eString;
+			return parseString(value.string);
 		}
-		catch (vk::SystemError err)
+		else if (text.compare(position, 4, "true") == 0 || text.compare(position, 5, "false") == 0)
 		{
-			result.value = false;
-			result.error = RenderPassError::RENDER_PASS_DESTRUCTION_ERROR;
+			value.type = JsonValue::Type::eBoolean;
+			value.boolean = (character == 't');
+			position += (value.boolean ? 4 : 5);
+			return true;
+		}
+		else if (text.compare(position, 4, "null") == 0)
+		{
+			value.type = JsonValue::Type::eNull;
+			position += 4;
+			return true;
 		}
 
-		return result;
+		value.type = JsonValue::Type::eNumber;
+
+		auto parseResult = std::from_chars(text.data() + position, text.data() + text.size(), value.number);
+		if (parseResult.ec != std::errc())
+		{
+			return false;
+		}
+
+		position = static_cast<size_t>(parseResult.ptr - text.data());
+		return true;
 	}
 
-	/*@brief Begins a given render pass
+	/*@brief Parses a whole JSON document
 	*
-	* @param commandBuffer the vulkan command buffer used to begin the render pass
-	* @param renderPass the actual vulkan render pass beginning
-	* @param extent the vulkan 2D extent to be used in the render pass
-	* @param framebuffer the vulkan framebuffer to be used in the render pass
-	* @param clearValue the vulkan clearValue to be used in the render pass
+	* @param text The JSON text
 	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), RenderPassError)
+	* @return SkResult(root value of the document, ImportError)
 	*/
-	inline SkResult<bool, RenderPassError> beginRenderPass(const vk::CommandBuffer& commandBuffer, const vk::RenderPass& renderPass, const vk::Extent2D& extent, 
-		                                                   const vk::Framebuffer& framebuffer, const vk::ClearValue& clearValue)
+	inline SkResult<JsonValue, ImportError> parseJson(const std::string_view text)
 	{
-		SkResult result(static_cast<bool>(true), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
-
-		vk::RenderPassBeginInfo renderPassBeginInfo = {};
-		renderPassBeginInfo.renderPass = renderPass;
-
-		renderPassBeginInfo.renderArea.offset.x = 0;
-		renderPassBeginInfo.renderArea.offset.y = 0;
-		renderPassBeginInfo.renderArea.extent = extent;
-
-		renderPassBeginInfo.framebuffer = framebuffer;
+		SkResult result(static_cast<JsonValue>(JsonValue()), static_cast<ImportError>(ImportError::NO_ERROR));
 
-		renderPassBeginInfo.clearValueCount = 1;
-		renderPassBeginInfo.pClearValues = &clearValue;
-
-		try
-		{
-			commandBuffer.beginRenderPass(renderPassBeginInfo, vk::SubpassContents::eInline);
-		}
-		catch (vk::SystemError err)
+		size_t position = 0;
+		if (!parseJsonValue(text, position, result.value, 0) || text.find_first_not_of(" \t\n\r", position) != std::string_view::npos)
 		{
-			result.value = true;
-			result.error = RenderPassError::RENDER_PASS_BEGIN_ERROR;
+			result.value = JsonValue();
+			result.error = ImportError::PARSING_ERROR;
 		}
 
 		return result;
 	}
 
-	/*@brief Ends the render pass
-	*
-	* @param the command buffer used to end the render pass it is assigned to
+	/*@brief Appends a string to a JSON text as a quoted JSON string, escaping quotes, backslashes and control characters
 	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), RenderPassError)
+	* @param json The JSON text being written
+	* @param text The string to be appended
 	*/
-	inline SkResult<bool, RenderPassError> endRenderPass(const vk::CommandBuffer& commandBuffer)
+	inline void appendJsonString(std::string& json, const std::string_view text)
 	{
-		SkResult result(static_cast<bool>(true), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
-
-		try
-		{
-			commandBuffer.endRenderPass();
-		}
-		catch (vk::SystemError err)
+		json.push_back('"');
+		for (const char character : text)
 		{
-			result.value = true;
-			result.error = RenderPassError::RENDER_PASS_END_ERROR;
+			switch (character)
+			{
+			case '"':  json += "\\\""; break;
+			case '\\': json += "\\\\"; break;
+			case '\n': json += "\\n"; break;
+			case '\r': json += "\\r"; break;
+			case '\t': json += "\\t"; break;
+			default:
+				if (static_cast<unsigned char>(character) < 0x20)
+				{
+					char escaped[8];
+					std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(character));
+					json += escaped;
+				}
+				else
+				{
+					json.push_back(character);
+				}
+				break;
+			}
 		}
-
-		return result;
+		json.push_back('"');
 	}
 
-	/*FRAMEBUFFER*/
+	/*GLTF*/
 
-	/*@brief Creates a vector of framebuffers from a given vulkan device, render pass, 2D extent, swapchain and an attachment count and a vector of swapchain image views
+	/*@brief Decodes base64 data (as found in data URIs)
 	*
-	* @param device the vulkan device used to create the framebuffers
-	* @param renderPass the vulkan render pass to be used in the framebuffers' creation
-	* @param windowExtent the vulkan 2D extent to be used in the framebuffers' creation
-	* @param swapchain the vulkan swapchain to be used in the framebuffers' creation
-	* @param swapchainImageViews a vector of swapchain image views the framebuffers a created from
+	* @param text The base64 text, padding included
 	*
-	* @return SkResult(created framebuffers, FramebufferError)
+	* @return SkResult(decoded bytes, ImportError)
 	*/
-	inline SkResult<std::vector<vk::Framebuffer>, FramebufferError> createFramebuffers(const vk::Device& device, const vk::RenderPass& renderPass, const uint32_t attachmentCount, const vk::Extent2D &windowExtent, 
-		const vk::SwapchainKHR& swapchain, const std::vector<vk::ImageView>& swapchainImageViews)
+	inline SkResult<std::vector<uint8_t>, ImportError> decodeBase64(const std::string_view text)
 	{
-		SkResult result(static_cast<std::vector<vk::Framebuffer>>(std::vector<vk::Framebuffer>()), static_cast<FramebufferError>(FramebufferError::NO_ERROR));
-
-		vk::FramebufferCreateInfo framebufferCreateInfo = {};
+		SkResult result(static_cast<std::vector<uint8_t>>(std::vector<uint8_t>()), static_cast<ImportError>(ImportError::NO_ERROR));
 
-		framebufferCreateInfo.renderPass = renderPass;
-		framebufferCreateInfo.attachmentCount = attachmentCount;
-		framebufferCreateInfo.width = windowExtent.width;
-		framebufferCreateInfo.height = windowExtent.height;
-		framebufferCreateInfo.layers = 1;
+		auto decodeCharacter = [](const char character) -> int32_t
+		{
+			if (character >= 'A' && character <= 'Z') return character - 'A';
+			if (character >= 'a' && character <= 'z') return character - 'a' + 26;
+			if (character >= '0' && character <= '9') return character - '0' + 52;
+			if (character == '+' || character == '-') return 62;
+			if (character == '/' || character == '_') return 63;
+			return -1;
+		};
 
-		const uint32_t swapchainImageCount = static_cast<uint32_t>(getSwapchainImages(device, swapchain).value.size());
-		std::vector<vk::Framebuffer> framebuffers;
-		framebuffers.reserve(swapchainImageCount);
+		result.value.reserve(text.size() / 4 * 3);
 
-		for (uint32_t i = 0; i < swapchainImageCount; i++)
+		uint32_t bits = 0;
+		uint32_t bitCount = 0;
+		for (const char character : text)
 		{
-			framebufferCreateInfo.pAttachments = &swapchainImageViews[i];
+			if (character == '=')
+			{
+				break;
+			}
 
-			try
+			int32_t sextet = decodeCharacter(character);
+			if (sextet < 0)
 			{
-				framebuffers.emplace_back(device.createFramebuffer(framebufferCreateInfo));
+				result.value.clear();
+				result.error = ImportError::PARSING_ERROR;
+				return result;
 			}
-			catch (vk::SystemError err)
+
+			bits = (bits << 6) | static_cast<uint32_t>(sextet);
+			bitCount += 6;
+
+			if (bitCount >= 8)
 			{
-				result.error = FramebufferError::FRAMEBUFFER_CREATION_ERROR;
+				bitCount -= 8;
+				result.value.emplace_back(static_cast<uint8_t>(bits >> bitCount));
 			}
 		}
 
-		result.value = std::move(framebuffers);
 		return result;
 	}
 
-	/*@brief Destroys a given array of vulkan framebuffers from a vulkan device
-	*
-	* @param device the vulkan device destroyed the framebuffers
-	* @param framebuffers a given vector of framebuffers to be destroyed
-	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), FramebufferError)
-	*/
-	inline SkResult<bool, FramebufferError> destroyFramebuffers(const vk::Device& device, const std::vector<vk::Framebuffer>& framebuffers)
+	/*Buffer of a glTF asset, pointing into the mapped .glb / .bin files or into decoded data URIs*/
+	struct GltfBuffer
 	{
-		SkResult result(static_cast<bool>(true), static_cast<FramebufferError>(FramebufferError::NO_ERROR));
+		const uint8_t* pData = nullptr;
+		size_t size = 0;
+	};
 
-		for (uint32_t i = 0; i < framebuffers.size(); i++)
-		{
-			try
-			{
-				device.destroyFramebuffer(framebuffers[i]);
-			}
-			catch (vk::SystemError err)
-			{
-				result.value = false;
-				result.error = FramebufferError::FRAMEBUFFER_DESTRUCTION_ERROR;
-			}
-		}
+	/*glTF asset ready to be imported : its parsed document and its buffers, the mapped files staying open as long as the asset lives*/
+	struct GltfAsset
+	{
+		JsonValue document;
+		std::vector<GltfBuffer> buffers;
 
-		return result;
-	}
+		//Hash of the document and of every buffer, used as import cache key
+		uint64_t contentHash = 0;
 
-	/*SYNCHRONIZATION*/
+		std::vector<std::shared_ptr<MappedFile>> mappedFiles;
+		std::vector<std::shared_ptr<std::vector<uint8_t>>> decodedBuffers;
+	};
 
-	/*@brief Creates a vulkan fence from a given vulkan device
+	/*@brief Loads a glTF 2.0 asset (.gltf with external or embedded buffers, or binary .glb) : parses its JSON document and maps its buffers
 	*
-	* @param device the vulkan device creating the fence
+	* @param filename The name of the .gltf or .glb file
 	*
-	* @return SkResult(created fence, SyncError)
+	* @return SkResult(loaded asset, ImportError)
 	*/
-	inline SkResult<vk::Fence, SyncError> createFence(const vk::Device& device)
+	inline SkResult<GltfAsset, ImportError> loadGltf(const std::string_view filename)
 	{
-		SkResult result(static_cast<vk::Fence>(vk::Fence(nullptr)), static_cast<SyncError>(SyncError::NO_ERROR));
+		SkResult result(static_cast<GltfAsset>(GltfAsset()), static_cast<ImportError>(ImportError::NO_ERROR));
 
-		vk::FenceCreateInfo fenceCreateInfo = {};
-		fenceCreateInfo.flags = vk::FenceCreateFlagBits::eSignaled;
+		GltfAsset asset;
 
-		try
-		{
-			result.value = device.createFence(fenceCreateInfo);
-		}
-		catch (vk::SystemError err)
+		auto pMainFile = std::make_shared<MappedFile>();
+		if (error(pMainFile->open(filename)))
 		{
-			result.error = SyncError::FENCE_CREATION_ERROR;
+			result.error = ImportError::FILE_OPENING_ERROR;
+			return result;
 		}
 
-		return result;
-	}
+		asset.mappedFiles.emplace_back(pMainFile);
 
-	/*@brief Destroys a given vulkan fence from a vulkan device
-	*
-	* @param device the vulkan device used to destroy the vulkan fence
-	* @param fence the vulkan fence to be destroyed
-	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), SyncError)
-	*/
-	inline SkResult<bool, SyncError> destroyFence(const vk::Device& device, vk::Fence& fence)
-	{
-		SkResult result(static_cast<bool>(true), static_cast<SyncError>(SyncError::NO_ERROR));
+		const uint8_t* pFileData = static_cast<const uint8_t*>(pMainFile->getData());
+		std::string_view json(reinterpret_cast<const char*>(pFileData), pMainFile->getSize());
+		GltfBuffer binaryChunk;
 
-		try
+		/*GLB CONTAINER*/
+		//12 bytes header (magic, version, length) followed by a JSON chunk and an optional BIN chunk, each chunk starting with its length and type
+		const uint32_t glbMagic = 0x46546C67;
+		uint32_t magic = 0;
+		if (pMainFile->getSize() >= 4)
 		{
-			device.destroyFence(fence);
+			std::memcpy(&magic, pFileData, sizeof(uint32_t));
 		}
-		catch (vk::SystemError err)
+
+		if (magic == glbMagic)
 		{
-			result.value = false;
-			result.error = SyncError::FENCE_DESTRUCTION_ERROR;
-		}
+			std::array<uint32_t, 3> glbHeader = {};
+			if (pMainFile->getSize() < 20)
+			{
+				result.error = ImportError::PARSING_ERROR;
+				return result;
+			}
 
-		return result;
-	}
+			std::memcpy(glbHeader.data(), pFileData, sizeof(glbHeader));
+			if (glbHeader[1] != 2)
+			{
+				result.error = ImportError::UNSUPPORTED_FORMAT_ERROR;
+				return result;
+			}
 
-	/*@brief Creates a vulkan semaphore from a given vulkan device
-	*
-	* @param device the vulkan device creating the vulkan semaphore
-	*
-	* @return SkResult(created semaphore, SyncError)
-	*/
-	inline SkResult<vk::Semaphore, SyncError> createSemaphore(const vk::Device& device)
-	{
-		SkResult result(static_cast<vk::Semaphore>(vk::Semaphore(nullptr)), static_cast<SyncError>(SyncError::NO_ERROR));
+			size_t fileSize = std::min<size_t>(glbHeader[2], pMainFile->getSize());
+			size_t chunkOffset = 12;
+			for (uint32_t chunk = 0; chunkOffset + 8 <= fileSize; chunk++)
+			{
+				std::array<uint32_t, 2> chunkHeader = {};
+				std::memcpy(chunkHeader.data(), pFileData + chunkOffset, sizeof(chunkHeader));
 
-		vk::SemaphoreCreateInfo semaphoreCreateInfo = {};
-		semaphoreCreateInfo.flags = vk::SemaphoreCreateFlagBits();
+				if (chunkHeader[0] > fileSize - chunkOffset - 8)
+				{
+					result.error = ImportError::PARSING_ERROR;
+					return result;
+				}
 
-		try
+				const uint8_t* pChunkData = pFileData + chunkOffset + 8;
+				if (chunk == 0 && chunkHeader[1] == 0x4E4F534A) //"JSON"
+				{
+					json = std::string_view(reinterpret_cast<const char*>(pChunkData), chunkHeader[0]);
+				}
+				else if (chunk == 1 && chunkHeader[1] == 0x004E4942) //"BIN\0"
+				{
+					binaryChunk.pData = pChunkData;
+					binaryChunk.size = chunkHeader[0];
+				}
+				else if (chunk == 0)
+				{
+					result.error = ImportError::PARSING_ERROR;
+					return result;
+				}
+
+				chunkOffset += 8 + chunkHeader[0];
+			}
+		}
+
+		auto parseJsonResult = parseJson(json);
+		if (error(parseJsonResult))
 		{
-			result.value = device.createSemaphore(semaphoreCreateInfo);
+			result.error = parseJsonResult.error;
+			return result;
 		}
-		catch (vk::SystemError err)
+
+		asset.document = std::move(parseJsonResult.value);
+		asset.contentHash = hashBytes(json.data(), json.size());
+
+		const JsonValue* pAssetInfo = asset.document.find("asset");
+		if (pAssetInfo == nullptr || pAssetInfo->getString("version").compare(0, 2, "2.") != 0)
 		{
-			result.error = SyncError::SEMAPHORE_CREATION_ERROR;
+			result.error = ImportError::UNSUPPORTED_FORMAT_ERROR;
+			return result;
 		}
 
-		return result;
-	}
+		/*BUFFERS*/
+		const JsonValue* pBuffers = asset.document.find("buffers");
+		const size_t bufferCount = (pBuffers != nullptr ? pBuffers->elements.size() : 0);
 
-	/*@brief Destroys a given vulkan semaphore from a vulkan device
-	*
-	* @param device the vulkan device used to destroy the vulkan semaphore
-	* @param semaphore the vulkan semaphore to be destroyed
-	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), SyncError)
-	*/
-	inline SkResult<bool, SyncError> destroySemaphore(const vk::Device& device, vk::Semaphore& semaphore)
-	{
-		SkResult result(static_cast<bool>(true), static_cast<SyncError>(SyncError::NO_ERROR));
-
-		try
-		{
-			device.destroySemaphore(semaphore);
-		}
-		catch (vk::SystemError err)
+		for (size_t i = 0; i < bufferCount; i++)
 		{
-			result.value = false;
-			result.error = SyncError::SEMAPHORE_DESTRUCTION_ERROR;
+			const JsonValue& buffer = pBuffers->elements[i];
+			const JsonValue* pUri = buffer.find("uri");
+
+			GltfBuffer gltfBuffer;
+			if (pUri == nullptr)
+			{
+				//Only the first buffer of a .glb can be its BIN chunk
+				gltfBuffer = (i == 0 ? binaryChunk : GltfBuffer());
+			}
+			else if (pUri->string.compare(0, 5, "data:") == 0)
+			{
+				size_t dataBegin = pUri->string.find(";base64,");
+				if (dataBegin == std::string::npos)
+				{
+					result.error = ImportError::UNSUPPORTED_FEATURE_ERROR;
+					return result;
+				}
+
+				auto decodeBase64Result = decodeBase64(std::string_view(pUri->string).substr(dataBegin + 8));
+				if (error(decodeBase64Result))
+				{
+					result.error = decodeBase64Result.error;
+					return result;
+				}
+
+				auto pDecodedBuffer = std::make_shared<std::vector<uint8_t>>(std::move(decodeBase64Result.value));
+				gltfBuffer.pData = pDecodedBuffer->data();
+				gltfBuffer.size = pDecodedBuffer->size();
+				asset.decodedBuffers.emplace_back(pDecodedBuffer);
+			}
+			else
+			{
+				//Relative URI, only spaces are usually percent encoded by exporters
+				std::string relativePath;
+				for (size_t c = 0; c < pUri->string.size(); c++)
+				{
+					if (pUri->string.compare(c, 3, "%20") == 0)
+					{
+						relativePath += ' ';
+						c += 2;
+					}
+					else
+					{
+						relativePath += pUri->string[c];
+					}
+				}
+
+				//URIs are UTF-8, std::filesystem::u8path being deprecated once char8_t exists
+#ifdef __cpp_lib_char8_t
+				const std::filesystem::path relativeBufferPath(std::u8string(relativePath.begin(), relativePath.end()));
+#else
+				const std::filesystem::path relativeBufferPath = std::filesystem::u8path(relativePath);
+#endif
+				std::filesystem::path bufferPath = std::filesystem::path(filename).parent_path() / relativeBufferPath;
+
+				auto pBufferFile = std::make_shared<MappedFile>();
+				if (error(pBufferFile->open(bufferPath.string())))
+				{
+					result.error = ImportError::FILE_OPENING_ERROR;
+					return result;
+				}
+
+				gltfBuffer.pData = static_cast<const uint8_t*>(pBufferFile->getData());
+				gltfBuffer.size = pBufferFile->getSize();
+				asset.mappedFiles.emplace_back(pBufferFile);
+			}
+
+			size_t byteLength = buffer.getSize("byteLength", 0);
+			if (gltfBuffer.size < byteLength)
+			{
+				result.error = ImportError::INVALID_ACCESSOR_ERROR;
+				return result;
+			}
+
+			gltfBuffer.size = byteLength;
+			asset.contentHash = hashBytes(gltfBuffer.pData, gltfBuffer.size, asset.contentHash);
+			asset.buffers.emplace_back(gltfBuffer);
 		}
 
+		result.value = std::move(asset);
 		return result;
 	}
 
-	/*DRAWING*/
+	/*Accessor of a glTF asset resolved to a pointer into its buffer, pData being nullptr for accessors without buffer view (all zeros)*/
+	struct GltfAccessor
+	{
+		const uint8_t* pData = nullptr;
+		size_t count = 0;
+		size_t stride = 0;
+		uint32_t componentType = 0;
+		uint32_t componentCount = 0;
+		bool normalized = false;
+	};
 
-	//Lots of work to do on that one
-	/*@brief The main drawing function
+	/*@brief Returns the size in bytes of a glTF component type (5120 = byte ... 5126 = float), 0 if the type is unknown*/
+	inline uint32_t getGltfComponentSize(const uint32_t componentType) noexcept
+	{
+		switch (componentType)
+		{
+		case 5120: case 5121: return 1;
+		case 5122: case 5123: return 2;
+		case 5125: case 5126: return 4;
+		default: return 0;
+		}
+	}
+
+	/*@brief Resolves an accessor of a glTF asset and checks that every element it reads lies inside its buffer view
 	*
-	* @param device the vulkan device used to acquire the next images
-	* @param commandBuffer the vulkan command buffer receiving all the commands
-	* @param swapchain the vulkan swapchain to get the next images from
-	* @param queue the vulkan queue from which to submit
-	* @param pipeline The vulkan pipeline used to draw
-	* @param renderFence The vulkan fence ensuring render synchronization
-	* @param presentSemaphore The vulkan semaphor ensuring present synchronization
-	* @param renderSemaphore The vulkan semaphore ensuring render synchronization
-	* @param renderPass The vulkan render pass to be used in the drawing process
-	* @param extent The vulkan 2D extent used in the vulkan render pass
-	* @param framebuffers The vulkan framebuffers to be drawn
-	* @param vertexBuffers The vulkan buffers of vertices
-	* @param vertices The vertices to be drawn
-	* @param frameNumber The current frame number
+	* @param asset The glTF asset
+	* @param accessorIndex The index of the accessor
 	*
-	* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawingError)
+	* @return SkResult(resolved accessor, ImportError)
 	*/
-	inline SkResult<bool, DrawingError> draw(const vk::Device& device, const vk::CommandBuffer& commandBuffer, const vk::SwapchainKHR& swapchain, const vk::Queue& queue, const vk::Pipeline& pipeline, vk::Fence& renderFence, vk::Semaphore& presentSemaphore,
-		vk::Semaphore& renderSemaphore, const vk::RenderPass& renderPass, const vk::Extent2D& extent, const std::vector<vk::Framebuffer>& framebuffers, const std::vector<vk::Buffer>& vertexBuffers,
-		const std::vector<Vertex>& vertices, double& frameNumber)
+	inline SkResult<GltfAccessor, ImportError> resolveGltfAccessor(const GltfAsset& asset, const size_t accessorIndex)
 	{
-		SkResult result(static_cast<bool>(true), static_cast<DrawingError>(DrawingError::NO_ERROR));
+		SkResult result(static_cast<GltfAccessor>(GltfAccessor()), static_cast<ImportError>(ImportError::NO_ERROR));
 
-		uint32_t timeout = 1000000000;
-		auto waitForFencesResult = device.waitForFences(renderFence, true, timeout);
-		device.resetFences(renderFence);
+		const JsonValue* pAccessors = asset.document.find("accessors");
+		if (pAccessors == nullptr || accessorIndex >= pAccessors->elements.size())
+		{
+			result.error = ImportError::INVALID_ACCESSOR_ERROR;
+			return result;
+		}
 
-		uint32_t swapchainImageIndex = device.acquireNextImageKHR(swapchain, timeout, presentSemaphore).value;
+		const JsonValue& accessor = pAccessors->elements[accessorIndex];
+		if (accessor.find("sparse") != nullptr)
+		{
+			result.error = ImportError::UNSUPPORTED_FEATURE_ERROR;
+			return result;
+		}
 
-		commandBuffer.reset();
+		static const std::array<std::pair<const char*, uint32_t>, 7> types = { { { "SCALAR", 1 }, { "VEC2", 2 }, { "VEC3", 3 }, { "VEC4", 4 }, { "MAT2", 4 }, { "MAT3", 9 }, { "MAT4", 16 } } };
 
-		beginCommandBuffer(commandBuffer);
+		GltfAccessor gltfAccessor;
+		gltfAccessor.count = accessor.getSize("count", 0);
+		gltfAccessor.componentType = static_cast<uint32_t>(std::min<size_t>(accessor.getSize("componentType", 0), UINT32_MAX));
 
-		vk::ClearValue clearValue;
-		double flash = abs(sin((frameNumber) / 1200.0));
-		std::array<float, 4> colorArray = { 0.0f, 0.0f, 0.0f, 1.0 };
-		clearValue.color = std::move(vk::ClearColorValue(colorArray));
+		const JsonValue* pNormalized = accessor.find("normalized");
+		gltfAccessor.normalized = (pNormalized != nullptr && pNormalized->boolean);
 
-		beginRenderPass(commandBuffer, renderPass, extent, framebuffers[swapchainImageIndex], clearValue);
+		std::string type = accessor.getString("type");
+		for (const auto& accessorType : types)
+		{
+			if (type == accessorType.first)
+			{
+				gltfAccessor.componentCount = accessorType.second;
+			}
+		}
+
+		uint32_t elementSize = getGltfComponentSize(gltfAccessor.componentType) * gltfAccessor.componentCount;
+		if (elementSize == 0)
+		{
+			result.error = ImportError::INVALID_ACCESSOR_ERROR;
+			return result;
+		}
 
-		commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline);
+		gltfAccessor.stride = elementSize;
 
-		vk::DeviceSize offset = 0;
-		commandBuffer.bindVertexBuffers(0, 1, vertexBuffers.data(), &offset);
+		const JsonValue* pBufferViewIndex = accessor.find("bufferView");
+		if (pBufferViewIndex == nullptr)
+		{
+			result.value = gltfAccessor;
+			return result;
+		}
 
-		commandBuffer.draw(static_cast<uint32_t>(vertices.size()), 1, 0, 0);
+		const JsonValue* pBufferViews = asset.document.find("bufferViews");
+		size_t bufferViewIndex = pBufferViewIndex->toSize();
+		if (pBufferViews == nullptr || bufferViewIndex >= pBufferViews->elements.size())
+		{
+			result.error = ImportError::INVALID_ACCESSOR_ERROR;
+			return result;
+		}
 
-		endRenderPass(commandBuffer);
+		const JsonValue& bufferView = pBufferViews->elements[bufferViewIndex];
+		size_t bufferIndex = bufferView.getSize("buffer", std::numeric_limits<size_t>::max());
+		size_t viewOffset = bufferView.getSize("byteOffset", 0);
+		size_t viewLength = bufferView.getSize("byteLength", 0);
+		size_t accessorOffset = accessor.getSize("byteOffset", 0);
 
-		endCommandBuffer(commandBuffer);
+		gltfAccessor.stride = bufferView.getSize("byteStride", elementSize);
 
-		queueSubmit(queue, commandBuffer, presentSemaphore, renderSemaphore, renderFence);
+		//The last element ends at offset + stride * (count - 1) + elementSize
+		bool isValid = (bufferIndex < asset.buffers.size() && viewLength <= asset.buffers[bufferIndex].size && viewOffset <= asset.buffers[bufferIndex].size - viewLength);
+		isValid = isValid && (gltfAccessor.stride >= elementSize && gltfAccessor.stride <= 252 && accessorOffset <= viewLength);
+		isValid = isValid && (gltfAccessor.count == 0 || (gltfAccessor.count - 1 <= (viewLength - accessorOffset) / gltfAccessor.stride &&
+		                                                  (gltfAccessor.count - 1) * gltfAccessor.stride + elementSize <= viewLength - accessorOffset));
 
-		queuePresent(queue, swapchain, renderSemaphore, swapchainImageIndex);
+		if (!isValid || asset.buffers[bufferIndex].pData == nullptr)
+		{
+			result.error = ImportError::INVALID_ACCESSOR_ERROR;
+			return result;
+		}
 
-		frameNumber++;
+		gltfAccessor.pData = asset.buffers[bufferIndex].pData + viewOffset + accessorOffset;
 
+		result.value = gltfAccessor;
 		return result;
 	}
 
-	/*SHADERS*/
+	/*@brief Reads a component of an element of a glTF accessor as a float, normalized integers being mapped to [0, 1] or [-1, 1]*/
+	inline float readGltfFloat(const GltfAccessor& accessor, const size_t element, const uint32_t component) noexcept
+	{
+		if (accessor.pData == nullptr)
+		{
+			return 0.0f;
+		}
+
+		const uint8_t* pComponent = accessor.pData + element * accessor.stride + component * getGltfComponentSize(accessor.componentType);
+
+		//Buffers hold no alignment guarantee once mapped, components are copied out
+		switch (accessor.componentType)
+		{
+		case 5120: { int8_t value = 0;   std::memcpy(&value, pComponent, 1); return (accessor.normalized ? std::max(value / 127.0f, -1.0f) : value); }
+		case 5121: { uint8_t value = 0;  std::memcpy(&value, pComponent, 1); return (accessor.normalized ? value / 255.0f : value); }
+		case 5122: { int16_t value = 0;  std::memcpy(&value, pComponent, 2); return (accessor.normalized ? std::max(value / 32767.0f, -1.0f) : value); }
+		case 5123: { uint16_t value = 0; std::memcpy(&value, pComponent, 2); return (accessor.normalized ? value / 65535.0f : value); }
+		case 5125: { uint32_t value = 0; std::memcpy(&value, pComponent, 4); return static_cast<float>(value); }
+		default:   { float value = 0.0f; std::memcpy(&value, pComponent, 4); return value; }
+		}
+	}
+
+	/*@brief Returns true if a glTF component type can hold indices (5121 = unsigned byte, 5123 = unsigned short, 5125 = unsigned int)*/
+	inline bool isGltfIndexComponentType(const uint32_t componentType) noexcept
+	{
+		return (componentType == 5121 || componentType == 5123 || componentType == 5125);
+	}
+
+	/*@brief Reads an element of a glTF index accessor, 0 being returned for component types rejected by isGltfIndexComponentType()*/
+	inline uint32_t readGltfIndex(const GltfAccessor& accessor, const size_t element) noexcept
+	{
+		if (accessor.pData == nullptr)
+		{
+			return 0;
+		}
+
+		const uint8_t* pIndex = accessor.pData + element * accessor.stride;
+
+		switch (accessor.componentType)
+		{
+		case 5121: return *pIndex;
+		case 5123: { uint16_t index = 0; std::memcpy(&index, pIndex, 2); return index; }
+		case 5125: { uint32_t index = 0; std::memcpy(&index, pIndex, 4); return index; }
+		default:   return 0;
+		}
+	}
 
-	/*@brief Loads a shader file into a vector uint32_t buffer from a given filename
+	/*@brief Builds the mesh of a glTF mesh, its triangle primitives being merged into one indexed mesh.
+	* Triangle strips and fans are turned into lists, points and lines are skipped, materials and node transforms are ignored
 	*
-	* @param shaderFilename the filename referring to the shader file
+	* @param asset The glTF asset
+	* @param meshIndex The index of the mesh
 	*
-	* @return SkResult(actual buffer holding shader file, ShaderError)
+	* @return SkResult(imported mesh, ImportError)
 	*/
-	inline SkResult<std::vector<uint32_t>, ShaderError> loadShaderFileInBuffer(const std::string_view shaderFilename) noexcept
+	inline SkResult<ImportedMesh, ImportError> importGltfMesh(const GltfAsset& asset, const size_t meshIndex)
 	{
-		SkResult result(static_cast<std::vector<uint32_t>>(std::vector<uint32_t>()), static_cast<ShaderError>(ShaderError::NO_ERROR));
+		SkResult result(static_cast<ImportedMesh>(ImportedMesh()), static_cast<ImportError>(ImportError::NO_ERROR));
+
+		const JsonValue& gltfMesh = asset.document.find("meshes")->elements[meshIndex];
+		const JsonValue* pPrimitives = gltfMesh.find("primitives");
+
+		ImportedMesh importedMesh;
+		importedMesh.name = gltfMesh.getString("name", "mesh_" + std::to_string(meshIndex));
 
-		std::ifstream shaderFile(std::string(shaderFilename), std::ios::ate | std::ios::binary);
+		Mesh& mesh = importedMesh.mesh;
+		const size_t primitiveCount = (pPrimitives != nullptr ? pPrimitives->elements.size() : 0);
 
-		if (!shaderFile.is_open())
+		for (size_t p = 0; p < primitiveCount; p++)
 		{
-			result.error = ShaderError::SHADER_FILE_OPENING_ERROR;
-		}
+			const JsonValue& primitive = pPrimitives->elements[p];
+
+			uint32_t mode = static_cast<uint32_t>(std::min<size_t>(primitive.getSize("mode", 4), UINT32_MAX));
+			const JsonValue* pAttributes = primitive.find("attributes");
+			if (mode < 4 || mode > 6 || pAttributes == nullptr)
+			{
+				continue;
+			}
+
+			/*VERTICES*/
+			const JsonValue* pPositionIndex = pAttributes->find("POSITION");
+			if (pPositionIndex == nullptr)
+			{
+				continue;
+			}
+
+			auto positionResult = resolveGltfAccessor(asset, pPositionIndex->toSize());
+			if (error(positionResult))
+			{
+				result.error = positionResult.error;
+				return result;
+			}
+
+			const GltfAccessor& positions = positionResult.value;
+			if (positions.pData == nullptr || positions.componentCount < 3)
+			{
+				result.error = ImportError::INVALID_ACCESSOR_ERROR;
+				return result;
+			}
+
+			GltfAccessor normals;
+			GltfAccessor colors;
+			for (const auto& attribute : { std::make_pair("NORMAL", &normals), std::make_pair("COLOR_0", &colors) })
+			{
+				const JsonValue* pAccessorIndex = pAttributes->find(attribute.first);
+				if (pAccessorIndex == nullptr)
+				{
+					continue;
+				}
+
+				auto accessorResult = resolveGltfAccessor(asset, pAccessorIndex->toSize());
+				if (error(accessorResult) || accessorResult.value.count < positions.count || accessorResult.value.componentCount < 3)
+				{
+					result.error = (error(accessorResult) ? accessorResult.error : ImportError::INVALID_ACCESSOR_ERROR);
+					return result;
+				}
+
+				*attribute.second = accessorResult.value;
+			}
+
+			const size_t firstVertex = mesh.vertices.size();
+			const size_t firstIndex = mesh.indices.size();
 
-		size_t shaderFileSize = static_cast<size_t>(shaderFile.tellg());
+			mesh.vertices.reserve(firstVertex + positions.count);
+			for (size_t v = 0; v < positions.count; v++)
+			{
+				SOULKAN_MATHS_NAMESPACE::Vec3 position(readGltfFloat(positions, v, 0), readGltfFloat(positions, v, 1), readGltfFloat(positions, v, 2));
+				SOULKAN_MATHS_NAMESPACE::Vec3 normal(readGltfFloat(normals, v, 0), readGltfFloat(normals, v, 1), readGltfFloat(normals, v, 2));
+				SOULKAN_MATHS_NAMESPACE::Vec3 color(1.0f, 1.0f, 1.0f);
+
+				if (colors.count > 0)
+				{
+					color = SOULKAN_MATHS_NAMESPACE::Vec3(readGltfFloat(colors, v, 0), readGltfFloat(colors, v, 1), readGltfFloat(colors, v, 2));
+				}
+
+				mesh.vertices.emplace_back(position, normal, color);
+			}
+
+			/*INDICES*/
+			GltfAccessor indices;
+			const JsonValue* pIndicesIndex = primitive.find("indices");
+			if (pIndicesIndex != nullptr)
+			{
+				auto indicesResult = resolveGltfAccessor(asset, pIndicesIndex->toSize());
+				if (error(indicesResult))
+				{
+					result.error = indicesResult.error;
+					return result;
+				}
+
+				indices = indicesResult.value;
+				if (indices.pData == nullptr || indices.componentCount != 1 || !isGltfIndexComponentType(indices.componentType))
+				{
+					result.error = ImportError::INVALID_ACCESSOR_ERROR;
+					return result;
+				}
+			}
+
+			const size_t indexCount = (pIndicesIndex != nullptr ? indices.count : positions.count);
+			auto getIndex = [&indices, pIndicesIndex](const size_t i)
+			{
+				return (pIndicesIndex != nullptr ? readGltfIndex(indices, i) : static_cast<uint32_t>(i));
+			};
 
-		std::vector<uint32_t> shaderBuffer(shaderFileSize / sizeof(uint32_t));
+			//4 = triangles, 5 = triangle strip, 6 = triangle fan
+			const size_t triangleCount = (mode == 4 ? indexCount / 3 : (indexCount >= 3 ? indexCount - 2 : 0));
+			mesh.indices.reserve(firstIndex + triangleCount * 3);
 
-		shaderFile.seekg(0);
+			for (size_t t = 0; t < triangleCount; t++)
+			{
+				std::array<uint32_t, 3> triangle = {};
+				if (mode == 4)
+				{
+					triangle = { getIndex(t * 3), getIndex(t * 3 + 1), getIndex(t * 3 + 2) };
+				}
+				else if (mode == 5)
+				{
+					//Every other triangle of a strip is flipped to keep the winding
+					triangle = (t % 2 == 0 ? std::array<uint32_t, 3>{ getIndex(t), getIndex(t + 1), getIndex(t + 2) }
+					                       : std::array<uint32_t, 3>{ getIndex(t), getIndex(t + 2), getIndex(t + 1) });
+				}
+				else
+				{
+					triangle = { getIndex(0), getIndex(t + 1), getIndex(t + 2) };
+				}
 
-		shaderFile.read((char*)shaderBuffer.data(), shaderFileSize);
+				for (const uint32_t index : triangle)
+				{
+					if (index >= positions.count)
+					{
+						result.error = ImportError::INDEX_OUT_OF_RANGE_ERROR;
+						return result;
+					}
+
+					mesh.indices.emplace_back(static_cast<uint32_t>(firstVertex) + index);
+				}
+			}
+
+			if (normals.count == 0)
+			{
+				computeVertexNormals(mesh, firstVertex, firstIndex);
+			}
+		}
 
-		shaderFile.close();
+		importedMesh.bounds = computeMeshBounds(mesh);
 
-		result.value = std::move(shaderBuffer);
+		result.value = std::move(importedMesh);
 		return result;
 	}
 
-	/*@brief Creates a shader module from a shaderBuffer by a vulkan device
+	/*@brief Imports every mesh of a loaded glTF asset, the meshes being built in parallel
 	*
-	* @param device the vulkan device creating the shader module
-	* @param shaderBuffer the vector uin32_t buffer holding the shader file data
+	* @param asset The glTF asset (see loadGltf())
+	* @param threadPool The thread pool building the meshes
 	*
-	* @return SkResult(created shader module, ShaderError)
+	* @return SkResult(imported meshes, one per glTF mesh, ImportError)
 	*/
-	inline SkResult<vk::ShaderModule, ShaderError> createShaderModule(const vk::Device& device, const std::vector<uint32_t>& shaderBuffer)
+	inline SkResult<std::vector<ImportedMesh>, ImportError> importGltf(const GltfAsset& asset, ThreadPool& threadPool)
 	{
-		SkResult result(static_cast<vk::ShaderModule>(vk::ShaderModule(nullptr)), static_cast<ShaderError>(ShaderError::NO_ERROR));
+		SkResult result(static_cast<std::vector<ImportedMesh>>(std::vector<ImportedMesh>()), static_cast<ImportError>(ImportError::NO_ERROR));
 
-		vk::ShaderModuleCreateInfo shaderModuleCreateInfo = {};
-		shaderModuleCreateInfo.codeSize = shaderBuffer.size() * sizeof(uint32_t);
-		shaderModuleCreateInfo.pCode = shaderBuffer.data();
+		const JsonValue* pMeshes = asset.document.find("meshes");
+		const size_t meshCount = (pMeshes != nullptr ? pMeshes->elements.size() : 0);
 
-		try
+		std::vector<ImportedMesh> meshes(meshCount);
+		std::vector<ImportError> errors(meshCount, ImportError::NO_ERROR);
+
+		threadPool.parallelFor(meshCount, [&](const size_t meshIndex)
 		{
-			result.value = device.createShaderModule(shaderModuleCreateInfo);
-		}
-		catch (vk::SystemError err)
+			auto importGltfMeshResult = importGltfMesh(asset, meshIndex);
+
+			errors[meshIndex] = importGltfMeshResult.error;
+			meshes[meshIndex] = std::move(importGltfMeshResult.value);
+		});
+
+		for (const ImportError meshError : errors)
 		{
-			result.error = ShaderError::SHADER_MODULE_CREATION_ERROR;
+			if (meshError != ImportError::NO_ERROR)
+			{
+				result.error = meshError;
+				return result;
+			}
 		}
 
+		result.value = std::move(meshes);
 		return result;
 	}
 
-	/*@brief Creates a shader module from a shader filename by a vulkan device
-	*
-	* @param device the vulkan device creating the shader module
-	* @param shaderFilename std::string containing the shader filename
-	*
-	* @return SkResult(created shader module, ShaderError)
-	*/
-	inline SkResult<vk::ShaderModule, ShaderError> createShaderModule(const vk::Device& device, const std::string_view shaderFilename)
-	{
-		SkResult result(static_cast<vk::ShaderModule>(vk::ShaderModule(nullptr)), static_cast<ShaderError>(ShaderError::NO_ERROR));
-
-		auto loadShaderFileInBufferResult = loadShaderFileInBuffer(std::string(shaderFilename));
-		result.error = affectError(loadShaderFileInBufferResult, result.error);
-		std::vector<uint32_t> shaderBuffer = retLog(loadShaderFileInBufferResult);
+	/*IMPORT CACHE*/
 
-		auto createShaderModuleResult = createShaderModule(device, shaderBuffer);
-		result.error = affectError(createShaderModuleResult, result.error);
-		vk::ShaderModule shaderModule = retLog(createShaderModuleResult);
+	/*@brief Returns the name of a file of the import cache : <cacheDirectory>/<16 hex digits key><suffix>*/
+	inline std::string getImportCacheFilename(const std::string_view cacheDirectory, const uint64_t key, const std::string_view suffix)
+	{
+		std::array<char, 17> hexKey = {};
+		std::snprintf(hexKey.data(), hexKey.size(), "%016llx", static_cast<unsigned long long>(key));
 
-		result.value = shaderModule;
-		return result;
+		return (std::filesystem::path(cacheDirectory) / (std::string(hexKey.data()) + std::string(suffix))).string();
 	}
 
-	/*@brief Destroys a given vulkan shader module
-	*
-	* @param device The vulkan device ordered to destroy the shader module
-	* @param shaderModule The vulkan shader module to be destroyed
-	*
-	* @return SkResult(bool indicating if the operation worked(true) or not(false), ShaderError)
-	*/
-	inline SkResult<bool, ShaderError> destroyShaderModule(const vk::Device& device, vk::ShaderModule& shaderModule)
+	/*@brief Escapes a mesh name into a single line of the import cache manifest, backslashes and line breaks becoming \\, \n and \r*/
+	inline std::string escapeImportCacheName(const std::string_view name)
 	{
-		SkResult result(static_cast<bool>(true), static_cast<ShaderError>(ShaderError::NO_ERROR));
+		std::string escapedName;
+		escapedName.reserve(name.size());
 
-		try
+		for (const char c : name)
 		{
-			device.destroyShaderModule(shaderModule);
+			switch (c)
+			{
+			case '\\': escapedName += "\\\\"; break;
+			case '\n': escapedName += "\\n"; break;
+			case '\r': escapedName += "\\r"; break;
+			default:   escapedName += c; break;
+			}
 		}
-		catch (vk::SystemError err)
+
+		return escapedName;
+	}
+
+	/*@brief Restores a mesh name escaped by escapeImportCacheName(), unknown escapes being kept as they are*/
+	inline std::string unescapeImportCacheName(const std::string_view escapedName)
+	{
+		std::string name;
+		name.reserve(escapedName.size());
+
+		for (size_t c = 0; c < escapedName.size(); c++)
 		{
-			result.value = 0;
-			result.error = ShaderError::SHADER_MODULE_DELETION_ERROR;
+			const char next = (c + 1 < escapedName.size() ? escapedName[c + 1] : '\0');
+			if (escapedName[c] == '\\' && (next == '\\' || next == 'n' || next == 'r'))
+			{
+				name += (next == 'n' ? '\n' : (next == 'r' ? '\r' : '\\'));
+				c++;
+			}
+			else
+			{
+				name += escapedName[c];
+			}
 		}
 
-		return result;
+		return name;
 	}
 
-	/*PIPELINES*/
-
-	/*@brief Creates a shader stage given its flags, module and entry name
+	/*@brief Reads the meshes of an asset from the import cache, written by writeImportCache() : a manifest listing the meshes and one mesh file per mesh
 	*
-	* @param shaderStageFlag The vulkan shader stage flag indicating if the associated shader module is a vertex shader or a fragment shader
-	* @param shaderModule The vulkan shader module to be included in the shader stage
-	* @param entryName The name of the main() function of the shader
+	* @param cacheDirectory The directory holding the cache
+	* @param key The content hash of the source asset
+	* @param threadPool The thread pool reading the mesh files
 	*
-	* @return SkResult(created shader stage, GraphicsPipelineError)
+	* @return SkResult(cached meshes, ImportError) : CACHE_ERROR if the asset is not cached or its cache is corrupted
 	*/
-	inline SkResult<vk::PipelineShaderStageCreateInfo, GraphicsPipelineError> createPipelineShaderStageCreateInfo(const vk::ShaderStageFlagBits& shaderStageFlag, const vk::ShaderModule& shaderModule,
-		const std::string& entryName)
+	inline SkResult<std::vector<ImportedMesh>, ImportError> readImportCache(const std::string_view cacheDirectory, const uint64_t key, ThreadPool& threadPool)
 	{
-		SkResult result(static_cast<vk::PipelineShaderStageCreateInfo>(vk::PipelineShaderStageCreateInfo{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+		SkResult result(static_cast<std::vector<ImportedMesh>>(std::vector<ImportedMesh>()), static_cast<ImportError>(ImportError::NO_ERROR));
 
-		vk::PipelineShaderStageCreateInfo pipelineShaderStageCreateInfo = {};
-		try
+		const std::string manifestFilename = getImportCacheFilename(cacheDirectory, key, ".skmeshes");
+		std::ifstream manifest(manifestFilename);
+
+		std::error_code errorCode;
+		const uintmax_t manifestSize = std::filesystem::file_size(manifestFilename, errorCode);
+
+		//Every mesh takes at least one line of the manifest, a larger count comes from a corrupted file
+		size_t meshCount = 0;
+		if (!manifest.is_open() || errorCode || !(manifest >> meshCount) || meshCount > manifestSize)
 		{
-			pipelineShaderStageCreateInfo.stage = shaderStageFlag;
-			pipelineShaderStageCreateInfo.module = shaderModule;
-			pipelineShaderStageCreateInfo.pName = entryName.c_str();
+			result.error = ImportError::CACHE_ERROR;
+			return result;
 		}
-		catch (vk::SystemError err)
+
+		std::vector<ImportedMesh> meshes(meshCount);
+
+		manifest.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+		for (auto& mesh : meshes)
 		{
-			result.error = GraphicsPipelineError::PIPELINE_SHADER_STAGE_CREATE_INFO_ERROR;
-		}
+			std::string escapedName;
+			if (!std::getline(manifest, escapedName))
+			{
+				result.error = ImportError::CACHE_ERROR;
+				return result;
+			}
 
-		result.value = pipelineShaderStageCreateInfo;
-		return result;
-	}
+			mesh.name = unescapeImportCacheName(escapedName);
+		}
 
-	/*@brief Creates a vector of shader stages given its flags, modules and entry names
-	*
-	* @param shaderStageFlags The vulkan shader stage flags indicating if each of the associated shaders are vertex or fragment shader
-	* @param shaderModules The vulkan shader modules to be included in the shader stage, originating from a given shader
-	* @param entryNames The names of the main() functions of the shaders
-	*
-	* @return SkResult(created shader stage, GraphicsPipelineError)
-	*/
-	inline SkResult<std::vector<vk::PipelineShaderStageCreateInfo>, GraphicsPipelineError> createPipelineShaderStageCreateInfos(const std::vector<vk::ShaderStageFlagBits>& shaderStageFlags,
-		const std::vector<vk::ShaderModule>& shaderModules, const std::vector<std::string>& entryNames)
-	{
-		SkResult result(static_cast<std::vector<vk::PipelineShaderStageCreateInfo>>(std::vector<vk::PipelineShaderStageCreateInfo>()), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+		std::vector<ImportError> errors(meshCount, ImportError::NO_ERROR);
 
-		std::vector<vk::PipelineShaderStageCreateInfo> shaderStages;
-		shaderStages.reserve(shaderModules.size());
-		for (int i = 0; i < shaderModules.size(); i++)
+		threadPool.parallelFor(meshCount, [&](const size_t meshIndex)
 		{
-			auto createShaderStageResult = createPipelineShaderStageCreateInfo(shaderStageFlags[i], shaderModules[i], entryNames[i]);
-			shaderStages.emplace_back(retLog(createShaderStageResult));
-		}
+			MappedFile meshFile;
+			if (error(meshFile.open(getImportCacheFilename(cacheDirectory, key, "_" + std::to_string(meshIndex) + ".skmesh"))))
+			{
+				errors[meshIndex] = ImportError::CACHE_ERROR;
+				return;
+			}
 
-		result.value = std::move(shaderStages);
-		return result;
-	}
+			auto readMeshFileResult = readMeshFile(meshFile.getData(), meshFile.getSize());
+			if (error(readMeshFileResult))
+			{
+				errors[meshIndex] = ImportError::CACHE_ERROR;
+				return;
+			}
 
-	/*@brief Creates a vector of shader stages given a vulkan device, a vector of shader filenames, a vector of shader stage flags and a vector of shader entry names
-	*
-	* @param device The vulkan device used to create the shader stages(creation of the shader modules)
-	* @param shaderFilenames The shader filenames to be converted into shader modules
-	* @param shaderStageFlags The shader stage flags indicating if the given shaders are either vertex or fragment shaders
-	* @param entryNames
-	*
-	* @return SkResult(created vector of shader stages, GraphicsPipelineError)
-	*/
-	inline SkResult<std::vector<vk::PipelineShaderStageCreateInfo>, GraphicsPipelineError> createShaderStages(const vk::Device& device, const std::vector<std::string>& shaderFilenames,
-		const std::vector<vk::ShaderStageFlagBits>& shaderStageFlags, const std::vector<std::string>& entryNames)
-	{
-		SkResult result(static_cast<std::vector<vk::PipelineShaderStageCreateInfo>>(std::vector<vk::PipelineShaderStageCreateInfo>()), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+			const MeshFileView& view = readMeshFileResult.value;
+			ImportedMesh& importedMesh = meshes[meshIndex];
 
-		std::vector<vk::ShaderModule> shaderModules;
-		shaderModules.reserve(shaderFilenames.size());
+			importedMesh.mesh.vertices.resize(static_cast<size_t>(view.pHeader->vertices.count));
+			std::memcpy(importedMesh.mesh.vertices.data(), view.getVertexData(), static_cast<size_t>(view.getVertexDataSize()));
 
-		for (uint32_t i = 0; i < shaderFilenames.size(); i++)
-		{
-			auto shaderBufferResult = loadShaderFileInBuffer(shaderFilenames[i]);
-			std::vector<uint32_t> shaderBuffer = retLog(shaderBufferResult);
+			importedMesh.mesh.indices.resize(static_cast<size_t>(view.pHeader->indices.count));
+			for (size_t i = 0; i < importedMesh.mesh.indices.size(); i++)
+			{
+				if (view.pHeader->indexSize == sizeof(uint16_t))
+				{
+					uint16_t index = 0;
+					std::memcpy(&index, static_cast<const uint8_t*>(view.getIndexData()) + i * sizeof(uint16_t), sizeof(uint16_t));
+					importedMesh.mesh.indices[i] = index;
+				}
+				else
+				{
+					std::memcpy(&importedMesh.mesh.indices[i], static_cast<const uint8_t*>(view.getIndexData()) + i * sizeof(uint32_t), sizeof(uint32_t));
+				}
+			}
 
-			auto shaderModuleResult = createShaderModule(device, shaderBuffer);
-			vk::ShaderModule shaderModule = retLog(shaderModuleResult);
+			importedMesh.bounds.boundsMin = view.pHeader->boundsMin;
+			importedMesh.bounds.boundsMax = view.pHeader->boundsMax;
+			importedMesh.bounds.boundingSphere = view.pHeader->boundingSphere;
+		});
 
-			shaderModules.emplace_back(std::move(shaderModule));
+		for (const ImportError meshError : errors)
+		{
+			if (meshError != ImportError::NO_ERROR)
+			{
+				result.error = meshError;
+				return result;
+			}
 		}
 
-		auto createPipelineShaderStageCreateInfosResult = createPipelineShaderStageCreateInfos(shaderStageFlags, shaderModules, entryNames);
-		result.error = affectError(createPipelineShaderStageCreateInfosResult, result.error);
-		std::vector<vk::PipelineShaderStageCreateInfo> pipelineShaderStageCreateInfos = retLog(createPipelineShaderStageCreateInfosResult);
-
-		result.value = std::move(pipelineShaderStageCreateInfos);
+		result.value = std::move(meshes);
 		return result;
 	}
 
-	/*@brief Creates a vertex input state containing given input bindings and given input attributes
+	/*@brief Writes imported meshes into the import cache, the manifest being written last so that an interrupted write is never read back
 	*
-	* @param vertexInputBindingDescriptions vector of input binding descriptions
-	* @param vertexInputAttributeDescriptions vector of input attribute descriptions
+	* @param cacheDirectory The directory holding the cache, created if needed
+	* @param key The content hash of the source asset
+	* @param meshes The imported meshes
+	* @param threadPool The thread pool writing the mesh files
 	*
-	* @return SkResult(created vertex input state, GraphicsPipelineError)
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), ImportError)
 	*/
-	inline SkResult<vk::PipelineVertexInputStateCreateInfo, GraphicsPipelineError> createPipelineVertexInputStateCreateInfo(const std::vector<vk::VertexInputBindingDescription>& vertexInputBindingDescriptions,
-		const std::vector<vk::VertexInputAttributeDescription>& vertexInputAttributeDescriptions)
+	inline SkResult<bool, ImportError> writeImportCache(const std::string_view cacheDirectory, const uint64_t key, const std::vector<ImportedMesh>& meshes, ThreadPool& threadPool)
 	{
-		SkResult result(static_cast<vk::PipelineVertexInputStateCreateInfo>(vk::PipelineVertexInputStateCreateInfo{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));;
+		SkResult result(static_cast<bool>(false), static_cast<ImportError>(ImportError::NO_ERROR));
 
-		vk::PipelineVertexInputStateCreateInfo pipelineVertexInputStateCreateInfo = {};
-		try
+		std::error_code errorCode;
+		std::filesystem::create_directories(std::filesystem::path(cacheDirectory), errorCode);
+
+		std::atomic<bool> isWritten{ true };
+		threadPool.parallelFor(meshes.size(), [&](const size_t meshIndex)
 		{
-			pipelineVertexInputStateCreateInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(vertexInputBindingDescriptions.size());
-			pipelineVertexInputStateCreateInfo.pVertexBindingDescriptions = vertexInputBindingDescriptions.data();
+			auto writeMeshFileResult = writeMeshFile(getImportCacheFilename(cacheDirectory, key, "_" + std::to_string(meshIndex) + ".skmesh"), meshes[meshIndex].mesh);
+			if (error(writeMeshFileResult))
+			{
+				isWritten = false;
+			}
+		});
 
-			pipelineVertexInputStateCreateInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(vertexInputAttributeDescriptions.size());
-			pipelineVertexInputStateCreateInfo.pVertexAttributeDescriptions = vertexInputAttributeDescriptions.data();
-		}
-		catch (vk::SystemError err)
+		std::ofstream manifest(getImportCacheFilename(cacheDirectory, key, ".skmeshes"), std::ios::trunc);
+		if (!isWritten || !manifest.is_open())
 		{
-			result.error = GraphicsPipelineError::PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO_ERROR;
+			result.error = ImportError::CACHE_ERROR;
+			return result;
 		}
 
-		result.value = std::move(pipelineVertexInputStateCreateInfo);
-		return result;
-	}
-
-	/*@brief Creates an input assembly state containing a given primitive topology
-	*
-	* @param primitiveTopology the primitive topology (point, line list/strip, triangle list/strip) to be used in the pipeline
-	*
-	* @return SkResult(created assembly state, GraphicsPipelineError)
-	*/
-	inline SkResult<vk::PipelineInputAssemblyStateCreateInfo, GraphicsPipelineError> createPipelineInputAssemblyStateCreateInfo(const vk::PrimitiveTopology primitiveTopology)
-	{
-		SkResult result(static_cast<vk::PipelineInputAssemblyStateCreateInfo>(vk::PipelineInputAssemblyStateCreateInfo{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
-
-		vk::PipelineInputAssemblyStateCreateInfo pipelineInputAssemblyStateCreateInfo = {};
-		try
+		manifest << meshes.size() << '\n';
+		for (const auto& mesh : meshes)
 		{
-			pipelineInputAssemblyStateCreateInfo.topology = primitiveTopology;
-			pipelineInputAssemblyStateCreateInfo.primitiveRestartEnable = VK_FALSE;
+			//One line per mesh, the names being escaped
+			manifest << escapeImportCacheName(mesh.name) << '\n';
 		}
-		catch (vk::SystemError err)
+
+		if (!manifest.good())
 		{
-			result.error = GraphicsPipelineError::PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO_ERROR;
+			result.error = ImportError::CACHE_ERROR;
+			return result;
 		}
 
-		result.value = std::move(pipelineInputAssemblyStateCreateInfo);
+		result.value = true;
 		return result;
 	}
 
-	/*@brief Creates a rasterization state containg a given polygonMode
+	/*@brief Imports every mesh of an asset file (.obj, .gltf or .glb, chosen by extension).
+	* With a cache directory, the meshes are cached as mesh files keyed by the hash of the asset content (buffers included) :
+	* loading an unchanged asset again only hashes it and maps the cached mesh files
 	*
-	* @param polygonMode The polygon mode to be used (fill, line, point) in the pipeline
+	* @param filename The name of the asset file
+	* @param threadPool The thread pool building the meshes
+	* @param cacheDirectory The directory of the import cache, no cache being used if empty
 	*
-	* @return SkResult(created rasterization state, GraphicsPipelineError)
+	* @return SkResult(imported meshes, ImportError)
 	*/
-	inline SkResult<vk::PipelineRasterizationStateCreateInfo, GraphicsPipelineError> createPipelineRasterizationStateCreateInfo(const vk::PolygonMode polygonMode)
+	inline SkResult<std::vector<ImportedMesh>, ImportError> importMeshes(const std::string_view filename, ThreadPool& threadPool, const std::string_view cacheDirectory = {})
 	{
-		SkResult result(static_cast<vk::PipelineRasterizationStateCreateInfo>(vk::PipelineRasterizationStateCreateInfo{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+		SkResult result(static_cast<std::vector<ImportedMesh>>(std::vector<ImportedMesh>()), static_cast<ImportError>(ImportError::NO_ERROR));
 
-		vk::PipelineRasterizationStateCreateInfo pipelineRasterizationStateCreateInfo = {};
-		try
-		{
-			pipelineRasterizationStateCreateInfo.depthClampEnable = VK_FALSE;
-			pipelineRasterizationStateCreateInfo.rasterizerDiscardEnable = VK_FALSE;
+		std::string extension = std::filesystem::path(filename).extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](const char character) { return static_cast<char>(std::tolower(static_cast<unsigned char>(character))); });
 
-			pipelineRasterizationStateCreateInfo.polygonMode = polygonMode;
-			pipelineRasterizationStateCreateInfo.lineWidth = 1.0f;
+		//Kept alive until the meshes are built, the OBJ text and glTF buffers being read in place
+		MappedFile objFile;
+		GltfAsset gltfAsset;
+		uint64_t key = 0;
 
-			pipelineRasterizationStateCreateInfo.cullMode = vk::CullModeFlagBits::eNone;
-			pipelineRasterizationStateCreateInfo.frontFace = vk::FrontFace::eClockwise;
+		if (extension == ".obj")
+		{
+			if (error(objFile.open(filename)))
+			{
+				result.error = ImportError::FILE_OPENING_ERROR;
+				return result;
+			}
 
-			pipelineRasterizationStateCreateInfo.depthBiasEnable = VK_FALSE;
-			pipelineRasterizationStateCreateInfo.depthBiasConstantFactor = 0.0f;
-			pipelineRasterizationStateCreateInfo.depthBiasClamp = 0.0f;
-			pipelineRasterizationStateCreateInfo.depthBiasSlopeFactor = 0.0f;
+			key = hashBytes(objFile.getData(), objFile.getSize());
 		}
-		catch (vk::SystemError err)
+		else if (extension == ".gltf" || extension == ".glb")
 		{
-			result.error = GraphicsPipelineError::PIPELINE_RASTERIZATION_STATE_CREATE_INFO_ERROR;
-		}
-
-		result.value = std::move(pipelineRasterizationStateCreateInfo);
-		return result;
-	}
-
-	/*@brief Creates a multisample state
-	*
-	* @param sampleShadingEnabled Is sample shading enabled ?
-	* @param sampleCountFlag Flags to be used if sample shading is enabled
-	*
-	* @return SkResult(created multisample state, GraphicsPipelineError)
-	*/
-	inline SkResult<vk::PipelineMultisampleStateCreateInfo, GraphicsPipelineError> createPipelineMultisampleStateCreateInfo(bool sampleShadingEnabled = false,
-		vk::SampleCountFlagBits sampleCountFlag = vk::SampleCountFlagBits::e1)
-	{
-		SkResult result(static_cast<vk::PipelineMultisampleStateCreateInfo>(vk::PipelineMultisampleStateCreateInfo{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+			auto loadGltfResult = loadGltf(filename);
+			if (error(loadGltfResult))
+			{
+				result.error = loadGltfResult.error;
+				return result;
+			}
 
-		vk::PipelineMultisampleStateCreateInfo pipelineMultisampleStateCreateInfo = {};
-		try
+			gltfAsset = std::move(loadGltfResult.value);
+			key = gltfAsset.contentHash;
+		}
+		else
 		{
-			if (sampleShadingEnabled)
-			{
-				pipelineMultisampleStateCreateInfo.sampleShadingEnable = VK_TRUE;
-				pipelineMultisampleStateCreateInfo.rasterizationSamples = sampleCountFlag;
+			result.error = ImportError::UNSUPPORTED_FORMAT_ERROR;
+			return result;
+		}
 
-			}
-			else
+		if (!cacheDirectory.empty())
+		{
+			auto readImportCacheResult = readImportCache(cacheDirectory, key, threadPool);
+			if (!error(readImportCacheResult))
 			{
-				pipelineMultisampleStateCreateInfo.sampleShadingEnable = VK_FALSE;
-				pipelineMultisampleStateCreateInfo.rasterizationSamples = vk::SampleCountFlagBits::e1;
+				result.value = std::move(readImportCacheResult.value);
+				return result;
 			}
+		}
 
-			pipelineMultisampleStateCreateInfo.minSampleShading = 1.0f;
-			pipelineMultisampleStateCreateInfo.pSampleMask = nullptr;
-
-			pipelineMultisampleStateCreateInfo.alphaToCoverageEnable = VK_FALSE;
-			pipelineMultisampleStateCreateInfo.alphaToOneEnable = VK_FALSE;
+		auto importResult = (objFile.getData() != nullptr ? importObj(objFile.getData(), objFile.getSize(), threadPool) : importGltf(gltfAsset, threadPool));
+		if (error(importResult))
+		{
+			result.error = importResult.error;
+			return result;
 		}
-		catch (vk::SystemError err)
+
+		//A cache that can not be written only costs the next import its fast path
+		if (!cacheDirectory.empty())
 		{
-			result.error = GraphicsPipelineError::PIPELINE_MULTISAMPLE_STATE_CREATE_INFO_ERROR;
+			logError(writeImportCache(cacheDirectory, key, importResult.value, threadPool));
 		}
 
-		result.value = std::move(pipelineMultisampleStateCreateInfo);
+		result.value = std::move(importResult.value);
 		return result;
 	}
 
-	/*@brief Creates a viewport according to a given extent
-	*
-	* @param extent The vulkan 2D extent to be used in the creation of the viewport
-	*
-	* @return SkResult(created viewport, GraphicsPipelineError)
+	/*GLFW
+	* Main functions concerning init and terminate, window creation.
 	*/
-	inline SkResult<vk::Viewport, GraphicsPipelineError> createViewport(const vk::Extent2D& extent)
+
+	/**
+		* @brief Initializes GLFW, must be called before any GLFW operation.
+		*
+		* @return SkResult(Result from glfwInit(), GLFWError)
+		*/
+	inline SkResult<uint32_t, GLFWError> initGlfw() noexcept
 	{
-		SkResult result(static_cast<vk::Viewport>(vk::Viewport{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+		SkResult result(static_cast<uint32_t>(glfwInit()), static_cast<GLFWError>(GLFWError::NO_ERROR));
 
-		vk::Viewport viewport = {};
-		try
+		if (!result.value)
 		{
-			viewport.x = 0.0f;
-			viewport.y = 0.0f;
-
-			viewport.width = static_cast<float>(extent.width);
-			viewport.height = static_cast<float>(extent.height);
+			result.error = GLFWError::INIT_ERROR;
 
-			viewport.minDepth = 0.0f;
-			viewport.maxDepth = 1.0f;
 		}
-		catch (vk::SystemError err)
+		else
 		{
-			result.error = GraphicsPipelineError::VIEWPORT_CREATION_ERROR;
+			glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
 		}
 
-		result.value = std::move(viewport);
 		return result;
 	}
 
-	/*@brief Creates a scissor according to a given extent
-	*
-	* @param extent The vulkan 2D extent to be used to create the scissor
-	*
-	* @return SkResult(created scissor, GraphicsPipelineError)
-	*/
-	inline SkResult<vk::Rect2D, GraphicsPipelineError> createScissor(const vk::Extent2D& extent)
+	/**
+		* @brief Terminates glfw.
+		*
+		* @return SkResult(bool signaling if the operation worked or not, GLFWError)
+		*/
+	inline SkResult<bool, GLFWError> terminateGlfw() noexcept
 	{
-		SkResult result(static_cast<vk::Rect2D>(vk::Rect2D{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
-
+		SkResult result(static_cast<bool>(true), static_cast<GLFWError>(GLFWError::NO_ERROR));
 
-		vk::Rect2D scissor = {};
-		try
-		{
-			scissor.offset = vk::Offset2D{ 0, 0 };
-			scissor.extent = extent;
-		}
-		catch (vk::SystemError err)
-		{
-			result.error = GraphicsPipelineError::SCISSOR_CREATION_ERROR;
-		}
+		glfwTerminate();
 
-		result.value = std::move(scissor);
 		return result;
 	}
 
-	/*@brief Creates a viewport state containing given viewports and given scissors
-	*
-	* @param viewports The vector of vulkan viewports to be used in the pipeline
-	* @param scissors The vector of vulkan scissors to be used in the pipeline
-	*
-	* @return SkResult(created viewport state, GraphicsPipelineError)
-	*/
-	inline SkResult<vk::PipelineViewportStateCreateInfo, GraphicsPipelineError> createPipelineViewportStateCreateInfo(const std::vector<vk::Viewport>& viewports, const std::vector<vk::Rect2D>& scissors)
-	{
-		vk::PipelineViewportStateCreateInfo value = vk::PipelineViewportStateCreateInfo{};
-		GraphicsPipelineError error = GraphicsPipelineError::NO_ERROR;
+	/**
+		* @brief Creates a GLFW Window, must be called after init().
+		*
+		* @param width : Sets the width in pixel
+		* @param height : Sets the height in pixel
+		* @param title : Sets the title of the GLFW window
+		* @param resizable : Sets if the window should be resizable or not
+		*
+		* @return inline SkResult<Pointer to the GLFW window, GLFWError>
+		*
+		*/
+	inline SkResult<GLFWwindow*, GLFWError> createGlfwWindow(const uint32_t width, const uint32_t height, std::string_view title, bool resizable) noexcept
+	{
+		SkResult result(static_cast<GLFWwindow*>(nullptr), static_cast<GLFWError>(GLFWError::NO_ERROR));
 
-		vk::PipelineViewportStateCreateInfo pipelineViewportStateCreateInfo = {};
-		pipelineViewportStateCreateInfo.viewportCount = static_cast<uint32_t>(viewports.size());
-		pipelineViewportStateCreateInfo.pViewports = viewports.data();
+		if (resizable)
+		{
+			glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
+		}
+		else
+		{
+			glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+		}
 
-		pipelineViewportStateCreateInfo.scissorCount = static_cast<uint32_t>(scissors.size());
-		pipelineViewportStateCreateInfo.pScissors = scissors.data();
+		result.value = glfwCreateWindow(width, height, std::string(title).c_str(), 0, nullptr);
 
-		value = pipelineViewportStateCreateInfo;
-		return SkResult(value, error); // Error seems to be after returning this, value is corrupted
+		if (result.value == nullptr)
+		{
+			result.error = std::move(GLFWError::WINDOW_CREATION_ERROR);
+		}
+
+		return result;
 	}
 
-	/*@brief Creates a color blend attachment state
+	inline SkResult<GLFWwindow*, GLFWError> createWindow(const uint32_t width, const uint32_t height, std::string_view title, bool resizable) noexcept
+	{
+		SkResult result(static_cast<GLFWwindow*>(nullptr), static_cast<GLFWError>(GLFWError::NO_ERROR));
+
+		auto initGlfwResult = initGlfw();
+		result.error = affectError(initGlfwResult, result.error);
+
+		auto createGlfwWindowResult = createGlfwWindow(width, height, title, resizable);
+		result.error = affectError(createGlfwWindowResult, result.error);
+		result.value = retLog(createGlfwWindowResult);
+
+		return result;
+	}
+
+	/*DEBUG UTILS
+	 *Useful functions concerning the debug utils messenger from vulkan.
+	 * @TODO : Clean up all that ugly stuff
+	 */
+
+	 /*
+	 * @brief Override of a vulkan function to print vulkan messages directly to a file. Is the default debugCallback if none are given at instance creation time.
+	 */
+	inline static VKAPI_ATTR VkBool32 VKAPI_CALL debugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
+		VkDebugUtilsMessageTypeFlagsEXT messageType,
+		const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData,
+		void* pUserData)
+	{
+		std::ofstream debugFile;
+		debugFile.open("debugCallbackOutput.txt", std::ios::app);
+
+		switch (messageSeverity)
+		{
+		case VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT:
+			debugFile << "VERB : " << pCallbackData->pMessage << "\n";
+			break;
+
+		case VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT:
+			debugFile << "INFO : " << pCallbackData->pMessage << "\n";
+			break;
+
+		case VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT:
+			debugFile << "WARN : " << pCallbackData->pMessage << "\n";
+			break;
+
+		case VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT:
+			debugFile << "ERRO : " << pCallbackData->pMessage << "\n";
+			break;
+
+
+		}
+
+		return VK_FALSE;
+	}
+
+	/*
+	* @brief Calls a vulkan function via a function pointer to create the debugUtilsMessenger
+	*/
+	inline VkResult CreateDebugUtilsMessengerEXT(VkInstance instance, const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugUtilsMessengerEXT* pCallback) noexcept
+	{
+		auto func = (PFN_vkCreateDebugUtilsMessengerEXT)vkGetInstanceProcAddr(instance, "vkCreateDebugUtilsMessengerEXT");
+		if (func != nullptr) {
+			return func(instance, pCreateInfo, pAllocator, pCallback);
+		}
+		else {
+			return VK_ERROR_EXTENSION_NOT_PRESENT;
+		}
+	}
+
+	/*
+	* @brief Calls a vulkan function via a function pointer to destroy the debugUtilsMessenger
+	*/
+	inline void DestroyDebugUtilsMessengerEXT(VkInstance instance, VkDebugUtilsMessengerEXT callback, const VkAllocationCallbacks* pAllocator) noexcept
+	{
+		auto func = (PFN_vkDestroyDebugUtilsMessengerEXT)vkGetInstanceProcAddr(instance, "vkDestroyDebugUtilsMessengerEXT");
+		if (func != nullptr) {
+			func(instance, callback, pAllocator);
+		}
+	}
+
+	/*
+	* @brief Creates a DebugUtilsMessengerCreateInfo with the basic information including the messageSeverity and MessageType Flags
 	*
-	* @param colorWriteMask The color write mask to be used in the pipeline
-	* @param blendEnabled Is blend enabled ?
+	* @param debugCallback The debug callback to be used in the the debug utils messenger
 	*
-	* @return SkResult(created color blend attachment state, GraphicsPipelineError)
+	* @return DebugUtilsMessengerCreateInfo
 	*/
-	inline SkResult<vk::PipelineColorBlendAttachmentState, GraphicsPipelineError> createPipelineColorBlendAttachmentState(vk::Flags<vk::ColorComponentFlagBits> colorWriteMask = (vk::ColorComponentFlagBits::eR |
-		vk::ColorComponentFlagBits::eG |
-		vk::ColorComponentFlagBits::eG |
-		vk::ColorComponentFlagBits::eA),
-		bool blendEnabled = false)
+	inline SkResult<vk::DebugUtilsMessengerCreateInfoEXT, DebugUtilsError> createDebugUtilsMessengerCreateInfo(PFN_vkDebugUtilsMessengerCallbackEXT debugCallback)
 	{
-		SkResult result(static_cast<vk::PipelineColorBlendAttachmentState>(vk::PipelineColorBlendAttachmentState{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+		SkResult result(static_cast<vk::DebugUtilsMessengerCreateInfoEXT>(vk::DebugUtilsMessengerCreateInfoEXT{}), static_cast<DebugUtilsError>(DebugUtilsError::NO_ERROR));
 
-		vk::PipelineColorBlendAttachmentState pipelineColorBlendAttachmentState = {};
 		try
 		{
-			pipelineColorBlendAttachmentState.colorWriteMask = colorWriteMask;
-			pipelineColorBlendAttachmentState.blendEnable = blendEnabled ? VK_TRUE : VK_FALSE;
+			result.value = vk::DebugUtilsMessengerCreateInfoEXT(vk::DebugUtilsMessengerCreateFlagsEXT(),
+				vk::DebugUtilsMessageSeverityFlagBitsEXT::eVerbose | vk::DebugUtilsMessageSeverityFlagBitsEXT::eWarning | vk::DebugUtilsMessageSeverityFlagBitsEXT::eError,
+				vk::DebugUtilsMessageTypeFlagBitsEXT::eGeneral | vk::DebugUtilsMessageTypeFlagBitsEXT::eValidation | vk::DebugUtilsMessageTypeFlagBitsEXT::ePerformance,
+				debugCallback,
+				nullptr);
 		}
 		catch (vk::SystemError err)
 		{
-			result.error = GraphicsPipelineError::PIPELINE_COLOR_BLEND_ATTACHMENT_STATE_ERROR;
+			result.error = std::move(DebugUtilsError::DEBUG_CALLBACK_CI_ERROR);
 		}
 
-		result.value = std::move(pipelineColorBlendAttachmentState);
 		return result;
 	}
 
-	/*@brief Creates a color blend state given color blend attachments
+	/*@brief Creates a debug utils messenger via CreateDebugUtilsMessengerEXT()
 	*
-	* @param colorBlendAttachments The vector of color blend attachments to be used in the pipeline
+	* @param instance The vulkan instance used to create the debug utils messenger
+	* @param debugUtilsMessengerCreateInfo The create info to be used for creating the debug utils messenger
 	*
-	* @return SkResult(created color blend state, GraphicsPipelineError)
+	* @return SkResult(boolean indicating if the operation worked(true) or not(false), DebugUtilsError)
 	*/
-	inline SkResult<vk::PipelineColorBlendStateCreateInfo, GraphicsPipelineError> createPipelineColorBlendStateCreateInfo(const std::vector<vk::PipelineColorBlendAttachmentState>& colorBlendAttachments)
+	inline SkResult<bool, DebugUtilsError> createDebugUtilsMessenger(vk::Instance instance, VkDebugUtilsMessengerCreateInfoEXT* debugUtilsMessengerCreateInfo)
 	{
-		SkResult result(static_cast<vk::PipelineColorBlendStateCreateInfo>(vk::PipelineColorBlendStateCreateInfo{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+		SkResult result(static_cast<bool>(true), static_cast<DebugUtilsError>(DebugUtilsError::NO_ERROR));
 
-		vk::PipelineColorBlendStateCreateInfo pipelineColorBlendStateCreateInfo{};
 		try
 		{
-			pipelineColorBlendStateCreateInfo.logicOpEnable = VK_FALSE;
-			pipelineColorBlendStateCreateInfo.logicOp = vk::LogicOp::eCopy;
-
-			pipelineColorBlendStateCreateInfo.attachmentCount = static_cast<uint32_t>(colorBlendAttachments.size());
-			pipelineColorBlendStateCreateInfo.pAttachments = colorBlendAttachments.data();
+			CreateDebugUtilsMessengerEXT(instance, debugUtilsMessengerCreateInfo, nullptr, nullptr);
 		}
 		catch (vk::SystemError err)
 		{
-			result.error = GraphicsPipelineError::PIPELINE_COLOR_BLEND_STATE_CREATE_INFO_ERROR;
+			result.value = false;
+			result.error = DebugUtilsError::DEBUG_CALLBACK_CREATION_ERROR;
 		}
 
-		result.value = std::move(pipelineColorBlendStateCreateInfo);
 		return result;
 	}
 
-	/*@brief Creates a pipeline layout with a given device
+	/*Instance*/
+
+	/*
+	* @brief Gets the required extensions from glfwGetRequiredInstanceExtensions()
 	*
-	* @param device The vulkan device used to create the pipeline layout
+	* @param validationEnabled Are the validation layers enabled or not, if they are then the DebugUtils extension is added to the list of required extensions
 	*
-	* @return SkResult(created pipeline layout, GraphicsPipelineError)
+	* @return SkResult(List of extension names, InstanceError)
 	*/
-	inline SkResult<vk::PipelineLayout, GraphicsPipelineError> createPipelineLayout(const vk::Device& device)
+	inline SkResult<std::vector<const char*>, InstanceError> getRequiredInstanceExtensions(bool validationEnabled) noexcept
 	{
-		SkResult result(static_cast<vk::PipelineLayout>(vk::PipelineLayout(nullptr)), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+		SkResult result(static_cast<std::vector<const char*>>(std::vector<const char*>()), static_cast<InstanceError>(InstanceError::NO_ERROR));
 
-		vk::PipelineLayoutCreateInfo pipelineLayoutCreateInfo = {};
-		try
-		{
-			pipelineLayoutCreateInfo.setLayoutCount = 0;
-			pipelineLayoutCreateInfo.pSetLayouts = nullptr;
+		uint32_t glfwExtensionCount = 0;
+		const char** ppGlfwExtensions = nullptr;
 
-			pipelineLayoutCreateInfo.pushConstantRangeCount = 0;
-			pipelineLayoutCreateInfo.pPushConstantRanges = nullptr;
-		}
-		catch (vk::SystemError err)
+		ppGlfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+		if (glfwExtensionCount == 0 || ppGlfwExtensions == nullptr)
 		{
-			result.error = GraphicsPipelineError::PIPELINE_LAYOUT_CREATE_INFO_ERROR;
+			result.error = InstanceError::GET_REQUIRED_INSTANCE_EXTENSIONS_ERROR;
 		}
 
-		vk::PipelineLayout pipelineLayout = vk::PipelineLayout(nullptr);
-		try
-		{
-			pipelineLayout = device.createPipelineLayout(pipelineLayoutCreateInfo);
-		}
-		catch (vk::SystemError err)
+		auto extensions = std::vector<const char*>(ppGlfwExtensions, ppGlfwExtensions + glfwExtensionCount);
+		if (validationEnabled)
 		{
-			result.error = GraphicsPipelineError::PIPELINE_LAYOUT_CREATION_ERROR;
+			extensions.emplace_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
 		}
 
-		result.value = pipelineLayout;
+		result.value = std::move(extensions);
 		return result;
 	}
 
-	/*@brief Destroys a given pipeline layout with a given device
+	/*
+	* @brief Creates a vulkan ApplicationInfo.
 	*
-	* @param device The vulkan device used to destroy the given pipeline layout
-	* @param pipelineLayout The vulkan pipeline layout to be destroyed
+	* Any error is stored in the instanceError variable
 	*
-	* @return SkResult(boolean indicating if the operation worked(true) or not(false), GraphicsPipelineError)
+	* @param pApplicationName Application name
+	* @param pEngineName Engine name
+	* @param apiVersion The vulkan version used by the application (default is 1.0, 1.2 is needed for drawIndexedIndirectCount())
+	*
+	* @return SkResult(application info, InstanceError)
 	*/
-	inline SkResult<bool, GraphicsPipelineError> destroyPipelineLayout(const vk::Device& device, const vk::PipelineLayout& pipelineLayout)
+	inline SkResult<vk::ApplicationInfo, InstanceError> createApplicationInfo(const std::string_view appName, const std::string_view engineName, const uint32_t apiVersion = VK_API_VERSION_1_0) noexcept
 	{
-		SkResult result(static_cast<bool>(true), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+		SkResult result(static_cast<vk::ApplicationInfo>(vk::ApplicationInfo{}), static_cast<InstanceError>(InstanceError::NO_ERROR));
 
 		try
 		{
-			device.destroyPipelineLayout(pipelineLayout);
+			result.value = vk::ApplicationInfo(std::string(appName).c_str(),
+				                               VK_MAKE_VERSION(1, 0, 0),
+				                               std::string(engineName).c_str(),
+				                               VK_MAKE_VERSION(1, 0, 0),
+				                               apiVersion);
 		}
-		catch (vk::SystemError error)
+		catch (vk::SystemError err)
 		{
-			result.value = false;
-			result.error = GraphicsPipelineError::PIPELINE_LAYOUT_DESTRUCTION_ERROR;
+			result.error = InstanceError::APPLICATION_INFO_CREATION_ERROR;
 		}
 
 		return result;
 	}
 
-	/*@brief Creates a basic graphics pipeline according to the given parameters
+	/*
+	* @brief Creates a vulkan Instance.
 	*
-	* @param device The vulkan device ordered to create the graphics pipeline
-	* @param renderPass The vulkan render pass to be used in the graphics pipeline
-	* @param pipelineLayout The vulkan pipeline layout to be used in the graphics pipeline
-	* @param extent The vulkan extent to be used in the graphics pipeline
-	* @param shaderStageFlags The vulkan shader stage flags to be used in the graphics pipeline
-	* @param shaderModules The vulkan shader modules to be used in the graphics pipeline
-	* @param entryNames The vulkan entry names to be used for the shaders in the graphics pipeline
-	* @param vertexInputBindingDescriptions The vulkan vertex input binding descriptions to be used in the graphics pipeline
-	* @param vertexInputAttributeDescriptions The vulkan vertex input attribute descriptions to be used in the graphics pipeline
-	* @param primitiveTopology The vulkan primitive topology to be used in the graphics pipeline
-	* @param polygonMode The vulkan polygon mode to be used in the graphics pipeline
-	* @param sampleShadingEnabled Is sample shading enabled in the graphics pipeline
-	* @param sampleCountFlag The sample count to be used in the graphics pipeline
-	* @param colorWriteMask The vulkan color write mask to be used in the graphics pipeline
-	* @param blendEnabled Is blend enabled in the graphics pipeline
+	* Any error is stored in the instanceError variable
 	*
-	* @return SkResult(created graphics pipeline, GraphicsPipelineError)
+	* @param applicationInfo A vulkan applicationInfo
+	* @param extensions List of extension names (default is an empty vector of char*)
+	* @param validationLayers List of validation layer names (default is an empty vector of char*)
+	* @param debugCallback debugCallback (default is nullptr)
+	*
+	* @return SkResult(vulkan instance, InstanceError)
 	*/
-	inline SkResult<vk::Pipeline, GraphicsPipelineError> createGraphicsPipeline(const vk::Device& device, const vk::RenderPass& renderPass, const vk::PipelineLayout& pipelineLayout, const vk::Extent2D& extent,
-		                                                                        const std::vector<vk::ShaderStageFlagBits>& shaderStageFlags, const std::vector<vk::ShaderModule>& shaderModules, const std::vector<std::string>& entryNames,
-		                                                                        std::vector<vk::VertexInputBindingDescription> vertexInputBindingDescriptions = std::vector<vk::VertexInputBindingDescription>(),
-		                                                                        std::vector<vk::VertexInputAttributeDescription> vertexInputAttributeDescriptions = std::vector<vk::VertexInputAttributeDescription>(),
-		                                                                        vk::PrimitiveTopology primitiveTopology = vk::PrimitiveTopology::eTriangleList, vk::PolygonMode polygonMode = vk::PolygonMode::eFill,
-		                                                                        bool sampleShadingEnabled = false, vk::SampleCountFlagBits sampleCountFlag = vk::SampleCountFlagBits::e1,
-		                                                                        vk::Flags<vk::ColorComponentFlagBits> colorWriteMask = (vk::ColorComponentFlagBits::eR |
-		                                                                        	                                                    vk::ColorComponentFlagBits::eG |
-		                                                                        	                                                    vk::ColorComponentFlagBits::eG |
-		                                                                        	                                                    vk::ColorComponentFlagBits::eA),
-		                                                                        bool blendEnabled = false)
+	inline SkResult<vk::Instance, InstanceError> createInstance(const vk::ApplicationInfo& applicationInfo, std::vector<const char*> extensions = std::vector<const char*>(), const std::vector<const char*>& validationLayers = std::vector<const char*>(),
+		const PFN_vkDebugUtilsMessengerCallbackEXT debugUtilsMessenger = nullptr)
 	{
-		SkResult result(static_cast<vk::Pipeline>(vk::Pipeline(nullptr)), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
-
-		//Shader stages
-		auto createPipelineShaderStageCreateInfosResult = createPipelineShaderStageCreateInfos(shaderStageFlags, shaderModules, entryNames);
-		result.error = affectError(createPipelineShaderStageCreateInfosResult, result.error);
-		std::vector<vk::PipelineShaderStageCreateInfo> shaderStages = retLog(createPipelineShaderStageCreateInfosResult);
+		SkResult result(static_cast<vk::Instance>(vk::Instance(nullptr)), static_cast<InstanceError>(InstanceError::NO_ERROR));
 
-		//Vertex input
-		auto createPipelineVertexInputStateCreateInfoResult = createPipelineVertexInputStateCreateInfo(vertexInputBindingDescriptions, vertexInputAttributeDescriptions);
-		result.error = affectError(createPipelineVertexInputStateCreateInfoResult, result.error);
-		vk::PipelineVertexInputStateCreateInfo vertexInputState = retLog(createPipelineVertexInputStateCreateInfoResult);
+		if (extensions.empty())
+		{
+			if (!validationLayers.empty())
+			{
+				auto getRequiredExtensionsResult = getRequiredInstanceExtensions(true);
+				result.error = std::move(affectError(getRequiredExtensionsResult, result.error));
 
-		//Input assembly
-		auto createPipelineInputAssemblyStateCreateInfoResult = createPipelineInputAssemblyStateCreateInfo(primitiveTopology);
-		result.error = affectError(createPipelineInputAssemblyStateCreateInfoResult, result.error);
-		vk::PipelineInputAssemblyStateCreateInfo inputAssemblyState = retLog(createPipelineInputAssemblyStateCreateInfoResult);
+				extensions = retLog(getRequiredExtensionsResult);
+			}
+			else
+			{
+				auto getRequiredExtensionsResult = getRequiredInstanceExtensions(false);
+				result.error = std::move(affectError(getRequiredExtensionsResult, result.error));
 
-		//Viewport
-		auto createViewportResult = createViewport(extent);
-		result.error = affectError(createViewportResult, result.error);
-		vk::Viewport viewport = retLog(createViewportResult);
+				extensions = retLog(getRequiredExtensionsResult);
+			}
+		}
 
-		auto createScissorResult = createScissor(extent);
-		result.error = affectError(createScissorResult, result.error);
-		vk::Rect2D scissor = retLog(createScissorResult);
+		auto instanceCreateInfo = std::move(vk::InstanceCreateInfo(vk::InstanceCreateFlags(),
+			&applicationInfo,
+			static_cast<uint32_t>(validationLayers.size()),
+			validationLayers.data(),
+			static_cast<uint32_t>(extensions.size()),
+			extensions.data()));
 
-		std::vector<vk::Viewport> viewports = { viewport };
-		std::vector<vk::Rect2D> scissors = { scissor };
-		auto createPipelineViewportStateCreateInfoResult = createPipelineViewportStateCreateInfo(viewports, scissors);
-		result.error = affectError(createPipelineViewportStateCreateInfoResult, result.error);
-		vk::PipelineViewportStateCreateInfo viewportState = retLog(createPipelineViewportStateCreateInfoResult);
 
-		//Rasterization
-		auto createPipelineRasterizationStateCreateInfoResult = createPipelineRasterizationStateCreateInfo(polygonMode);
-		result.error = affectError(createPipelineRasterizationStateCreateInfoResult, result.error);
-		vk::PipelineRasterizationStateCreateInfo rasterizationState = retLog(createPipelineRasterizationStateCreateInfoResult);
+		vk::DebugUtilsMessengerCreateInfoEXT debugUtilsMessengerCreateInfo = {};
 
-		//Multisample
-		auto createPipelineMultisampleStateCreateInfoResult = createPipelineMultisampleStateCreateInfo();
-		result.error = affectError(createPipelineMultisampleStateCreateInfoResult, result.error);
-		vk::PipelineMultisampleStateCreateInfo multisampleState = retLog(createPipelineMultisampleStateCreateInfoResult);
+		auto createDebugUtilsMessengerCreateInfoResult = std::move(createDebugUtilsMessengerCreateInfo(debugCallback));
+		debugUtilsMessengerCreateInfo = std::move(retLog(createDebugUtilsMessengerCreateInfoResult));
 
-		//Color blend
-		auto createPipelineColorBlendAttachmentStateResult = createPipelineColorBlendAttachmentState();
-		result.error = affectError(createPipelineColorBlendAttachmentStateResult, result.error);
-		vk::PipelineColorBlendAttachmentState colorBlendAttachmentState = retLog(createPipelineColorBlendAttachmentStateResult);
+		//Doesn't work for now
+		//if (debugCallback == nullptr && !validationLayers.empty())
+		//{
+		//	auto createDebugUtilsMessengerCreateInfoResult = createDebugUtilsMessengerCreateInfo(debugCallback);
+		//	debugUtilsMessengerCreateInfo = retLog(createDebugUtilsMessengerCreateInfoResult);
+		//
+		//	debugUtilsMessengerCreateInfo.pfnUserCallback = debugCallback;
+		//}
+		//else if (debugCallback != nullptr && !validationLayers.empty())
+		//{
+		//	auto createDebugUtilsMessengerCreateInfoResult = createDebugUtilsMessengerCreateInfo(debugUtilsMessenger);
+		//	debugUtilsMessengerCreateInfo = retLog(createDebugUtilsMessengerCreateInfoResult);
+		//
+		//	debugUtilsMessengerCreateInfo.pfnUserCallback = debugUtilsMessenger;
+		//}
 
-		std::vector<vk::PipelineColorBlendAttachmentState> colorBlendAttachmentStates = { colorBlendAttachmentState };
-		auto createPipelineColorBlendStateCreateInfoResult = createPipelineColorBlendStateCreateInfo(colorBlendAttachmentStates);
-		result.error = affectError(createPipelineColorBlendStateCreateInfoResult, result.error);
-		vk::PipelineColorBlendStateCreateInfo colorBlendState = retLog(createPipelineColorBlendStateCreateInfoResult);
+		debugUtilsMessengerCreateInfo.pfnUserCallback = debugCallback;
+		instanceCreateInfo.pNext = (VkDebugUtilsMessengerCreateInfoEXT*)&debugUtilsMessengerCreateInfo;
 
-		vk::GraphicsPipelineCreateInfo graphicsPipelineCreateInfo = {};
+		vk::Instance instance;
 		try
 		{
-			graphicsPipelineCreateInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
-			graphicsPipelineCreateInfo.pStages = shaderStages.data();
-
-			graphicsPipelineCreateInfo.pVertexInputState = &vertexInputState;
-
-			graphicsPipelineCreateInfo.pInputAssemblyState = &inputAssemblyState;
-
-			graphicsPipelineCreateInfo.pViewportState = &viewportState;
-
-			graphicsPipelineCreateInfo.pRasterizationState = &rasterizationState;
-
-			graphicsPipelineCreateInfo.pMultisampleState = &multisampleState;
-
-			graphicsPipelineCreateInfo.pColorBlendState = &colorBlendState;
-
-			graphicsPipelineCreateInfo.layout = pipelineLayout;
-
-			graphicsPipelineCreateInfo.renderPass = renderPass;
-
-			graphicsPipelineCreateInfo.subpass = 0;
-
-			graphicsPipelineCreateInfo.basePipelineHandle = vk::Pipeline(nullptr);
+			instance = std::move(vk::createInstance(instanceCreateInfo));
 		}
 		catch (vk::SystemError err)
 		{
-			result.error = GraphicsPipelineError::GRAPHICS_PIPELINE_CREATE_INFO_ERROR;
+			result.error = InstanceError::INSTANCE_CREATION_ERROR;
 		}
 
-		vk::Pipeline graphicsPipeline = vk::Pipeline(nullptr);
+		result.value = std::move(instance);
+		return result;
+	}
 
-		try
-		{
-			auto createGraphicsPipelineResult = device.createGraphicsPipeline(vk::PipelineCache(nullptr), graphicsPipelineCreateInfo);
-			if (createGraphicsPipelineResult.result != vk::Result::eSuccess)
-			{
-				result.error = GraphicsPipelineError::PIPELINE_CREATION_ERROR;
-			}
+	inline SkResult<vk::Instance, InstanceError> createInstance(const std::string_view appName, const std::string_view engineName, const std::vector<const char*>& extensions = std::vector<const char*>(),
+		const std::vector<const char*>& validationLayers = std::vector<const char*>(), const PFN_vkDebugUtilsMessengerCallbackEXT debugUtilsMessenger = nullptr, const uint32_t apiVersion = VK_API_VERSION_1_0) noexcept
+	{
+		SkResult result(vk::Instance(nullptr), InstanceError::NO_ERROR);
 
-			graphicsPipeline = createGraphicsPipelineResult.value;
-		}
-		catch (vk::SystemError err)
-		{
-			result.error = GraphicsPipelineError::PIPELINE_CREATION_ERROR;
-		}
+		auto createApplicationInfoResult = createApplicationInfo(appName, engineName, apiVersion);
+		result.error = affectError(createApplicationInfoResult, result.error);
+		vk::ApplicationInfo applicationInfo = retLog(createApplicationInfoResult);
 
-		result.value = std::move(graphicsPipeline);
+		auto createInstanceResult = createInstance(applicationInfo, extensions, validationLayers, debugUtilsMessenger);
+		result.error = std::move(affectError(createInstanceResult, result.error));
+		vk::Instance instance = retLog(createInstanceResult);
+
+		result.value = std::move(instance);
 		return result;
 	}
 
-	/*@brief Destroys the given pipeline using a given device
+	/*
+	* @brief Creates a vulkan surface using glfwCreateWindowSurface()
 	*
-	* @param device The vulkan device ordered to destroy the pipeline
-	* @param pipeline The vulkan pipeline to be destroyed
+	* Any error is stored in the instanceError variable
 	*
-	* @return SkResult(boolean indicating if the operation worked(true) or not(false), GraphicsPipelineError)
+	* @param instance A vulkan instance
+	* @param pWindow pointer to the GLFW window created with createGLFWWindow()
+	*
+	* @return SkResult(
 	*/
-	inline SkResult<bool, GraphicsPipelineError> destroyPipeline(const vk::Device& device, const vk::Pipeline& pipeline)
+	inline SkResult<vk::SurfaceKHR, InstanceError> createGLFWWindowSurface(const vk::Instance& instance, GLFWwindow* pWindow) noexcept
 	{
-		SkResult result(static_cast<bool>(true), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+		SkResult result(static_cast<vk::SurfaceKHR>(vk::SurfaceKHR(nullptr)), static_cast<InstanceError>(InstanceError::NO_ERROR));
 
-		try
-		{
-			device.destroyPipeline(pipeline);
-		}
-		catch (vk::SystemError err)
+		VkSurfaceKHR rawSurface;
+		VkResult res = glfwCreateWindowSurface(instance, pWindow, nullptr, &rawSurface);
+
+		if (res != VK_SUCCESS || rawSurface == VK_NULL_HANDLE)
 		{
-			result.value = false;
-			result.error = GraphicsPipelineError::PIPELINE_DELETION_ERROR;
+			result.error = InstanceError::SURFACE_CREATION_ERROR;
 		}
 
+		result.value = std::move(rawSurface);
 		return result;
 	}
 
-	/*Allocation*/
+	/*PHYSICAL DEVICE*/
 
-	/*@brief Returns the index of the chosen memory type according to the given type filter and memory properties
+
+	/*@brief Returns all the available physical devices on the machine
 	*
-	* @param physicalDevice The vulkan physical device to query memory properties from
-	* @param typeFilter The type filter indicating which memory type should be used
-	* @param memoryProperties The memory properties to be compared against physical device queried memory properties
+	* @param instance a vulkan instance
 	*
-	* @return SkResult(index of memory type, AllocationError)
+	* @return SkResult(vector of physical devices, PhysicalDeviceError)
 	*/
-	inline SkResult<uint32_t, AllocationError> getMemoryTypeIndex(const vk::PhysicalDevice& physicalDevice, uint32_t typeFilter, const vk::Flags<vk::MemoryPropertyFlagBits>& memoryProperties)
+	inline SkResult<std::vector<vk::PhysicalDevice>, PhysicalDeviceError> getAvailablePhysicalDevices(const vk::Instance& instance) noexcept
 	{
-		SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
-
-		vk::PhysicalDeviceMemoryProperties physicalDeviceMemoryProperties = physicalDevice.getMemoryProperties();
-
-		uint32_t memoryTypeIndex = std::numeric_limits<uint32_t>::max();
+		SkResult result(static_cast<std::vector<vk::PhysicalDevice>>(std::vector<vk::PhysicalDevice>()), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
 
-		for (uint32_t i = 0; i < physicalDeviceMemoryProperties.memoryTypeCount; i++)
-		{
-			if ((typeFilter & (1 << i)) && ((physicalDeviceMemoryProperties.memoryTypes[i].propertyFlags & memoryProperties) == memoryProperties))
-			{
-				memoryTypeIndex = i;
-				break;
-			}
-		}
+		auto availablePhysicalDevices = instance.enumeratePhysicalDevices();
 
-		if (memoryTypeIndex == std::numeric_limits<uint32_t>::max())
+		if (availablePhysicalDevices.size() == 0)
 		{
-			result.error = AllocationError::COULD_NOT_GET_MEMORY_TYPE_INDEX_ERROR;
+			result.error = PhysicalDeviceError::NO_PHYSICAL_DEVICE_FOUND;
 		}
 
-		result.value = std::move(memoryTypeIndex);
+		result.value = std::move(availablePhysicalDevices);
 		return result;
 	}
 
-	/*@brief Returns the aligned offset according to the given alignement and current offset
+	/*@brief Reserved for later use
 	*
-	* @param alignement The alignement to follow
-	* @param currentOffset The current offset before aligned
+	* @param physicalDevice a vulkan physicaldevice
 	*
-	* @return SkResult(aligned offset, AllocationError)
+	* @return boolean indicating if a given vulkan device is suitable(true) or not(false)
 	*/
-	inline SkResult<uint64_t, AllocationError> getAlignedOffset(const vk::DeviceSize& alignement, uint64_t currentOffset)
+	constexpr inline bool isDeviceSuitable(const vk::PhysicalDevice& physicalDevice) noexcept
 	{
-		SkResult result(static_cast<uint64_t>(std::numeric_limits<uint64_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+		return true;
+	}
+
+	/* @brief Returns all of the suitable vulkan physical devices filtered through isDeviceSuitable()
+	 *
+	 * @param availablePhysicalDevices vector of the available vulkan physical devices (getAvailablePhysicalDevices())
+	 *
+	 * @return SkResult(Vector of physical devices, PhysicalDeviceError)
+	 */
+	inline SkResult<std::vector<vk::PhysicalDevice>, PhysicalDeviceError> getSuitablePhysicalDevices(const std::vector<vk::PhysicalDevice>& availablePhysicalDevices)
+	{
+		SkResult result(static_cast<std::vector<vk::PhysicalDevice>>(std::vector<vk::PhysicalDevice>()), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
 
-		while ((currentOffset % alignement) != 0)
+		std::vector<vk::PhysicalDevice> suitablePhysicalDevices;
+		suitablePhysicalDevices.reserve(availablePhysicalDevices.size());
+		for (int i = 0; i < availablePhysicalDevices.size(); i++)
 		{
-			currentOffset++;
+			if (isDeviceSuitable(availablePhysicalDevices[i]))
+			{
+				suitablePhysicalDevices.emplace_back(availablePhysicalDevices[i]);
+			}
 		}
 
-		result.value = currentOffset;
+		result.value = std::move(suitablePhysicalDevices);
 		return result;
 	}
 
-	/*A very basic/barebone memory block, contains the id, origin and size of itself.*/
-	class MemoryBlock
+	/* @brief Returns the best vulkan physical device filtered through a score system
+	 *
+	 * @param suitablePhysicalDevices vector of the suitable vulkan physical devices (getSuitablePhysicalDevices())
+	 *
+	 * @return SkResult(Vulkan physical device, PhysicalDeviceError)
+	 */
+	inline SkResult<vk::PhysicalDevice, PhysicalDeviceError> getBestPhysicalDeviceByScore(const std::vector<vk::PhysicalDevice>& suitablePhysicalDevices)
 	{
-	public:
-		MemoryBlock(uint32_t identification, uint64_t offset, MemoryBlockSize size)
-		{
-			id = identification;
-			origin = offset;
-			blockSize = size;
+		SkResult result(static_cast<vk::PhysicalDevice>(vk::PhysicalDevice(nullptr)), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+
+		int i = -1;
+		int index = -1;
+		uint32_t hiscore = 0;
+
+		for (const auto& physicalDevice : suitablePhysicalDevices)
+		{
+			i += 1;
+			uint32_t score = 0;
+
+			auto physicalDeviceProperties = physicalDevice.getProperties();
+			auto physicalDeviceFeatures = physicalDevice.getFeatures();
+
+			// Discrete GPUs have a significant performance advantage
+			if (physicalDeviceProperties.deviceType == vk::PhysicalDeviceType::eDiscreteGpu)
+			{
+				score += 1000;
+			}
+
+			// Maximum possible size of textures affects graphics quality
+			score += physicalDeviceProperties.limits.maxImageDimension2D;
+
+			// Application can't function without geometry shaders
+			if (!physicalDeviceFeatures.geometryShader)
+			{
+				score = 0;
+			}
+
+			if (score > hiscore) { hiscore = score; index = i; }
+		}
+
+		if (suitablePhysicalDevices[index] != vk::PhysicalDevice(nullptr))
+		{
+			result.value = suitablePhysicalDevices[index];
+		}
+		else
+		{
+			result.error = PhysicalDeviceError::NO_SUITABLE_PHYSICAL_DEVICE_FOUND;
+		}
+
+
+		return result;
+	}
+
+	/*@brief Returns the best suitable vulkan physical device, if there are more than 1 suitable physical device, they are filtered through getBestPhysicalDeviceByScore().
+	*
+	* @param suitablePhysicalDevices vector of suitable vulkan physical devices
+	*
+	* @return SkResult(vulkan physical device, PhysicalDeviceError)
+	*/
+	inline SkResult<vk::PhysicalDevice, PhysicalDeviceError> getBestPhysicalDevice(const std::vector<vk::PhysicalDevice>& suitablePhysicalDevices)
+	{
+		SkResult result(static_cast<vk::PhysicalDevice>(vk::PhysicalDevice(nullptr)), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+
+		if (suitablePhysicalDevices.size() == 0)
+		{
+			result.error = PhysicalDeviceError::NO_SUITABLE_PHYSICAL_DEVICE_FOUND;
+		}
+
+		else if (suitablePhysicalDevices.size() == 1)
+		{
+			result.value = std::move(suitablePhysicalDevices[0]);
+		}
+
+		else
+		{
+			auto bestPhysicalResult = getBestPhysicalDeviceByScore(suitablePhysicalDevices);
+
+			result.value = retLog(bestPhysicalResult);
+			result.error = affectError(bestPhysicalResult, result.error);
+		}
+
+		return result;
+	}
+
+	/*@brief Sorts through all available physical devices and returns the best (getAvailablePhysicalDevices() -> getSuitablePhysicalDevices() -> getBestPhysicalDevice())
+	*
+	* @param instance The vulkan instance used to get the available devices
+	*
+	* @return SkResult(vulkan physical device, PhysicalDeviceError)
+	*/
+	inline SkResult<vk::PhysicalDevice, PhysicalDeviceError> getPhysicalDevice(const vk::Instance& instance)
+	{
+		SkResult result(static_cast<vk::PhysicalDevice>(vk::PhysicalDevice(nullptr)), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+
+		auto getAvailablePhysicalDevicesResult = getAvailablePhysicalDevices(instance);
+		result.error = std::move(affectError(getAvailablePhysicalDevicesResult, result.error));
+		std::vector<vk::PhysicalDevice> availablePhysicalDevices = std::move(retLog(getAvailablePhysicalDevicesResult));
+
+		auto getSuitablePhysicalDevicesResult = getSuitablePhysicalDevices(availablePhysicalDevices);
+		result.error = std::move(affectError(getSuitablePhysicalDevicesResult, result.error));
+		std::vector<vk::PhysicalDevice> suitablePhysicalDevices = std::move(retLog(getSuitablePhysicalDevicesResult));
+
+		auto getBestPhysicalDeviceResult = getBestPhysicalDevice(suitablePhysicalDevices);
+		result.error = std::move(affectError(getBestPhysicalDeviceResult, result.error));
+		vk::PhysicalDevice physicalDevice = std::move(retLog(getBestPhysicalDeviceResult));
+
+		result.value = std::move(physicalDevice);
+		return result;
+	}
+
+	/*@brief Returns a vector of queue family indexes with the following information :
+	* In the vector, index 0 = generalFamily, 1 = graphicsFamily, 2 = presentFamily, 3 = computeFamily, 4 = transferFamily, 5 = debug/tmp.
+	* (See QueueFamilyType enum)
+	*
+	* @param physicalDevice a vulkan physical device
+	* @param surface a vulkan surface
+	*
+	* @return SkResult(vector of queue family indexes, PhysicalDeviceError)
+	*/
+	inline SkResult<std::array<uint32_t, 6>, PhysicalDeviceError> getQueueFamilyIndexes(const vk::PhysicalDevice& physicalDevice, const vk::SurfaceKHR& surface)
+	{
+		SkResult result(std::array<uint32_t, 6>(), PhysicalDeviceError::NO_ERROR);
+
+		uint32_t uint32_tMax = std::move(std::numeric_limits<uint32_t>::max());
+		std::array<uint32_t, 6> queueFamilyIndexes = { uint32_tMax, uint32_tMax, uint32_tMax, uint32_tMax, uint32_tMax, uint32_tMax };
+
+		auto availableQueueFamilies = physicalDevice.getQueueFamilyProperties();
+
+		uint32_t i = 0;
+		for (const auto& queueFamily : availableQueueFamilies)
+		{
+			if (queueFamily.queueFlags & vk::QueueFlagBits::eGraphics &&
+				queueFamily.queueFlags & vk::QueueFlagBits::eCompute &&
+				physicalDevice.getSurfaceSupportKHR(i, surface))
+			{
+				queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::GENERAL)] = i;
+			}
+
+			i++;
+		}
+
+		uint32_t j = 0;
+		for (const auto& queueFamily : availableQueueFamilies)
+		{
+			if (queueFamily.queueFlags & vk::QueueFlagBits::eGraphics)
+			{
+				queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::GRAPHICS)] = j;
+			}
+
+			if (queueFamily.queueFlags & vk::QueueFlagBits::eTransfer &&
+				queueFamily.queueFlags & vk::QueueFlagBits::eCompute &&
+				!(queueFamily.queueFlags & vk::QueueFlagBits::eGraphics))
+			{
+				queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::COMPUTE)] = j;
+			}
+
+
+			if (queueFamily.queueFlags & vk::QueueFlagBits::eTransfer &&
+				!(queueFamily.queueFlags & vk::QueueFlagBits::eCompute) &&
+				!(queueFamily.queueFlags & vk::QueueFlagBits::eGraphics))
+			{
+				queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::TRANSFER)] = j;
+			}
+
+			if (physicalDevice.getSurfaceSupportKHR(j, surface))
+			{
+				queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::PRESENT)] = j;
+			}
+
+			j++;
+		}
+
+		if (queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::GENERAL)] == uint32_tMax ||
+			queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::GRAPHICS)] == uint32_tMax)
+		{
+			result.error = PhysicalDeviceError::NO_SUITABLE_QUEUES_FOUND;
+		}
+
+		result.value = std::move(queueFamilyIndexes);
+		return result;
+	}
+
+	/*@brief Returns the queue family index to be used for compute work :
+	* the dedicated compute family when getQueueFamilyIndexes() found one, the general family otherwise
+	*
+	* @param queueFamilyIndexes The queue family indexes returned by getQueueFamilyIndexes()
+	*
+	* @return The type (COMPUTE or GENERAL) of the chosen queue family
+	*/
+	inline QueueFamilyType getComputeQueueFamilyType(const std::array<uint32_t, 6>& queueFamilyIndexes) noexcept
+	{
+		if (queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::COMPUTE)] != std::numeric_limits<uint32_t>::max())
+		{
+			return QueueFamilyType::COMPUTE;
+		}
+
+		return QueueFamilyType::GENERAL;
+	}
+
+	/*@brief Returns the index, inside its family, of the queue to be used for compute work.
+	* Without a dedicated compute family, a second queue of the general family is used when the family exposes one (see createDevice()),
+	* so that compute and graphics submissions can still overlap
+	*
+	* @param physicalDevice The vulkan physical device owning the queue families
+	* @param queueFamilyIndexes The queue family indexes returned by getQueueFamilyIndexes()
+	* @param specificQueueFamilyIndex The specificQueueFamilyIndex given to createDevice() (default is -1), a device created for a specific family holding a single queue
+	*
+	* @return The index of the compute queue inside the family returned by getComputeQueueFamilyType()
+	*/
+	inline uint32_t getComputeQueueIndex(const vk::PhysicalDevice& physicalDevice, const std::array<uint32_t, 6>& queueFamilyIndexes,
+		const uint32_t specificQueueFamilyIndex = std::numeric_limits<uint32_t>::max())
+	{
+		if (getComputeQueueFamilyType(queueFamilyIndexes) == QueueFamilyType::COMPUTE || specificQueueFamilyIndex != std::numeric_limits<uint32_t>::max())
+		{
+			return 0;
+		}
+
+		uint32_t generalFamilyIndex = queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::GENERAL)];
+		auto queueFamilies = physicalDevice.getQueueFamilyProperties();
+		if (generalFamilyIndex < queueFamilies.size() && queueFamilies[generalFamilyIndex].queueCount > 1)
+		{
+			return 1;
+		}
+
+		return 0;
+	}
+
+	/*@brief Returns a vector of "concentrated" queue family indexes,
+	* meaning that duplicate indexes are removed and that only known correct indexes are left in the vector (no std::numeric_limits<uint32_t>::max(), nor debug/tmp)
+	*
+	* @param queueFamilyIndexes a vector of queue family indexes
+	*
+	* @return SkResult(vector of concentrated queue family indexes, PhysicalDeviceError)
+	*/
+	inline SkResult<std::vector<uint32_t>, QueueError> concentrateQueueFamilyIndexes(const std::array<uint32_t, 6>& queueFamilyIndexes)
+	{
+		SkResult result(static_cast<std::vector<uint32_t>>(std::vector<uint32_t>()), static_cast<QueueError>(QueueError::NO_ERROR));
+
+		//Erasing while iterating skipped consecutive unknown indexes and duplicates, sorting first makes both removals a single pass
+		std::vector<uint32_t> concentratedQueueFamilyIndexes(queueFamilyIndexes.begin(), queueFamilyIndexes.end());
+		std::sort(concentratedQueueFamilyIndexes.begin(), concentratedQueueFamilyIndexes.end());
+		concentratedQueueFamilyIndexes.erase(std::unique(concentratedQueueFamilyIndexes.begin(), concentratedQueueFamilyIndexes.end()), concentratedQueueFamilyIndexes.end());
+		concentratedQueueFamilyIndexes.erase(std::remove(concentratedQueueFamilyIndexes.begin(), concentratedQueueFamilyIndexes.end(), std::numeric_limits<uint32_t>::max()),
+			                                 concentratedQueueFamilyIndexes.end());
+
+		if (concentratedQueueFamilyIndexes.size() == 0)
+		{
+			result.error = QueueError::EMPTY_CONCENTRATED_QUEUE_VECTOR;
+		}
+
+		result.value = std::move(concentratedQueueFamilyIndexes);
+		return result;
+	}
+
+	/*@brief Returns the best available present mode, the chosen present mode or the other preferred modes if it's not available :
+	* Mailbox > Fifo > FifoRelaxed > Immediate
+	*
+	* @param physicalDevice the vulkan physical device used from which to get the surface present modeds
+	* @param surface the vulkan surface used to get present modes from
+	* @param presentMode the chosen vulkan present mode
+	*
+	* @return SkResult(best available present mode, PhysicalDeviceError)
+	*/
+	inline SkResult<vk::PresentModeKHR, PhysicalDeviceError> getBestAvailablePresentMode(const vk::PhysicalDevice& physicalDevice, const vk::SurfaceKHR& surface, const vk::PresentModeKHR& presentMode)
+	{
+		SkResult result(vk::PresentModeKHR::eImmediate, PhysicalDeviceError::NO_ERROR); //Could not find an acceptable default value for PresentModeKHR
+
+		std::vector<vk::PresentModeKHR> presentModes = physicalDevice.getSurfacePresentModesKHR(surface);
+		if (presentModes.size() == 0)
+		{
+			result.error = PhysicalDeviceError::NO_PRESENT_MODES;
+		}
+
+		bool isChoiceAvailable = false;
+
+		bool isImmediateAvailable = false;
+		bool isFifoAvailable = false;
+		bool isFifoRelaxedAvailable = false;
+		bool isMailboxAvailable = false;
+
+		//Checks if the chosen present mode is available, otherwise check if every present mode is available or not
+		for (const auto& mode : presentModes)
+		{
+			if (mode == presentMode)
+			{
+				isChoiceAvailable = true;
+				break;
+			}
+
+			if (mode == vk::PresentModeKHR::eImmediate)
+			{
+				isImmediateAvailable = true;
+			}
+
+			if (mode == vk::PresentModeKHR::eFifo)
+			{
+				isFifoAvailable = true;
+			}
+
+			if (mode == vk::PresentModeKHR::eFifoRelaxed)
+			{
+				isFifoRelaxedAvailable = true;
+			}
+
+			if (mode == vk::PresentModeKHR::eMailbox)
+			{
+				isMailboxAvailable = true;
+			}
+		}
+
+		//Picks the chosen present mode if it's available, otherwise go through preferred present modes one by one
+		if (isChoiceAvailable)
+		{
+			result.value = presentMode;
+		}
+		else
+		{
+			if (isMailboxAvailable)
+			{
+				result.value = vk::PresentModeKHR::eMailbox;
+			}
+
+			else if (isFifoAvailable)
+			{
+				result.value = vk::PresentModeKHR::eFifo;
+			}
+
+			else if (isFifoRelaxedAvailable)
+			{
+				result.value = vk::PresentModeKHR::eFifo;
+			}
+
+			else
+			{
+				result.value = vk::PresentModeKHR::eImmediate;
+			}
+		}
+
+		return result;
+	}
+
+	/*@brief Returns the best available surface format from a given physical device for a given surface
+	*
+	* @param physicalDevice the vulkan physical device used to get the surface format from
+	* @param surface the vulkan surface used to get the surface format
+	*
+	* @return SkResult(best available surface format, PhysicalDeviceError)
+	*/
+	inline SkResult<vk::SurfaceFormatKHR, PhysicalDeviceError> getBestAvailableSurfaceFormat(const vk::PhysicalDevice& physicalDevice, const vk::SurfaceKHR& surface)
+	{
+		SkResult result(static_cast<vk::SurfaceFormatKHR>(vk::SurfaceFormatKHR()), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR)); // No default value for vk::SurfaceFormatKHR
+
+		std::vector<vk::SurfaceFormatKHR> surfaceFormats = physicalDevice.getSurfaceFormatsKHR(surface);
+
+		if (surfaceFormats.size() == 0)
+		{
+			result.error = PhysicalDeviceError::NO_SURFACE_FORMATS;
+		}
+
+		if (surfaceFormats.size() == 1 && surfaceFormats[0].format == vk::Format::eUndefined)
+		{
+			result.error = PhysicalDeviceError::UNDEFINED_FORMAT;
+
+			result.value = std::move(vk::SurfaceFormatKHR{ vk::Format::eB8G8R8Unorm, vk::ColorSpaceKHR::eSrgbNonlinear });
+		}
+
+		else if (surfaceFormats.size() == 1)
+		{
+			result.value = std::move(surfaceFormats[0]);
+		}
+
+		else
+		{
+			for (const auto& surfaceFormat : surfaceFormats)
+			{
+				if (surfaceFormat.format == vk::Format::eB8G8R8A8Unorm && surfaceFormat.colorSpace == vk::ColorSpaceKHR::eSrgbNonlinear)
+				{
+					result.value = surfaceFormat;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	/*@brief Returns the swapchain 2D extent for a given physical device, surface and GLFW window
+	*
+	* @param physicalDevice the vulkan physical device from which to get the surface capabilities
+	* @param surface the vulkan surface used to get its capabilities
+	* @param pWindow the glfw window from which the framebuffer size is returned
+	*
+	* @return SkResult(2D extent of the swapchain, PhysicalDeviceError)
+	*/
+	inline SkResult<vk::Extent2D, PhysicalDeviceError> getSwapchainExtent(const vk::PhysicalDevice& physicalDevice, const vk::SurfaceKHR& surface, GLFWwindow* pWindow)
+	{
+		SkResult result(static_cast<vk::Extent2D>(vk::Extent2D()), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+
+		vk::SurfaceCapabilitiesKHR surfaceCapabilities = physicalDevice.getSurfaceCapabilitiesKHR(surface);
+
+		if (surfaceCapabilities.currentExtent.width != std::numeric_limits<uint32_t>::max())
+		{
+			result.value = surfaceCapabilities.currentExtent;
+		}
+		else
+		{
+			int width, height;
+			glfwGetFramebufferSize(pWindow, &width, &height);
+
+			if (width == NULL && height == NULL)
+			{
+				result.error = PhysicalDeviceError::GLFW_FRAMEBUFFER_SIZE_ERROR;
+			}
+
+			vk::Extent2D actualExtent = { static_cast<uint32_t>(width), static_cast<uint32_t>(height) };
+
+			actualExtent.width = std::max(surfaceCapabilities.minImageExtent.width, std::min(surfaceCapabilities.maxImageExtent.width, actualExtent.width));
+			actualExtent.height = std::max(surfaceCapabilities.minImageExtent.height, std::min(surfaceCapabilities.maxImageExtent.height, actualExtent.height));
+
+			result.value = std::move(actualExtent);
+		}
+
+		return result;
+	}
+
+	inline SkResult<std::string, PhysicalDeviceError> getMemoryInformations(const vk::PhysicalDevice& physicalDevice)
+	{
+		SkResult result(static_cast<std::string>(std::string()), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+
+		uint64_t bytesToMbConversion = 1048576;
+
+		vk::PhysicalDeviceMemoryProperties memoryProperties = physicalDevice.getMemoryProperties();
+
+		std::string memoryInformations = std::string("");
+		memoryInformations.append("Heap count : " + std::to_string(memoryProperties.memoryHeapCount) + '\t');
+		memoryInformations.append("Type count : " + std::to_string(memoryProperties.memoryTypeCount) + '\n');
+
+		for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; i++)
+		{
+			uint32_t memoryTypeRelativeIndex = 0;
+
+			memoryInformations.append("Heap [" + std::to_string(i) + "] ");
+
+			if (memoryProperties.memoryHeaps[i].flags == vk::MemoryHeapFlagBits::eDeviceLocal)
+			{
+				memoryInformations.append("(DEVICE MEMORY)");
+			}
+
+			memoryInformations.append(" : \n");
+
+			memoryInformations.append("\tSize : " + std::to_string(memoryProperties.memoryHeaps[i].size) + " bytes (" + std::to_string(memoryProperties.memoryHeaps[i].size / bytesToMbConversion) + " MB) \n");
+
+			for (uint32_t j = 0; j < memoryProperties.memoryTypeCount; j++)
+			{
+				if (memoryProperties.memoryTypes[j].heapIndex == i)
+				{
+					memoryInformations.append("\tMemory type [" + std::to_string(memoryTypeRelativeIndex) + "] : ");
+					memoryInformations.append(vk::to_string(memoryProperties.memoryTypes[j].propertyFlags));
+					memoryInformations.append("\n");
+
+					memoryTypeRelativeIndex++;
+				}
+			}
+		}
+
+		result.value = std::move(memoryInformations);
+		return result;
+	}
+
+	inline SkResult<uint32_t, PhysicalDeviceError> getHeapIndexByTypeIndex(const vk::PhysicalDevice& physicalDevice, const uint32_t& memoryTypeIndex)
+	{
+		uint32_t value = std::numeric_limits<uint32_t>::max();
+		PhysicalDeviceError error = PhysicalDeviceError::NO_ERROR;
+
+		vk::PhysicalDeviceMemoryProperties memoryProperties = physicalDevice.getMemoryProperties();
+
+		uint32_t heapIndex = std::numeric_limits<uint32_t>::max();
+		for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++)
+		{
+			if (i == memoryTypeIndex)
+			{
+				heapIndex = memoryProperties.memoryTypes[i].heapIndex;
+			}
+		}
+
+		value = heapIndex;
+		return SkResult(value, error);
+	}
+
+	/*Dynamic state features supported by a physical device, see getDynamicStateSupport()*/
+	struct DynamicStateSupport
+	{
+		//VK_EXT_extended_dynamic_state : cull mode, front face, primitive topology and depth test set while recording
+		bool extendedDynamicState = false;
+
+		//VK_KHR_dynamic_rendering : rendering without render pass nor framebuffer objects, always false with vulkan headers older than 1.2.197
+		bool dynamicRendering = false;
+	};
+
+	/*@brief Returns the dynamic state features supported by a given physical device, both the extension and its feature being required.
+	* The instance must be created with vulkan 1.1 or above (see createApplicationInfo())
+	*
+	* @param physicalDevice The vulkan physical device to be queried
+	*
+	* @return SkResult(supported dynamic state features, PhysicalDeviceError)
+	*/
+	inline SkResult<DynamicStateSupport, PhysicalDeviceError> getDynamicStateSupport(const vk::PhysicalDevice& physicalDevice)
+	{
+		SkResult result(static_cast<DynamicStateSupport>(DynamicStateSupport()), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+
+		std::vector<vk::ExtensionProperties> extensionProperties;
+		try
+		{
+			extensionProperties = physicalDevice.enumerateDeviceExtensionProperties();
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = PhysicalDeviceError::EXTENSION_QUERY_ERROR;
+			return result;
+		}
+
+		auto isExtensionSupported = [&extensionProperties](const char* extensionName)
+		{
+			return std::any_of(extensionProperties.begin(), extensionProperties.end(), [extensionName](const vk::ExtensionProperties& properties)
+			{
+				return std::strcmp(properties.extensionName, extensionName) == 0;
+			});
+		};
+
+		//Feature structures of unsupported extensions must not be chained
+		vk::PhysicalDeviceFeatures2 features = {};
+		void** ppNext = &features.pNext;
+
+		vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT extendedDynamicStateFeatures = {};
+		const bool hasExtendedDynamicState = isExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+		if (hasExtendedDynamicState)
+		{
+			*ppNext = &extendedDynamicStateFeatures;
+			ppNext = &extendedDynamicStateFeatures.pNext;
+		}
+
+#ifdef VK_KHR_dynamic_rendering
+		vk::PhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeatures = {};
+		const bool hasDynamicRendering = isExtensionSupported(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+		if (hasDynamicRendering)
+		{
+			*ppNext = &dynamicRenderingFeatures;
+			ppNext = &dynamicRenderingFeatures.pNext;
+		}
+#endif
+
+		physicalDevice.getFeatures2(&features);
+
+		result.value.extendedDynamicState = (hasExtendedDynamicState && extendedDynamicStateFeatures.extendedDynamicState == VK_TRUE);
+#ifdef VK_KHR_dynamic_rendering
+		result.value.dynamicRendering = (hasDynamicRendering && dynamicRenderingFeatures.dynamicRendering == VK_TRUE);
+#endif
+
+		return result;
+	}
+
+	/*Feature structures enabling the supported dynamic state on a device, must stay alive until the device is created*/
+	struct DynamicStateFeatures
+	{
+		vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT extendedDynamicStateFeatures;
+#ifdef VK_KHR_dynamic_rendering
+		vk::PhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeatures;
+#endif
+	};
+
+	/*@brief Adds the extensions and features of the supported dynamic state to the creation of a device
+	*
+	* @param support The dynamic state features supported by the physical device, given by getDynamicStateSupport()
+	* @param features The feature structures to be chained, filled by the function
+	* @param deviceExtensions The extensions of the device, receiving the dynamic state extensions
+	* @param pNextFeatures The chain of feature structures already given to the device (default is none)
+	*
+	* @return The new chain of feature structures, to be given as pNextFeatures to createDevice()
+	*/
+	inline const void* enableDynamicState(const DynamicStateSupport& support, DynamicStateFeatures& features, std::vector<const char*>& deviceExtensions, const void* pNextFeatures = nullptr)
+	{
+		if (support.extendedDynamicState)
+		{
+			features.extendedDynamicStateFeatures = vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT{};
+			features.extendedDynamicStateFeatures.extendedDynamicState = VK_TRUE;
+			features.extendedDynamicStateFeatures.pNext = const_cast<void*>(pNextFeatures);
+
+			deviceExtensions.emplace_back(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+			pNextFeatures = &features.extendedDynamicStateFeatures;
+		}
+
+#ifdef VK_KHR_dynamic_rendering
+		if (support.dynamicRendering)
+		{
+			features.dynamicRenderingFeatures = vk::PhysicalDeviceDynamicRenderingFeaturesKHR{};
+			features.dynamicRenderingFeatures.dynamicRendering = VK_TRUE;
+			features.dynamicRenderingFeatures.pNext = const_cast<void*>(pNextFeatures);
+
+			deviceExtensions.emplace_back(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+			pNextFeatures = &features.dynamicRenderingFeatures;
+		}
+#endif
+
+		return pNextFeatures;
+	}
+
+	/*@brief Returns true if a given physical device supports the descriptor indexing needed by BindlessDescriptorSet : VK_EXT_descriptor_indexing
+	* with non uniform indexing of sampled images and storage buffers, partially bound and update after bind descriptors and runtime arrays.
+	* The instance must be created with vulkan 1.1 or above (see createApplicationInfo())
+	*
+	* @param physicalDevice The vulkan physical device to be queried
+	*
+	* @return SkResult(bool indicating if bindless descriptors are supported(true) or not(false), PhysicalDeviceError)
+	*/
+	inline SkResult<bool, PhysicalDeviceError> getDescriptorIndexingSupport(const vk::PhysicalDevice& physicalDevice)
+	{
+		SkResult result(static_cast<bool>(false), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+
+		std::vector<vk::ExtensionProperties> extensionProperties;
+		try
+		{
+			extensionProperties = physicalDevice.enumerateDeviceExtensionProperties();
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = PhysicalDeviceError::EXTENSION_QUERY_ERROR;
+			return result;
+		}
+
+		const bool hasDescriptorIndexing = std::any_of(extensionProperties.begin(), extensionProperties.end(), [](const vk::ExtensionProperties& properties)
+		{
+			return std::strcmp(properties.extensionName, VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME) == 0;
+		});
+
+		if (!hasDescriptorIndexing)
+		{
+			return result;
+		}
+
+		vk::PhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures = {};
+
+		vk::PhysicalDeviceFeatures2 features = {};
+		features.pNext = &descriptorIndexingFeatures;
+
+		physicalDevice.getFeatures2(&features);
+
+		result.value = (descriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing == VK_TRUE)
+			&& (descriptorIndexingFeatures.shaderStorageBufferArrayNonUniformIndexing == VK_TRUE)
+			&& (descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind == VK_TRUE)
+			&& (descriptorIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind == VK_TRUE)
+			&& (descriptorIndexingFeatures.descriptorBindingPartiallyBound == VK_TRUE)
+			&& (descriptorIndexingFeatures.runtimeDescriptorArray == VK_TRUE);
+
+		return result;
+	}
+
+	/*@brief Adds the extensions and features used by BindlessDescriptorSet to the creation of a device, if getDescriptorIndexingSupport() returned true
+	*
+	* @param descriptorIndexingFeatures The feature structure to be chained, filled by the function, must stay alive until the device is created
+	* @param deviceExtensions The extensions of the device, receiving the descriptor indexing extensions
+	* @param pNextFeatures The chain of feature structures already given to the device (default is none)
+	*
+	* @return The new chain of feature structures, to be given as pNextFeatures to createDevice()
+	*/
+	inline const void* enableDescriptorIndexing(vk::PhysicalDeviceDescriptorIndexingFeaturesEXT& descriptorIndexingFeatures, std::vector<const char*>& deviceExtensions,
+		const void* pNextFeatures = nullptr)
+	{
+		descriptorIndexingFeatures = vk::PhysicalDeviceDescriptorIndexingFeaturesEXT{};
+		descriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+		descriptorIndexingFeatures.shaderStorageBufferArrayNonUniformIndexing = VK_TRUE;
+		descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+		descriptorIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+		descriptorIndexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+		descriptorIndexingFeatures.runtimeDescriptorArray = VK_TRUE;
+		descriptorIndexingFeatures.pNext = const_cast<void*>(pNextFeatures);
+
+		//Descriptor indexing depends on maintenance3 under vulkan 1.1
+		deviceExtensions.emplace_back(VK_KHR_MAINTENANCE3_EXTENSION_NAME);
+		deviceExtensions.emplace_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+
+		return &descriptorIndexingFeatures;
+	}
+
+	/*@brief Returns true if a given physical device supports VK_EXT_calibrated_timestamps, used by calibrateGpuClock()
+	*
+	* @param physicalDevice The vulkan physical device to be queried
+	*
+	* @return SkResult(bool indicating if calibrated timestamps are supported(true) or not(false), PhysicalDeviceError)
+	*/
+	inline SkResult<bool, PhysicalDeviceError> getCalibratedTimestampsSupport(const vk::PhysicalDevice& physicalDevice)
+	{
+		SkResult result(static_cast<bool>(false), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+
+		std::vector<vk::ExtensionProperties> extensionProperties;
+		try
+		{
+			extensionProperties = physicalDevice.enumerateDeviceExtensionProperties();
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = PhysicalDeviceError::EXTENSION_QUERY_ERROR;
+			return result;
+		}
+
+		result.value = std::any_of(extensionProperties.begin(), extensionProperties.end(), [](const vk::ExtensionProperties& properties)
+		{
+			return std::strcmp(properties.extensionName, VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME) == 0;
+		});
+
+		return result;
+	}
+
+	/*@brief Adds the extension used by calibrateGpuClock() to the creation of a device, if getCalibratedTimestampsSupport() returned true.
+	* The extension has no feature structure, the chain of feature structures is left untouched
+	*
+	* @param deviceExtensions The extensions of the device, receiving the calibrated timestamps extension
+	*/
+	inline void enableCalibratedTimestamps(std::vector<const char*>& deviceExtensions)
+	{
+		const bool enabled = std::any_of(deviceExtensions.begin(), deviceExtensions.end(), [](const char* extensionName)
+		{
+			return std::strcmp(extensionName, VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME) == 0;
+		});
+
+		if (!enabled)
+		{
+			deviceExtensions.emplace_back(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+		}
+	}
+
+	/*@brief Returns the highest sample count of a set of supported sample counts, capped by a requested one
+	*
+	* @param sampleCounts The supported vulkan sample counts (framebuffer limits of a physical device)
+	* @param maxSamples The highest sample count wanted (default is 8)
+	*
+	* @return The highest supported sample count not above maxSamples, 1 if none
+	*/
+	inline vk::SampleCountFlagBits getHighestSampleCount(const vk::SampleCountFlags& sampleCounts, const vk::SampleCountFlagBits maxSamples = vk::SampleCountFlagBits::e8)
+	{
+		const std::array<vk::SampleCountFlagBits, 6> candidates = { vk::SampleCountFlagBits::e64, vk::SampleCountFlagBits::e32, vk::SampleCountFlagBits::e16,
+			vk::SampleCountFlagBits::e8, vk::SampleCountFlagBits::e4, vk::SampleCountFlagBits::e2 };
+
+		for (const vk::SampleCountFlagBits candidate : candidates)
+		{
+			if (static_cast<uint32_t>(candidate) <= static_cast<uint32_t>(maxSamples) && (sampleCounts & candidate))
+			{
+				return candidate;
+			}
+		}
+
+		return vk::SampleCountFlagBits::e1;
+	}
+
+	/*@brief Returns the highest sample count usable by both the color and the depth attachments of a framebuffer
+	*
+	* @param physicalDevice The vulkan physical device to be queried
+	* @param maxSamples The highest sample count wanted (default is 8)
+	*
+	* @return SkResult(vulkan sample count, PhysicalDeviceError)
+	*/
+	inline SkResult<vk::SampleCountFlagBits, PhysicalDeviceError> getMaxUsableSampleCount(const vk::PhysicalDevice& physicalDevice, const vk::SampleCountFlagBits maxSamples = vk::SampleCountFlagBits::e8)
+	{
+		SkResult result(static_cast<vk::SampleCountFlagBits>(vk::SampleCountFlagBits::e1), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+
+		const vk::PhysicalDeviceLimits limits = physicalDevice.getProperties().limits;
+
+		result.value = getHighestSampleCount(limits.framebufferColorSampleCounts & limits.framebufferDepthSampleCounts, maxSamples);
+		return result;
+	}
+
+	/*@brief Returns the first depth format of a list usable as an optimally tiled depth/stencil attachment
+	*
+	* @param physicalDevice The vulkan physical device to be queried
+	* @param candidates The depth formats in order of preference (default prefers 32 bits float depth, then formats with stencil)
+	*
+	* @return SkResult(vulkan depth format, PhysicalDeviceError)
+	*/
+	inline SkResult<vk::Format, PhysicalDeviceError> getSupportedDepthFormat(const vk::PhysicalDevice& physicalDevice,
+		const std::vector<vk::Format>& candidates = { vk::Format::eD32Sfloat, vk::Format::eD32SfloatS8Uint, vk::Format::eD24UnormS8Uint })
+	{
+		SkResult result(static_cast<vk::Format>(vk::Format::eUndefined), static_cast<PhysicalDeviceError>(PhysicalDeviceError::NO_ERROR));
+
+		for (const vk::Format candidate : candidates)
+		{
+			const vk::FormatProperties formatProperties = physicalDevice.getFormatProperties(candidate);
+			if (formatProperties.optimalTilingFeatures & vk::FormatFeatureFlagBits::eDepthStencilAttachment)
+			{
+				result.value = candidate;
+				return result;
+			}
+		}
+
+		result.error = PhysicalDeviceError::NO_SUPPORTED_DEPTH_FORMAT;
+		return result;
+	}
+
+	/*LOGICAL DEVICE*/
+
+	/*@brief Returns a vulkan device from a given vulkan physical device
+	*
+	* @param physicalDevice a vulkan physical device
+	* @param queueFamilyIndexes a vector of queue family indexes to be included in the device creation
+	* @param deviceExtensions a vector of extension (names) to be enabled on the device
+	* @param physicalDeviceFeatures vulkan physical device features to be enabled on the dedvice
+	* @param specificQueueFamilyIndex the index of the queue family to be enabled on the device (default is -1), -1 value means all the indexes from queueFamilyIndexes are used for device creation
+	* @param pNextFeatures pointer to a chain of extended feature structures (vk::PhysicalDeviceVulkan12Features, ...) to be enabled on the device (default is nullptr)
+	*/
+	inline SkResult<vk::Device, DeviceError> createDevice(const vk::PhysicalDevice& physicalDevice, const std::array<uint32_t, 6>& queueFamilyIndexes, const std::vector<const char*>& deviceExtensions,
+		vk::PhysicalDeviceFeatures physicalDeviceFeatures = vk::PhysicalDeviceFeatures{}, uint32_t specificQueueFamilyIndex = std::numeric_limits<uint32_t>::max(), const void* pNextFeatures = nullptr)
+	{
+		SkResult result(static_cast<vk::Device>(vk::Device(nullptr)), static_cast<DeviceError>(DeviceError::NO_ERROR));
+
+		//DeviceQueueCreateInfos
+		auto concentrateQueueFamilyIndexesResult = concentrateQueueFamilyIndexes(queueFamilyIndexes);
+		std::vector<uint32_t> concentratedQueueFamilyIndexes = retLog(concentrateQueueFamilyIndexesResult);
+
+		std::vector<vk::DeviceQueueCreateInfo> deviceQueueCreateInfos;
+		deviceQueueCreateInfos.reserve(concentratedQueueFamilyIndexes.size());
+
+		float queuePriority = 1.0f;
+		std::array<float, 2> queuePriorities = { 1.0f, 1.0f };
+
+		if (specificQueueFamilyIndex == std::numeric_limits<uint32_t>::max())
+		{
+			//The general family gets a second queue for compute work when no dedicated compute family exists, see getComputeQueueIndex()
+			uint32_t generalFamilyIndex = queueFamilyIndexes[static_cast<uint32_t>(QueueFamilyType::GENERAL)];
+			uint32_t generalQueueCount = getComputeQueueIndex(physicalDevice, queueFamilyIndexes) + 1;
+
+			for (const auto queueFamilyIndex : concentratedQueueFamilyIndexes)
+			{
+				uint32_t index = static_cast<uint32_t>(queueFamilyIndex);
+				if (index == generalFamilyIndex)
+				{
+					deviceQueueCreateInfos.emplace_back(vk::DeviceQueueCreateFlags(), index, generalQueueCount, queuePriorities.data());
+				}
+				else
+				{
+					deviceQueueCreateInfos.emplace_back(vk::DeviceQueueCreateFlags(), index, 1, &(queuePriority));
+				}
+			}
+		}
+
+		else
+		{
+			if ((specificQueueFamilyIndex > queueFamilyIndexes.size() && specificQueueFamilyIndex < queueFamilyIndexes.size()))
+			{
+				result.error = DeviceError::WRONG_QUEUE_FAMILY_INDEX;
+			}
+
+			else
+			{
+				uint32_t index = static_cast<uint32_t>(queueFamilyIndexes[specificQueueFamilyIndex]);
+				deviceQueueCreateInfos.emplace_back(vk::DeviceQueueCreateFlags(), index, 1, &(queuePriority));
+			}
+		}
+
+		//DeviceCreateInfo
+		vk::DeviceCreateInfo deviceCreateInfo = vk::DeviceCreateInfo(vk::DeviceCreateFlags(), static_cast<uint32_t>(deviceQueueCreateInfos.size()), deviceQueueCreateInfos.data());
+
+		if (deviceExtensions.size() == 0)
+		{
+			result.error = DeviceError::DEVICE_EXTENSIONS_EMPTY;
+		}
+
+		physicalDeviceFeatures.samplerAnisotropy = VK_TRUE;
+
+		deviceCreateInfo.pEnabledFeatures = &(physicalDeviceFeatures);
+		deviceCreateInfo.pNext = pNextFeatures;
+		deviceCreateInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
+		deviceCreateInfo.ppEnabledExtensionNames = deviceExtensions.data();
+
+		vk::Device device;
+
+		try
+		{
+			device = physicalDevice.createDevice(deviceCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = DeviceError::DEVICE_CREATION_ERROR;
+		}
+
+		result.value = std::move(device);
+		return result;
+	}
+
+	/*@brief Destroys a given vulkan device
+	*
+	* @param device the vulkan device to be destroyed
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DeviceError)
+	*/
+	inline SkResult<bool, DeviceError> destroyDevice(vk::Device& device)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DeviceError>(DeviceError::NO_ERROR));
+
+		try
+		{
+			device.destroy();
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = DeviceError::DEVICE_DESTRUCTION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Returns a vulkan queue from a given queue family index and a given queue index
+	*
+	* @param device a vulkan device
+	* @param queueFamilyIndex the index of the queueFamily from which the queue will stem from
+	* @param queueIndex the index of the queue from the queueFamily
+	*/
+	inline SkResult<vk::Queue, DeviceError> getQueue(const vk::Device& device, uint32_t queueFamilyIndex, uint32_t queueIndex)
+	{
+		SkResult result(static_cast<vk::Queue>(vk::Queue(nullptr)), static_cast<DeviceError>(DeviceError::NO_ERROR));
+
+		try
+		{
+			result.value = device.getQueue(queueFamilyIndex, queueIndex);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = DeviceError::QUEUE_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*QUEUE*/
+
+	/*@brief Submits a given command buffer from a given queue, infos such as semaphores and fences must be included to ensure synchronization
+	*
+	* @param queue the queue which to submit from
+	* @param commandBuffer vector of command buffers holding the commands to be submitted
+	* @param waitSemaphore vector of semaphores on which to wait before submitting
+	* @param signalSemaphore vector of semaphores to signal after submitting
+	* @param renderFence the fence to signal after submitting
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DeviceError)
+	*/
+	inline SkResult<bool, DeviceError> queueSubmit(const vk::Queue& queue, const std::vector<vk::CommandBuffer>& commandBuffer, std::vector<vk::Semaphore>& waitSemaphores, std::vector<vk::Semaphore>& signalSemaphore, vk::Fence& renderFence)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DeviceError>(DeviceError::NO_ERROR));
+
+		vk::SubmitInfo submitInfo = {};
+
+		vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eColorAttachmentOutput;
+
+		submitInfo.pWaitDstStageMask = &waitStage;
+
+		submitInfo.waitSemaphoreCount = static_cast<uint32_t>(waitSemaphores.size());
+		submitInfo.pWaitSemaphores = waitSemaphores.data();
+
+		submitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphore.size());
+		submitInfo.pSignalSemaphores = signalSemaphore.data();
+
+		submitInfo.commandBufferCount = static_cast<uint32_t>(commandBuffer.size());
+		submitInfo.pCommandBuffers = commandBuffer.data();
+
+		try
+		{
+			queue.submit(submitInfo, renderFence);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = DeviceError::QUEUE_SUBMIT_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Submits a given command buffer from a given queue, infos such as semaphores and fences must be included to ensure synchronization
+	*
+	* @param queue the queue which to submit from
+	* @param commandBuffer the command buffer holding the commands to be submitted
+	* @param waitSemaphore the semaphore on which to wait before submitting
+	* @param signalSemaphore the semaphore to signal after submitting
+	* @param renderFence the fence to signal after submitting
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DeviceError)
+	*/
+	inline SkResult<bool, DeviceError> queueSubmit(const vk::Queue& queue, const vk::CommandBuffer& commandBuffer, vk::Semaphore& waitSemaphores, vk::Semaphore& signalSemaphore, vk::Fence& renderFence)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DeviceError>(DeviceError::NO_ERROR));
+
+		vk::SubmitInfo submitInfo = {};
+
+		vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eColorAttachmentOutput;
+
+		submitInfo.pWaitDstStageMask = &waitStage;
+
+		submitInfo.waitSemaphoreCount = 1;
+		submitInfo.pWaitSemaphores = &waitSemaphores;
+
+		submitInfo.signalSemaphoreCount = 1;
+		submitInfo.pSignalSemaphores = &signalSemaphore;
+
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &commandBuffer;
+
+		try
+		{
+			queue.submit(submitInfo, renderFence);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = DeviceError::QUEUE_SUBMIT_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Submits given command buffers from a given queue, each wait semaphore is paired with the pipeline stage that waits on it.
+	* Used for compute submissions, where the graphics wait stage of the other overloads does not apply
+	*
+	* @param queue the queue which to submit from
+	* @param commandBuffers vector of command buffers holding the commands to be submitted
+	* @param waitSemaphores vector of semaphores on which to wait before executing
+	* @param waitStages vector of pipeline stages waiting on the semaphore of the same index
+	* @param signalSemaphores vector of semaphores to signal once the command buffers have completed
+	* @param fence the fence to signal once the command buffers have completed (default is none)
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DeviceError)
+	*/
+	inline SkResult<bool, DeviceError> queueSubmit(const vk::Queue& queue, const std::vector<vk::CommandBuffer>& commandBuffers, const std::vector<vk::Semaphore>& waitSemaphores,
+		const std::vector<vk::PipelineStageFlags>& waitStages, const std::vector<vk::Semaphore>& signalSemaphores, const vk::Fence& fence = vk::Fence(nullptr))
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DeviceError>(DeviceError::NO_ERROR));
+
+		if (waitStages.size() != waitSemaphores.size())
+		{
+			result.value = false;
+			result.error = DeviceError::QUEUE_SUBMIT_ERROR;
+			return result;
+		}
+
+		vk::SubmitInfo submitInfo = {};
+
+		submitInfo.waitSemaphoreCount = static_cast<uint32_t>(waitSemaphores.size());
+		submitInfo.pWaitSemaphores = waitSemaphores.data();
+		submitInfo.pWaitDstStageMask = waitStages.data();
+
+		submitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
+		submitInfo.pSignalSemaphores = signalSemaphores.data();
+
+		submitInfo.commandBufferCount = static_cast<uint32_t>(commandBuffers.size());
+		submitInfo.pCommandBuffers = commandBuffers.data();
+
+		try
+		{
+			queue.submit(submitInfo, fence);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = DeviceError::QUEUE_SUBMIT_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Presents from a given queue a given swapchain image using a given swapchain image index, semaphore must be included to ensure synchronization
+	*
+	* @param queue a vulkan queue to present from
+	* @param swapchain a vulkan swapchain from which the presented image stems from
+	* @param waitSemaphore the semaphore on which to wait before presenting
+	* @param swapchainImageIndex the index of the image to be rendered from the swapchain
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DeviceError)
+	*/
+	inline SkResult<bool, DeviceError> queuePresent(const vk::Queue& queue, const vk::SwapchainKHR& swapchain, vk::Semaphore& waitSemaphore, uint32_t swapchainImageIndex)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DeviceError>(DeviceError::NO_ERROR));
+
+		vk::PresentInfoKHR presentInfo = {};
+
+		presentInfo.pSwapchains = &swapchain;
+		presentInfo.swapchainCount = 1;
+
+		presentInfo.pWaitSemaphores = &waitSemaphore;
+		presentInfo.waitSemaphoreCount = 1;
+
+		presentInfo.pImageIndices = &swapchainImageIndex;
+
+		try
+		{
+			auto res = queue.presentKHR(presentInfo);
+			if (res != vk::Result::eSuccess)
+			{
+				result.error = DeviceError::QUEUE_PRESENT_ERROR;
+			}
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = DeviceError::QUEUE_PRESENT_ERROR;
+		}
+
+		return result;
+	}
+
+	/*Swapchain*/
+
+	inline SkResult<vk::SwapchainCreateInfoKHR, DeviceError> createSwapchainCreateInfo(const vk::PhysicalDevice& physicalDevice, const vk::SurfaceKHR& surface, GLFWwindow* pWindow, const vk::PresentModeKHR& presentMode,
+		const vk::SurfaceFormatKHR& surfaceFormat, const vk::Extent2D& extent, const std::array<uint32_t, 6>& queueFamilyIndices)
+	{
+		SkResult result(vk::SwapchainCreateInfoKHR{}, DeviceError::NO_ERROR);
+
+		vk::SurfaceCapabilitiesKHR surfaceCapabilities = physicalDevice.getSurfaceCapabilitiesKHR(surface);
+		uint32_t swapchainImageCount = surfaceCapabilities.minImageCount + 1;
+		if (surfaceCapabilities.maxImageCount > 0 && swapchainImageCount > surfaceCapabilities.maxImageCount)
+		{
+			swapchainImageCount = surfaceCapabilities.maxImageCount;
+		}
+
+		vk::SwapchainCreateInfoKHR swapchainCreateInfo = vk::SwapchainCreateInfoKHR(vk::SwapchainCreateFlagsKHR(),
+			                                                                        surface,
+			                                                                        swapchainImageCount,
+			                                                                        surfaceFormat.format,
+			                                                                        surfaceFormat.colorSpace,
+			                                                                        extent,
+			                                                                        1,
+			                                                                        vk::ImageUsageFlagBits::eColorAttachment);
+
+		swapchainCreateInfo.queueFamilyIndexCount = static_cast<uint32_t>(queueFamilyIndices.size());
+		swapchainCreateInfo.pQueueFamilyIndices = queueFamilyIndices.data();
+
+		if (queueFamilyIndices.size() > 1)
+		{
+			swapchainCreateInfo.imageSharingMode = vk::SharingMode::eConcurrent;
+		}
+
+		else
+		{
+			swapchainCreateInfo.imageSharingMode = vk::SharingMode::eExclusive;
+		}
+
+		swapchainCreateInfo.preTransform = surfaceCapabilities.currentTransform;
+		swapchainCreateInfo.compositeAlpha = vk::CompositeAlphaFlagBitsKHR::eOpaque;
+
+		swapchainCreateInfo.presentMode = presentMode;
+
+		swapchainCreateInfo.clipped = VK_TRUE;
+		swapchainCreateInfo.oldSwapchain = vk::SwapchainKHR(nullptr);
+
+		result.value = std::move(swapchainCreateInfo);
+
+		return result;
+	}
+
+	inline SkResult<vk::SwapchainKHR, DeviceError> createVkSwapchain(const vk::Device& device, const vk::SwapchainCreateInfoKHR& swapchainCreateInfo)
+	{
+		SkResult result(vk::SwapchainKHR(nullptr), DeviceError::NO_ERROR);
+
+		try
+		{
+			result.value = device.createSwapchainKHR(swapchainCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = DeviceError::SWAPCHAIN_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief (The recommended way to create a swapchain)
+	* Creates a vulkan swapchain from a given vulkan device using a given vulkan physicalDevice, surface, present mode, a GLFW window and a vector of allowed queue family indices
+	*
+	* @param physicalDevice the vulkan physical device used to query surface capabilities
+	* @param device the vulkan device from which the swapchain is created
+	* @param surface the vulkan surface used to get its capabilities
+	* @param pWindow the GLFW window used to query the swapchain 2D extent
+	* @param presentMode the present mode to be used during swapchain creation
+	* @param surfaceFormat the surface format to be used during swapchain creation
+	* @param extent the 2D extent to be used during swapchain creation
+	* @param allowedQueueIndices a vector of all the allowed queue indices for swapchain creation
+	*
+	* @return SkResult(created swapchain, SwapchainError)
+	*/
+	inline SkResult<vk::SwapchainKHR, SwapchainError> createVkSwapchain(const vk::PhysicalDevice& physicalDevice, const vk::Device& device, const vk::SurfaceKHR surface, 
+		const GLFWwindow* pWindow, const vk::PresentModeKHR& presentMode, const vk::SurfaceFormatKHR& surfaceFormat, const vk::Extent2D& extent, const std::array<uint32_t, 6>& queueFamilyIndices)
+	{
+		SkResult result(static_cast<vk::SwapchainKHR>(vk::SwapchainKHR(nullptr)), static_cast<SwapchainError>(SwapchainError::NO_ERROR));
+
+		vk::SurfaceCapabilitiesKHR surfaceCapabilities = physicalDevice.getSurfaceCapabilitiesKHR(surface);
+		uint32_t swapchainImageCount = surfaceCapabilities.minImageCount + 1;
+		if (surfaceCapabilities.maxImageCount > 0 && swapchainImageCount > surfaceCapabilities.maxImageCount)
+		{
+			swapchainImageCount = surfaceCapabilities.maxImageCount;
+		}
+
+		vk::SwapchainCreateInfoKHR swapchainCreateInfo = vk::SwapchainCreateInfoKHR(vk::SwapchainCreateFlagsKHR(),
+			                                                                        surface,
+			                                                                        swapchainImageCount,
+			                                                                        surfaceFormat.format,
+			                                                                        surfaceFormat.colorSpace,
+			                                                                        extent,
+			                                                                        1,
+			                                                                        vk::ImageUsageFlagBits::eColorAttachment);
+
+		swapchainCreateInfo.queueFamilyIndexCount = std::move(static_cast<uint32_t>(queueFamilyIndices.size()));
+		swapchainCreateInfo.pQueueFamilyIndices = std::move(queueFamilyIndices.data());
+
+		if (queueFamilyIndices.size() > 1)
+		{
+			swapchainCreateInfo.imageSharingMode = vk::SharingMode::eConcurrent;
+		}
+
+		else
+		{
+			swapchainCreateInfo.imageSharingMode = vk::SharingMode::eExclusive;
+		}
+
+		swapchainCreateInfo.preTransform = surfaceCapabilities.currentTransform;
+		swapchainCreateInfo.compositeAlpha = vk::CompositeAlphaFlagBitsKHR::eOpaque;
+
+		swapchainCreateInfo.presentMode = std::move(presentMode);
+
+		swapchainCreateInfo.clipped = VK_TRUE;
+		swapchainCreateInfo.oldSwapchain = vk::SwapchainKHR(nullptr);
+
+		try
+		{
+			result.value = device.createSwapchainKHR(swapchainCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = SwapchainError::SWAPCHAIN_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Destroys the given swapchain using the given device
+	*
+	* @param device the vulkan device used to destroy the swapchain
+	* @param swapchain the vulkan swapchain to be destroyed
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), SwapchainError)
+	*/
+	inline SkResult<bool, SwapchainError> destroySwapchain(const vk::Device& device, vk::SwapchainKHR& swapchain)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<SwapchainError>(SwapchainError::NO_ERROR));
+
+		try
+		{
+			device.destroySwapchainKHR(swapchain);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = SwapchainError::SWAPCHAIN_DESTRUCTION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Returns the swapchain images from a given swapchain by a given device
+	*
+	* @param device the vulkan device used to get the swapchain images
+	* @param swapchain the vulkan swapchain from which the images are returned
+	*
+	* @return SkResult(vector of swapchain images, SwapchainError)
+	*/
+	inline SkResult<std::vector<vk::Image>, SwapchainError> getSwapchainImages(const vk::Device& device, const vk::SwapchainKHR& swapchain)
+	{
+		SkResult result(static_cast<std::vector<vk::Image>>(std::vector<vk::Image>()), static_cast<SwapchainError>(SwapchainError::NO_ERROR));
+
+		std::vector<vk::Image> swapchainImages;
+		try
+		{
+			swapchainImages = device.getSwapchainImagesKHR(swapchain);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = SwapchainError::GET_SWAPCHAIN_IMAGES_ERROR;
+		}
+
+		result.value = std::move(swapchainImages);
+		return result;
+	}
+
+	/*@brief Creates swapchain image views from given swapchain images using a given vulkan device and a given vulkan surface format
+	*
+	* @param device the vulkan device used to create these image views
+	* @param swapchainImages the vulkan swapchain images from which the image views are created
+	* @param surfaceFormat the vulkan surface format used for created image views
+	*
+	* @return SkResult(vector of created image views, SwapchainError)
+	*/
+	inline SkResult<std::vector<vk::ImageView>, SwapchainError> createSwapchainImageViews(const vk::Device& device, const std::vector<vk::Image>& swapchainImages, const vk::SurfaceFormatKHR& surfaceFormat)
+	{
+		SkResult result(static_cast<std::vector<vk::ImageView>>(std::vector<vk::ImageView>()), static_cast<SwapchainError>(SwapchainError::NO_ERROR));
+
+		uint32_t swapchainImageCount = static_cast<uint32_t>(swapchainImages.size());
+		std::vector<vk::ImageView> swapchainImageViews;
+		swapchainImageViews.reserve(swapchainImageCount);
+
+		for (uint32_t i = 0; i < swapchainImageCount; i++)
+		{
+			vk::ImageViewCreateInfo imageViewCreateInfo = {};
+
+			imageViewCreateInfo.image = swapchainImages[i];
+			imageViewCreateInfo.viewType = vk::ImageViewType::e2D;
+			imageViewCreateInfo.format = surfaceFormat.format;
+
+			imageViewCreateInfo.components.r = vk::ComponentSwizzle::eIdentity;
+			imageViewCreateInfo.components.g = vk::ComponentSwizzle::eIdentity;
+			imageViewCreateInfo.components.g = vk::ComponentSwizzle::eIdentity;
+
+			imageViewCreateInfo.subresourceRange.aspectMask = vk::ImageAspectFlagBits::eColor;
+			imageViewCreateInfo.subresourceRange.baseMipLevel = 0;
+			imageViewCreateInfo.subresourceRange.levelCount = 1;
+			imageViewCreateInfo.subresourceRange.baseArrayLayer = 0;
+			imageViewCreateInfo.subresourceRange.layerCount = 1;
+
+			try
+			{
+				swapchainImageViews.emplace_back(device.createImageView(imageViewCreateInfo));
+			}
+			catch (vk::SystemError err)
+			{
+				result.error = SwapchainError::SWAPCHAIN_IMAGE_VIEW_CREATION_ERROR;
+			}
+		}
+
+		result.value = std::move(swapchainImageViews);
+		return result;
+	}
+
+	/*@brief Destroys a given vector of swapchain image views using a given device
+	*
+	* @param device the vulkan device used to destroy the swapchain image views
+	* @param swapchainImageViews the vulkan swapchain image views to be destroyed
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), SwapchainError>
+	*/
+	inline SkResult<bool, SwapchainError> destroySwapchainImageViews(const vk::Device& device, std::vector<vk::ImageView>& swapchainImageViews)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<SwapchainError>(SwapchainError::NO_ERROR));
+
+		for (uint32_t i = 0; i < swapchainImageViews.size(); i++)
+		{
+			try
+			{
+				device.destroyImageView(swapchainImageViews[i]);
+			}
+			catch (vk::SystemError err)
+			{
+				result.value = false;
+				result.error = SwapchainError::SWAPCHAIN_IMAGE_VIEW_DESTRUCTION_ERROR;
+			}
+		}
+
+
+
+		return result;
+	}
+
+	/*Command Pool*/
+
+	/*@brief Creates a command pool using a given device from a particular queue family type (see QueueFamilyType enum)
+	*
+	* @param device The vulkan device used to create the command pool
+	* @param queueFamilyIndexes the queue family indexes from which a particular queue family will be used in the command pool
+	* @param queueFamilyType the specific type of queue family to be used in the command pool creation
+	*
+	* @return SkResult(created command pool, CommandPoolError)
+	*/
+	inline SkResult<vk::CommandPool, CommandPoolError> createCommandPool(const vk::Device& device, const std::array<uint32_t, 6>& queueFamilyIndexes, QueueFamilyType queueFamilyType)
+	{
+		SkResult result(static_cast<vk::CommandPool>(vk::CommandPool(nullptr)), static_cast<CommandPoolError>(CommandPoolError::NO_ERROR));
+
+		vk::CommandPoolCreateInfo commandPoolCreateInfo = {};
+		commandPoolCreateInfo.flags = vk::CommandPoolCreateFlagBits::eResetCommandBuffer;
+
+		if (queueFamilyIndexes[static_cast<uint32_t>(queueFamilyType)] != std::numeric_limits<uint32_t>::max())
+		{
+			commandPoolCreateInfo.queueFamilyIndex = queueFamilyIndexes[static_cast<uint32_t>(queueFamilyType)];
+		}
+		else
+		{
+			result.error = CommandPoolError::WRONG_QUEUE_INDEX;
+		}
+
+		try
+		{
+			result.value = device.createCommandPool(commandPoolCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = CommandPoolError::COMMAND_POOL_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Creates a vector of command pools using a given device from a given vector of queueFamilyIndexes (following the QueueFamilyType ordering, see QueueFamilyType)
+	*
+	* @param device The vulkan device used to create the vector of command pools
+	* @param queueFamilyIndexes the queue family indexes from which the command pools will be created
+	*
+	* @return SkResult(vector of created command pools, CommandPoolError)
+	*/
+	inline SkResult<std::vector<vk::CommandPool>, CommandPoolError> createCommandPools(const vk::Device& device, const std::array<uint32_t, 6>& queueFamilyIndexes)
+	{
+		SkResult result(static_cast<std::vector<vk::CommandPool>>(std::vector<vk::CommandPool>()), static_cast<CommandPoolError>(CommandPoolError::NO_ERROR));
+
+		std::vector<vk::CommandPool> commandPools;
+		commandPools.reserve(queueFamilyIndexes.size());
+
+		//Implying use of the QueueFamilyType ordering, see QueueFamilyType
+		for (int i = 0; i < queueFamilyIndexes.size(); i++)
+		{
+			auto createCommandPoolResult = createCommandPool(device, queueFamilyIndexes, static_cast<QueueFamilyType>(i));
+			result.error = affectError(createCommandPoolResult, result.error);
+			vk::CommandPool commandPool = retLog(createCommandPoolResult);
+
+			commandPools.emplace_back(commandPool);
+		}
+
+		result.value = commandPools;
+		return result;
+	}
+
+	/*@brief Destroys the given vulkan command pool using the given vulkan device
+	*
+	* @param device the vulkan device used to destroy the command pool
+	* @param commandPool the vulkan command pool to be destroyed
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), CommandPoolError)
+	*/
+	inline SkResult<bool, CommandPoolError> destroyCommandPool(const vk::Device& device, vk::CommandPool& commandPool)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<CommandPoolError>(CommandPoolError::NO_ERROR));
+
+		try
+		{
+			device.destroyCommandPool(commandPool);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = CommandPoolError::COMMAND_POOL_DESTRUCTION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Destroys the given vulkan command pools using the given vulkan device
+	*
+	* @param device the vulkan device used to destroy the command pools
+	* @param commandPools the vulkan command pools to be destroyed
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), CommandPoolError)
+	*/
+	inline SkResult<bool, CommandPoolError> destroyCommandPools(const vk::Device& device, std::vector<vk::CommandPool>& commandPools)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<CommandPoolError>(CommandPoolError::NO_ERROR));
+
+		for (auto& commandPool : commandPools)
+		{
+			auto destroyResult = destroyCommandPool(device, commandPool);
+			result.error = affectError(destroyResult, result.error);
+		}
+
+		if (error(result))
+		{
+			result.value = true;
+		}
+
+		return result;
+	}
+
+	/*COMMAND BUFFER*/
+
+	/*@brief Allocates a single vulkan command buffer given a vulkan command pool
+	*
+	* @param device The vulkan device allocating the command buffer
+	* @param commandPool The vulkan command pool used for allocating the command buffer
+	*
+	* @return SkResult(vulkan command buffer, CommandBufferError)
+	*/
+	inline SkResult<vk::CommandBuffer, CommandBufferError> allocateCommandBuffer(const vk::Device& device, const vk::CommandPool& commandPool)
+	{
+		SkResult result(static_cast<vk::CommandBuffer>(vk::CommandBuffer(nullptr)), static_cast<CommandBufferError>(CommandBufferError::NO_ERROR));
+
+		vk::CommandBufferAllocateInfo commandBufferAllocateInfo = {};
+		commandBufferAllocateInfo.commandPool = commandPool;
+		commandBufferAllocateInfo.commandBufferCount = 1;
+		commandBufferAllocateInfo.level = vk::CommandBufferLevel::ePrimary;
+
+		try
+		{
+			result.value = device.allocateCommandBuffers(commandBufferAllocateInfo)[0];
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = CommandBufferError::COMMAND_BUFFER_ALLOCATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Allocates a number of vulkan command buffer given a vulkan command pool
+	*
+	* @param device The vulkan device allocating the command buffer
+	* @param commandPool The vulkan command pool used for allocating the command buffers
+	* @param commandBufferCount The number of vulkan command buffers to be allocated
+	*
+	* @return SkResult(vector of vulkan command buffers, CommandBufferError)
+	*/
+	inline SkResult<std::vector<vk::CommandBuffer>, CommandBufferError> allocateCommandBuffers(const vk::Device& device, const vk::CommandPool& commandPool, const uint32_t commandBufferCount)
+	{
+		SkResult result(static_cast<std::vector<vk::CommandBuffer>>(std::vector<vk::CommandBuffer>()), static_cast<CommandBufferError>(CommandBufferError::NO_ERROR));
+
+		vk::CommandBufferAllocateInfo commandBufferAllocateInfo = {};
+		commandBufferAllocateInfo.commandPool = commandPool;
+		commandBufferAllocateInfo.commandBufferCount = commandBufferCount;
+		commandBufferAllocateInfo.level = vk::CommandBufferLevel::ePrimary;
+
+		try
+		{
+			result.value = device.allocateCommandBuffers(commandBufferAllocateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = CommandBufferError::COMMAND_BUFFER_ALLOCATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief "Begins" a given vulkan command buffer
+	*
+	* @param commandBuffer The vulkan command buffer to be "beginned"
+	*
+	* @return SkResult(bool, CommandBufferError)
+	*/
+	inline SkResult<bool, CommandBufferError> beginCommandBuffer(const vk::CommandBuffer& commandBuffer)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<CommandBufferError>(CommandBufferError::NO_ERROR));
+
+		vk::CommandBufferBeginInfo commandBufferBeginInfo = {};
+		commandBufferBeginInfo.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
+
+		try
+		{
+			commandBuffer.begin(commandBufferBeginInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = CommandBufferError::COMMAND_BUFFER_BEGIN_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief "Ends" a given vulkan command buffer
+	*
+	* @param commandBuffer The vulkan command buffer to be "Ended"
+	*
+	* @return SkResult(bool, CommandBufferError)
+	*/
+	inline SkResult<bool, CommandBufferError> endCommandBuffer(const vk::CommandBuffer& commandBuffer)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<CommandBufferError>(CommandBufferError::NO_ERROR));
+
+		try
+		{
+			commandBuffer.end();
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = true;
+			result.error = CommandBufferError::COMMAND_BUFFER_END_ERROR;
+		}
+
+		return result;
+	}
+
+	/*RENDER PASS*/
+
+	/*@brief Creates an attachment description from a given vulkan surfaceFormat, initial image layout (default is undefined), final image layout (default is present src)
+	*
+	* @param surfaceFormat the surface format used for the attachment description
+	* @param initialImageLayout Initial image layout of incoming images
+	* @param finalImageLayout Final image layout of outgoing images
+	*
+	* @return SkResult(created attachment description, RenderPassError)
+	*/
+	inline SkResult<vk::AttachmentDescription, RenderPassError> createAttachmentDescription(const vk::SurfaceFormatKHR& surfaceFormat, const vk::ImageLayout initialImageLayout = vk::ImageLayout::eUndefined, const vk::ImageLayout finalImageLayout = vk::ImageLayout::ePresentSrcKHR) noexcept
+	{
+		SkResult result(static_cast<vk::AttachmentDescription>(vk::AttachmentDescription{}), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		vk::AttachmentDescription colorAttachment = {};
+
+		colorAttachment.format = surfaceFormat.format;
+		colorAttachment.samples = vk::SampleCountFlagBits::e1;
+		colorAttachment.loadOp = vk::AttachmentLoadOp::eClear;
+		colorAttachment.storeOp = vk::AttachmentStoreOp::eStore;
+
+		colorAttachment.stencilLoadOp = vk::AttachmentLoadOp::eDontCare;
+		colorAttachment.stencilStoreOp = vk::AttachmentStoreOp::eDontCare;
+
+		colorAttachment.initialLayout = initialImageLayout;
+		colorAttachment.finalLayout = finalImageLayout;
+
+		result.value = std::move(colorAttachment);
+		return result;
+	}
+
+	/*@brief Creates an attachment reference from a given attachmentIndex (default is 0) and a given vulkan image layout (default is color attachment optimal)
+	*
+	* @param attachmentIndex the index corresponding to the attachment description at this index
+	* @param imageLayout the image layout of the attachment reference
+	*
+	* @return SkResult(created attachment reference, RenderPassError)
+	*/
+	inline SkResult<vk::AttachmentReference, RenderPassError> createAttachmentReference(const uint32_t attachmentIndex = 0, const vk::ImageLayout imageLayout = vk::ImageLayout::eColorAttachmentOptimal) noexcept
+	{
+		SkResult result(static_cast<vk::AttachmentReference>(vk::AttachmentReference()), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		vk::AttachmentReference colorAttachmentReference = {};
+
+		colorAttachmentReference.attachment = attachmentIndex;
+		colorAttachmentReference.layout = imageLayout;
+
+		result.value = std::move(colorAttachmentReference);
+		return result;
+	}
+
+	/*@brief Creates a subpass description from given vulkan attachment references, pipeline bind point (default is graphics) and color attachment count (default is 1)
+	*
+	* @param colorAttachments Vector of attachment references
+	* @param pipelineBindPoint a specific pipeline bind point used in the subpass description creation
+	*
+	* @return SkResult(created subpass description, RenderPassError)
+	*/
+	inline SkResult<vk::SubpassDescription, RenderPassError> createSubpassDescription(std::vector<vk::AttachmentReference>& colorAttachments, const vk::PipelineBindPoint pipelineBindPoint = vk::PipelineBindPoint::eGraphics) noexcept
+	{
+		SkResult result(static_cast<vk::SubpassDescription>(vk::SubpassDescription()), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		vk::SubpassDescription subpassDescription = {};
+
+		subpassDescription.pipelineBindPoint = pipelineBindPoint;
+		subpassDescription.colorAttachmentCount = static_cast<uint32_t>(colorAttachments.size());
+		subpassDescription.pColorAttachments = colorAttachments.data();
+
+		result.value = std::move(subpassDescription);
+		return result;
+	}
+
+	/*@brief Creates a render pass from a device with a given array of vulkan attachment descriptions, subpass descriptions and count of attachment descriptions and subpasses
+	*
+	* @param device the vulkan device used to create the render pass
+	* @param attachmentDescriptions Vector of vulkan attachment descriptions used in the render pass
+	* @param subpassDescriptions Vector of subpass descriptions used in the render pass
+	*
+	* @return SkResult(created vulkan renderPass, RenderPassError)
+	*/
+	inline SkResult<vk::RenderPass, RenderPassError> createRenderPass(const vk::Device& device, const std::vector<vk::AttachmentDescription>& attachmentDescriptions, const std::vector<vk::SubpassDescription>& subpassDescriptions)
+	{
+		SkResult result(static_cast<vk::RenderPass>(vk::RenderPass(nullptr)), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		vk::RenderPassCreateInfo renderPassCreateInfo = {};
+		renderPassCreateInfo.attachmentCount = static_cast<uint32_t>(attachmentDescriptions.size());
+		renderPassCreateInfo.pAttachments = attachmentDescriptions.data();
+
+		renderPassCreateInfo.subpassCount = static_cast<uint32_t>(subpassDescriptions.size());
+		renderPassCreateInfo.pSubpasses = subpassDescriptions.data();
+
+		try
+		{
+			result.value = device.createRenderPass(renderPassCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = RenderPassError::RENDER_PASS_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Creates the attachment descriptions of a render pass rendering into the swapchain with an optional depth/stencil attachment and optional MSAA.
+	* Attachments are ordered color, depth (if any), resolve (if multisampled). Multisampled color and depth are cleared and never stored,
+	* the color being resolved on tile into the single sampled swapchain image at the end of the subpass
+	*
+	* @param colorFormat The format of the swapchain images
+	* @param depthFormat The format of the depth/stencil attachment, undefined for none
+	* @param samples The sample count of the color and depth attachments
+	* @param finalLayout The layout of the swapchain image once rendered (default is present src)
+	*
+	* @return SkResult(vector of attachment descriptions, RenderPassError)
+	*/
+	inline SkResult<std::vector<vk::AttachmentDescription>, RenderPassError> createRenderTargetAttachmentDescriptions(const vk::Format colorFormat, const vk::Format depthFormat,
+		const vk::SampleCountFlagBits samples, const vk::ImageLayout finalLayout = vk::ImageLayout::ePresentSrcKHR)
+	{
+		SkResult result(static_cast<std::vector<vk::AttachmentDescription>>(std::vector<vk::AttachmentDescription>()), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		const bool multisampled = (samples != vk::SampleCountFlagBits::e1);
+
+		vk::AttachmentDescription colorAttachment = {};
+		colorAttachment.format = colorFormat;
+		colorAttachment.samples = samples;
+		colorAttachment.loadOp = vk::AttachmentLoadOp::eClear;
+		colorAttachment.storeOp = (multisampled ? vk::AttachmentStoreOp::eDontCare : vk::AttachmentStoreOp::eStore);
+		colorAttachment.stencilLoadOp = vk::AttachmentLoadOp::eDontCare;
+		colorAttachment.stencilStoreOp = vk::AttachmentStoreOp::eDontCare;
+		colorAttachment.initialLayout = vk::ImageLayout::eUndefined;
+		colorAttachment.finalLayout = (multisampled ? vk::ImageLayout::eColorAttachmentOptimal : finalLayout);
+		result.value.push_back(colorAttachment);
+
+		if (depthFormat != vk::Format::eUndefined)
+		{
+			vk::AttachmentDescription depthAttachment = {};
+			depthAttachment.format = depthFormat;
+			depthAttachment.samples = samples;
+			depthAttachment.loadOp = vk::AttachmentLoadOp::eClear;
+			depthAttachment.storeOp = vk::AttachmentStoreOp::eDontCare;
+			depthAttachment.stencilLoadOp = vk::AttachmentLoadOp::eClear;
+			depthAttachment.stencilStoreOp = vk::AttachmentStoreOp::eDontCare;
+			depthAttachment.initialLayout = vk::ImageLayout::eUndefined;
+			depthAttachment.finalLayout = vk::ImageLayout::eDepthStencilAttachmentOptimal;
+			result.value.push_back(depthAttachment);
+		}
+
+		if (multisampled)
+		{
+			vk::AttachmentDescription resolveAttachment = {};
+			resolveAttachment.format = colorFormat;
+			resolveAttachment.samples = vk::SampleCountFlagBits::e1;
+			resolveAttachment.loadOp = vk::AttachmentLoadOp::eDontCare;
+			resolveAttachment.storeOp = vk::AttachmentStoreOp::eStore;
+			resolveAttachment.stencilLoadOp = vk::AttachmentLoadOp::eDontCare;
+			resolveAttachment.stencilStoreOp = vk::AttachmentStoreOp::eDontCare;
+			resolveAttachment.initialLayout = vk::ImageLayout::eUndefined;
+			resolveAttachment.finalLayout = finalLayout;
+			result.value.push_back(resolveAttachment);
+		}
+
+		return result;
+	}
+
+	/*@brief Creates a single subpass render pass rendering into the swapchain with an optional depth/stencil attachment and optional MSAA resolved on tile
+	* (see createRenderTargetAttachmentDescriptions() for the order of the attachments and RenderTargets for their images)
+	*
+	* @param device The vulkan device used to create the render pass
+	* @param colorFormat The format of the swapchain images
+	* @param depthFormat The format of the depth/stencil attachment, undefined for none
+	* @param samples The sample count of the color and depth attachments
+	* @param finalLayout The layout of the swapchain image once rendered (default is present src)
+	*
+	* @return SkResult(created vulkan render pass, RenderPassError)
+	*/
+	inline SkResult<vk::RenderPass, RenderPassError> createRenderTargetRenderPass(const vk::Device& device, const vk::Format colorFormat, const vk::Format depthFormat,
+		const vk::SampleCountFlagBits samples, const vk::ImageLayout finalLayout = vk::ImageLayout::ePresentSrcKHR)
+	{
+		SkResult result(static_cast<vk::RenderPass>(vk::RenderPass(nullptr)), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		auto createRenderTargetAttachmentDescriptionsResult = createRenderTargetAttachmentDescriptions(colorFormat, depthFormat, samples, finalLayout);
+		result.error = affectError(createRenderTargetAttachmentDescriptionsResult, result.error);
+		const std::vector<vk::AttachmentDescription> attachmentDescriptions = retLog(createRenderTargetAttachmentDescriptionsResult);
+
+		const bool hasDepth = (depthFormat != vk::Format::eUndefined);
+		const vk::AttachmentReference colorReference(0, vk::ImageLayout::eColorAttachmentOptimal);
+		const vk::AttachmentReference depthReference(1, vk::ImageLayout::eDepthStencilAttachmentOptimal);
+		const vk::AttachmentReference resolveReference(static_cast<uint32_t>(attachmentDescriptions.size() - 1), vk::ImageLayout::eColorAttachmentOptimal);
+
+		vk::SubpassDescription subpassDescription = {};
+		subpassDescription.pipelineBindPoint = vk::PipelineBindPoint::eGraphics;
+		subpassDescription.colorAttachmentCount = 1;
+		subpassDescription.pColorAttachments = &colorReference;
+		subpassDescription.pResolveAttachments = (samples != vk::SampleCountFlagBits::e1 ? &resolveReference : nullptr);
+		subpassDescription.pDepthStencilAttachment = (hasDepth ? &depthReference : nullptr);
+
+		//The swapchain image is acquired at the color attachment output stage, the multisampled color and depth images are reused by the frames in flight
+		vk::SubpassDependency subpassDependency = {};
+		subpassDependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+		subpassDependency.dstSubpass = 0;
+		subpassDependency.srcStageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput | vk::PipelineStageFlagBits::eLateFragmentTests;
+		subpassDependency.dstStageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput | vk::PipelineStageFlagBits::eEarlyFragmentTests;
+		subpassDependency.srcAccessMask = vk::AccessFlagBits::eColorAttachmentWrite | vk::AccessFlagBits::eDepthStencilAttachmentWrite;
+		subpassDependency.dstAccessMask = vk::AccessFlagBits::eColorAttachmentWrite | vk::AccessFlagBits::eDepthStencilAttachmentWrite;
+
+		vk::RenderPassCreateInfo renderPassCreateInfo = {};
+		renderPassCreateInfo.attachmentCount = static_cast<uint32_t>(attachmentDescriptions.size());
+		renderPassCreateInfo.pAttachments = attachmentDescriptions.data();
+		renderPassCreateInfo.subpassCount = 1;
+		renderPassCreateInfo.pSubpasses = &subpassDescription;
+		renderPassCreateInfo.dependencyCount = 1;
+		renderPassCreateInfo.pDependencies = &subpassDependency;
+
+		try
+		{
+			result.value = device.createRenderPass(renderPassCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = RenderPassError::RENDER_PASS_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Creates a basic vulkan render pass with default parameters, with an optional depth/stencil attachment and optional MSAA
+	*
+	* @param device The vulkan device used to create the basic vulkan renderpass
+	* @param surfaceFormat The vulkan surface format to be used in the creation of the basic vulkan render pass
+	* @param depthFormat The format of the depth/stencil attachment, undefined for none (default is none)
+	* @param samples The sample count of the color and depth attachments, resolved into the swapchain image if above 1 (default is 1)
+	*
+	* @return SkResult(created vulkan render pass, RenderPassError)
+	*/
+	inline SkResult<vk::RenderPass, RenderPassError> createBasicRenderPass(const vk::Device& device, const vk::SurfaceFormatKHR& surfaceFormat,
+		const vk::Format depthFormat = vk::Format::eUndefined, const vk::SampleCountFlagBits samples = vk::SampleCountFlagBits::e1)
+	{
+		SkResult result(static_cast<vk::RenderPass>(vk::RenderPass(nullptr)), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		if (depthFormat != vk::Format::eUndefined || samples != vk::SampleCountFlagBits::e1)
+		{
+			return createRenderTargetRenderPass(device, surfaceFormat.format, depthFormat, samples);
+		}
+
+		auto createAttachmentDescriptionResult = createAttachmentDescription(surfaceFormat);
+		result.error = affectError(createAttachmentDescriptionResult, result.error);
+		vk::AttachmentDescription attachmentDescription = retLog(createAttachmentDescriptionResult);
+		std::vector<vk::AttachmentDescription> attachmentDescriptions = { std::move(attachmentDescription) };
+
+		auto  createAttachmentReferenceResult = createAttachmentReference();
+		result.error = affectError(createAttachmentReferenceResult, result.error);
+		vk::AttachmentReference attachmentReference = retLog(createAttachmentReferenceResult);
+		std::vector<vk::AttachmentReference> attachmentReferences = { std::move(attachmentReference) };
+
+		auto createSubpassDescriptionResult = createSubpassDescription(attachmentReferences);
+		result.error = affectError(createSubpassDescriptionResult, result.error);
+		vk::SubpassDescription subpassDescription = retLog(createSubpassDescriptionResult);
+		std::vector<vk::SubpassDescription> subpassDescriptions = { std::move(subpassDescription) };
+
+		auto createRenderPassResult = createRenderPass(device, attachmentDescriptions, subpassDescriptions);
+		result.error = affectError(createRenderPassResult, result.error);
+		vk::RenderPass renderPass = retLog(createRenderPassResult);
+
+		result.value = std::move(renderPass);
+		return result;
+	}
+	/*@brief Destroys a given vulkan render pass from a given vulkan device
+	*
+	* @param device the vulkan device used to destroy the vulkan render pass
+	* @param the vulkan render pass to be destroyed
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), RenderPassError)
+	*/
+	inline SkResult<bool, RenderPassError> destroyRenderPass(const vk::Device& device, const vk::RenderPass& renderPass)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		try
+		{
+			device.destroyRenderPass(renderPass);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = RenderPassError::RENDER_PASS_DESTRUCTION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Begins a given render pass
+	*
+	* @param commandBuffer the vulkan command buffer used to begin the render pass
+	* @param renderPass the actual vulkan render pass beginning
+	* @param extent the vulkan 2D extent to be used in the render pass
+	* @param framebuffer the vulkan framebuffer to be used in the render pass
+	* @param clearValue the vulkan clearValue to be used in the render pass
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), RenderPassError)
+	*/
+	inline SkResult<bool, RenderPassError> beginRenderPass(const vk::CommandBuffer& commandBuffer, const vk::RenderPass& renderPass, const vk::Extent2D& extent, 
+		                                                   const vk::Framebuffer& framebuffer, const vk::ClearValue& clearValue)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		vk::RenderPassBeginInfo renderPassBeginInfo = {};
+		renderPassBeginInfo.renderPass = renderPass;
+
+		renderPassBeginInfo.renderArea.offset.x = 0;
+		renderPassBeginInfo.renderArea.offset.y = 0;
+		renderPassBeginInfo.renderArea.extent = extent;
+
+		renderPassBeginInfo.framebuffer = framebuffer;
+
+		renderPassBeginInfo.clearValueCount = 1;
+		renderPassBeginInfo.pClearValues = &clearValue;
+
+		try
+		{
+			commandBuffer.beginRenderPass(renderPassBeginInfo, vk::SubpassContents::eInline);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = true;
+			result.error = RenderPassError::RENDER_PASS_BEGIN_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Begins a given render pass with one clear value per attachment (color, depth and resolve attachments of createRenderTargetRenderPass())
+	*
+	* @param commandBuffer the vulkan command buffer used to begin the render pass
+	* @param renderPass the actual vulkan render pass beginning
+	* @param extent the vulkan 2D extent to be used in the render pass
+	* @param framebuffer the vulkan framebuffer to be used in the render pass
+	* @param clearValues the vulkan clear values to be used in the render pass, indexed by attachment
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), RenderPassError)
+	*/
+	inline SkResult<bool, RenderPassError> beginRenderPass(const vk::CommandBuffer& commandBuffer, const vk::RenderPass& renderPass, const vk::Extent2D& extent,
+		                                                   const vk::Framebuffer& framebuffer, const std::vector<vk::ClearValue>& clearValues)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		vk::RenderPassBeginInfo renderPassBeginInfo = {};
+		renderPassBeginInfo.renderPass = renderPass;
+
+		renderPassBeginInfo.renderArea.offset.x = 0;
+		renderPassBeginInfo.renderArea.offset.y = 0;
+		renderPassBeginInfo.renderArea.extent = extent;
+
+		renderPassBeginInfo.framebuffer = framebuffer;
+
+		renderPassBeginInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
+		renderPassBeginInfo.pClearValues = clearValues.data();
+
+		try
+		{
+			commandBuffer.beginRenderPass(renderPassBeginInfo, vk::SubpassContents::eInline);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = RenderPassError::RENDER_PASS_BEGIN_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Ends the render pass
+	*
+	* @param the command buffer used to end the render pass it is assigned to
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), RenderPassError)
+	*/
+	inline SkResult<bool, RenderPassError> endRenderPass(const vk::CommandBuffer& commandBuffer)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		try
+		{
+			commandBuffer.endRenderPass();
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = true;
+			result.error = RenderPassError::RENDER_PASS_END_ERROR;
+		}
+
+		return result;
+	}
+
+#ifdef VK_KHR_dynamic_rendering
+	/*@brief Begins rendering into a color image, and optionally a depth image, without render pass nor framebuffer (VK_KHR_dynamic_rendering).
+	* The color image (usually a swapchain image) goes from an undefined layout to the color attachment layout and is cleared,
+	* the depth image must already be in the depth attachment layout. Pipelines must be created from RenderingFormats
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands
+	* @param colorImage The vulkan image rendered into
+	* @param colorImageView The vulkan image view of colorImage
+	* @param extent The vulkan 2D extent of the rendered area
+	* @param clearValue The color colorImage is cleared with
+	* @param dispatcher The vulkan dispatcher holding the functions of the extension, loaded from the device
+	* @param depthImageView The vulkan image view of the depth image, cleared to 1.0 (default is none)
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), RenderPassError)
+	*/
+	inline SkResult<bool, RenderPassError> beginRendering(const vk::CommandBuffer& commandBuffer, const vk::Image& colorImage, const vk::ImageView& colorImageView, const vk::Extent2D& extent,
+		const vk::ClearValue& clearValue, const vk::DispatchLoaderDynamic& dispatcher, const vk::ImageView& depthImageView = vk::ImageView(nullptr))
+	{
+		SkResult result(static_cast<bool>(true), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		//Replaces the initial layout transition of the render pass, after the image is acquired (color attachment output stage)
+		vk::ImageMemoryBarrier colorBarrier = {};
+		colorBarrier.dstAccessMask = vk::AccessFlagBits::eColorAttachmentWrite;
+		colorBarrier.oldLayout = vk::ImageLayout::eUndefined;
+		colorBarrier.newLayout = vk::ImageLayout::eColorAttachmentOptimal;
+		colorBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		colorBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		colorBarrier.image = colorImage;
+		colorBarrier.subresourceRange = vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1);
+
+		commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::DependencyFlags(),
+			nullptr, nullptr, colorBarrier);
+
+		vk::RenderingAttachmentInfoKHR colorAttachment = {};
+		colorAttachment.imageView = colorImageView;
+		colorAttachment.imageLayout = vk::ImageLayout::eColorAttachmentOptimal;
+		colorAttachment.loadOp = vk::AttachmentLoadOp::eClear;
+		colorAttachment.storeOp = vk::AttachmentStoreOp::eStore;
+		colorAttachment.clearValue = clearValue;
+
+		vk::RenderingAttachmentInfoKHR depthAttachment = {};
+		depthAttachment.imageView = depthImageView;
+		depthAttachment.imageLayout = vk::ImageLayout::eDepthStencilAttachmentOptimal;
+		depthAttachment.loadOp = vk::AttachmentLoadOp::eClear;
+		depthAttachment.storeOp = vk::AttachmentStoreOp::eDontCare;
+		depthAttachment.clearValue.depthStencil = vk::ClearDepthStencilValue(1.0f, 0);
+
+		vk::RenderingInfoKHR renderingInfo = {};
+		renderingInfo.renderArea.extent = extent;
+		renderingInfo.layerCount = 1;
+		renderingInfo.colorAttachmentCount = 1;
+		renderingInfo.pColorAttachments = &colorAttachment;
+		renderingInfo.pDepthAttachment = (depthImageView ? &depthAttachment : nullptr);
+
+		try
+		{
+			commandBuffer.beginRenderingKHR(renderingInfo, dispatcher);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = RenderPassError::RENDER_PASS_BEGIN_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Ends rendering begun by beginRendering() and transitions the color image to the present layout
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands
+	* @param colorImage The vulkan image rendered into, given to beginRendering()
+	* @param dispatcher The vulkan dispatcher holding the functions of the extension, loaded from the device
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), RenderPassError)
+	*/
+	inline SkResult<bool, RenderPassError> endRendering(const vk::CommandBuffer& commandBuffer, const vk::Image& colorImage, const vk::DispatchLoaderDynamic& dispatcher)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<RenderPassError>(RenderPassError::NO_ERROR));
+
+		try
+		{
+			commandBuffer.endRenderingKHR(dispatcher);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = RenderPassError::RENDER_PASS_END_ERROR;
+		}
+
+		vk::ImageMemoryBarrier presentBarrier = {};
+		presentBarrier.srcAccessMask = vk::AccessFlagBits::eColorAttachmentWrite;
+		presentBarrier.oldLayout = vk::ImageLayout::eColorAttachmentOptimal;
+		presentBarrier.newLayout = vk::ImageLayout::ePresentSrcKHR;
+		presentBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		presentBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		presentBarrier.image = colorImage;
+		presentBarrier.subresourceRange = vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1);
+
+		commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::PipelineStageFlagBits::eBottomOfPipe, vk::DependencyFlags(),
+			nullptr, nullptr, presentBarrier);
+
+		return result;
+	}
+#endif
+
+	/*FRAMEBUFFER*/
+
+	/*@brief Creates a vector of framebuffers from a given vulkan device, render pass, 2D extent, swapchain and an attachment count and a vector of swapchain image views
+	*
+	* @param device the vulkan device used to create the framebuffers
+	* @param renderPass the vulkan render pass to be used in the framebuffers' creation
+	* @param windowExtent the vulkan 2D extent to be used in the framebuffers' creation
+	* @param swapchain the vulkan swapchain to be used in the framebuffers' creation
+	* @param swapchainImageViews a vector of swapchain image views the framebuffers a created from
+	*
+	* @return SkResult(created framebuffers, FramebufferError)
+	*/
+	inline SkResult<std::vector<vk::Framebuffer>, FramebufferError> createFramebuffers(const vk::Device& device, const vk::RenderPass& renderPass, const uint32_t attachmentCount, const vk::Extent2D &windowExtent, 
+		const vk::SwapchainKHR& swapchain, const std::vector<vk::ImageView>& swapchainImageViews)
+	{
+		SkResult result(static_cast<std::vector<vk::Framebuffer>>(std::vector<vk::Framebuffer>()), static_cast<FramebufferError>(FramebufferError::NO_ERROR));
+
+		vk::FramebufferCreateInfo framebufferCreateInfo = {};
+
+		framebufferCreateInfo.renderPass = renderPass;
+		framebufferCreateInfo.attachmentCount = attachmentCount;
+		framebufferCreateInfo.width = windowExtent.width;
+		framebufferCreateInfo.height = windowExtent.height;
+		framebufferCreateInfo.layers = 1;
+
+		const uint32_t swapchainImageCount = static_cast<uint32_t>(getSwapchainImages(device, swapchain).value.size());
+		std::vector<vk::Framebuffer> framebuffers;
+		framebuffers.reserve(swapchainImageCount);
+
+		for (uint32_t i = 0; i < swapchainImageCount; i++)
+		{
+			framebufferCreateInfo.pAttachments = &swapchainImageViews[i];
+
+			try
+			{
+				framebuffers.emplace_back(device.createFramebuffer(framebufferCreateInfo));
+			}
+			catch (vk::SystemError err)
+			{
+				result.error = FramebufferError::FRAMEBUFFER_CREATION_ERROR;
+			}
+		}
+
+		result.value = std::move(framebuffers);
+		return result;
+	}
+
+	/*@brief Creates one framebuffer per given attachment list, for render passes with more than the swapchain image as attachment
+	* (see RenderTargets::getFramebufferAttachments() for depth and multisampled render targets)
+	*
+	* @param device the vulkan device used to create the framebuffers
+	* @param renderPass the vulkan render pass to be used in the framebuffers' creation
+	* @param windowExtent the vulkan 2D extent to be used in the framebuffers' creation
+	* @param framebufferAttachments the image views of every framebuffer, ordered as the attachments of the render pass
+	*
+	* @return SkResult(created framebuffers, FramebufferError)
+	*/
+	inline SkResult<std::vector<vk::Framebuffer>, FramebufferError> createFramebuffers(const vk::Device& device, const vk::RenderPass& renderPass, const vk::Extent2D& windowExtent,
+		const std::vector<std::vector<vk::ImageView>>& framebufferAttachments)
+	{
+		SkResult result(static_cast<std::vector<vk::Framebuffer>>(std::vector<vk::Framebuffer>()), static_cast<FramebufferError>(FramebufferError::NO_ERROR));
+
+		vk::FramebufferCreateInfo framebufferCreateInfo = {};
+
+		framebufferCreateInfo.renderPass = renderPass;
+		framebufferCreateInfo.width = windowExtent.width;
+		framebufferCreateInfo.height = windowExtent.height;
+		framebufferCreateInfo.layers = 1;
+
+		std::vector<vk::Framebuffer> framebuffers;
+		framebuffers.reserve(framebufferAttachments.size());
+
+		for (const std::vector<vk::ImageView>& attachments : framebufferAttachments)
+		{
+			framebufferCreateInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
+			framebufferCreateInfo.pAttachments = attachments.data();
+
+			try
+			{
+				framebuffers.emplace_back(device.createFramebuffer(framebufferCreateInfo));
+			}
+			catch (vk::SystemError err)
+			{
+				result.error = FramebufferError::FRAMEBUFFER_CREATION_ERROR;
+			}
+		}
+
+		result.value = std::move(framebuffers);
+		return result;
+	}
+
+	/*@brief Destroys a given array of vulkan framebuffers from a vulkan device
+	*
+	* @param device the vulkan device destroyed the framebuffers
+	* @param framebuffers a given vector of framebuffers to be destroyed
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), FramebufferError)
+	*/
+	inline SkResult<bool, FramebufferError> destroyFramebuffers(const vk::Device& device, const std::vector<vk::Framebuffer>& framebuffers)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<FramebufferError>(FramebufferError::NO_ERROR));
+
+		for (uint32_t i = 0; i < framebuffers.size(); i++)
+		{
+			try
+			{
+				device.destroyFramebuffer(framebuffers[i]);
+			}
+			catch (vk::SystemError err)
+			{
+				result.value = false;
+				result.error = FramebufferError::FRAMEBUFFER_DESTRUCTION_ERROR;
+			}
+		}
+
+		return result;
+	}
+
+	/*SYNCHRONIZATION*/
+
+	/*@brief Creates a vulkan fence from a given vulkan device
+	*
+	* @param device the vulkan device creating the fence
+	*
+	* @return SkResult(created fence, SyncError)
+	*/
+	inline SkResult<vk::Fence, SyncError> createFence(const vk::Device& device)
+	{
+		SkResult result(static_cast<vk::Fence>(vk::Fence(nullptr)), static_cast<SyncError>(SyncError::NO_ERROR));
+
+		vk::FenceCreateInfo fenceCreateInfo = {};
+		fenceCreateInfo.flags = vk::FenceCreateFlagBits::eSignaled;
+
+		try
+		{
+			result.value = device.createFence(fenceCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = SyncError::FENCE_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Destroys a given vulkan fence from a vulkan device
+	*
+	* @param device the vulkan device used to destroy the vulkan fence
+	* @param fence the vulkan fence to be destroyed
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), SyncError)
+	*/
+	inline SkResult<bool, SyncError> destroyFence(const vk::Device& device, vk::Fence& fence)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<SyncError>(SyncError::NO_ERROR));
+
+		try
+		{
+			device.destroyFence(fence);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = SyncError::FENCE_DESTRUCTION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Creates a vulkan semaphore from a given vulkan device
+	*
+	* @param device the vulkan device creating the vulkan semaphore
+	*
+	* @return SkResult(created semaphore, SyncError)
+	*/
+	inline SkResult<vk::Semaphore, SyncError> createSemaphore(const vk::Device& device)
+	{
+		SkResult result(static_cast<vk::Semaphore>(vk::Semaphore(nullptr)), static_cast<SyncError>(SyncError::NO_ERROR));
+
+		vk::SemaphoreCreateInfo semaphoreCreateInfo = {};
+		semaphoreCreateInfo.flags = vk::SemaphoreCreateFlagBits();
+
+		try
+		{
+			result.value = device.createSemaphore(semaphoreCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = SyncError::SEMAPHORE_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Destroys a given vulkan semaphore from a vulkan device
+	*
+	* @param device the vulkan device used to destroy the vulkan semaphore
+	* @param semaphore the vulkan semaphore to be destroyed
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), SyncError)
+	*/
+	inline SkResult<bool, SyncError> destroySemaphore(const vk::Device& device, vk::Semaphore& semaphore)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<SyncError>(SyncError::NO_ERROR));
+
+		try
+		{
+			device.destroySemaphore(semaphore);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = SyncError::SEMAPHORE_DESTRUCTION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Records the release half of a queue family ownership transfer of exclusive buffers, on a command buffer of the source queue family.
+	* The matching acquireBufferOwnership() must be recorded on the destination queue family, after a semaphore signaled by this submission.
+	* Nothing is recorded when both families are the same, the semaphore alone is then enough
+	*
+	* @param commandBuffer The vulkan command buffer of the source queue family
+	* @param buffers The vulkan buffers (created with vk::SharingMode::eExclusive) to be transferred
+	* @param srcQueueFamilyIndex The queue family currently owning the buffers
+	* @param dstQueueFamilyIndex The queue family receiving the buffers
+	* @param srcStage The pipeline stage of the last use of the buffers on the source queue family
+	* @param srcAccess The access mask of the last use of the buffers on the source queue family
+	*
+	* @return SkResult(bool signaling if a barrier was recorded(1) or not(0), SyncError)
+	*/
+	inline SkResult<bool, SyncError> releaseBufferOwnership(const vk::CommandBuffer& commandBuffer, const std::vector<vk::Buffer>& buffers, const uint32_t srcQueueFamilyIndex, const uint32_t dstQueueFamilyIndex,
+		const vk::PipelineStageFlags srcStage, const vk::AccessFlags srcAccess)
+	{
+		SkResult result(static_cast<bool>(false), static_cast<SyncError>(SyncError::NO_ERROR));
+
+		if (srcQueueFamilyIndex == dstQueueFamilyIndex || buffers.empty())
+		{
+			return result;
+		}
+
+		std::vector<vk::BufferMemoryBarrier> bufferMemoryBarriers;
+		bufferMemoryBarriers.reserve(buffers.size());
+		for (const auto& buffer : buffers)
+		{
+			//dstAccessMask is ignored for a release, visibility is provided by the acquire
+			bufferMemoryBarriers.emplace_back(srcAccess, vk::AccessFlags(), srcQueueFamilyIndex, dstQueueFamilyIndex, buffer, 0, VK_WHOLE_SIZE);
+		}
+
+		commandBuffer.pipelineBarrier(srcStage, vk::PipelineStageFlagBits::eBottomOfPipe, vk::DependencyFlags(), nullptr, bufferMemoryBarriers, nullptr);
+
+		result.value = true;
+		return result;
+	}
+
+	/*@brief Records the acquire half of a queue family ownership transfer of exclusive buffers, on a command buffer of the destination queue family.
+	* Must match a releaseBufferOwnership() with the same buffers and families. Nothing is recorded when both families are the same
+	*
+	* @param commandBuffer The vulkan command buffer of the destination queue family
+	* @param buffers The vulkan buffers (created with vk::SharingMode::eExclusive) to be transferred
+	* @param srcQueueFamilyIndex The queue family releasing the buffers
+	* @param dstQueueFamilyIndex The queue family acquiring the buffers
+	* @param dstStage The pipeline stage of the first use of the buffers on the destination queue family
+	* @param dstAccess The access mask of the first use of the buffers on the destination queue family
+	*
+	* @return SkResult(bool signaling if a barrier was recorded(1) or not(0), SyncError)
+	*/
+	inline SkResult<bool, SyncError> acquireBufferOwnership(const vk::CommandBuffer& commandBuffer, const std::vector<vk::Buffer>& buffers, const uint32_t srcQueueFamilyIndex, const uint32_t dstQueueFamilyIndex,
+		const vk::PipelineStageFlags dstStage, const vk::AccessFlags dstAccess)
+	{
+		SkResult result(static_cast<bool>(false), static_cast<SyncError>(SyncError::NO_ERROR));
+
+		if (srcQueueFamilyIndex == dstQueueFamilyIndex || buffers.empty())
+		{
+			return result;
+		}
+
+		std::vector<vk::BufferMemoryBarrier> bufferMemoryBarriers;
+		bufferMemoryBarriers.reserve(buffers.size());
+		for (const auto& buffer : buffers)
+		{
+			//srcAccessMask is ignored for an acquire, availability is provided by the release
+			bufferMemoryBarriers.emplace_back(vk::AccessFlags(), dstAccess, srcQueueFamilyIndex, dstQueueFamilyIndex, buffer, 0, VK_WHOLE_SIZE);
+		}
+
+		commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTopOfPipe, dstStage, vk::DependencyFlags(), nullptr, bufferMemoryBarriers, nullptr);
+
+		result.value = true;
+		return result;
+	}
+
+	/*@brief Submits compute work whose results are consumed by a later graphics submission (see queueSubmitAfterCompute()).
+	* Submitting the compute work of the next frame while the graphics work of the current one is still running lets both overlap
+	*
+	* @param computeQueue The compute queue (see Device::getComputeQueue())
+	* @param commandBuffer The command buffer holding the compute commands, ending with releaseBufferOwnership() for exclusive buffers
+	* @param computeFinishedSemaphore The semaphore signaled once the compute work has completed
+	* @param computeFence The fence signaled once the compute work has completed (default is none)
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DeviceError)
+	*/
+	inline SkResult<bool, DeviceError> queueSubmitCompute(const vk::Queue& computeQueue, const vk::CommandBuffer& commandBuffer, const vk::Semaphore& computeFinishedSemaphore,
+		const vk::Fence& computeFence = vk::Fence(nullptr))
+	{
+		return queueSubmit(computeQueue, { commandBuffer }, {}, {}, { computeFinishedSemaphore }, computeFence);
+	}
+
+	/*@brief Submits graphics work waiting both on the swapchain image and on the compute work submitted by queueSubmitCompute()
+	*
+	* @param graphicsQueue The graphics queue
+	* @param commandBuffer The command buffer holding the graphics commands, starting with acquireBufferOwnership() for exclusive buffers
+	* @param presentSemaphore The semaphore signaled when the swapchain image is acquired
+	* @param computeFinishedSemaphore The semaphore signaled by the compute submission
+	* @param computeWaitStage The first graphics stage reading the compute results (eDrawIndirect, eVertexInput, eFragmentShader...)
+	* @param renderSemaphore The semaphore to signal once rendering has completed
+	* @param renderFence The fence to signal once rendering has completed
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DeviceError)
+	*/
+	inline SkResult<bool, DeviceError> queueSubmitAfterCompute(const vk::Queue& graphicsQueue, const vk::CommandBuffer& commandBuffer, const vk::Semaphore& presentSemaphore, const vk::Semaphore& computeFinishedSemaphore,
+		const vk::PipelineStageFlags computeWaitStage, const vk::Semaphore& renderSemaphore, const vk::Fence& renderFence)
+	{
+		return queueSubmit(graphicsQueue, { commandBuffer }, { presentSemaphore, computeFinishedSemaphore }, { vk::PipelineStageFlagBits::eColorAttachmentOutput, computeWaitStage },
+			               { renderSemaphore }, renderFence);
+	}
+
+	/*DRAWING*/
+
+	/*@brief Records a viewport and a scissor covering a given extent, used by the pipelines created with dynamic viewport and scissor
+	* (see createDynamicGraphicsPipeline()), which then survive swapchain resizes
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands
+	* @param extent The vulkan 2D extent to be covered
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawingError)
+	*/
+	inline SkResult<bool, DrawingError> recordViewportAndScissor(const vk::CommandBuffer& commandBuffer, const vk::Extent2D& extent)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DrawingError>(DrawingError::NO_ERROR));
+
+		vk::Viewport viewport = {};
+		viewport.width = static_cast<float>(extent.width);
+		viewport.height = static_cast<float>(extent.height);
+		viewport.maxDepth = 1.0f;
+
+		vk::Rect2D scissor = {};
+		scissor.extent = extent;
+
+		commandBuffer.setViewport(0, viewport);
+		commandBuffer.setScissor(0, scissor);
+
+		return result;
+	}
+
+	/*State recorded by recordExtendedDynamicState(), replacing the fixed function state of pipelines created with VK_EXT_extended_dynamic_state*/
+	struct ExtendedDynamicState
+	{
+		vk::CullModeFlags cullMode = vk::CullModeFlagBits::eNone;
+		vk::FrontFace frontFace = vk::FrontFace::eClockwise;
+
+		//Must belong to the topology class of the pipeline (triangles for createDynamicGraphicsPipeline())
+		vk::PrimitiveTopology primitiveTopology = vk::PrimitiveTopology::eTriangleList;
+
+		bool depthTestEnabled = false;
+		bool depthWriteEnabled = false;
+		vk::CompareOp depthCompareOp = vk::CompareOp::eLessOrEqual;
+	};
+
+	/*@brief Records the extended dynamic state (VK_EXT_extended_dynamic_state) : cull mode, front face, primitive topology and depth test.
+	* One pipeline then covers every combination of these states
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands
+	* @param state The state to be recorded
+	* @param dispatcher The vulkan dispatcher holding the functions of the extension, loaded from the device
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawingError)
+	*/
+	inline SkResult<bool, DrawingError> recordExtendedDynamicState(const vk::CommandBuffer& commandBuffer, const ExtendedDynamicState& state, const vk::DispatchLoaderDynamic& dispatcher)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DrawingError>(DrawingError::NO_ERROR));
+
+		commandBuffer.setCullModeEXT(state.cullMode, dispatcher);
+		commandBuffer.setFrontFaceEXT(state.frontFace, dispatcher);
+		commandBuffer.setPrimitiveTopologyEXT(state.primitiveTopology, dispatcher);
+
+		commandBuffer.setDepthTestEnableEXT(state.depthTestEnabled ? VK_TRUE : VK_FALSE, dispatcher);
+		commandBuffer.setDepthWriteEnableEXT(state.depthWriteEnabled ? VK_TRUE : VK_FALSE, dispatcher);
+		commandBuffer.setDepthCompareOpEXT(state.depthCompareOp, dispatcher);
+
+		return result;
+	}
+
+	/*@brief Draws one frame : waits for the previous frame, acquires the next swapchain image, begins the render pass on it,
+	* lets recordCommands record the drawing commands, then submits the command buffer and presents the image.
+	* Every draw() overload goes through this function
+	*
+	* @param device the vulkan device used to acquire the next images
+	* @param commandBuffer the vulkan command buffer receiving all the commands
+	* @param swapchain the vulkan swapchain to get the next images from
+	* @param queue the vulkan queue from which to submit
+	* @param renderFence The vulkan fence ensuring render synchronization
+	* @param presentSemaphore The vulkan semaphor ensuring present synchronization
+	* @param renderSemaphore The vulkan semaphore ensuring render synchronization
+	* @param renderPass The vulkan render pass to be used in the drawing process
+	* @param extent The vulkan 2D extent used in the vulkan render pass
+	* @param framebuffers The vulkan framebuffers to be drawn
+	* @param recordCommands Function recording the drawing commands inside the render pass
+	* @param frameNumber The current frame number
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawingError)
+	*/
+	inline SkResult<bool, DrawingError> drawFrame(const vk::Device& device, const vk::CommandBuffer& commandBuffer, const vk::SwapchainKHR& swapchain, const vk::Queue& queue, vk::Fence& renderFence, vk::Semaphore& presentSemaphore,
+		vk::Semaphore& renderSemaphore, const vk::RenderPass& renderPass, const vk::Extent2D& extent, const std::vector<vk::Framebuffer>& framebuffers,
+		const std::function<void(const vk::CommandBuffer&)>& recordCommands, double& frameNumber)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DrawingError>(DrawingError::NO_ERROR));
+
+		uint32_t timeout = 1000000000;
+		auto waitForFencesResult = device.waitForFences(renderFence, true, timeout);
+		device.resetFences(renderFence);
+
+		uint32_t swapchainImageIndex = device.acquireNextImageKHR(swapchain, timeout, presentSemaphore).value;
+
+		commandBuffer.reset();
+
+		beginCommandBuffer(commandBuffer);
+
+		vk::ClearValue clearValue;
+		double flash = abs(sin((frameNumber) / 1200.0));
+		std::array<float, 4> colorArray = { 0.0f, 0.0f, 0.0f, 1.0 };
+		clearValue.color = std::move(vk::ClearColorValue(colorArray));
+
+		beginRenderPass(commandBuffer, renderPass, extent, framebuffers[swapchainImageIndex], clearValue);
+
+		//Pipelines with a static viewport and scissor ignore them
+		recordViewportAndScissor(commandBuffer, extent);
+
+		recordCommands(commandBuffer);
+
+		endRenderPass(commandBuffer);
+
+		endCommandBuffer(commandBuffer);
+
+		queueSubmit(queue, commandBuffer, presentSemaphore, renderSemaphore, renderFence);
+
+		queuePresent(queue, swapchain, renderSemaphore, swapchainImageIndex);
+
+		frameNumber++;
+
+		return result;
+	}
+
+	//Lots of work to do on that one
+	/*@brief The main drawing function
+	*
+	* @param device the vulkan device used to acquire the next images
+	* @param commandBuffer the vulkan command buffer receiving all the commands
+	* @param swapchain the vulkan swapchain to get the next images from
+	* @param queue the vulkan queue from which to submit
+	* @param pipeline The vulkan pipeline used to draw
+	* @param renderFence The vulkan fence ensuring render synchronization
+	* @param presentSemaphore The vulkan semaphor ensuring present synchronization
+	* @param renderSemaphore The vulkan semaphore ensuring render synchronization
+	* @param renderPass The vulkan render pass to be used in the drawing process
+	* @param extent The vulkan 2D extent used in the vulkan render pass
+	* @param framebuffers The vulkan framebuffers to be drawn
+	* @param vertexBuffers The vulkan buffers of vertices
+	* @param vertices The vertices to be drawn
+	* @param frameNumber The current frame number
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawingError)
+	*/
+	inline SkResult<bool, DrawingError> draw(const vk::Device& device, const vk::CommandBuffer& commandBuffer, const vk::SwapchainKHR& swapchain, const vk::Queue& queue, const vk::Pipeline& pipeline, vk::Fence& renderFence, vk::Semaphore& presentSemaphore,
+		vk::Semaphore& renderSemaphore, const vk::RenderPass& renderPass, const vk::Extent2D& extent, const std::vector<vk::Framebuffer>& framebuffers, const std::vector<vk::Buffer>& vertexBuffers,
+		const std::vector<Vertex>& vertices, double& frameNumber)
+	{
+		auto recordCommands = [&](const vk::CommandBuffer& cmd)
+		{
+			cmd.bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline);
+
+			vk::DeviceSize offset = 0;
+			cmd.bindVertexBuffers(0, 1, vertexBuffers.data(), &offset);
+
+			cmd.draw(static_cast<uint32_t>(vertices.size()), 1, 0, 0);
+		};
+
+		return drawFrame(device, commandBuffer, swapchain, queue, renderFence, presentSemaphore, renderSemaphore, renderPass, extent, framebuffers, recordCommands, frameNumber);
+	}
+
+	/*@brief Records the indexed draw of a whole mesh : binds its vertex buffers and index buffer, then draws its indices
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands, inside a render pass with a bound graphics pipeline
+	* @param vertexBuffers The vulkan buffers of vertices, bound from binding 0
+	* @param indexBuffer The vulkan index buffer created by createIndexBuffer() and filled by writeIndices()
+	* @param mesh The indexed mesh to be drawn
+	* @param instanceCount The number of instances to be drawn (default is 1)
+	* @param firstIndex The index of the first index of the mesh in the index buffer, meshes sharing one index buffer (default is 0)
+	* @param vertexOffset The value added to the indices of the mesh, meshes sharing vertex buffers (default is 0)
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawingError)
+	*/
+	inline SkResult<bool, DrawingError> drawIndexed(const vk::CommandBuffer& commandBuffer, const std::vector<vk::Buffer>& vertexBuffers, const vk::Buffer& indexBuffer, const Mesh& mesh,
+		const uint32_t instanceCount = 1, const uint32_t firstIndex = 0, const int32_t vertexOffset = 0)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DrawingError>(DrawingError::NO_ERROR));
+
+		std::vector<vk::DeviceSize> offsets(vertexBuffers.size(), 0);
+		commandBuffer.bindVertexBuffers(0, vertexBuffers, offsets);
+
+		commandBuffer.bindIndexBuffer(indexBuffer, 0, mesh.getIndexType());
+
+		commandBuffer.drawIndexed(static_cast<uint32_t>(mesh.indices.size()), instanceCount, firstIndex, vertexOffset, 0);
+
+		return result;
+	}
+
+	/*@brief Binds the vertex and index buffers of a mesh with levels of detail and draws one of its levels
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands, inside a render pass with a pipeline bound
+	* @param vertexBuffers The vulkan buffers holding the vertices of lodMesh.mesh
+	* @param indexBuffer The vulkan index buffer holding the indices of every level (see writeIndices())
+	* @param lodMesh The mesh with levels of detail to be drawn
+	* @param lod The index of the level to be drawn, usually given by selectLod()
+	* @param instanceCount The number of instances to be drawn
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawingError)
+	*/
+	inline SkResult<bool, DrawingError> drawIndexedLod(const vk::CommandBuffer& commandBuffer, const std::vector<vk::Buffer>& vertexBuffers, const vk::Buffer& indexBuffer, const LodMesh& lodMesh,
+		const uint32_t lod, const uint32_t instanceCount = 1)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DrawingError>(DrawingError::NO_ERROR));
+
+		if (lod >= lodMesh.lods.size())
+		{
+			result.value = false;
+			result.error = DrawingError::LOD_OUT_OF_RANGE_ERROR;
+			return result;
+		}
+
+		std::vector<vk::DeviceSize> offsets(vertexBuffers.size(), 0);
+		commandBuffer.bindVertexBuffers(0, vertexBuffers, offsets);
+
+		commandBuffer.bindIndexBuffer(indexBuffer, 0, lodMesh.mesh.getIndexType());
+
+		commandBuffer.drawIndexed(lodMesh.lods[lod].indexCount, instanceCount, lodMesh.lods[lod].firstIndex, 0, 0);
+
+		return result;
+	}
+
+	/*@brief Binds the vertex buffer of a mesh on binding 0 and an instance buffer on binding 1, then draws instanceCount instances of the mesh
+	* in a single call. The pipeline must read both streams (see getInstancedVertexInputDescription())
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands, inside a render pass with a pipeline bound
+	* @param meshBuffers The buffers of the mesh to be drawn
+	* @param instanceBuffer The vulkan buffer holding the InstanceData of the instances
+	* @param instanceCount The number of instances to be drawn
+	* @param firstInstance The index of the first InstanceData to be read from instanceBuffer
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawingError)
+	*/
+	inline SkResult<bool, DrawingError> drawIndexedInstanced(const vk::CommandBuffer& commandBuffer, const MeshBuffers& meshBuffers, const vk::Buffer& instanceBuffer,
+		const uint32_t instanceCount, const uint32_t firstInstance = 0)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DrawingError>(DrawingError::NO_ERROR));
+
+		//Instance rate attributes are fetched from firstInstance on, so the instance buffer is always bound at offset 0
+		std::array<vk::Buffer, 2> vertexBuffers = { meshBuffers.vertexBuffer, instanceBuffer };
+		std::array<vk::DeviceSize, 2> offsets = { 0, 0 };
+		commandBuffer.bindVertexBuffers(0, vertexBuffers, offsets);
+
+		commandBuffer.bindIndexBuffer(meshBuffers.indexBuffer, 0, meshBuffers.indexType);
+
+		commandBuffer.drawIndexed(meshBuffers.indexCount, instanceCount, 0, 0, firstInstance);
+
+		return result;
+	}
+
+	/*@brief Records the batches built by InstanceBatcher::build(), one pipeline bind per pipeline and one draw call per batch.
+	* Push constants and descriptor sets shared by the pipelines must be recorded beforehand
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands, inside a render pass
+	* @param batches The batches returned by InstanceBatcher::build()
+	* @param meshes The buffers of the meshes, indexed by the mesh ids given to InstanceBatcher::add()
+	* @param instanceBuffer The vulkan buffer the instances were written into by InstanceBatcher::build()
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawingError)
+	*/
+	inline SkResult<bool, DrawingError> recordInstanceBatches(const vk::CommandBuffer& commandBuffer, const std::vector<InstanceBatch>& batches, const std::vector<MeshBuffers>& meshes,
+		const vk::Buffer& instanceBuffer)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DrawingError>(DrawingError::NO_ERROR));
+
+		vk::Pipeline boundPipeline = nullptr;
+		for (const auto& batch : batches)
+		{
+			if (batch.meshId >= meshes.size())
+			{
+				result.value = false;
+				result.error = DrawingError::MESH_ID_OUT_OF_RANGE_ERROR;
+				return result;
+			}
+
+			if (batch.pipeline != boundPipeline)
+			{
+				commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, batch.pipeline);
+				boundPipeline = batch.pipeline;
+			}
+
+			drawIndexedInstanced(commandBuffer, meshes[batch.meshId], instanceBuffer, batch.instanceCount, batch.firstInstance);
+		}
+
+		return result;
+	}
+
+	/*@brief The main drawing function for indexed meshes
+	*
+	* @param device the vulkan device used to acquire the next images
+	* @param commandBuffer the vulkan command buffer receiving all the commands
+	* @param swapchain the vulkan swapchain to get the next images from
+	* @param queue the vulkan queue from which to submit
+	* @param pipeline The vulkan pipeline used to draw
+	* @param renderFence The vulkan fence ensuring render synchronization
+	* @param presentSemaphore The vulkan semaphor ensuring present synchronization
+	* @param renderSemaphore The vulkan semaphore ensuring render synchronization
+	* @param renderPass The vulkan render pass to be used in the drawing process
+	* @param extent The vulkan 2D extent used in the vulkan render pass
+	* @param framebuffers The vulkan framebuffers to be drawn
+	* @param vertexBuffers The vulkan buffers of vertices
+	* @param indexBuffer The vulkan index buffer of the mesh
+	* @param mesh The indexed mesh to be drawn
+	* @param frameNumber The current frame number
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawingError)
+	*/
+	inline SkResult<bool, DrawingError> draw(const vk::Device& device, const vk::CommandBuffer& commandBuffer, const vk::SwapchainKHR& swapchain, const vk::Queue& queue, const vk::Pipeline& pipeline, vk::Fence& renderFence, vk::Semaphore& presentSemaphore,
+		vk::Semaphore& renderSemaphore, const vk::RenderPass& renderPass, const vk::Extent2D& extent, const std::vector<vk::Framebuffer>& framebuffers, const std::vector<vk::Buffer>& vertexBuffers,
+		const vk::Buffer& indexBuffer, const Mesh& mesh, double& frameNumber)
+	{
+		auto recordCommands = [&](const vk::CommandBuffer& cmd)
+		{
+			cmd.bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline);
+
+			logError(drawIndexed(cmd, vertexBuffers, indexBuffer, mesh));
+		};
+
+		return drawFrame(device, commandBuffer, swapchain, queue, renderFence, presentSemaphore, renderSemaphore, renderPass, extent, framebuffers, recordCommands, frameNumber);
+	}
+
+	/*@brief Records an indexed draw whose commands and draw count are read from GPU buffers (filled by recordFrustumCulling),
+	* requires a vulkan 1.2 device created with VkPhysicalDeviceVulkan12Features::drawIndirectCount enabled.
+	* The pipeline, vertex buffers and index buffer must already be bound inside a render pass
+	*
+	* @param commandBuffer The vulkan command buffer receiving the draw command
+	* @param drawCommandBuffer The buffer holding the vk::DrawIndexedIndirectCommand array
+	* @param drawCountBuffer The buffer holding the number of draw commands to execute
+	* @param maxDrawCount The maximum number of draw commands to execute
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawingError)
+	*/
+	inline SkResult<bool, DrawingError> drawIndexedIndirectCount(const vk::CommandBuffer& commandBuffer, const vk::Buffer& drawCommandBuffer, const vk::Buffer& drawCountBuffer, const uint32_t maxDrawCount)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DrawingError>(DrawingError::NO_ERROR));
+
+		commandBuffer.drawIndexedIndirectCount(drawCommandBuffer, 0, drawCountBuffer, 0, maxDrawCount, sizeof(vk::DrawIndexedIndirectCommand));
+
+		return result;
+	}
+
+	/*COMPUTE*/
+
+	/*@brief Returns the number of workgroups needed to cover a given number of invocations
+	*
+	* @param invocationCount The number of invocations (particles, vertices, pixels...) to be processed
+	* @param localSize The local_size of the compute shader in the same dimension
+	*
+	* @return The number of workgroups to dispatch
+	*/
+	inline constexpr uint32_t getGroupCount(const uint32_t invocationCount, const uint32_t localSize) noexcept
+	{
+		return ((invocationCount + localSize - 1) / localSize);
+	}
+
+	/*@brief Records a compute dispatch : binds the compute pipeline, its descriptor sets and push constants, then dispatches the workgroups
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands
+	* @param pipeline The vulkan compute pipeline to be dispatched
+	* @param pipelineLayout The vulkan pipeline layout of the compute pipeline
+	* @param descriptorSets The vulkan descriptor sets to be bound, starting from set 0
+	* @param pushConstantData Pointer to the push constant data (nullptr if the pipeline has no push constants)
+	* @param pushConstantSize The size in bytes of the push constant data
+	* @param groupCountX The number of workgroups to dispatch in the X dimension
+	* @param groupCountY The number of workgroups to dispatch in the Y dimension
+	* @param groupCountZ The number of workgroups to dispatch in the Z dimension
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), ComputePipelineError)
+	*/
+	inline SkResult<bool, ComputePipelineError> dispatch(const vk::CommandBuffer& commandBuffer, const vk::Pipeline& pipeline, const vk::PipelineLayout& pipelineLayout, const std::vector<vk::DescriptorSet>& descriptorSets,
+		const void* pushConstantData, const uint32_t pushConstantSize, const uint32_t groupCountX, const uint32_t groupCountY = 1, const uint32_t groupCountZ = 1)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<ComputePipelineError>(ComputePipelineError::NO_ERROR));
+
+		commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, pipeline);
+
+		if (!descriptorSets.empty())
+		{
+			commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute, pipelineLayout, 0, descriptorSets, nullptr);
+		}
+
+		if (pushConstantData != nullptr && pushConstantSize > 0)
+		{
+			commandBuffer.pushConstants(pipelineLayout, vk::ShaderStageFlagBits::eCompute, 0, pushConstantSize, pushConstantData);
+		}
+
+		commandBuffer.dispatch(groupCountX, groupCountY, groupCountZ);
+
+		return result;
+	}
+
+	/*SHADERS*/
+
+	/*First word of every SPIR-V module*/
+	constexpr uint32_t spirvMagicNumber = 0x07230203;
+
+	/*@brief Checks that a block of memory holds a SPIR-V module : whole words, a 5 words header at least and the SPIR-V magic number
+	*
+	* @param pCode Pointer to the SPIR-V code
+	* @param codeSize The size of the code in bytes
+	*
+	* @return true if the code looks like a SPIR-V module
+	*/
+	inline bool isSpirvCode(const void* pCode, const size_t codeSize) noexcept
+	{
+		if (pCode == nullptr || codeSize < 5 * sizeof(uint32_t) || codeSize % sizeof(uint32_t) != 0)
+		{
+			return false;
+		}
+
+		uint32_t magicNumber = 0;
+		std::memcpy(&magicNumber, pCode, sizeof(uint32_t));
+		return (magicNumber == spirvMagicNumber);
+	}
+
+	/*@brief Loads a shader file into a vector uint32_t buffer from a given filename, the file being mapped and copied at once
+	*
+	* @param shaderFilename the filename referring to the shader file
+	*
+	* @return SkResult(actual buffer holding shader file, ShaderError)
+	*/
+	inline SkResult<std::vector<uint32_t>, ShaderError> loadShaderFileInBuffer(const std::string_view shaderFilename) noexcept
+	{
+		SkResult result(static_cast<std::vector<uint32_t>>(std::vector<uint32_t>()), static_cast<ShaderError>(ShaderError::NO_ERROR));
+
+		MappedFile shaderFile;
+		if (error(shaderFile.open(shaderFilename)))
+		{
+			result.error = ShaderError::SHADER_FILE_OPENING_ERROR;
+			return result;
+		}
+
+		if (!isSpirvCode(shaderFile.getData(), shaderFile.getSize()))
+		{
+			result.error = ShaderError::INVALID_SPIRV_ERROR;
+			return result;
+		}
+
+		const uint32_t* pCode = static_cast<const uint32_t*>(shaderFile.getData());
+
+		result.value.assign(pCode, pCode + shaderFile.getSize() / sizeof(uint32_t));
+		return result;
+	}
+
+	/*@brief Creates a shader module from SPIR-V code held in memory (a mapped .spv file for instance), nothing is copied
+	*
+	* @param device the vulkan device creating the shader module
+	* @param pCode Pointer to the SPIR-V code, aligned on 4 bytes
+	* @param codeSize The size of the code in bytes
+	*
+	* @return SkResult(created shader module, ShaderError)
+	*/
+	inline SkResult<vk::ShaderModule, ShaderError> createShaderModule(const vk::Device& device, const uint32_t* pCode, const size_t codeSize)
+	{
+		SkResult result(static_cast<vk::ShaderModule>(vk::ShaderModule(nullptr)), static_cast<ShaderError>(ShaderError::NO_ERROR));
+
+		if (!isSpirvCode(pCode, codeSize))
+		{
+			result.error = ShaderError::INVALID_SPIRV_ERROR;
+			return result;
+		}
+
+		vk::ShaderModuleCreateInfo shaderModuleCreateInfo = {};
+		shaderModuleCreateInfo.codeSize = codeSize;
+		shaderModuleCreateInfo.pCode = pCode;
+
+		try
+		{
+			result.value = device.createShaderModule(shaderModuleCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = ShaderError::SHADER_MODULE_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Creates a shader module from a shaderBuffer by a vulkan device
+	*
+	* @param device the vulkan device creating the shader module
+	* @param shaderBuffer the vector uin32_t buffer holding the shader file data
+	*
+	* @return SkResult(created shader module, ShaderError)
+	*/
+	inline SkResult<vk::ShaderModule, ShaderError> createShaderModule(const vk::Device& device, const std::vector<uint32_t>& shaderBuffer)
+	{
+		return createShaderModule(device, shaderBuffer.data(), shaderBuffer.size() * sizeof(uint32_t));
+	}
+
+	/*@brief Creates a shader module from a shader filename by a vulkan device
+	*
+	* @param device the vulkan device creating the shader module
+	* @param shaderFilename std::string containing the shader filename
+	*
+	* @return SkResult(created shader module, ShaderError)
+	*/
+	inline SkResult<vk::ShaderModule, ShaderError> createShaderModule(const vk::Device& device, const std::string_view shaderFilename)
+	{
+		SkResult result(static_cast<vk::ShaderModule>(vk::ShaderModule(nullptr)), static_cast<ShaderError>(ShaderError::NO_ERROR));
+
+		//The module is created straight from the mapping, without copying the code
+		MappedFile shaderFile;
+		if (error(shaderFile.open(shaderFilename)))
+		{
+			result.error = ShaderError::SHADER_FILE_OPENING_ERROR;
+			return result;
+		}
+
+		auto createShaderModuleResult = createShaderModule(device, static_cast<const uint32_t*>(shaderFile.getData()), shaderFile.getSize());
+		result.error = affectError(createShaderModuleResult, result.error);
+		result.value = createShaderModuleResult.value;
+
+		return result;
+	}
+
+	/*@brief Destroys a given vulkan shader module
+	*
+	* @param device The vulkan device ordered to destroy the shader module
+	* @param shaderModule The vulkan shader module to be destroyed
+	*
+	* @return SkResult(bool indicating if the operation worked(true) or not(false), ShaderError)
+	*/
+	inline SkResult<bool, ShaderError> destroyShaderModule(const vk::Device& device, vk::ShaderModule& shaderModule)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<ShaderError>(ShaderError::NO_ERROR));
+
+		try
+		{
+			device.destroyShaderModule(shaderModule);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = 0;
+			result.error = ShaderError::SHADER_MODULE_DELETION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*Shader modules created from .spv files, shared by every pipeline using the same code.
+	* Files are identified by path, their write time and size being checked on each request : an unchanged file is neither read nor hashed,
+	* a changed file is mapped and hashed, modules being keyed by content hash so that identical files share one module.
+	* Thread safe, modules replaced after a file change are kept alive until releaseStaleShaderModules() as pipelines may still be created from them*/
+	class ShaderModuleCache
+	{
+	public:
+		ShaderModuleCache(vk::Device logicDevice)
+			: device(logicDevice)
+		{
+
+		}
+
+		ShaderModuleCache(const ShaderModuleCache&) = delete;
+		ShaderModuleCache& operator=(const ShaderModuleCache&) = delete;
+
+		/*@brief Returns the shader module of a given .spv file, creating it only if no module holds the current content of the file
+		*
+		* @param shaderFilename The filename of the compiled shader
+		*
+		* @return SkResult(shader module owned by the cache, ShaderError)
+		*/
+		inline SkResult<vk::ShaderModule, ShaderError> getShaderModule(const std::string_view shaderFilename)
+		{
+			SkResult result(static_cast<vk::ShaderModule>(vk::ShaderModule(nullptr)), static_cast<ShaderError>(ShaderError::NO_ERROR));
+
+			std::error_code errorCode;
+			const std::filesystem::path shaderPath(shaderFilename);
+			const auto writeTime = std::filesystem::last_write_time(shaderPath, errorCode);
+			const uintmax_t fileSize = (errorCode ? 0 : std::filesystem::file_size(shaderPath, errorCode));
+
+			if (errorCode)
+			{
+				result.error = ShaderError::SHADER_FILE_OPENING_ERROR;
+				return result;
+			}
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+
+			/*UNCHANGED FILE*/
+			auto fileIterator = files.find(std::string(shaderFilename));
+			if (fileIterator != files.end() && fileIterator->second.writeTime == writeTime && fileIterator->second.fileSize == fileSize)
+			{
+				result.value = modules[fileIterator->second.contentHash].shaderModule;
+				return result;
+			}
+
+			/*NEW OR CHANGED FILE*/
+			MappedFile shaderFile;
+			if (error(shaderFile.open(shaderFilename)))
+			{
+				result.error = ShaderError::SHADER_FILE_OPENING_ERROR;
+				return result;
+			}
+
+			if (!isSpirvCode(shaderFile.getData(), shaderFile.getSize()))
+			{
+				result.error = ShaderError::INVALID_SPIRV_ERROR;
+				return result;
+			}
+
+			const uint64_t contentHash = hashBytes(shaderFile.getData(), shaderFile.getSize());
+
+			auto moduleIterator = modules.find(contentHash);
+			if (moduleIterator == modules.end())
+			{
+				auto createShaderModuleResult = createShaderModule(device, static_cast<const uint32_t*>(shaderFile.getData()), shaderFile.getSize());
+				if (error(createShaderModuleResult))
+				{
+					result.error = createShaderModuleResult.error;
+					return result;
+				}
+
+				moduleIterator = modules.emplace(contentHash, CachedShaderModule{ createShaderModuleResult.value, 0 }).first;
+			}
+
+			//Touched files may keep their content (a rebuild writing the same SPIR-V), their module is then kept
+			if (fileIterator != files.end() && fileIterator->second.contentHash != contentHash)
+			{
+				releaseModule(fileIterator->second.contentHash);
+			}
+
+			if (fileIterator == files.end() || fileIterator->second.contentHash != contentHash)
+			{
+				moduleIterator->second.fileCount++;
+			}
+
+			files[std::string(shaderFilename)] = ShaderFileStamp{ writeTime, fileSize, contentHash };
+
+			result.value = moduleIterator->second.shaderModule;
+			return result;
+		}
+
+		/*@brief Returns the content hash of a shader module of the cache, which identifies its code whatever its handle :
+		* a destroyed module's handle may be given back by the driver to a module holding other code
+		*
+		* @param shaderModule A shader module returned by getShaderModule(), not released yet
+		*
+		* @return SkResult(hash of the SPIR-V code of the module, ShaderError)
+		*/
+		inline SkResult<uint64_t, ShaderError> getShaderModuleHash(const vk::ShaderModule& shaderModule)
+		{
+			SkResult result(static_cast<uint64_t>(0), static_cast<ShaderError>(ShaderError::NO_ERROR));
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			for (const auto& module : modules)
+			{
+				if (module.second.shaderModule == shaderModule)
+				{
+					result.value = module.first;
+					return result;
+				}
+			}
+
+			for (const Pair<vk::ShaderModule, uint64_t>& staleModule : staleModules)
+			{
+				if (staleModule.a == shaderModule)
+				{
+					result.value = staleModule.b;
+					return result;
+				}
+			}
+
+			result.error = ShaderError::SHADER_MODULE_NOT_CACHED_ERROR;
+			return result;
+		}
+
+		/*Returns the number of distinct shader modules held by the cache*/
+		inline size_t getShaderModuleCount()
+		{
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			return modules.size();
+		}
+
+		/*@brief Destroys the modules replaced after a file change, once no pipeline is being created from them anymore
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), ShaderError)
+		*/
+		inline SkResult<bool, ShaderError> releaseStaleShaderModules()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<ShaderError>(ShaderError::NO_ERROR));
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			for (auto& staleModule : staleModules)
+			{
+				result.error = affectError(destroyShaderModule(device, staleModule.a), result.error);
+			}
+
+			staleModules.clear();
+
+			result.value = (result.error == ShaderError::NO_ERROR);
+			return result;
+		}
+
+		/*@brief Destroys every shader module of the cache
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), ShaderError)
+		*/
+		inline SkResult<bool, ShaderError> destroyShaderModules()
+		{
+			SkResult result = releaseStaleShaderModules();
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			for (auto& module : modules)
+			{
+				result.error = affectError(destroyShaderModule(device, module.second.shaderModule), result.error);
+			}
+
+			modules.clear();
+			files.clear();
+
+			result.value = (result.error == ShaderError::NO_ERROR);
+			return result;
+		}
+
+	private:
+		struct ShaderFileStamp
+		{
+			std::filesystem::file_time_type writeTime;
+			uintmax_t fileSize = 0;
+			uint64_t contentHash = 0;
+		};
+
+		struct CachedShaderModule
+		{
+			vk::ShaderModule shaderModule;
+			uint32_t fileCount = 0;
+		};
+
+		inline void releaseModule(const uint64_t contentHash)
+		{
+			auto moduleIterator = modules.find(contentHash);
+			if (moduleIterator != modules.end() && --moduleIterator->second.fileCount == 0)
+			{
+				staleModules.emplace_back(moduleIterator->second.shaderModule, contentHash);
+				modules.erase(moduleIterator);
+			}
+		}
+
+		vk::Device device;
+
+		std::unordered_map<std::string, ShaderFileStamp> files;
+		std::unordered_map<uint64_t, CachedShaderModule> modules;
+		std::vector<Pair<vk::ShaderModule, uint64_t>> staleModules;
+		std::mutex cacheMutex;
+	};
+
+	/*SPECIALIZATION CONSTANTS*/
+
+	/*Typed values of the specialization constants (layout(constant_id = N) const ...) of a shader stage, baked when the pipeline is created :
+	* the driver folds them like literals, so loop counts and feature toggles cost no uniform branch at runtime.
+	* Entries are kept sorted by constant id, two sets holding the same values being equal whatever the order they were set in*/
+	class SpecializationConstants
+	{
+	public:
+		SpecializationConstants()
+		{
+
+		}
+
+		/*@brief Sets the value of a specialization constant, replacing any previous value of the same constant
+		*
+		* @param constantId The constant_id of the constant in the shader
+		* @param value The value of the constant : bool (stored as a VkBool32), 32 or 64 bits integers and floats
+		*
+		* @return Reference to the constants, allowing chained calls
+		*/
+		template<typename T>
+		inline SpecializationConstants& set(const uint32_t constantId, const T value)
+		{
+			static_assert(std::is_same<T, bool>::value || (std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8)),
+				"Specialization constants are booleans, 32 or 64 bits integers or floats");
+
+			if constexpr (std::is_same<T, bool>::value)
+			{
+				const uint32_t booleanValue = (value ? 1 : 0);
+				setBytes(constantId, &booleanValue, sizeof(booleanValue));
+			}
+			else
+			{
+				setBytes(constantId, &value, sizeof(T));
+			}
+
+			return *this;
+		}
+
+		/*Returns true if no constant was set*/
+		inline bool isEmpty() const noexcept
+		{
+			return entries.empty();
+		}
+
+		/*Returns the map entries of the constants, sorted by constant id*/
+		inline const std::vector<vk::SpecializationMapEntry>& getEntries() const noexcept
+		{
+			return entries;
+		}
+
+		/*Returns the packed values of the constants*/
+		inline const std::vector<uint8_t>& getData() const noexcept
+		{
+			return data;
+		}
+
+		/*Returns the vulkan specialization info pointing into the constants, valid until they are modified or destroyed*/
+		inline vk::SpecializationInfo getSpecializationInfo() const noexcept
+		{
+			vk::SpecializationInfo specializationInfo = {};
+			specializationInfo.mapEntryCount = static_cast<uint32_t>(entries.size());
+			specializationInfo.pMapEntries = entries.data();
+			specializationInfo.dataSize = data.size();
+			specializationInfo.pData = data.data();
+
+			return specializationInfo;
+		}
+
+		/*@brief Appends the constants to the key of a cached object : entry count, then constant id, size and value words of each entry
+		*
+		* @param key The key receiving the constants
+		*/
+		inline void appendKey(std::vector<uint32_t>& key) const
+		{
+			key.push_back(static_cast<uint32_t>(entries.size()));
+			for (const vk::SpecializationMapEntry& entry : entries)
+			{
+				key.insert(key.end(), { entry.constantID, static_cast<uint32_t>(entry.size) });
+
+				//Sizes are 4 or 8 bytes, values are copied as whole words
+				const size_t firstWord = key.size();
+				key.resize(firstWord + entry.size / sizeof(uint32_t));
+				std::memcpy(key.data() + firstWord, data.data() + entry.offset, entry.size);
+			}
+		}
+
+	private:
+		inline void setBytes(const uint32_t constantId, const void* pValue, const size_t size)
+		{
+			auto entryIterator = std::lower_bound(entries.begin(), entries.end(), constantId, [](const vk::SpecializationMapEntry& entry, const uint32_t id)
+			{
+				return entry.constantID < id;
+			});
+
+			//Same constant and type : the value is overwritten in place
+			if (entryIterator != entries.end() && entryIterator->constantID == constantId)
+			{
+				if (entryIterator->size == size)
+				{
+					std::memcpy(data.data() + entryIterator->offset, pValue, size);
+					return;
+				}
+
+				const uint32_t removedSize = static_cast<uint32_t>(entryIterator->size);
+				data.erase(data.begin() + entryIterator->offset, data.begin() + entryIterator->offset + removedSize);
+				for (auto followingIterator = entryIterator + 1; followingIterator != entries.end(); followingIterator++)
+				{
+					followingIterator->offset -= removedSize;
+				}
+
+				entryIterator = entries.erase(entryIterator);
+			}
+
+			//Values are packed in constant id order, the following ones are moved by the size of the new value
+			const uint32_t offset = (entryIterator == entries.end() ? static_cast<uint32_t>(data.size()) : entryIterator->offset);
+			const uint8_t* pBytes = static_cast<const uint8_t*>(pValue);
+			data.insert(data.begin() + offset, pBytes, pBytes + size);
+
+			for (auto followingIterator = entryIterator; followingIterator != entries.end(); followingIterator++)
+			{
+				followingIterator->offset += static_cast<uint32_t>(size);
+			}
+
+			vk::SpecializationMapEntry entry = {};
+			entry.constantID = constantId;
+			entry.offset = offset;
+			entry.size = size;
+
+			entries.insert(entryIterator, entry);
+		}
+
+		std::vector<vk::SpecializationMapEntry> entries;
+		std::vector<uint8_t> data;
+	};
+
+	/*SHADER REFLECTION*/
+
+	/*Descriptor binding declared by a shader, descriptorCount being 0 for runtime arrays (sized by the application)*/
+	struct ReflectedBinding
+	{
+		uint32_t set = 0;
+		uint32_t binding = 0;
+		vk::DescriptorType descriptorType = vk::DescriptorType::eUniformBuffer;
+		uint32_t descriptorCount = 1;
+	};
+
+	/*Input of a vertex shader, format being the 32 bits type seen by the shader*/
+	struct ReflectedVertexInput
+	{
+		uint32_t location = 0;
+		vk::Format format = vk::Format::eUndefined;
+		uint32_t size = 0;
+	};
+
+	/*Specialization constant declared by a shader, size being the size expected in the specialization data (4 for booleans)*/
+	struct ReflectedSpecializationConstant
+	{
+		uint32_t constantId = 0;
+		uint32_t size = 0;
+		uint64_t defaultValue = 0;
+	};
+
+	/*Resources and interface of the entry point of a SPIR-V module*/
+	struct ShaderReflection
+	{
+		vk::ShaderStageFlagBits stage = vk::ShaderStageFlagBits::eVertex;
+		std::string entryPoint;
+
+		//Sorted by set then binding
+		std::vector<ReflectedBinding> bindings;
+
+		//Range of the push constant block, size is 0 without push constants
+		uint32_t pushConstantOffset = 0;
+		uint32_t pushConstantSize = 0;
+
+		//Vertex shaders only, sorted by location
+		std::vector<ReflectedVertexInput> vertexInputs;
+
+		//Compute shaders only
+		std::array<uint32_t, 3> localSize = { 0, 0, 0 };
+
+		//Sorted by constant id
+		std::vector<ReflectedSpecializationConstant> specializationConstants;
+	};
+
+	/*@brief Reflects the first entry point of a SPIR-V module : descriptor bindings, push constant range, vertex inputs, workgroup size and specialization constants.
+	* Only the declarations of the module are read (types, variables and decorations), function bodies are skipped
+	*
+	* @param pCode Pointer to the SPIR-V code
+	* @param codeSize The size of the code in bytes
+	*
+	* @return SkResult(reflection of the module, ReflectionError)
+	*/
+	inline SkResult<ShaderReflection, ReflectionError> reflectShader(const uint32_t* pCode, const size_t codeSize)
+	{
+		SkResult result(static_cast<ShaderReflection>(ShaderReflection()), static_cast<ReflectionError>(ReflectionError::NO_ERROR));
+
+		if (!isSpirvCode(pCode, codeSize))
+		{
+			result.error = ReflectionError::INVALID_SPIRV_ERROR;
+			return result;
+		}
+
+		/*Ids of the module : opcode and operands of the instruction declaring them, and their decorations*/
+		struct SpirvId
+		{
+			uint32_t opcode = 0;
+			std::vector<uint32_t> operands;
+
+			uint32_t set = 0;
+			uint32_t binding = 0;
+			uint32_t location = std::numeric_limits<uint32_t>::max();
+			uint32_t specId = std::numeric_limits<uint32_t>::max();
+			uint32_t arrayStride = 0;
+			bool isBuiltIn = false;
+			bool isBufferBlock = false;
+
+			//Structs only, per member
+			std::vector<uint32_t> memberOffsets;
+			std::vector<uint32_t> memberMatrixStrides;
+			std::vector<bool> memberRowMajor;
+		};
+
+		struct SpirvVariable
+		{
+			uint32_t id = 0;
+			uint32_t pointerTypeId = 0;
+			uint32_t storageClass = 0;
+		};
+
+		struct SpirvSpecConstant
+		{
+			uint32_t id = 0;
+			uint32_t typeId = 0;
+			uint64_t defaultValue = 0;
+		};
+
+		const size_t wordCount = codeSize / sizeof(uint32_t);
+
+		std::unordered_map<uint32_t, SpirvId> ids;
+		std::vector<SpirvVariable> variables;
+		std::vector<SpirvSpecConstant> specConstants;
+
+		uint32_t executionModel = std::numeric_limits<uint32_t>::max();
+		uint32_t entryPointId = 0;
+
+		auto growMembers = [](SpirvId& id, const uint32_t member)
+		{
+			//Member indices come from the module, bounded to keep a malformed one from allocating gigabytes
+			if (member >= 4096)
+			{
+				return false;
+			}
+
+			if (id.memberOffsets.size() <= member)
+			{
+				id.memberOffsets.resize(member + 1, std::numeric_limits<uint32_t>::max());
+				id.memberMatrixStrides.resize(member + 1, 0);
+				id.memberRowMajor.resize(member + 1, false);
+			}
+
+			return true;
+		};
+
+		/*DECLARATIONS*/
+		for (size_t i = 5; i < wordCount;)
+		{
+			const uint32_t opcode = pCode[i] & 0xFFFF;
+			const uint32_t instructionWordCount = pCode[i] >> 16;
+			if (instructionWordCount == 0 || instructionWordCount > wordCount - i)
+			{
+				result.error = ReflectionError::INVALID_SPIRV_ERROR;
+				return result;
+			}
+
+			const uint32_t* pOperands = pCode + i + 1;
+			const uint32_t operandCount = instructionWordCount - 1;
+			i += instructionWordCount;
+
+			switch (opcode)
+			{
+			case 15: //OpEntryPoint : execution model, id, name, interface
+				if (operandCount >= 3 && entryPointId == 0)
+				{
+					executionModel = pOperands[0];
+					entryPointId = pOperands[1];
+
+					const char* pName = reinterpret_cast<const char*>(pOperands + 2);
+					result.value.entryPoint.assign(pName, strnlen(pName, (operandCount - 2) * sizeof(uint32_t)));
+				}
+				break;
+
+			case 16: //OpExecutionMode : entry point, mode, literals
+				if (operandCount >= 5 && pOperands[0] == entryPointId && pOperands[1] == 17) //LocalSize
+				{
+					result.value.localSize = { pOperands[2], pOperands[3], pOperands[4] };
+				}
+				break;
+
+			case 71: //OpDecorate : target, decoration, literal
+				if (operandCount >= 2)
+				{
+					SpirvId& target = ids[pOperands[0]];
+					const uint32_t literal = (operandCount >= 3 ? pOperands[2] : 0);
+
+					switch (pOperands[1])
+					{
+					case 1:  target.specId = literal; break;
+					case 3:  target.isBufferBlock = true; break;
+					case 6:  target.arrayStride = literal; break;
+					case 11: target.isBuiltIn = true; break;
+					case 30: target.location = literal; break;
+					case 33: target.binding = literal; break;
+					case 34: target.set = literal; break;
+					default: break;
+					}
+				}
+				break;
+
+			case 72: //OpMemberDecorate : struct, member, decoration, literal
+				if (operandCount >= 3)
+				{
+					SpirvId& target = ids[pOperands[0]];
+					const uint32_t member = pOperands[1];
+					const uint32_t literal = (operandCount >= 4 ? pOperands[3] : 0);
+
+					if (!growMembers(target, member))
+					{
+						result.error = ReflectionError::INVALID_SPIRV_ERROR;
+						return result;
+					}
+
+					switch (pOperands[2])
+					{
+					case 4:  target.memberRowMajor[member] = true; break;
+					case 7:  target.memberMatrixStrides[member] = literal; break;
+					case 35: target.memberOffsets[member] = literal; break;
+					default: break;
+					}
+				}
+				break;
+
+			case 43: //OpConstant : result type, id, value (low word)
+				if (operandCount >= 3)
+				{
+					SpirvId& constant = ids[pOperands[1]];
+					constant.opcode = opcode;
+					constant.operands = { pOperands[0], pOperands[2] };
+				}
+				break;
+
+			case 48: //OpSpecConstantTrue : result type, id
+			case 49: //OpSpecConstantFalse : result type, id
+				if (operandCount >= 2)
+				{
+					specConstants.emplace_back(SpirvSpecConstant{ pOperands[1], pOperands[0], (opcode == 48 ? 1u : 0u) });
+				}
+				break;
+
+			case 50: //OpSpecConstant : result type, id, value (one or two words)
+				if (operandCount >= 3)
+				{
+					uint64_t defaultValue = pOperands[2];
+					if (operandCount >= 4)
+					{
+						defaultValue |= static_cast<uint64_t>(pOperands[3]) << 32;
+					}
+
+					specConstants.emplace_back(SpirvSpecConstant{ pOperands[1], pOperands[0], defaultValue });
+				}
+				break;
+
+			case 59: //OpVariable : result type, id, storage class
+				if (operandCount >= 3 && pOperands[2] != 7) //Function variables are not part of the interface
+				{
+					variables.emplace_back(SpirvVariable{ pOperands[1], pOperands[0], pOperands[2] });
+				}
+				break;
+
+			default:
+				//Type declarations : OpTypeVoid (19) to OpTypeStruct (30), OpTypePointer (32), OpTypeAccelerationStructureKHR (5341)
+				if (((opcode >= 19 && opcode <= 30) || opcode == 32 || opcode == 5341) && operandCount >= 1)
+				{
+					SpirvId& type = ids[pOperands[0]];
+					type.opcode = opcode;
+					type.operands.assign(pOperands + 1, pOperands + operandCount);
+				}
+				break;
+			}
+		}
+
+		/*STAGE*/
+		switch (executionModel)
+		{
+		case 0:    result.value.stage = vk::ShaderStageFlagBits::eVertex; break;
+		case 1:    result.value.stage = vk::ShaderStageFlagBits::eTessellationControl; break;
+		case 2:    result.value.stage = vk::ShaderStageFlagBits::eTessellationEvaluation; break;
+		case 3:    result.value.stage = vk::ShaderStageFlagBits::eGeometry; break;
+		case 4:    result.value.stage = vk::ShaderStageFlagBits::eFragment; break;
+		case 5:    result.value.stage = vk::ShaderStageFlagBits::eCompute; break;
+		case 5267: result.value.stage = vk::ShaderStageFlagBits::eTaskNV; break;
+		case 5268: result.value.stage = vk::ShaderStageFlagBits::eMeshNV; break;
+		default:
+			result.error = (entryPointId == 0 ? ReflectionError::INVALID_SPIRV_ERROR : ReflectionError::UNSUPPORTED_STAGE_ERROR);
+			return result;
+		}
+
+		auto findId = [&ids](const uint32_t id) -> const SpirvId*
+		{
+			auto idIterator = ids.find(id);
+			return (idIterator != ids.end() && idIterator->second.opcode != 0 ? &idIterator->second : nullptr);
+		};
+
+		auto getArrayLength = [&findId](const SpirvId& arrayType) -> uint32_t
+		{
+			const SpirvId* pLength = (arrayType.operands.size() >= 2 ? findId(arrayType.operands[1]) : nullptr);
+			return (pLength != nullptr && pLength->opcode == 43 ? pLength->operands[1] : 0);
+		};
+
+		//Size in bytes of a type laid out in a buffer (explicit offsets and strides), depth bounded against cyclic malformed modules
+		std::function<uint32_t(uint32_t, uint32_t, bool, uint32_t)> getTypeSize = [&](const uint32_t typeId, const uint32_t matrixStride, const bool isRowMajor, const uint32_t depth) -> uint32_t
+		{
+			const SpirvId* pType = findId(typeId);
+			if (pType == nullptr || depth > 32)
+			{
+				return 0;
+			}
+
+			const std::vector<uint32_t>& operands = pType->operands;
+			switch (pType->opcode)
+			{
+			case 20: return 4;
+			case 21: case 22: return (operands.empty() ? 0 : operands[0] / 8);
+			case 23: return (operands.size() < 2 ? 0 : operands[1] * getTypeSize(operands[0], 0, false, depth + 1));
+			case 24:
+			{
+				if (operands.size() < 2)
+				{
+					return 0;
+				}
+
+				//Column major : one stride per column, row major : one stride per row (component of a column)
+				const SpirvId* pColumn = findId(operands[0]);
+				uint32_t rowCount = (pColumn != nullptr && pColumn->operands.size() >= 2 ? pColumn->operands[1] : 0);
+				uint32_t vectorCount = (isRowMajor ? rowCount : operands[1]);
+
+				return (matrixStride > 0 ? vectorCount * matrixStride : operands[1] * getTypeSize(operands[0], 0, false, depth + 1));
+			}
+			case 28:
+			{
+				uint32_t elementSize = (pType->arrayStride > 0 ? pType->arrayStride : getTypeSize(operands[0], matrixStride, isRowMajor, depth + 1));
+				return getArrayLength(*pType) * elementSize;
+			}
+			case 30:
+			{
+				uint32_t structSize = 0;
+				for (uint32_t member = 0; member < operands.size(); member++)
+				{
+					bool hasOffset = (member < pType->memberOffsets.size() && pType->memberOffsets[member] != std::numeric_limits<uint32_t>::max());
+					uint32_t memberOffset = (hasOffset ? pType->memberOffsets[member] : structSize);
+					uint32_t memberMatrixStride = (member < pType->memberMatrixStrides.size() ? pType->memberMatrixStrides[member] : 0);
+					bool isMemberRowMajor = (member < pType->memberRowMajor.size() && pType->memberRowMajor[member]);
+
+					structSize = std::max(structSize, memberOffset + getTypeSize(operands[member], memberMatrixStride, isMemberRowMajor, depth + 1));
+				}
+
+				return structSize;
+			}
+			default: return 0;
+			}
+		};
+
+		/*VARIABLES*/
+		for (const SpirvVariable& variable : variables)
+		{
+			const SpirvId* pPointer = findId(variable.pointerTypeId);
+			const SpirvId& decorations = ids[variable.id];
+
+			if (pPointer == nullptr || pPointer->opcode != 32 || pPointer->operands.size() < 2 || decorations.isBuiltIn)
+			{
+				continue;
+			}
+
+			//Arrays of resources are unwrapped into a descriptor count
+			uint32_t typeId = pPointer->operands[1];
+			uint32_t descriptorCount = 1;
+
+			const SpirvId* pType = findId(typeId);
+			while (pType != nullptr && (pType->opcode == 28 || pType->opcode == 29) && variable.storageClass != 1 && variable.storageClass != 9)
+			{
+				descriptorCount = (pType->opcode == 29 ? 0 : descriptorCount * getArrayLength(*pType));
+				typeId = pType->operands[0];
+				pType = findId(typeId);
+			}
+
+			if (pType == nullptr)
+			{
+				result.error = ReflectionError::INVALID_SPIRV_ERROR;
+				return result;
+			}
+
+			ReflectedBinding binding;
+			binding.set = decorations.set;
+			binding.binding = decorations.binding;
+			binding.descriptorCount = descriptorCount;
+
+			switch (variable.storageClass)
+			{
+			case 0: //UniformConstant
+				if (pType->opcode == 26)
+				{
+					binding.descriptorType = vk::DescriptorType::eSampler;
+				}
+				else if (pType->opcode == 27)
+				{
+					binding.descriptorType = vk::DescriptorType::eCombinedImageSampler;
+				}
+				else if (pType->opcode == 25 && pType->operands.size() >= 6)
+				{
+					//Image operands : sampled type, dim, depth, arrayed, multisampled, sampled (1 = sampled, 2 = storage)
+					const uint32_t dim = pType->operands[1];
+					const bool isStorage = (pType->operands[5] == 2);
+
+					if (dim == 5)
+					{
+						binding.descriptorType = (isStorage ? vk::DescriptorType::eStorageTexelBuffer : vk::DescriptorType::eUniformTexelBuffer);
+					}
+					else if (dim == 6)
+					{
+						binding.descriptorType = vk::DescriptorType::eInputAttachment;
+					}
+					else
+					{
+						binding.descriptorType = (isStorage ? vk::DescriptorType::eStorageImage : vk::DescriptorType::eSampledImage);
+					}
+				}
+				else
+				{
+					result.error = ReflectionError::UNSUPPORTED_RESOURCE_ERROR;
+					return result;
+				}
+
+				result.value.bindings.emplace_back(binding);
+				break;
+
+			case 2: //Uniform, BufferBlock being the storage buffers of SPIR-V < 1.3
+				binding.descriptorType = (pType->isBufferBlock ? vk::DescriptorType::eStorageBuffer : vk::DescriptorType::eUniformBuffer);
+				result.value.bindings.emplace_back(binding);
+				break;
+
+			case 12: //StorageBuffer
+				binding.descriptorType = vk::DescriptorType::eStorageBuffer;
+				result.value.bindings.emplace_back(binding);
+				break;
+
+			case 9: //PushConstant
+			{
+				uint32_t firstOffset = std::numeric_limits<uint32_t>::max();
+				for (const uint32_t memberOffset : pType->memberOffsets)
+				{
+					firstOffset = std::min(firstOffset, memberOffset);
+				}
+
+				result.value.pushConstantOffset = (firstOffset == std::numeric_limits<uint32_t>::max() ? 0 : firstOffset);
+				result.value.pushConstantSize = getTypeSize(typeId, 0, false, 0) - result.value.pushConstantOffset;
+				break;
+			}
+
+			case 1: //Input
+			{
+				if (result.value.stage != vk::ShaderStageFlagBits::eVertex || decorations.location == std::numeric_limits<uint32_t>::max())
+				{
+					break;
+				}
+
+				//Matrices and arrays take one location per column or element
+				uint32_t locationCount = 1;
+				if (pType->opcode == 24 || pType->opcode == 28)
+				{
+					locationCount = (pType->opcode == 24 ? (pType->operands.size() >= 2 ? pType->operands[1] : 0) : getArrayLength(*pType));
+					pType = findId(pType->operands[0]);
+				}
+
+				const SpirvId* pComponent = (pType != nullptr && pType->opcode == 23 ? findId(pType->operands[0]) : pType);
+				const uint32_t componentCount = (pType != nullptr && pType->opcode == 23 && pType->operands.size() >= 2 ? pType->operands[1] : 1);
+
+				if (pComponent == nullptr || (pComponent->opcode != 21 && pComponent->opcode != 22) || pComponent->operands.empty() || pComponent->operands[0] != 32 ||
+				    componentCount < 1 || componentCount > 4 || locationCount > 16)
+				{
+					result.error = ReflectionError::UNSUPPORTED_RESOURCE_ERROR;
+					return result;
+				}
+
+				static const std::array<std::array<vk::Format, 4>, 3> formats = { {
+					{ vk::Format::eR32Sfloat, vk::Format::eR32G32Sfloat, vk::Format::eR32G32B32Sfloat, vk::Format::eR32G32B32A32Sfloat },
+					{ vk::Format::eR32Sint,   vk::Format::eR32G32Sint,   vk::Format::eR32G32B32Sint,   vk::Format::eR32G32B32A32Sint },
+					{ vk::Format::eR32Uint,   vk::Format::eR32G32Uint,   vk::Format::eR32G32B32Uint,   vk::Format::eR32G32B32A32Uint } } };
+
+				//OpTypeInt operands : width, signedness
+				size_t formatRow = (pComponent->opcode == 22 ? 0 : (pComponent->operands.size() >= 2 && pComponent->operands[1] == 1 ? 1 : 2));
+
+				for (uint32_t i = 0; i < locationCount; i++)
+				{
+					ReflectedVertexInput vertexInput;
+					vertexInput.location = decorations.location + i;
+					vertexInput.format = formats[formatRow][componentCount - 1];
+					vertexInput.size = componentCount * static_cast<uint32_t>(sizeof(uint32_t));
+
+					result.value.vertexInputs.emplace_back(vertexInput);
+				}
+				break;
+			}
+
+			default:
+				break;
+			}
+		}
+
+		/*SPECIALIZATION CONSTANTS*/
+		for (const SpirvSpecConstant& specConstant : specConstants)
+		{
+			const uint32_t specId = ids[specConstant.id].specId;
+			const SpirvId* pType = findId(specConstant.typeId);
+
+			//Constants without SpecId (members of spec constant composites) cannot be set by the application
+			if (specId == std::numeric_limits<uint32_t>::max() || pType == nullptr)
+			{
+				continue;
+			}
+
+			ReflectedSpecializationConstant reflectedConstant;
+			reflectedConstant.constantId = specId;
+			reflectedConstant.size = (pType->opcode == 20 ? 4 : (pType->operands.empty() ? 0 : pType->operands[0] / 8));
+			reflectedConstant.defaultValue = specConstant.defaultValue;
+
+			result.value.specializationConstants.emplace_back(reflectedConstant);
+		}
+
+		std::sort(result.value.specializationConstants.begin(), result.value.specializationConstants.end(), [](const ReflectedSpecializationConstant& lhs, const ReflectedSpecializationConstant& rhs)
+		{
+			return lhs.constantId < rhs.constantId;
+		});
+
+		std::sort(result.value.bindings.begin(), result.value.bindings.end(), [](const ReflectedBinding& lhs, const ReflectedBinding& rhs)
+		{
+			return (lhs.set != rhs.set ? lhs.set < rhs.set : lhs.binding < rhs.binding);
+		});
+
+		std::sort(result.value.vertexInputs.begin(), result.value.vertexInputs.end(), [](const ReflectedVertexInput& lhs, const ReflectedVertexInput& rhs)
+		{
+			return lhs.location < rhs.location;
+		});
+
+		return result;
+	}
+
+	/*@brief Reflects a SPIR-V module loaded by loadShaderFileInBuffer()
+	*
+	* @param shaderBuffer The words of the module
+	*
+	* @return SkResult(reflection of the module, ReflectionError)
+	*/
+	inline SkResult<ShaderReflection, ReflectionError> reflectShader(const std::vector<uint32_t>& shaderBuffer)
+	{
+		return reflectShader(shaderBuffer.data(), shaderBuffer.size() * sizeof(uint32_t));
+	}
+
+	/*@brief Checks that specialization constants match the ones declared by a shader, a constant of the wrong size being read as garbage by the driver
+	*
+	* @param reflection The reflection of the shader
+	* @param specializationConstants The constants given to the shader stage
+	*
+	* @return SkResult(boolean indicating if the constants match(true) or not(false), ReflectionError)
+	*/
+	inline SkResult<bool, ReflectionError> checkSpecializationConstants(const ShaderReflection& reflection, const SpecializationConstants& specializationConstants)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<ReflectionError>(ReflectionError::NO_ERROR));
+
+		for (const vk::SpecializationMapEntry& entry : specializationConstants.getEntries())
+		{
+			auto constantIterator = std::find_if(reflection.specializationConstants.begin(), reflection.specializationConstants.end(),
+				[&entry](const ReflectedSpecializationConstant& constant) { return constant.constantId == entry.constantID; });
+
+			if (constantIterator == reflection.specializationConstants.end())
+			{
+				result.value = false;
+				result.error = ReflectionError::UNKNOWN_SPECIALIZATION_CONSTANT_ERROR;
+				return result;
+			}
+
+			if (constantIterator->size != entry.size)
+			{
+				result.value = false;
+				result.error = ReflectionError::SPECIALIZATION_CONSTANT_SIZE_ERROR;
+				return result;
+			}
+		}
+
+		return result;
+	}
+
+	/*Descriptor set layouts (index = set number) and push constant ranges of a pipeline layout*/
+	struct PipelineLayoutDescription
+	{
+		std::vector<std::vector<vk::DescriptorSetLayoutBinding>> setBindings;
+		std::vector<vk::PushConstantRange> pushConstantRanges;
+	};
+
+	/*@brief Merges the reflections of the stages of a pipeline into the description of its layout.
+	* Bindings used by several stages get the flags of every stage, push constants become one range visible to every stage using them
+	*
+	* @param reflections The reflections of the stages of the pipeline
+	*
+	* @return SkResult(description of the pipeline layout, ReflectionError) : BINDING_CONFLICT_ERROR if stages disagree on a binding
+	*/
+	inline SkResult<PipelineLayoutDescription, ReflectionError> mergeShaderReflections(const std::vector<ShaderReflection>& reflections)
+	{
+		SkResult result(static_cast<PipelineLayoutDescription>(PipelineLayoutDescription()), static_cast<ReflectionError>(ReflectionError::NO_ERROR));
+
+		PipelineLayoutDescription description;
+
+		vk::PushConstantRange pushConstantRange = {};
+		uint32_t pushConstantEnd = 0;
+		pushConstantRange.offset = std::numeric_limits<uint32_t>::max();
+
+		for (const ShaderReflection& reflection : reflections)
+		{
+			for (const ReflectedBinding& reflectedBinding : reflection.bindings)
+			{
+				//Set numbers come from the shader, 32 is far above the maxBoundDescriptorSets of any device
+				if (reflectedBinding.set >= 32)
+				{
+					result.error = ReflectionError::UNSUPPORTED_RESOURCE_ERROR;
+					return result;
+				}
+
+				if (description.setBindings.size() <= reflectedBinding.set)
+				{
+					description.setBindings.resize(reflectedBinding.set + 1);
+				}
+
+				std::vector<vk::DescriptorSetLayoutBinding>& setBindings = description.setBindings[reflectedBinding.set];
+
+				auto bindingIterator = std::find_if(setBindings.begin(), setBindings.end(), [&reflectedBinding](const vk::DescriptorSetLayoutBinding& binding)
+				{
+					return binding.binding == reflectedBinding.binding;
+				});
+
+				if (bindingIterator == setBindings.end())
+				{
+					vk::DescriptorSetLayoutBinding binding = {};
+					binding.binding = reflectedBinding.binding;
+					binding.descriptorType = reflectedBinding.descriptorType;
+					binding.descriptorCount = reflectedBinding.descriptorCount;
+					binding.stageFlags = reflection.stage;
+
+					setBindings.emplace_back(binding);
+				}
+				else if (bindingIterator->descriptorType != reflectedBinding.descriptorType || bindingIterator->descriptorCount != reflectedBinding.descriptorCount)
+				{
+					result.error = ReflectionError::BINDING_CONFLICT_ERROR;
+					return result;
+				}
+				else
+				{
+					bindingIterator->stageFlags |= reflection.stage;
+				}
+			}
+
+			if (reflection.pushConstantSize > 0)
+			{
+				pushConstantRange.stageFlags |= reflection.stage;
+				pushConstantRange.offset = std::min(pushConstantRange.offset, reflection.pushConstantOffset);
+				pushConstantEnd = std::max(pushConstantEnd, reflection.pushConstantOffset + reflection.pushConstantSize);
+			}
+		}
+
+		for (auto& setBindings : description.setBindings)
+		{
+			std::sort(setBindings.begin(), setBindings.end(), [](const vk::DescriptorSetLayoutBinding& lhs, const vk::DescriptorSetLayoutBinding& rhs)
+			{
+				return lhs.binding < rhs.binding;
+			});
+		}
+
+		if (pushConstantEnd > 0)
+		{
+			pushConstantRange.size = pushConstantEnd - pushConstantRange.offset;
+			description.pushConstantRanges.emplace_back(pushConstantRange);
+		}
+
+		result.value = std::move(description);
+		return result;
+	}
+
+	/*@brief Builds the vertex input of a pipeline from the reflection of its vertex shader, attributes being packed in location order.
+	* Locations below firstInstanceLocation are read from a per vertex stream at binding 0, the others from a per instance stream at binding 1 :
+	* the vertex shaders of the repository read Vertex and InstanceData that way. Quantized layouts (CompactVertex) keep VertexLayout
+	*
+	* @param reflection The reflection of the vertex shader
+	* @param firstInstanceLocation The first location read per instance (none by default)
+	*
+	* @return SkResult(vertex input bindings and attributes, ReflectionError)
+	*/
+	inline SkResult<VertexInputDescription, ReflectionError> createReflectedVertexInputDescription(const ShaderReflection& reflection,
+		const uint32_t firstInstanceLocation = std::numeric_limits<uint32_t>::max())
+	{
+		SkResult result(static_cast<VertexInputDescription>(VertexInputDescription()), static_cast<ReflectionError>(ReflectionError::NO_ERROR));
+
+		if (reflection.stage != vk::ShaderStageFlagBits::eVertex)
+		{
+			result.error = ReflectionError::UNSUPPORTED_STAGE_ERROR;
+			return result;
+		}
+
+		std::array<uint32_t, 2> strides = { 0, 0 };
+		for (const ReflectedVertexInput& vertexInput : reflection.vertexInputs)
+		{
+			uint32_t binding = (vertexInput.location >= firstInstanceLocation ? 1 : 0);
+
+			result.value.attributes.emplace_back(vertexInput.location, binding, vertexInput.format, strides[binding]);
+			strides[binding] += vertexInput.size;
+		}
+
+		for (uint32_t binding = 0; binding < 2; binding++)
+		{
+			if (strides[binding] > 0)
+			{
+				vk::VertexInputBindingDescription bindingDescription = {};
+				bindingDescription.binding = binding;
+				bindingDescription.stride = strides[binding];
+				bindingDescription.inputRate = (binding == 0 ? vk::VertexInputRate::eVertex : vk::VertexInputRate::eInstance);
+
+				result.value.bindings.emplace_back(bindingDescription);
+			}
+		}
+
+		return result;
+	}
+
+	/*PIPELINES*/
+
+	/*@brief Creates a shader stage given its flags, module and entry name
+	*
+	* @param shaderStageFlag The vulkan shader stage flag indicating if the associated shader module is a vertex shader or a fragment shader
+	* @param shaderModule The vulkan shader module to be included in the shader stage
+	* @param entryName The name of the main() function of the shader
+	* @param pSpecializationInfo The vulkan specialization info holding the specialization constants of the stage, must outlive the pipeline creation (default is none)
+	*
+	* @return SkResult(created shader stage, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::PipelineShaderStageCreateInfo, GraphicsPipelineError> createPipelineShaderStageCreateInfo(const vk::ShaderStageFlagBits& shaderStageFlag, const vk::ShaderModule& shaderModule,
+		const std::string& entryName, const vk::SpecializationInfo* pSpecializationInfo = nullptr)
+	{
+		SkResult result(static_cast<vk::PipelineShaderStageCreateInfo>(vk::PipelineShaderStageCreateInfo{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		vk::PipelineShaderStageCreateInfo pipelineShaderStageCreateInfo = {};
+		try
+		{
+			pipelineShaderStageCreateInfo.stage = shaderStageFlag;
+			pipelineShaderStageCreateInfo.module = shaderModule;
+			pipelineShaderStageCreateInfo.pName = entryName.c_str();
+			pipelineShaderStageCreateInfo.pSpecializationInfo = pSpecializationInfo;
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::PIPELINE_SHADER_STAGE_CREATE_INFO_ERROR;
+		}
+
+		result.value = pipelineShaderStageCreateInfo;
+		return result;
+	}
+
+	/*@brief Creates a vector of shader stages given its flags, modules and entry names
+	*
+	* @param shaderStageFlags The vulkan shader stage flags indicating if each of the associated shaders are vertex or fragment shader
+	* @param shaderModules The vulkan shader modules to be included in the shader stage, originating from a given shader
+	* @param entryNames The names of the main() functions of the shaders
+	* @param specializationInfos The vulkan specialization infos of the stages, in stage order, empty ones and missing ones meaning no specialization (default is none)
+	*
+	* @return SkResult(created shader stage, GraphicsPipelineError)
+	*/
+	inline SkResult<std::vector<vk::PipelineShaderStageCreateInfo>, GraphicsPipelineError> createPipelineShaderStageCreateInfos(const std::vector<vk::ShaderStageFlagBits>& shaderStageFlags,
+		const std::vector<vk::ShaderModule>& shaderModules, const std::vector<std::string>& entryNames,
+		const std::vector<vk::SpecializationInfo>& specializationInfos = std::vector<vk::SpecializationInfo>())
+	{
+		SkResult result(static_cast<std::vector<vk::PipelineShaderStageCreateInfo>>(std::vector<vk::PipelineShaderStageCreateInfo>()), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		std::vector<vk::PipelineShaderStageCreateInfo> shaderStages;
+		shaderStages.reserve(shaderModules.size());
+		for (int i = 0; i < shaderModules.size(); i++)
+		{
+			const bool isSpecialized = (i < specializationInfos.size() && specializationInfos[i].mapEntryCount > 0);
+
+			auto createShaderStageResult = createPipelineShaderStageCreateInfo(shaderStageFlags[i], shaderModules[i], entryNames[i], (isSpecialized ? &specializationInfos[i] : nullptr));
+			shaderStages.emplace_back(retLog(createShaderStageResult));
+		}
+
+		result.value = std::move(shaderStages);
+		return result;
+	}
+
+	/*@brief Creates a vector of shader stages given a vulkan device, a vector of shader filenames, a vector of shader stage flags and a vector of shader entry names
+	*
+	* @param device The vulkan device used to create the shader stages(creation of the shader modules)
+	* @param shaderFilenames The shader filenames to be converted into shader modules
+	* @param shaderStageFlags The shader stage flags indicating if the given shaders are either vertex or fragment shaders
+	* @param entryNames
+	*
+	* @return SkResult(created vector of shader stages, GraphicsPipelineError)
+	*/
+	inline SkResult<std::vector<vk::PipelineShaderStageCreateInfo>, GraphicsPipelineError> createShaderStages(const vk::Device& device, const std::vector<std::string>& shaderFilenames,
+		const std::vector<vk::ShaderStageFlagBits>& shaderStageFlags, const std::vector<std::string>& entryNames)
+	{
+		SkResult result(static_cast<std::vector<vk::PipelineShaderStageCreateInfo>>(std::vector<vk::PipelineShaderStageCreateInfo>()), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		std::vector<vk::ShaderModule> shaderModules;
+		shaderModules.reserve(shaderFilenames.size());
+
+		for (uint32_t i = 0; i < shaderFilenames.size(); i++)
+		{
+			auto shaderModuleResult = createShaderModule(device, shaderFilenames[i]);
+			if (logError(shaderModuleResult))
+			{
+				for (auto& shaderModule : shaderModules)
+				{
+					logError(destroyShaderModule(device, shaderModule));
+				}
+
+				result.error = GraphicsPipelineError::PIPELINE_SHADER_STAGE_CREATE_INFO_ERROR;
+				return result;
+			}
+
+			shaderModules.emplace_back(shaderModuleResult.value);
+		}
+
+		auto createPipelineShaderStageCreateInfosResult = createPipelineShaderStageCreateInfos(shaderStageFlags, shaderModules, entryNames);
+		result.error = affectError(createPipelineShaderStageCreateInfosResult, result.error);
+		std::vector<vk::PipelineShaderStageCreateInfo> pipelineShaderStageCreateInfos = retLog(createPipelineShaderStageCreateInfosResult);
+
+		result.value = std::move(pipelineShaderStageCreateInfos);
+		return result;
+	}
+
+	/*@brief Creates a vector of shader stages whose shader modules come from a shader module cache : files already loaded are neither read nor recreated
+	*
+	* @param shaderModuleCache The cache owning the shader modules
+	* @param shaderFilenames The shader filenames to be converted into shader modules
+	* @param shaderStageFlags The shader stage flags indicating if the given shaders are either vertex or fragment shaders
+	* @param entryNames The names of the main() functions of the shaders
+	*
+	* @return SkResult(created vector of shader stages, GraphicsPipelineError)
+	*/
+	inline SkResult<std::vector<vk::PipelineShaderStageCreateInfo>, GraphicsPipelineError> createShaderStages(ShaderModuleCache& shaderModuleCache, const std::vector<std::string>& shaderFilenames,
+		const std::vector<vk::ShaderStageFlagBits>& shaderStageFlags, const std::vector<std::string>& entryNames)
+	{
+		SkResult result(static_cast<std::vector<vk::PipelineShaderStageCreateInfo>>(std::vector<vk::PipelineShaderStageCreateInfo>()), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		std::vector<vk::ShaderModule> shaderModules;
+		shaderModules.reserve(shaderFilenames.size());
+
+		for (const auto& shaderFilename : shaderFilenames)
+		{
+			auto getShaderModuleResult = shaderModuleCache.getShaderModule(shaderFilename);
+			if (logError(getShaderModuleResult))
+			{
+				result.error = GraphicsPipelineError::PIPELINE_SHADER_STAGE_CREATE_INFO_ERROR;
+				return result;
+			}
+
+			shaderModules.emplace_back(getShaderModuleResult.value);
+		}
+
+		auto createPipelineShaderStageCreateInfosResult = createPipelineShaderStageCreateInfos(shaderStageFlags, shaderModules, entryNames);
+		result.error = affectError(createPipelineShaderStageCreateInfosResult, result.error);
+		result.value = retLog(createPipelineShaderStageCreateInfosResult);
+
+		return result;
+	}
+
+	/*@brief Creates a vertex input state containing given input bindings and given input attributes
+	*
+	* @param vertexInputBindingDescriptions vector of input binding descriptions
+	* @param vertexInputAttributeDescriptions vector of input attribute descriptions
+	*
+	* @return SkResult(created vertex input state, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::PipelineVertexInputStateCreateInfo, GraphicsPipelineError> createPipelineVertexInputStateCreateInfo(const std::vector<vk::VertexInputBindingDescription>& vertexInputBindingDescriptions,
+		const std::vector<vk::VertexInputAttributeDescription>& vertexInputAttributeDescriptions)
+	{
+		SkResult result(static_cast<vk::PipelineVertexInputStateCreateInfo>(vk::PipelineVertexInputStateCreateInfo{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));;
+
+		vk::PipelineVertexInputStateCreateInfo pipelineVertexInputStateCreateInfo = {};
+		try
+		{
+			pipelineVertexInputStateCreateInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(vertexInputBindingDescriptions.size());
+			pipelineVertexInputStateCreateInfo.pVertexBindingDescriptions = vertexInputBindingDescriptions.data();
+
+			pipelineVertexInputStateCreateInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(vertexInputAttributeDescriptions.size());
+			pipelineVertexInputStateCreateInfo.pVertexAttributeDescriptions = vertexInputAttributeDescriptions.data();
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO_ERROR;
+		}
+
+		result.value = std::move(pipelineVertexInputStateCreateInfo);
+		return result;
+	}
+
+	/*@brief Creates an input assembly state containing a given primitive topology
+	*
+	* @param primitiveTopology the primitive topology (point, line list/strip, triangle list/strip) to be used in the pipeline
+	*
+	* @return SkResult(created assembly state, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::PipelineInputAssemblyStateCreateInfo, GraphicsPipelineError> createPipelineInputAssemblyStateCreateInfo(const vk::PrimitiveTopology primitiveTopology)
+	{
+		SkResult result(static_cast<vk::PipelineInputAssemblyStateCreateInfo>(vk::PipelineInputAssemblyStateCreateInfo{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		vk::PipelineInputAssemblyStateCreateInfo pipelineInputAssemblyStateCreateInfo = {};
+		try
+		{
+			pipelineInputAssemblyStateCreateInfo.topology = primitiveTopology;
+			pipelineInputAssemblyStateCreateInfo.primitiveRestartEnable = VK_FALSE;
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO_ERROR;
+		}
+
+		result.value = std::move(pipelineInputAssemblyStateCreateInfo);
+		return result;
+	}
+
+	/*@brief Creates a rasterization state containg a given polygonMode
+	*
+	* @param polygonMode The polygon mode to be used (fill, line, point) in the pipeline
+	*
+	* @return SkResult(created rasterization state, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::PipelineRasterizationStateCreateInfo, GraphicsPipelineError> createPipelineRasterizationStateCreateInfo(const vk::PolygonMode polygonMode)
+	{
+		SkResult result(static_cast<vk::PipelineRasterizationStateCreateInfo>(vk::PipelineRasterizationStateCreateInfo{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		vk::PipelineRasterizationStateCreateInfo pipelineRasterizationStateCreateInfo = {};
+		try
+		{
+			pipelineRasterizationStateCreateInfo.depthClampEnable = VK_FALSE;
+			pipelineRasterizationStateCreateInfo.rasterizerDiscardEnable = VK_FALSE;
+
+			pipelineRasterizationStateCreateInfo.polygonMode = polygonMode;
+			pipelineRasterizationStateCreateInfo.lineWidth = 1.0f;
+
+			pipelineRasterizationStateCreateInfo.cullMode = vk::CullModeFlagBits::eNone;
+			pipelineRasterizationStateCreateInfo.frontFace = vk::FrontFace::eClockwise;
+
+			pipelineRasterizationStateCreateInfo.depthBiasEnable = VK_FALSE;
+			pipelineRasterizationStateCreateInfo.depthBiasConstantFactor = 0.0f;
+			pipelineRasterizationStateCreateInfo.depthBiasClamp = 0.0f;
+			pipelineRasterizationStateCreateInfo.depthBiasSlopeFactor = 0.0f;
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::PIPELINE_RASTERIZATION_STATE_CREATE_INFO_ERROR;
+		}
+
+		result.value = std::move(pipelineRasterizationStateCreateInfo);
+		return result;
+	}
+
+	/*@brief Creates a multisample state
+	*
+	* @param sampleShadingEnabled Is sample shading enabled ?
+	* @param sampleCountFlag Rasterization sample count, must match the sample count of the render pass attachments
+	*
+	* @return SkResult(created multisample state, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::PipelineMultisampleStateCreateInfo, GraphicsPipelineError> createPipelineMultisampleStateCreateInfo(bool sampleShadingEnabled = false,
+		vk::SampleCountFlagBits sampleCountFlag = vk::SampleCountFlagBits::e1)
+	{
+		SkResult result(static_cast<vk::PipelineMultisampleStateCreateInfo>(vk::PipelineMultisampleStateCreateInfo{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		vk::PipelineMultisampleStateCreateInfo pipelineMultisampleStateCreateInfo = {};
+		try
+		{
+			pipelineMultisampleStateCreateInfo.sampleShadingEnable = (sampleShadingEnabled ? VK_TRUE : VK_FALSE);
+			pipelineMultisampleStateCreateInfo.rasterizationSamples = sampleCountFlag;
+
+			pipelineMultisampleStateCreateInfo.minSampleShading = 1.0f;
+			pipelineMultisampleStateCreateInfo.pSampleMask = nullptr;
+
+			pipelineMultisampleStateCreateInfo.alphaToCoverageEnable = VK_FALSE;
+			pipelineMultisampleStateCreateInfo.alphaToOneEnable = VK_FALSE;
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::PIPELINE_MULTISAMPLE_STATE_CREATE_INFO_ERROR;
+		}
+
+		result.value = std::move(pipelineMultisampleStateCreateInfo);
+		return result;
+	}
+
+	/*@brief Creates a viewport according to a given extent
+	*
+	* @param extent The vulkan 2D extent to be used in the creation of the viewport
+	*
+	* @return SkResult(created viewport, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::Viewport, GraphicsPipelineError> createViewport(const vk::Extent2D& extent)
+	{
+		SkResult result(static_cast<vk::Viewport>(vk::Viewport{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		vk::Viewport viewport = {};
+		try
+		{
+			viewport.x = 0.0f;
+			viewport.y = 0.0f;
+
+			viewport.width = static_cast<float>(extent.width);
+			viewport.height = static_cast<float>(extent.height);
+
+			viewport.minDepth = 0.0f;
+			viewport.maxDepth = 1.0f;
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::VIEWPORT_CREATION_ERROR;
+		}
+
+		result.value = std::move(viewport);
+		return result;
+	}
+
+	/*@brief Creates a scissor according to a given extent
+	*
+	* @param extent The vulkan 2D extent to be used to create the scissor
+	*
+	* @return SkResult(created scissor, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::Rect2D, GraphicsPipelineError> createScissor(const vk::Extent2D& extent)
+	{
+		SkResult result(static_cast<vk::Rect2D>(vk::Rect2D{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+
+		vk::Rect2D scissor = {};
+		try
+		{
+			scissor.offset = vk::Offset2D{ 0, 0 };
+			scissor.extent = extent;
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::SCISSOR_CREATION_ERROR;
+		}
+
+		result.value = std::move(scissor);
+		return result;
+	}
+
+	/*@brief Creates a viewport state containing given viewports and given scissors
+	*
+	* @param viewports The vector of vulkan viewports to be used in the pipeline
+	* @param scissors The vector of vulkan scissors to be used in the pipeline
+	*
+	* @return SkResult(created viewport state, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::PipelineViewportStateCreateInfo, GraphicsPipelineError> createPipelineViewportStateCreateInfo(const std::vector<vk::Viewport>& viewports, const std::vector<vk::Rect2D>& scissors)
+	{
+		vk::PipelineViewportStateCreateInfo value = vk::PipelineViewportStateCreateInfo{};
+		GraphicsPipelineError error = GraphicsPipelineError::NO_ERROR;
+
+		vk::PipelineViewportStateCreateInfo pipelineViewportStateCreateInfo = {};
+		pipelineViewportStateCreateInfo.viewportCount = static_cast<uint32_t>(viewports.size());
+		pipelineViewportStateCreateInfo.pViewports = viewports.data();
+
+		pipelineViewportStateCreateInfo.scissorCount = static_cast<uint32_t>(scissors.size());
+		pipelineViewportStateCreateInfo.pScissors = scissors.data();
+
+		value = pipelineViewportStateCreateInfo;
+		return SkResult(value, error); // Error seems to be after returning this, value is corrupted
+	}
+
+	/*@brief Creates a color blend attachment state
+	*
+	* @param colorWriteMask The color write mask to be used in the pipeline
+	* @param blendEnabled Is blend enabled ?
+	*
+	* @return SkResult(created color blend attachment state, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::PipelineColorBlendAttachmentState, GraphicsPipelineError> createPipelineColorBlendAttachmentState(vk::Flags<vk::ColorComponentFlagBits> colorWriteMask = (vk::ColorComponentFlagBits::eR |
+		vk::ColorComponentFlagBits::eG |
+		vk::ColorComponentFlagBits::eG |
+		vk::ColorComponentFlagBits::eA),
+		bool blendEnabled = false)
+	{
+		SkResult result(static_cast<vk::PipelineColorBlendAttachmentState>(vk::PipelineColorBlendAttachmentState{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		vk::PipelineColorBlendAttachmentState pipelineColorBlendAttachmentState = {};
+		try
+		{
+			pipelineColorBlendAttachmentState.colorWriteMask = colorWriteMask;
+			pipelineColorBlendAttachmentState.blendEnable = blendEnabled ? VK_TRUE : VK_FALSE;
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::PIPELINE_COLOR_BLEND_ATTACHMENT_STATE_ERROR;
+		}
+
+		result.value = std::move(pipelineColorBlendAttachmentState);
+		return result;
+	}
+
+	/*@brief Creates a color blend state given color blend attachments
+	*
+	* @param colorBlendAttachments The vector of color blend attachments to be used in the pipeline
+	*
+	* @return SkResult(created color blend state, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::PipelineColorBlendStateCreateInfo, GraphicsPipelineError> createPipelineColorBlendStateCreateInfo(const std::vector<vk::PipelineColorBlendAttachmentState>& colorBlendAttachments)
+	{
+		SkResult result(static_cast<vk::PipelineColorBlendStateCreateInfo>(vk::PipelineColorBlendStateCreateInfo{}), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		vk::PipelineColorBlendStateCreateInfo pipelineColorBlendStateCreateInfo{};
+		try
+		{
+			pipelineColorBlendStateCreateInfo.logicOpEnable = VK_FALSE;
+			pipelineColorBlendStateCreateInfo.logicOp = vk::LogicOp::eCopy;
+
+			pipelineColorBlendStateCreateInfo.attachmentCount = static_cast<uint32_t>(colorBlendAttachments.size());
+			pipelineColorBlendStateCreateInfo.pAttachments = colorBlendAttachments.data();
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::PIPELINE_COLOR_BLEND_STATE_CREATE_INFO_ERROR;
+		}
+
+		result.value = std::move(pipelineColorBlendStateCreateInfo);
+		return result;
+	}
+
+	/*@brief Creates a pipeline layout with a given device
+	*
+	* @param device The vulkan device used to create the pipeline layout
+	*
+	* @return SkResult(created pipeline layout, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::PipelineLayout, GraphicsPipelineError> createPipelineLayout(const vk::Device& device)
+	{
+		SkResult result(static_cast<vk::PipelineLayout>(vk::PipelineLayout(nullptr)), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		vk::PipelineLayoutCreateInfo pipelineLayoutCreateInfo = {};
+		try
+		{
+			pipelineLayoutCreateInfo.setLayoutCount = 0;
+			pipelineLayoutCreateInfo.pSetLayouts = nullptr;
+
+			pipelineLayoutCreateInfo.pushConstantRangeCount = 0;
+			pipelineLayoutCreateInfo.pPushConstantRanges = nullptr;
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::PIPELINE_LAYOUT_CREATE_INFO_ERROR;
+		}
+
+		vk::PipelineLayout pipelineLayout = vk::PipelineLayout(nullptr);
+		try
+		{
+			pipelineLayout = device.createPipelineLayout(pipelineLayoutCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::PIPELINE_LAYOUT_CREATION_ERROR;
+		}
+
+		result.value = pipelineLayout;
+		return result;
+	}
+
+	/*@brief Creates a pipeline layout holding given descriptor set layouts and push constant ranges, usable by graphics and compute pipelines
+	*
+	* @param device The vulkan device used to create the pipeline layout
+	* @param descriptorSetLayouts The vulkan descriptor set layouts, in set number order
+	* @param pushConstantRanges The vulkan push constant ranges (default is none)
+	*
+	* @return SkResult(created pipeline layout, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::PipelineLayout, GraphicsPipelineError> createPipelineLayout(const vk::Device& device, const std::vector<vk::DescriptorSetLayout>& descriptorSetLayouts,
+		const std::vector<vk::PushConstantRange>& pushConstantRanges = std::vector<vk::PushConstantRange>())
+	{
+		SkResult result(static_cast<vk::PipelineLayout>(vk::PipelineLayout(nullptr)), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		vk::PipelineLayoutCreateInfo pipelineLayoutCreateInfo = {};
+		pipelineLayoutCreateInfo.setLayoutCount = static_cast<uint32_t>(descriptorSetLayouts.size());
+		pipelineLayoutCreateInfo.pSetLayouts = descriptorSetLayouts.data();
+
+		pipelineLayoutCreateInfo.pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size());
+		pipelineLayoutCreateInfo.pPushConstantRanges = pushConstantRanges.data();
+
+		try
+		{
+			result.value = device.createPipelineLayout(pipelineLayoutCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::PIPELINE_LAYOUT_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Destroys a given pipeline layout with a given device
+	*
+	* @param device The vulkan device used to destroy the given pipeline layout
+	* @param pipelineLayout The vulkan pipeline layout to be destroyed
+	*
+	* @return SkResult(boolean indicating if the operation worked(true) or not(false), GraphicsPipelineError)
+	*/
+	inline SkResult<bool, GraphicsPipelineError> destroyPipelineLayout(const vk::Device& device, const vk::PipelineLayout& pipelineLayout)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		try
+		{
+			device.destroyPipelineLayout(pipelineLayout);
+		}
+		catch (vk::SystemError error)
+		{
+			result.value = false;
+			result.error = GraphicsPipelineError::PIPELINE_LAYOUT_DESTRUCTION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Creates a basic graphics pipeline according to the given parameters
+	*
+	* @param device The vulkan device ordered to create the graphics pipeline
+	* @param renderPass The vulkan render pass to be used in the graphics pipeline
+	* @param pipelineLayout The vulkan pipeline layout to be used in the graphics pipeline
+	* @param extent The vulkan extent to be used in the graphics pipeline
+	* @param shaderStageFlags The vulkan shader stage flags to be used in the graphics pipeline
+	* @param shaderModules The vulkan shader modules to be used in the graphics pipeline
+	* @param entryNames The vulkan entry names to be used for the shaders in the graphics pipeline
+	* @param vertexInputBindingDescriptions The vulkan vertex input binding descriptions to be used in the graphics pipeline
+	* @param vertexInputAttributeDescriptions The vulkan vertex input attribute descriptions to be used in the graphics pipeline
+	* @param primitiveTopology The vulkan primitive topology to be used in the graphics pipeline
+	* @param polygonMode The vulkan polygon mode to be used in the graphics pipeline
+	* @param sampleShadingEnabled Is sample shading enabled in the graphics pipeline
+	* @param sampleCountFlag The sample count to be used in the graphics pipeline
+	* @param colorWriteMask The vulkan color write mask to be used in the graphics pipeline
+	* @param blendEnabled Is blend enabled in the graphics pipeline
+	* @param specializationInfos The vulkan specialization infos of the shader stages, in stage order (default is none)
+	* @param pipelineCache The vulkan pipeline cache used by the driver to reuse compiled code (default is none)
+	*
+	* @return SkResult(created graphics pipeline, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::Pipeline, GraphicsPipelineError> createGraphicsPipeline(const vk::Device& device, const vk::RenderPass& renderPass, const vk::PipelineLayout& pipelineLayout, const vk::Extent2D& extent,
+		                                                                        const std::vector<vk::ShaderStageFlagBits>& shaderStageFlags, const std::vector<vk::ShaderModule>& shaderModules, const std::vector<std::string>& entryNames,
+		                                                                        std::vector<vk::VertexInputBindingDescription> vertexInputBindingDescriptions = std::vector<vk::VertexInputBindingDescription>(),
+		                                                                        std::vector<vk::VertexInputAttributeDescription> vertexInputAttributeDescriptions = std::vector<vk::VertexInputAttributeDescription>(),
+		                                                                        vk::PrimitiveTopology primitiveTopology = vk::PrimitiveTopology::eTriangleList, vk::PolygonMode polygonMode = vk::PolygonMode::eFill,
+		                                                                        bool sampleShadingEnabled = false, vk::SampleCountFlagBits sampleCountFlag = vk::SampleCountFlagBits::e1,
+		                                                                        vk::Flags<vk::ColorComponentFlagBits> colorWriteMask = (vk::ColorComponentFlagBits::eR |
+		                                                                        	                                                    vk::ColorComponentFlagBits::eG |
+		                                                                        	                                                    vk::ColorComponentFlagBits::eG |
+		                                                                        	                                                    vk::ColorComponentFlagBits::eA),
+		                                                                        bool blendEnabled = false,
+		                                                                        const std::vector<vk::SpecializationInfo>& specializationInfos = std::vector<vk::SpecializationInfo>(),
+		                                                                        const vk::PipelineCache& pipelineCache = vk::PipelineCache(nullptr))
+	{
+		SkResult result(static_cast<vk::Pipeline>(vk::Pipeline(nullptr)), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		//Shader stages
+		auto createPipelineShaderStageCreateInfosResult = createPipelineShaderStageCreateInfos(shaderStageFlags, shaderModules, entryNames, specializationInfos);
+		result.error = affectError(createPipelineShaderStageCreateInfosResult, result.error);
+		std::vector<vk::PipelineShaderStageCreateInfo> shaderStages = retLog(createPipelineShaderStageCreateInfosResult);
+
+		//Vertex input
+		auto createPipelineVertexInputStateCreateInfoResult = createPipelineVertexInputStateCreateInfo(vertexInputBindingDescriptions, vertexInputAttributeDescriptions);
+		result.error = affectError(createPipelineVertexInputStateCreateInfoResult, result.error);
+		vk::PipelineVertexInputStateCreateInfo vertexInputState = retLog(createPipelineVertexInputStateCreateInfoResult);
+
+		//Input assembly
+		auto createPipelineInputAssemblyStateCreateInfoResult = createPipelineInputAssemblyStateCreateInfo(primitiveTopology);
+		result.error = affectError(createPipelineInputAssemblyStateCreateInfoResult, result.error);
+		vk::PipelineInputAssemblyStateCreateInfo inputAssemblyState = retLog(createPipelineInputAssemblyStateCreateInfoResult);
+
+		//Viewport
+		auto createViewportResult = createViewport(extent);
+		result.error = affectError(createViewportResult, result.error);
+		vk::Viewport viewport = retLog(createViewportResult);
+
+		auto createScissorResult = createScissor(extent);
+		result.error = affectError(createScissorResult, result.error);
+		vk::Rect2D scissor = retLog(createScissorResult);
+
+		std::vector<vk::Viewport> viewports = { viewport };
+		std::vector<vk::Rect2D> scissors = { scissor };
+		auto createPipelineViewportStateCreateInfoResult = createPipelineViewportStateCreateInfo(viewports, scissors);
+		result.error = affectError(createPipelineViewportStateCreateInfoResult, result.error);
+		vk::PipelineViewportStateCreateInfo viewportState = retLog(createPipelineViewportStateCreateInfoResult);
+
+		//Rasterization
+		auto createPipelineRasterizationStateCreateInfoResult = createPipelineRasterizationStateCreateInfo(polygonMode);
+		result.error = affectError(createPipelineRasterizationStateCreateInfoResult, result.error);
+		vk::PipelineRasterizationStateCreateInfo rasterizationState = retLog(createPipelineRasterizationStateCreateInfoResult);
+
+		//Multisample
+		auto createPipelineMultisampleStateCreateInfoResult = createPipelineMultisampleStateCreateInfo();
+		result.error = affectError(createPipelineMultisampleStateCreateInfoResult, result.error);
+		vk::PipelineMultisampleStateCreateInfo multisampleState = retLog(createPipelineMultisampleStateCreateInfoResult);
+
+		//Color blend
+		auto createPipelineColorBlendAttachmentStateResult = createPipelineColorBlendAttachmentState();
+		result.error = affectError(createPipelineColorBlendAttachmentStateResult, result.error);
+		vk::PipelineColorBlendAttachmentState colorBlendAttachmentState = retLog(createPipelineColorBlendAttachmentStateResult);
+
+		std::vector<vk::PipelineColorBlendAttachmentState> colorBlendAttachmentStates = { colorBlendAttachmentState };
+		auto createPipelineColorBlendStateCreateInfoResult = createPipelineColorBlendStateCreateInfo(colorBlendAttachmentStates);
+		result.error = affectError(createPipelineColorBlendStateCreateInfoResult, result.error);
+		vk::PipelineColorBlendStateCreateInfo colorBlendState = retLog(createPipelineColorBlendStateCreateInfoResult);
+
+		vk::GraphicsPipelineCreateInfo graphicsPipelineCreateInfo = {};
+		try
+		{
+			graphicsPipelineCreateInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
+			graphicsPipelineCreateInfo.pStages = shaderStages.data();
+
+			graphicsPipelineCreateInfo.pVertexInputState = &vertexInputState;
+
+			graphicsPipelineCreateInfo.pInputAssemblyState = &inputAssemblyState;
+
+			graphicsPipelineCreateInfo.pViewportState = &viewportState;
+
+			graphicsPipelineCreateInfo.pRasterizationState = &rasterizationState;
+
+			graphicsPipelineCreateInfo.pMultisampleState = &multisampleState;
+
+			graphicsPipelineCreateInfo.pColorBlendState = &colorBlendState;
+
+			graphicsPipelineCreateInfo.layout = pipelineLayout;
+
+			graphicsPipelineCreateInfo.renderPass = renderPass;
+
+			graphicsPipelineCreateInfo.subpass = 0;
+
+			graphicsPipelineCreateInfo.basePipelineHandle = vk::Pipeline(nullptr);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::GRAPHICS_PIPELINE_CREATE_INFO_ERROR;
+		}
+
+		vk::Pipeline graphicsPipeline = vk::Pipeline(nullptr);
+
+		try
+		{
+			auto createGraphicsPipelineResult = device.createGraphicsPipeline(pipelineCache, graphicsPipelineCreateInfo);
+			if (createGraphicsPipelineResult.result != vk::Result::eSuccess)
+			{
+				result.error = GraphicsPipelineError::PIPELINE_CREATION_ERROR;
+			}
+
+			graphicsPipeline = createGraphicsPipelineResult.value;
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::PIPELINE_CREATION_ERROR;
+		}
+
+		result.value = std::move(graphicsPipeline);
+		return result;
+	}
+
+	/*@brief Returns the states of a graphics pipeline set while recording : viewport and scissor always (core vulkan),
+	* cull mode, front face, primitive topology and depth test with VK_EXT_extended_dynamic_state
+	*
+	* @param support The dynamic state features enabled on the device
+	*
+	* @return The vulkan dynamic states
+	*/
+	inline std::vector<vk::DynamicState> getDynamicStates(const DynamicStateSupport& support)
+	{
+		std::vector<vk::DynamicState> dynamicStates = { vk::DynamicState::eViewport, vk::DynamicState::eScissor };
+
+		if (support.extendedDynamicState)
+		{
+			dynamicStates.insert(dynamicStates.end(), { vk::DynamicState::eCullModeEXT, vk::DynamicState::eFrontFaceEXT, vk::DynamicState::ePrimitiveTopologyEXT,
+				vk::DynamicState::eDepthTestEnableEXT, vk::DynamicState::eDepthWriteEnableEXT, vk::DynamicState::eDepthCompareOpEXT });
+		}
+
+		return dynamicStates;
+	}
+
+	/*Formats of the attachments rendered into with dynamic rendering, replacing the render pass of a graphics pipeline.
+	* The sample count applies with a render pass as well, it must match the samples of its attachments (see RenderTargets)*/
+	struct RenderingFormats
+	{
+		std::vector<vk::Format> colorFormats;
+		vk::Format depthFormat = vk::Format::eUndefined;
+		vk::SampleCountFlagBits samples = vk::SampleCountFlagBits::e1;
+	};
+
+	/*@brief Creates a graphics pipeline whose viewport and scissor are set while recording (see recordViewportAndScissor()), so that it survives
+	* swapchain resizes and serves every viewport. With VK_EXT_extended_dynamic_state the cull mode, front face, triangle topology and depth test
+	* are dynamic as well (see recordExtendedDynamicState()), one pipeline replacing every combination of them.
+	* Without render pass, the pipeline renders into renderingFormats with VK_KHR_dynamic_rendering (see beginRendering())
+	*
+	* @param device The vulkan device ordered to create the graphics pipeline
+	* @param renderPass The vulkan render pass to be used in the graphics pipeline, null to use dynamic rendering
+	* @param renderingFormats The formats of the attachments with dynamic rendering, only the sample count is used with a render pass
+	* @param pipelineLayout The vulkan pipeline layout to be used in the graphics pipeline
+	* @param shaderStageFlags The vulkan shader stage flags of the shader modules
+	* @param shaderModules The vulkan shader modules of the pipeline
+	* @param entryNames The names of the main() functions of the shaders
+	* @param vertexInputBindingDescriptions The vulkan vertex input binding descriptions to be used in the graphics pipeline
+	* @param vertexInputAttributeDescriptions The vulkan vertex input attribute descriptions to be used in the graphics pipeline
+	* @param support The dynamic state features enabled on the device
+	* @param depthTestEnabled Is the depth test enabled, the initial value of the dynamic depth test with extended dynamic state (default is false)
+	* @param specializationInfos The vulkan specialization infos of the shader stages, in stage order (default is none)
+	* @param pipelineCache The vulkan pipeline cache used by the driver to reuse compiled code (default is none)
+	*
+	* @return SkResult(created graphics pipeline, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::Pipeline, GraphicsPipelineError> createDynamicGraphicsPipeline(const vk::Device& device, const vk::RenderPass& renderPass, const RenderingFormats& renderingFormats,
+		const vk::PipelineLayout& pipelineLayout, const std::vector<vk::ShaderStageFlagBits>& shaderStageFlags, const std::vector<vk::ShaderModule>& shaderModules, const std::vector<std::string>& entryNames,
+		const std::vector<vk::VertexInputBindingDescription>& vertexInputBindingDescriptions, const std::vector<vk::VertexInputAttributeDescription>& vertexInputAttributeDescriptions,
+		const DynamicStateSupport& support, const bool depthTestEnabled = false,
+		const std::vector<vk::SpecializationInfo>& specializationInfos = std::vector<vk::SpecializationInfo>(), const vk::PipelineCache& pipelineCache = vk::PipelineCache(nullptr))
+	{
+		SkResult result(static_cast<vk::Pipeline>(vk::Pipeline(nullptr)), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+#ifndef VK_KHR_dynamic_rendering
+		if (!renderPass)
+		{
+			result.error = GraphicsPipelineError::GRAPHICS_PIPELINE_CREATE_INFO_ERROR;
+			return result;
+		}
+#endif
+
+		auto createPipelineShaderStageCreateInfosResult = createPipelineShaderStageCreateInfos(shaderStageFlags, shaderModules, entryNames, specializationInfos);
+		result.error = affectError(createPipelineShaderStageCreateInfosResult, result.error);
+		std::vector<vk::PipelineShaderStageCreateInfo> shaderStages = retLog(createPipelineShaderStageCreateInfosResult);
+
+		auto createPipelineVertexInputStateCreateInfoResult = createPipelineVertexInputStateCreateInfo(vertexInputBindingDescriptions, vertexInputAttributeDescriptions);
+		result.error = affectError(createPipelineVertexInputStateCreateInfoResult, result.error);
+		vk::PipelineVertexInputStateCreateInfo vertexInputState = retLog(createPipelineVertexInputStateCreateInfoResult);
+
+		auto createPipelineInputAssemblyStateCreateInfoResult = createPipelineInputAssemblyStateCreateInfo(vk::PrimitiveTopology::eTriangleList);
+		result.error = affectError(createPipelineInputAssemblyStateCreateInfoResult, result.error);
+		vk::PipelineInputAssemblyStateCreateInfo inputAssemblyState = retLog(createPipelineInputAssemblyStateCreateInfoResult);
+
+		//Counts only, the viewport and scissor themselves are recorded
+		vk::PipelineViewportStateCreateInfo viewportState = {};
+		viewportState.viewportCount = 1;
+		viewportState.scissorCount = 1;
+
+		auto createPipelineRasterizationStateCreateInfoResult = createPipelineRasterizationStateCreateInfo(vk::PolygonMode::eFill);
+		result.error = affectError(createPipelineRasterizationStateCreateInfoResult, result.error);
+		vk::PipelineRasterizationStateCreateInfo rasterizationState = retLog(createPipelineRasterizationStateCreateInfoResult);
+
+		auto createPipelineMultisampleStateCreateInfoResult = createPipelineMultisampleStateCreateInfo(false, renderingFormats.samples);
+		result.error = affectError(createPipelineMultisampleStateCreateInfoResult, result.error);
+		vk::PipelineMultisampleStateCreateInfo multisampleState = retLog(createPipelineMultisampleStateCreateInfoResult);
+
+		vk::PipelineDepthStencilStateCreateInfo depthStencilState = {};
+		depthStencilState.depthTestEnable = (depthTestEnabled ? VK_TRUE : VK_FALSE);
+		depthStencilState.depthWriteEnable = (depthTestEnabled ? VK_TRUE : VK_FALSE);
+		depthStencilState.depthCompareOp = vk::CompareOp::eLessOrEqual;
+
+		auto createPipelineColorBlendAttachmentStateResult = createPipelineColorBlendAttachmentState();
+		result.error = affectError(createPipelineColorBlendAttachmentStateResult, result.error);
+
+		//One blend state per color attachment
+		const size_t colorAttachmentCount = (renderPass ? 1 : renderingFormats.colorFormats.size());
+		std::vector<vk::PipelineColorBlendAttachmentState> colorBlendAttachmentStates(colorAttachmentCount, retLog(createPipelineColorBlendAttachmentStateResult));
+
+		auto createPipelineColorBlendStateCreateInfoResult = createPipelineColorBlendStateCreateInfo(colorBlendAttachmentStates);
+		result.error = affectError(createPipelineColorBlendStateCreateInfoResult, result.error);
+		vk::PipelineColorBlendStateCreateInfo colorBlendState = retLog(createPipelineColorBlendStateCreateInfoResult);
+
+		const std::vector<vk::DynamicState> dynamicStates = getDynamicStates(support);
+
+		vk::PipelineDynamicStateCreateInfo dynamicState = {};
+		dynamicState.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
+		dynamicState.pDynamicStates = dynamicStates.data();
+
+		vk::GraphicsPipelineCreateInfo graphicsPipelineCreateInfo = {};
+		graphicsPipelineCreateInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
+		graphicsPipelineCreateInfo.pStages = shaderStages.data();
+		graphicsPipelineCreateInfo.pVertexInputState = &vertexInputState;
+		graphicsPipelineCreateInfo.pInputAssemblyState = &inputAssemblyState;
+		graphicsPipelineCreateInfo.pViewportState = &viewportState;
+		graphicsPipelineCreateInfo.pRasterizationState = &rasterizationState;
+		graphicsPipelineCreateInfo.pMultisampleState = &multisampleState;
+		graphicsPipelineCreateInfo.pDepthStencilState = &depthStencilState;
+		graphicsPipelineCreateInfo.pColorBlendState = &colorBlendState;
+		graphicsPipelineCreateInfo.pDynamicState = &dynamicState;
+		graphicsPipelineCreateInfo.layout = pipelineLayout;
+		graphicsPipelineCreateInfo.renderPass = renderPass;
+		graphicsPipelineCreateInfo.subpass = 0;
+		graphicsPipelineCreateInfo.basePipelineHandle = vk::Pipeline(nullptr);
+
+#ifdef VK_KHR_dynamic_rendering
+		vk::PipelineRenderingCreateInfoKHR pipelineRenderingCreateInfo = {};
+		pipelineRenderingCreateInfo.colorAttachmentCount = static_cast<uint32_t>(renderingFormats.colorFormats.size());
+		pipelineRenderingCreateInfo.pColorAttachmentFormats = renderingFormats.colorFormats.data();
+		pipelineRenderingCreateInfo.depthAttachmentFormat = renderingFormats.depthFormat;
+
+		if (!renderPass)
+		{
+			graphicsPipelineCreateInfo.pNext = &pipelineRenderingCreateInfo;
+		}
+#endif
+
+		try
+		{
+			auto createGraphicsPipelineResult = device.createGraphicsPipeline(pipelineCache, graphicsPipelineCreateInfo);
+			if (createGraphicsPipelineResult.result != vk::Result::eSuccess)
+			{
+				result.error = GraphicsPipelineError::PIPELINE_CREATION_ERROR;
+			}
+
+			result.value = createGraphicsPipelineResult.value;
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = GraphicsPipelineError::PIPELINE_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Destroys the given pipeline using a given device
+	*
+	* @param device The vulkan device ordered to destroy the pipeline
+	* @param pipeline The vulkan pipeline to be destroyed
+	*
+	* @return SkResult(boolean indicating if the operation worked(true) or not(false), GraphicsPipelineError)
+	*/
+	inline SkResult<bool, GraphicsPipelineError> destroyPipeline(const vk::Device& device, const vk::Pipeline& pipeline)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+		try
+		{
+			device.destroyPipeline(pipeline);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = GraphicsPipelineError::PIPELINE_DELETION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Creates a compute pipeline from a given compute shader module
+	*
+	* @param device The vulkan device ordered to create the compute pipeline
+	* @param pipelineLayout The vulkan pipeline layout to be used in the compute pipeline
+	* @param shaderModule The vulkan shader module holding the compute shader
+	* @param entryName The name of the main() function of the compute shader
+	* @param pSpecializationInfo The vulkan specialization info holding the specialization constants of the shader (default is none)
+	* @param pipelineCache The vulkan pipeline cache used by the driver to reuse compiled code (default is none)
+	*
+	* @return SkResult(created compute pipeline, ComputePipelineError)
+	*/
+	inline SkResult<vk::Pipeline, ComputePipelineError> createComputePipeline(const vk::Device& device, const vk::PipelineLayout& pipelineLayout, const vk::ShaderModule& shaderModule, const std::string& entryName = "main",
+		const vk::SpecializationInfo* pSpecializationInfo = nullptr, const vk::PipelineCache& pipelineCache = vk::PipelineCache(nullptr))
+	{
+		SkResult result(static_cast<vk::Pipeline>(vk::Pipeline(nullptr)), static_cast<ComputePipelineError>(ComputePipelineError::NO_ERROR));
+
+		vk::ComputePipelineCreateInfo computePipelineCreateInfo = {};
+		computePipelineCreateInfo.stage.stage = vk::ShaderStageFlagBits::eCompute;
+		computePipelineCreateInfo.stage.module = shaderModule;
+		computePipelineCreateInfo.stage.pName = entryName.c_str();
+		computePipelineCreateInfo.stage.pSpecializationInfo = pSpecializationInfo;
+		computePipelineCreateInfo.layout = pipelineLayout;
+		computePipelineCreateInfo.basePipelineHandle = vk::Pipeline(nullptr);
+
+		try
+		{
+			auto createComputePipelineResult = device.createComputePipeline(pipelineCache, computePipelineCreateInfo);
+			if (createComputePipelineResult.result != vk::Result::eSuccess)
+			{
+				result.error = ComputePipelineError::COMPUTE_PIPELINE_CREATION_ERROR;
+			}
+
+			result.value = createComputePipelineResult.value;
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = ComputePipelineError::COMPUTE_PIPELINE_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Creates a compute pipeline from a given compute shader file (.spv), the shader module is destroyed once the pipeline is created
+	*
+	* @param device The vulkan device ordered to create the compute pipeline
+	* @param pipelineLayout The vulkan pipeline layout to be used in the compute pipeline
+	* @param shaderFilename The filename of the compiled compute shader
+	* @param entryName The name of the main() function of the compute shader
+	*
+	* @return SkResult(created compute pipeline, ComputePipelineError)
+	*/
+	inline SkResult<vk::Pipeline, ComputePipelineError> createComputePipeline(const vk::Device& device, const vk::PipelineLayout& pipelineLayout, const std::string_view shaderFilename, const std::string& entryName = "main")
+	{
+		SkResult result(static_cast<vk::Pipeline>(vk::Pipeline(nullptr)), static_cast<ComputePipelineError>(ComputePipelineError::NO_ERROR));
+
+		auto createShaderModuleResult = createShaderModule(device, shaderFilename);
+		if (logError(createShaderModuleResult))
+		{
+			result.error = ComputePipelineError::SHADER_MODULE_CREATION_ERROR;
+			return result;
+		}
+		vk::ShaderModule shaderModule = createShaderModuleResult.value;
+
+		auto createComputePipelineResult = createComputePipeline(device, pipelineLayout, shaderModule, entryName);
+		result.error = affectError(createComputePipelineResult, result.error);
+		result.value = retLog(createComputePipelineResult);
+
+		logError(destroyShaderModule(device, shaderModule));
+
+		return result;
+	}
+
+	/*@brief Appends a vulkan handle to the key of a cached object, as two words
+	*
+	* @param key The key receiving the handle
+	* @param handle The vulkan handle (pipeline layout, render pass, shader module...)
+	*/
+	template<typename Handle>
+	inline void appendHandleKey(std::vector<uint32_t>& key, const Handle& handle)
+	{
+		const typename Handle::CType cHandle = static_cast<typename Handle::CType>(handle);
+
+		uint64_t value = 0;
+		std::memcpy(&value, &cHandle, sizeof(cHandle));
+
+		key.insert(key.end(), { static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32) });
+	}
+
+	/*@brief Appends a string to the key of a cached object : its length, then its characters packed in words
+	*
+	* @param key The key receiving the string
+	* @param string The string (shader entry name...)
+	*/
+	inline void appendStringKey(std::vector<uint32_t>& key, const std::string_view string)
+	{
+		key.push_back(static_cast<uint32_t>(string.size()));
+
+		const size_t firstWord = key.size();
+		key.resize(firstWord + (string.size() + sizeof(uint32_t) - 1) / sizeof(uint32_t), 0);
+		std::memcpy(key.data() + firstWord, string.data(), string.size());
+	}
+
+	/*Pipelines keyed by their shaders, specialization constants and state, every variant (material permutation, baked feature toggle...)
+	* being created once and shared afterwards. Shaders come from a ShaderModuleCache and are keyed by the hash of their code rather than by
+	* their handle, so a handle reused by the driver for other code never returns an old variant. Variants are compiled through one vulkan
+	* pipeline cache, whose data can be saved and given back on the next run so that the driver skips the compilation of known variants.
+	* Thread safe, pipelines live until destroyPipelines()*/
+	class PipelineVariantCache
+	{
+	public:
+		PipelineVariantCache(vk::Device logicDevice, ShaderModuleCache& moduleCache, std::vector<uint8_t> pipelineCacheData = std::vector<uint8_t>())
+			: device(logicDevice), shaderModuleCache(moduleCache), initialPipelineCacheData(std::move(pipelineCacheData))
+		{
+
+		}
+
+		PipelineVariantCache(const PipelineVariantCache&) = delete;
+		PipelineVariantCache& operator=(const PipelineVariantCache&) = delete;
+
+		/*@brief Returns the graphics pipeline variant of given shaders and specialization constants, creating it only if it does not exist yet.
+		* The fixed function state is the default one of createGraphicsPipeline()
+		*
+		* @param renderPass The vulkan render pass to be used in the graphics pipeline
+		* @param pipelineLayout The vulkan pipeline layout to be used in the graphics pipeline
+		* @param extent The vulkan extent of the viewport and scissor
+		* @param shaderStageFlags The vulkan shader stage flags of the shader modules
+		* @param shaderModules The vulkan shader modules of the pipeline, from the shader module cache
+		* @param entryNames The names of the main() functions of the shaders
+		* @param vertexInputBindingDescriptions The vulkan vertex input binding descriptions to be used in the graphics pipeline
+		* @param vertexInputAttributeDescriptions The vulkan vertex input attribute descriptions to be used in the graphics pipeline
+		* @param specializationConstants The specialization constants of the stages, in stage order (default is none)
+		*
+		* @return SkResult(graphics pipeline owned by the cache, GraphicsPipelineError)
+		*/
+		inline SkResult<vk::Pipeline, GraphicsPipelineError> getGraphicsPipeline(const vk::RenderPass& renderPass, const vk::PipelineLayout& pipelineLayout, const vk::Extent2D& extent,
+			const std::vector<vk::ShaderStageFlagBits>& shaderStageFlags, const std::vector<vk::ShaderModule>& shaderModules, const std::vector<std::string>& entryNames,
+			const std::vector<vk::VertexInputBindingDescription>& vertexInputBindingDescriptions, const std::vector<vk::VertexInputAttributeDescription>& vertexInputAttributeDescriptions,
+			const std::vector<SpecializationConstants>& specializationConstants = std::vector<SpecializationConstants>())
+		{
+			SkResult result(static_cast<vk::Pipeline>(vk::Pipeline(nullptr)), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+			if (shaderStageFlags.size() != shaderModules.size() || entryNames.size() != shaderModules.size() || specializationConstants.size() > shaderModules.size())
+			{
+				result.error = GraphicsPipelineError::PIPELINE_SHADER_STAGE_CREATE_INFO_ERROR;
+				return result;
+			}
+
+			/*KEY*/
+			std::vector<uint32_t> key = { static_cast<uint32_t>(vk::PipelineBindPoint::eGraphics) };
+			appendHandleKey(key, renderPass);
+			appendHandleKey(key, pipelineLayout);
+			key.insert(key.end(), { extent.width, extent.height });
+			if (!appendShaderStagesKey(key, shaderStageFlags, shaderModules, entryNames, specializationConstants, vertexInputBindingDescriptions, vertexInputAttributeDescriptions))
+			{
+				result.error = GraphicsPipelineError::UNCACHED_SHADER_MODULE_ERROR;
+				return result;
+			}
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+
+			auto pipelineIterator = pipelines.find(key);
+			if (pipelineIterator != pipelines.end())
+			{
+				result.value = pipelineIterator->second;
+				return result;
+			}
+
+			/*NEW VARIANT*/
+			const std::vector<vk::SpecializationInfo> specializationInfos = getSpecializationInfos(specializationConstants);
+
+			auto createGraphicsPipelineResult = createGraphicsPipeline(device, renderPass, pipelineLayout, extent, shaderStageFlags, shaderModules, entryNames,
+				vertexInputBindingDescriptions, vertexInputAttributeDescriptions, vk::PrimitiveTopology::eTriangleList, vk::PolygonMode::eFill, false, vk::SampleCountFlagBits::e1,
+				(vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG | vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA), false,
+				specializationInfos, getPipelineCache());
+
+			if (error(createGraphicsPipelineResult))
+			{
+				result.error = createGraphicsPipelineResult.error;
+				return result;
+			}
+
+			pipelines.emplace(std::move(key), createGraphicsPipelineResult.value);
+
+			result.value = createGraphicsPipelineResult.value;
+			return result;
+		}
+
+		/*@brief Returns the graphics pipeline variant of given shaders and specialization constants with dynamic viewport and scissor, creating it
+		* only if it does not exist yet. Unlike getGraphicsPipeline() the variant does not depend on the extent and survives swapchain resizes,
+		* see createDynamicGraphicsPipeline()
+		*
+		* @param renderPass The vulkan render pass to be used in the graphics pipeline, null to use dynamic rendering
+		* @param renderingFormats The formats of the attachments with dynamic rendering, only the sample count is used with a render pass
+		* @param pipelineLayout The vulkan pipeline layout to be used in the graphics pipeline
+		* @param shaderStageFlags The vulkan shader stage flags of the shader modules
+		* @param shaderModules The vulkan shader modules of the pipeline, from the shader module cache
+		* @param entryNames The names of the main() functions of the shaders
+		* @param vertexInputBindingDescriptions The vulkan vertex input binding descriptions to be used in the graphics pipeline
+		* @param vertexInputAttributeDescriptions The vulkan vertex input attribute descriptions to be used in the graphics pipeline
+		* @param support The dynamic state features enabled on the device
+		* @param depthTestEnabled Is the depth test enabled (default is false)
+		* @param specializationConstants The specialization constants of the stages, in stage order (default is none)
+		*
+		* @return SkResult(graphics pipeline owned by the cache, GraphicsPipelineError)
+		*/
+		inline SkResult<vk::Pipeline, GraphicsPipelineError> getDynamicGraphicsPipeline(const vk::RenderPass& renderPass, const RenderingFormats& renderingFormats, const vk::PipelineLayout& pipelineLayout,
+			const std::vector<vk::ShaderStageFlagBits>& shaderStageFlags, const std::vector<vk::ShaderModule>& shaderModules, const std::vector<std::string>& entryNames,
+			const std::vector<vk::VertexInputBindingDescription>& vertexInputBindingDescriptions, const std::vector<vk::VertexInputAttributeDescription>& vertexInputAttributeDescriptions,
+			const DynamicStateSupport& support, const bool depthTestEnabled = false, const std::vector<SpecializationConstants>& specializationConstants = std::vector<SpecializationConstants>())
+		{
+			SkResult result(static_cast<vk::Pipeline>(vk::Pipeline(nullptr)), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+			if (shaderStageFlags.size() != shaderModules.size() || entryNames.size() != shaderModules.size() || specializationConstants.size() > shaderModules.size())
+			{
+				result.error = GraphicsPipelineError::PIPELINE_SHADER_STAGE_CREATE_INFO_ERROR;
+				return result;
+			}
+
+			/*KEY*/
+			//Past the bind points, so that dynamic variants never collide with the static ones
+			std::vector<uint32_t> key = { static_cast<uint32_t>(vk::PipelineBindPoint::eCompute) + 1 };
+			appendHandleKey(key, renderPass);
+			appendHandleKey(key, pipelineLayout);
+			key.insert(key.end(), { static_cast<uint32_t>(support.extendedDynamicState), static_cast<uint32_t>(depthTestEnabled), static_cast<uint32_t>(renderingFormats.samples) });
+
+			if (!renderPass)
+			{
+				key.push_back(static_cast<uint32_t>(renderingFormats.colorFormats.size()));
+				for (const vk::Format format : renderingFormats.colorFormats)
+				{
+					key.push_back(static_cast<uint32_t>(format));
+				}
+
+				key.push_back(static_cast<uint32_t>(renderingFormats.depthFormat));
+			}
+
+			if (!appendShaderStagesKey(key, shaderStageFlags, shaderModules, entryNames, specializationConstants, vertexInputBindingDescriptions, vertexInputAttributeDescriptions))
+			{
+				result.error = GraphicsPipelineError::UNCACHED_SHADER_MODULE_ERROR;
+				return result;
+			}
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+
+			auto pipelineIterator = pipelines.find(key);
+			if (pipelineIterator != pipelines.end())
+			{
+				result.value = pipelineIterator->second;
+				return result;
+			}
+
+			/*NEW VARIANT*/
+			const std::vector<vk::SpecializationInfo> specializationInfos = getSpecializationInfos(specializationConstants);
+
+			auto createDynamicGraphicsPipelineResult = createDynamicGraphicsPipeline(device, renderPass, renderingFormats, pipelineLayout, shaderStageFlags, shaderModules, entryNames,
+				vertexInputBindingDescriptions, vertexInputAttributeDescriptions, support, depthTestEnabled, specializationInfos, getPipelineCache());
+
+			if (error(createDynamicGraphicsPipelineResult))
+			{
+				result.error = createDynamicGraphicsPipelineResult.error;
+				return result;
+			}
+
+			pipelines.emplace(std::move(key), createDynamicGraphicsPipelineResult.value);
+
+			result.value = createDynamicGraphicsPipelineResult.value;
+			return result;
+		}
+
+		/*@brief Returns the compute pipeline variant of a given shader and specialization constants, creating it only if it does not exist yet
+		*
+		* @param pipelineLayout The vulkan pipeline layout to be used in the compute pipeline
+		* @param shaderModule The vulkan shader module holding the compute shader, from the shader module cache
+		* @param specializationConstants The specialization constants of the shader (default is none)
+		* @param entryName The name of the main() function of the compute shader
+		*
+		* @return SkResult(compute pipeline owned by the cache, ComputePipelineError)
+		*/
+		inline SkResult<vk::Pipeline, ComputePipelineError> getComputePipeline(const vk::PipelineLayout& pipelineLayout, const vk::ShaderModule& shaderModule,
+			const SpecializationConstants& specializationConstants = SpecializationConstants(), const std::string& entryName = "main")
+		{
+			SkResult result(static_cast<vk::Pipeline>(vk::Pipeline(nullptr)), static_cast<ComputePipelineError>(ComputePipelineError::NO_ERROR));
+
+			std::vector<uint32_t> key = { static_cast<uint32_t>(vk::PipelineBindPoint::eCompute) };
+			appendHandleKey(key, pipelineLayout);
+			if (!appendShaderModuleKey(key, shaderModule))
+			{
+				result.error = ComputePipelineError::UNCACHED_SHADER_MODULE_ERROR;
+				return result;
+			}
+			appendStringKey(key, entryName);
+			specializationConstants.appendKey(key);
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+
+			auto pipelineIterator = pipelines.find(key);
+			if (pipelineIterator != pipelines.end())
+			{
+				result.value = pipelineIterator->second;
+				return result;
+			}
+
+			const vk::SpecializationInfo specializationInfo = specializationConstants.getSpecializationInfo();
+
+			auto createComputePipelineResult = createComputePipeline(device, pipelineLayout, shaderModule, entryName,
+				(specializationConstants.isEmpty() ? nullptr : &specializationInfo), getPipelineCache());
+
+			if (error(createComputePipelineResult))
+			{
+				result.error = createComputePipelineResult.error;
+				return result;
+			}
+
+			pipelines.emplace(std::move(key), createComputePipelineResult.value);
+
+			result.value = createComputePipelineResult.value;
+			return result;
+		}
+
+		/*Returns the number of pipeline variants held by the cache*/
+		inline size_t getPipelineCount()
+		{
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			return pipelines.size();
+		}
+
+		/*@brief Returns the data of the vulkan pipeline cache, to be saved and given to the constructor on the next run
+		*
+		* @return SkResult(pipeline cache data, empty if no variant was created, GraphicsPipelineError)
+		*/
+		inline SkResult<std::vector<uint8_t>, GraphicsPipelineError> getPipelineCacheData()
+		{
+			SkResult result(static_cast<std::vector<uint8_t>>(std::vector<uint8_t>()), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			if (!pipelineCache)
+			{
+				return result;
+			}
+
+			try
+			{
+				result.value = device.getPipelineCacheData(pipelineCache);
+			}
+			catch (vk::SystemError err)
+			{
+				result.error = GraphicsPipelineError::PIPELINE_CACHE_DATA_ERROR;
+			}
+
+			return result;
+		}
+
+		/*@brief Destroys every pipeline variant and the vulkan pipeline cache
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), GraphicsPipelineError)
+		*/
+		inline SkResult<bool, GraphicsPipelineError> destroyPipelines()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<GraphicsPipelineError>(GraphicsPipelineError::NO_ERROR));
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			for (auto& pipeline : pipelines)
+			{
+				result.error = affectError(destroyPipeline(device, pipeline.second), result.error);
+			}
+
+			pipelines.clear();
+
+			if (pipelineCache)
+			{
+				try
+				{
+					device.destroyPipelineCache(pipelineCache);
+				}
+				catch (vk::SystemError err)
+				{
+					result.error = GraphicsPipelineError::PIPELINE_CACHE_DESTRUCTION_ERROR;
+				}
+
+				pipelineCache = vk::PipelineCache(nullptr);
+			}
+
+			result.value = (result.error == GraphicsPipelineError::NO_ERROR);
+			return result;
+		}
+
+	private:
+		//Shader modules are keyed by the hash of their code, false if the module is not held by the shader module cache
+		inline bool appendShaderModuleKey(std::vector<uint32_t>& key, const vk::ShaderModule& shaderModule)
+		{
+			auto getShaderModuleHashResult = shaderModuleCache.getShaderModuleHash(shaderModule);
+			if (logError(getShaderModuleHashResult))
+			{
+				return false;
+			}
+
+			key.insert(key.end(), { static_cast<uint32_t>(getShaderModuleHashResult.value), static_cast<uint32_t>(getShaderModuleHashResult.value >> 32) });
+			return true;
+		}
+
+		//Shader stages, their specialization constants and the vertex input, shared by every graphics variant
+		inline bool appendShaderStagesKey(std::vector<uint32_t>& key, const std::vector<vk::ShaderStageFlagBits>& shaderStageFlags, const std::vector<vk::ShaderModule>& shaderModules,
+			const std::vector<std::string>& entryNames, const std::vector<SpecializationConstants>& specializationConstants,
+			const std::vector<vk::VertexInputBindingDescription>& vertexInputBindingDescriptions, const std::vector<vk::VertexInputAttributeDescription>& vertexInputAttributeDescriptions)
+		{
+			key.push_back(static_cast<uint32_t>(shaderModules.size()));
+
+			for (size_t i = 0; i < shaderModules.size(); i++)
+			{
+				key.push_back(static_cast<uint32_t>(shaderStageFlags[i]));
+				if (!appendShaderModuleKey(key, shaderModules[i]))
+				{
+					return false;
+				}
+				appendStringKey(key, entryNames[i]);
+
+				if (i < specializationConstants.size())
+				{
+					specializationConstants[i].appendKey(key);
+				}
+				else
+				{
+					SpecializationConstants().appendKey(key);
+				}
+			}
+
+			key.push_back(static_cast<uint32_t>(vertexInputBindingDescriptions.size()));
+			for (const vk::VertexInputBindingDescription& binding : vertexInputBindingDescriptions)
+			{
+				key.insert(key.end(), { binding.binding, binding.stride, static_cast<uint32_t>(binding.inputRate) });
+			}
+
+			key.push_back(static_cast<uint32_t>(vertexInputAttributeDescriptions.size()));
+			for (const vk::VertexInputAttributeDescription& attribute : vertexInputAttributeDescriptions)
+			{
+				key.insert(key.end(), { attribute.location, attribute.binding, static_cast<uint32_t>(attribute.format), attribute.offset });
+			}
+
+			return true;
+		}
+
+		//The infos point into the constants, which must outlive the pipeline creation
+		static inline std::vector<vk::SpecializationInfo> getSpecializationInfos(const std::vector<SpecializationConstants>& specializationConstants)
+		{
+			std::vector<vk::SpecializationInfo> specializationInfos;
+			specializationInfos.reserve(specializationConstants.size());
+			for (const SpecializationConstants& constants : specializationConstants)
+			{
+				specializationInfos.emplace_back(constants.getSpecializationInfo());
+			}
+
+			return specializationInfos;
+		}
+
+		//Created with the first variant, data rejected by the driver (other device or driver version) falls back to an empty cache
+		inline vk::PipelineCache getPipelineCache()
+		{
+			if (pipelineCache)
+			{
+				return pipelineCache;
+			}
+
+			vk::PipelineCacheCreateInfo pipelineCacheCreateInfo = {};
+			pipelineCacheCreateInfo.initialDataSize = initialPipelineCacheData.size();
+			pipelineCacheCreateInfo.pInitialData = initialPipelineCacheData.data();
+
+			try
+			{
+				pipelineCache = device.createPipelineCache(pipelineCacheCreateInfo);
+			}
+			catch (vk::SystemError err)
+			{
+				pipelineCacheCreateInfo.initialDataSize = 0;
+				pipelineCacheCreateInfo.pInitialData = nullptr;
+
+				try
+				{
+					pipelineCache = device.createPipelineCache(pipelineCacheCreateInfo);
+				}
+				catch (vk::SystemError err)
+				{
+					//Pipelines are still created, without reusing compiled code
+					pipelineCache = vk::PipelineCache(nullptr);
+				}
+			}
+
+			initialPipelineCacheData.clear();
+			return pipelineCache;
+		}
+
+		vk::Device device;
+		ShaderModuleCache& shaderModuleCache;
+		std::vector<uint8_t> initialPipelineCacheData;
+		vk::PipelineCache pipelineCache = vk::PipelineCache(nullptr);
+
+		std::unordered_map<std::vector<uint32_t>, vk::Pipeline, WordKeyHash> pipelines;
+		std::mutex cacheMutex;
+	};
+
+	/*DESCRIPTORS*/
+
+	/*@brief Creates a descriptor set layout from given bindings
+	*
+	* @param device The vulkan device used to create the descriptor set layout
+	* @param bindings The vulkan descriptor set layout bindings describing the layout
+	*
+	* @return SkResult(created descriptor set layout, DescriptorError)
+	*/
+	inline SkResult<vk::DescriptorSetLayout, DescriptorError> createDescriptorSetLayout(const vk::Device& device, const std::vector<vk::DescriptorSetLayoutBinding>& bindings)
+	{
+		SkResult result(static_cast<vk::DescriptorSetLayout>(vk::DescriptorSetLayout(nullptr)), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+		vk::DescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = {};
+		descriptorSetLayoutCreateInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+		descriptorSetLayoutCreateInfo.pBindings = bindings.data();
+
+		try
+		{
+			result.value = device.createDescriptorSetLayout(descriptorSetLayoutCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = DescriptorError::DESCRIPTOR_SET_LAYOUT_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Destroys a given descriptor set layout
+	*
+	* @param device The vulkan device used to destroy the descriptor set layout
+	* @param descriptorSetLayout The vulkan descriptor set layout to be destroyed
+	*
+	* @return SkResult(boolean indicating if the operation worked(true) or not(false), DescriptorError)
+	*/
+	inline SkResult<bool, DescriptorError> destroyDescriptorSetLayout(const vk::Device& device, const vk::DescriptorSetLayout& descriptorSetLayout)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+		try
+		{
+			device.destroyDescriptorSetLayout(descriptorSetLayout);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = DescriptorError::DESCRIPTOR_SET_LAYOUT_DESTRUCTION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Creates a descriptor pool able to hold a given number of sets and descriptors
+	*
+	* @param device The vulkan device used to create the descriptor pool
+	* @param poolSizes The number of descriptors of each type the pool can hold
+	* @param maxSets The maximum number of descriptor sets that can be allocated from the pool
+	* @param flags The vulkan descriptor pool create flags (default is none)
+	*
+	* @return SkResult(created descriptor pool, DescriptorError)
+	*/
+	inline SkResult<vk::DescriptorPool, DescriptorError> createDescriptorPool(const vk::Device& device, const std::vector<vk::DescriptorPoolSize>& poolSizes, const uint32_t maxSets,
+		const vk::DescriptorPoolCreateFlags flags = vk::DescriptorPoolCreateFlags())
+	{
+		SkResult result(static_cast<vk::DescriptorPool>(vk::DescriptorPool(nullptr)), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+		vk::DescriptorPoolCreateInfo descriptorPoolCreateInfo = {};
+		descriptorPoolCreateInfo.flags = flags;
+		descriptorPoolCreateInfo.maxSets = maxSets;
+		descriptorPoolCreateInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+		descriptorPoolCreateInfo.pPoolSizes = poolSizes.data();
+
+		try
+		{
+			result.value = device.createDescriptorPool(descriptorPoolCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = DescriptorError::DESCRIPTOR_POOL_CREATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Destroys a given descriptor pool, every descriptor set allocated from it is freed
+	*
+	* @param device The vulkan device used to destroy the descriptor pool
+	* @param descriptorPool The vulkan descriptor pool to be destroyed
+	*
+	* @return SkResult(boolean indicating if the operation worked(true) or not(false), DescriptorError)
+	*/
+	inline SkResult<bool, DescriptorError> destroyDescriptorPool(const vk::Device& device, const vk::DescriptorPool& descriptorPool)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+		try
+		{
+			device.destroyDescriptorPool(descriptorPool);
+		}
+		catch (vk::SystemError err)
+		{
+			result.value = false;
+			result.error = DescriptorError::DESCRIPTOR_POOL_DESTRUCTION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Allocates a single descriptor set of a given layout from a given descriptor pool
+	*
+	* @param device The vulkan device allocating the descriptor set
+	* @param descriptorPool The vulkan descriptor pool the set is allocated from
+	* @param descriptorSetLayout The layout of the descriptor set
+	*
+	* @return SkResult(allocated descriptor set, DescriptorError)
+	*/
+	inline SkResult<vk::DescriptorSet, DescriptorError> allocateDescriptorSet(const vk::Device& device, const vk::DescriptorPool& descriptorPool, const vk::DescriptorSetLayout& descriptorSetLayout)
+	{
+		SkResult result(static_cast<vk::DescriptorSet>(vk::DescriptorSet(nullptr)), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+		vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo = {};
+		descriptorSetAllocateInfo.descriptorPool = descriptorPool;
+		descriptorSetAllocateInfo.descriptorSetCount = 1;
+		descriptorSetAllocateInfo.pSetLayouts = &descriptorSetLayout;
+
+		try
+		{
+			result.value = device.allocateDescriptorSets(descriptorSetAllocateInfo)[0];
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = DescriptorError::DESCRIPTOR_SET_ALLOCATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Points a buffer binding of a descriptor set to a given buffer range
+	*
+	* @param device The vulkan device updating the descriptor set
+	* @param descriptorSet The vulkan descriptor set to be updated
+	* @param binding The binding of the descriptor set to be updated
+	* @param descriptorType The type of the descriptor (storage buffer, uniform buffer...)
+	* @param buffer The vulkan buffer the descriptor points to
+	* @param offset The offset of the range in the buffer (default is 0)
+	* @param range The size of the range in the buffer (default is the whole buffer)
+	*
+	* @return SkResult(boolean indicating if the operation worked(true) or not(false), DescriptorError), INVALID_DESCRIPTOR_WRITE_ERROR if the set or the buffer is null
+	*/
+	inline SkResult<bool, DescriptorError> writeBufferDescriptor(const vk::Device& device, const vk::DescriptorSet& descriptorSet, const uint32_t binding, const vk::DescriptorType descriptorType,
+		const vk::Buffer& buffer, const vk::DeviceSize offset = 0, const vk::DeviceSize range = VK_WHOLE_SIZE)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+		if (!descriptorSet || !buffer)
+		{
+			result.value = false;
+			result.error = DescriptorError::INVALID_DESCRIPTOR_WRITE_ERROR;
+			return result;
+		}
+
+		vk::DescriptorBufferInfo descriptorBufferInfo = {};
+		descriptorBufferInfo.buffer = buffer;
+		descriptorBufferInfo.offset = offset;
+		descriptorBufferInfo.range = range;
+
+		vk::WriteDescriptorSet writeDescriptorSet = {};
+		writeDescriptorSet.dstSet = descriptorSet;
+		writeDescriptorSet.dstBinding = binding;
+		writeDescriptorSet.descriptorCount = 1;
+		writeDescriptorSet.descriptorType = descriptorType;
+		writeDescriptorSet.pBufferInfo = &descriptorBufferInfo;
+
+		device.updateDescriptorSets(writeDescriptorSet, nullptr);
+
+		return result;
+	}
+
+	/*Descriptor set layouts and pipeline layouts keyed by their description (usually coming from mergeShaderReflections()),
+	* pipelines declaring the same resources sharing the same vulkan objects instead of duplicating them. Thread safe, layouts live until destroyLayouts()*/
+	class PipelineLayoutCache
+	{
+	public:
+		/*Pipeline layout and the descriptor set layouts it was created from, in set number order*/
+		struct SharedPipelineLayout
+		{
+			vk::PipelineLayout pipelineLayout;
+			std::vector<vk::DescriptorSetLayout> descriptorSetLayouts;
+		};
+
+		PipelineLayoutCache(vk::Device logicDevice)
+			: device(logicDevice)
+		{
+
+		}
+
+		PipelineLayoutCache(const PipelineLayoutCache&) = delete;
+		PipelineLayoutCache& operator=(const PipelineLayoutCache&) = delete;
+
+		/*@brief Returns the descriptor set layout holding given bindings, creating it only if no layout with the same bindings exists
+		*
+		* @param bindings The vulkan descriptor set layout bindings (immutable samplers are not supported)
+		*
+		* @return SkResult(descriptor set layout owned by the cache, DescriptorError)
+		*/
+		inline SkResult<vk::DescriptorSetLayout, DescriptorError> getDescriptorSetLayout(const std::vector<vk::DescriptorSetLayoutBinding>& bindings)
+		{
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			return getDescriptorSetLayoutLocked(bindings);
+		}
+
+		/*@brief Returns the pipeline layout of a given description, creating it and its descriptor set layouts only if they do not exist yet.
+		* Sets skipped by the description get an empty descriptor set layout
+		*
+		* @param description The description of the pipeline layout
+		*
+		* @return SkResult(pipeline layout and descriptor set layouts owned by the cache, DescriptorError)
+		*/
+		inline SkResult<SharedPipelineLayout, DescriptorError> getPipelineLayout(const PipelineLayoutDescription& description)
+		{
+			SkResult result(static_cast<SharedPipelineLayout>(SharedPipelineLayout()), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+			std::vector<uint32_t> key;
+			for (const auto& setBindings : description.setBindings)
+			{
+				appendBindingsKey(key, setBindings);
+			}
+
+			key.push_back(static_cast<uint32_t>(description.pushConstantRanges.size()));
+			for (const vk::PushConstantRange& pushConstantRange : description.pushConstantRanges)
+			{
+				key.insert(key.end(), { static_cast<uint32_t>(pushConstantRange.stageFlags), pushConstantRange.offset, pushConstantRange.size });
+			}
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+
+			auto pipelineLayoutIterator = pipelineLayouts.find(key);
+			if (pipelineLayoutIterator != pipelineLayouts.end())
+			{
+				result.value = pipelineLayoutIterator->second;
+				return result;
+			}
+
+			SharedPipelineLayout sharedPipelineLayout;
+			for (const auto& setBindings : description.setBindings)
+			{
+				auto getDescriptorSetLayoutResult = getDescriptorSetLayoutLocked(setBindings);
+				if (error(getDescriptorSetLayoutResult))
+				{
+					result.error = getDescriptorSetLayoutResult.error;
+					return result;
+				}
+
+				sharedPipelineLayout.descriptorSetLayouts.emplace_back(getDescriptorSetLayoutResult.value);
+			}
+
+			vk::PipelineLayoutCreateInfo pipelineLayoutCreateInfo = {};
+			pipelineLayoutCreateInfo.setLayoutCount = static_cast<uint32_t>(sharedPipelineLayout.descriptorSetLayouts.size());
+			pipelineLayoutCreateInfo.pSetLayouts = sharedPipelineLayout.descriptorSetLayouts.data();
+			pipelineLayoutCreateInfo.pushConstantRangeCount = static_cast<uint32_t>(description.pushConstantRanges.size());
+			pipelineLayoutCreateInfo.pPushConstantRanges = description.pushConstantRanges.data();
+
+			try
+			{
+				sharedPipelineLayout.pipelineLayout = device.createPipelineLayout(pipelineLayoutCreateInfo);
+			}
+			catch (vk::SystemError err)
+			{
+				result.error = DescriptorError::PIPELINE_LAYOUT_CREATION_ERROR;
+				return result;
+			}
+
+			pipelineLayouts.emplace(std::move(key), sharedPipelineLayout);
+
+			result.value = sharedPipelineLayout;
+			return result;
+		}
+
+		/*Returns the number of distinct descriptor set layouts held by the cache*/
+		inline size_t getDescriptorSetLayoutCount()
+		{
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			return descriptorSetLayouts.size();
+		}
+
+		/*Returns the number of distinct pipeline layouts held by the cache*/
+		inline size_t getPipelineLayoutCount()
+		{
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			return pipelineLayouts.size();
+		}
+
+		/*@brief Destroys every pipeline layout and descriptor set layout of the cache
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), DescriptorError)
+		*/
+		inline SkResult<bool, DescriptorError> destroyLayouts()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+			std::lock_guard<std::mutex> lock(cacheMutex);
+			for (auto& pipelineLayout : pipelineLayouts)
+			{
+				try
+				{
+					device.destroyPipelineLayout(pipelineLayout.second.pipelineLayout);
+				}
+				catch (vk::SystemError err)
+				{
+					result.error = DescriptorError::PIPELINE_LAYOUT_DESTRUCTION_ERROR;
+				}
+			}
+
+			for (auto& descriptorSetLayout : descriptorSetLayouts)
+			{
+				result.error = affectError(destroyDescriptorSetLayout(device, descriptorSetLayout.second), result.error);
+			}
+
+			pipelineLayouts.clear();
+			descriptorSetLayouts.clear();
+
+			result.value = (result.error == DescriptorError::NO_ERROR);
+			return result;
+		}
+
+	private:
+		//Bindings are sorted by binding number so that the same set declared in another order gets the same key
+		inline static void appendBindingsKey(std::vector<uint32_t>& key, std::vector<vk::DescriptorSetLayoutBinding> bindings)
+		{
+			std::sort(bindings.begin(), bindings.end(), [](const vk::DescriptorSetLayoutBinding& lhs, const vk::DescriptorSetLayoutBinding& rhs)
+			{
+				return lhs.binding < rhs.binding;
+			});
+
+			key.push_back(static_cast<uint32_t>(bindings.size()));
+			for (const vk::DescriptorSetLayoutBinding& binding : bindings)
+			{
+				key.insert(key.end(), { binding.binding, static_cast<uint32_t>(binding.descriptorType), binding.descriptorCount, static_cast<uint32_t>(binding.stageFlags) });
+			}
+		}
+
+		inline SkResult<vk::DescriptorSetLayout, DescriptorError> getDescriptorSetLayoutLocked(const std::vector<vk::DescriptorSetLayoutBinding>& bindings)
+		{
+			std::vector<uint32_t> key;
+			appendBindingsKey(key, bindings);
+
+			auto descriptorSetLayoutIterator = descriptorSetLayouts.find(key);
+			if (descriptorSetLayoutIterator != descriptorSetLayouts.end())
+			{
+				return SkResult(static_cast<vk::DescriptorSetLayout>(descriptorSetLayoutIterator->second), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+			}
+
+			auto createDescriptorSetLayoutResult = createDescriptorSetLayout(device, bindings);
+			if (!error(createDescriptorSetLayoutResult))
+			{
+				descriptorSetLayouts.emplace(std::move(key), createDescriptorSetLayoutResult.value);
+			}
+
+			return createDescriptorSetLayoutResult;
+		}
+
+		vk::Device device;
+
+		std::unordered_map<std::vector<uint32_t>, vk::DescriptorSetLayout, WordKeyHash> descriptorSetLayouts;
+		std::unordered_map<std::vector<uint32_t>, SharedPipelineLayout, WordKeyHash> pipelineLayouts;
+		std::mutex cacheMutex;
+	};
+
+	/*Share of the descriptors of a type in a descriptor pool, in descriptors per set*/
+	struct DescriptorPoolRatio
+	{
+		vk::DescriptorType descriptorType;
+		float ratio;
+	};
+
+	/*@brief Returns the default descriptor pool ratios, fitting sets made of a few uniform buffers, storage buffers and textures
+	*
+	* @return The descriptor pool ratios
+	*/
+	inline std::vector<DescriptorPoolRatio> getDefaultDescriptorPoolRatios()
+	{
+		return
+		{
+			{ vk::DescriptorType::eUniformBuffer,        2.0f },
+			{ vk::DescriptorType::eUniformBufferDynamic, 1.0f },
+			{ vk::DescriptorType::eStorageBuffer,        2.0f },
+			{ vk::DescriptorType::eStorageBufferDynamic, 0.5f },
+			{ vk::DescriptorType::eCombinedImageSampler, 4.0f },
+			{ vk::DescriptorType::eSampledImage,         1.0f },
+			{ vk::DescriptorType::eSampler,              0.5f },
+			{ vk::DescriptorType::eStorageImage,         1.0f }
+		};
+	}
+
+	/*@brief Computes the pool sizes of a descriptor pool holding a given number of sets, each type getting its ratio of descriptors per set
+	*
+	* @param ratios The descriptors per set of each type
+	* @param maxSets The maximum number of descriptor sets of the pool
+	*
+	* @return The vulkan descriptor pool sizes, at least one descriptor per type
+	*/
+	inline std::vector<vk::DescriptorPoolSize> computeDescriptorPoolSizes(const std::vector<DescriptorPoolRatio>& ratios, const uint32_t maxSets)
+	{
+		std::vector<vk::DescriptorPoolSize> poolSizes;
+		poolSizes.reserve(ratios.size());
+
+		for (const DescriptorPoolRatio& ratio : ratios)
+		{
+			const uint32_t descriptorCount = static_cast<uint32_t>(std::ceil(std::max(ratio.ratio, 0.0f) * static_cast<float>(maxSets)));
+			poolSizes.emplace_back(ratio.descriptorType, std::max(descriptorCount, 1u));
+		}
+
+		return poolSizes;
+	}
+
+	/*Resource pointed to by a binding of a descriptor set, a buffer range or an image view and sampler depending on the descriptor type*/
+	struct DescriptorBinding
+	{
+		uint32_t binding = 0;
+		vk::DescriptorType descriptorType = vk::DescriptorType::eUniformBuffer;
+
+		vk::Buffer buffer = vk::Buffer(nullptr);
+		vk::DeviceSize offset = 0;
+		vk::DeviceSize range = VK_WHOLE_SIZE;
+
+		vk::ImageView imageView = vk::ImageView(nullptr);
+		vk::Sampler sampler = vk::Sampler(nullptr);
+		vk::ImageLayout imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal;
+	};
+
+	/*@brief Returns true if a descriptor type points to an image view or a sampler rather than to a buffer
+	*
+	* @param descriptorType The vulkan descriptor type
+	*
+	* @return True for samplers and images, false for buffers
+	*/
+	inline bool isImageDescriptorType(const vk::DescriptorType descriptorType)
+	{
+		return (descriptorType == vk::DescriptorType::eSampler || descriptorType == vk::DescriptorType::eCombinedImageSampler || descriptorType == vk::DescriptorType::eSampledImage
+			|| descriptorType == vk::DescriptorType::eStorageImage || descriptorType == vk::DescriptorType::eInputAttachment);
+	}
+
+	/*@brief Points several bindings of a descriptor set to their resources in a single update
+	*
+	* @param device The vulkan device updating the descriptor set
+	* @param descriptorSet The vulkan descriptor set to be updated
+	* @param bindings The resources of the bindings
+	*
+	* @return SkResult(boolean indicating if the operation worked(true) or not(false), DescriptorError)
+	*/
+	inline SkResult<bool, DescriptorError> writeDescriptorSet(const vk::Device& device, const vk::DescriptorSet& descriptorSet, const std::vector<DescriptorBinding>& bindings)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+		//Sized up front, the writes point into them
+		std::vector<vk::DescriptorBufferInfo> descriptorBufferInfos(bindings.size());
+		std::vector<vk::DescriptorImageInfo> descriptorImageInfos(bindings.size());
+		std::vector<vk::WriteDescriptorSet> writeDescriptorSets(bindings.size());
+
+		for (size_t i = 0; i < bindings.size(); i++)
+		{
+			writeDescriptorSets[i].dstSet = descriptorSet;
+			writeDescriptorSets[i].dstBinding = bindings[i].binding;
+			writeDescriptorSets[i].descriptorCount = 1;
+			writeDescriptorSets[i].descriptorType = bindings[i].descriptorType;
+
+			if (isImageDescriptorType(bindings[i].descriptorType))
+			{
+				descriptorImageInfos[i].sampler = bindings[i].sampler;
+				descriptorImageInfos[i].imageView = bindings[i].imageView;
+				descriptorImageInfos[i].imageLayout = bindings[i].imageLayout;
+				writeDescriptorSets[i].pImageInfo = &descriptorImageInfos[i];
+			}
+			else
+			{
+				descriptorBufferInfos[i].buffer = bindings[i].buffer;
+				descriptorBufferInfos[i].offset = bindings[i].offset;
+				descriptorBufferInfos[i].range = bindings[i].range;
+				writeDescriptorSets[i].pBufferInfo = &descriptorBufferInfos[i];
+			}
+		}
+
+		device.updateDescriptorSets(writeDescriptorSets, nullptr);
+
+		return result;
+	}
+
+	/*@brief Returns the number of sets of the next descriptor pool of a chain : the first pool holds a given number of sets,
+	* each new pool twice as many as the previous one, up to a limit
+	*
+	* @param previousSetCount The number of sets of the previous pool, 0 if none was created
+	* @param firstSetCount The number of sets of the first pool
+	* @param maxSetCount The maximum number of sets of a pool
+	*
+	* @return The number of sets of the next pool
+	*/
+	inline uint32_t getNextDescriptorPoolSetCount(const uint32_t previousSetCount, const uint32_t firstSetCount, const uint32_t maxSetCount)
+	{
+		return (previousSetCount == 0 ? firstSetCount : static_cast<uint32_t>(std::min<uint64_t>(uint64_t(previousSetCount) * 2, maxSetCount)));
+	}
+
+	/*@brief Returns the key identifying a descriptor set of a given layout pointing to given resources, the same resources given in another order
+	* getting the same key
+	*
+	* @param descriptorSetLayout The layout of the descriptor set
+	* @param bindings The resources of the bindings
+	*
+	* @return The key of the descriptor set
+	*/
+	inline std::vector<uint32_t> getDescriptorSetKey(const vk::DescriptorSetLayout& descriptorSetLayout, std::vector<DescriptorBinding> bindings)
+	{
+		std::sort(bindings.begin(), bindings.end(), [](const DescriptorBinding& lhs, const DescriptorBinding& rhs)
+		{
+			return lhs.binding < rhs.binding;
+		});
+
+		std::vector<uint32_t> key;
+		appendHandleKey(key, descriptorSetLayout);
+		key.push_back(static_cast<uint32_t>(bindings.size()));
+
+		for (const DescriptorBinding& binding : bindings)
+		{
+			key.insert(key.end(), { binding.binding, static_cast<uint32_t>(binding.descriptorType) });
+
+			if (isImageDescriptorType(binding.descriptorType))
+			{
+				appendHandleKey(key, binding.imageView);
+				appendHandleKey(key, binding.sampler);
+				key.push_back(static_cast<uint32_t>(binding.imageLayout));
+			}
+			else
+			{
+				appendHandleKey(key, binding.buffer);
+				key.insert(key.end(), { static_cast<uint32_t>(binding.offset), static_cast<uint32_t>(binding.offset >> 32),
+					static_cast<uint32_t>(binding.range), static_cast<uint32_t>(binding.range >> 32) });
+			}
+		}
+
+		return key;
+	}
+
+	/*Descriptor sets allocated from growable chains of descriptor pools, one chain per frame in flight. Sets are never freed one by one :
+	* beginFrame() resets every pool the frame used once its fence signaled, which makes an allocation a pointer bump in the current pool
+	* and a new pool (recycled, or created twice as large up to a limit) when it is full.
+	* Sets living longer than a frame (material textures, constant buffers...) come from a persistent chain, and getImmutableSet() shares the
+	* sets of a same layout pointing to the same resources. Immutable sets are keyed by resource handles : releaseImmutableSets() must be called
+	* with every buffer, image view or sampler about to be destroyed, otherwise a new resource given the same handle would get a set pointing
+	* to freed memory. Thread safe, pools live until destroyPools()*/
+	class DescriptorAllocator
+	{
+	public:
+		DescriptorAllocator(vk::Device logicDevice, const uint32_t framesInFlight = 2, std::vector<DescriptorPoolRatio> poolRatios = getDefaultDescriptorPoolRatios(),
+			const uint32_t firstPoolSetCount = 64, const uint32_t maxPoolSetCount = 4096)
+			: device(logicDevice), ratios(std::move(poolRatios)), frames(std::max(framesInFlight, 1u)), persistentChain(),
+			firstSetCount(std::max(firstPoolSetCount, 1u)), maxSetCount(std::max(maxPoolSetCount, std::max(firstPoolSetCount, 1u)))
+		{
+
+		}
+
+		DescriptorAllocator(const DescriptorAllocator&) = delete;
+		DescriptorAllocator& operator=(const DescriptorAllocator&) = delete;
+
+		/*@brief Starts a frame in flight, resetting every pool its sets were allocated from. To be called once the fence of the frame
+		* (the last submission using its sets) signaled
+		*
+		* @param frameIndex The index of the frame in flight, below the number given to the constructor
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), DescriptorError)
+		*/
+		inline SkResult<bool, DescriptorError> beginFrame(const uint32_t frameIndex)
+		{
+			SkResult result(static_cast<bool>(true), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+			std::lock_guard<std::mutex> lock(allocatorMutex);
+
+			currentFrame = frameIndex % static_cast<uint32_t>(frames.size());
+			PoolChain& chain = frames[currentFrame];
+
+			//Immutable sets released the last time the frame ran are no longer used by the GPU
+			freeImmutableSets.insert(freeImmutableSets.end(), chain.releasedSets.begin(), chain.releasedSets.end());
+			chain.releasedSets.clear();
+
+			for (const SizedPool& pool : chain.usedPools)
+			{
+				try
+				{
+					device.resetDescriptorPool(pool.descriptorPool);
+					readyPools.push_back(pool);
+				}
+				catch (vk::SystemError err)
+				{
+					result.error = DescriptorError::DESCRIPTOR_POOL_RESET_ERROR;
+					result.error = affectError(destroyDescriptorPool(device, pool.descriptorPool), result.error);
+				}
+			}
+
+			chain.usedPools.clear();
+
+			result.value = (result.error == DescriptorError::NO_ERROR);
+			return result;
+		}
+
+		/*@brief Allocates a descriptor set living until the current frame in flight starts again
+		*
+		* @param descriptorSetLayout The layout of the descriptor set
+		*
+		* @return SkResult(allocated descriptor set, DescriptorError)
+		*/
+		inline SkResult<vk::DescriptorSet, DescriptorError> allocate(const vk::DescriptorSetLayout& descriptorSetLayout)
+		{
+			std::lock_guard<std::mutex> lock(allocatorMutex);
+			return allocateFromChain(frames[currentFrame], descriptorSetLayout);
+		}
+
+		/*@brief Allocates a descriptor set living until destroyPools()
+		*
+		* @param descriptorSetLayout The layout of the descriptor set
+		*
+		* @return SkResult(allocated descriptor set, DescriptorError)
+		*/
+		inline SkResult<vk::DescriptorSet, DescriptorError> allocatePersistent(const vk::DescriptorSetLayout& descriptorSetLayout)
+		{
+			std::lock_guard<std::mutex> lock(allocatorMutex);
+			return allocateFromChain(persistentChain, descriptorSetLayout);
+		}
+
+		/*@brief Returns the persistent descriptor set of a given layout pointing to given resources, allocating and writing it only if no such set exists.
+		* The set must not be updated afterwards, since every user of the same layout and resources shares it. Sets released by releaseImmutableSets()
+		* are reused once no frame in flight uses them anymore
+		*
+		* @param descriptorSetLayout The layout of the descriptor set
+		* @param bindings The resources of the bindings
+		*
+		* @return SkResult(descriptor set owned by the allocator, DescriptorError)
+		*/
+		inline SkResult<vk::DescriptorSet, DescriptorError> getImmutableSet(const vk::DescriptorSetLayout& descriptorSetLayout, const std::vector<DescriptorBinding>& bindings)
+		{
+			SkResult result(static_cast<vk::DescriptorSet>(vk::DescriptorSet(nullptr)), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+			std::vector<uint32_t> key = getDescriptorSetKey(descriptorSetLayout, bindings);
+
+			std::lock_guard<std::mutex> lock(allocatorMutex);
+
+			auto immutableSetIterator = immutableSets.find(key);
+			if (immutableSetIterator != immutableSets.end())
+			{
+				result.value = immutableSetIterator->second.descriptorSet;
+				return result;
+			}
+
+			//A released set of the same layout is rewritten rather than a new one allocated
+			auto freeSetIterator = std::find_if(freeImmutableSets.begin(), freeImmutableSets.end(), [&descriptorSetLayout](const Pair<vk::DescriptorSetLayout, vk::DescriptorSet>& freeSet)
+			{
+				return freeSet.a == descriptorSetLayout;
+			});
+
+			if (freeSetIterator != freeImmutableSets.end())
+			{
+				result.value = freeSetIterator->b;
+				freeImmutableSets.erase(freeSetIterator);
+			}
+			else
+			{
+				auto allocateResult = allocateFromChain(persistentChain, descriptorSetLayout);
+				if (error(allocateResult))
+				{
+					result.error = allocateResult.error;
+					return result;
+				}
+
+				result.value = allocateResult.value;
+			}
+
+			writeDescriptorSet(device, result.value, bindings);
+			immutableSets.emplace(std::move(key), ImmutableSet{ result.value, descriptorSetLayout, bindings });
+
+			return result;
+		}
+
+		/*@brief Releases the immutable sets pointing to a buffer, to be called before the buffer is destroyed. The sets are reused once
+		* the current frame in flight starts again, the submissions of the frames in flight may still use them
+		*
+		* @param buffer The vulkan buffer about to be destroyed
+		*
+		* @return SkResult(number of released sets, DescriptorError)
+		*/
+		inline SkResult<uint32_t, DescriptorError> releaseImmutableSets(const vk::Buffer& buffer)
+		{
+			return releaseImmutableSetsIf([&buffer](const DescriptorBinding& binding)
+			{
+				return !isImageDescriptorType(binding.descriptorType) && binding.buffer == buffer;
+			});
+		}
+
+		/*@brief Releases the immutable sets pointing to an image view, to be called before the image view is destroyed (see releaseImmutableSets(buffer))
+		*
+		* @param imageView The vulkan image view about to be destroyed
+		*
+		* @return SkResult(number of released sets, DescriptorError)
+		*/
+		inline SkResult<uint32_t, DescriptorError> releaseImmutableSets(const vk::ImageView& imageView)
+		{
+			return releaseImmutableSetsIf([&imageView](const DescriptorBinding& binding)
+			{
+				return isImageDescriptorType(binding.descriptorType) && binding.imageView == imageView;
+			});
+		}
+
+		/*@brief Releases the immutable sets pointing to a sampler, to be called before the sampler is destroyed (see releaseImmutableSets(buffer))
+		*
+		* @param sampler The vulkan sampler about to be destroyed
+		*
+		* @return SkResult(number of released sets, DescriptorError)
+		*/
+		inline SkResult<uint32_t, DescriptorError> releaseImmutableSets(const vk::Sampler& sampler)
+		{
+			return releaseImmutableSetsIf([&sampler](const DescriptorBinding& binding)
+			{
+				return isImageDescriptorType(binding.descriptorType) && binding.sampler == sampler;
+			});
+		}
+
+		/*Returns the number of descriptor pools created by the allocator, in use or ready to be reused*/
+		inline size_t getPoolCount()
+		{
+			std::lock_guard<std::mutex> lock(allocatorMutex);
+
+			size_t poolCount = readyPools.size() + persistentChain.usedPools.size();
+			for (const PoolChain& chain : frames)
+			{
+				poolCount += chain.usedPools.size();
+			}
+
+			return poolCount;
+		}
+
+		/*Returns the number of distinct immutable descriptor sets held by the allocator*/
+		inline size_t getImmutableSetCount()
+		{
+			std::lock_guard<std::mutex> lock(allocatorMutex);
+			return immutableSets.size();
+		}
+
+		/*@brief Destroys every descriptor pool of the allocator, freeing every descriptor set allocated from it
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), DescriptorError)
+		*/
+		inline SkResult<bool, DescriptorError> destroyPools()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+			std::lock_guard<std::mutex> lock(allocatorMutex);
+
+			std::vector<SizedPool> pools = std::move(readyPools);
+			readyPools.clear();
+
+			for (PoolChain& chain : frames)
+			{
+				pools.insert(pools.end(), chain.usedPools.begin(), chain.usedPools.end());
+				chain.usedPools.clear();
+			}
+
+			pools.insert(pools.end(), persistentChain.usedPools.begin(), persistentChain.usedPools.end());
+			persistentChain.usedPools.clear();
+
+			for (const SizedPool& pool : pools)
+			{
+				result.error = affectError(destroyDescriptorPool(device, pool.descriptorPool), result.error);
+			}
+
+			immutableSets.clear();
+			freeImmutableSets.clear();
+			for (PoolChain& chain : frames)
+			{
+				chain.releasedSets.clear();
+			}
+			nextSetCount = 0;
+
+			result.value = (result.error == DescriptorError::NO_ERROR);
+			return result;
+		}
+
+	private:
+		struct SizedPool
+		{
+			vk::DescriptorPool descriptorPool;
+			uint32_t maxSets;
+		};
+
+		//The last used pool is the one sets are allocated from, the previous ones are full
+		struct PoolChain
+		{
+			std::vector<SizedPool> usedPools;
+
+			//Immutable sets released during the frame, with their layout
+			std::vector<Pair<vk::DescriptorSetLayout, vk::DescriptorSet>> releasedSets;
+		};
+
+		struct ImmutableSet
+		{
+			vk::DescriptorSet descriptorSet;
+			vk::DescriptorSetLayout descriptorSetLayout;
+			std::vector<DescriptorBinding> bindings;
+		};
+
+		template<typename Predicate>
+		inline SkResult<uint32_t, DescriptorError> releaseImmutableSetsIf(const Predicate& isBindingReleased)
+		{
+			SkResult result(static_cast<uint32_t>(0), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+			std::lock_guard<std::mutex> lock(allocatorMutex);
+
+			for (auto immutableSetIterator = immutableSets.begin(); immutableSetIterator != immutableSets.end();)
+			{
+				const ImmutableSet& immutableSet = immutableSetIterator->second;
+				if (std::none_of(immutableSet.bindings.begin(), immutableSet.bindings.end(), isBindingReleased))
+				{
+					++immutableSetIterator;
+					continue;
+				}
+
+				frames[currentFrame].releasedSets.emplace_back(immutableSet.descriptorSetLayout, immutableSet.descriptorSet);
+				immutableSetIterator = immutableSets.erase(immutableSetIterator);
+				result.value++;
+			}
+
+			return result;
+		}
+
+		inline SkResult<vk::DescriptorSet, DescriptorError> allocateFromChain(PoolChain& chain, const vk::DescriptorSetLayout& descriptorSetLayout)
+		{
+			SkResult result(static_cast<vk::DescriptorSet>(vk::DescriptorSet(nullptr)), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+			//A full pool is retried once in a fresh one, a set which does not fit in an empty pool is an error
+			for (uint32_t attempt = 0; attempt < 2; attempt++)
+			{
+				if (chain.usedPools.empty() || attempt > 0)
+				{
+					auto acquirePoolResult = acquirePool();
+					if (error(acquirePoolResult))
+					{
+						result.error = acquirePoolResult.error;
+						return result;
+					}
+
+					chain.usedPools.push_back(acquirePoolResult.value);
+				}
+
+				vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo = {};
+				descriptorSetAllocateInfo.descriptorPool = chain.usedPools.back().descriptorPool;
+				descriptorSetAllocateInfo.descriptorSetCount = 1;
+				descriptorSetAllocateInfo.pSetLayouts = &descriptorSetLayout;
+
+				try
+				{
+					result.value = device.allocateDescriptorSets(descriptorSetAllocateInfo)[0];
+					return result;
+				}
+				catch (vk::OutOfPoolMemoryError err)
+				{
+					continue;
+				}
+				catch (vk::FragmentedPoolError err)
+				{
+					continue;
+				}
+				catch (vk::SystemError err)
+				{
+					break;
+				}
+			}
+
+			result.error = DescriptorError::DESCRIPTOR_SET_ALLOCATION_ERROR;
+			return result;
+		}
+
+		//Recycles a reset pool if any, otherwise creates one twice as large as the previous one
+		inline SkResult<SizedPool, DescriptorError> acquirePool()
+		{
+			SkResult result(static_cast<SizedPool>(SizedPool{ vk::DescriptorPool(nullptr), 0 }), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+			if (!readyPools.empty())
+			{
+				result.value = readyPools.back();
+				readyPools.pop_back();
+				return result;
+			}
+
+			nextSetCount = getNextDescriptorPoolSetCount(nextSetCount, firstSetCount, maxSetCount);
+
+			auto createDescriptorPoolResult = createDescriptorPool(device, computeDescriptorPoolSizes(ratios, nextSetCount), nextSetCount);
+			if (error(createDescriptorPoolResult))
+			{
+				result.error = createDescriptorPoolResult.error;
+				return result;
+			}
+
+			result.value = SizedPool{ createDescriptorPoolResult.value, nextSetCount };
+			return result;
+		}
+
+		vk::Device device;
+		std::vector<DescriptorPoolRatio> ratios;
+
+		std::vector<PoolChain> frames;
+		PoolChain persistentChain;
+		std::vector<SizedPool> readyPools;
+		uint32_t currentFrame = 0;
+
+		uint32_t firstSetCount;
+		uint32_t maxSetCount;
+		uint32_t nextSetCount = 0;
+
+		std::unordered_map<std::vector<uint32_t>, ImmutableSet, WordKeyHash> immutableSets;
+		std::vector<Pair<vk::DescriptorSetLayout, vk::DescriptorSet>> freeImmutableSets;
+		std::mutex allocatorMutex;
+	};
+
+	/*Stable indices into an array of descriptors. Released indices are only reused once the frame in flight releasing them comes back
+	* (see beginFrame()), so that the GPU never reads a descriptor overwritten while a submission still uses the previous one. Not thread safe*/
+	class DescriptorSlotAllocator
+	{
+	public:
+		DescriptorSlotAllocator(const uint32_t slotCapacity = 0, const uint32_t framesInFlight = 2)
+			: capacity(slotCapacity), usedSlots(slotCapacity, false), pendingSlots(std::max(framesInFlight, 1u))
+		{
+
+		}
+
+		/*@brief Returns a free index, the most recently recycled one first
+		*
+		* @return SkResult(index below the capacity, DescriptorError)
+		*/
+		inline SkResult<uint32_t, DescriptorError> allocate()
+		{
+			SkResult result(static_cast<uint32_t>(0), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+			if (!freeSlots.empty())
+			{
+				result.value = freeSlots.back();
+				freeSlots.pop_back();
+			}
+			else if (nextSlot < capacity)
+			{
+				result.value = nextSlot++;
+			}
+			else
+			{
+				result.error = DescriptorError::BINDLESS_SLOTS_EXHAUSTED_ERROR;
+				return result;
+			}
+
+			usedSlots[result.value] = true;
+			usedCount++;
+
+			return result;
+		}
+
+		/*@brief Releases an index during the current frame in flight, it becomes free when the frame starts again
+		*
+		* @param slot The index given by allocate()
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), DescriptorError)
+		*/
+		inline SkResult<bool, DescriptorError> release(const uint32_t slot)
+		{
+			SkResult result(static_cast<bool>(true), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+			if (slot >= capacity || !usedSlots[slot])
+			{
+				result.value = false;
+				result.error = DescriptorError::INVALID_BINDLESS_INDEX_ERROR;
+				return result;
+			}
+
+			usedSlots[slot] = false;
+			usedCount--;
+			pendingSlots[currentFrame].push_back(slot);
+
+			return result;
+		}
+
+		/*@brief Starts a frame in flight, freeing the indices released the last time it ran. To be called once the fence of the frame signaled
+		*
+		* @param frameIndex The index of the frame in flight
+		*/
+		inline void beginFrame(const uint32_t frameIndex)
+		{
+			currentFrame = frameIndex % static_cast<uint32_t>(pendingSlots.size());
+
+			std::vector<uint32_t>& retiredSlots = pendingSlots[currentFrame];
+			freeSlots.insert(freeSlots.end(), retiredSlots.begin(), retiredSlots.end());
+			retiredSlots.clear();
+		}
+
+		/*Returns the number of indices in use, released indices waiting for their frame not included*/
+		inline uint32_t getUsedCount() const
+		{
+			return usedCount;
+		}
+
+		/*Returns the number of indices the allocator can hand out*/
+		inline uint32_t getCapacity() const
+		{
+			return capacity;
+		}
+
+		/*Returns true if a given index is in use*/
+		inline bool isUsed(const uint32_t slot) const
+		{
+			return (slot < capacity && usedSlots[slot]);
+		}
+
+	private:
+		uint32_t capacity;
+		uint32_t nextSlot = 0;
+		uint32_t usedCount = 0;
+		uint32_t currentFrame = 0;
+
+		std::vector<bool> usedSlots;
+		std::vector<uint32_t> freeSlots;
+		std::vector<std::vector<uint32_t>> pendingSlots;
+	};
+
+	/*Resource arrays of a BindlessDescriptorSet, the value being the binding of the array*/
+	enum class BindlessResourceType
+	{
+		SAMPLED_IMAGE = 0,
+		STORAGE_BUFFER = 1,
+		SAMPLER = 2
+	};
+
+	/*Indices given to a draw through push constants (see recordBindlessDrawIndices()), matching shaders/bindless_mesh.frag*/
+	struct BindlessDrawIndices
+	{
+		uint32_t sampledImageIndex = 0;
+		uint32_t samplerIndex = 0;
+		uint32_t storageBufferIndex = 0;
+		uint32_t instanceIndex = 0;
+	};
+
+	/*@brief Returns the push constant range holding the BindlessDrawIndices of a draw, to be added to the pipeline layouts using a BindlessDescriptorSet
+	*
+	* @param stageFlags The vulkan shader stages reading the indices (default is vertex and fragment)
+	*
+	* @return The vulkan push constant range
+	*/
+	inline vk::PushConstantRange getBindlessPushConstantRange(const vk::ShaderStageFlags stageFlags = (vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment))
+	{
+		vk::PushConstantRange pushConstantRange = {};
+		pushConstantRange.stageFlags = stageFlags;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(BindlessDrawIndices);
+
+		return pushConstantRange;
+	}
+
+	/*@brief Records the indices of the resources of a draw, replacing the descriptor set binds of every draw
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands
+	* @param pipelineLayout The vulkan pipeline layout holding the range given by getBindlessPushConstantRange()
+	* @param stageFlags The vulkan shader stages of the range
+	* @param indices The indices of the draw
+	*/
+	inline void recordBindlessDrawIndices(const vk::CommandBuffer& commandBuffer, const vk::PipelineLayout& pipelineLayout, const vk::ShaderStageFlags stageFlags,
+		const BindlessDrawIndices& indices)
+	{
+		commandBuffer.pushConstants(pipelineLayout, stageFlags, 0, sizeof(BindlessDrawIndices), &indices);
+	}
+
+	/*@brief Checks the sizes of the arrays of a BindlessDescriptorSet against the update after bind limits of a device, every array being visible
+	* to every shader stage
+	*
+	* @param descriptorIndexingProperties The descriptor indexing properties of the physical device
+	* @param sampledImageCount The size of the sampled image array
+	* @param storageBufferCount The size of the storage buffer array
+	* @param samplerCount The size of the sampler array
+	*
+	* @return SkResult(bool indicating if the arrays fit(true) or not(false), DescriptorError), BINDLESS_LIMIT_EXCEEDED_ERROR if an array is too large
+	*/
+	inline SkResult<bool, DescriptorError> checkBindlessDescriptorLimits(const vk::PhysicalDeviceDescriptorIndexingPropertiesEXT& descriptorIndexingProperties,
+		const uint32_t sampledImageCount, const uint32_t storageBufferCount, const uint32_t samplerCount)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+		const uint64_t resourceCount = static_cast<uint64_t>(sampledImageCount) + storageBufferCount + samplerCount;
+
+		const bool fits = (sampledImageCount <= descriptorIndexingProperties.maxDescriptorSetUpdateAfterBindSampledImages)
+			&& (sampledImageCount <= descriptorIndexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages)
+			&& (storageBufferCount <= descriptorIndexingProperties.maxDescriptorSetUpdateAfterBindStorageBuffers)
+			&& (storageBufferCount <= descriptorIndexingProperties.maxPerStageDescriptorUpdateAfterBindStorageBuffers)
+			&& (samplerCount <= descriptorIndexingProperties.maxDescriptorSetUpdateAfterBindSamplers)
+			&& (samplerCount <= descriptorIndexingProperties.maxPerStageDescriptorUpdateAfterBindSamplers)
+			&& (resourceCount <= descriptorIndexingProperties.maxPerStageUpdateAfterBindResources);
+
+		if (!fits)
+		{
+			result.value = false;
+			result.error = DescriptorError::BINDLESS_LIMIT_EXCEEDED_ERROR;
+		}
+
+		return result;
+	}
+
+	/*One descriptor set holding every sampled image, storage buffer and sampler of the renderer in three large arrays (VK_EXT_descriptor_indexing,
+	* see getDescriptorIndexingSupport()). Registered resources get a stable index that shaders use to reach them, so the set is bound once per
+	* command buffer and draws only push their indices. Descriptors are partially bound and updated after bind : unused indices stay empty and
+	* resources can be registered while the set is in use. Thread safe, the set lives until destroy()*/
+	class BindlessDescriptorSet
+	{
+	public:
+		BindlessDescriptorSet(vk::Device logicDevice, const uint32_t sampledImageCount = 16384, const uint32_t storageBufferCount = 4096, const uint32_t samplerCount = 64,
+			const uint32_t framesInFlight = 2)
+			: device(logicDevice), slotAllocators{ DescriptorSlotAllocator(sampledImageCount, framesInFlight), DescriptorSlotAllocator(storageBufferCount, framesInFlight),
+				DescriptorSlotAllocator(samplerCount, framesInFlight) }
+		{
+
+		}
+
+		BindlessDescriptorSet(const BindlessDescriptorSet&) = delete;
+		BindlessDescriptorSet& operator=(const BindlessDescriptorSet&) = delete;
+
+		/*@brief Creates the descriptor set layout, the descriptor pool and the descriptor set. Binding 0 holds the sampled images,
+		* binding 1 the storage buffers and binding 2 the samplers, all visible to every shader stage
+		*
+		* @param physicalDevice The vulkan physical device of the device, whose update after bind limits must hold the arrays
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), DescriptorError), BINDLESS_LIMIT_EXCEEDED_ERROR if an array is
+		* larger than the limits of the device (see checkBindlessDescriptorLimits())
+		*/
+		inline SkResult<bool, DescriptorError> create(const vk::PhysicalDevice& physicalDevice)
+		{
+			SkResult result(static_cast<bool>(true), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+			std::lock_guard<std::mutex> lock(setMutex);
+
+			vk::PhysicalDeviceDescriptorIndexingPropertiesEXT descriptorIndexingProperties = {};
+
+			vk::PhysicalDeviceProperties2 properties = {};
+			properties.pNext = &descriptorIndexingProperties;
+
+			physicalDevice.getProperties2(&properties);
+
+			auto checkLimitsResult = checkBindlessDescriptorLimits(descriptorIndexingProperties, slotAllocators[0].getCapacity(), slotAllocators[1].getCapacity(),
+				slotAllocators[2].getCapacity());
+			if (error(checkLimitsResult))
+			{
+				return checkLimitsResult;
+			}
+
+			const std::array<vk::DescriptorType, 3> descriptorTypes = { vk::DescriptorType::eSampledImage, vk::DescriptorType::eStorageBuffer, vk::DescriptorType::eSampler };
+
+			std::vector<vk::DescriptorSetLayoutBinding> bindings(descriptorTypes.size());
+			std::vector<vk::DescriptorBindingFlagsEXT> bindingFlags(descriptorTypes.size(), vk::DescriptorBindingFlagBitsEXT::ePartiallyBound | vk::DescriptorBindingFlagBitsEXT::eUpdateAfterBind);
+			std::vector<vk::DescriptorPoolSize> poolSizes;
+
+			for (size_t i = 0; i < descriptorTypes.size(); i++)
+			{
+				bindings[i].binding = static_cast<uint32_t>(i);
+				bindings[i].descriptorType = descriptorTypes[i];
+				bindings[i].descriptorCount = slotAllocators[i].getCapacity();
+				bindings[i].stageFlags = vk::ShaderStageFlagBits::eAll;
+
+				poolSizes.emplace_back(descriptorTypes[i], std::max(slotAllocators[i].getCapacity(), 1u));
+			}
+
+			vk::DescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsCreateInfo = {};
+			bindingFlagsCreateInfo.bindingCount = static_cast<uint32_t>(bindingFlags.size());
+			bindingFlagsCreateInfo.pBindingFlags = bindingFlags.data();
+
+			vk::DescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = {};
+			descriptorSetLayoutCreateInfo.pNext = &bindingFlagsCreateInfo;
+			descriptorSetLayoutCreateInfo.flags = vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPoolEXT;
+			descriptorSetLayoutCreateInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+			descriptorSetLayoutCreateInfo.pBindings = bindings.data();
+
+			try
+			{
+				descriptorSetLayout = device.createDescriptorSetLayout(descriptorSetLayoutCreateInfo);
+			}
+			catch (vk::SystemError err)
+			{
+				result.value = false;
+				result.error = DescriptorError::DESCRIPTOR_SET_LAYOUT_CREATION_ERROR;
+				return result;
+			}
+
+			auto createDescriptorPoolResult = createDescriptorPool(device, poolSizes, 1, vk::DescriptorPoolCreateFlagBits::eUpdateAfterBindEXT);
+			if (error(createDescriptorPoolResult))
+			{
+				result.value = false;
+				result.error = createDescriptorPoolResult.error;
+				return result;
+			}
+
+			descriptorPool = createDescriptorPoolResult.value;
+
+			auto allocateDescriptorSetResult = allocateDescriptorSet(device, descriptorPool, descriptorSetLayout);
+			if (error(allocateDescriptorSetResult))
+			{
+				result.value = false;
+				result.error = allocateDescriptorSetResult.error;
+				return result;
+			}
+
+			descriptorSet = allocateDescriptorSetResult.value;
+
+			return result;
+		}
+
+		/*@brief Registers a sampled image, to be combined in shaders with a sampler registered by registerSampler()
+		*
+		* @param imageView The vulkan image view of the image
+		* @param imageLayout The layout of the image when shaders read it (default is shader read only)
+		*
+		* @return SkResult(index of the image in binding 0, DescriptorError), BINDLESS_SET_NOT_CREATED_ERROR if create() did not succeed
+		*/
+		inline SkResult<uint32_t, DescriptorError> registerSampledImage(const vk::ImageView& imageView, const vk::ImageLayout imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal)
+		{
+			DescriptorBinding binding = {};
+			binding.descriptorType = vk::DescriptorType::eSampledImage;
+			binding.imageView = imageView;
+			binding.imageLayout = imageLayout;
+
+			return registerResource(BindlessResourceType::SAMPLED_IMAGE, binding);
+		}
+
+		/*@brief Registers a storage buffer range
+		*
+		* @param buffer The vulkan buffer
+		* @param offset The offset of the range in the buffer (default is 0)
+		* @param range The size of the range in the buffer (default is the whole buffer)
+		*
+		* @return SkResult(index of the buffer in binding 1, DescriptorError), BINDLESS_SET_NOT_CREATED_ERROR if create() did not succeed
+		*/
+		inline SkResult<uint32_t, DescriptorError> registerStorageBuffer(const vk::Buffer& buffer, const vk::DeviceSize offset = 0, const vk::DeviceSize range = VK_WHOLE_SIZE)
+		{
+			DescriptorBinding binding = {};
+			binding.descriptorType = vk::DescriptorType::eStorageBuffer;
+			binding.buffer = buffer;
+			binding.offset = offset;
+			binding.range = range;
+
+			return registerResource(BindlessResourceType::STORAGE_BUFFER, binding);
+		}
+
+		/*@brief Registers a sampler
+		*
+		* @param sampler The vulkan sampler
+		*
+		* @return SkResult(index of the sampler in binding 2, DescriptorError), BINDLESS_SET_NOT_CREATED_ERROR if create() did not succeed
+		*/
+		inline SkResult<uint32_t, DescriptorError> registerSampler(const vk::Sampler& sampler)
+		{
+			DescriptorBinding binding = {};
+			binding.descriptorType = vk::DescriptorType::eSampler;
+			binding.sampler = sampler;
+
+			return registerResource(BindlessResourceType::SAMPLER, binding);
+		}
+
+		/*@brief Releases the index of a resource, reused once the current frame in flight retired. The resource itself can be destroyed
+		* once no submission uses it anymore
+		*
+		* @param resourceType The array holding the resource
+		* @param index The index given when the resource was registered
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), DescriptorError)
+		*/
+		inline SkResult<bool, DescriptorError> release(const BindlessResourceType resourceType, const uint32_t index)
+		{
+			std::lock_guard<std::mutex> lock(setMutex);
+			return slotAllocators[static_cast<uint32_t>(resourceType)].release(index);
+		}
+
+		/*@brief Starts a frame in flight, recycling the indices released the last time it ran. To be called once the fence of the frame signaled
+		*
+		* @param frameIndex The index of the frame in flight
+		*/
+		inline void beginFrame(const uint32_t frameIndex)
+		{
+			std::lock_guard<std::mutex> lock(setMutex);
+			for (DescriptorSlotAllocator& slotAllocator : slotAllocators)
+			{
+				slotAllocator.beginFrame(frameIndex);
+			}
+		}
+
+		/*@brief Records the bind of the set, once per command buffer and pipeline layout
+		*
+		* @param commandBuffer The vulkan command buffer receiving the commands
+		* @param pipelineBindPoint The vulkan pipeline bind point (graphics or compute)
+		* @param pipelineLayout The vulkan pipeline layout whose set firstSet is getDescriptorSetLayout()
+		* @param firstSet The set number of the bindless set in the pipeline layout (default is 0)
+		*/
+		inline void bind(const vk::CommandBuffer& commandBuffer, const vk::PipelineBindPoint pipelineBindPoint, const vk::PipelineLayout& pipelineLayout, const uint32_t firstSet = 0)
+		{
+			commandBuffer.bindDescriptorSets(pipelineBindPoint, pipelineLayout, firstSet, descriptorSet, nullptr);
+		}
+
+		/*Returns the descriptor set layout, to be used in the pipeline layouts reading bindless resources*/
+		inline vk::DescriptorSetLayout getDescriptorSetLayout() const
+		{
+			return descriptorSetLayout;
+		}
+
+		/*Returns the descriptor set*/
+		inline vk::DescriptorSet getDescriptorSet() const
+		{
+			return descriptorSet;
+		}
+
+		/*Returns the number of registered resources of a given type*/
+		inline uint32_t getResourceCount(const BindlessResourceType resourceType)
+		{
+			std::lock_guard<std::mutex> lock(setMutex);
+			return slotAllocators[static_cast<uint32_t>(resourceType)].getUsedCount();
+		}
+
+		/*@brief Destroys the descriptor pool, freeing the set, and the descriptor set layout
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), DescriptorError)
+		*/
+		inline SkResult<bool, DescriptorError> destroy()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+			std::lock_guard<std::mutex> lock(setMutex);
+
+			if (descriptorPool)
+			{
+				result.error = affectError(destroyDescriptorPool(device, descriptorPool), result.error);
+				descriptorPool = vk::DescriptorPool(nullptr);
+				descriptorSet = vk::DescriptorSet(nullptr);
+			}
+
+			if (descriptorSetLayout)
+			{
+				result.error = affectError(destroyDescriptorSetLayout(device, descriptorSetLayout), result.error);
+				descriptorSetLayout = vk::DescriptorSetLayout(nullptr);
+			}
+
+			result.value = (result.error == DescriptorError::NO_ERROR);
+			return result;
+		}
+
+	private:
+		inline SkResult<uint32_t, DescriptorError> registerResource(const BindlessResourceType resourceType, DescriptorBinding binding)
+		{
+			std::lock_guard<std::mutex> lock(setMutex);
+
+			//Checked before taking a slot, a write to a null set being invalid
+			if (!descriptorSet)
+			{
+				SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<DescriptorError>(DescriptorError::BINDLESS_SET_NOT_CREATED_ERROR));
+				return result;
+			}
+
+			auto allocateResult = slotAllocators[static_cast<uint32_t>(resourceType)].allocate();
+			if (error(allocateResult))
+			{
+				return allocateResult;
+			}
+
+			binding.binding = static_cast<uint32_t>(resourceType);
+
+			vk::DescriptorBufferInfo descriptorBufferInfo = {};
+			descriptorBufferInfo.buffer = binding.buffer;
+			descriptorBufferInfo.offset = binding.offset;
+			descriptorBufferInfo.range = binding.range;
+
+			vk::DescriptorImageInfo descriptorImageInfo = {};
+			descriptorImageInfo.sampler = binding.sampler;
+			descriptorImageInfo.imageView = binding.imageView;
+			descriptorImageInfo.imageLayout = binding.imageLayout;
+
+			//The index is the element of the array, the whole array being a single binding
+			vk::WriteDescriptorSet writeDescriptorSet = {};
+			writeDescriptorSet.dstSet = descriptorSet;
+			writeDescriptorSet.dstBinding = binding.binding;
+			writeDescriptorSet.dstArrayElement = allocateResult.value;
+			writeDescriptorSet.descriptorCount = 1;
+			writeDescriptorSet.descriptorType = binding.descriptorType;
+
+			if (isImageDescriptorType(binding.descriptorType))
+			{
+				writeDescriptorSet.pImageInfo = &descriptorImageInfo;
+			}
+			else
+			{
+				writeDescriptorSet.pBufferInfo = &descriptorBufferInfo;
+			}
+
+			device.updateDescriptorSets(writeDescriptorSet, nullptr);
+
+			return allocateResult;
+		}
+
+		vk::Device device;
+
+		vk::DescriptorSetLayout descriptorSetLayout = vk::DescriptorSetLayout(nullptr);
+		vk::DescriptorPool descriptorPool = vk::DescriptorPool(nullptr);
+		vk::DescriptorSet descriptorSet = vk::DescriptorSet(nullptr);
+
+		std::array<DescriptorSlotAllocator, 3> slotAllocators;
+		std::mutex setMutex;
+	};
+
+	/*GPU PROFILING*/
+
+	/*Time spent by the GPU in a zone of a frame, zones nested in other zones having a higher depth*/
+	struct GpuZoneTiming
+	{
+		std::string name;
+		uint32_t depth = 0;
+		double milliseconds = 0.0;
+
+		//Raw timestamps of the zone, aligned on the CPU clock by a GpuClockCalibration
+		uint64_t beginTimestamp = 0;
+		uint64_t endTimestamp = 0;
+	};
+
+	/*Timestamp queries of a zone, the end query being std::numeric_limits<uint32_t>::max() while the zone is open*/
+	struct GpuZoneQueries
+	{
+		std::string name;
+		uint32_t depth = 0;
+		uint32_t beginQuery = 0;
+		uint32_t endQuery = std::numeric_limits<uint32_t>::max();
+	};
+
+	/*@brief Converts two timestamps written by the same queue into milliseconds, counters wrapping around after timestampValidBits bits
+	*
+	* @param begin The timestamp written at the beginning of the zone
+	* @param end The timestamp written at the end of the zone
+	* @param timestampValidBits The number of valid bits of the timestamps of the queue family, 0 if it does not support timestamps
+	* @param timestampPeriod The number of nanoseconds per timestamp tick (VkPhysicalDeviceLimits::timestampPeriod)
+	*
+	* @return SkResult(duration in milliseconds, GpuProfilerError)
+	*/
+	inline SkResult<double, GpuProfilerError> getTimestampDuration(const uint64_t begin, const uint64_t end, const uint32_t timestampValidBits, const float timestampPeriod)
+	{
+		SkResult result(static_cast<double>(0.0), static_cast<GpuProfilerError>(GpuProfilerError::NO_ERROR));
+
+		if (timestampValidBits == 0)
+		{
+			result.error = GpuProfilerError::TIMESTAMPS_NOT_SUPPORTED_ERROR;
+			return result;
+		}
+
+		const uint64_t mask = (timestampValidBits >= 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t(1) << timestampValidBits) - 1);
+		const uint64_t ticks = (end - begin) & mask;
+
+		result.value = static_cast<double>(ticks) * static_cast<double>(timestampPeriod) / 1000000.0;
+		return result;
+	}
+
+	/*@brief Converts the timestamp queries of the zones of a frame into timings
+	*
+	* @param zones The zones of the frame, in the order they were begun
+	* @param queryResults The results of the queries read with vk::QueryResultFlagBits::e64 | eWithAvailability, two values (timestamp, availability) per query
+	* @param timestampValidBits The number of valid bits of the timestamps of the queue family
+	* @param timestampPeriod The number of nanoseconds per timestamp tick
+	*
+	* @return SkResult(timings of the closed zones, GpuProfilerError), RESULTS_NOT_AVAILABLE_ERROR if the GPU has not written every timestamp yet
+	*/
+	inline SkResult<std::vector<GpuZoneTiming>, GpuProfilerError> resolveGpuZones(const std::vector<GpuZoneQueries>& zones, const std::vector<uint64_t>& queryResults,
+		const uint32_t timestampValidBits, const float timestampPeriod)
+	{
+		SkResult result(static_cast<std::vector<GpuZoneTiming>>(std::vector<GpuZoneTiming>()), static_cast<GpuProfilerError>(GpuProfilerError::NO_ERROR));
+
+		result.value.reserve(zones.size());
+		for (const GpuZoneQueries& zone : zones)
+		{
+			//Zones left open are not timed
+			if (zone.endQuery == std::numeric_limits<uint32_t>::max())
+			{
+				continue;
+			}
+
+			if (2 * static_cast<size_t>(std::max(zone.beginQuery, zone.endQuery)) + 1 >= queryResults.size())
+			{
+				result.error = GpuProfilerError::QUERY_RESULTS_ERROR;
+				return result;
+			}
+
+			if (queryResults[2 * zone.beginQuery + 1] == 0 || queryResults[2 * zone.endQuery + 1] == 0)
+			{
+				result.error = GpuProfilerError::RESULTS_NOT_AVAILABLE_ERROR;
+				return result;
+			}
+
+			auto getTimestampDurationResult = getTimestampDuration(queryResults[2 * zone.beginQuery], queryResults[2 * zone.endQuery], timestampValidBits, timestampPeriod);
+			if (error(getTimestampDurationResult))
+			{
+				result.error = getTimestampDurationResult.error;
+				return result;
+			}
+
+			result.value.push_back(GpuZoneTiming{ zone.name, zone.depth, getTimestampDurationResult.value, queryResults[2 * zone.beginQuery], queryResults[2 * zone.endQuery] });
+		}
+
+		return result;
+	}
+
+	/*Profiler of the GPU time of the zones of a frame (passes, dispatches, copies), measured by timestamp queries written into the command buffer.
+	* Each frame in flight owns a query pool, read back without waiting when the frame comes back, after the fence of its previous use was waited on :
+	* timings lag framesInFlight frames behind the recorded frame. Not thread safe, query pools live until destroy()*/
+	class GpuProfiler
+	{
+	public:
+		GpuProfiler(vk::PhysicalDevice physicalDevice, vk::Device logicDevice, const uint32_t queueFamilyIndex, const uint32_t framesInFlight = 2, const uint32_t maxZonesPerFrame = 64)
+			: device(logicDevice), queryCount(2 * std::max(maxZonesPerFrame, 1u)), frames(std::max(framesInFlight, 1u))
+		{
+			const std::vector<vk::QueueFamilyProperties> queueFamilies = physicalDevice.getQueueFamilyProperties();
+			if (queueFamilyIndex < queueFamilies.size())
+			{
+				timestampValidBits = queueFamilies[queueFamilyIndex].timestampValidBits;
+			}
+
+			timestampPeriod = physicalDevice.getProperties().limits.timestampPeriod;
+		}
+
+		GpuProfiler(const GpuProfiler&) = delete;
+		GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+		/*@brief Reads the timings of the last use of a frame in flight and resets its queries, to be recorded at the beginning of its command buffer
+		*
+		* @param commandBuffer The vulkan command buffer of the frame, outside of any render pass
+		* @param frameIndex The index of the frame in flight, whose fence was already waited on
+		*
+		* @return SkResult(bool signaling if the operation worked(1) or not(0), GpuProfilerError)
+		*/
+		inline SkResult<bool, GpuProfilerError> beginFrame(const vk::CommandBuffer& commandBuffer, const uint32_t frameIndex)
+		{
+			SkResult result(static_cast<bool>(false), static_cast<GpuProfilerError>(GpuProfilerError::NO_ERROR));
+
+			if (!isSupported())
+			{
+				result.error = GpuProfilerError::TIMESTAMPS_NOT_SUPPORTED_ERROR;
+				return result;
+			}
+
+			currentFrame = frameIndex % static_cast<uint32_t>(frames.size());
+			FrameQueries& frame = frames[currentFrame];
+
+			if (!frame.queryPool)
+			{
+				vk::QueryPoolCreateInfo queryPoolCreateInfo = {};
+				queryPoolCreateInfo.queryType = vk::QueryType::eTimestamp;
+				queryPoolCreateInfo.queryCount = queryCount;
+
+				try
+				{
+					frame.queryPool = device.createQueryPool(queryPoolCreateInfo);
+				}
+				catch (vk::SystemError err)
+				{
+					result.error = GpuProfilerError::QUERY_POOL_CREATION_ERROR;
+					return result;
+				}
+			}
+			else if (!frame.zones.empty())
+			{
+				//Timings not available yet are dropped, the last complete ones being kept
+				auto readResultsResult = readResults(frame);
+				if (error(readResultsResult) && readResultsResult.error != GpuProfilerError::RESULTS_NOT_AVAILABLE_ERROR)
+				{
+					result.error = readResultsResult.error;
+				}
+			}
+
+			commandBuffer.resetQueryPool(frame.queryPool, 0, queryCount);
+
+			frame.zones.clear();
+			frame.writtenQueries = 0;
+			openZones.clear();
+			frameBegun = true;
+
+			result.value = (result.error == GpuProfilerError::NO_ERROR);
+			return result;
+		}
+
+		/*@brief Opens a zone by writing a timestamp once the previous commands reached a given stage, zones may be nested
+		*
+		* @param commandBuffer The vulkan command buffer of the frame
+		* @param name The name the zone is reported with, usually the name of a pass
+		* @param stage The pipeline stage the timestamp waits for (default is top of pipe, the zone starting as soon as it is reached)
+		*
+		* @return SkResult(index of the zone in the frame, GpuProfilerError)
+		*/
+		inline SkResult<uint32_t, GpuProfilerError> beginZone(const vk::CommandBuffer& commandBuffer, const std::string& name,
+			const vk::PipelineStageFlagBits stage = vk::PipelineStageFlagBits::eTopOfPipe)
+		{
+			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<GpuProfilerError>(GpuProfilerError::NO_ERROR));
+
+			if (!frameBegun)
+			{
+				result.error = GpuProfilerError::UNBALANCED_ZONE_ERROR;
+				return result;
+			}
+
+			FrameQueries& frame = frames[currentFrame];
+			if (frame.writtenQueries >= queryCount)
+			{
+				result.error = GpuProfilerError::ZONE_OVERFLOW_ERROR;
+				return result;
+			}
+
+			const uint32_t query = frame.writtenQueries++;
+
+			commandBuffer.writeTimestamp(stage, frame.queryPool, query);
+
+			GpuZoneQueries zone = {};
+			zone.name = name;
+			zone.depth = static_cast<uint32_t>(openZones.size());
+			zone.beginQuery = query;
+
+			result.value = static_cast<uint32_t>(frame.zones.size());
+			openZones.push_back(result.value);
+			frame.zones.push_back(std::move(zone));
+
+			return result;
+		}
+
+		/*@brief Closes the last opened zone by writing a timestamp once the previous commands completed a given stage
+		*
+		* @param commandBuffer The vulkan command buffer of the frame
+		* @param stage The pipeline stage the timestamp waits for (default is bottom of pipe, every previous command being complete)
+		*
+		* @return SkResult(bool signaling if the operation worked(1) or not(0), GpuProfilerError)
+		*/
+		inline SkResult<bool, GpuProfilerError> endZone(const vk::CommandBuffer& commandBuffer, const vk::PipelineStageFlagBits stage = vk::PipelineStageFlagBits::eBottomOfPipe)
+		{
+			SkResult result(static_cast<bool>(false), static_cast<GpuProfilerError>(GpuProfilerError::NO_ERROR));
+
+			if (!frameBegun || openZones.empty())
+			{
+				result.error = GpuProfilerError::UNBALANCED_ZONE_ERROR;
+				return result;
+			}
+
+			FrameQueries& frame = frames[currentFrame];
+			if (frame.writtenQueries >= queryCount)
+			{
+				result.error = GpuProfilerError::ZONE_OVERFLOW_ERROR;
+				return result;
+			}
+
+			const uint32_t query = frame.writtenQueries++;
+
+			commandBuffer.writeTimestamp(stage, frame.queryPool, query);
+
+			frame.zones[openZones.back()].endQuery = query;
+			openZones.pop_back();
+
+			result.value = true;
+			return result;
+		}
+
+		/*Returns the timings of the last frame whose timestamps were all available, in the order the zones were begun*/
+		inline const std::vector<GpuZoneTiming>& getTimings() const
+		{
+			return timings;
+		}
+
+		/*Returns the GPU time of the last frame read back, summing its outermost zones*/
+		inline double getFrameTime() const
+		{
+			double frameTime = 0.0;
+			for (const GpuZoneTiming& timing : timings)
+			{
+				if (timing.depth == 0)
+				{
+					frameTime += timing.milliseconds;
+				}
+			}
+
+			return frameTime;
+		}
+
+		/*Returns whether the queue family writes timestamps*/
+		inline bool isSupported() const
+		{
+			return (timestampValidBits != 0);
+		}
+
+		/*@brief Destroys the query pools of the frames in flight
+		*
+		* @return SkResult(bool signaling if the operation worked(1) or not(0), GpuProfilerError)
+		*/
+		inline SkResult<bool, GpuProfilerError> destroy()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<GpuProfilerError>(GpuProfilerError::NO_ERROR));
+
+			for (FrameQueries& frame : frames)
+			{
+				try
+				{
+					if (frame.queryPool)
+					{
+						device.destroyQueryPool(frame.queryPool);
+					}
+				}
+				catch (vk::SystemError err)
+				{
+					result.value = false;
+					result.error = GpuProfilerError::QUERY_POOL_DESTRUCTION_ERROR;
+				}
+
+				frame.queryPool = nullptr;
+				frame.zones.clear();
+				frame.writtenQueries = 0;
+			}
+
+			openZones.clear();
+			frameBegun = false;
+
+			return result;
+		}
+
+	private:
+		struct FrameQueries
+		{
+			vk::QueryPool queryPool = nullptr;
+			std::vector<GpuZoneQueries> zones;
+
+			//Queries are written in order, whether they begin or end a zone
+			uint32_t writtenQueries = 0;
+		};
+
+		vk::Device device;
+
+		uint32_t timestampValidBits = 0;
+		float    timestampPeriod = 1.0f;
+		uint32_t queryCount;
+
+		std::vector<FrameQueries> frames;
+		uint32_t currentFrame = 0;
+		bool frameBegun = false;
+
+		std::vector<uint32_t> openZones;
+		std::vector<GpuZoneTiming> timings;
+
+		inline SkResult<bool, GpuProfilerError> readResults(const FrameQueries& frame)
+		{
+			SkResult result(static_cast<bool>(false), static_cast<GpuProfilerError>(GpuProfilerError::NO_ERROR));
+
+			std::vector<uint64_t> queryResults(2 * static_cast<size_t>(frame.writtenQueries), 0);
+
+			//Never waits : queries still in flight report themselves as unavailable
+			const vk::Result queryResult = device.getQueryPoolResults(frame.queryPool, 0, frame.writtenQueries, queryResults.size() * sizeof(uint64_t), queryResults.data(),
+				2 * sizeof(uint64_t), vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWithAvailability);
+
+			if (queryResult != vk::Result::eSuccess && queryResult != vk::Result::eNotReady)
+			{
+				result.error = GpuProfilerError::QUERY_RESULTS_ERROR;
+				return result;
+			}
+
+			auto resolveGpuZonesResult = resolveGpuZones(frame.zones, queryResults, timestampValidBits, timestampPeriod);
+			if (error(resolveGpuZonesResult))
+			{
+				result.error = resolveGpuZonesResult.error;
+				return result;
+			}
+
+			timings = std::move(resolveGpuZonesResult.value);
+
+			result.value = true;
+			return result;
+		}
+	};
+
+	/*Pipeline statistics and samples passed by a group of draws, counters not queried being left to 0*/
+	struct DrawGroupStatistics
+	{
+		std::string name;
+
+		uint64_t inputAssemblyVertices = 0;
+		uint64_t inputAssemblyPrimitives = 0;
+		uint64_t vertexShaderInvocations = 0;
+		uint64_t clippingInvocations = 0;
+		uint64_t clippingPrimitives = 0;
+		uint64_t fragmentShaderInvocations = 0;
+		uint64_t computeShaderInvocations = 0;
+
+		//Samples passing the depth and stencil tests, only counted exactly with the occlusionQueryPrecise feature (any non zero value meaning visible otherwise)
+		uint64_t samplesPassed = 0;
+		bool occlusionQueried = false;
+	};
+
+	/*Queries of a group of draws in a query pool of each type, the group being open until it is ended*/
+	struct DrawGroupQueries
+	{
+		std::string name;
+		bool occlusion = false;
+		bool ended = false;
+	};
+
+	/*@brief Returns the pipeline statistics queried by default : vertex and primitive counts, clipping, vertex and fragment shader invocations*/
+	inline vk::QueryPipelineStatisticFlags getDefaultPipelineStatisticFlags()
+	{
+		return vk::QueryPipelineStatisticFlagBits::eInputAssemblyVertices | vk::QueryPipelineStatisticFlagBits::eInputAssemblyPrimitives
+			| vk::QueryPipelineStatisticFlagBits::eVertexShaderInvocations | vk::QueryPipelineStatisticFlagBits::eClippingInvocations
+			| vk::QueryPipelineStatisticFlagBits::eClippingPrimitives | vk::QueryPipelineStatisticFlagBits::eFragmentShaderInvocations;
+	}
+
+	/*@brief Returns the number of values written per pipeline statistics query, one per counter enabled in its query pool
+	*
+	* @param statisticFlags The counters of the query pool
+	*
+	* @return The number of counters
+	*/
+	inline uint32_t getPipelineStatisticCount(const vk::QueryPipelineStatisticFlags& statisticFlags)
+	{
+		uint32_t count = 0;
+		for (uint32_t bits = static_cast<uint32_t>(statisticFlags); bits != 0; bits &= bits - 1)
+		{
+			count++;
+		}
+
+		return count;
+	}
+
+	/*@brief Converts the results of the queries of the groups of draws of a frame into statistics. Pipeline statistics are written
+	* in the order of their bits, lowest first, followed by their availability
+	*
+	* @param groups The groups of draws of the frame, in the order they were begun
+	* @param statisticFlags The counters of the pipeline statistics queries, none if they were not queried
+	* @param statisticResults The results of the pipeline statistics queries read with vk::QueryResultFlagBits::e64 | eWithAvailability
+	* @param occlusionResults The results of the occlusion queries read with vk::QueryResultFlagBits::e64 | eWithAvailability, two values per query
+	*
+	* @return SkResult(statistics of the ended groups, DrawQueryError), RESULTS_NOT_AVAILABLE_ERROR if the GPU has not written every result yet
+	*/
+	inline SkResult<std::vector<DrawGroupStatistics>, DrawQueryError> resolveDrawGroupQueries(const std::vector<DrawGroupQueries>& groups,
+		const vk::QueryPipelineStatisticFlags& statisticFlags, const std::vector<uint64_t>& statisticResults, const std::vector<uint64_t>& occlusionResults)
+	{
+		SkResult result(static_cast<std::vector<DrawGroupStatistics>>(std::vector<DrawGroupStatistics>()), static_cast<DrawQueryError>(DrawQueryError::NO_ERROR));
+
+		const uint32_t statisticCount = getPipelineStatisticCount(statisticFlags);
+		const size_t statisticStride = static_cast<size_t>(statisticCount) + 1;
+
+		if ((statisticCount > 0 && statisticResults.size() < groups.size() * statisticStride) || occlusionResults.size() < 2 * groups.size())
+		{
+			result.error = DrawQueryError::QUERY_RESULTS_ERROR;
+			return result;
+		}
+
+		result.value.reserve(groups.size());
+		for (size_t i = 0; i < groups.size(); i++)
+		{
+			if (!groups[i].ended)
+			{
+				continue;
+			}
+
+			DrawGroupStatistics statistics = {};
+			statistics.name = groups[i].name;
+
+			if (statisticCount > 0)
+			{
+				const uint64_t* pValues = statisticResults.data() + i * statisticStride;
+				if (pValues[statisticCount] == 0)
+				{
+					result.error = DrawQueryError::RESULTS_NOT_AVAILABLE_ERROR;
+					return result;
+				}
+
+				//Counters of the pool come one after the other, in the order of their bits
+				uint32_t valueIndex = 0;
+				for (uint32_t bits = static_cast<uint32_t>(statisticFlags); bits != 0; bits &= bits - 1)
+				{
+					const uint64_t value = pValues[valueIndex++];
+
+					switch (static_cast<vk::QueryPipelineStatisticFlagBits>(bits & (~bits + 1)))
+					{
+					case vk::QueryPipelineStatisticFlagBits::eInputAssemblyVertices:    statistics.inputAssemblyVertices = value; break;
+					case vk::QueryPipelineStatisticFlagBits::eInputAssemblyPrimitives:  statistics.inputAssemblyPrimitives = value; break;
+					case vk::QueryPipelineStatisticFlagBits::eVertexShaderInvocations:  statistics.vertexShaderInvocations = value; break;
+					case vk::QueryPipelineStatisticFlagBits::eClippingInvocations:      statistics.clippingInvocations = value; break;
+					case vk::QueryPipelineStatisticFlagBits::eClippingPrimitives:       statistics.clippingPrimitives = value; break;
+					case vk::QueryPipelineStatisticFlagBits::eFragmentShaderInvocations: statistics.fragmentShaderInvocations = value; break;
+					case vk::QueryPipelineStatisticFlagBits::eComputeShaderInvocations:  statistics.computeShaderInvocations = value; break;
+					default: break;
+					}
+				}
+			}
+
+			if (groups[i].occlusion)
+			{
+				if (occlusionResults[2 * i + 1] == 0)
+				{
+					result.error = DrawQueryError::RESULTS_NOT_AVAILABLE_ERROR;
+					return result;
+				}
+
+				statistics.samplesPassed = occlusionResults[2 * i];
+				statistics.occlusionQueried = true;
+			}
+
+			result.value.push_back(std::move(statistics));
+		}
+
+		return result;
+	}
+
+	/*Pipeline statistics and occlusion queries of groups of draws (a material, a pass, the proxy of an occluder), one query of each type per group.
+	* Each frame in flight owns its query pools, read back without waiting when the frame comes back, statistics lagging framesInFlight frames behind.
+	* Pipeline statistics need the pipelineStatisticsQuery feature, exact sample counts the occlusionQueryPrecise feature.
+	* Not thread safe, query pools live until destroy()*/
+	class DrawQueryProfiler
+	{
+	public:
+		DrawQueryProfiler(vk::Device logicDevice, const vk::PhysicalDeviceFeatures& enabledFeatures, const uint32_t framesInFlight = 2, const uint32_t maxGroupsPerFrame = 64,
+			const vk::QueryPipelineStatisticFlags statisticFlags = getDefaultPipelineStatisticFlags())
+			: device(logicDevice), groupCapacity(std::max(maxGroupsPerFrame, 1u)), frames(std::max(framesInFlight, 1u))
+		{
+			pipelineStatisticFlags = (enabledFeatures.pipelineStatisticsQuery == VK_TRUE ? statisticFlags : vk::QueryPipelineStatisticFlags());
+			preciseOcclusion = (enabledFeatures.occlusionQueryPrecise == VK_TRUE);
+		}
+
+		DrawQueryProfiler(const DrawQueryProfiler&) = delete;
+		DrawQueryProfiler& operator=(const DrawQueryProfiler&) = delete;
+
+		/*@brief Reads the statistics of the last use of a frame in flight and resets its queries, to be recorded at the beginning of its command buffer
+		*
+		* @param commandBuffer The vulkan command buffer of the frame, outside of any render pass
+		* @param frameIndex The index of the frame in flight, whose fence was already waited on
+		*
+		* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawQueryError)
+		*/
+		inline SkResult<bool, DrawQueryError> beginFrame(const vk::CommandBuffer& commandBuffer, const uint32_t frameIndex)
+		{
+			SkResult result(static_cast<bool>(false), static_cast<DrawQueryError>(DrawQueryError::NO_ERROR));
+
+			currentFrame = frameIndex % static_cast<uint32_t>(frames.size());
+			FrameQueries& frame = frames[currentFrame];
+
+			if (!frame.occlusionQueryPool)
+			{
+				result.error = createQueryPools(frame);
+				if (result.error != DrawQueryError::NO_ERROR)
+				{
+					return result;
+				}
+			}
+			else if (!frame.groups.empty())
+			{
+				//Statistics not available yet are dropped, the last complete ones being kept
+				auto readResultsResult = readResults(frame);
+				if (error(readResultsResult) && readResultsResult.error != DrawQueryError::RESULTS_NOT_AVAILABLE_ERROR)
+				{
+					result.error = readResultsResult.error;
+				}
+			}
+
+			if (frame.statisticsQueryPool)
+			{
+				commandBuffer.resetQueryPool(frame.statisticsQueryPool, 0, groupCapacity);
+			}
+			commandBuffer.resetQueryPool(frame.occlusionQueryPool, 0, groupCapacity);
+
+			frame.groups.clear();
+			frameBegun = true;
+
+			result.value = (result.error == DrawQueryError::NO_ERROR);
+			return result;
+		}
+
+		/*@brief Begins the queries of a group of draws, groups cannot be nested and must end in the subpass they began in
+		*
+		* @param commandBuffer The vulkan command buffer of the frame
+		* @param name The name the statistics of the group are reported with
+		* @param occlusion Are the samples passed by the group counted (default is true)
+		*
+		* @return SkResult(index of the group in the frame, DrawQueryError)
+		*/
+		inline SkResult<uint32_t, DrawQueryError> beginGroup(const vk::CommandBuffer& commandBuffer, const std::string& name, const bool occlusion = true)
+		{
+			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<DrawQueryError>(DrawQueryError::NO_ERROR));
+
+			if (!frameBegun || groupOpen)
+			{
+				result.error = DrawQueryError::UNBALANCED_GROUP_ERROR;
+				return result;
+			}
+
+			FrameQueries& frame = frames[currentFrame];
+			if (frame.groups.size() >= groupCapacity)
+			{
+				result.error = DrawQueryError::GROUP_OVERFLOW_ERROR;
+				return result;
+			}
+
+			const uint32_t query = static_cast<uint32_t>(frame.groups.size());
+
+			if (frame.statisticsQueryPool)
+			{
+				commandBuffer.beginQuery(frame.statisticsQueryPool, query, vk::QueryControlFlags());
+			}
+
+			if (occlusion)
+			{
+				commandBuffer.beginQuery(frame.occlusionQueryPool, query, (preciseOcclusion ? vk::QueryControlFlags(vk::QueryControlFlagBits::ePrecise) : vk::QueryControlFlags()));
+			}
+
+			DrawGroupQueries group = {};
+			group.name = name;
+			group.occlusion = occlusion;
+			frame.groups.push_back(std::move(group));
+			groupOpen = true;
+
+			result.value = query;
+			return result;
+		}
+
+		/*@brief Ends the queries of the open group of draws
+		*
+		* @param commandBuffer The vulkan command buffer of the frame
+		*
+		* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawQueryError)
+		*/
+		inline SkResult<bool, DrawQueryError> endGroup(const vk::CommandBuffer& commandBuffer)
+		{
+			SkResult result(static_cast<bool>(false), static_cast<DrawQueryError>(DrawQueryError::NO_ERROR));
+
+			if (!groupOpen)
+			{
+				result.error = DrawQueryError::UNBALANCED_GROUP_ERROR;
+				return result;
+			}
+
+			FrameQueries& frame = frames[currentFrame];
+			const uint32_t query = static_cast<uint32_t>(frame.groups.size() - 1);
+
+			if (frame.statisticsQueryPool)
+			{
+				commandBuffer.endQuery(frame.statisticsQueryPool, query);
+			}
+
+			if (frame.groups[query].occlusion)
+			{
+				commandBuffer.endQuery(frame.occlusionQueryPool, query);
+			}
+
+			frame.groups[query].ended = true;
+			groupOpen = false;
+
+			result.value = true;
+			return result;
+		}
+
+		/*Returns the statistics of the groups of the last frame whose queries were all available, in the order the groups were begun*/
+		inline const std::vector<DrawGroupStatistics>& getStatistics() const
+		{
+			return statistics;
+		}
+
+		/*Returns whether pipeline statistics are queried, the pipelineStatisticsQuery feature being enabled*/
+		inline bool hasPipelineStatistics() const
+		{
+			return static_cast<bool>(pipelineStatisticFlags);
+		}
+
+		/*@brief Destroys the query pools of the frames in flight
+		*
+		* @return SkResult(bool signaling if the operation worked(1) or not(0), DrawQueryError)
+		*/
+		inline SkResult<bool, DrawQueryError> destroy()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<DrawQueryError>(DrawQueryError::NO_ERROR));
+
+			for (FrameQueries& frame : frames)
+			{
+				try
+				{
+					if (frame.statisticsQueryPool)
+					{
+						device.destroyQueryPool(frame.statisticsQueryPool);
+					}
+
+					if (frame.occlusionQueryPool)
+					{
+						device.destroyQueryPool(frame.occlusionQueryPool);
+					}
+				}
+				catch (vk::SystemError err)
+				{
+					result.value = false;
+					result.error = DrawQueryError::QUERY_POOL_DESTRUCTION_ERROR;
+				}
+
+				frame.statisticsQueryPool = nullptr;
+				frame.occlusionQueryPool = nullptr;
+				frame.groups.clear();
+			}
+
+			frameBegun = false;
+			groupOpen = false;
+
+			return result;
+		}
+
+	private:
+		struct FrameQueries
+		{
+			vk::QueryPool statisticsQueryPool = nullptr;
+			vk::QueryPool occlusionQueryPool = nullptr;
+			std::vector<DrawGroupQueries> groups;
+		};
+
+		vk::Device device;
+
+		vk::QueryPipelineStatisticFlags pipelineStatisticFlags;
+		bool preciseOcclusion = false;
+		uint32_t groupCapacity;
+
+		std::vector<FrameQueries> frames;
+		uint32_t currentFrame = 0;
+		bool frameBegun = false;
+		bool groupOpen = false;
+
+		std::vector<DrawGroupStatistics> statistics;
+
+		inline DrawQueryError createQueryPools(FrameQueries& frame)
+		{
+			try
+			{
+				vk::QueryPoolCreateInfo queryPoolCreateInfo = {};
+				queryPoolCreateInfo.queryCount = groupCapacity;
+
+				if (pipelineStatisticFlags)
+				{
+					queryPoolCreateInfo.queryType = vk::QueryType::ePipelineStatistics;
+					queryPoolCreateInfo.pipelineStatistics = pipelineStatisticFlags;
+					frame.statisticsQueryPool = device.createQueryPool(queryPoolCreateInfo);
+				}
+
+				queryPoolCreateInfo.queryType = vk::QueryType::eOcclusion;
+				queryPoolCreateInfo.pipelineStatistics = vk::QueryPipelineStatisticFlags();
+				frame.occlusionQueryPool = device.createQueryPool(queryPoolCreateInfo);
+			}
+			catch (vk::SystemError err)
+			{
+				return DrawQueryError::QUERY_POOL_CREATION_ERROR;
+			}
+
+			return DrawQueryError::NO_ERROR;
+		}
+
+		inline SkResult<bool, DrawQueryError> readResults(const FrameQueries& frame)
+		{
+			SkResult result(static_cast<bool>(false), static_cast<DrawQueryError>(DrawQueryError::NO_ERROR));
+
+			const uint32_t groupCount = static_cast<uint32_t>(frame.groups.size());
+			const vk::QueryResultFlags queryResultFlags = vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWithAvailability;
+
+			//Never waits : queries still in flight report themselves as unavailable
+			std::vector<uint64_t> statisticResults;
+			if (frame.statisticsQueryPool)
+			{
+				const size_t statisticStride = static_cast<size_t>(getPipelineStatisticCount(pipelineStatisticFlags)) + 1;
+				statisticResults.assign(groupCount * statisticStride, 0);
+
+				const vk::Result queryResult = device.getQueryPoolResults(frame.statisticsQueryPool, 0, groupCount, statisticResults.size() * sizeof(uint64_t),
+					statisticResults.data(), statisticStride * sizeof(uint64_t), queryResultFlags);
+
+				if (queryResult != vk::Result::eSuccess && queryResult != vk::Result::eNotReady)
+				{
+					result.error = DrawQueryError::QUERY_RESULTS_ERROR;
+					return result;
+				}
+			}
+
+			//Groups without occlusion leave their query reset, read one by one so that they never block the others
+			std::vector<uint64_t> occlusionResults(2 * static_cast<size_t>(groupCount), 0);
+			for (uint32_t i = 0; i < groupCount; i++)
+			{
+				if (!frame.groups[i].occlusion)
+				{
+					continue;
+				}
+
+				const vk::Result queryResult = device.getQueryPoolResults(frame.occlusionQueryPool, i, 1, 2 * sizeof(uint64_t), occlusionResults.data() + 2 * i,
+					2 * sizeof(uint64_t), queryResultFlags);
+
+				if (queryResult != vk::Result::eSuccess && queryResult != vk::Result::eNotReady)
+				{
+					result.error = DrawQueryError::QUERY_RESULTS_ERROR;
+					return result;
+				}
+			}
+
+			auto resolveDrawGroupQueriesResult = resolveDrawGroupQueries(frame.groups, (frame.statisticsQueryPool ? pipelineStatisticFlags : vk::QueryPipelineStatisticFlags()),
+				statisticResults, occlusionResults);
+			if (error(resolveDrawGroupQueriesResult))
+			{
+				result.error = resolveDrawGroupQueriesResult.error;
+				return result;
+			}
+
+			statistics = std::move(resolveDrawGroupQueriesResult.value);
+
+			result.value = true;
+			return result;
+		}
+	};
+
+	/*TRACING*/
+
+	/*@brief Returns the time of the CPU clock the traces are recorded with (std::chrono::steady_clock), in nanoseconds*/
+	inline uint64_t getTraceTime()
+	{
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	/*Correspondence between the timestamps of a queue and the trace clock (see getTraceTime()), measured by calibrateGpuClock() or synchronizeGpuClock()*/
+	struct GpuClockCalibration
+	{
+		uint64_t cpuTime = 0;
+		uint64_t gpuTimestamp = 0;
+
+		float timestampPeriod = 1.0f;
+		uint32_t timestampValidBits = 64;
+
+		//Uncertainty of the correspondence, in nanoseconds
+		uint64_t maxDeviation = 0;
+	};
+
+	/*@brief Converts a timestamp written by a queue into the trace clock, timestamps written before the calibration giving earlier times.
+	* GPU and CPU clocks drift apart, the calibration should be measured again every few seconds
+	*
+	* @param calibration The calibration of the queue
+	* @param gpuTimestamp The timestamp to be converted
+	*
+	* @return The time of the timestamp on the trace clock, in nanoseconds
+	*/
+	inline uint64_t getGpuTraceTime(const GpuClockCalibration& calibration, const uint64_t gpuTimestamp)
+	{
+		const uint64_t mask = (calibration.timestampValidBits >= 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t(1) << calibration.timestampValidBits) - 1);
+		const uint64_t ticks = (gpuTimestamp - calibration.gpuTimestamp) & mask;
+
+		//Past half of the counter range, the timestamp precedes the calibration
+		const bool before = (ticks > mask / 2);
+		const double nanoseconds = static_cast<double>(before ? (calibration.gpuTimestamp - gpuTimestamp) & mask : ticks) * static_cast<double>(calibration.timestampPeriod);
+
+		return (before ? calibration.cpuTime - std::min(calibration.cpuTime, static_cast<uint64_t>(nanoseconds)) : calibration.cpuTime + static_cast<uint64_t>(nanoseconds));
+	}
+
+	/*@brief Calibrates the timestamps of a device with VK_EXT_calibrated_timestamps, the device and the trace clock being sampled at the same time.
+	* The extension must be enabled on the device (see enableCalibratedTimestamps()), the trace clock being CLOCK_MONOTONIC on linux and the performance counter on windows
+	*
+	* @param physicalDevice The vulkan physical device of the device
+	* @param device The vulkan device whose timestamps are calibrated
+	* @param timestampValidBits The number of valid bits of the timestamps of the queue family the zones are recorded on
+	* @param dispatcher The dynamic dispatcher loaded with the instance and the device
+	*
+	* @return SkResult(calibration, TraceError), CALIBRATION_EXTENSION_NOT_ENABLED_ERROR if the dispatcher holds no function of the extension,
+	* CALIBRATION_NOT_SUPPORTED_ERROR if the device cannot sample both clocks (see synchronizeGpuClock())
+	*/
+	inline SkResult<GpuClockCalibration, TraceError> calibrateGpuClock(const vk::PhysicalDevice& physicalDevice, const vk::Device& device, const uint32_t timestampValidBits,
+		const vk::DispatchLoaderDynamic& dispatcher)
+	{
+		SkResult result(static_cast<GpuClockCalibration>(GpuClockCalibration()), static_cast<TraceError>(TraceError::NO_ERROR));
+
+		//Functions of an extension not enabled on the device are not loaded
+		if (!dispatcher.vkGetPhysicalDeviceCalibrateableTimeDomainsEXT || !dispatcher.vkGetCalibratedTimestampsEXT)
+		{
+			result.error = TraceError::CALIBRATION_EXTENSION_NOT_ENABLED_ERROR;
+			return result;
+		}
+
+#ifdef _WIN32
+		const vk::TimeDomainEXT hostTimeDomain = vk::TimeDomainEXT::eQueryPerformanceCounter;
+#else
+		const vk::TimeDomainEXT hostTimeDomain = vk::TimeDomainEXT::eClockMonotonic;
+#endif
+
+		std::vector<vk::TimeDomainEXT> timeDomains;
+		try
+		{
+			timeDomains = physicalDevice.getCalibrateableTimeDomainsEXT(dispatcher);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = TraceError::CALIBRATION_ERROR;
+			return result;
+		}
+
+		if (std::find(timeDomains.begin(), timeDomains.end(), vk::TimeDomainEXT::eDevice) == timeDomains.end()
+			|| std::find(timeDomains.begin(), timeDomains.end(), hostTimeDomain) == timeDomains.end())
+		{
+			result.error = TraceError::CALIBRATION_NOT_SUPPORTED_ERROR;
+			return result;
+		}
+
+		const std::array<vk::CalibratedTimestampInfoEXT, 2> timestampInfos = { vk::CalibratedTimestampInfoEXT(vk::TimeDomainEXT::eDevice), vk::CalibratedTimestampInfoEXT(hostTimeDomain) };
+		std::array<uint64_t, 2> timestamps = { 0, 0 };
+		uint64_t maxDeviation = 0;
+
+		if (device.getCalibratedTimestampsEXT(static_cast<uint32_t>(timestampInfos.size()), timestampInfos.data(), timestamps.data(), &maxDeviation, dispatcher) != vk::Result::eSuccess)
+		{
+			result.error = TraceError::CALIBRATION_ERROR;
+			return result;
+		}
+
+#ifdef _WIN32
+		//Performance counter ticks to nanoseconds, as steady_clock does
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		const uint64_t ticksPerSecond = static_cast<uint64_t>(frequency.QuadPart);
+		result.value.cpuTime = (timestamps[1] / ticksPerSecond) * 1000000000 + (timestamps[1] % ticksPerSecond) * 1000000000 / ticksPerSecond;
+#else
+		result.value.cpuTime = timestamps[1];
+#endif
+
+		result.value.gpuTimestamp = timestamps[0];
+		result.value.timestampPeriod = physicalDevice.getProperties().limits.timestampPeriod;
+		result.value.timestampValidBits = timestampValidBits;
+		result.value.maxDeviation = maxDeviation;
+
+		return result;
+	}
+
+	/*@brief Calibrates the timestamps of a queue without extension : a timestamp is written by a submitted command buffer, waited on, and
+	* matched with the middle of the CPU time spent waiting. Stalls the queue, to be called outside of the frames
+	*
+	* @param physicalDevice The vulkan physical device of the device
+	* @param device The vulkan device whose timestamps are calibrated
+	* @param queue The vulkan queue the zones are recorded on
+	* @param commandPool A vulkan command pool of the family of the queue
+	* @param timestampValidBits The number of valid bits of the timestamps of the queue family
+	*
+	* @return SkResult(calibration, TraceError)
+	*/
+	inline SkResult<GpuClockCalibration, TraceError> synchronizeGpuClock(const vk::PhysicalDevice& physicalDevice, const vk::Device& device, const vk::Queue& queue,
+		const vk::CommandPool& commandPool, const uint32_t timestampValidBits)
+	{
+		SkResult result(static_cast<GpuClockCalibration>(GpuClockCalibration()), static_cast<TraceError>(TraceError::NO_ERROR));
+
+		if (timestampValidBits == 0)
+		{
+			result.error = TraceError::CALIBRATION_NOT_SUPPORTED_ERROR;
+			return result;
+		}
+
+		vk::QueryPool queryPool = nullptr;
+		vk::CommandBuffer commandBuffer = nullptr;
+		vk::Fence fence = nullptr;
+
+		try
+		{
+			vk::QueryPoolCreateInfo queryPoolCreateInfo = {};
+			queryPoolCreateInfo.queryType = vk::QueryType::eTimestamp;
+			queryPoolCreateInfo.queryCount = 1;
+			queryPool = device.createQueryPool(queryPoolCreateInfo);
+
+			vk::CommandBufferAllocateInfo commandBufferAllocateInfo(commandPool, vk::CommandBufferLevel::ePrimary, 1);
+			commandBuffer = device.allocateCommandBuffers(commandBufferAllocateInfo)[0];
+			fence = device.createFence(vk::FenceCreateInfo());
+
+			commandBuffer.begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+			commandBuffer.resetQueryPool(queryPool, 0, 1);
+			commandBuffer.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe, queryPool, 0);
+			commandBuffer.end();
+
+			vk::SubmitInfo submitInfo = {};
+			submitInfo.commandBufferCount = 1;
+			submitInfo.pCommandBuffers = &commandBuffer;
+
+			const uint64_t submitTime = getTraceTime();
+			queue.submit(submitInfo, fence);
+			const vk::Result waitResult = device.waitForFences(fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+			const uint64_t completionTime = getTraceTime();
+
+			uint64_t timestamp = 0;
+			const vk::Result queryResult = device.getQueryPoolResults(queryPool, 0, 1, sizeof(uint64_t), &timestamp, sizeof(uint64_t),
+				vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait);
+
+			if (waitResult != vk::Result::eSuccess || queryResult != vk::Result::eSuccess)
+			{
+				result.error = TraceError::CALIBRATION_ERROR;
+			}
+
+			result.value.cpuTime = submitTime + (completionTime - submitTime) / 2;
+			result.value.gpuTimestamp = timestamp;
+			result.value.timestampPeriod = physicalDevice.getProperties().limits.timestampPeriod;
+			result.value.timestampValidBits = timestampValidBits;
+			result.value.maxDeviation = (completionTime - submitTime) / 2;
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = TraceError::CALIBRATION_ERROR;
+		}
+
+		if (fence)
+		{
+			device.destroyFence(fence);
+		}
+
+		if (commandBuffer)
+		{
+			device.freeCommandBuffers(commandPool, commandBuffer);
+		}
+
+		if (queryPool)
+		{
+			device.destroyQueryPool(queryPool);
+		}
+
+		return result;
+	}
+
+	/*Event of a trace, times being in nanoseconds on the trace clock. CPU events are on process 0, one track per thread, GPU events on process 1*/
+	struct TraceEvent
+	{
+		std::string name;
+		uint32_t processId = 0;
+		uint32_t threadId = 0;
+		uint64_t begin = 0;
+		uint64_t end = 0;
+	};
+
+	/*Events of a range of frames, ready to be written*/
+	struct TraceCapture
+	{
+		std::vector<TraceEvent> events;
+
+		//Names of the threads of the CPU process, indexed by thread id
+		std::vector<std::string> threadNames;
+
+		//Pairs (frame number, beginning of the frame)
+		std::vector<Pair<uint64_t, uint64_t>> frames;
+	};
+
+	/*@brief Writes a capture in the Chrome trace event format, read by chrome://tracing and Perfetto (ui.perfetto.dev) :
+	* one complete event per zone, one instant event per frame, times in microseconds from the beginning of the capture
+	*
+	* @param capture The events to be written
+	*
+	* @return SkResult(JSON text of the trace, TraceError)
+	*/
+	inline SkResult<std::string, TraceError> writeChromeTrace(const TraceCapture& capture)
+	{
+		SkResult result(static_cast<std::string>(std::string()), static_cast<TraceError>(TraceError::NO_ERROR));
+
+		uint64_t origin = std::numeric_limits<uint64_t>::max();
+		for (const TraceEvent& event : capture.events)
+		{
+			origin = std::min(origin, event.begin);
+		}
+
+		for (const Pair<uint64_t, uint64_t>& frame : capture.frames)
+		{
+			origin = std::min(origin, frame.b);
+		}
+
+		auto toMicroseconds = [origin](const uint64_t time)
+		{
+			return std::to_string((time - origin) / 1000) + "." + std::to_string(1000 + (time - origin) % 1000).substr(1);
+		};
+
+		std::string& json = result.value;
+		json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		json += "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"CPU\"}},\n";
+		json += "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"GPU\"}}";
+
+		for (size_t i = 0; i < capture.threadNames.size(); i++)
+		{
+			json += ",\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":0,\"tid\":" + std::to_string(i) + ",\"args\":{\"name\":";
+			appendJsonString(json, capture.threadNames[i]);
+			json += "}}";
+		}
+
+		for (const Pair<uint64_t, uint64_t>& frame : capture.frames)
+		{
+			json += ",\n{\"ph\":\"i\",\"s\":\"g\",\"name\":\"Frame " + std::to_string(frame.a) + "\",\"pid\":0,\"tid\":0,\"ts\":" + toMicroseconds(frame.b) + "}";
+		}
+
+		for (const TraceEvent& event : capture.events)
+		{
+			json += ",\n{\"ph\":\"X\",\"name\":";
+			appendJsonString(json, event.name);
+			json += ",\"pid\":" + std::to_string(event.processId) + ",\"tid\":" + std::to_string(event.threadId) + ",\"ts\":" + toMicroseconds(event.begin)
+				+ ",\"dur\":" + toMicroseconds(origin + std::max(event.end, event.begin) - event.begin) + "}";
+		}
+
+		json += "\n]}\n";
+		return result;
+	}
+
+	/*Recorder of the CPU scopes of every thread and of the GPU zones of the frames, exported as a Chrome trace for a range of frames.
+	* Each thread writes its scopes into its own ring buffer without locking (only its first scope registers the ring, reused by later threads of the same id), the oldest scopes
+	* being overwritten once the ring is full. Scope names must outlive the recorder (string literals).
+	* Thread safe, rings live until the recorder is destroyed*/
+	class TraceRecorder
+	{
+	public:
+		/*eventsPerThread is rounded up to a power of 2*/
+		explicit TraceRecorder(const uint32_t eventsPerThread = 16384, const uint32_t maxGpuEvents = 16384, const uint32_t maxFrames = 1024)
+			: ringCapacity(1), gpuCapacity(std::max(maxGpuEvents, 1u)), frameCapacity(std::max(maxFrames, 2u)), recorderId(nextRecorderId().fetch_add(1))
+		{
+			while (ringCapacity < eventsPerThread)
+			{
+				ringCapacity *= 2;
+			}
+		}
+
+		TraceRecorder(const TraceRecorder&) = delete;
+		TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+		/*@brief Records a scope of the calling thread, usually through TraceScope
+		*
+		* @param name The name of the scope, must outlive the recorder
+		* @param begin The beginning of the scope on the trace clock (see getTraceTime())
+		* @param end The end of the scope on the trace clock
+		*/
+		inline void recordScope(const char* name, const uint64_t begin, const uint64_t end)
+		{
+			ThreadRing& ring = getThreadRing();
+
+			const uint64_t index = ring.writeIndex.load(std::memory_order_relaxed);
+			RingEvent& event = ring.events[index & (ringCapacity - 1)];
+
+			//Marks the slot as being written, readers skipping it
+			event.sequence.store(0, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+
+			event.name.store(name, std::memory_order_relaxed);
+			event.begin.store(begin, std::memory_order_relaxed);
+			event.end.store(end, std::memory_order_relaxed);
+
+			event.sequence.store(index + 1, std::memory_order_release);
+			ring.writeIndex.store(index + 1, std::memory_order_release);
+		}
+
+		/*@brief Names the calling thread in the traces
+		*
+		* @param name The name of the thread
+		*/
+		inline void setThreadName(const std::string& name)
+		{
+			ThreadRing& ring = getThreadRing();
+
+			std::lock_guard<std::mutex> lock(recorderMutex);
+			ring.name = name;
+		}
+
+		/*@brief Marks the beginning of a frame, frames delimiting the ranges exported by exportChromeTrace()
+		*
+		* @param frameNumber The number of the frame, increasing
+		*/
+		inline void markFrame(const uint64_t frameNumber)
+		{
+			const uint64_t time = getTraceTime();
+
+			std::lock_guard<std::mutex> lock(recorderMutex);
+			frames.emplace_back(frameNumber, time);
+			if (frames.size() > frameCapacity)
+			{
+				frames.pop_front();
+			}
+		}
+
+		/*@brief Records the zones of a frame timed by a GpuProfiler, aligned on the trace clock by a calibration of their queue
+		*
+		* @param timings The timings returned by GpuProfiler::getTimings(), recorded once per frame read back
+		* @param calibration The calibration of the queue (see calibrateGpuClock() and synchronizeGpuClock())
+		* @param queueIndex The track of the queue in the GPU process (default is 0)
+		*/
+		inline void recordGpuZones(const std::vector<GpuZoneTiming>& timings, const GpuClockCalibration& calibration, const uint32_t queueIndex = 0)
+		{
+			std::lock_guard<std::mutex> lock(recorderMutex);
+			for (const GpuZoneTiming& timing : timings)
+			{
+				TraceEvent event = {};
+				event.name = timing.name;
+				event.processId = 1;
+				event.threadId = queueIndex;
+				event.begin = getGpuTraceTime(calibration, timing.beginTimestamp);
+				event.end = getGpuTraceTime(calibration, timing.endTimestamp);
+
+				gpuEvents.push_back(std::move(event));
+				if (gpuEvents.size() > gpuCapacity)
+				{
+					gpuEvents.pop_front();
+				}
+			}
+		}
+
+		/*@brief Gathers the events of a range of frames still held by the recorder : the events overlapping the time between the beginning of
+		* the first frame and the beginning of the frame after the last one (or now)
+		*
+		* @param firstFrame The number of the first frame of the range
+		* @param lastFrame The number of the last frame of the range
+		*
+		* @return SkResult(events of the frames, TraceError)
+		*/
+		inline SkResult<TraceCapture, TraceError> capture(const uint64_t firstFrame, const uint64_t lastFrame)
+		{
+			SkResult result(static_cast<TraceCapture>(TraceCapture()), static_cast<TraceError>(TraceError::NO_ERROR));
+
+			std::lock_guard<std::mutex> lock(recorderMutex);
+
+			uint64_t begin = std::numeric_limits<uint64_t>::max();
+			uint64_t end = getTraceTime();
+			for (const Pair<uint64_t, uint64_t>& frame : frames)
+			{
+				if (frame.a >= firstFrame && frame.a <= lastFrame)
+				{
+					begin = std::min(begin, frame.b);
+					result.value.frames.push_back(frame);
+				}
+				else if (frame.a > lastFrame)
+				{
+					end = std::min(end, frame.b);
+				}
+			}
+
+			if (firstFrame > lastFrame || begin == std::numeric_limits<uint64_t>::max())
+			{
+				result.error = TraceError::INVALID_FRAME_RANGE_ERROR;
+				return result;
+			}
+
+			auto overlaps = [begin, end](const uint64_t eventBegin, const uint64_t eventEnd)
+			{
+				return eventBegin <= end && eventEnd >= begin;
+			};
+
+			for (uint32_t threadId = 0; threadId < threadRings.size(); threadId++)
+			{
+				ThreadRing& ring = *threadRings[threadId];
+				result.value.threadNames.push_back(ring.name.empty() ? "Thread " + std::to_string(threadId) : ring.name);
+
+				const uint64_t writeIndex = ring.writeIndex.load(std::memory_order_acquire);
+				const uint64_t firstIndex = (writeIndex > ringCapacity ? writeIndex - ringCapacity : 0);
+
+				for (uint64_t index = firstIndex; index < writeIndex; index++)
+				{
+					const RingEvent& event = ring.events[index & (ringCapacity - 1)];
+
+					//Slots overwritten while being read are skipped
+					if (event.sequence.load(std::memory_order_acquire) != index + 1)
+					{
+						continue;
+					}
+
+					const char* name = event.name.load(std::memory_order_relaxed);
+					const uint64_t eventBegin = event.begin.load(std::memory_order_relaxed);
+					const uint64_t eventEnd = event.end.load(std::memory_order_relaxed);
+
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if (event.sequence.load(std::memory_order_relaxed) != index + 1 || !overlaps(eventBegin, eventEnd))
+					{
+						continue;
+					}
+
+					result.value.events.push_back(TraceEvent{ name, 0, threadId, eventBegin, eventEnd });
+				}
+			}
+
+			for (const TraceEvent& event : gpuEvents)
+			{
+				if (overlaps(event.begin, event.end))
+				{
+					result.value.events.push_back(event);
+				}
+			}
+
+			return result;
+		}
+
+		/*@brief Writes the events of a range of frames into a Chrome trace file (see writeChromeTrace()). GPU zones being read back frames after
+		* their recording, the last frames of the range only hold their GPU zones a few frames later
+		*
+		* @param path The path of the JSON file to be written
+		* @param firstFrame The number of the first frame of the range
+		* @param lastFrame The number of the last frame of the range
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), TraceError)
+		*/
+		inline SkResult<bool, TraceError> exportChromeTrace(const std::string& path, const uint64_t firstFrame, const uint64_t lastFrame)
+		{
+			SkResult result(static_cast<bool>(false), static_cast<TraceError>(TraceError::NO_ERROR));
+
+			auto captureResult = capture(firstFrame, lastFrame);
+			if (error(captureResult))
+			{
+				result.error = captureResult.error;
+				return result;
+			}
+
+			auto writeChromeTraceResult = writeChromeTrace(captureResult.value);
+			if (error(writeChromeTraceResult))
+			{
+				result.error = writeChromeTraceResult.error;
+				return result;
+			}
+
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			file.write(writeChromeTraceResult.value.data(), static_cast<std::streamsize>(writeChromeTraceResult.value.size()));
+			if (!file)
+			{
+				result.error = TraceError::FILE_WRITE_ERROR;
+				return result;
+			}
+
+			result.value = true;
+			return result;
+		}
+
+	private:
+		struct RingEvent
+		{
+			//Index of the event plus one once written, 0 while being written
+			std::atomic<uint64_t> sequence{ 0 };
+
+			std::atomic<const char*> name{ nullptr };
+			std::atomic<uint64_t> begin{ 0 };
+			std::atomic<uint64_t> end{ 0 };
+		};
+
+		struct ThreadRing
+		{
+			std::thread::id thread;
+			std::string name;
+
+			std::unique_ptr<RingEvent[]> events;
+			std::atomic<uint64_t> writeIndex{ 0 };
+		};
+
+		uint64_t ringCapacity;
+		size_t gpuCapacity;
+		size_t frameCapacity;
+		uint64_t recorderId;
+
+		std::mutex recorderMutex;
+		std::vector<std::unique_ptr<ThreadRing>> threadRings;
+		std::deque<TraceEvent> gpuEvents;
+		std::deque<Pair<uint64_t, uint64_t>> frames;
+
+		static std::atomic<uint64_t>& nextRecorderId()
+		{
+			static std::atomic<uint64_t> recorderCounter{ 1 };
+			return recorderCounter;
+		}
+
+		//The ring of the calling thread is cached per thread, recorders being told apart by ids never reused
+		inline ThreadRing& getThreadRing()
+		{
+			thread_local uint64_t cachedRecorderId = 0;
+			thread_local ThreadRing* pCachedRing = nullptr;
+
+			if (cachedRecorderId == recorderId)
+			{
+				return *pCachedRing;
+			}
+
+			std::lock_guard<std::mutex> lock(recorderMutex);
+
+			const std::thread::id thread = std::this_thread::get_id();
+			auto ringIterator = std::find_if(threadRings.begin(), threadRings.end(), [thread](const std::unique_ptr<ThreadRing>& pRing)
+				{
+					return pRing->thread == thread;
+				});
+
+			if (ringIterator == threadRings.end())
+			{
+				std::unique_ptr<ThreadRing> pRing = std::make_unique<ThreadRing>();
+				pRing->thread = thread;
+				pRing->events = std::make_unique<RingEvent[]>(ringCapacity);
+
+				threadRings.push_back(std::move(pRing));
+				ringIterator = threadRings.end() - 1;
+			}
+
+			cachedRecorderId = recorderId;
+			pCachedRing = ringIterator->get();
+			return *pCachedRing;
+		}
+	};
+
+	/*Scope of the calling thread recorded into a TraceRecorder from its construction to its destruction*/
+	class TraceScope
+	{
+	public:
+		TraceScope(TraceRecorder& traceRecorder, const char* scopeName)
+			: recorder(traceRecorder), name(scopeName), begin(getTraceTime())
+		{
+		}
+
+		~TraceScope()
+		{
+			recorder.recordScope(name, begin, getTraceTime());
+		}
+
+		TraceScope(const TraceScope&) = delete;
+		TraceScope& operator=(const TraceScope&) = delete;
+
+	private:
+		TraceRecorder& recorder;
+		const char* name;
+		uint64_t begin;
+	};
+
+	/*FRAME STATISTICS*/
+
+	/*Times of a frame, the GPU time being negative when it was not measured*/
+	struct FrameSample
+	{
+		uint64_t frameNumber = 0;
+		double cpuMilliseconds = 0.0;
+		double gpuMilliseconds = -1.0;
+	};
+
+	/*Distribution of the times of the frames of a clock (CPU or GPU), in milliseconds*/
+	struct FrameTimeSummary
+	{
+		uint32_t frameCount = 0;
+		uint32_t framesOverBudget = 0;
+
+		double mean = 0.0;
+		double p50 = 0.0;
+		double p95 = 0.0;
+		double p99 = 0.0;
+		double max = 0.0;
+
+		//Frames per bucket of the histogram, the last bucket also holding every longer frame
+		std::vector<uint32_t> histogram;
+	};
+
+	/*Statistics of the frames held by a FrameStatistics*/
+	struct FrameStatisticsReport
+	{
+		uint64_t firstFrame = 0;
+		uint64_t lastFrame = 0;
+
+		double budgetMilliseconds = 0.0;
+		double histogramBucketWidth = 0.0;
+
+		//Frames over budget on the CPU or on the GPU
+		uint32_t framesOverBudget = 0;
+
+		FrameTimeSummary cpu;
+		FrameTimeSummary gpu;
+	};
+
+	/*Formats frame statistics are written in, frames being streamed as CSV rows or as JSON lines*/
+	enum class FrameStatisticsFormat
+	{
+		CSV = 0,
+		JSON = 1
+	};
+
+	/*@brief Returns a percentile of sorted frame times with the nearest-rank method : the smallest time that at least the percentile of the frames
+	* do not exceed, so the p99 of 100 frames is their second longest
+	*
+	* @param sortedTimes The frame times, in ascending order
+	* @param percentile The percentile, between 0 and 100
+	*
+	* @return SkResult(percentile of the times, FrameStatisticsError)
+	*/
+	inline SkResult<double, FrameStatisticsError> getPercentile(const std::vector<double>& sortedTimes, const double percentile)
+	{
+		SkResult result(static_cast<double>(0.0), static_cast<FrameStatisticsError>(FrameStatisticsError::NO_ERROR));
+
+		if (sortedTimes.empty())
+		{
+			result.error = FrameStatisticsError::NO_FRAME_ERROR;
+			return result;
+		}
+
+		if (!(percentile >= 0.0 && percentile <= 100.0))
+		{
+			result.error = FrameStatisticsError::INVALID_PERCENTILE_ERROR;
+			return result;
+		}
+
+		const size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sortedTimes.size())));
+		result.value = sortedTimes[std::clamp<size_t>(rank, 1, sortedTimes.size()) - 1];
+
+		return result;
+	}
+
+	/*@brief Summarizes frame times : mean, percentiles, maximum, frames over budget and histogram
+	*
+	* @param times The frame times, in milliseconds
+	* @param budgetMilliseconds The time a frame must not exceed
+	* @param histogramBucketWidth The width of the buckets of the histogram, in milliseconds
+	* @param histogramBucketCount The number of buckets of the histogram
+	*
+	* @return SkResult(summary of the times, FrameStatisticsError)
+	*/
+	inline SkResult<FrameTimeSummary, FrameStatisticsError> summarizeFrameTimes(std::vector<double> times, const double budgetMilliseconds,
+		const double histogramBucketWidth, const uint32_t histogramBucketCount)
+	{
+		SkResult result(static_cast<FrameTimeSummary>(FrameTimeSummary()), static_cast<FrameStatisticsError>(FrameStatisticsError::NO_ERROR));
+
+		if (times.empty())
+		{
+			result.error = FrameStatisticsError::NO_FRAME_ERROR;
+			return result;
+		}
+
+		if (!(histogramBucketWidth > 0.0) || histogramBucketCount == 0)
+		{
+			result.error = FrameStatisticsError::INVALID_HISTOGRAM_ERROR;
+			return result;
+		}
+
+		std::sort(times.begin(), times.end());
+
+		FrameTimeSummary& summary = result.value;
+		summary.frameCount = static_cast<uint32_t>(times.size());
+		summary.histogram.resize(histogramBucketCount, 0);
+
+		double total = 0.0;
+		for (const double time : times)
+		{
+			total += time;
+			summary.framesOverBudget += (time > budgetMilliseconds);
+
+			const double bucket = std::floor(std::max(time, 0.0) / histogramBucketWidth);
+			summary.histogram[static_cast<size_t>(std::min(bucket, static_cast<double>(histogramBucketCount - 1)))]++;
+		}
+
+		summary.mean = total / static_cast<double>(times.size());
+		summary.p50 = getPercentile(times, 50.0).value;
+		summary.p95 = getPercentile(times, 95.0).value;
+		summary.p99 = getPercentile(times, 99.0).value;
+		summary.max = times.back();
+
+		return result;
+	}
+
+	/*@brief Writes a report of frame statistics as CSV (one row per statistic, one column per clock) or as a JSON object
+	*
+	* @param report The report to be written
+	* @param format The format of the text
+	*
+	* @return SkResult(text of the report, FrameStatisticsError)
+	*/
+	inline SkResult<std::string, FrameStatisticsError> writeFrameStatisticsReport(const FrameStatisticsReport& report, const FrameStatisticsFormat format)
+	{
+		SkResult result(static_cast<std::string>(std::string()), static_cast<FrameStatisticsError>(FrameStatisticsError::NO_ERROR));
+
+		const std::array<Pair<std::string, double FrameTimeSummary::*>, 5> statistics = {
+			Pair<std::string, double FrameTimeSummary::*>("mean", &FrameTimeSummary::mean),
+			Pair<std::string, double FrameTimeSummary::*>("p50", &FrameTimeSummary::p50),
+			Pair<std::string, double FrameTimeSummary::*>("p95", &FrameTimeSummary::p95),
+			Pair<std::string, double FrameTimeSummary::*>("p99", &FrameTimeSummary::p99),
+			Pair<std::string, double FrameTimeSummary::*>("max", &FrameTimeSummary::max) };
+
+		std::string& text = result.value;
+		if (format == FrameStatisticsFormat::CSV)
+		{
+			text = "statistic,cpu,gpu\n";
+			text += "frames," + std::to_string(report.cpu.frameCount) + "," + std::to_string(report.gpu.frameCount) + "\n";
+			text += "frames_over_budget," + std::to_string(report.cpu.framesOverBudget) + "," + std::to_string(report.gpu.framesOverBudget) + "\n";
+
+			for (const auto& statistic : statistics)
+			{
+				text += statistic.a + "_ms," + std::to_string(report.cpu.*statistic.b) + "," + std::to_string(report.gpu.*statistic.b) + "\n";
+			}
+
+			for (size_t i = 0; i < std::max(report.cpu.histogram.size(), report.gpu.histogram.size()); i++)
+			{
+				text += "histogram_" + std::to_string(report.histogramBucketWidth * static_cast<double>(i)) + "_ms,"
+					+ (i < report.cpu.histogram.size() ? std::to_string(report.cpu.histogram[i]) : "0") + ","
+					+ (i < report.gpu.histogram.size() ? std::to_string(report.gpu.histogram[i]) : "0") + "\n";
+			}
+
+			return result;
+		}
+
+		auto writeSummary = [&statistics](std::string& json, const FrameTimeSummary& summary)
+		{
+			json += "{\"frames\":" + std::to_string(summary.frameCount) + ",\"frames_over_budget\":" + std::to_string(summary.framesOverBudget);
+			for (const auto& statistic : statistics)
+			{
+				json += ",\"" + statistic.a + "_ms\":" + std::to_string(summary.*statistic.b);
+			}
+
+			json += ",\"histogram\":[";
+			for (size_t i = 0; i < summary.histogram.size(); i++)
+			{
+				json += (i == 0 ? "" : ",") + std::to_string(summary.histogram[i]);
+			}
+			json += "]}";
+		};
+
+		text = "{\"first_frame\":" + std::to_string(report.firstFrame) + ",\"last_frame\":" + std::to_string(report.lastFrame)
+			+ ",\"budget_ms\":" + std::to_string(report.budgetMilliseconds) + ",\"histogram_bucket_ms\":" + std::to_string(report.histogramBucketWidth)
+			+ ",\"frames_over_budget\":" + std::to_string(report.framesOverBudget) + ",\"cpu\":";
+		writeSummary(text, report.cpu);
+		text += ",\"gpu\":";
+		writeSummary(text, report.gpu);
+		text += "}\n";
+
+		return result;
+	}
+
+	/*Collector of the CPU and GPU times of the last frames, kept in a ring of fixed size, reporting their percentiles rather than their mean
+	* so that stutters show. Every recorded frame can also be streamed to a CSV or JSON lines file, whatever the size of the ring.
+	* Not thread safe, the sink lives until closeSink()*/
+	class FrameStatistics
+	{
+	public:
+		FrameStatistics(const uint32_t maxFrames = 1024, const double frameBudgetMilliseconds = 1000.0 / 60.0, const double bucketWidthMilliseconds = 1.0,
+			const uint32_t bucketCount = 50)
+			: samples(std::max(maxFrames, 1u)), budgetMilliseconds(frameBudgetMilliseconds), histogramBucketWidth(bucketWidthMilliseconds), histogramBucketCount(bucketCount)
+		{
+		}
+
+		FrameStatistics(const FrameStatistics&) = delete;
+		FrameStatistics& operator=(const FrameStatistics&) = delete;
+
+		/*@brief Records the times of a frame, overwriting the oldest frame once the ring is full
+		*
+		* @param cpuMilliseconds The CPU time of the frame
+		* @param gpuMilliseconds The GPU time of the frame (see GpuProfiler::getFrameTime()), negative if not measured (default is -1.0)
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), FrameStatisticsError)
+		*/
+		inline SkResult<bool, FrameStatisticsError> recordFrame(const double cpuMilliseconds, const double gpuMilliseconds = -1.0)
+		{
+			SkResult result(static_cast<bool>(false), static_cast<FrameStatisticsError>(FrameStatisticsError::NO_ERROR));
+
+			FrameSample& sample = samples[recordedFrames % samples.size()];
+			sample.frameNumber = recordedFrames;
+			sample.cpuMilliseconds = cpuMilliseconds;
+			sample.gpuMilliseconds = gpuMilliseconds;
+			recordedFrames++;
+
+			if (sink.is_open())
+			{
+				const std::string gpuTime = (gpuMilliseconds < 0.0 ? (sinkFormat == FrameStatisticsFormat::CSV ? "" : "null") : std::to_string(gpuMilliseconds));
+				if (sinkFormat == FrameStatisticsFormat::CSV)
+				{
+					sink << sample.frameNumber << "," << std::to_string(cpuMilliseconds) << "," << gpuTime << "\n";
+				}
+				else
+				{
+					sink << "{\"frame\":" << sample.frameNumber << ",\"cpu_ms\":" << std::to_string(cpuMilliseconds) << ",\"gpu_ms\":" << gpuTime << "}\n";
+				}
+
+				if (!sink)
+				{
+					result.error = FrameStatisticsError::FILE_WRITE_ERROR;
+					return result;
+				}
+			}
+
+			result.value = true;
+			return result;
+		}
+
+		/*@brief Records a frame whose CPU time is the time elapsed since the previous call, the first call only starting the clock
+		*
+		* @param gpuMilliseconds The GPU time of the frame, negative if not measured (default is -1.0)
+		*
+		* @return SkResult(bool indicating if a frame was recorded(true) or not(false), FrameStatisticsError)
+		*/
+		inline SkResult<bool, FrameStatisticsError> endFrame(const double gpuMilliseconds = -1.0)
+		{
+			const auto now = std::chrono::steady_clock::now();
+			const bool started = frameClockStarted;
+
+			const std::chrono::duration<double, std::milli> frameTime = now - lastFrameEnd;
+			lastFrameEnd = now;
+			frameClockStarted = true;
+
+			if (!started)
+			{
+				return SkResult(static_cast<bool>(false), static_cast<FrameStatisticsError>(FrameStatisticsError::NO_ERROR));
+			}
+
+			return recordFrame(frameTime.count(), gpuMilliseconds);
+		}
+
+		/*@brief Returns the frames held by the ring, from the oldest to the newest*/
+		inline std::vector<FrameSample> getFrames() const
+		{
+			const uint64_t frameCount = std::min<uint64_t>(recordedFrames, samples.size());
+
+			std::vector<FrameSample> frames;
+			frames.reserve(static_cast<size_t>(frameCount));
+			for (uint64_t frameNumber = recordedFrames - frameCount; frameNumber < recordedFrames; frameNumber++)
+			{
+				frames.push_back(samples[frameNumber % samples.size()]);
+			}
+
+			return frames;
+		}
+
+		/*@brief Returns the last recorded frame, a default sample if none was recorded*/
+		inline FrameSample getLastFrame() const
+		{
+			return (recordedFrames == 0 ? FrameSample() : samples[(recordedFrames - 1) % samples.size()]);
+		}
+
+		/*@brief Computes the statistics of the frames held by the ring, the GPU summary being empty if no GPU time was measured
+		*
+		* @return SkResult(report of the frames, FrameStatisticsError)
+		*/
+		inline SkResult<FrameStatisticsReport, FrameStatisticsError> getReport() const
+		{
+			SkResult result(static_cast<FrameStatisticsReport>(FrameStatisticsReport()), static_cast<FrameStatisticsError>(FrameStatisticsError::NO_ERROR));
+
+			const std::vector<FrameSample> frames = getFrames();
+			if (frames.empty())
+			{
+				result.error = FrameStatisticsError::NO_FRAME_ERROR;
+				return result;
+			}
+
+			FrameStatisticsReport& report = result.value;
+			report.firstFrame = frames.front().frameNumber;
+			report.lastFrame = frames.back().frameNumber;
+			report.budgetMilliseconds = budgetMilliseconds;
+			report.histogramBucketWidth = histogramBucketWidth;
+
+			std::vector<double> cpuTimes;
+			std::vector<double> gpuTimes;
+			for (const FrameSample& frame : frames)
+			{
+				cpuTimes.push_back(frame.cpuMilliseconds);
+				if (frame.gpuMilliseconds >= 0.0)
+				{
+					gpuTimes.push_back(frame.gpuMilliseconds);
+				}
+
+				report.framesOverBudget += (frame.cpuMilliseconds > budgetMilliseconds || frame.gpuMilliseconds > budgetMilliseconds);
+			}
+
+			auto cpuSummaryResult = summarizeFrameTimes(std::move(cpuTimes), budgetMilliseconds, histogramBucketWidth, histogramBucketCount);
+			if (error(cpuSummaryResult))
+			{
+				result.error = cpuSummaryResult.error;
+				return result;
+			}
+			report.cpu = std::move(cpuSummaryResult.value);
+
+			if (!gpuTimes.empty())
+			{
+				auto gpuSummaryResult = summarizeFrameTimes(std::move(gpuTimes), budgetMilliseconds, histogramBucketWidth, histogramBucketCount);
+				if (error(gpuSummaryResult))
+				{
+					result.error = gpuSummaryResult.error;
+					return result;
+				}
+				report.gpu = std::move(gpuSummaryResult.value);
+			}
+
+			return result;
+		}
+
+		/*@brief Streams every frame recorded from now on into a file, one CSV row (frame,cpu_ms,gpu_ms) or one JSON object per line
+		*
+		* @param path The path of the file, truncated
+		* @param format The format of the file
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), FrameStatisticsError)
+		*/
+		inline SkResult<bool, FrameStatisticsError> openSink(const std::string& path, const FrameStatisticsFormat format)
+		{
+			SkResult result(static_cast<bool>(false), static_cast<FrameStatisticsError>(FrameStatisticsError::NO_ERROR));
+
+			closeSink();
+
+			sink.open(path, std::ios::binary | std::ios::trunc);
+			sinkFormat = format;
+			if (format == FrameStatisticsFormat::CSV)
+			{
+				sink << "frame,cpu_ms,gpu_ms\n";
+			}
+
+			if (!sink)
+			{
+				sink.close();
+				result.error = FrameStatisticsError::FILE_WRITE_ERROR;
+				return result;
+			}
+
+			result.value = true;
+			return result;
+		}
+
+		/*@brief Flushes and closes the file the frames are streamed to, if any*/
+		inline void closeSink()
+		{
+			if (sink.is_open())
+			{
+				sink.close();
+			}
+		}
+
+		/*@brief Writes the report of the frames held by the ring into a file (see writeFrameStatisticsReport())
+		*
+		* @param path The path of the file, truncated
+		* @param format The format of the file
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), FrameStatisticsError)
+		*/
+		inline SkResult<bool, FrameStatisticsError> exportReport(const std::string& path, const FrameStatisticsFormat format) const
+		{
+			SkResult result(static_cast<bool>(false), static_cast<FrameStatisticsError>(FrameStatisticsError::NO_ERROR));
+
+			auto getReportResult = getReport();
+			if (error(getReportResult))
+			{
+				result.error = getReportResult.error;
+				return result;
+			}
+
+			auto writeReportResult = writeFrameStatisticsReport(getReportResult.value, format);
+			if (error(writeReportResult))
+			{
+				result.error = writeReportResult.error;
+				return result;
+			}
+
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			file.write(writeReportResult.value.data(), static_cast<std::streamsize>(writeReportResult.value.size()));
+			if (!file)
+			{
+				result.error = FrameStatisticsError::FILE_WRITE_ERROR;
+				return result;
+			}
+
+			result.value = true;
+			return result;
+		}
+
+		/*@brief Returns the number of frames recorded since the creation of the collector*/
+		inline uint64_t getRecordedFrameCount() const
+		{
+			return recordedFrames;
+		}
+
+	private:
+		std::vector<FrameSample> samples;
+		uint64_t recordedFrames = 0;
+
+		double budgetMilliseconds;
+		double histogramBucketWidth;
+		uint32_t histogramBucketCount;
+
+		std::chrono::steady_clock::time_point lastFrameEnd;
+		bool frameClockStarted = false;
+
+		std::ofstream sink;
+		FrameStatisticsFormat sinkFormat = FrameStatisticsFormat::CSV;
+	};
+
+	/*RENDER GRAPH*/
+
+	/*Kind of work of a render graph pass : the attachments of graphics passes are rendered inside render passes created by the graph,
+	* compute and transfer passes record outside of any render pass*/
+	enum class RenderGraphPassType
+	{
+		GRAPHICS = 0,
+		COMPUTE = 1,
+		TRANSFER = 2
+	};
+
+	/*Use of a resource by a render graph pass, from which the graph deduces pipeline stages, memory accesses and image layouts*/
+	enum class RenderGraphUsage
+	{
+		COLOR_ATTACHMENT = 0,
+		DEPTH_ATTACHMENT = 1,
+		DEPTH_READ_ONLY = 2,
+		INPUT_ATTACHMENT = 3,
+		SAMPLED = 4,
+		STORAGE_READ = 5,
+		STORAGE_WRITE = 6,
+		UNIFORM_READ = 7,
+		VERTEX_READ = 8,
+		INDIRECT_READ = 9,
+		TRANSFER_SRC = 10,
+		TRANSFER_DST = 11
+	};
+
+	/*Synchronization scope of a use : pipeline stages, memory accesses and image layout (undefined for buffers)*/
+	struct RenderGraphAccess
+	{
+		vk::PipelineStageFlags stages;
+		vk::AccessFlags access;
+		vk::ImageLayout layout = vk::ImageLayout::eUndefined;
+		bool write = false;
+	};
+
+	/*Accesses that write memory, the only ones a barrier needs to make available*/
+	const vk::AccessFlags renderGraphWriteAccess = vk::AccessFlagBits::eColorAttachmentWrite | vk::AccessFlagBits::eDepthStencilAttachmentWrite
+		| vk::AccessFlagBits::eShaderWrite | vk::AccessFlagBits::eTransferWrite;
+
+	/*@brief Returns true if a usage reads or writes an attachment of a render pass
+	*
+	* @param usage The use of the resource
+	*
+	* @return True for color, depth and input attachments
+	*/
+	inline bool isRenderGraphAttachmentUsage(const RenderGraphUsage usage)
+	{
+		return (usage == RenderGraphUsage::COLOR_ATTACHMENT || usage == RenderGraphUsage::DEPTH_ATTACHMENT || usage == RenderGraphUsage::DEPTH_READ_ONLY
+			|| usage == RenderGraphUsage::INPUT_ATTACHMENT);
+	}
+
+	/*@brief Returns true if a usage applies to a kind of resource : attachments and sampled images for images, uniform, vertex and indirect reads for buffers,
+	* storage and transfer usages for both
+	*
+	* @param usage The use of the resource
+	* @param isImage Is the resource an image(true) or a buffer(false)
+	*
+	* @return True if the usage applies to the resource
+	*/
+	inline bool isRenderGraphUsageValid(const RenderGraphUsage usage, const bool isImage)
+	{
+		if (isRenderGraphAttachmentUsage(usage) || usage == RenderGraphUsage::SAMPLED)
+		{
+			return isImage;
+		}
+
+		if (usage == RenderGraphUsage::UNIFORM_READ || usage == RenderGraphUsage::VERTEX_READ || usage == RenderGraphUsage::INDIRECT_READ)
+		{
+			return !isImage;
+		}
+
+		return true;
+	}
+
+	/*@brief Returns the pipeline stages, memory accesses and image layout of a use of a resource
+	*
+	* @param usage The use of the resource
+	* @param passType The type of the pass, shader accesses of graphics passes coming from the vertex and fragment shaders
+	*
+	* @return The synchronization scope of the use
+	*/
+	inline RenderGraphAccess getRenderGraphAccess(const RenderGraphUsage usage, const RenderGraphPassType passType)
+	{
+		const vk::PipelineStageFlags shaderStages = (passType == RenderGraphPassType::COMPUTE ? vk::PipelineStageFlags(vk::PipelineStageFlagBits::eComputeShader)
+			: (vk::PipelineStageFlagBits::eVertexShader | vk::PipelineStageFlagBits::eFragmentShader));
+
+		RenderGraphAccess access = {};
+
+		switch (usage)
+		{
+		case RenderGraphUsage::COLOR_ATTACHMENT:
+			access = { vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::AccessFlagBits::eColorAttachmentRead | vk::AccessFlagBits::eColorAttachmentWrite,
+				vk::ImageLayout::eColorAttachmentOptimal, true };
+			break;
+		case RenderGraphUsage::DEPTH_ATTACHMENT:
+			access = { vk::PipelineStageFlagBits::eEarlyFragmentTests | vk::PipelineStageFlagBits::eLateFragmentTests,
+				vk::AccessFlagBits::eDepthStencilAttachmentRead | vk::AccessFlagBits::eDepthStencilAttachmentWrite, vk::ImageLayout::eDepthStencilAttachmentOptimal, true };
+			break;
+		case RenderGraphUsage::DEPTH_READ_ONLY:
+			access = { vk::PipelineStageFlagBits::eEarlyFragmentTests | vk::PipelineStageFlagBits::eLateFragmentTests, vk::AccessFlagBits::eDepthStencilAttachmentRead,
+				vk::ImageLayout::eDepthStencilReadOnlyOptimal, false };
+			break;
+		case RenderGraphUsage::INPUT_ATTACHMENT:
+			access = { vk::PipelineStageFlagBits::eFragmentShader, vk::AccessFlagBits::eInputAttachmentRead, vk::ImageLayout::eShaderReadOnlyOptimal, false };
+			break;
+		case RenderGraphUsage::SAMPLED:
+			access = { shaderStages, vk::AccessFlagBits::eShaderRead, vk::ImageLayout::eShaderReadOnlyOptimal, false };
+			break;
+		case RenderGraphUsage::STORAGE_READ:
+			access = { shaderStages, vk::AccessFlagBits::eShaderRead, vk::ImageLayout::eGeneral, false };
+			break;
+		case RenderGraphUsage::STORAGE_WRITE:
+			//Storage writes are usually read-modify-writes (atomics, appends)
+			access = { shaderStages, vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite, vk::ImageLayout::eGeneral, true };
+			break;
+		case RenderGraphUsage::UNIFORM_READ:
+			access = { shaderStages, vk::AccessFlagBits::eUniformRead, vk::ImageLayout::eUndefined, false };
+			break;
+		case RenderGraphUsage::VERTEX_READ:
+			access = { vk::PipelineStageFlagBits::eVertexInput, vk::AccessFlagBits::eVertexAttributeRead | vk::AccessFlagBits::eIndexRead, vk::ImageLayout::eUndefined, false };
+			break;
+		case RenderGraphUsage::INDIRECT_READ:
+			access = { vk::PipelineStageFlagBits::eDrawIndirect, vk::AccessFlagBits::eIndirectCommandRead, vk::ImageLayout::eUndefined, false };
+			break;
+		case RenderGraphUsage::TRANSFER_SRC:
+			access = { vk::PipelineStageFlagBits::eTransfer, vk::AccessFlagBits::eTransferRead, vk::ImageLayout::eTransferSrcOptimal, false };
+			break;
+		case RenderGraphUsage::TRANSFER_DST:
+			access = { vk::PipelineStageFlagBits::eTransfer, vk::AccessFlagBits::eTransferWrite, vk::ImageLayout::eTransferDstOptimal, true };
+			break;
+		}
+
+		return access;
+	}
+
+	/*@brief Returns the aspects of the images of a given format : depth and/or stencil for depth formats, color otherwise
+	*
+	* @param format The vulkan format of the image
+	*
+	* @return The vulkan image aspect flags
+	*/
+	inline vk::ImageAspectFlags getFormatAspect(const vk::Format format)
+	{
+		switch (format)
+		{
+		case vk::Format::eD16Unorm:
+		case vk::Format::eX8D24UnormPack32:
+		case vk::Format::eD32Sfloat:
+			return vk::ImageAspectFlagBits::eDepth;
+		case vk::Format::eD16UnormS8Uint:
+		case vk::Format::eD24UnormS8Uint:
+		case vk::Format::eD32SfloatS8Uint:
+			return vk::ImageAspectFlagBits::eDepth | vk::ImageAspectFlagBits::eStencil;
+		case vk::Format::eS8Uint:
+			return vk::ImageAspectFlagBits::eStencil;
+		default:
+			return vk::ImageAspectFlagBits::eColor;
+		}
+	}
+
+	/*Image or buffer of a render graph. Transient resources live only inside the frame, imported ones (swapchain images, persistent buffers...)
+	* come with their own layout and are kept alive by the graph. Handles are given by setImage() / setBuffer() and may change every frame*/
+	struct RenderGraphResource
+	{
+		std::string name;
+		bool isImage = true;
+
+		vk::Format format = vk::Format::eUndefined;
+		vk::Extent2D extent = {};
+		vk::SampleCountFlagBits samples = vk::SampleCountFlagBits::e1;
+		vk::DeviceSize size = 0;
+
+		bool imported = false;
+		bool output = false;
+		vk::ImageLayout initialLayout = vk::ImageLayout::eUndefined;
+		vk::ImageLayout finalLayout = vk::ImageLayout::eUndefined;
+		vk::PipelineStageFlags initialStages;
+
+		bool hasClearValue = false;
+		vk::ClearValue clearValue;
+
+		vk::Image image = vk::Image(nullptr);
+		vk::ImageView imageView = vk::ImageView(nullptr);
+		vk::Buffer buffer = vk::Buffer(nullptr);
+
+		//Resources whose memory this one reuses (see TransientMemoryAllocator)
+		std::vector<uint32_t> aliasedResources;
+	};
+
+	/*Inclusive range of the pass groups using a resource, empty (first > last) for unused resources*/
+	struct RenderGraphLifetime
+	{
+		uint32_t firstGroup;
+		uint32_t lastGroup;
+	};
+
+	/*Resource used by a pass and how*/
+	struct RenderGraphResourceUse
+	{
+		uint32_t resource;
+		RenderGraphUsage usage;
+	};
+
+	/*Pass of a render graph : the resources it uses and the function recording its commands*/
+	struct RenderGraphPass
+	{
+		std::string name;
+		RenderGraphPassType type = RenderGraphPassType::GRAPHICS;
+		std::vector<RenderGraphResourceUse> uses;
+		std::function<void(const vk::CommandBuffer&)> record;
+
+		//Passes with side effects (readbacks, uploads...) are never culled
+		bool sideEffects = false;
+	};
+
+	/*Transition of one resource between two uses, resolved into a vulkan image or buffer memory barrier when the graph is executed*/
+	struct RenderGraphBarrier
+	{
+		uint32_t resource;
+		vk::AccessFlags srcAccess;
+		vk::AccessFlags dstAccess;
+		vk::ImageLayout oldLayout = vk::ImageLayout::eUndefined;
+		vk::ImageLayout newLayout = vk::ImageLayout::eUndefined;
+	};
+
+	/*Barriers recorded together in a single vkCmdPipelineBarrier*/
+	struct RenderGraphBarrierBatch
+	{
+		vk::PipelineStageFlags srcStages;
+		vk::PipelineStageFlags dstStages;
+		std::vector<RenderGraphBarrier> barriers;
+	};
+
+	/*Attachment of a render pass created by the graph, its layouts being the ones of its first and last use in the render pass*/
+	struct RenderGraphAttachment
+	{
+		uint32_t resource;
+		vk::AttachmentLoadOp loadOp = vk::AttachmentLoadOp::eDontCare;
+		vk::AttachmentStoreOp storeOp = vk::AttachmentStoreOp::eDontCare;
+		vk::ImageLayout initialLayout = vk::ImageLayout::eUndefined;
+		vk::ImageLayout finalLayout = vk::ImageLayout::eUndefined;
+		uint32_t firstSubpass = 0;
+		uint32_t lastSubpass = 0;
+	};
+
+	/*Passes recorded after a single batch of barriers : either graphics passes merged as the subpasses of one render pass, or one pass alone*/
+	struct RenderGraphPassGroup
+	{
+		std::vector<uint32_t> passes;
+		RenderGraphBarrierBatch barriers;
+
+		bool usesRenderPass = false;
+		vk::Extent2D extent = {};
+		std::vector<RenderGraphAttachment> attachments;
+		std::vector<vk::SubpassDependency> subpassDependencies;
+		vk::RenderPass renderPass = vk::RenderPass(nullptr);
+	};
+
+	/*Render pass and subpass index a graphics pass records into, needed to create its pipelines*/
+	struct RenderGraphSubpass
+	{
+		vk::RenderPass renderPass;
+		uint32_t subpass;
+	};
+
+	/*Frame graph : passes declare the resources they read and write, compile() orders them, culls the ones nothing depends on,
+	* deduces every barrier and layout transition from the uses and merges consecutive graphics passes working on the same pixels into the subpasses of
+	* one render pass (load and store operations included), then execute() records the whole frame. A resource read by a pass holds the content left by
+	* the last pass writing it, writers running in declaration order. Framebuffers are cached by image views : releaseImageViews() must be called with
+	* the image views given to setImage() before they are destroyed (swapchain recreation...).
+	* Not thread safe, render passes and framebuffers live until destroy()*/
+	class RenderGraph
+	{
+	public:
+		RenderGraph(vk::Device logicDevice = vk::Device(nullptr))
+			: device(logicDevice)
+		{
+
+		}
+
+		RenderGraph(const RenderGraph&) = delete;
+		RenderGraph& operator=(const RenderGraph&) = delete;
+
+		/*@brief Adds an image living inside the frame, its content being discarded at the start of the frame
+		*
+		* @param name The name of the image
+		* @param format The vulkan format of the image
+		* @param extent The vulkan 2D extent of the image
+		* @param samples The number of samples of the image (default is 1)
+		*
+		* @return The index of the image
+		*/
+		inline uint32_t addImage(const std::string& name, const vk::Format format, const vk::Extent2D& extent, const vk::SampleCountFlagBits samples = vk::SampleCountFlagBits::e1)
+		{
+			RenderGraphResource resource = {};
+			resource.name = name;
+			resource.format = format;
+			resource.extent = extent;
+			resource.samples = samples;
+
+			return addResource(std::move(resource));
+		}
+
+		/*@brief Adds an image living outside the frame, its content being kept
+		*
+		* @param name The name of the image
+		* @param format The vulkan format of the image
+		* @param extent The vulkan 2D extent of the image
+		* @param initialLayout The layout of the image when the frame starts, undefined if its content does not matter
+		* @param finalLayout The layout the image is left in when the frame ends, undefined to leave it in the layout of its last use
+		* @param initialStages The stages the first use of the image waits for (the wait stage of the semaphore guarding it, default is none)
+		*
+		* @return The index of the image
+		*/
+		inline uint32_t importImage(const std::string& name, const vk::Format format, const vk::Extent2D& extent, const vk::ImageLayout initialLayout,
+			const vk::ImageLayout finalLayout, const vk::PipelineStageFlags initialStages = vk::PipelineStageFlags())
+		{
+			RenderGraphResource resource = {};
+			resource.name = name;
+			resource.format = format;
+			resource.extent = extent;
+			resource.imported = true;
+			resource.initialLayout = initialLayout;
+			resource.finalLayout = finalLayout;
+			resource.initialStages = initialStages;
+
+			return addResource(std::move(resource));
+		}
+
+		/*@brief Adds the swapchain image of the frame, acquired with a semaphore waited at the color attachment output stage (see queueSubmit())
+		* and left in the present layout
+		*
+		* @param name The name of the image
+		* @param format The vulkan format of the swapchain images
+		* @param extent The vulkan 2D extent of the swapchain
+		*
+		* @return The index of the image
+		*/
+		inline uint32_t importSwapchainImage(const std::string& name, const vk::Format format, const vk::Extent2D& extent)
+		{
+			const uint32_t resource = importImage(name, format, extent, vk::ImageLayout::eUndefined, vk::ImageLayout::ePresentSrcKHR,
+				vk::PipelineStageFlagBits::eColorAttachmentOutput);
+			resources[resource].output = true;
+
+			return resource;
+		}
+
+		/*@brief Adds a buffer living inside the frame
+		*
+		* @param name The name of the buffer
+		* @param size The size of the buffer in bytes
+		*
+		* @return The index of the buffer
+		*/
+		inline uint32_t addBuffer(const std::string& name, const vk::DeviceSize size)
+		{
+			RenderGraphResource resource = {};
+			resource.name = name;
+			resource.isImage = false;
+			resource.size = size;
+
+			return addResource(std::move(resource));
+		}
+
+		/*@brief Adds a buffer living outside the frame, its content being kept
+		*
+		* @param name The name of the buffer
+		* @param size The size of the buffer in bytes
+		* @param initialStages The stages the first use of the buffer waits for (default is none, the buffer being synchronized by the user)
+		*
+		* @return The index of the buffer
+		*/
+		inline uint32_t importBuffer(const std::string& name, const vk::DeviceSize size, const vk::PipelineStageFlags initialStages = vk::PipelineStageFlags())
+		{
+			RenderGraphResource resource = {};
+			resource.name = name;
+			resource.isImage = false;
+			resource.size = size;
+			resource.imported = true;
+			resource.initialStages = initialStages;
+
+			return addResource(std::move(resource));
+		}
+
+		/*@brief Sets the value an image is cleared to by the first pass rendering into it
+		*
+		* @param resource The index of the image
+		* @param clearValue The vulkan clear value
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), RenderGraphError)
+		*/
+		inline SkResult<bool, RenderGraphError> setClearValue(const uint32_t resource, const vk::ClearValue& clearValue)
+		{
+			SkResult result(static_cast<bool>(true), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			if (resource >= resources.size() || !resources[resource].isImage)
+			{
+				result.value = false;
+				result.error = RenderGraphError::INVALID_RESOURCE_ERROR;
+				return result;
+			}
+
+			resources[resource].hasClearValue = true;
+			resources[resource].clearValue = clearValue;
+			compiled = false;
+
+			return result;
+		}
+
+		/*@brief Marks a resource as an output of the frame (read back, presented...), the passes writing it and their dependencies being kept.
+		* Imported resources are always outputs
+		*
+		* @param resource The index of the resource
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), RenderGraphError)
+		*/
+		inline SkResult<bool, RenderGraphError> markOutput(const uint32_t resource)
+		{
+			SkResult result(static_cast<bool>(true), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			if (resource >= resources.size())
+			{
+				result.value = false;
+				result.error = RenderGraphError::INVALID_RESOURCE_ERROR;
+				return result;
+			}
+
+			resources[resource].output = true;
+			compiled = false;
+
+			return result;
+		}
+
+		/*@brief Gives the vulkan image and image view of an image, to be called before execute() whenever they change (swapchain image of the frame...).
+		* The image view must be given to releaseImageViews() before being destroyed
+		*
+		* @param resource The index of the image
+		* @param image The vulkan image
+		* @param imageView The vulkan image view, used by the framebuffers
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), RenderGraphError)
+		*/
+		inline SkResult<bool, RenderGraphError> setImage(const uint32_t resource, const vk::Image& image, const vk::ImageView& imageView)
+		{
+			SkResult result(static_cast<bool>(true), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			if (resource >= resources.size() || !resources[resource].isImage)
+			{
+				result.value = false;
+				result.error = RenderGraphError::INVALID_RESOURCE_ERROR;
+				return result;
+			}
+
+			resources[resource].image = image;
+			resources[resource].imageView = imageView;
+
+			return result;
+		}
+
+		/*@brief Gives the vulkan buffer of a buffer, to be called before execute() whenever it changes
+		*
+		* @param resource The index of the buffer
+		* @param buffer The vulkan buffer
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), RenderGraphError)
+		*/
+		inline SkResult<bool, RenderGraphError> setBuffer(const uint32_t resource, const vk::Buffer& buffer)
+		{
+			SkResult result(static_cast<bool>(true), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			if (resource >= resources.size() || resources[resource].isImage)
+			{
+				result.value = false;
+				result.error = RenderGraphError::INVALID_RESOURCE_ERROR;
+				return result;
+			}
+
+			resources[resource].buffer = buffer;
+
+			return result;
+		}
+
+		/*@brief Adds a pass, its resources being declared with use()
+		*
+		* @param name The name of the pass
+		* @param type The type of the pass
+		* @param record The function recording the commands of the pass. Graphics passes record inside the render pass begun by the graph
+		* and set their own viewport and scissor
+		* @param sideEffects Is the pass kept even if no output depends on it (default is false)
+		*
+		* @return The index of the pass
+		*/
+		inline uint32_t addPass(const std::string& name, const RenderGraphPassType type, std::function<void(const vk::CommandBuffer&)> record, const bool sideEffects = false)
+		{
+			RenderGraphPass pass = {};
+			pass.name = name;
+			pass.type = type;
+			pass.record = std::move(record);
+			pass.sideEffects = sideEffects;
+
+			passes.emplace_back(std::move(pass));
+			compiled = false;
+
+			return static_cast<uint32_t>(passes.size() - 1);
+		}
+
+		/*@brief Declares the use of a resource by a pass, once per resource and pass. Attachments can only be used by graphics passes
+		*
+		* @param pass The index of the pass
+		* @param resource The index of the resource
+		* @param usage How the pass uses the resource
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), RenderGraphError)
+		*/
+		inline SkResult<bool, RenderGraphError> use(const uint32_t pass, const uint32_t resource, const RenderGraphUsage usage)
+		{
+			SkResult result(static_cast<bool>(false), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			if (pass >= passes.size())
+			{
+				result.error = RenderGraphError::INVALID_PASS_ERROR;
+				return result;
+			}
+
+			if (resource >= resources.size())
+			{
+				result.error = RenderGraphError::INVALID_RESOURCE_ERROR;
+				return result;
+			}
+
+			const bool attachmentOutsideGraphicsPass = (isRenderGraphAttachmentUsage(usage) && passes[pass].type != RenderGraphPassType::GRAPHICS);
+			if (!isRenderGraphUsageValid(usage, resources[resource].isImage) || attachmentOutsideGraphicsPass || findUse(pass, resource) != nullptr)
+			{
+				result.error = RenderGraphError::INVALID_USAGE_ERROR;
+				return result;
+			}
+
+			passes[pass].uses.push_back({ resource, usage });
+			compiled = false;
+
+			result.value = true;
+			return result;
+		}
+
+		/*@brief Orders the passes, culls the unused ones, merges passes into render passes and generates the barriers, subpass dependencies
+		* and load/store operations of the frame. Render passes and framebuffers of a previous compilation are destroyed
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), RenderGraphError)
+		*/
+		inline SkResult<bool, RenderGraphError> compile()
+		{
+			SkResult result(static_cast<bool>(false), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			destroyRenderPasses();
+
+			compiled = false;
+			sortedPasses.clear();
+			groups.clear();
+			finalBarriers = RenderGraphBarrierBatch();
+			culledPasses.assign(passes.size(), true);
+			passGroups.assign(passes.size(), std::numeric_limits<uint32_t>::max());
+
+			/*DEPENDENCIES*/
+			std::vector<std::vector<uint32_t>> successors(passes.size());
+			std::vector<std::vector<uint32_t>> predecessors(passes.size());
+
+			for (uint32_t resource = 0; resource < resources.size(); resource++)
+			{
+				std::vector<uint32_t> writers;
+				std::vector<uint32_t> readers;
+
+				for (uint32_t pass = 0; pass < passes.size(); pass++)
+				{
+					const RenderGraphResourceUse* pUse = findUse(pass, resource);
+					if (pUse != nullptr)
+					{
+						(getRenderGraphAccess(pUse->usage, passes[pass].type).write ? writers : readers).push_back(pass);
+					}
+				}
+
+				//Writers run in declaration order, readers read the content left by the last one
+				for (size_t i = 1; i < writers.size(); i++)
+				{
+					successors[writers[i - 1]].push_back(writers[i]);
+					predecessors[writers[i]].push_back(writers[i - 1]);
+				}
+
+				for (const uint32_t reader : readers)
+				{
+					if (!writers.empty())
+					{
+						successors[writers.back()].push_back(reader);
+						predecessors[reader].push_back(writers.back());
+					}
+				}
+			}
+
+			/*CULLING*/
+			//Passes with side effects or writing an output are kept, then every pass they depend on
+			std::vector<uint32_t> keptPasses;
+			for (uint32_t pass = 0; pass < passes.size(); pass++)
+			{
+				bool kept = passes[pass].sideEffects;
+				for (const RenderGraphResourceUse& use : passes[pass].uses)
+				{
+					const RenderGraphResource& resource = resources[use.resource];
+					kept = kept || ((resource.imported || resource.output) && getRenderGraphAccess(use.usage, passes[pass].type).write);
+				}
+
+				if (kept)
+				{
+					culledPasses[pass] = false;
+					keptPasses.push_back(pass);
+				}
+			}
+
+			while (!keptPasses.empty())
+			{
+				const uint32_t pass = keptPasses.back();
+				keptPasses.pop_back();
+
+				for (const uint32_t predecessor : predecessors[pass])
+				{
+					if (culledPasses[predecessor])
+					{
+						culledPasses[predecessor] = false;
+						keptPasses.push_back(predecessor);
+					}
+				}
+			}
+
+			/*SORT AND GROUPS*/
+			std::vector<vk::Extent2D> passExtents(passes.size(), vk::Extent2D{ 0, 0 });
+			std::vector<uint32_t> inDegrees(passes.size(), 0);
+			uint32_t keptPassCount = 0;
+			for (uint32_t pass = 0; pass < passes.size(); pass++)
+			{
+				if (culledPasses[pass])
+				{
+					continue;
+				}
+
+				auto getPassExtentResult = getPassExtent(pass);
+				if (error(getPassExtentResult))
+				{
+					result.error = getPassExtentResult.error;
+					return result;
+				}
+
+				passExtents[pass] = getPassExtentResult.value;
+				inDegrees[pass] = static_cast<uint32_t>(predecessors[pass].size());
+				keptPassCount++;
+			}
+
+			//Ready passes sorted by declaration order
+			std::vector<uint32_t> readyPasses;
+			for (uint32_t pass = 0; pass < passes.size(); pass++)
+			{
+				if (!culledPasses[pass] && inDegrees[pass] == 0)
+				{
+					readyPasses.push_back(pass);
+				}
+			}
+
+			//Topological order preferring the ready pass that can join the render pass of the previous group, then the first declared one
+			while (!readyPasses.empty())
+			{
+				auto passIterator = readyPasses.begin();
+				if (!groups.empty())
+				{
+					auto mergeableIterator = std::find_if(readyPasses.begin(), readyPasses.end(), [&](const uint32_t readyPass)
+						{
+							return canMerge(groups.back(), readyPass, passExtents[readyPass]);
+						});
+
+					if (mergeableIterator != readyPasses.end())
+					{
+						passIterator = mergeableIterator;
+					}
+				}
+
+				const uint32_t pass = *passIterator;
+				readyPasses.erase(passIterator);
+				sortedPasses.push_back(pass);
+
+				if (!groups.empty() && canMerge(groups.back(), pass, passExtents[pass]))
+				{
+					groups.back().passes.push_back(pass);
+				}
+				else
+				{
+					RenderGraphPassGroup group = {};
+					group.passes.push_back(pass);
+					group.usesRenderPass = (passes[pass].type == RenderGraphPassType::GRAPHICS && passExtents[pass].width > 0);
+					group.extent = passExtents[pass];
+
+					groups.emplace_back(std::move(group));
+				}
+
+				passGroups[pass] = static_cast<uint32_t>(groups.size() - 1);
+
+				for (const uint32_t successor : successors[pass])
+				{
+					if (!culledPasses[successor] && --inDegrees[successor] == 0)
+					{
+						readyPasses.insert(std::lower_bound(readyPasses.begin(), readyPasses.end(), successor), successor);
+					}
+				}
+			}
+
+			if (sortedPasses.size() != keptPassCount)
+			{
+				sortedPasses.clear();
+				groups.clear();
+				result.error = RenderGraphError::DEPENDENCY_CYCLE_ERROR;
+				return result;
+			}
+
+			/*SYNCHRONIZATION*/
+			lifetimes.assign(resources.size(), RenderGraphLifetime{ std::numeric_limits<uint32_t>::max(), 0 });
+			for (uint32_t groupIndex = 0; groupIndex < groups.size(); groupIndex++)
+			{
+				for (const uint32_t pass : groups[groupIndex].passes)
+				{
+					for (const RenderGraphResourceUse& use : passes[pass].uses)
+					{
+						lifetimes[use.resource].firstGroup = std::min(lifetimes[use.resource].firstGroup, groupIndex);
+						lifetimes[use.resource].lastGroup = groupIndex;
+					}
+				}
+			}
+
+			//Aliased resources must be used after the resources whose memory they reuse
+			for (uint32_t resource = 0; resource < resources.size(); resource++)
+			{
+				for (const uint32_t aliasedResource : resources[resource].aliasedResources)
+				{
+					if (lifetimes[resource].firstGroup <= lifetimes[aliasedResource].lastGroup && lifetimes[aliasedResource].firstGroup <= lifetimes[resource].lastGroup)
+					{
+						result.error = RenderGraphError::ALIASED_LIFETIME_ERROR;
+						return result;
+					}
+				}
+			}
+
+			std::vector<ResourceState> states(resources.size());
+			for (uint32_t resource = 0; resource < resources.size(); resource++)
+			{
+				if (resources[resource].imported)
+				{
+					states[resource].layout = resources[resource].initialLayout;
+					states[resource].writeStages = resources[resource].initialStages;
+					states[resource].touched = true;
+					states[resource].hasContent = (!resources[resource].isImage || resources[resource].initialLayout != vk::ImageLayout::eUndefined);
+				}
+			}
+
+			for (uint32_t groupIndex = 0; groupIndex < groups.size(); groupIndex++)
+			{
+				//The first use of an aliased resource waits for the last uses of the memory it reuses
+				for (uint32_t resource = 0; resource < resources.size(); resource++)
+				{
+					if (lifetimes[resource].firstGroup != groupIndex)
+					{
+						continue;
+					}
+
+					for (const uint32_t aliasedResource : resources[resource].aliasedResources)
+					{
+						if (lifetimes[aliasedResource].firstGroup < groupIndex)
+						{
+							states[resource].writeStages |= states[aliasedResource].writeStages | states[aliasedResource].readStages;
+							states[resource].writeAccess |= states[aliasedResource].writeAccess;
+						}
+					}
+				}
+
+				synchronizeGroup(groups[groupIndex], states);
+
+				for (RenderGraphAttachment& attachment : groups[groupIndex].attachments)
+				{
+					const RenderGraphResource& resource = resources[attachment.resource];
+					const bool kept = (resource.imported || resource.output || lifetimes[attachment.resource].lastGroup > groupIndex);
+					attachment.storeOp = (kept ? vk::AttachmentStoreOp::eStore : vk::AttachmentStoreOp::eDontCare);
+				}
+			}
+
+			//Imported images are left in their final layout once every pass completed
+			for (uint32_t resource = 0; resource < resources.size(); resource++)
+			{
+				const RenderGraphResource& graphResource = resources[resource];
+				if (graphResource.imported && graphResource.isImage && graphResource.finalLayout != vk::ImageLayout::eUndefined && states[resource].layout != graphResource.finalLayout)
+				{
+					RenderGraphAccess finalAccess = {};
+					finalAccess.stages = vk::PipelineStageFlagBits::eBottomOfPipe;
+					finalAccess.layout = graphResource.finalLayout;
+
+					addBarrier(finalBarriers, resource, states[resource], finalAccess, true, !states[resource].hasContent);
+				}
+			}
+
+			compiled = true;
+
+			result.value = true;
+			return result;
+		}
+
+		/*@brief Returns the render pass and subpass a graphics pass records into, creating the render pass if needed. Pipelines of the pass are created with them
+		*
+		* @param pass The index of a graphics pass rendering into attachments
+		*
+		* @return SkResult(render pass owned by the graph and subpass index, RenderGraphError)
+		*/
+		inline SkResult<RenderGraphSubpass, RenderGraphError> getRenderPass(const uint32_t pass)
+		{
+			SkResult result(static_cast<RenderGraphSubpass>(RenderGraphSubpass{ vk::RenderPass(nullptr), 0 }), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			if (!compiled)
+			{
+				result.error = RenderGraphError::NOT_COMPILED_ERROR;
+				return result;
+			}
+
+			if (pass >= passes.size() || culledPasses[pass] || !groups[passGroups[pass]].usesRenderPass)
+			{
+				result.error = RenderGraphError::INVALID_PASS_ERROR;
+				return result;
+			}
+
+			RenderGraphPassGroup& group = groups[passGroups[pass]];
+
+			result.error = createGroupRenderPass(group);
+			result.value.renderPass = group.renderPass;
+			result.value.subpass = static_cast<uint32_t>(std::find(group.passes.begin(), group.passes.end(), pass) - group.passes.begin());
+
+			return result;
+		}
+
+		/*@brief Records the frame : the barriers of every group of passes, then its passes, merged passes being the subpasses of one render pass.
+		* Render passes and framebuffers are created on first use, framebuffers being cached by image views (one per swapchain image)
+		*
+		* @param commandBuffer The vulkan command buffer receiving the commands, outside of a render pass
+		* @param pProfiler The GPU profiler timing every pass in a zone named after it, GpuProfiler::beginFrame() having been recorded (default is none)
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), RenderGraphError)
+		*/
+		inline SkResult<bool, RenderGraphError> execute(const vk::CommandBuffer& commandBuffer, GpuProfiler* pProfiler = nullptr)
+		{
+			SkResult result(static_cast<bool>(false), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			if (!compiled)
+			{
+				result.error = RenderGraphError::NOT_COMPILED_ERROR;
+				return result;
+			}
+
+			for (uint32_t groupIndex = 0; groupIndex < groups.size(); groupIndex++)
+			{
+				RenderGraphPassGroup& group = groups[groupIndex];
+
+				result.error = recordBarrierBatch(commandBuffer, group.barriers);
+				if (result.error != RenderGraphError::NO_ERROR)
+				{
+					return result;
+				}
+
+				if (!group.usesRenderPass)
+				{
+					for (const uint32_t pass : group.passes)
+					{
+						recordPass(commandBuffer, pass, pProfiler);
+					}
+
+					continue;
+				}
+
+				auto getFramebufferResult = getFramebuffer(groupIndex);
+				if (error(getFramebufferResult))
+				{
+					result.error = getFramebufferResult.error;
+					return result;
+				}
+
+				std::vector<vk::ClearValue> clearValues;
+				clearValues.reserve(group.attachments.size());
+				for (const RenderGraphAttachment& attachment : group.attachments)
+				{
+					clearValues.push_back(resources[attachment.resource].clearValue);
+				}
+
+				vk::RenderPassBeginInfo renderPassBeginInfo = {};
+				renderPassBeginInfo.renderPass = group.renderPass;
+				renderPassBeginInfo.framebuffer = getFramebufferResult.value;
+				renderPassBeginInfo.renderArea.extent = group.extent;
+				renderPassBeginInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
+				renderPassBeginInfo.pClearValues = clearValues.data();
+
+				commandBuffer.beginRenderPass(renderPassBeginInfo, vk::SubpassContents::eInline);
+
+				for (size_t i = 0; i < group.passes.size(); i++)
+				{
+					if (i > 0)
+					{
+						commandBuffer.nextSubpass(vk::SubpassContents::eInline);
+					}
+
+					recordPass(commandBuffer, group.passes[i], pProfiler);
+				}
+
+				commandBuffer.endRenderPass();
+			}
+
+			result.error = recordBarrierBatch(commandBuffer, finalBarriers);
+
+			result.value = (result.error == RenderGraphError::NO_ERROR);
+			return result;
+		}
+
+		/*@brief Declares that a transient image reuses the memory of another one used before it, its first use waiting for the last uses of the other.
+		* Takes effect at the next compile()
+		*
+		* @param resource The index of the image reusing the memory
+		* @param aliasedResource The index of the image whose memory is reused, its lifetime ending before the one of the first image begins
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), RenderGraphError)
+		*/
+		inline SkResult<bool, RenderGraphError> addAliasDependency(const uint32_t resource, const uint32_t aliasedResource)
+		{
+			SkResult result(static_cast<bool>(false), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			if (resource >= resources.size() || aliasedResource >= resources.size() || resource == aliasedResource
+				|| resources[resource].imported || resources[aliasedResource].imported)
+			{
+				result.error = RenderGraphError::INVALID_RESOURCE_ERROR;
+				return result;
+			}
+
+			resources[resource].aliasedResources.push_back(aliasedResource);
+			compiled = false;
+
+			result.value = true;
+			return result;
+		}
+
+		/*@brief Returns the range of pass groups using a resource, the lifetime given to the transient memory allocator
+		*
+		* @param resource The index of the resource
+		*
+		* @return SkResult(first and last group using the resource, RenderGraphError)
+		*/
+		inline SkResult<RenderGraphLifetime, RenderGraphError> getResourceLifetime(const uint32_t resource) const
+		{
+			SkResult result(static_cast<RenderGraphLifetime>(RenderGraphLifetime{ std::numeric_limits<uint32_t>::max(), 0 }), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			if (!compiled)
+			{
+				result.error = RenderGraphError::NOT_COMPILED_ERROR;
+				return result;
+			}
+
+			if (resource >= resources.size())
+			{
+				result.error = RenderGraphError::INVALID_RESOURCE_ERROR;
+				return result;
+			}
+
+			result.value = lifetimes[resource];
+			return result;
+		}
+
+		/*@brief Returns true if an image is only used as an attachment inside one render pass, its content never reaching memory.
+		* Such images can be created with vk::ImageUsageFlagBits::eTransientAttachment and live in lazily allocated memory
+		*
+		* @param resource The index of the image
+		*
+		* @return True for transient attachments, false otherwise (or before compile())
+		*/
+		inline bool isTransientAttachment(const uint32_t resource) const
+		{
+			if (!compiled || resource >= resources.size() || !resources[resource].isImage || resources[resource].imported || resources[resource].output)
+			{
+				return false;
+			}
+
+			const RenderGraphLifetime& lifetime = lifetimes[resource];
+			if (lifetime.firstGroup != lifetime.lastGroup || !groups[lifetime.firstGroup].usesRenderPass)
+			{
+				return false;
+			}
+
+			for (uint32_t pass = 0; pass < passes.size(); pass++)
+			{
+				const RenderGraphResourceUse* pUse = findUse(pass, resource);
+				if (pUse != nullptr && !culledPasses[pass] && !isRenderGraphAttachmentUsage(pUse->usage))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		/*@brief Returns the usage flags an image has to be created with, deduced from the passes using it
+		*
+		* @param resource The index of the image
+		*
+		* @return SkResult(vulkan image usage flags, RenderGraphError)
+		*/
+		inline SkResult<vk::ImageUsageFlags, RenderGraphError> getImageUsage(const uint32_t resource) const
+		{
+			SkResult result(static_cast<vk::ImageUsageFlags>(vk::ImageUsageFlags()), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			if (resource >= resources.size() || !resources[resource].isImage)
+			{
+				result.error = RenderGraphError::INVALID_RESOURCE_ERROR;
+				return result;
+			}
+
+			for (const RenderGraphPass& pass : passes)
+			{
+				for (const RenderGraphResourceUse& use : pass.uses)
+				{
+					if (use.resource != resource)
+					{
+						continue;
+					}
+
+					switch (use.usage)
+					{
+					case RenderGraphUsage::COLOR_ATTACHMENT:
+						result.value |= vk::ImageUsageFlagBits::eColorAttachment;
+						break;
+					case RenderGraphUsage::DEPTH_ATTACHMENT:
+					case RenderGraphUsage::DEPTH_READ_ONLY:
+						result.value |= vk::ImageUsageFlagBits::eDepthStencilAttachment;
+						break;
+					case RenderGraphUsage::INPUT_ATTACHMENT:
+						result.value |= vk::ImageUsageFlagBits::eInputAttachment;
+						break;
+					case RenderGraphUsage::SAMPLED:
+						result.value |= vk::ImageUsageFlagBits::eSampled;
+						break;
+					case RenderGraphUsage::STORAGE_READ:
+					case RenderGraphUsage::STORAGE_WRITE:
+						result.value |= vk::ImageUsageFlagBits::eStorage;
+						break;
+					case RenderGraphUsage::TRANSFER_SRC:
+						result.value |= vk::ImageUsageFlagBits::eTransferSrc;
+						break;
+					case RenderGraphUsage::TRANSFER_DST:
+						result.value |= vk::ImageUsageFlagBits::eTransferDst;
+						break;
+					default:
+						break;
+					}
+				}
+			}
+
+			if (isTransientAttachment(resource))
+			{
+				result.value |= vk::ImageUsageFlagBits::eTransientAttachment;
+			}
+
+			return result;
+		}
+
+		/*Returns the kept passes in execution order, valid after compile()*/
+		inline const std::vector<uint32_t>& getSortedPasses() const
+		{
+			return sortedPasses;
+		}
+
+		/*Returns the groups of passes in execution order with their barriers, valid after compile()*/
+		inline const std::vector<RenderGraphPassGroup>& getPassGroups() const
+		{
+			return groups;
+		}
+
+		/*Returns the barriers recorded after the last group, moving imported images to their final layout*/
+		inline const RenderGraphBarrierBatch& getFinalBarriers() const
+		{
+			return finalBarriers;
+		}
+
+		/*Returns true if a pass was culled by compile(), nothing depending on it*/
+		inline bool isPassCulled(const uint32_t pass) const
+		{
+			return (pass >= culledPasses.size() || culledPasses[pass]);
+		}
+
+		/*Returns the resources of the graph*/
+		inline const std::vector<RenderGraphResource>& getResources() const
+		{
+			return resources;
+		}
+
+		/*Returns the passes of the graph*/
+		inline const std::vector<RenderGraphPass>& getPasses() const
+		{
+			return passes;
+		}
+
+		/*@brief Destroys the cached framebuffers using given image views, to be called before the image views are destroyed (swapchain recreation...)
+		* once the GPU finished the frames using them
+		*
+		* @param imageViews The vulkan image views about to be destroyed
+		*
+		* @return SkResult(number of destroyed framebuffers, RenderGraphError)
+		*/
+		inline SkResult<uint32_t, RenderGraphError> releaseImageViews(const std::vector<vk::ImageView>& imageViews)
+		{
+			SkResult result(static_cast<uint32_t>(0), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			for (auto framebufferIterator = framebuffers.begin(); framebufferIterator != framebuffers.end();)
+			{
+				const std::vector<vk::ImageView>& framebufferImageViews = framebufferIterator->second.imageViews;
+				const bool released = std::any_of(framebufferImageViews.begin(), framebufferImageViews.end(), [&imageViews](const vk::ImageView& imageView)
+				{
+					return std::find(imageViews.begin(), imageViews.end(), imageView) != imageViews.end();
+				});
+
+				if (!released)
+				{
+					++framebufferIterator;
+					continue;
+				}
+
+				try
+				{
+					device.destroyFramebuffer(framebufferIterator->second.framebuffer);
+				}
+				catch (vk::SystemError err)
+				{
+					result.error = RenderGraphError::RENDER_PASS_DESTRUCTION_ERROR;
+				}
+
+				framebufferIterator = framebuffers.erase(framebufferIterator);
+				result.value++;
+			}
+
+			return result;
+		}
+
+		/*@brief Destroys the render passes and framebuffers created by the graph
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), RenderGraphError)
+		*/
+		inline SkResult<bool, RenderGraphError> destroy()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			result.error = destroyRenderPasses();
+
+			result.value = (result.error == RenderGraphError::NO_ERROR);
+			return result;
+		}
+
+	private:
+		/*Synchronization state of a resource while the passes are walked in execution order*/
+		struct ResourceState
+		{
+			vk::ImageLayout layout = vk::ImageLayout::eUndefined;
+
+			//Stages of the last write (or layout transition) and the accesses it made
+			vk::PipelineStageFlags writeStages;
+			vk::AccessFlags writeAccess;
+
+			//Stages and accesses of the reads since the last write, already synchronized with it
+			vk::PipelineStageFlags readStages;
+			vk::AccessFlags readAccess;
+
+			bool touched = false;
+			bool hasContent = false;
+		};
+
+		/*Framebuffer of a group with the image views it was created with, released with them*/
+		struct CachedFramebuffer
+		{
+			vk::Framebuffer framebuffer;
+			std::vector<vk::ImageView> imageViews;
+		};
+
+		/*Use of an attachment by a subpass of the render pass of a group*/
+		struct SubpassUse
+		{
+			uint32_t subpass;
+			vk::PipelineStageFlags stages;
+			vk::AccessFlags writeAccess;
+		};
+
+		/*Synchronization state of an attachment inside the render pass of a group : uses from before the render pass not yet waited for by a subpass,
+		* then the subpasses using it since its last write*/
+		struct AttachmentState
+		{
+			vk::PipelineStageFlags externalStages;
+			vk::AccessFlags externalAccess;
+			std::vector<SubpassUse> subpassUses;
+		};
+
+		inline uint32_t addResource(RenderGraphResource&& resource)
+		{
+			resources.emplace_back(std::move(resource));
+			compiled = false;
+
+			return static_cast<uint32_t>(resources.size() - 1);
+		}
+
+		inline const RenderGraphResourceUse* findUse(const uint32_t pass, const uint32_t resource) const
+		{
+			for (const RenderGraphResourceUse& use : passes[pass].uses)
+			{
+				if (use.resource == resource)
+				{
+					return &use;
+				}
+			}
+
+			return nullptr;
+		}
+
+		//Extent shared by the attachments of a pass, zero if it has none
+		inline SkResult<vk::Extent2D, RenderGraphError> getPassExtent(const uint32_t pass) const
+		{
+			SkResult result(static_cast<vk::Extent2D>(vk::Extent2D{ 0, 0 }), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			for (const RenderGraphResourceUse& use : passes[pass].uses)
+			{
+				if (!isRenderGraphAttachmentUsage(use.usage))
+				{
+					continue;
+				}
+
+				const vk::Extent2D& extent = resources[use.resource].extent;
+				if (result.value.width == 0)
+				{
+					result.value = extent;
+				}
+				else if (result.value.width != extent.width || result.value.height != extent.height)
+				{
+					result.error = RenderGraphError::ATTACHMENT_EXTENT_ERROR;
+				}
+			}
+
+			return result;
+		}
+
+		//A graphics pass joins the render pass of the previous group if it renders the same pixels and only reads what the group produced
+		//through attachments, every other dependency being satisfied before the render pass begins
+		inline bool canMerge(const RenderGraphPassGroup& group, const uint32_t pass, const vk::Extent2D& extent) const
+		{
+			if (!group.usesRenderPass || passes[pass].type != RenderGraphPassType::GRAPHICS || extent.width != group.extent.width || extent.height != group.extent.height)
+			{
+				return false;
+			}
+
+			for (const RenderGraphResourceUse& use : passes[pass].uses)
+			{
+				for (const uint32_t groupPass : group.passes)
+				{
+					const RenderGraphResourceUse* pGroupUse = findUse(groupPass, use.resource);
+					if (pGroupUse == nullptr)
+					{
+						continue;
+					}
+
+					const bool attachment = isRenderGraphAttachmentUsage(use.usage);
+					const bool write = getRenderGraphAccess(use.usage, passes[pass].type).write || getRenderGraphAccess(pGroupUse->usage, passes[groupPass].type).write;
+
+					if (attachment != isRenderGraphAttachmentUsage(pGroupUse->usage) || (!attachment && write))
+					{
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		//True if moving a resource from its state to a new use needs a barrier or a subpass dependency
+		static inline bool needsSynchronization(const ResourceState& state, const RenderGraphAccess& next, const bool isImage)
+		{
+			const bool layoutChange = (isImage && state.layout != next.layout);
+
+			if (!state.touched)
+			{
+				return layoutChange;
+			}
+
+			if (next.write || layoutChange)
+			{
+				return true;
+			}
+
+			//Reads already synchronized with the last write need nothing more
+			return (static_cast<bool>(state.writeStages) && ((state.readStages & next.stages) != next.stages || (state.readAccess & next.access) != next.access));
+		}
+
+		//Updates the state of a resource once a use is synchronized with the previous ones
+		static inline void applyUse(ResourceState& state, const RenderGraphAccess& next, const bool isImage)
+		{
+			const bool layoutChange = (isImage && state.layout != next.layout);
+
+			if (next.write)
+			{
+				state.writeStages = next.stages;
+				state.writeAccess = next.access & renderGraphWriteAccess;
+				state.readStages = vk::PipelineStageFlags();
+				state.readAccess = vk::AccessFlags();
+				state.hasContent = true;
+			}
+			else if (layoutChange)
+			{
+				//A layout transition writes the image, following reads wait for the stages it was done before
+				state.writeStages = next.stages;
+				state.writeAccess = vk::AccessFlags();
+				state.readStages = next.stages;
+				state.readAccess = next.access;
+			}
+			else
+			{
+				state.readStages |= next.stages;
+				state.readAccess |= next.access;
+			}
+
+			if (isImage)
+			{
+				state.layout = next.layout;
+			}
+
+			state.touched = true;
+		}
+
+		static inline void addBarrier(RenderGraphBarrierBatch& batch, const uint32_t resource, const ResourceState& state, const RenderGraphAccess& next, const bool isImage,
+			const bool discardContent)
+		{
+			const bool layoutChange = (isImage && state.layout != next.layout);
+
+			//Writes and layout transitions also wait for the reads of the previous content
+			vk::PipelineStageFlags srcStages = state.writeStages;
+			if (next.write || layoutChange)
+			{
+				srcStages |= state.readStages;
+			}
+
+			batch.srcStages |= (srcStages ? srcStages : vk::PipelineStageFlags(vk::PipelineStageFlagBits::eTopOfPipe));
+			batch.dstStages |= next.stages;
+
+			RenderGraphBarrier barrier = {};
+			barrier.resource = resource;
+			barrier.srcAccess = state.writeAccess;
+			barrier.dstAccess = next.access;
+			barrier.oldLayout = (discardContent ? vk::ImageLayout::eUndefined : state.layout);
+			barrier.newLayout = (isImage ? next.layout : vk::ImageLayout::eUndefined);
+
+			batch.barriers.push_back(barrier);
+		}
+
+		static inline void addSubpassDependency(std::vector<vk::SubpassDependency>& subpassDependencies, const uint32_t srcSubpass, const uint32_t dstSubpass,
+			const vk::PipelineStageFlags srcStages, const vk::AccessFlags srcAccess, const RenderGraphAccess& next)
+		{
+			for (vk::SubpassDependency& subpassDependency : subpassDependencies)
+			{
+				if (subpassDependency.srcSubpass == srcSubpass && subpassDependency.dstSubpass == dstSubpass)
+				{
+					subpassDependency.srcStageMask |= srcStages;
+					subpassDependency.dstStageMask |= next.stages;
+					subpassDependency.srcAccessMask |= srcAccess;
+					subpassDependency.dstAccessMask |= next.access;
+					return;
+				}
+			}
+
+			vk::SubpassDependency subpassDependency = {};
+			subpassDependency.srcSubpass = srcSubpass;
+			subpassDependency.dstSubpass = dstSubpass;
+			subpassDependency.srcStageMask = (srcStages ? srcStages : vk::PipelineStageFlags(vk::PipelineStageFlagBits::eTopOfPipe));
+			subpassDependency.dstStageMask = next.stages;
+			subpassDependency.srcAccessMask = srcAccess;
+			subpassDependency.dstAccessMask = next.access;
+			subpassDependency.dependencyFlags = vk::DependencyFlagBits::eByRegion;
+
+			subpassDependencies.push_back(subpassDependency);
+		}
+
+		//Barriers before the group for its first use of every resource, subpass dependencies for the following uses of its attachments
+		inline void synchronizeGroup(RenderGraphPassGroup& group, std::vector<ResourceState>& states) const
+		{
+			std::unordered_map<uint32_t, AttachmentState> attachmentStates;
+
+			for (uint32_t subpass = 0; subpass < group.passes.size(); subpass++)
+			{
+				const RenderGraphPass& pass = passes[group.passes[subpass]];
+
+				for (const RenderGraphResourceUse& use : pass.uses)
+				{
+					const RenderGraphResource& resource = resources[use.resource];
+					ResourceState& state = states[use.resource];
+					const RenderGraphAccess next = getRenderGraphAccess(use.usage, pass.type);
+					const bool inRenderPass = (group.usesRenderPass && isRenderGraphAttachmentUsage(use.usage));
+
+					auto attachmentStateIterator = attachmentStates.find(use.resource);
+					if (inRenderPass && attachmentStateIterator != attachmentStates.end())
+					{
+						//Attachment of a previous subpass, layouts being changed by the render pass itself
+						AttachmentState& attachmentState = attachmentStateIterator->second;
+
+						if (needsSynchronization(state, next, true))
+						{
+							if (attachmentState.externalStages)
+							{
+								addSubpassDependency(group.subpassDependencies, VK_SUBPASS_EXTERNAL, subpass, attachmentState.externalStages, attachmentState.externalAccess, next);
+							}
+
+							for (const SubpassUse& subpassUse : attachmentState.subpassUses)
+							{
+								if (subpassUse.subpass != subpass)
+								{
+									addSubpassDependency(group.subpassDependencies, subpassUse.subpass, subpass, subpassUse.stages, subpassUse.writeAccess, next);
+								}
+							}
+
+							if (next.write || state.layout != next.layout)
+							{
+								attachmentState.externalStages = vk::PipelineStageFlags();
+								attachmentState.externalAccess = vk::AccessFlags();
+								attachmentState.subpassUses.clear();
+							}
+						}
+
+						attachmentState.subpassUses.push_back({ subpass, next.stages, next.access & renderGraphWriteAccess });
+
+						for (RenderGraphAttachment& attachment : group.attachments)
+						{
+							if (attachment.resource == use.resource)
+							{
+								attachment.finalLayout = next.layout;
+								attachment.lastSubpass = subpass;
+							}
+						}
+
+						applyUse(state, next, true);
+						continue;
+					}
+
+					//First use in the group, synchronized before the render pass begins
+					const ResourceState previousState = state;
+					const bool discardContent = (inRenderPass && !state.hasContent);
+					const bool synchronized = needsSynchronization(state, next, resource.isImage);
+
+					if (synchronized)
+					{
+						addBarrier(group.barriers, use.resource, state, next, resource.isImage, discardContent);
+					}
+
+					if (inRenderPass)
+					{
+						//Reads from before the render pass which the barrier did not wait for must be waited for by later writing subpasses
+						AttachmentState attachmentState = {};
+						if (!synchronized)
+						{
+							attachmentState.externalStages = previousState.writeStages | previousState.readStages;
+							attachmentState.externalAccess = previousState.writeAccess;
+						}
+						else if (!next.write && previousState.layout == next.layout)
+						{
+							attachmentState.externalStages = previousState.readStages;
+						}
+
+						attachmentState.subpassUses.push_back({ subpass, next.stages, next.access & renderGraphWriteAccess });
+						attachmentStates.emplace(use.resource, attachmentState);
+
+						RenderGraphAttachment attachment = {};
+						attachment.resource = use.resource;
+						attachment.loadOp = (previousState.hasContent ? vk::AttachmentLoadOp::eLoad : (resource.hasClearValue ? vk::AttachmentLoadOp::eClear : vk::AttachmentLoadOp::eDontCare));
+						attachment.initialLayout = next.layout;
+						attachment.finalLayout = next.layout;
+						attachment.firstSubpass = subpass;
+						attachment.lastSubpass = subpass;
+
+						group.attachments.push_back(attachment);
+					}
+
+					applyUse(state, next, resource.isImage);
+				}
+			}
+		}
+
+		//Profiling errors (zone overflow, no timestamp support) never stop the recording of the frame
+		inline void recordPass(const vk::CommandBuffer& commandBuffer, const uint32_t pass, GpuProfiler* pProfiler) const
+		{
+			const bool profiled = (pProfiler != nullptr && !logError(pProfiler->beginZone(commandBuffer, passes[pass].name)));
+
+			if (passes[pass].record)
+			{
+				passes[pass].record(commandBuffer);
+			}
+
+			if (profiled)
+			{
+				logError(pProfiler->endZone(commandBuffer));
+			}
+		}
+
+		inline RenderGraphError recordBarrierBatch(const vk::CommandBuffer& commandBuffer, const RenderGraphBarrierBatch& batch) const
+		{
+			if (batch.barriers.empty())
+			{
+				return RenderGraphError::NO_ERROR;
+			}
+
+			std::vector<vk::ImageMemoryBarrier> imageBarriers;
+			std::vector<vk::BufferMemoryBarrier> bufferBarriers;
+
+			for (const RenderGraphBarrier& barrier : batch.barriers)
+			{
+				const RenderGraphResource& resource = resources[barrier.resource];
+
+				if (resource.isImage)
+				{
+					if (!resource.image)
+					{
+						return RenderGraphError::MISSING_RESOURCE_HANDLE_ERROR;
+					}
+
+					vk::ImageMemoryBarrier imageBarrier = {};
+					imageBarrier.srcAccessMask = barrier.srcAccess;
+					imageBarrier.dstAccessMask = barrier.dstAccess;
+					imageBarrier.oldLayout = barrier.oldLayout;
+					imageBarrier.newLayout = barrier.newLayout;
+					imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+					imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+					imageBarrier.image = resource.image;
+					imageBarrier.subresourceRange = vk::ImageSubresourceRange(getFormatAspect(resource.format), 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS);
+
+					imageBarriers.push_back(imageBarrier);
+				}
+				else
+				{
+					if (!resource.buffer)
+					{
+						return RenderGraphError::MISSING_RESOURCE_HANDLE_ERROR;
+					}
+
+					vk::BufferMemoryBarrier bufferBarrier = {};
+					bufferBarrier.srcAccessMask = barrier.srcAccess;
+					bufferBarrier.dstAccessMask = barrier.dstAccess;
+					bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+					bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+					bufferBarrier.buffer = resource.buffer;
+					bufferBarrier.offset = 0;
+					bufferBarrier.size = VK_WHOLE_SIZE;
+
+					bufferBarriers.push_back(bufferBarrier);
+				}
+			}
+
+			commandBuffer.pipelineBarrier(batch.srcStages, batch.dstStages, vk::DependencyFlags(), nullptr, bufferBarriers, imageBarriers);
+
+			return RenderGraphError::NO_ERROR;
+		}
+
+		inline RenderGraphError createGroupRenderPass(RenderGraphPassGroup& group) const
+		{
+			if (group.renderPass)
+			{
+				return RenderGraphError::NO_ERROR;
+			}
+
+			std::vector<vk::AttachmentDescription> attachmentDescriptions;
+			attachmentDescriptions.reserve(group.attachments.size());
+
+			for (const RenderGraphAttachment& attachment : group.attachments)
+			{
+				const RenderGraphResource& resource = resources[attachment.resource];
+				const bool hasStencil = static_cast<bool>(getFormatAspect(resource.format) & vk::ImageAspectFlagBits::eStencil);
+
+				vk::AttachmentDescription attachmentDescription = {};
+				attachmentDescription.format = resource.format;
+				attachmentDescription.samples = resource.samples;
+				attachmentDescription.loadOp = attachment.loadOp;
+				attachmentDescription.storeOp = attachment.storeOp;
+				attachmentDescription.stencilLoadOp = (hasStencil ? attachment.loadOp : vk::AttachmentLoadOp::eDontCare);
+				attachmentDescription.stencilStoreOp = (hasStencil ? attachment.storeOp : vk::AttachmentStoreOp::eDontCare);
+				attachmentDescription.initialLayout = attachment.initialLayout;
+				attachmentDescription.finalLayout = attachment.finalLayout;
+
+				attachmentDescriptions.push_back(attachmentDescription);
+			}
+
+			//References must stay alive until the render pass is created
+			const size_t subpassCount = group.passes.size();
+			std::vector<std::vector<vk::AttachmentReference>> colorReferences(subpassCount);
+			std::vector<std::vector<vk::AttachmentReference>> inputReferences(subpassCount);
+			std::vector<vk::AttachmentReference> depthReferences(subpassCount, vk::AttachmentReference(VK_ATTACHMENT_UNUSED, vk::ImageLayout::eUndefined));
+			std::vector<std::vector<uint32_t>> preservedAttachments(subpassCount);
+			std::vector<vk::SubpassDescription> subpassDescriptions(subpassCount);
+
+			for (uint32_t subpass = 0; subpass < subpassCount; subpass++)
+			{
+				const RenderGraphPass& pass = passes[group.passes[subpass]];
+
+				for (uint32_t attachmentIndex = 0; attachmentIndex < group.attachments.size(); attachmentIndex++)
+				{
+					const RenderGraphAttachment& attachment = group.attachments[attachmentIndex];
+					const RenderGraphResourceUse* pUse = findUse(group.passes[subpass], attachment.resource);
+
+					if (pUse == nullptr)
+					{
+						//Content written before this subpass and read after it
+						if (attachment.firstSubpass < subpass && subpass < attachment.lastSubpass)
+						{
+							preservedAttachments[subpass].push_back(attachmentIndex);
+						}
+
+						continue;
+					}
+
+					const vk::AttachmentReference reference(attachmentIndex, getRenderGraphAccess(pUse->usage, pass.type).layout);
+
+					if (pUse->usage == RenderGraphUsage::COLOR_ATTACHMENT)
+					{
+						colorReferences[subpass].push_back(reference);
+					}
+					else if (pUse->usage == RenderGraphUsage::INPUT_ATTACHMENT)
+					{
+						inputReferences[subpass].push_back(reference);
+					}
+					else
+					{
+						depthReferences[subpass] = reference;
+					}
+				}
+
+				subpassDescriptions[subpass].pipelineBindPoint = vk::PipelineBindPoint::eGraphics;
+				subpassDescriptions[subpass].colorAttachmentCount = static_cast<uint32_t>(colorReferences[subpass].size());
+				subpassDescriptions[subpass].pColorAttachments = colorReferences[subpass].data();
+				subpassDescriptions[subpass].inputAttachmentCount = static_cast<uint32_t>(inputReferences[subpass].size());
+				subpassDescriptions[subpass].pInputAttachments = inputReferences[subpass].data();
+				subpassDescriptions[subpass].pDepthStencilAttachment = (depthReferences[subpass].attachment != VK_ATTACHMENT_UNUSED ? &depthReferences[subpass] : nullptr);
+				subpassDescriptions[subpass].preserveAttachmentCount = static_cast<uint32_t>(preservedAttachments[subpass].size());
+				subpassDescriptions[subpass].pPreserveAttachments = preservedAttachments[subpass].data();
+			}
+
+			vk::RenderPassCreateInfo renderPassCreateInfo = {};
+			renderPassCreateInfo.attachmentCount = static_cast<uint32_t>(attachmentDescriptions.size());
+			renderPassCreateInfo.pAttachments = attachmentDescriptions.data();
+			renderPassCreateInfo.subpassCount = static_cast<uint32_t>(subpassDescriptions.size());
+			renderPassCreateInfo.pSubpasses = subpassDescriptions.data();
+			renderPassCreateInfo.dependencyCount = static_cast<uint32_t>(group.subpassDependencies.size());
+			renderPassCreateInfo.pDependencies = group.subpassDependencies.data();
+
+			try
+			{
+				group.renderPass = device.createRenderPass(renderPassCreateInfo);
+			}
+			catch (vk::SystemError err)
+			{
+				return RenderGraphError::RENDER_PASS_CREATION_ERROR;
+			}
+
+			return RenderGraphError::NO_ERROR;
+		}
+
+		inline SkResult<vk::Framebuffer, RenderGraphError> getFramebuffer(const uint32_t groupIndex)
+		{
+			SkResult result(static_cast<vk::Framebuffer>(vk::Framebuffer(nullptr)), static_cast<RenderGraphError>(RenderGraphError::NO_ERROR));
+
+			RenderGraphPassGroup& group = groups[groupIndex];
+
+			result.error = createGroupRenderPass(group);
+			if (result.error != RenderGraphError::NO_ERROR)
+			{
+				return result;
+			}
+
+			std::vector<vk::ImageView> imageViews;
+			std::vector<uint32_t> key = { groupIndex };
+
+			for (const RenderGraphAttachment& attachment : group.attachments)
+			{
+				const vk::ImageView& imageView = resources[attachment.resource].imageView;
+				if (!imageView)
+				{
+					result.error = RenderGraphError::MISSING_RESOURCE_HANDLE_ERROR;
+					return result;
+				}
+
+				imageViews.push_back(imageView);
+				appendHandleKey(key, imageView);
+			}
+
+			auto framebufferIterator = framebuffers.find(key);
+			if (framebufferIterator != framebuffers.end())
+			{
+				result.value = framebufferIterator->second.framebuffer;
+				return result;
+			}
+
+			vk::FramebufferCreateInfo framebufferCreateInfo = {};
+			framebufferCreateInfo.renderPass = group.renderPass;
+			framebufferCreateInfo.attachmentCount = static_cast<uint32_t>(imageViews.size());
+			framebufferCreateInfo.pAttachments = imageViews.data();
+			framebufferCreateInfo.width = group.extent.width;
+			framebufferCreateInfo.height = group.extent.height;
+			framebufferCreateInfo.layers = 1;
+
+			try
+			{
+				result.value = device.createFramebuffer(framebufferCreateInfo);
+			}
+			catch (vk::SystemError err)
+			{
+				result.error = RenderGraphError::FRAMEBUFFER_CREATION_ERROR;
+				return result;
+			}
+
+			framebuffers.emplace(std::move(key), CachedFramebuffer{ result.value, std::move(imageViews) });
+			return result;
+		}
+
+		inline RenderGraphError destroyRenderPasses()
+		{
+			RenderGraphError graphError = RenderGraphError::NO_ERROR;
+
+			for (auto& framebuffer : framebuffers)
+			{
+				try
+				{
+					device.destroyFramebuffer(framebuffer.second.framebuffer);
+				}
+				catch (vk::SystemError err)
+				{
+					graphError = RenderGraphError::RENDER_PASS_DESTRUCTION_ERROR;
+				}
+			}
+
+			framebuffers.clear();
+
+			for (RenderGraphPassGroup& group : groups)
+			{
+				if (group.renderPass)
+				{
+					try
+					{
+						device.destroyRenderPass(group.renderPass);
+					}
+					catch (vk::SystemError err)
+					{
+						graphError = RenderGraphError::RENDER_PASS_DESTRUCTION_ERROR;
+					}
+
+					group.renderPass = vk::RenderPass(nullptr);
+				}
+			}
+
+			return graphError;
+		}
+
+		vk::Device device;
+
+		std::vector<RenderGraphResource> resources;
+		std::vector<RenderGraphPass> passes;
+
+		bool compiled = false;
+		std::vector<uint32_t> sortedPasses;
+		std::vector<bool> culledPasses;
+		std::vector<uint32_t> passGroups;
+		std::vector<RenderGraphPassGroup> groups;
+		std::vector<RenderGraphLifetime> lifetimes;
+		RenderGraphBarrierBatch finalBarriers;
+
+		std::unordered_map<std::vector<uint32_t>, CachedFramebuffer, WordKeyHash> framebuffers;
+	};
+
+	/*GPU CULLING*/
+
+	/*@brief Records the reset of a draw count buffer to 0, made visible to the compute shaders appending draw commands
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands, outside of a render pass
+	* @param drawCountBuffer The buffer created by createDrawCountBuffer
+	*/
+	inline void recordDrawCountReset(const vk::CommandBuffer& commandBuffer, const vk::Buffer& drawCountBuffer)
+	{
+		commandBuffer.fillBuffer(drawCountBuffer, 0, sizeof(uint32_t), 0);
+
+		vk::BufferMemoryBarrier resetBarrier = {};
+		resetBarrier.srcAccessMask = vk::AccessFlagBits::eTransferWrite;
+		resetBarrier.dstAccessMask = vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eShaderWrite;
+		resetBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		resetBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		resetBarrier.buffer = drawCountBuffer;
+		resetBarrier.offset = 0;
+		resetBarrier.size = VK_WHOLE_SIZE;
+
+		commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eComputeShader, vk::DependencyFlags(), nullptr, resetBarrier, nullptr);
+	}
+
+	/*@brief Records the barrier making the draw commands and draw count written by a compute shader visible to indirect draws
+	*
+	* @param commandBuffer The vulkan command buffer receiving the barrier
+	*/
+	inline void recordIndirectDrawBarrier(const vk::CommandBuffer& commandBuffer)
+	{
+		//Covers both the draw commands and the draw count written by the shader
+		vk::MemoryBarrier indirectBarrier = {};
+		indirectBarrier.srcAccessMask = vk::AccessFlagBits::eShaderWrite;
+		indirectBarrier.dstAccessMask = vk::AccessFlagBits::eIndirectCommandRead;
+
+		commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader, vk::PipelineStageFlagBits::eDrawIndirect, vk::DependencyFlags(), indirectBarrier, nullptr, nullptr);
+	}
+
+	/*@brief Creates the descriptor set layout of shaders/frustum_culling.comp :
+	* binding 0 = CullingInstance storage buffer, binding 1 = indirect command storage buffer, binding 2 = draw count storage buffer
+	*
+	* @param device The vulkan device used to create the descriptor set layout
+	*
+	* @return SkResult(created descriptor set layout, DescriptorError)
+	*/
+	inline SkResult<vk::DescriptorSetLayout, DescriptorError> createFrustumCullingDescriptorSetLayout(const vk::Device& device)
+	{
+		std::vector<vk::DescriptorSetLayoutBinding> bindings(3);
+		for (uint32_t i = 0; i < static_cast<uint32_t>(bindings.size()); i++)
+		{
+			bindings[i].binding = i;
+			bindings[i].descriptorType = vk::DescriptorType::eStorageBuffer;
+			bindings[i].descriptorCount = 1;
+			bindings[i].stageFlags = vk::ShaderStageFlagBits::eCompute;
+		}
+
+		return createDescriptorSetLayout(device, bindings);
+	}
+
+	/*@brief Creates the pipeline layout of shaders/frustum_culling.comp (one descriptor set and CullingPushConstants)
+	*
+	* @param device The vulkan device used to create the pipeline layout
+	* @param descriptorSetLayout The layout created by createFrustumCullingDescriptorSetLayout
+	*
+	* @return SkResult(created pipeline layout, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::PipelineLayout, GraphicsPipelineError> createFrustumCullingPipelineLayout(const vk::Device& device, const vk::DescriptorSetLayout& descriptorSetLayout)
+	{
+		vk::PushConstantRange pushConstantRange = {};
+		pushConstantRange.stageFlags = vk::ShaderStageFlagBits::eCompute;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(CullingPushConstants);
+
+		return createPipelineLayout(device, { descriptorSetLayout }, { pushConstantRange });
+	}
+
+	/*@brief Points the three bindings of a frustum culling descriptor set to the given buffers
+	*
+	* @param device The vulkan device updating the descriptor set
+	* @param descriptorSet The descriptor set allocated with the frustum culling layout
+	* @param instanceBuffer The storage buffer holding the CullingInstance array (or the Meshlet array for the meshlet culling)
+	* @param drawCommandBuffer The buffer created by createIndirectCommandBuffer
+	* @param drawCountBuffer The buffer created by createDrawCountBuffer
+	*
+	* @return SkResult(boolean indicating if the operation worked(true) or not(false), DescriptorError)
+	*/
+	inline SkResult<bool, DescriptorError> writeFrustumCullingDescriptorSet(const vk::Device& device, const vk::DescriptorSet& descriptorSet, const vk::Buffer& instanceBuffer,
+		const vk::Buffer& drawCommandBuffer, const vk::Buffer& drawCountBuffer)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<DescriptorError>(DescriptorError::NO_ERROR));
+
+		result.error = affectError(writeBufferDescriptor(device, descriptorSet, 0, vk::DescriptorType::eStorageBuffer, instanceBuffer), result.error);
+		result.error = affectError(writeBufferDescriptor(device, descriptorSet, 1, vk::DescriptorType::eStorageBuffer, drawCommandBuffer), result.error);
+		result.error = affectError(writeBufferDescriptor(device, descriptorSet, 2, vk::DescriptorType::eStorageBuffer, drawCountBuffer), result.error);
+
+		result.value = (result.error == DescriptorError::NO_ERROR);
+		return result;
+	}
+
+	/*@brief Records the frustum culling dispatch : resets the draw count, culls every instance against the frustum on the GPU
+	* and makes the written draw commands and draw count visible to drawIndexedIndirectCount.
+	* Must be recorded outside of a render pass, the CPU cost does not depend on the number of instances
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands
+	* @param pipeline The compute pipeline created from shaders/frustum_culling.spv
+	* @param pipelineLayout The layout created by createFrustumCullingPipelineLayout
+	* @param descriptorSet The descriptor set written by writeFrustumCullingDescriptorSet
+	* @param drawCountBuffer The buffer created by createDrawCountBuffer
+	* @param frustum The frustum extracted from the view projection matrix
+	* @param instanceCount The number of instances in the instance buffer
+	* @param maxDrawCount The number of draw commands the indirect command buffer can hold
+	*
+	* @return SkResult(boolean indicating if the operation worked(true) or not(false), CullingError)
+	*/
+	inline SkResult<bool, CullingError> recordFrustumCulling(const vk::CommandBuffer& commandBuffer, const vk::Pipeline& pipeline, const vk::PipelineLayout& pipelineLayout, const vk::DescriptorSet& descriptorSet,
+		const vk::Buffer& drawCountBuffer, const SOULKAN_MATHS_NAMESPACE::Frustum& frustum, const uint32_t instanceCount, const uint32_t maxDrawCount)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<CullingError>(CullingError::NO_ERROR));
+
+		//The shader never writes more than maxDrawCount commands, the exceeding visible instances would silently disappear
+		if (instanceCount > maxDrawCount)
+		{
+			result.value = false;
+			result.error = CullingError::INSTANCE_COUNT_EXCEEDS_MAX_DRAW_COUNT;
+			return result;
+		}
+
+		recordDrawCountReset(commandBuffer, drawCountBuffer);
+
+		CullingPushConstants pushConstants;
+		pushConstants.frustumPlanes = frustum.planes;
+		pushConstants.instanceCount = instanceCount;
+		pushConstants.maxDrawCount = maxDrawCount;
+
+		commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, pipeline);
+		commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute, pipelineLayout, 0, descriptorSet, nullptr);
+		commandBuffer.pushConstants(pipelineLayout, vk::ShaderStageFlagBits::eCompute, 0, sizeof(CullingPushConstants), &pushConstants);
+
+		//64 = local_size_x of shaders/frustum_culling.comp
+		commandBuffer.dispatch((instanceCount + 63) / 64, 1, 1);
+
+		recordIndirectDrawBarrier(commandBuffer);
+
+		return result;
+	}
+
+	/*@brief Creates the pipeline layout of shaders/meshlet_culling.comp (one descriptor set and MeshletCullingPushConstants).
+	* The descriptor set layout is the one of the frustum culling, binding 0 holding the Meshlet array instead of the CullingInstance array
+	*
+	* @param device The vulkan device used to create the pipeline layout
+	* @param descriptorSetLayout The layout created by createFrustumCullingDescriptorSetLayout
+	*
+	* @return SkResult(created pipeline layout, GraphicsPipelineError)
+	*/
+	inline SkResult<vk::PipelineLayout, GraphicsPipelineError> createMeshletCullingPipelineLayout(const vk::Device& device, const vk::DescriptorSetLayout& descriptorSetLayout)
+	{
+		vk::PushConstantRange pushConstantRange = {};
+		pushConstantRange.stageFlags = vk::ShaderStageFlagBits::eCompute;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(MeshletCullingPushConstants);
+
+		return createPipelineLayout(device, { descriptorSetLayout }, { pushConstantRange });
+	}
+
+	/*@brief Records the meshlet culling dispatch : every meshlet is tested against the frustum and its normal cone on the GPU,
+	* the visible ones get a draw command for drawIndexedIndirectCount, with the index buffer of MeshletMesh::mesh bound.
+	* Frustum and camera position are expected in the space of the mesh : extract the frustum from projection * view * model
+	* and bring the camera position back with the inverse of the model matrix
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands, outside of a render pass
+	* @param pipeline The compute pipeline created from shaders/meshlet_culling.spv
+	* @param pipelineLayout The layout created by createMeshletCullingPipelineLayout
+	* @param descriptorSet The descriptor set written by writeFrustumCullingDescriptorSet with the meshlet buffer
+	* @param drawCountBuffer The buffer created by createDrawCountBuffer
+	* @param frustum The frustum in the space of the mesh
+	* @param cameraPosition The camera position in the space of the mesh
+	* @param meshletCount The number of meshlets in the meshlet buffer
+	* @param maxDrawCount The number of draw commands the indirect command buffer can hold
+	*
+	* @return SkResult(boolean indicating if the operation worked(true) or not(false), CullingError)
+	*/
+	inline SkResult<bool, CullingError> recordMeshletCulling(const vk::CommandBuffer& commandBuffer, const vk::Pipeline& pipeline, const vk::PipelineLayout& pipelineLayout, const vk::DescriptorSet& descriptorSet,
+		const vk::Buffer& drawCountBuffer, const SOULKAN_MATHS_NAMESPACE::Frustum& frustum, const SOULKAN_MATHS_NAMESPACE::Vec3& cameraPosition, const uint32_t meshletCount, const uint32_t maxDrawCount)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<CullingError>(CullingError::NO_ERROR));
+
+		if (meshletCount > maxDrawCount)
+		{
+			result.value = false;
+			result.error = CullingError::INSTANCE_COUNT_EXCEEDS_MAX_DRAW_COUNT;
+			return result;
+		}
+
+		recordDrawCountReset(commandBuffer, drawCountBuffer);
+
+		MeshletCullingPushConstants pushConstants;
+		pushConstants.frustumPlanes = frustum.planes;
+		pushConstants.cameraPosition = SOULKAN_MATHS_NAMESPACE::Vec4(cameraPosition, 1.0f);
+		pushConstants.meshletCount = meshletCount;
+		pushConstants.maxDrawCount = maxDrawCount;
+
+		commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, pipeline);
+		commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute, pipelineLayout, 0, descriptorSet, nullptr);
+		commandBuffer.pushConstants(pipelineLayout, vk::ShaderStageFlagBits::eCompute, 0, sizeof(MeshletCullingPushConstants), &pushConstants);
+
+		//64 = local_size_x of shaders/meshlet_culling.comp
+		commandBuffer.dispatch((meshletCount + 63) / 64, 1, 1);
+
+		recordIndirectDrawBarrier(commandBuffer);
+
+		return result;
+	}
+
+	/*Allocation*/
+
+	/*@brief Returns the index of the chosen memory type according to the given type filter and memory properties
+	*
+	* @param physicalDevice The vulkan physical device to query memory properties from
+	* @param typeFilter The type filter indicating which memory type should be used
+	* @param memoryProperties The memory properties to be compared against physical device queried memory properties
+	*
+	* @return SkResult(index of memory type, AllocationError)
+	*/
+	inline SkResult<uint32_t, AllocationError> getMemoryTypeIndex(const vk::PhysicalDevice& physicalDevice, uint32_t typeFilter, const vk::Flags<vk::MemoryPropertyFlagBits>& memoryProperties)
+	{
+		SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+		vk::PhysicalDeviceMemoryProperties physicalDeviceMemoryProperties = physicalDevice.getMemoryProperties();
+
+		uint32_t memoryTypeIndex = std::numeric_limits<uint32_t>::max();
+
+		for (uint32_t i = 0; i < physicalDeviceMemoryProperties.memoryTypeCount; i++)
+		{
+			if ((typeFilter & (1 << i)) && ((physicalDeviceMemoryProperties.memoryTypes[i].propertyFlags & memoryProperties) == memoryProperties))
+			{
+				memoryTypeIndex = i;
+				break;
+			}
+		}
+
+		if (memoryTypeIndex == std::numeric_limits<uint32_t>::max())
+		{
+			result.error = AllocationError::COULD_NOT_GET_MEMORY_TYPE_INDEX_ERROR;
+		}
+
+		result.value = std::move(memoryTypeIndex);
+		return result;
+	}
+
+	/*@brief Returns the aligned offset according to the given alignement and current offset
+	*
+	* @param alignement The alignement to follow
+	* @param currentOffset The current offset before aligned
+	*
+	* @return SkResult(aligned offset, AllocationError)
+	*/
+	inline SkResult<uint64_t, AllocationError> getAlignedOffset(const vk::DeviceSize& alignement, uint64_t currentOffset)
+	{
+		SkResult result(static_cast<uint64_t>(std::numeric_limits<uint64_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+		//Rounded up in one step, the offsets of per draw data being aligned for every draw
+		result.value = (alignement > 1 ? ((currentOffset + alignement - 1) / alignement) * alignement : currentOffset);
+		return result;
+	}
+
+	/*A very basic/barebone memory block, contains the id, origin and size of itself.*/
+	class MemoryBlock
+	{
+	public:
+		MemoryBlock(uint32_t identification, uint64_t offset, MemoryBlockSize size)
+		{
+			id = identification;
+			origin = offset;
+			blockSize = size;
+		}
+
+		MemoryBlock(MemoryBlockSize size)
+		{
+			id = 0;
+			origin = 0;
+			blockSize = size;
+		}
+
+		MemoryBlock()
+		{
+			id = 0;
+			origin = 0;
+			blockSize = MemoryBlockSize::ZERO;
+		}
+
+		/*Returns a pointer to the memory block*/
+		inline SkResult<MemoryBlock*, AllocationError> get()
+		{
+			SkResult result(static_cast<MemoryBlock*>(nullptr), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			result.value = this;
+			return result;
+		}
+
+		/*Returns the id of the memory block*/
+		inline SkResult<uint32_t, AllocationError> getId()
+		{
+			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			result.value = this->id;
+			return result;
+		}
+
+		/*Returns the origin of the memory block*/
+		inline SkResult<uint64_t, AllocationError> getOrigin()
+		{
+			SkResult result(static_cast<uint64_t>(std::numeric_limits<uint64_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+
+			result.value = this->origin;
+			return result;
+		}
+
+		/*Returns the size of to the memory block*/
+		inline SkResult<MemoryBlockSize, AllocationError> getSize()
+		{
+			SkResult result(static_cast<MemoryBlockSize>(MemoryBlockSize::ZERO), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			result.value = this->blockSize;
+			return result;
+		}
+	private:
+		uint32_t id;
+		uint64_t origin;
+
+		MemoryBlockSize blockSize;
+
+	};
+
+	/*A very basic/barebone memory pool, holds onto device memory and a vector of blocks*/
+	class MemoryPool
+	{
+	public:
+		MemoryPool()
+		{
+
+		}
+		MemoryPool(vk::Device poolDevice, MemoryPoolSize poolSize, uint32_t poolId, vk::DeviceMemory poolMemory, vk::MemoryType poolMemoryType, uint32_t poolMemoryTypeIndex)
+			: device(poolDevice),
+			memorySize(poolSize),
+			id(poolId),
+			memory(poolMemory),
+			memoryType(poolMemoryType),
+			memoryTypeIndex(poolMemoryTypeIndex)
+		{
+		}
+
+		//Create block 
+		inline SkResult<uint32_t, AllocationError> createMemoryBlock(MemoryBlockSize blockSize, vk::Buffer buffer)
+		{
+			return createMemoryBlock(blockSize, device.getBufferMemoryRequirements(buffer));
+		}
+
+		//Create block aligned as given memory requirements
+		inline SkResult<uint32_t, AllocationError> createMemoryBlock(MemoryBlockSize blockSize, const vk::MemoryRequirements& memoryRequirements)
+		{
+			SkResult result(static_cast<uint32_t>(1), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			//Ranges of the blocks by origin, aliased blocks overlapping each other
+			std::vector<Pair<uint64_t, uint64_t>> ranges;
+			ranges.reserve(memoryBlocks.size());
+			for (MemoryBlock* pBlock : memoryBlocks)
+			{
+				const uint64_t origin = retLog(pBlock->getOrigin());
+				ranges.emplace_back(origin, origin + static_cast<uint64_t>(retLog(pBlock->getSize())));
+			}
+
+			std::sort(ranges.begin(), ranges.end(), [](const Pair<uint64_t, uint64_t>& first, const Pair<uint64_t, uint64_t>& second)
+				{
+					return first.a < second.a;
+				});
+
+			//The block goes into the first aligned gap large enough, gaps being left by freed blocks (see freeMemoryBlock())
+			uint64_t offset = 0;
+			for (const Pair<uint64_t, uint64_t>& range : ranges)
+			{
+				if (offset + static_cast<uint64_t>(blockSize) <= range.a)
+				{
+					break;
+				}
+
+				offset = std::max(offset, retLog(getAlignedOffset(memoryRequirements.alignment, range.b)));
+			}
+
+			if (offset + static_cast<uint64_t>(blockSize) > static_cast<uint64_t>(memorySize))
+			{
+				result.value = std::numeric_limits<uint32_t>::max();
+				result.error = AllocationError::INSUFFICIENT_FREE_MEMORY_ERROR;
+				return result;
+			}
+
+			uint32_t id = nextBlockId++;
+
+			MemoryBlock* block = new MemoryBlock(id, offset, blockSize);
+			memoryBlocks.emplace_back(block);
+
+			occupiedMemory = std::max(occupiedMemory, offset + static_cast<uint64_t>(blockSize));
+
+			result.value = std::move(id);
+			return result;
+		}
+
+		//Create a block at a given offset, transient resources whose lifetimes do not overlap sharing the same range of the pool
+		inline SkResult<uint32_t, AllocationError> createAliasedMemoryBlock(uint64_t offset, MemoryBlockSize blockSize)
+		{
+			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			if (offset + static_cast<uint64_t>(blockSize) > static_cast<uint64_t>(memorySize))
+			{
+				result.error = AllocationError::INSUFFICIENT_FREE_MEMORY_ERROR;
+				return result;
+			}
+
+			uint32_t id = nextBlockId++;
+
+			MemoryBlock* block = new MemoryBlock(id, offset, blockSize);
+			memoryBlocks.emplace_back(block);
+
+			occupiedMemory = std::max(occupiedMemory, offset + static_cast<uint64_t>(blockSize));
+
+			result.value = std::move(id);
+			return result;
+		}
+
+		inline SkResult<bool, AllocationError> bind(MemoryBlock* block, vk::Buffer buffer)
+		{
+			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			uint64_t offset = retLog(block->getOrigin());
+			device.bindBufferMemory(buffer, this->memory, offset);
+
+
+			return result;
+		}
+
+		inline SkResult<bool, AllocationError> bind(MemoryBlock* block, vk::Image image)
+		{
+			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			uint64_t offset = retLog(block->getOrigin());
+			try
+			{
+				device.bindImageMemory(image, this->memory, offset);
+			}
+			catch (vk::SystemError err)
+			{
+				result.value = false;
+				result.error = AllocationError::BIND_IMAGE_MEMORY_ERROR;
+			}
+
+			return result;
+		}
+
+		inline SkResult<void*, AllocationError> map(MemoryBlock* block)
+		{
+			SkResult result(static_cast<void*>(nullptr), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			uint64_t offset = retLog(block->getOrigin());
+			uint64_t size = static_cast<uint64_t>(retLog(block->getSize()));
+			void* data = device.mapMemory(this->memory, offset, size);
+
+			result.value = data;
+			return result;
+		}
+
+		inline SkResult<bool, AllocationError> unmap()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			device.unmapMemory(this->memory);
+
+			return result;
+		}
+
+		/*Returns the free memory of the memory pool*/
+		inline SkResult<uint64_t, AllocationError> getFreeMemory()
+		{
+			SkResult result(static_cast<uint64_t>(0), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			uint64_t freePoolMemory = static_cast<uint64_t>(memorySize) - occupiedMemory;
+
+			result.value = std::move(freePoolMemory);
+			return result;
+		}
+
+		inline SkResult<uint32_t, AllocationError> getMemoryTypeIndex()
+		{
+			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			result.value = memoryTypeIndex;
+			return result;
+		}
+
+		inline SkResult<vk::MemoryType, AllocationError> getMemoryType()
+		{
+			SkResult result(static_cast<vk::MemoryType>(vk::MemoryType{}), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			result.value = memoryType;
+			return result;
+		}
+
+		inline SkResult<uint32_t, AllocationError> getId()
+		{
+			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			result.value = id;
+			return result;
+		}
+
+		inline SkResult<MemoryBlock*, AllocationError> getBlockById(uint32_t blockId)
+		{
+			SkResult result(static_cast<MemoryBlock*>(nullptr), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			bool found = false;
+			MemoryBlock* pMemoryBlock = nullptr;
+			for (uint32_t i = 0; i < memoryBlocks.size(); i++)
+			{
+				uint32_t currentBlockId = retLog(memoryBlocks[i]->getId());
+				if (currentBlockId == blockId)
+				{
+					pMemoryBlock = memoryBlocks[i];
+					found = true;
+				}
+			}
+
+			if (!found)
+			{
+				result.error = AllocationError::UNDEFINED_ERROR;
+			}
+
+			result.value = std::move(pMemoryBlock);
+			return result;
+		}
+
+		inline SkResult<uint32_t, AllocationError> getNumberOfBlocks()
+		{
+			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			result.value = static_cast<uint32_t>(memoryBlocks.size());
+			return result;
+		}
+
+		//Free a block, its range being reused by the next blocks that fit in it
+		inline SkResult<bool, AllocationError> freeMemoryBlock(uint32_t blockId)
+		{
+			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			auto blockIterator = std::find_if(memoryBlocks.begin(), memoryBlocks.end(), [blockId](MemoryBlock* pBlock)
+				{
+					return retLog(pBlock->getId()) == blockId;
+				});
+
+			if (blockIterator == memoryBlocks.end())
+			{
+				result.value = false;
+				result.error = AllocationError::UNDEFINED_ERROR;
+				return result;
+			}
+
+			delete *blockIterator;
+			memoryBlocks.erase(blockIterator);
+
+			//The free memory of the pool is the memory after its last block
+			occupiedMemory = 0;
+			for (MemoryBlock* pBlock : memoryBlocks)
+			{
+				occupiedMemory = std::max(occupiedMemory, retLog(pBlock->getOrigin()) + static_cast<uint64_t>(retLog(pBlock->getSize())));
+			}
+
+			return result;
+		}
+
+		inline SkResult<bool, AllocationError> freeMemoryBlocks()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			for (uint32_t i = 0; i < memoryBlocks.size(); i++)
+			{
+				delete memoryBlocks[i];
+			}
+
+			return result;
+		}
+
+		inline SkResult<bool, AllocationError> freeMemory()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			try
+			{
+				device.freeMemory(memory);
+			}
+			catch (vk::SystemError error)
+			{
+				result.value = false;
+				result.error = AllocationError::UNDEFINED_ERROR;
+			}
+
+			return result;
+		}
+
+	private:
+		vk::Device device;
+
+		uint32_t id;
+
+		std::vector<MemoryBlock*> memoryBlocks = {};
+		uint32_t nextBlockId = 0;
+
+		MemoryPoolSize   memorySize;
+		uint64_t         occupiedMemory = 0;
+		vk::DeviceMemory memory;
+
+		vk::MemoryType memoryType;
+		uint32_t memoryTypeIndex;
+	};
+
+	/*A very basic/barebone memory allocator, should be used as a singleton.
+	It contains pools and pools contain blocks. Pools hold on to device memory and subdivides it into smaller sections contained in blocks*/
+	class MemoryAllocator
+	{
+	public:
+		MemoryAllocator(vk::PhysicalDevice physDevice, vk::Device logicDevice)
+			: physicalDevice(physDevice),
+			device(logicDevice)
+		{
+
+		}
+
+		inline SkResult<Pair<uint32_t, uint32_t>, AllocationError> allocateBind(vk::Buffer& buffer, vk::Flags<vk::MemoryPropertyFlagBits> memoryPropertyFlags)
+		{
+			SkResult result(static_cast<Pair<uint32_t, uint32_t>>(Pair(std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint32_t>::max())), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			auto allocateResult = allocate(device.getBufferMemoryRequirements(buffer), memoryPropertyFlags);
+			if (logError(allocateResult))
+			{
+				result.error = allocateResult.error;
+				return result;
+			}
+
+			MemoryPool* currentPool = retLog(getPoolById(allocateResult.value.a));
+			MemoryBlock* block = retLog(currentPool->getBlockById(allocateResult.value.b));
+
+			auto bindResult = currentPool->bind(block, buffer);
+			bool binded = retLog(bindResult);
+
+			result.value = allocateResult.value;
+			return result;
+		}
+
+		/*Allocates and binds the memory of an optimally tiled image (render target, texture). Images share pools with buffers of the same memory type,
+		* their blocks being padded to bufferImageGranularity so that no linear resource shares a page with them*/
+		inline SkResult<Pair<uint32_t, uint32_t>, AllocationError> allocateBind(vk::Image& image, vk::Flags<vk::MemoryPropertyFlagBits> memoryPropertyFlags)
+		{
+			SkResult result(static_cast<Pair<uint32_t, uint32_t>>(Pair(std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint32_t>::max())), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			vk::MemoryRequirements memoryRequirements = device.getImageMemoryRequirements(image);
+
+			const vk::DeviceSize bufferImageGranularity = physicalDevice.getProperties().limits.bufferImageGranularity;
+			memoryRequirements.alignment = std::max(memoryRequirements.alignment, bufferImageGranularity);
+			memoryRequirements.size = retLog(getAlignedOffset(bufferImageGranularity, memoryRequirements.size));
+
+			auto allocateResult = allocate(memoryRequirements, memoryPropertyFlags);
+			if (logError(allocateResult))
+			{
+				result.error = allocateResult.error;
+				return result;
+			}
+
+			MemoryPool* currentPool = retLog(getPoolById(allocateResult.value.a));
+			MemoryBlock* block = retLog(currentPool->getBlockById(allocateResult.value.b));
+
+			auto bindResult = currentPool->bind(block, image);
+			if (logError(bindResult))
+			{
+				result.error = bindResult.error;
+				return result;
+			}
+
+			result.value = allocateResult.value;
+			return result;
 		}
 
-		MemoryBlock(MemoryBlockSize size)
+		/*Frees the block of an allocation returned by allocateBind(), the resource bound to it having been destroyed.
+		* The memory of the block is reused by the next allocations of its pool*/
+		inline SkResult<bool, AllocationError> free(const Pair<uint32_t, uint32_t>& allocation)
 		{
-			id = 0;
-			origin = 0;
-			blockSize = size;
+			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			MemoryPool* pool = retLog(getPoolById(allocation.a));
+			if (pool == nullptr)
+			{
+				result.value = false;
+				result.error = AllocationError::UNDEFINED_ERROR;
+				return result;
+			}
+
+			return pool->freeMemoryBlock(allocation.b);
 		}
 
-		MemoryBlock()
+		inline SkResult<MemoryPool*, AllocationError> getPoolById(uint32_t poolId)
 		{
-			id = 0;
-			origin = 0;
-			blockSize = MemoryBlockSize::ZERO;
+			SkResult result(static_cast<MemoryPool*>(nullptr), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			MemoryPool* memoryPool = nullptr;
+			for (uint32_t i = 0; i < memoryPools.size(); i++)
+			{
+				auto getPoolIdResult = memoryPools[i]->getId();
+				uint32_t currPoolId = retLog(getPoolIdResult);
+
+				if (currPoolId == poolId)
+				{
+					memoryPool = memoryPools[i];
+				}
+			}
+
+			result.value = std::move(memoryPool);
+			return result;
 		}
 
-		/*Returns a pointer to the memory block*/
-		inline SkResult<MemoryBlock*, AllocationError> get()
+		inline SkResult<uint32_t, AllocationError> getNumberOfPools()
 		{
-			SkResult result(static_cast<MemoryBlock*>(nullptr), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
 
-			result.value = this;
+			result.value = static_cast<uint32_t>(memoryPools.size());
 			return result;
 		}
 
-		/*Returns the id of the memory block*/
-		inline SkResult<uint32_t, AllocationError> getId()
+		inline SkResult<bool, AllocationError> freeMemoryPools()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			for (uint32_t i = 0; i < memoryPools.size(); i++)
+			{
+				delete memoryPools[i];
+			}
+
+			return result;
+		}
+
+		inline SkResult<bool, AllocationError> freeAllMemory()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			for (uint32_t i = 0; i < memoryPools.size(); i++)
+			{
+				memoryPools[i]->freeMemory();
+				memoryPools[i]->freeMemoryBlocks();
+			}
+
+			bool memoryPoolsFreed = retLog(freeMemoryPools());
+			if (!memoryPoolsFreed)
+			{
+				result.value = false;
+			}
+
+			return result;
+		}
+	private:
+		vk::PhysicalDevice physicalDevice;
+		vk::Device         device;
+
+		std::vector<MemoryPool*> memoryPools = {};
+
+		//Finds or creates a pool able to hold a block of given memory requirements and creates the block, returns the ids of the pool and block
+		inline SkResult<Pair<uint32_t, uint32_t>, AllocationError> allocate(const vk::MemoryRequirements& memoryRequirements, vk::Flags<vk::MemoryPropertyFlagBits> memoryPropertyFlags)
+		{
+			SkResult result(static_cast<Pair<uint32_t, uint32_t>>(Pair(std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint32_t>::max())), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			uint32_t createdPoolId = std::numeric_limits<uint32_t>::max();
+			uint32_t createdBlockId = std::numeric_limits<uint32_t>::max();
+
+			MemoryPool* currentPool = nullptr;
+			if (memoryPools.size() > 0)
+			{
+				auto getSuitablePoolIdsResult = getSuitablePoolIds(memoryRequirements, memoryPropertyFlags);
+				std::vector<uint32_t> suitablePoolIds = retLog(getSuitablePoolIdsResult);
+
+				if (suitablePoolIds.size() > 0)
+				{
+					//@TODO Somehow prefer one pool over another
+					uint32_t memoryPoolId = suitablePoolIds[0];
+					auto getPoolIdResult = getPoolById(memoryPoolId);
+					currentPool = retLog(getPoolIdResult);
+
+				}
+			}
+
+			if (currentPool == nullptr)
+			{
+				auto getAppropriateBufferSizeResult = getAppropriateMemorySize(memoryRequirements, true);
+				MemorySize appropriatePoolSize = retLog(getAppropriateBufferSizeResult);
+
+				auto createMemoryPoolResult = createMemoryPool(static_cast<MemoryPoolSize>(appropriatePoolSize), memoryRequirements, memoryPropertyFlags);
+				uint32_t memoryPoolId = retLog(createMemoryPoolResult);
+
+				auto getPoolIdResult = getPoolById(memoryPoolId);
+				currentPool = retLog(getPoolIdResult);
+			}
+
+			auto getAppropriateMemorySizeResult = getAppropriateMemorySize(memoryRequirements, false);
+			MemorySize appropriateMemorySize = retLog(getAppropriateMemorySizeResult);
+
+			auto createMemoryBlockResult = currentPool->createMemoryBlock(static_cast<MemoryBlockSize>(appropriateMemorySize), memoryRequirements);
+			if (logError(createMemoryBlockResult))
+			{
+				result.error = createMemoryBlockResult.error;
+				return result;
+			}
+			uint32_t memoryBlockId = createMemoryBlockResult.value;
+
+			createdPoolId = retLog(currentPool->getId());
+			createdBlockId = memoryBlockId;
+
+			result.value = std::move(Pair(createdPoolId, createdBlockId));
+			return result;
+		}
+
+		//Create pool : Allocate memory
+		inline SkResult<uint32_t, AllocationError> createMemoryPool(MemoryPoolSize poolSize, const vk::MemoryRequirements& memoryRequirements, vk::Flags<vk::MemoryPropertyFlagBits> memoryPropertyFlags)
 		{
 			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
 
-			result.value = this->id;
+			auto getMemoryTypeIndexResult = getMemoryTypeIndex(physicalDevice, memoryRequirements.memoryTypeBits, memoryPropertyFlags);
+			uint32_t memoryTypeIndex = retLog(getMemoryTypeIndexResult);
+
+			vk::MemoryAllocateInfo memoryAllocateInfo = {};
+			memoryAllocateInfo.allocationSize = static_cast<uint64_t>(poolSize);
+			memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
+
+			vk::DeviceMemory poolMemory = device.allocateMemory(memoryAllocateInfo);
+
+			uint32_t poolId;
+			if (memoryPools.size() > 0)
+			{
+				auto getLastPoolIdResult = memoryPools[memoryPools.size() - 1]->getId();
+				uint32_t lastPoolId = retLog(getLastPoolIdResult);
+
+				poolId = lastPoolId + 1;
+			}
+			else
+			{
+				poolId = 0;
+			}
+
+			auto getHeapIndexByTypeIndexResult = getHeapIndexByTypeIndex(physicalDevice, memoryTypeIndex);
+			uint32_t poolHeapIndex = retLog(getHeapIndexByTypeIndexResult);
+
+			vk::MemoryType poolMemoryType = {};
+			poolMemoryType.heapIndex = poolHeapIndex;
+			poolMemoryType.propertyFlags = memoryPropertyFlags;
+
+			MemoryPool* pool = new MemoryPool(device, poolSize, poolId, std::move(poolMemory), poolMemoryType, memoryTypeIndex);
+			memoryPools.emplace_back(pool);
+
+			result.value = std::move(poolId);
+			return result;
+		}
+
+		inline SkResult<bool, AllocationError> isASuitablePool(MemoryPool* pool, const vk::MemoryRequirements& memoryRequirements, vk::Flags<vk::MemoryPropertyFlagBits> memoryPropertyFlags)
+		{
+			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			auto getFreePoolMemoryResult = pool->getFreeMemory();
+			uint64_t freePoolMemory = retLog(getFreePoolMemoryResult);
+
+			//The block is rounded up to a power of 2 and may be preceded by up to alignment - 1 bytes of padding
+			auto getAppropriateMemorySizeResult = getAppropriateMemorySize(memoryRequirements, false);
+			uint64_t blockSize = static_cast<uint64_t>(retLog(getAppropriateMemorySizeResult));
+
+			if (blockSize + static_cast<uint64_t>(memoryRequirements.alignment) > freePoolMemory)
+			{
+				result.value = false;
+			}
+
+			auto getMemoryTypeIndexResult = getMemoryTypeIndex(physicalDevice, memoryRequirements.memoryTypeBits, memoryPropertyFlags);
+			uint32_t memoryTypeIndex = retLog(getMemoryTypeIndexResult);
+
+			auto getPoolMemoryTypeIndex = pool->getMemoryTypeIndex();
+			uint32_t poolMemoryTypeIndex = retLog(getPoolMemoryTypeIndex);
+
+			if (memoryTypeIndex != poolMemoryTypeIndex)
+			{
+				result.value = false;
+			}
+
+			auto getPoolMemoryType = pool->getMemoryType();
+			vk::MemoryType poolMemoryType = retLog(getPoolMemoryType);
+
+			if (poolMemoryType.propertyFlags != memoryPropertyFlags)
+			{
+				result.value = false;
+			}
+
+			return result;
+		}
+
+		inline SkResult<std::vector<uint32_t>, AllocationError> getSuitablePoolIds(const vk::MemoryRequirements& memoryRequirements, vk::Flags<vk::MemoryPropertyFlagBits> memoryPropertyFlags)
+		{
+			SkResult result(static_cast<std::vector<uint32_t>>(std::vector<uint32_t>()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			std::vector<uint32_t> poolIds = {};
+			for (uint32_t i = 0; i < memoryPools.size(); i++)
+			{
+				auto isASuitablePoolResult = isASuitablePool(memoryPools[i], memoryRequirements, memoryPropertyFlags);
+				bool isSuitable = retLog(isASuitablePoolResult);
+
+				if (isSuitable)
+				{
+					auto getPoolIdResult = memoryPools[i]->getId();
+					uint32_t poolId = retLog(getPoolIdResult);
+
+					poolIds.emplace_back(poolId);
+				}
+			}
+
+			result.value = std::move(poolIds);
+			return result;
+		}
+
+		inline SkResult<MemorySize, AllocationError> getAppropriateMemorySize(const vk::MemoryRequirements& memoryRequirements, bool isForPool)
+		{
+			SkResult result(static_cast<MemorySize>(MemorySize::ZERO), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+			uint32_t i = 0;
+			while (memoryRequirements.size > pow(2, i))
+			{
+				i++;
+			}
+
+			MemorySize appropriatePoolSize;
+			if (isForPool)
+			{
+				appropriatePoolSize = static_cast<MemorySize>(pow(2, i) * 8);
+			}
+			else
+			{
+				appropriatePoolSize = static_cast<MemorySize>(pow(2, i));
+			}
+
+			result.value = std::move(appropriatePoolSize);
 			return result;
 		}
+	};
+
+	/*Transient memory aliasing*/
+
+	/*Memory needs and lifetime of a transient resource, lifetimes being inclusive ranges of pass group indices (see RenderGraph::getResourceLifetime())*/
+	struct TransientAllocationRequest
+	{
+		vk::DeviceSize size;
+		vk::DeviceSize alignment;
+		uint32_t firstUse;
+		uint32_t lastUse;
+	};
+
+	/*Placement of transient resources in one range of memory : resources alive at the same time never overlap, the others may share memory*/
+	struct TransientAliasingPlan
+	{
+		std::vector<vk::DeviceSize> offsets;
+		vk::DeviceSize size = 0;
+
+		//Size the resources would take placed one after the other
+		vk::DeviceSize unaliasedSize = 0;
+
+		//Pairs (resource, earlier resource whose memory it reuses), the first use of the resource having to wait for the last use of the earlier one
+		std::vector<Pair<uint32_t, uint32_t>> aliases;
+	};
+
+	/*@brief Places transient resources in one range of memory, largest first, each at the lowest aligned offset not used by a resource alive at the same time
+	*
+	* @param requests The sizes, alignments and lifetimes of the resources
+	*
+	* @return SkResult(offsets of the resources and size of the range, AllocationError)
+	*/
+	inline SkResult<TransientAliasingPlan, AllocationError> planTransientAliasing(const std::vector<TransientAllocationRequest>& requests)
+	{
+		SkResult result(static_cast<TransientAliasingPlan>(TransientAliasingPlan()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+
+		for (const TransientAllocationRequest& request : requests)
+		{
+			if (request.firstUse > request.lastUse)
+			{
+				result.error = AllocationError::INVALID_TRANSIENT_LIFETIME_ERROR;
+				return result;
+			}
+
+			result.value.unaliasedSize = retLog(getAlignedOffset(request.alignment, result.value.unaliasedSize)) + request.size;
+		}
 
-		/*Returns the origin of the memory block*/
-		inline SkResult<uint64_t, AllocationError> getOrigin()
+		std::vector<uint32_t> order(requests.size());
+		for (uint32_t i = 0; i < order.size(); i++)
 		{
-			SkResult result(static_cast<uint64_t>(std::numeric_limits<uint64_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			order[i] = i;
+		}
 
+		std::stable_sort(order.begin(), order.end(), [&](const uint32_t a, const uint32_t b)
+			{
+				return requests[a].size > requests[b].size;
+			});
 
-			result.value = this->origin;
-			return result;
-		}
+		result.value.offsets.assign(requests.size(), 0);
+		std::vector<uint32_t> placedRequests;
+		placedRequests.reserve(requests.size());
 
-		/*Returns the size of to the memory block*/
-		inline SkResult<MemoryBlockSize, AllocationError> getSize()
+		for (const uint32_t index : order)
 		{
-			SkResult result(static_cast<MemoryBlockSize>(MemoryBlockSize::ZERO), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			const TransientAllocationRequest& request = requests[index];
 
-			result.value = this->blockSize;
-			return result;
+			//Ranges used by the placed resources alive at the same time, sorted by offset
+			std::vector<Pair<vk::DeviceSize, vk::DeviceSize>> usedRanges;
+			for (const uint32_t placedIndex : placedRequests)
+			{
+				const TransientAllocationRequest& placedRequest = requests[placedIndex];
+				if (placedRequest.firstUse <= request.lastUse && request.firstUse <= placedRequest.lastUse)
+				{
+					usedRanges.emplace_back(result.value.offsets[placedIndex], result.value.offsets[placedIndex] + placedRequest.size);
+				}
+			}
+
+			std::sort(usedRanges.begin(), usedRanges.end(), [](const Pair<vk::DeviceSize, vk::DeviceSize>& a, const Pair<vk::DeviceSize, vk::DeviceSize>& b)
+				{
+					return a.a < b.a;
+				});
+
+			vk::DeviceSize offset = 0;
+			for (const Pair<vk::DeviceSize, vk::DeviceSize>& usedRange : usedRanges)
+			{
+				if (offset + request.size <= usedRange.a)
+				{
+					break;
+				}
+
+				offset = std::max(offset, retLog(getAlignedOffset(request.alignment, usedRange.b)));
+			}
+
+			result.value.offsets[index] = offset;
+			result.value.size = std::max(result.value.size, offset + request.size);
+
+			//Resources sharing memory are ordered by their lifetimes
+			for (const uint32_t placedIndex : placedRequests)
+			{
+				const TransientAllocationRequest& placedRequest = requests[placedIndex];
+				const vk::DeviceSize placedOffset = result.value.offsets[placedIndex];
+
+				if (placedOffset < offset + request.size && offset < placedOffset + placedRequest.size)
+				{
+					if (placedRequest.lastUse < request.firstUse)
+					{
+						result.value.aliases.emplace_back(index, placedIndex);
+					}
+					else
+					{
+						result.value.aliases.emplace_back(placedIndex, index);
+					}
+				}
+			}
+
+			placedRequests.push_back(index);
 		}
-	private:
-		uint32_t id;
-		uint64_t origin;
 
-		MemoryBlockSize blockSize;
+		return result;
+	}
 
+	/*Transient image (render target living inside a frame) to be bound to aliased memory*/
+	struct TransientImage
+	{
+		vk::Image image;
+		uint32_t firstUse;
+		uint32_t lastUse;
+
+		//Only used as an attachment inside one render pass (created with vk::ImageUsageFlagBits::eTransientAttachment), may live in lazily allocated memory
+		bool transientAttachment = false;
 	};
 
-	/*A very basic/barebone memory pool, holds onto device memory and a vector of blocks*/
-	class MemoryPool
+	/*Allocator of the memory of transient images : images of the same memory type whose lifetimes do not overlap share ranges of one memory pool,
+	* transient attachments going to lazily allocated memory (never backed on tiled GPUs) when the device has some.
+	* Images used by several frames in flight need one allocator per frame. Not thread safe, pools live until freeAllMemory()*/
+	class TransientMemoryAllocator
 	{
 	public:
-		MemoryPool()
+		TransientMemoryAllocator(vk::PhysicalDevice physDevice, vk::Device logicDevice)
+			: physicalDevice(physDevice),
+			device(logicDevice)
 		{
 
-		}
-		MemoryPool(vk::Device poolDevice, MemoryPoolSize poolSize, uint32_t poolId, vk::DeviceMemory poolMemory, vk::MemoryType poolMemoryType, uint32_t poolMemoryTypeIndex)
-			: device(poolDevice),
-			memorySize(poolSize),
-			id(poolId),
-			memory(poolMemory),
-			memoryType(poolMemoryType),
-			memoryTypeIndex(poolMemoryTypeIndex)
-		{
 		}
 
-		//Create block 
-		inline SkResult<uint32_t, AllocationError> createMemoryBlock(MemoryBlockSize blockSize, vk::Buffer buffer)
+		TransientMemoryAllocator(const TransientMemoryAllocator&) = delete;
+		TransientMemoryAllocator& operator=(const TransientMemoryAllocator&) = delete;
+
+		/*@brief Allocates memory for transient images and binds them to it, each memory type getting one pool and one aliasing plan
+		*
+		* @param images The images and their lifetimes
+		*
+		* @return SkResult(pairs of indices (image, earlier image whose memory it reuses), to be given to RenderGraph::addAliasDependency(), AllocationError)
+		*/
+		inline SkResult<std::vector<Pair<uint32_t, uint32_t>>, AllocationError> allocateBind(const std::vector<TransientImage>& images)
 		{
-			SkResult result(static_cast<uint32_t>(1), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			SkResult result(static_cast<std::vector<Pair<uint32_t, uint32_t>>>(std::vector<Pair<uint32_t, uint32_t>>()), static_cast<AllocationError>(AllocationError::NO_ERROR));
 
-			vk::MemoryRequirements memoryRequirements = device.getBufferMemoryRequirements(buffer);
+			imageAllocations.assign(images.size(), Pair<uint32_t, uint32_t>(std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint32_t>::max()));
 
-			uint32_t id = std::numeric_limits<uint32_t>::max();
-			uint64_t offset = std::numeric_limits<uint32_t>::max();
-			if (memoryBlocks.size() == 0)
-			{
-				id = 0;
-				offset = 0;
-			}
-			else
+			std::vector<vk::MemoryRequirements> memoryRequirements(images.size());
+			std::vector<uint32_t> memoryTypeIndices(images.size());
+			std::vector<vk::Flags<vk::MemoryPropertyFlagBits>> memoryPropertyFlags(images.size());
+
+			for (size_t i = 0; i < images.size(); i++)
 			{
-				uint32_t blockId = retLog(memoryBlocks[memoryBlocks.size() - 1]->getId());
-				id = blockId + 1;
+				memoryRequirements[i] = device.getImageMemoryRequirements(images[i].image);
+				memoryPropertyFlags[i] = vk::MemoryPropertyFlagBits::eDeviceLocal;
+
+				auto getLazyMemoryTypeIndexResult = getMemoryTypeIndex(physicalDevice, memoryRequirements[i].memoryTypeBits,
+					vk::MemoryPropertyFlagBits::eDeviceLocal | vk::MemoryPropertyFlagBits::eLazilyAllocated);
 
-				uint64_t totalBlockSize = 0;
-				for (uint32_t i = 0; i < memoryBlocks.size(); i++)
+				if (images[i].transientAttachment && !error(getLazyMemoryTypeIndexResult))
 				{
-					MemoryBlockSize blockSize = retLog(memoryBlocks[i]->getSize());
-					totalBlockSize += static_cast<uint64_t>(blockSize);
+					memoryPropertyFlags[i] |= vk::MemoryPropertyFlagBits::eLazilyAllocated;
+					memoryTypeIndices[i] = getLazyMemoryTypeIndexResult.value;
+					continue;
 				}
 
-				uint64_t currentOffset = totalBlockSize + (memoryBlocks.size() * gapSize);
-				auto getAlignedOffsetResult = getAlignedOffset(memoryRequirements.alignment, currentOffset);
-				uint64_t alignedOffset = retLog(getAlignedOffsetResult);
+				auto getMemoryTypeIndexResult = getMemoryTypeIndex(physicalDevice, memoryRequirements[i].memoryTypeBits, memoryPropertyFlags[i]);
+				if (logError(getMemoryTypeIndexResult))
+				{
+					result.error = getMemoryTypeIndexResult.error;
+					return result;
+				}
 
-				offset = alignedOffset;
+				memoryTypeIndices[i] = getMemoryTypeIndexResult.value;
 			}
 
-			MemoryBlock* block = new MemoryBlock(id, offset, blockSize);
-			memoryBlocks.emplace_back(block);
-
-			result.value = std::move(id);
-			return result;
-		}
+			std::vector<uint32_t> usedMemoryTypeIndices = memoryTypeIndices;
+			std::sort(usedMemoryTypeIndices.begin(), usedMemoryTypeIndices.end());
+			usedMemoryTypeIndices.erase(std::unique(usedMemoryTypeIndices.begin(), usedMemoryTypeIndices.end()), usedMemoryTypeIndices.end());
 
-		inline SkResult<bool, AllocationError> bind(MemoryBlock* block, vk::Buffer buffer)
-		{
-			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			for (const uint32_t memoryTypeIndex : usedMemoryTypeIndices)
+			{
+				std::vector<uint32_t> poolImages;
+				std::vector<TransientAllocationRequest> requests;
 
-			uint64_t offset = static_cast<uint64_t>(retLog(block->getId()));
-			device.bindBufferMemory(buffer, this->memory, offset);
+				for (uint32_t i = 0; i < images.size(); i++)
+				{
+					if (memoryTypeIndices[i] == memoryTypeIndex)
+					{
+						poolImages.push_back(i);
+						requests.push_back({ memoryRequirements[i].size, memoryRequirements[i].alignment, images[i].firstUse, images[i].lastUse });
+					}
+				}
 
+				auto planTransientAliasingResult = planTransientAliasing(requests);
+				if (logError(planTransientAliasingResult))
+				{
+					result.error = planTransientAliasingResult.error;
+					return result;
+				}
 
-			return result;
-		}
+				const TransientAliasingPlan& plan = planTransientAliasingResult.value;
 
-		inline SkResult<void*, AllocationError> map(MemoryBlock* block)
-		{
-			SkResult result(static_cast<void*>(nullptr), static_cast<AllocationError>(AllocationError::NO_ERROR));
+				auto createMemoryPoolResult = createMemoryPool(plan.size, memoryTypeIndex, memoryPropertyFlags[poolImages[0]]);
+				if (logError(createMemoryPoolResult))
+				{
+					result.error = createMemoryPoolResult.error;
+					return result;
+				}
 
-			uint64_t offset = static_cast<uint64_t>(retLog(block->getId()));
-			uint64_t size = static_cast<uint64_t>(retLog(block->getSize()));
-			void* data = device.mapMemory(this->memory, offset, size);
+				MemoryPool* pool = createMemoryPoolResult.value;
 
-			result.value = data;
-			return result;
-		}
+				for (size_t i = 0; i < poolImages.size(); i++)
+				{
+					auto createAliasedMemoryBlockResult = pool->createAliasedMemoryBlock(plan.offsets[i], static_cast<MemoryBlockSize>(requests[i].size));
+					if (logError(createAliasedMemoryBlockResult))
+					{
+						result.error = createAliasedMemoryBlockResult.error;
+						return result;
+					}
 
-		inline SkResult<bool, AllocationError> unmap()
-		{
-			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+					MemoryBlock* block = retLog(pool->getBlockById(createAliasedMemoryBlockResult.value));
 
-			device.unmapMemory(this->memory);
+					auto bindResult = pool->bind(block, images[poolImages[i]].image);
+					if (logError(bindResult))
+					{
+						result.error = bindResult.error;
+						return result;
+					}
 
-			return result;
-		}
+					imageAllocations[poolImages[i]] = Pair<uint32_t, uint32_t>(retLog(pool->getId()), createAliasedMemoryBlockResult.value);
+				}
 
-		/*Returns the free memory of the memory pool*/
-		inline SkResult<uint64_t, AllocationError> getFreeMemory()
-		{
-			SkResult result(static_cast<uint64_t>(0), static_cast<AllocationError>(AllocationError::NO_ERROR));
+				for (const Pair<uint32_t, uint32_t>& alias : plan.aliases)
+				{
+					result.value.emplace_back(poolImages[alias.a], poolImages[alias.b]);
+				}
 
-			uint64_t freePoolMemory = static_cast<uint64_t>(memorySize) - occupiedMemory;
+				allocatedSize += plan.size;
+				unaliasedSize += plan.unaliasedSize;
+			}
 
-			result.value = std::move(freePoolMemory);
 			return result;
 		}
 
-		inline SkResult<uint32_t, AllocationError> getMemoryTypeIndex()
+		/*Returns the memory allocated for the transient images*/
+		inline SkResult<vk::DeviceSize, AllocationError> getAllocatedSize()
 		{
-			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			SkResult result(static_cast<vk::DeviceSize>(allocatedSize), static_cast<AllocationError>(AllocationError::NO_ERROR));
 
-			result.value = memoryTypeIndex;
 			return result;
 		}
 
-		inline SkResult<vk::MemoryType, AllocationError> getMemoryType()
+		/*Returns the memory the transient images would have taken without aliasing*/
+		inline SkResult<vk::DeviceSize, AllocationError> getUnaliasedSize()
 		{
-			SkResult result(static_cast<vk::MemoryType>(vk::MemoryType{}), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			SkResult result(static_cast<vk::DeviceSize>(unaliasedSize), static_cast<AllocationError>(AllocationError::NO_ERROR));
 
-			result.value = memoryType;
 			return result;
 		}
 
-		inline SkResult<uint32_t, AllocationError> getId()
+		inline SkResult<uint32_t, AllocationError> getNumberOfPools()
 		{
-			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			SkResult result(static_cast<uint32_t>(memoryPools.size()), static_cast<AllocationError>(AllocationError::NO_ERROR));
 
-			result.value = id;
 			return result;
 		}
 
-		inline SkResult<MemoryBlock*, AllocationError> getBlockById(uint32_t blockId)
+		inline SkResult<MemoryPool*, AllocationError> getPoolById(uint32_t poolId)
 		{
-			SkResult result(static_cast<MemoryBlock*>(nullptr), static_cast<AllocationError>(AllocationError::NO_ERROR));
-
-			bool found = false;
-			MemoryBlock* pMemoryBlock = nullptr;
-			for (uint32_t i = 0; i < memoryBlocks.size(); i++)
-			{
-				uint32_t currentBlockId = retLog(memoryBlocks[i]->getId());
-				if (currentBlockId == blockId)
-				{
-					pMemoryBlock = memoryBlocks[i];
-					found = true;
-				}
-			}
+			SkResult result(static_cast<MemoryPool*>(nullptr), static_cast<AllocationError>(AllocationError::NO_ERROR));
 
-			if (!found)
+			//Pool ids are their indices (see createMemoryPool())
+			if (poolId < memoryPools.size())
 			{
-				result.error = AllocationError::UNDEFINED_ERROR;
+				result.value = memoryPools[poolId];
 			}
 
-			result.value = std::move(pMemoryBlock);
-			return result;
-		}
-
-		inline SkResult<uint32_t, AllocationError> getNumberOfBlocks()
-		{
-			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
-
-			result.value = static_cast<uint32_t>(memoryBlocks.size());
 			return result;
 		}
 
-		inline SkResult<bool, AllocationError> freeMemoryBlocks()
+		/*@brief Returns the memory an image of the last allocateBind() is bound to
+		*
+		* @param image The index of the image in the images given to allocateBind()
+		*
+		* @return SkResult(pool and block ids of the memory of the image, AllocationError)
+		*/
+		inline SkResult<Pair<uint32_t, uint32_t>, AllocationError> getImageAllocation(const uint32_t image)
 		{
-			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			SkResult result(static_cast<Pair<uint32_t, uint32_t>>(Pair(std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint32_t>::max())), static_cast<AllocationError>(AllocationError::NO_ERROR));
 
-			for (uint32_t i = 0; i < memoryBlocks.size(); i++)
+			if (image >= imageAllocations.size() || imageAllocations[image].a == std::numeric_limits<uint32_t>::max())
 			{
-				delete memoryBlocks[i];
+				result.error = AllocationError::INVALID_TRANSIENT_IMAGE_ERROR;
+				return result;
 			}
 
+			result.value = imageAllocations[image];
 			return result;
 		}
 
-		inline SkResult<bool, AllocationError> freeMemory()
+		/*Frees the memory of every pool, the images bound to it being destroyed beforehand*/
+		inline SkResult<bool, AllocationError> freeAllMemory()
 		{
 			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
 
-			try
-			{
-				device.freeMemory(memory);
-			}
-			catch (vk::SystemError error)
+			for (uint32_t i = 0; i < memoryPools.size(); i++)
 			{
-				result.value = false;
-				result.error = AllocationError::UNDEFINED_ERROR;
+				result.error = affectError(memoryPools[i]->freeMemory(), result.error);
+				memoryPools[i]->freeMemoryBlocks();
+
+				delete memoryPools[i];
 			}
 
+			memoryPools.clear();
+			imageAllocations.clear();
+			allocatedSize = 0;
+			unaliasedSize = 0;
+
+			result.value = (result.error == AllocationError::NO_ERROR);
 			return result;
 		}
 
 	private:
-		vk::Device device;
-
-		uint32_t id;
-
-		std::vector<MemoryBlock*> memoryBlocks = {};
-		uint64_t gapSize = 1;
-
-		MemoryPoolSize   memorySize;
-		uint64_t         occupiedMemory;
-		vk::DeviceMemory memory;
+		vk::PhysicalDevice physicalDevice;
+		vk::Device         device;
 
-		vk::MemoryType memoryType;
-		uint32_t memoryTypeIndex;
-	};
+		std::vector<MemoryPool*> memoryPools = {};
 
-	/*A very basic/barebone memory allocator, should be used as a singleton.
-	It contains pools and pools contain blocks. Pools hold on to device memory and subdivides it into smaller sections contained in blocks*/
-	class MemoryAllocator
-	{
-	public:
-		MemoryAllocator(vk::PhysicalDevice physDevice, vk::Device logicDevice)
-			: physicalDevice(physDevice),
-			device(logicDevice)
-		{
+		//Pool and block ids of the images of the last allocateBind(), by index
+		std::vector<Pair<uint32_t, uint32_t>> imageAllocations = {};
 
-		}
+		vk::DeviceSize allocatedSize = 0;
+		vk::DeviceSize unaliasedSize = 0;
 
-		inline SkResult<Pair<uint32_t, uint32_t>, AllocationError> allocateBind(vk::Buffer& buffer, vk::Flags<vk::MemoryPropertyFlagBits> memoryPropertyFlags)
+		inline SkResult<MemoryPool*, AllocationError> createMemoryPool(const vk::DeviceSize size, const uint32_t memoryTypeIndex, const vk::Flags<vk::MemoryPropertyFlagBits> memoryPropertyFlags)
 		{
-			SkResult result(static_cast<Pair<uint32_t, uint32_t>>(Pair(std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint32_t>::max())), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			SkResult result(static_cast<MemoryPool*>(nullptr), static_cast<AllocationError>(AllocationError::NO_ERROR));
 
-			uint32_t createdPoolId = std::numeric_limits<uint32_t>::max();
-			uint32_t createdBlockId = std::numeric_limits<uint32_t>::max();
+			vk::MemoryAllocateInfo memoryAllocateInfo = {};
+			memoryAllocateInfo.allocationSize = size;
+			memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
 
-			MemoryPool* currentPool = nullptr;
-			if (memoryPools.size() > 0)
+			vk::DeviceMemory poolMemory;
+			try
 			{
-				auto getSuitablePoolIdsResult = getSuitablePoolIds(buffer, memoryPropertyFlags);
-				std::vector<uint32_t> suitablePoolIds = retLog(getSuitablePoolIdsResult);
-
-				if (suitablePoolIds.size() > 0)
-				{
-					//@TODO Somehow prefer one pool over another
-					uint32_t memoryPoolId = suitablePoolIds[0];
-					auto getPoolIdResult = getPoolById(memoryPoolId);
-					currentPool = retLog(getPoolIdResult);
-
-				}
-				else
-				{
-					result.error = AllocationError::UNDEFINED_ERROR;
-				}
-
+				poolMemory = device.allocateMemory(memoryAllocateInfo);
 			}
-			else
+			catch (vk::SystemError err)
 			{
-				auto getAppropriateBufferSizeResult = getAppropriateMemorySize(buffer, true);
-				MemorySize appropriatePoolSize = retLog(getAppropriateBufferSizeResult);
-
-				auto createMemoryPoolResult = createMemoryPool(static_cast<MemoryPoolSize>(appropriatePoolSize), buffer, memoryPropertyFlags);
-				uint32_t memoryPoolId = retLog(createMemoryPoolResult);
-
-				auto getPoolIdResult = getPoolById(memoryPoolId);
-				currentPool = retLog(getPoolIdResult);
+				result.error = AllocationError::MEMORY_ALLOCATION_ERROR;
+				return result;
 			}
 
-			auto getAppropriateMemorySizeResult = getAppropriateMemorySize(buffer, false);
-			MemorySize appropriateMemorySize = retLog(getAppropriateMemorySizeResult);
-
-			auto createMemoryBlockResult = currentPool->createMemoryBlock(static_cast<MemoryBlockSize>(appropriateMemorySize), buffer);
-			uint32_t memoryBlockId = retLog(createMemoryBlockResult);
-
-			auto getBlockByIdResult = currentPool->getBlockById(memoryBlockId);
-			MemoryBlock* block = retLog(getBlockByIdResult);
-
-			auto bindResult = currentPool->bind(block, buffer);
-			bool binded = retLog(bindResult);
+			vk::MemoryType poolMemoryType = {};
+			poolMemoryType.heapIndex = retLog(getHeapIndexByTypeIndex(physicalDevice, memoryTypeIndex));
+			poolMemoryType.propertyFlags = memoryPropertyFlags;
 
-			createdPoolId = retLog(currentPool->getId());
-			createdBlockId = memoryBlockId;
+			const uint32_t poolId = static_cast<uint32_t>(memoryPools.size());
+			MemoryPool* pool = new MemoryPool(device, static_cast<MemoryPoolSize>(size), poolId, std::move(poolMemory), poolMemoryType, memoryTypeIndex);
+			memoryPools.emplace_back(pool);
 
-			result.value = std::move(Pair(createdPoolId, createdBlockId));
+			result.value = pool;
 			return result;
 		}
+	};
+
+	/*Render targets*/
+
+	/*@brief Orders the image views of the framebuffers of a render pass created by createRenderTargetRenderPass() : color, depth (if any), resolve (if multisampled)
+	*
+	* @param swapchainImageViews The image views of the swapchain images, one framebuffer being created per view
+	* @param colorImageView The view of the multisampled color image, null without MSAA
+	* @param depthImageView The view of the depth/stencil image, null without depth
+	*
+	* @return SkResult(attachments of every framebuffer, to be given to createFramebuffers(), RenderTargetError)
+	*/
+	inline SkResult<std::vector<std::vector<vk::ImageView>>, RenderTargetError> getRenderTargetFramebufferAttachments(const std::vector<vk::ImageView>& swapchainImageViews,
+		const vk::ImageView& colorImageView, const vk::ImageView& depthImageView)
+	{
+		SkResult result(static_cast<std::vector<std::vector<vk::ImageView>>>(std::vector<std::vector<vk::ImageView>>()), static_cast<RenderTargetError>(RenderTargetError::NO_ERROR));
 
-		inline SkResult<MemoryPool*, AllocationError> getPoolById(uint32_t poolId)
+		result.value.reserve(swapchainImageViews.size());
+		for (const vk::ImageView& swapchainImageView : swapchainImageViews)
 		{
-			SkResult result(static_cast<MemoryPool*>(nullptr), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			std::vector<vk::ImageView> attachments = { (colorImageView ? colorImageView : swapchainImageView) };
 
-			MemoryPool* memoryPool = nullptr;
-			for (uint32_t i = 0; i < memoryPools.size(); i++)
+			if (depthImageView)
 			{
-				auto getPoolIdResult = memoryPools[i]->getId();
-				uint32_t currPoolId = retLog(getPoolIdResult);
+				attachments.push_back(depthImageView);
+			}
 
-				if (currPoolId == poolId)
-				{
-					memoryPool = memoryPools[i];
-				}
+			//Multisampled color is resolved into the swapchain image
+			if (colorImageView)
+			{
+				attachments.push_back(swapchainImageView);
 			}
 
-			result.value = std::move(memoryPool);
-			return result;
+			result.value.push_back(std::move(attachments));
 		}
 
-		inline SkResult<uint32_t, AllocationError> getNumberOfPools()
+		return result;
+	}
+
+	/*Depth/stencil and multisampled color images of a render pass created by createRenderTargetRenderPass(), shared by every swapchain image.
+	* Both are transient attachments (never stored, the color being resolved on tile) and go to lazily allocated memory when the device has some.
+	* Images are recreated by create() on resize, destroy() giving their memory back to the allocator.
+	* Not thread safe, images live until destroy()*/
+	class RenderTargets
+	{
+	public:
+		RenderTargets(vk::PhysicalDevice physDevice, vk::Device logicDevice, MemoryAllocator& memoryAllocator)
+			: physicalDevice(physDevice),
+			device(logicDevice),
+			allocator(memoryAllocator)
 		{
-			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
 
-			result.value = static_cast<uint32_t>(memoryPools.size());
-			return result;
 		}
 
-		inline SkResult<bool, AllocationError> freeMemoryPools()
+		RenderTargets(const RenderTargets&) = delete;
+		RenderTargets& operator=(const RenderTargets&) = delete;
+
+		/*@brief Creates the render targets, destroying the previous ones
+		*
+		* @param colorFormat The format of the swapchain images
+		* @param depthFormat The format of the depth/stencil image (see getSupportedDepthFormat()), undefined for none
+		* @param sampleCount The sample count of the color and depth images (see getMaxUsableSampleCount()), 1 for no MSAA
+		* @param extent The extent of the swapchain images
+		*
+		* @return SkResult(bool signaling if the operation worked(1) or not(0), RenderTargetError)
+		*/
+		inline SkResult<bool, RenderTargetError> create(const vk::Format colorFormat, const vk::Format depthFormat, const vk::SampleCountFlagBits sampleCount, const vk::Extent2D& extent)
 		{
-			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			SkResult result(static_cast<bool>(true), static_cast<RenderTargetError>(RenderTargetError::NO_ERROR));
 
-			for (uint32_t i = 0; i < memoryPools.size(); i++)
+			result.error = affectError(destroy(), result.error);
+
+			const vk::PhysicalDeviceLimits limits = physicalDevice.getProperties().limits;
+			if (getHighestSampleCount(limits.framebufferColorSampleCounts & limits.framebufferDepthSampleCounts, sampleCount) != sampleCount)
 			{
-				delete memoryPools[i];
+				result.value = false;
+				result.error = RenderTargetError::UNSUPPORTED_SAMPLE_COUNT_ERROR;
+				return result;
+			}
+
+			samples = sampleCount;
+			format = depthFormat;
+
+			if (samples != vk::SampleCountFlagBits::e1)
+			{
+				result.error = affectError(createImage(colorFormat, extent, vk::ImageUsageFlagBits::eColorAttachment, vk::ImageAspectFlagBits::eColor, colorImage, colorImageView,
+					colorAllocation), result.error);
 			}
 
+			if (depthFormat != vk::Format::eUndefined)
+			{
+				result.error = affectError(createImage(depthFormat, extent, vk::ImageUsageFlagBits::eDepthStencilAttachment, getFormatAspect(depthFormat), depthImage, depthImageView,
+					depthAllocation), result.error);
+			}
+
+			result.value = (result.error == RenderTargetError::NO_ERROR);
 			return result;
 		}
 
-		inline SkResult<bool, AllocationError> freeAllMemory()
+		/*@brief Returns the attachments of the framebuffers of the render pass, one framebuffer per swapchain image
+		*
+		* @param swapchainImageViews The image views of the swapchain images
+		*
+		* @return SkResult(attachments of every framebuffer, to be given to createFramebuffers(), RenderTargetError)
+		*/
+		inline SkResult<std::vector<std::vector<vk::ImageView>>, RenderTargetError> getFramebufferAttachments(const std::vector<vk::ImageView>& swapchainImageViews) const
 		{
-			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			return getRenderTargetFramebufferAttachments(swapchainImageViews, colorImageView, depthImageView);
+		}
 
-			for (uint32_t i = 0; i < memoryPools.size(); i++)
+		/*@brief Returns the clear values of the attachments of the render pass, indexed as getFramebufferAttachments()
+		*
+		* @param colorClearValue The clear value of the color attachment
+		*
+		* @return SkResult(clear values, to be given to beginRenderPass(), RenderTargetError)
+		*/
+		inline SkResult<std::vector<vk::ClearValue>, RenderTargetError> getClearValues(const vk::ClearValue& colorClearValue) const
+		{
+			SkResult result(static_cast<std::vector<vk::ClearValue>>(std::vector<vk::ClearValue>()), static_cast<RenderTargetError>(RenderTargetError::NO_ERROR));
+
+			result.value.push_back(colorClearValue);
+
+			if (depthImageView)
 			{
-				memoryPools[i]->freeMemory();
-				memoryPools[i]->freeMemoryBlocks();
+				vk::ClearValue depthClearValue = {};
+				depthClearValue.depthStencil = vk::ClearDepthStencilValue(1.0f, 0);
+				result.value.push_back(depthClearValue);
 			}
 
-			bool memoryPoolsFreed = retLog(freeMemoryPools());
-			if (!memoryPoolsFreed)
+			//The resolve attachment is not cleared, its clear value being ignored
+			if (colorImageView)
 			{
-				result.value = false;
+				result.value.push_back(colorClearValue);
 			}
 
 			return result;
 		}
-	private:
-		vk::PhysicalDevice physicalDevice;
-		vk::Device         device;
 
-		std::vector<MemoryPool*> memoryPools = {};
-
-		//Create pool : Allocate memory
-		inline SkResult<uint32_t, AllocationError> createMemoryPool(MemoryPoolSize poolSize, vk::Buffer buffer, vk::Flags<vk::MemoryPropertyFlagBits> memoryPropertyFlags)
+		inline vk::SampleCountFlagBits getSamples() const
 		{
-			SkResult result(static_cast<uint32_t>(std::numeric_limits<uint32_t>::max()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			return samples;
+		}
 
-			vk::MemoryRequirements memoryRequirements = device.getBufferMemoryRequirements(buffer);
+		inline vk::Format getDepthFormat() const
+		{
+			return format;
+		}
 
-			auto getMemoryTypeIndexResult = getMemoryTypeIndex(physicalDevice, memoryRequirements.memoryTypeBits, memoryPropertyFlags);
-			uint32_t memoryTypeIndex = retLog(getMemoryTypeIndexResult);
+		/*@brief Destroys the images and image views of the render targets and frees their memory
+		*
+		* @return SkResult(bool signaling if the operation worked(1) or not(0), RenderTargetError)
+		*/
+		inline SkResult<bool, RenderTargetError> destroy()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<RenderTargetError>(RenderTargetError::NO_ERROR));
 
-			vk::MemoryAllocateInfo memoryAllocateInfo = {};
-			memoryAllocateInfo.allocationSize = static_cast<uint64_t>(poolSize);
-			memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
+			try
+			{
+				if (colorImageView)
+				{
+					device.destroyImageView(colorImageView);
+				}
 
-			vk::DeviceMemory poolMemory = device.allocateMemory(memoryAllocateInfo);
+				if (colorImage)
+				{
+					device.destroyImage(colorImage);
+				}
 
-			uint32_t poolId;
-			if (memoryPools.size() > 0)
-			{
-				auto getLastPoolIdResult = memoryPools[memoryPools.size() - 1]->getId();
-				uint32_t lastPoolId = retLog(getLastPoolIdResult);
+				if (depthImageView)
+				{
+					device.destroyImageView(depthImageView);
+				}
 
-				poolId = lastPoolId++;
+				if (depthImage)
+				{
+					device.destroyImage(depthImage);
+				}
 			}
-			else
+			catch (vk::SystemError err)
 			{
-				poolId = 0;
+				result.value = false;
+				result.error = RenderTargetError::IMAGE_DESTRUCTION_ERROR;
 			}
 
-			auto getHeapIndexByTypeIndexResult = getHeapIndexByTypeIndex(physicalDevice, memoryTypeIndex);
-			uint32_t poolHeapIndex = retLog(getHeapIndexByTypeIndexResult);
+			colorImage = nullptr;
+			colorImageView = nullptr;
+			depthImage = nullptr;
+			depthImageView = nullptr;
 
-			vk::MemoryType poolMemoryType = {};
-			poolMemoryType.heapIndex = poolHeapIndex;
-			poolMemoryType.propertyFlags = memoryPropertyFlags;
+			for (Pair<uint32_t, uint32_t>* pAllocation : { &colorAllocation, &depthAllocation })
+			{
+				if (pAllocation->a != std::numeric_limits<uint32_t>::max() && error(allocator.free(*pAllocation)))
+				{
+					result.value = false;
+					result.error = RenderTargetError::IMAGE_DESTRUCTION_ERROR;
+				}
 
-			MemoryPool* pool = new MemoryPool(device, poolSize, poolId, std::move(poolMemory), poolMemoryType, memoryTypeIndex);
-			memoryPools.emplace_back(pool);
+				*pAllocation = Pair(std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint32_t>::max());
+			}
 
-			result.value = std::move(poolId);
 			return result;
 		}
 
-		inline SkResult<bool, AllocationError> isASuitablePool(MemoryPool* pool, vk::Buffer buffer, vk::Flags<vk::MemoryPropertyFlagBits> memoryPropertyFlags)
-		{
-			SkResult result(static_cast<bool>(true), static_cast<AllocationError>(AllocationError::NO_ERROR));
+	private:
+		vk::PhysicalDevice physicalDevice;
+		vk::Device         device;
+		MemoryAllocator&   allocator;
 
-			vk::MemoryRequirements memoryRequirements = device.getBufferMemoryRequirements(buffer);
+		vk::SampleCountFlagBits samples = vk::SampleCountFlagBits::e1;
+		vk::Format              format = vk::Format::eUndefined;
 
-			auto getFreePoolMemoryResult = pool->getFreeMemory();
-			uint64_t freePoolMemory = retLog(getFreePoolMemoryResult);
+		vk::Image     colorImage = nullptr;
+		vk::ImageView colorImageView = nullptr;
+		vk::Image     depthImage = nullptr;
+		vk::ImageView depthImageView = nullptr;
+
+		//Pool and block ids of the memory of the images, freed by destroy()
+		Pair<uint32_t, uint32_t> colorAllocation = Pair(std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint32_t>::max());
+		Pair<uint32_t, uint32_t> depthAllocation = Pair(std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint32_t>::max());
+
+		inline SkResult<bool, RenderTargetError> createImage(const vk::Format imageFormat, const vk::Extent2D& extent, const vk::ImageUsageFlags usage, const vk::ImageAspectFlags aspect,
+			vk::Image& image, vk::ImageView& imageView, Pair<uint32_t, uint32_t>& allocation)
+		{
+			SkResult result(static_cast<bool>(true), static_cast<RenderTargetError>(RenderTargetError::NO_ERROR));
+
+			vk::ImageCreateInfo imageCreateInfo = {};
+			imageCreateInfo.imageType = vk::ImageType::e2D;
+			imageCreateInfo.format = imageFormat;
+			imageCreateInfo.extent = vk::Extent3D(extent.width, extent.height, 1);
+			imageCreateInfo.mipLevels = 1;
+			imageCreateInfo.arrayLayers = 1;
+			imageCreateInfo.samples = samples;
+			imageCreateInfo.tiling = vk::ImageTiling::eOptimal;
+			imageCreateInfo.usage = usage | vk::ImageUsageFlagBits::eTransientAttachment;
+			imageCreateInfo.sharingMode = vk::SharingMode::eExclusive;
+			imageCreateInfo.initialLayout = vk::ImageLayout::eUndefined;
 
-			if (static_cast<uint64_t>(memoryRequirements.size) > freePoolMemory)
+			try
+			{
+				image = device.createImage(imageCreateInfo);
+			}
+			catch (vk::SystemError err)
 			{
 				result.value = false;
+				result.error = RenderTargetError::IMAGE_CREATION_ERROR;
+				return result;
 			}
 
-			auto getMemoryTypeIndexResult = getMemoryTypeIndex(physicalDevice, memoryRequirements.memoryTypeBits, memoryPropertyFlags);
-			uint32_t memoryTypeIndex = retLog(getMemoryTypeIndexResult);
-
-			auto getPoolMemoryTypeIndex = pool->getMemoryTypeIndex();
-			uint32_t poolMemoryTypeIndex = retLog(getPoolMemoryTypeIndex);
+			//Never stored, the image only needs backing memory on GPUs that do not render on tile
+			const vk::MemoryRequirements memoryRequirements = device.getImageMemoryRequirements(image);
+			vk::Flags<vk::MemoryPropertyFlagBits> memoryPropertyFlags = vk::MemoryPropertyFlagBits::eDeviceLocal | vk::MemoryPropertyFlagBits::eLazilyAllocated;
+			if (error(getMemoryTypeIndex(physicalDevice, memoryRequirements.memoryTypeBits, memoryPropertyFlags)))
+			{
+				memoryPropertyFlags = vk::MemoryPropertyFlagBits::eDeviceLocal;
+			}
 
-			if (memoryTypeIndex != poolMemoryTypeIndex)
+			auto allocateBindResult = allocator.allocateBind(image, memoryPropertyFlags);
+			if (error(allocateBindResult))
 			{
 				result.value = false;
+				result.error = RenderTargetError::IMAGE_ALLOCATION_ERROR;
+				return result;
 			}
+			allocation = allocateBindResult.value;
 
-			auto getPoolMemoryType = pool->getMemoryType();
-			vk::MemoryType poolMemoryType = retLog(getPoolMemoryType);
+			vk::ImageViewCreateInfo imageViewCreateInfo = {};
+			imageViewCreateInfo.image = image;
+			imageViewCreateInfo.viewType = vk::ImageViewType::e2D;
+			imageViewCreateInfo.format = imageFormat;
+			imageViewCreateInfo.subresourceRange.aspectMask = aspect;
+			imageViewCreateInfo.subresourceRange.baseMipLevel = 0;
+			imageViewCreateInfo.subresourceRange.levelCount = 1;
+			imageViewCreateInfo.subresourceRange.baseArrayLayer = 0;
+			imageViewCreateInfo.subresourceRange.layerCount = 1;
 
-			if (poolMemoryType.propertyFlags != memoryPropertyFlags)
+			try
+			{
+				imageView = device.createImageView(imageViewCreateInfo);
+			}
+			catch (vk::SystemError err)
 			{
 				result.value = false;
+				result.error = RenderTargetError::IMAGE_VIEW_CREATION_ERROR;
 			}
 
 			return result;
 		}
+	};
+
+	/*Buffer*/
+
+	/*@brief Creates a vertex buffer given a vector of vertices
+	*
+	* @param device The vulkan device used to create the vertex buffer
+	* @param vertices The vector of vertices = content of the buffer
+	* @param sharingMode The vulkan sharing mode to be used for the buffer (concurrent vs explicit)
+	*
+	* @return SkResult(created vertex buffer, BufferError)
+	*/
+	inline SkResult<vk::Buffer, BufferError> createVertexBuffer(const vk::Device& device, const std::vector<Vertex>& vertices, const vk::SharingMode& sharingMode)
+	{
+		SkResult result(static_cast<vk::Buffer>(vk::Buffer(nullptr)), static_cast<BufferError>(BufferError::NO_ERROR));
+
+		vk::BufferCreateInfo bufferCreateInfo = {};
+		bufferCreateInfo.size = vertices.size() * sizeof(Vertex);
+		bufferCreateInfo.usage = vk::BufferUsageFlagBits::eVertexBuffer;
+		bufferCreateInfo.sharingMode = sharingMode;
 
-		inline SkResult<std::vector<uint32_t>, AllocationError> getSuitablePoolIds(vk::Buffer buffer, vk::Flags<vk::MemoryPropertyFlagBits> memoryPropertyFlags)
+		vk::Buffer buffer;
+		try
 		{
-			SkResult result(static_cast<std::vector<uint32_t>>(std::vector<uint32_t>()), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			buffer = device.createBuffer(bufferCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = BufferError::BUFFER_CREATION_ERROR;
+		}
 
-			std::vector<uint32_t> poolIds = {};
-			for (uint32_t i = 0; i < memoryPools.size(); i++)
-			{
-				auto isASuitablePoolResult = isASuitablePool(memoryPools[i], buffer, memoryPropertyFlags);
-				bool isSuitable = retLog(isASuitablePoolResult);
+		result.value = std::move(buffer);
+		return result;
+	}
 
-				if (isSuitable)
-				{
-					auto getPoolIdResult = memoryPools[i]->getId();
-					uint32_t poolId = retLog(getPoolIdResult);
+	/*@brief Creates a mesh buffer given a Mesh
+	*
+	* @param device The vulkan device used to create the mesh buffer
+	* @param mesh The content of the buffer
+	* @param sharingMode The vulkan sharing mode to be used for the buffer (concurrent vs explicit)
+	*
+	* @return SkResult(created mesh buffer, BufferError)
+	*/
+	inline SkResult<vk::Buffer, BufferError> createMeshBuffer(const vk::Device& device, const Mesh& mesh, const vk::SharingMode& sharingMode)
+	{
+		SkResult result(static_cast<vk::Buffer>(vk::Buffer(nullptr)), static_cast<BufferError>(BufferError::NO_ERROR));
 
-					poolIds.emplace_back(poolId);
-				}
-			}
+		std::vector<Vertex> meshVertices = mesh.vertices;
 
-			result.value = std::move(poolIds);
-			return result;
-		}
+		vk::BufferCreateInfo bufferCreateInfo = {};
+		bufferCreateInfo.size = meshVertices.size() * sizeof(Vertex);
+		bufferCreateInfo.usage = vk::BufferUsageFlagBits::eVertexBuffer;
+		bufferCreateInfo.sharingMode = sharingMode;
 
-		inline SkResult<MemorySize, AllocationError> getAppropriateMemorySize(vk::Buffer buffer, bool isForPool)
+		vk::Buffer buffer;
+		try
 		{
-			SkResult result(static_cast<MemorySize>(MemorySize::ZERO), static_cast<AllocationError>(AllocationError::NO_ERROR));
+			buffer = device.createBuffer(bufferCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = BufferError::BUFFER_CREATION_ERROR;
+		}
 
-			vk::MemoryRequirements memoryRequirements = device.getBufferMemoryRequirements(buffer);
+		result.value = std::move(buffer);
+		return result;
+	}
 
-			uint32_t i = 0;
-			while (memoryRequirements.size > pow(2, i))
-			{
-				i++;
-			}
+	/*@brief Creates an index buffer able to hold the indices of a given mesh, using the index type of the mesh (see Mesh::getIndexType())
+	*
+	* @param device The vulkan device used to create the index buffer
+	* @param mesh The indexed mesh (Mesh or CompactMesh) whose indices will be held by the buffer
+	* @param sharingMode The vulkan sharing mode to be used for the buffer (concurrent vs explicit)
+	*
+	* @return SkResult(created index buffer, BufferError)
+	*/
+	template<typename MeshT>
+	inline SkResult<vk::Buffer, BufferError> createIndexBuffer(const vk::Device& device, const MeshT& mesh, const vk::SharingMode& sharingMode)
+	{
+		SkResult result(static_cast<vk::Buffer>(vk::Buffer(nullptr)), static_cast<BufferError>(BufferError::NO_ERROR));
 
-			MemorySize appropriatePoolSize;
-			if (isForPool)
-			{
-				appropriatePoolSize = static_cast<MemorySize>(pow(2, i) * 8);
-			}
-			else
+		vk::BufferCreateInfo bufferCreateInfo = {};
+		bufferCreateInfo.size = mesh.getIndexBufferSize();
+		bufferCreateInfo.usage = vk::BufferUsageFlagBits::eIndexBuffer;
+		bufferCreateInfo.sharingMode = sharingMode;
+
+		vk::Buffer buffer;
+		try
+		{
+			buffer = device.createBuffer(bufferCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			result.error = BufferError::BUFFER_CREATION_ERROR;
+		}
+
+		result.value = std::move(buffer);
+		return result;
+	}
+
+	/*@brief Writes the indices of a given mesh into mapped memory, narrowing them to uint16_t when the mesh uses 16 bits indices
+	*
+	* @param mesh The indexed mesh (Mesh or CompactMesh) whose indices are written
+	* @param pData Pointer to mapped memory of at least mesh.getIndexBufferSize() bytes
+	*
+	* @return SkResult(bool signaling if the operation worked(1) or not(0), BufferError)
+	*/
+	template<typename MeshT>
+	inline SkResult<bool, BufferError> writeIndices(const MeshT& mesh, void* pData)
+	{
+		SkResult result(static_cast<bool>(true), static_cast<BufferError>(BufferError::NO_ERROR));
+
+		if (mesh.getIndexType() == vk::IndexType::eUint16)
+		{
+			uint16_t* pIndices = static_cast<uint16_t*>(pData);
+			for (size_t i = 0; i < mesh.indices.size(); i++)
 			{
-				appropriatePoolSize = static_cast<MemorySize>(pow(2, i));
+				pIndices[i] = static_cast<uint16_t>(mesh.indices[i]);
 			}
-
-			result.value = std::move(appropriatePoolSize);
-			return result;
 		}
-	};
+		else
+		{
+			std::memcpy(pData, mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+		}
 
-	/*Buffer*/
+		return result;
+	}
 
-	/*@brief Creates a vertex buffer given a vector of vertices
+	/*@brief Creates an instance buffer able to hold maxInstanceCount InstanceData, read as a per instance vertex stream
 	*
-	* @param device The vulkan device used to create the vertex buffer
-	* @param vertices The vector of vertices = content of the buffer
+	* @param device The vulkan device used to create the instance buffer
+	* @param maxInstanceCount The number of instances the buffer can hold
 	* @param sharingMode The vulkan sharing mode to be used for the buffer (concurrent vs explicit)
 	*
-	* @return SkResult(created vertex buffer, BufferError)
+	* @return SkResult(created instance buffer, BufferError)
 	*/
-	inline SkResult<vk::Buffer, BufferError> createVertexBuffer(const vk::Device& device, const std::vector<Vertex>& vertices, const vk::SharingMode& sharingMode)
+	inline SkResult<vk::Buffer, BufferError> createInstanceBuffer(const vk::Device& device, const uint32_t maxInstanceCount, const vk::SharingMode& sharingMode)
 	{
 		SkResult result(static_cast<vk::Buffer>(vk::Buffer(nullptr)), static_cast<BufferError>(BufferError::NO_ERROR));
 
 		vk::BufferCreateInfo bufferCreateInfo = {};
-		bufferCreateInfo.size = vertices.size() * sizeof(Vertex);
+		bufferCreateInfo.size = static_cast<vk::DeviceSize>(maxInstanceCount) * sizeof(InstanceData);
 		bufferCreateInfo.usage = vk::BufferUsageFlagBits::eVertexBuffer;
 		bufferCreateInfo.sharingMode = sharingMode;
 
@@ -5060,23 +19219,22 @@ namespace SOULKAN_NAMESPACE
 		return result;
 	}
 
-	/*@brief Creates a mesh buffer given a Mesh
+	/*@brief Creates a buffer of a given size and usage
 	*
-	* @param device The vulkan device used to create the mesh buffer
-	* @param mesh The content of the buffer
+	* @param device The vulkan device used to create the buffer
+	* @param size The size of the buffer in bytes
+	* @param usage The vulkan buffer usage flags of the buffer
 	* @param sharingMode The vulkan sharing mode to be used for the buffer (concurrent vs explicit)
 	*
-	* @return SkResult(created mesh buffer, BufferError)
+	* @return SkResult(created buffer, BufferError)
 	*/
-	inline SkResult<vk::Buffer, BufferError> createMeshBuffer(const vk::Device& device, const Mesh& mesh, const vk::SharingMode& sharingMode)
+	inline SkResult<vk::Buffer, BufferError> createBuffer(const vk::Device& device, const vk::DeviceSize size, const vk::BufferUsageFlags usage, const vk::SharingMode& sharingMode)
 	{
 		SkResult result(static_cast<vk::Buffer>(vk::Buffer(nullptr)), static_cast<BufferError>(BufferError::NO_ERROR));
 
-		std::vector<Vertex> meshVertices = mesh.vertices;
-
 		vk::BufferCreateInfo bufferCreateInfo = {};
-		bufferCreateInfo.size = meshVertices.size() * sizeof(Vertex);
-		bufferCreateInfo.usage = vk::BufferUsageFlagBits::eVertexBuffer;
+		bufferCreateInfo.size = size;
+		bufferCreateInfo.usage = usage;
 		bufferCreateInfo.sharingMode = sharingMode;
 
 		vk::Buffer buffer;
@@ -5093,6 +19251,96 @@ namespace SOULKAN_NAMESPACE
 		return result;
 	}
 
+	/*@brief Creates a buffer holding maxDrawCount indexed indirect draw commands, written by a compute shader and read by drawIndexedIndirectCount
+	*
+	* @param device The vulkan device used to create the buffer
+	* @param maxDrawCount The maximum number of draw commands the buffer can hold
+	* @param sharingMode The vulkan sharing mode to be used for the buffer (concurrent vs explicit)
+	*
+	* @return SkResult(created indirect command buffer, BufferError)
+	*/
+	inline SkResult<vk::Buffer, BufferError> createIndirectCommandBuffer(const vk::Device& device, const uint32_t maxDrawCount, const vk::SharingMode& sharingMode)
+	{
+		return createBuffer(device, static_cast<vk::DeviceSize>(maxDrawCount) * sizeof(vk::DrawIndexedIndirectCommand),
+			vk::BufferUsageFlagBits::eIndirectBuffer | vk::BufferUsageFlagBits::eStorageBuffer, sharingMode);
+	}
+
+	/*@brief Creates a buffer holding a single uint32_t draw count, reset with a fill and incremented by a compute shader
+	*
+	* @param device The vulkan device used to create the buffer
+	* @param sharingMode The vulkan sharing mode to be used for the buffer (concurrent vs explicit)
+	*
+	* @return SkResult(created draw count buffer, BufferError)
+	*/
+	inline SkResult<vk::Buffer, BufferError> createDrawCountBuffer(const vk::Device& device, const vk::SharingMode& sharingMode)
+	{
+		return createBuffer(device, sizeof(uint32_t),
+			vk::BufferUsageFlagBits::eIndirectBuffer | vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferDst, sharingMode);
+	}
+
+	/*@brief Copies the GPU ready data of a mesh file straight from its mapping into mapped staging memory (a single memcpy, nothing is parsed)
+	* and records the copies from the staging buffer to the vertex, index and meshlet buffers, followed by the barrier making them visible to draws.
+	* Destination buffers need the eTransferDst usage, the staging buffer the eTransferSrc usage
+	*
+	* @param commandBuffer The vulkan command buffer receiving the copies
+	* @param meshFile The view over the mapped mesh file (see readMeshFile())
+	* @param pStagingData Pointer to mapped memory of the staging buffer, of at least meshFile.getDataSize() bytes
+	* @param stagingBuffer The vulkan buffer whose memory is pointed to by pStagingData
+	* @param vertexBuffer The vulkan buffer receiving the vertices, of at least meshFile.getVertexDataSize() bytes
+	* @param indexBuffer The vulkan buffer receiving the indices, of at least meshFile.getIndexDataSize() bytes
+	* @param meshletBuffer The vulkan buffer receiving the meshlets (skipped if null or if the file holds no meshlet)
+	*/
+	inline void recordMeshFileUpload(const vk::CommandBuffer& commandBuffer, const MeshFileView& meshFile, void* pStagingData, const vk::Buffer& stagingBuffer,
+		const vk::Buffer& vertexBuffer, const vk::Buffer& indexBuffer, const vk::Buffer& meshletBuffer = vk::Buffer(nullptr))
+	{
+		const vk::DeviceSize dataOffset = meshFile.getDataOffset();
+		std::memcpy(pStagingData, meshFile.pFileData + dataOffset, static_cast<size_t>(meshFile.getDataSize()));
+
+		//The staging buffer holds the file from its first section on, so file offsets only need to be shifted
+		vk::BufferCopy vertexCopy = {};
+		vertexCopy.srcOffset = meshFile.pHeader->vertices.offset - dataOffset;
+		vertexCopy.dstOffset = 0;
+		vertexCopy.size = meshFile.getVertexDataSize();
+
+		vk::BufferCopy indexCopy = {};
+		indexCopy.srcOffset = meshFile.pHeader->indices.offset - dataOffset;
+		indexCopy.dstOffset = 0;
+		indexCopy.size = meshFile.getIndexDataSize();
+
+		vk::AccessFlags dstAccessMask = vk::AccessFlagBits::eVertexAttributeRead | vk::AccessFlagBits::eIndexRead;
+		vk::PipelineStageFlags dstStageMask = vk::PipelineStageFlagBits::eVertexInput;
+
+		if (vertexCopy.size > 0)
+		{
+			commandBuffer.copyBuffer(stagingBuffer, vertexBuffer, vertexCopy);
+		}
+
+		if (indexCopy.size > 0)
+		{
+			commandBuffer.copyBuffer(stagingBuffer, indexBuffer, indexCopy);
+		}
+
+		if (meshletBuffer && meshFile.getMeshletDataSize() > 0)
+		{
+			vk::BufferCopy meshletCopy = {};
+			meshletCopy.srcOffset = meshFile.pHeader->meshlets.offset - dataOffset;
+			meshletCopy.dstOffset = 0;
+			meshletCopy.size = meshFile.getMeshletDataSize();
+
+			commandBuffer.copyBuffer(stagingBuffer, meshletBuffer, meshletCopy);
+
+			//Meshlets are read by the culling compute shader (see recordMeshletCulling())
+			dstAccessMask |= vk::AccessFlagBits::eShaderRead;
+			dstStageMask |= vk::PipelineStageFlagBits::eComputeShader;
+		}
+
+		vk::MemoryBarrier uploadBarrier = {};
+		uploadBarrier.srcAccessMask = vk::AccessFlagBits::eTransferWrite;
+		uploadBarrier.dstAccessMask = dstAccessMask;
+
+		commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, dstStageMask, vk::DependencyFlags(), uploadBarrier, nullptr, nullptr);
+	}
+
 	/*@brief Destroys a given buffer
 	*
 	* @param device The vulka device used to destroy the buffer
@@ -5117,6 +19365,351 @@ namespace SOULKAN_NAMESPACE
 		return result;
 	}
 
+	/*PER DRAW DATA*/
+
+	/*Data of a single draw, pushed as push constants (see recordDrawPushConstants()) or written into a UniformRingBuffer and read through a
+	* dynamic offset. model follows the layout of Mat4 (model[column][row]), materialIndex selects the material of the draw (bindless index...)*/
+	struct DrawData
+	{
+		DrawData()
+			: model({ { {1.0f, 0.0f, 0.0f, 0.0f},
+			            {0.0f, 1.0f, 0.0f, 0.0f},
+			            {0.0f, 0.0f, 1.0f, 0.0f},
+			            {0.0f, 0.0f, 0.0f, 1.0f} } }),
+			materialIndex(0), padding{ 0, 0, 0 }
+		{}
+
+		DrawData(const SOULKAN_MATHS_NAMESPACE::Mat4& modelMatrix, const uint32_t material)
+			: model(modelMatrix.matrix), materialIndex(material), padding{ 0, 0, 0 }
+		{}
+
+		std::array<std::array<float, 4>, 4> model;
+		uint32_t materialIndex;
+
+		//std140 rounds the block up to a multiple of 16 bytes
+		uint32_t padding[3];
+	};
+
+	//128 bytes of push constants are guaranteed by every vulkan implementation
+	static_assert(sizeof(DrawData) == 80 && sizeof(DrawData) <= 128, "DrawData must match the DrawUniforms block of shaders/draw_data_mesh.vert");
+
+	/*@brief Returns the push constant range holding the DrawData of a draw
+	*
+	* @param stageFlags The vulkan shader stages reading the data (default is vertex)
+	*
+	* @return The vulkan push constant range
+	*/
+	inline vk::PushConstantRange getDrawPushConstantRange(const vk::ShaderStageFlags stageFlags = vk::ShaderStageFlagBits::eVertex)
+	{
+		vk::PushConstantRange pushConstantRange = {};
+		pushConstantRange.stageFlags = stageFlags;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = sizeof(DrawData);
+
+		return pushConstantRange;
+	}
+
+	/*@brief Records the data of the next draw as push constants, the cheapest path for small per draw data
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands
+	* @param pipelineLayout The vulkan pipeline layout holding the range given by getDrawPushConstantRange()
+	* @param stageFlags The vulkan shader stages of the range
+	* @param drawData The data of the draw
+	*/
+	inline void recordDrawPushConstants(const vk::CommandBuffer& commandBuffer, const vk::PipelineLayout& pipelineLayout, const vk::ShaderStageFlags stageFlags, const DrawData& drawData)
+	{
+		commandBuffer.pushConstants(pipelineLayout, stageFlags, 0, sizeof(DrawData), &drawData);
+	}
+
+	/*@brief Records the bind of a descriptor set holding one dynamic uniform buffer, the set staying the same for the whole frame and
+	* only the offset changing between draws
+	*
+	* @param commandBuffer The vulkan command buffer receiving the commands
+	* @param pipelineBindPoint The vulkan pipeline bind point (graphics or compute)
+	* @param pipelineLayout The vulkan pipeline layout of the bound pipeline
+	* @param set The set number of the descriptor set in the pipeline layout
+	* @param descriptorSet The vulkan descriptor set whose dynamic uniform buffer points to a UniformRingBuffer
+	* @param dynamicOffset The offset of the data of the draw, given by UniformRingBuffer::push()
+	*/
+	inline void recordDynamicOffsetBind(const vk::CommandBuffer& commandBuffer, const vk::PipelineBindPoint pipelineBindPoint, const vk::PipelineLayout& pipelineLayout, const uint32_t set,
+		const vk::DescriptorSet& descriptorSet, const uint32_t dynamicOffset)
+	{
+		commandBuffer.bindDescriptorSets(pipelineBindPoint, pipelineLayout, set, descriptorSet, dynamicOffset);
+	}
+
+	/*@brief Returns true if every offset into a buffer can be given as a dynamic offset, which vulkan takes as 32 bits
+	*
+	* @param bufferSize The size of the buffer in bytes
+	*
+	* @return Boolean indicating if the buffer is at most 4 GiB(true) or not(false)
+	*/
+	inline bool isDynamicOffsetRange(const vk::DeviceSize bufferSize)
+	{
+		return (bufferSize <= static_cast<vk::DeviceSize>(std::numeric_limits<uint32_t>::max()) + 1);
+	}
+
+	/*Offsets into a buffer split in one region per frame in flight, allocations of a frame being bumped linearly in its region and aligned
+	* (to minUniformBufferOffsetAlignment for dynamic uniform buffers). A region is only reused when its frame starts again, so data is never
+	* overwritten while the GPU reads it. Not thread safe*/
+	class FrameRingAllocator
+	{
+	public:
+		FrameRingAllocator(const vk::DeviceSize regionSize = 0, const uint32_t framesInFlight = 2, const vk::DeviceSize offsetAlignment = 1)
+			: alignment(std::max<vk::DeviceSize>(offsetAlignment, 1)), frameCount(std::max(framesInFlight, 1u))
+		{
+			frameSize = retLog(getAlignedOffset(alignment, regionSize));
+		}
+
+		/*@brief Starts a frame in flight, its region being empty again. To be called once the fence of the frame signaled
+		*
+		* @param frameIndex The index of the frame in flight
+		*/
+		inline void beginFrame(const uint32_t frameIndex)
+		{
+			currentFrame = frameIndex % frameCount;
+			head = 0;
+		}
+
+		/*@brief Allocates a given number of bytes in the region of the current frame
+		*
+		* @param size The number of bytes
+		*
+		* @return SkResult(aligned offset from the start of the buffer, BufferError)
+		*/
+		inline SkResult<vk::DeviceSize, BufferError> allocate(const vk::DeviceSize size)
+		{
+			SkResult result(static_cast<vk::DeviceSize>(0), static_cast<BufferError>(BufferError::NO_ERROR));
+
+			const vk::DeviceSize offset = retLog(getAlignedOffset(alignment, head));
+			if (offset + size > frameSize)
+			{
+				result.error = BufferError::RING_BUFFER_FULL_ERROR;
+				return result;
+			}
+
+			head = offset + size;
+
+			result.value = static_cast<vk::DeviceSize>(currentFrame) * frameSize + offset;
+			return result;
+		}
+
+		/*Returns the number of bytes used in the region of the current frame, padding included*/
+		inline vk::DeviceSize getFrameUsage() const
+		{
+			return head;
+		}
+
+		/*Returns the size of the region of a frame, rounded up to the alignment*/
+		inline vk::DeviceSize getFrameSize() const
+		{
+			return frameSize;
+		}
+
+		/*Returns the size of the whole buffer, every region included*/
+		inline vk::DeviceSize getBufferSize() const
+		{
+			return frameSize * frameCount;
+		}
+
+	private:
+		vk::DeviceSize alignment;
+		vk::DeviceSize frameSize = 0;
+		uint32_t frameCount;
+
+		uint32_t currentFrame = 0;
+		vk::DeviceSize head = 0;
+	};
+
+	/*Host visible uniform buffer persistently mapped and sub-allocated per frame in flight with a FrameRingAllocator, delivering per draw data
+	* through a single descriptor set with a dynamic uniform buffer : the set is bound once per frame and every draw only changes its dynamic
+	* offset (see recordDynamicOffsetBind()). Offsets respect minUniformBufferOffsetAlignment, and the buffer is at most 4 GiB since dynamic offsets
+	* are 32 bits. Not thread safe, the buffer lives until destroy()*/
+	class UniformRingBuffer
+	{
+	public:
+		UniformRingBuffer(vk::PhysicalDevice physDevice, vk::Device logicDevice, const vk::DeviceSize frameSize, const uint32_t framesInFlight = 2)
+			: physicalDevice(physDevice), device(logicDevice), requestedFrameSize(frameSize), frameCount(std::max(framesInFlight, 1u))
+		{
+
+		}
+
+		UniformRingBuffer(const UniformRingBuffer&) = delete;
+		UniformRingBuffer& operator=(const UniformRingBuffer&) = delete;
+
+		/*@brief Creates the buffer and its host visible, host coherent memory, then maps it for the lifetime of the ring
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), BufferError), RING_BUFFER_TOO_LARGE_ERROR if the regions of
+		* the frames take more than 4 GiB
+		*/
+		inline SkResult<bool, BufferError> create()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<BufferError>(BufferError::NO_ERROR));
+
+			const vk::DeviceSize offsetAlignment = physicalDevice.getProperties().limits.minUniformBufferOffsetAlignment;
+			ringAllocator = FrameRingAllocator(requestedFrameSize, frameCount, offsetAlignment);
+
+			//Every offset returned by push() must fit in a dynamic offset
+			if (!isDynamicOffsetRange(ringAllocator.getBufferSize()))
+			{
+				result.value = false;
+				result.error = BufferError::RING_BUFFER_TOO_LARGE_ERROR;
+				return result;
+			}
+
+			auto createBufferResult = createBuffer(device, ringAllocator.getBufferSize(), vk::BufferUsageFlagBits::eUniformBuffer, vk::SharingMode::eExclusive);
+			if (error(createBufferResult))
+			{
+				result.value = false;
+				result.error = createBufferResult.error;
+				return result;
+			}
+
+			buffer = createBufferResult.value;
+
+			const vk::MemoryRequirements memoryRequirements = device.getBufferMemoryRequirements(buffer);
+
+			//Coherent memory, writes need no flush before the submission
+			auto getMemoryTypeIndexResult = getMemoryTypeIndex(physicalDevice, memoryRequirements.memoryTypeBits,
+				vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent);
+			if (error(getMemoryTypeIndexResult))
+			{
+				result.value = false;
+				result.error = BufferError::BUFFER_MEMORY_ERROR;
+				return result;
+			}
+
+			vk::MemoryAllocateInfo memoryAllocateInfo = {};
+			memoryAllocateInfo.allocationSize = memoryRequirements.size;
+			memoryAllocateInfo.memoryTypeIndex = getMemoryTypeIndexResult.value;
+
+			try
+			{
+				memory = device.allocateMemory(memoryAllocateInfo);
+				device.bindBufferMemory(buffer, memory, 0);
+				pMappedData = static_cast<uint8_t*>(device.mapMemory(memory, 0, VK_WHOLE_SIZE));
+			}
+			catch (vk::SystemError err)
+			{
+				result.value = false;
+				result.error = BufferError::BUFFER_MEMORY_ERROR;
+			}
+
+			return result;
+		}
+
+		/*@brief Starts a frame in flight, its region being reused. To be called once the fence of the frame signaled
+		*
+		* @param frameIndex The index of the frame in flight
+		*/
+		inline void beginFrame(const uint32_t frameIndex)
+		{
+			ringAllocator.beginFrame(frameIndex);
+		}
+
+		/*@brief Copies the data of a draw into the region of the current frame
+		*
+		* @param data The data of the draw, laid out as the uniform block reading it (std140)
+		*
+		* @return SkResult(dynamic offset of the data, BufferError), the offset fitting in 32 bits since create() rejects larger rings
+		*/
+		template<typename T>
+		inline SkResult<uint32_t, BufferError> push(const T& data)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Data pushed into a uniform buffer must be trivially copyable");
+
+			SkResult result(static_cast<uint32_t>(0), static_cast<BufferError>(BufferError::NO_ERROR));
+
+			auto allocateResult = ringAllocator.allocate(sizeof(T));
+			if (error(allocateResult) || pMappedData == nullptr)
+			{
+				result.error = (error(allocateResult) ? allocateResult.error : BufferError::BUFFER_MEMORY_ERROR);
+				return result;
+			}
+
+			std::memcpy(pMappedData + allocateResult.value, &data, sizeof(T));
+
+			result.value = static_cast<uint32_t>(allocateResult.value);
+			return result;
+		}
+
+		/*@brief Returns the binding pointing a dynamic uniform buffer of a descriptor set to the ring, written once (see writeDescriptorSet())
+		*
+		* @param binding The binding of the descriptor set
+		* @param range The size of the data of a draw, sizeof(DrawData) usually
+		*
+		* @return The descriptor binding
+		*/
+		inline DescriptorBinding getDescriptorBinding(const uint32_t binding, const vk::DeviceSize range) const
+		{
+			DescriptorBinding descriptorBinding = {};
+			descriptorBinding.binding = binding;
+			descriptorBinding.descriptorType = vk::DescriptorType::eUniformBufferDynamic;
+			descriptorBinding.buffer = buffer;
+			descriptorBinding.offset = 0;
+			descriptorBinding.range = range;
+
+			return descriptorBinding;
+		}
+
+		/*Returns the vulkan buffer of the ring*/
+		inline vk::Buffer getBuffer() const
+		{
+			return buffer;
+		}
+
+		/*Returns the number of bytes used by the current frame*/
+		inline vk::DeviceSize getFrameUsage() const
+		{
+			return ringAllocator.getFrameUsage();
+		}
+
+		/*@brief Unmaps and frees the memory and destroys the buffer
+		*
+		* @return SkResult(bool indicating if the operation worked(true) or not(false), BufferError)
+		*/
+		inline SkResult<bool, BufferError> destroy()
+		{
+			SkResult result(static_cast<bool>(true), static_cast<BufferError>(BufferError::NO_ERROR));
+
+			if (buffer)
+			{
+				result.error = affectError(destroyBuffer(device, buffer), result.error);
+				buffer = vk::Buffer(nullptr);
+			}
+
+			if (memory)
+			{
+				try
+				{
+					device.unmapMemory(memory);
+					device.freeMemory(memory);
+				}
+				catch (vk::SystemError err)
+				{
+					result.error = BufferError::BUFFER_MEMORY_ERROR;
+				}
+
+				memory = vk::DeviceMemory(nullptr);
+				pMappedData = nullptr;
+			}
+
+			result.value = (result.error == BufferError::NO_ERROR);
+			return result;
+		}
+
+	private:
+		vk::PhysicalDevice physicalDevice;
+		vk::Device device;
+
+		vk::DeviceSize requestedFrameSize;
+		uint32_t frameCount;
+		FrameRingAllocator ringAllocator;
+
+		vk::Buffer buffer = vk::Buffer(nullptr);
+		vk::DeviceMemory memory = vk::DeviceMemory(nullptr);
+		uint8_t* pMappedData = nullptr;
+	};
+
 	/*@brief Creates a basic triangle mesh
 	*
 	*
@@ -5147,11 +19740,13 @@ namespace SOULKAN_NAMESPACE
 
 		vertices.emplace_back(pos2, normal2, color2);
 
-		result.value = std::move(Mesh(vertices));
+		std::vector<uint32_t> indices = { 0, 1, 2 };
+
+		result.value = std::move(Mesh(vertices, indices));
 		return result;
 	}
 
-	/*@brief Creates a basic heart mesh
+	/*@brief Creates a basic indexed heart mesh, 4 triangles sharing 6 vertices
 	*
 	*
 	* @return SkResult(created Mesh, MeshError)
@@ -5164,80 +19759,35 @@ namespace SOULKAN_NAMESPACE
 		SOULKAN_MATHS_NAMESPACE::Vec3 pos0(0.0f, 0.5f, 0.0f);
 		SOULKAN_MATHS_NAMESPACE::Vec3 pos1(0.5f, 1.0f, 0.0f);
 		SOULKAN_MATHS_NAMESPACE::Vec3 pos2(1.0f, 0.5f, 0.0f);
+		SOULKAN_MATHS_NAMESPACE::Vec3 pos3(0.0f, -1.0f, 0.0f);
+		SOULKAN_MATHS_NAMESPACE::Vec3 pos4(-1.0f, 0.5f, 0.0f);
+		SOULKAN_MATHS_NAMESPACE::Vec3 pos5(-0.5f, 1.0f, 0.0f);
 
-		SOULKAN_MATHS_NAMESPACE::Vec3 pos3(0.0f, 0.5f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 pos4(1.0f, 0.5f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 pos5(0.0f, -1.0f, 0.0f);
-
-		SOULKAN_MATHS_NAMESPACE::Vec3 pos6(-1.0f, 0.5f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 pos7(0.0f, 0.5f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 pos8(0.0f, -1.0f, 0.0f);
-
-		SOULKAN_MATHS_NAMESPACE::Vec3 pos9(-1.0f, 0.5f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 pos10(-0.5f, 1.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 pos11(0.0f, 0.5f, 0.0f);
-
-
-		SOULKAN_MATHS_NAMESPACE::Vec3 normal0(0.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 normal1(0.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 normal2(0.0f, 0.0f, 0.0f);
-
-		SOULKAN_MATHS_NAMESPACE::Vec3 normal3(0.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 normal4(0.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 normal5(0.0f, 0.0f, 0.0f);
-
-		SOULKAN_MATHS_NAMESPACE::Vec3 normal6(0.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 normal7(0.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 normal8(0.0f, 0.0f, 0.0f);
+		SOULKAN_MATHS_NAMESPACE::Vec3 normal(0.0f, 0.0f, 0.0f);
 
-		SOULKAN_MATHS_NAMESPACE::Vec3 normal9(0.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 normal10(0.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 normal11(0.0f, 0.0f, 0.0f);
-
-		SOULKAN_MATHS_NAMESPACE::Vec3 color0(1.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 color1(1.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 color2(1.0f, 0.0f, 0.0f);
-
-		SOULKAN_MATHS_NAMESPACE::Vec3 color3(1.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 color4(1.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 color5(1.0f, 0.0f, 0.0f);
-
-		SOULKAN_MATHS_NAMESPACE::Vec3 color6(1.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 color7(1.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 color8(1.0f, 0.0f, 0.0f);
-
-		SOULKAN_MATHS_NAMESPACE::Vec3 color9(1.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 color10(1.0f, 0.0f, 0.0f);
-		SOULKAN_MATHS_NAMESPACE::Vec3 color11(1.0f, 0.0f, 0.0f);
+		SOULKAN_MATHS_NAMESPACE::Vec3 color(1.0f, 0.0f, 0.0f);
 
 		std::vector<Vertex> vertices;
-		vertices.reserve(12); // A basic heart mesh contains 12 vertices
-
-		vertices.emplace_back(pos0, normal0, color0);
-
-		vertices.emplace_back(pos1, normal1, color1);
+		vertices.reserve(6); // A basic heart mesh contains 6 unique vertices
 
-		vertices.emplace_back(pos2, normal2, color2);
-
-		vertices.emplace_back(pos3, normal3, color3);
-
-		vertices.emplace_back(pos4, normal4, color4);
-
-		vertices.emplace_back(pos5, normal5, color5);
+		vertices.emplace_back(pos0, normal, color);
 
-		vertices.emplace_back(pos6, normal6, color6);
+		vertices.emplace_back(pos1, normal, color);
 
-		vertices.emplace_back(pos7, normal7, color7);
+		vertices.emplace_back(pos2, normal, color);
 
-		vertices.emplace_back(pos8, normal8, color8);
+		vertices.emplace_back(pos3, normal, color);
 
-		vertices.emplace_back(pos9, normal9, color9);
+		vertices.emplace_back(pos4, normal, color);
 
-		vertices.emplace_back(pos10, normal10, color10);
+		vertices.emplace_back(pos5, normal, color);
 
-		vertices.emplace_back(pos11, normal11, color11);
+		std::vector<uint32_t> indices = { 0, 1, 2,    // Right lobe
+		                                  0, 2, 3,    // Right half of the point
+		                                  4, 0, 3,    // Left half of the point
+		                                  4, 5, 0 };  // Left lobe
 
-		result.value = std::move(Mesh(vertices));
+		result.value = std::move(Mesh(vertices, indices));
 		return result;
 	}
 
@@ -5339,9 +19889,9 @@ namespace SOULKAN_NAMESPACE
 			mInstance = createInstanceResult.value;
 		}
 
-		Instance(const std::string_view engineName, const std::string_view appName, const std::vector<const char*>& extensions, const std::vector<const char*>& validationLayers)
+		Instance(const std::string_view engineName, const std::string_view appName, const std::vector<const char*>& extensions, const std::vector<const char*>& validationLayers, const uint32_t apiVersion = VK_API_VERSION_1_0)
 		{
-			auto createInstanceResult = createInstance(std::string(engineName).c_str(), std::string(appName).c_str(), extensions, validationLayers);
+			auto createInstanceResult = createInstance(std::string(engineName).c_str(), std::string(appName).c_str(), extensions, validationLayers, nullptr, apiVersion);
 			mError = affectError(createInstanceResult, mError);
 
 			mInstance = createInstanceResult.value;
@@ -5415,7 +19965,7 @@ namespace SOULKAN_NAMESPACE
 		}
 
 		Device createDevice(const std::array<uint32_t, 6>& queueFamilyIndexes, const std::vector<const char*>& extensions);
-		Device createDevice(const std::array<uint32_t, 6>& queueFamilyIndexes, const std::vector<const char*>& extensions, const vk::PhysicalDeviceFeatures& physicalDeviceFeatures);
+		Device createDevice(const std::array<uint32_t, 6>& queueFamilyIndexes, const std::vector<const char*>& extensions, const vk::PhysicalDeviceFeatures& physicalDeviceFeatures, const void* pNextFeatures = nullptr);
 
 		vk::PresentModeKHR getAppropriatePresentMode(const vk::SurfaceKHR& surface, const vk::PresentModeKHR& chosenPresentMode)
 		{
@@ -5480,15 +20030,18 @@ namespace SOULKAN_NAMESPACE
 			mError = affectError(createDeviceResult, mError);
 
 			mDevice = retLog(createDeviceResult);
+			mGeneralQueueCount = getComputeQueueIndex(physicalDevice.get(), queueFamilyIndexes) + 1;
 		}
 
-		Device(const PhysicalDevice& physicalDevice, const std::array<uint32_t, 6>& queueFamilyIndexes, const std::vector<const char*>& extensions, const vk::PhysicalDeviceFeatures& physicalDeviceFeatures)
+		Device(const PhysicalDevice& physicalDevice, const std::array<uint32_t, 6>& queueFamilyIndexes, const std::vector<const char*>& extensions, const vk::PhysicalDeviceFeatures& physicalDeviceFeatures,
+			   const void* pNextFeatures = nullptr)
 			: mPhysicalDevice(physicalDevice)
 		{
-			auto createDeviceResult = createDevice(physicalDevice.get(), queueFamilyIndexes, extensions, physicalDeviceFeatures);
+			auto createDeviceResult = createDevice(physicalDevice.get(), queueFamilyIndexes, extensions, physicalDeviceFeatures, std::numeric_limits<uint32_t>::max(), pNextFeatures);
 			mError = affectError(createDeviceResult, mError);
 
 			mDevice = retLog(createDeviceResult);
+			mGeneralQueueCount = getComputeQueueIndex(physicalDevice.get(), queueFamilyIndexes) + 1;
 		}
 
 		bool operator==(Device other)
@@ -5506,6 +20059,7 @@ namespace SOULKAN_NAMESPACE
 
 		Queue getQueue(const QueueFamilyType queueFamilyType, const std::array<uint32_t, 6>& queueFamilyIndexes, const uint32_t queueIndex);
 		Queue getQueue(const QueueFamilyType queueFamilyType, const uint32_t queueFamilyIndex, const uint32_t queueIndex);
+		Queue getComputeQueue(const std::array<uint32_t, 6>& queueFamilyIndexes);
 
 		Swapchain createSwapchain(const vk::SwapchainCreateInfoKHR& swapchainCreateInfo);
 		Swapchain createSwapchain(const Window& window, const vk::SurfaceKHR& surface, const vk::PresentModeKHR& presentMode, const vk::SurfaceFormatKHR& surfaceFormat, 
@@ -5537,6 +20091,9 @@ namespace SOULKAN_NAMESPACE
 		vk::Device mDevice = nullptr;
 		PhysicalDevice mPhysicalDevice = PhysicalDevice();
 
+		//Queues created in the general family (see createDevice()), a device wrapping a vk::Device created elsewhere being assumed to hold one
+		uint32_t mGeneralQueueCount = 1;
+
 		DeviceError mError = DeviceError::NO_ERROR;
 	};
 
@@ -5545,9 +20102,9 @@ namespace SOULKAN_NAMESPACE
 		return Device(*this, queueFamilyIndexes, extensions);
 	}
 											    												  								
-	inline Device PhysicalDevice::createDevice(const std::array<uint32_t, 6>& queueFamilyIndexes, const std::vector<const char*>& extensions, const vk::PhysicalDeviceFeatures& physicalDeviceFeatures)
+	inline Device PhysicalDevice::createDevice(const std::array<uint32_t, 6>& queueFamilyIndexes, const std::vector<const char*>& extensions, const vk::PhysicalDeviceFeatures& physicalDeviceFeatures, const void* pNextFeatures)
 	{
-		return Device(*this, queueFamilyIndexes, extensions, physicalDeviceFeatures);
+		return Device(*this, queueFamilyIndexes, extensions, physicalDeviceFeatures, pNextFeatures);
 	}
 
 	class Queue
@@ -5645,6 +20202,13 @@ namespace SOULKAN_NAMESPACE
 		return Queue(queue, *this, queueFamilyType, queueFamilyIndex, queueIndex);
 	}
 
+	inline Queue Device::getComputeQueue(const std::array<uint32_t, 6>& queueFamilyIndexes)
+	{
+		//Never asks for a queue the device was not created with
+		uint32_t queueIndex = std::min(getComputeQueueIndex(mPhysicalDevice.get(), queueFamilyIndexes), mGeneralQueueCount - 1);
+		return getQueue(getComputeQueueFamilyType(queueFamilyIndexes), queueFamilyIndexes, queueIndex);
+	}
+
 	class Swapchain
 	{
 	public:
@@ -0,0 +1,39 @@
+#version 450
+#extension GL_EXT_nonuniform_qualifier : require
+
+//Bindless arrays (see sk::BindlessDescriptorSet), every resource of the renderer reached through its index
+layout (set = 0, binding = 0) uniform texture2D textures[];
+layout (set = 0, binding = 2) uniform sampler samplers[];
+
+//Per draw material data stored in one of the registered storage buffers
+struct Material
+{
+    vec4 baseColor;
+};
+
+layout (set = 0, binding = 1) readonly buffer Materials
+{
+    Material materials[];
+} materialBuffers[];
+
+//Indices of the draw (see sk::BindlessDrawIndices)
+layout (push_constant) uniform DrawIndices
+{
+    uint sampledImageIndex;
+    uint samplerIndex;
+    uint storageBufferIndex;
+    uint instanceIndex;
+} draw;
+
+layout (location = 0) in vec3 inColor;
+layout (location = 1) in vec2 inTexCoord;
+
+layout (location = 0) out vec4 outFragColor;
+
+void main()
+{
+    vec4 texel          = texture(sampler2D(textures[nonuniformEXT(draw.sampledImageIndex)], samplers[nonuniformEXT(draw.samplerIndex)]), inTexCoord);
+    Material material   = materialBuffers[nonuniformEXT(draw.storageBufferIndex)].materials[draw.instanceIndex];
+
+    outFragColor = vec4(inColor, 1.0f) * texel * material.baseColor;
+}
@@ -0,0 +1,34 @@
+#version 450
+
+//Compact vertex input (see sk::CompactVertex), the formats normalize every attribute to floats
+layout (location = 0) in vec4 vecPosition;
+layout (location = 1) in vec2 vecNormal;
+layout (location = 2) in vec4 vecColor;
+
+//Dequantization of the mesh (see sk::VertexQuantization) : position = offset + scale * vecPosition
+layout (push_constant) uniform Dequantization
+{
+    vec4 offset;
+    vec4 scale;
+} dequantization;
+
+//Color going to the fragment shader
+layout (location = 0) out vec3 outColor;
+
+//Inverse of sk::encodeOctahedral
+vec3 decodeOctahedral(vec2 encodedNormal)
+{
+    vec3 normal = vec3(encodedNormal, 1.0f - abs(encodedNormal.x) - abs(encodedNormal.y));
+    float t = max(-normal.z, 0.0f);
+    normal.xy += mix(vec2(t), vec2(-t), greaterThanEqual(normal.xy, vec2(0.0f)));
+    return normalize(normal);
+}
+
+void main()
+{
+    vec3 position = dequantization.offset.xyz + dequantization.scale.xyz * vecPosition.xyz;
+    vec3 normal   = decodeOctahedral(vecNormal);
+
+    gl_Position = vec4(position, 1.0f);
+    outColor    = vecColor.rgb * (0.5f + 0.5f * max(normal.z, 0.0f));
+}
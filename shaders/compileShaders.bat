@@ -1,4 +1,10 @@
 cd %~dp0
 C:\VulkanSDK\1.2.148.0\Bin\glslc.exe triangle_mesh.vert -o triangle_mesh.spv
 C:\VulkanSDK\1.2.148.0\Bin\glslc.exe colored_triangle.frag -o colored_triangle.spv
+C:\VulkanSDK\1.2.148.0\Bin\glslc.exe frustum_culling.comp -o frustum_culling.spv
+C:\VulkanSDK\1.2.148.0\Bin\glslc.exe compact_mesh.vert -o compact_mesh.spv
+C:\VulkanSDK\1.2.148.0\Bin\glslc.exe meshlet_culling.comp -o meshlet_culling.spv
+C:\VulkanSDK\1.2.148.0\Bin\glslc.exe instanced_mesh.vert -o instanced_mesh.spv
+C:\VulkanSDK\1.2.148.0\Bin\glslc.exe bindless_mesh.frag -o bindless_mesh.spv
+C:\VulkanSDK\1.2.148.0\Bin\glslc.exe draw_data_mesh.vert -o draw_data_mesh.spv
 pause
\ No newline at end of file
@@ -0,0 +1,23 @@
+#version 450
+
+//Vertex input
+layout (location = 0) in vec3 vecPosition;
+layout (location = 1) in vec3 vecNormal;
+layout (location = 2) in vec3 vecColor;
+
+//Per draw data (see sk::DrawData), read from a dynamic uniform buffer of a sk::UniformRingBuffer whose offset changes between draws.
+//This shader reads no push constants : data pushed by sk::recordDrawPushConstants() needs the same block declared with layout (push_constant) instead
+layout (set = 0, binding = 0) uniform DrawUniforms
+{
+    mat4 model;
+    uint materialIndex;
+} draw;
+
+//Color going to the fragment shader
+layout (location = 0) out vec3 outColor;
+
+void main()
+{
+    gl_Position = draw.model * vec4(vecPosition, 1.0f);
+    outColor    = vecColor;
+}
@@ -0,0 +1,26 @@
+#version 450
+
+//Vertex stream (binding 0, see sk::Vertex)
+layout (location = 0) in vec3 vecPosition;
+layout (location = 1) in vec3 vecNormal;
+layout (location = 2) in vec3 vecColor;
+
+//Instance stream (binding 1, see sk::InstanceData), the transform takes locations 3 to 6
+layout (location = 3) in mat4 instanceTransform;
+layout (location = 7) in vec4 instanceColor;
+layout (location = 8) in vec4 instanceCustom;
+
+//View projection matrix shared by every instance
+layout (push_constant) uniform Camera
+{
+    mat4 viewProjection;
+} camera;
+
+//Color going to the fragment shader
+layout (location = 0) out vec3 outColor;
+
+void main()
+{
+    gl_Position = camera.viewProjection * instanceTransform * vec4(vecPosition, 1.0f);
+    outColor    = vecColor * instanceColor.rgb;
+}
@@ -2,13 +2,2726 @@
 #define SOULKAN_TESTS_HPP
 #pragma once
 
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
 #include <memory>
+#include <random>
+#include <tuple>
 
 #include "../Soulkan.hpp"
 
 namespace SOULKAN_NAMESPACE
 {
+	/*@brief CPU only test of the frustum culling : planes extracted from a known projection, spheres inside the frustum, outside each plane
+	* and straddling a plane, and descriptor writes into a set that was never allocated
+	*/
+	inline sk::SkResult<bool, sk::TestError> frustumCullingTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*PLANES*/
+		//A 90 degrees square frustum looking toward +z : |x| <= z, |y| <= z and 1 <= z <= 100
+		auto projectionResult = skm::perspectiveProjection(skm::toRad(90.0f), 1.0f, 1.0f, 100.0f);
+		passed = passed && !skm::error(projectionResult);
+
+		auto extractFrustumResult = skm::extractFrustum(projectionResult.value);
+		passed = passed && !skm::error(extractFrustumResult);
+
+		const skm::Frustum& frustum = extractFrustumResult.value;
+		const float halfSqrt2 = std::sqrt(0.5f);
+
+		//Normalized normals pointing inside : left, right, bottom, top, near, far
+		const std::array<skm::Vec4, 6> expectedPlanes = { skm::Vec4(halfSqrt2, 0.0f, halfSqrt2, 0.0f), skm::Vec4(-halfSqrt2, 0.0f, halfSqrt2, 0.0f),
+		                                                  skm::Vec4(0.0f, halfSqrt2, halfSqrt2, 0.0f), skm::Vec4(0.0f, -halfSqrt2, halfSqrt2, 0.0f),
+		                                                  skm::Vec4(0.0f, 0.0f, 1.0f, -1.0f),          skm::Vec4(0.0f, 0.0f, -1.0f, 100.0f) };
+
+		for (size_t i = 0; i < expectedPlanes.size(); i++)
+		{
+			const skm::Vec4& plane = frustum.planes[i];
+			const skm::Vec4& expectedPlane = expectedPlanes[i];
+
+			passed = passed && (std::abs(plane.x - expectedPlane.x) < 1e-5f) && (std::abs(plane.y - expectedPlane.y) < 1e-5f);
+			passed = passed && (std::abs(plane.z - expectedPlane.z) < 1e-5f) && (std::abs(plane.w - expectedPlane.w) < 1e-3f);
+		}
+
+		/*SPHERES*/
+		passed = passed && skm::isSphereInFrustum(frustum, skm::Vec3(0.0f, 0.0f, 50.0f), 1.0f);
+
+		//One sphere past each plane, in plane order
+		const std::array<skm::Vec3, 6> outsideCenters = { skm::Vec3(-60.0f, 0.0f, 50.0f), skm::Vec3(60.0f, 0.0f, 50.0f),
+		                                                  skm::Vec3(0.0f, -60.0f, 50.0f), skm::Vec3(0.0f, 60.0f, 50.0f),
+		                                                  skm::Vec3(0.0f, 0.0f, 0.5f),    skm::Vec3(0.0f, 0.0f, 101.0f) };
+
+		for (const skm::Vec3& center : outsideCenters)
+		{
+			passed = passed && !skm::isSphereInFrustum(frustum, center, 0.25f);
+		}
+
+		//Centers outside, but the spheres reach inside across the left and near planes
+		passed = passed && skm::isSphereInFrustum(frustum, skm::Vec3(-50.5f, 0.0f, 50.0f), 2.0f);
+		passed = passed && skm::isSphereInFrustum(frustum, skm::Vec3(0.0f, 0.0f, 0.5f), 1.0f);
+		passed = passed && skm::isSphereInFrustum(frustum, skm::Vec3(0.0f, 0.0f, 100.5f), 1.0f);
+
+		/*VIEW*/
+		//The world moved 5 units along +x, the camera looking from x = -5
+		skm::Mat4 viewProjection = projectionResult.value;
+		viewProjection *= skm::translation(5.0f, 0.0f, 0.0f);
+
+		auto extractViewFrustumResult = skm::extractFrustum(viewProjection);
+		passed = passed && !skm::error(extractViewFrustumResult);
+		passed = passed && skm::isSphereInFrustum(extractViewFrustumResult.value, skm::Vec3(-50.0f, 0.0f, 50.0f), 1.0f);
+		passed = passed && !skm::isSphereInFrustum(extractViewFrustumResult.value, skm::Vec3(50.0f, 0.0f, 50.0f), 1.0f);
+
+		/*DEGENERATE MATRIX*/
+		passed = passed && (skm::extractFrustum(skm::Mat4(0.0f)).error == skm::MathError::DIVIDING_BY_ZERO_ERROR);
+
+		/*DESCRIPTOR SET*/
+		//Writes into a set that was never allocated are reported instead of reaching the device
+		auto writeResult = sk::writeFrustumCullingDescriptorSet(vk::Device(nullptr), vk::DescriptorSet(nullptr), vk::Buffer(nullptr), vk::Buffer(nullptr), vk::Buffer(nullptr));
+		passed = passed && !writeResult.value && (writeResult.error == sk::DescriptorError::INVALID_DESCRIPTOR_WRITE_ERROR);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::FRUSTUM_CULLING_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the concentration of queue family indexes : repeated, out of order and unknown indexes must give
+	* unique sorted indexes
+	*/
+	inline sk::SkResult<bool, sk::TestError> queueFamilyTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		const uint32_t unknown = std::numeric_limits<uint32_t>::max();
+
+		//Consecutive duplicates and unknown indexes used to be skipped when erased while iterating
+		const std::vector<std::pair<std::array<uint32_t, 6>, std::vector<uint32_t>>> cases = {
+			{ { 2, 0, 2, unknown, unknown, 0 }, { 0, 2 } },
+			{ { 5, 3, 1, 3, 5, 1 },             { 1, 3, 5 } },
+			{ { 1, 1, 1, 0, 0, 0 },             { 0, 1 } },
+			{ { unknown, 4, unknown, 4, 4, 2 }, { 2, 4 } },
+			{ { 0, 0, 0, 0, 0, 0 },             { 0 } }
+		};
+
+		for (const auto& testCase : cases)
+		{
+			auto concentrateResult = sk::concentrateQueueFamilyIndexes(testCase.first);
+			passed = passed && !sk::logError(concentrateResult) && (concentrateResult.value == testCase.second);
+		}
+
+		auto emptyResult = sk::concentrateQueueFamilyIndexes({ unknown, unknown, unknown, unknown, unknown, unknown });
+		passed = passed && (emptyResult.error == sk::QueueError::EMPTY_CONCENTRATED_QUEUE_VECTOR) && emptyResult.value.empty();
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::QUEUE_FAMILY_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Test of the compute queue on a device : the compute queue is one the device was created with, and an exclusive buffer filled
+	* on it is handed to the general queue family by a release and an acquire ordered by a semaphore
+	*
+	* @param skDevice The device the queues are taken from
+	* @param queueFamilyIndexes The queue family indexes the device was created with
+	*/
+	inline sk::SkResult<bool, sk::TestError> queueOwnershipDeviceTest(sk::Device& skDevice, const std::array<uint32_t, 6>& queueFamilyIndexes)
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		vk::Device device = skDevice.get();
+
+		/*QUEUES*/
+		sk::Queue computeQueue = skDevice.getComputeQueue(queueFamilyIndexes);
+		sk::Queue generalQueue = skDevice.getQueue(sk::QueueFamilyType::GENERAL, queueFamilyIndexes, 0);
+
+		bool passed = (skDevice.error() == sk::DeviceError::NO_ERROR) && computeQueue.get() && generalQueue.get();
+
+		const uint32_t computeFamilyIndex = computeQueue.getFamilyIndex();
+		const uint32_t generalFamilyIndex = generalQueue.getFamilyIndex();
+
+		//Barriers are only recorded when the compute queue has its own family
+		const bool transferred = (computeFamilyIndex != generalFamilyIndex);
+
+		/*RESOURCES*/
+		vk::CommandPool computeCommandPool = sk::retLog(sk::createCommandPool(device, queueFamilyIndexes, computeQueue.getFamilyType()));
+		vk::CommandPool generalCommandPool = sk::retLog(sk::createCommandPool(device, queueFamilyIndexes, sk::QueueFamilyType::GENERAL));
+		passed = passed && computeCommandPool && generalCommandPool;
+
+		vk::CommandBuffer computeCommandBuffer = (passed ? sk::retLog(sk::allocateCommandBuffer(device, computeCommandPool)) : vk::CommandBuffer(nullptr));
+		vk::CommandBuffer generalCommandBuffer = (passed ? sk::retLog(sk::allocateCommandBuffer(device, generalCommandPool)) : vk::CommandBuffer(nullptr));
+
+		vk::Semaphore computeFinishedSemaphore = sk::retLog(sk::createSemaphore(device));
+		vk::Fence fence = sk::retLog(sk::createFence(device));
+
+		vk::Buffer buffer = sk::retLog(sk::createBuffer(device, 256, vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferDst, vk::SharingMode::eExclusive));
+		sk::MemoryAllocator allocator(skDevice.getPhysicalDevice().get(), device);
+
+		passed = passed && computeCommandBuffer && generalCommandBuffer && computeFinishedSemaphore && fence && buffer;
+		passed = passed && !sk::logError(allocator.allocateBind(buffer, vk::MemoryPropertyFlagBits::eDeviceLocal));
+
+		if (passed)
+		{
+			/*RELEASE ON THE COMPUTE QUEUE*/
+			passed = !sk::error(sk::beginCommandBuffer(computeCommandBuffer));
+			computeCommandBuffer.fillBuffer(buffer, 0, VK_WHOLE_SIZE, 42);
+
+			auto releaseResult = sk::releaseBufferOwnership(computeCommandBuffer, { buffer }, computeFamilyIndex, generalFamilyIndex, vk::PipelineStageFlagBits::eTransfer,
+				vk::AccessFlagBits::eTransferWrite);
+			passed = passed && !sk::logError(releaseResult) && (releaseResult.value == transferred);
+			passed = passed && !sk::error(sk::endCommandBuffer(computeCommandBuffer));
+			passed = passed && !sk::logError(sk::queueSubmitCompute(computeQueue.get(), computeCommandBuffer, computeFinishedSemaphore));
+
+			/*ACQUIRE ON THE GENERAL QUEUE*/
+			passed = passed && !sk::error(sk::beginCommandBuffer(generalCommandBuffer));
+
+			auto acquireResult = sk::acquireBufferOwnership(generalCommandBuffer, { buffer }, computeFamilyIndex, generalFamilyIndex, vk::PipelineStageFlagBits::eTransfer,
+				vk::AccessFlagBits::eTransferRead);
+			passed = passed && !sk::logError(acquireResult) && (acquireResult.value == transferred);
+			passed = passed && !sk::error(sk::endCommandBuffer(generalCommandBuffer));
+
+			try
+			{
+				if (passed)
+				{
+					device.resetFences(fence);
+					passed = !sk::logError(sk::queueSubmit(generalQueue.get(), { generalCommandBuffer }, { computeFinishedSemaphore }, { vk::PipelineStageFlagBits::eTransfer }, {}, fence));
+					passed = passed && (device.waitForFences(fence, VK_TRUE, std::numeric_limits<uint64_t>::max()) == vk::Result::eSuccess);
+				}
+			}
+			catch (vk::SystemError err)
+			{
+				passed = false;
+			}
+		}
+
+		//The submissions may still be pending when a step failed
+		device.waitIdle();
+
+		if (buffer)
+		{
+			sk::logError(sk::destroyBuffer(device, buffer));
+		}
+
+		sk::logError(allocator.freeAllMemory());
+
+		if (fence)
+		{
+			sk::logError(sk::destroyFence(device, fence));
+		}
+
+		if (computeFinishedSemaphore)
+		{
+			sk::logError(sk::destroySemaphore(device, computeFinishedSemaphore));
+		}
+
+		if (computeCommandPool)
+		{
+			sk::logError(sk::destroyCommandPool(device, computeCommandPool));
+		}
+
+		if (generalCommandPool)
+		{
+			sk::logError(sk::destroyCommandPool(device, generalCommandPool));
+		}
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::QUEUE_FAMILY_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the vertex welding : bitwise identical vertices of triangle lists and indexed meshes are merged and their indices
+	* remapped, vertices differing by a single bit of any attribute are kept apart
+	*/
+	inline sk::SkResult<bool, sk::TestError> vertexWeldingTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		const skm::Vec3 normal(0.0f, 0.0f, 1.0f);
+		const skm::Vec3 white(1.0f, 1.0f, 1.0f);
+
+		const sk::Vertex a(skm::Vec3(0.0f, 0.0f, 0.0f), normal, white);
+		const sk::Vertex b(skm::Vec3(1.0f, 0.0f, 0.0f), normal, white);
+		const sk::Vertex c(skm::Vec3(1.0f, 1.0f, 0.0f), normal, white);
+		const sk::Vertex d(skm::Vec3(0.0f, 1.0f, 0.0f), normal, white);
+
+		/*TRIANGLE LIST*/
+		//A quad as 6 vertices, the repeated corner having a -0.0f coordinate which welds with 0.0f
+		sk::Mesh quad;
+		quad.vertices = { a, b, c, sk::Vertex(skm::Vec3(0.0f, -0.0f, 0.0f), normal, white), c, d };
+
+		auto weldQuadResult = sk::weldVertices(quad);
+		passed = passed && !sk::logError(weldQuadResult);
+
+		const sk::Mesh& weldedQuad = weldQuadResult.value;
+		passed = passed && (weldedQuad.vertices.size() == 4) && (weldedQuad.indices == std::vector<uint32_t>({ 0, 1, 2, 0, 2, 3 }));
+		passed = passed && (weldedQuad.vertices[3].position.x == 0.0f) && (weldedQuad.vertices[3].position.y == 1.0f);
+
+		/*NEAR DUPLICATES*/
+		//Welding is exact : a vertex one ulp away or with another color stays a vertex of its own
+		sk::Vertex nearC = c;
+		nearC.position.x = std::nextafter(1.0f, 2.0f);
+
+		sk::Vertex coloredA = a;
+		coloredA.color.z = 0.0f;
+
+		sk::Mesh nearMesh;
+		nearMesh.vertices = { a, b, c, a, nearC, coloredA };
+
+		auto weldNearResult = sk::weldVertices(nearMesh);
+		passed = passed && !sk::logError(weldNearResult);
+		passed = passed && (weldNearResult.value.vertices.size() == 5) && (weldNearResult.value.indices == std::vector<uint32_t>({ 0, 1, 2, 0, 3, 4 }));
+
+		/*INDEXED MESH*/
+		//Two copies of a and b referred to by both triangles, the vertices coming out in order of first use
+		sk::Mesh indexedMesh;
+		indexedMesh.vertices = { a, b, c, b, a };
+		indexedMesh.indices = { 2, 1, 0, 4, 3, 2 };
+
+		auto weldIndexedResult = sk::weldVertices(indexedMesh);
+		passed = passed && !sk::logError(weldIndexedResult);
+
+		const sk::Mesh& weldedIndexedMesh = weldIndexedResult.value;
+		passed = passed && (weldedIndexedMesh.vertices.size() == 3) && (weldedIndexedMesh.indices == std::vector<uint32_t>({ 0, 1, 2, 2, 1, 0 }));
+		passed = passed && (weldedIndexedMesh.vertices[0].position.y == 1.0f) && (weldedIndexedMesh.vertices[2].position.x == 0.0f);
+
+		//Every triangle keeps its corners
+		for (size_t i = 0; passed && i < indexedMesh.indices.size(); i++)
+		{
+			const sk::Vertex& source = indexedMesh.vertices[indexedMesh.indices[i]];
+			const sk::Vertex& welded = weldedIndexedMesh.vertices[weldedIndexedMesh.indices[i]];
+			passed = (source.position.x == welded.position.x) && (source.position.y == welded.position.y) && (source.position.z == welded.position.z);
+		}
+
+		/*INVALID INDICES*/
+		indexedMesh.indices.push_back(5);
+		passed = passed && (sk::weldVertices(indexedMesh).error == sk::MeshError::INDEX_OUT_OF_RANGE_ERROR);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::VERTEX_WELDING_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the mesh optimization passes : a grid mesh with shuffled triangles must come out of optimizeMesh()
+	* with the same triangles, a lower ACMR and vertices sorted by first use
+	*/
+	inline sk::SkResult<bool, sk::TestError> meshOptimizationTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		/*GRID MESH*/
+		const uint32_t gridSize = 64;
+
+		sk::Mesh gridMesh;
+		for (uint32_t y = 0; y <= gridSize; y++)
+		{
+			for (uint32_t x = 0; x <= gridSize; x++)
+			{
+				gridMesh.vertices.emplace_back(skm::Vec3(static_cast<float>(x), static_cast<float>(y), 0.0f), skm::Vec3(0.0f, 0.0f, 1.0f), skm::Vec3(1.0f, 1.0f, 1.0f));
+			}
+		}
+
+		std::vector<std::array<uint32_t, 3>> triangles;
+		for (uint32_t y = 0; y < gridSize; y++)
+		{
+			for (uint32_t x = 0; x < gridSize; x++)
+			{
+				uint32_t corner = y * (gridSize + 1) + x;
+				triangles.push_back({ corner, corner + 1, corner + gridSize + 1 });
+				triangles.push_back({ corner + 1, corner + gridSize + 2, corner + gridSize + 1 });
+			}
+		}
+
+		//Worst case input : triangles in random order
+		std::mt19937 randomEngine(42);
+		std::shuffle(triangles.begin(), triangles.end(), randomEngine);
+
+		for (const auto& triangle : triangles)
+		{
+			gridMesh.indices.insert(gridMesh.indices.end(), triangle.begin(), triangle.end());
+		}
+
+		/*OPTIMIZATION*/
+		auto optimizeMeshResult = sk::optimizeMesh(gridMesh);
+		if (sk::logError(optimizeMeshResult))
+		{
+			result.value = false;
+			result.error = sk::TestError::MESH_OPTIMIZATION_ERROR;
+			return result;
+		}
+		const sk::OptimizedMesh& optimizedMesh = optimizeMeshResult.value;
+
+		/*CHECKS*/
+		//Shuffled triangles miss the cache almost every time, the optimized order stays close to the 0.5 ACMR of a regular grid
+		//and transforms most vertices once
+		const sk::VertexCacheStatistics& statisticsBefore = optimizedMesh.statisticsBefore;
+		const sk::VertexCacheStatistics& statisticsAfter = optimizedMesh.statisticsAfter;
+
+		bool passed = (optimizedMesh.mesh.vertices.size() == gridMesh.vertices.size() &&
+		               optimizedMesh.mesh.indices.size() == gridMesh.indices.size() &&
+		               statisticsBefore.acmr > 2.5f && statisticsAfter.acmr >= 0.5f && statisticsAfter.acmr < 1.0f &&
+		               statisticsBefore.atvr > 4.0f && statisticsAfter.atvr >= 1.0f && statisticsAfter.atvr < 1.5f);
+
+		//Same triangles (compared by their positions, with the same winding) before and after optimization
+		auto getTriangleKeys = [](const sk::Mesh& mesh)
+		{
+			std::vector<std::array<float, 6>> keys;
+			for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+			{
+				std::array<skm::Vec3, 3> corners = { mesh.vertices[mesh.indices[i]].position, mesh.vertices[mesh.indices[i + 1]].position, mesh.vertices[mesh.indices[i + 2]].position };
+
+				//Rotates the corners so that the smallest one comes first, which keeps the winding
+				size_t first = 0;
+				for (size_t k = 1; k < 3; k++)
+				{
+					if (std::tie(corners[k].x, corners[k].y) < std::tie(corners[first].x, corners[first].y))
+					{
+						first = k;
+					}
+				}
+
+				keys.push_back({ corners[first].x, corners[first].y, corners[(first + 1) % 3].x, corners[(first + 1) % 3].y, corners[(first + 2) % 3].x, corners[(first + 2) % 3].y });
+			}
+
+			std::sort(keys.begin(), keys.end());
+			return keys;
+		};
+
+		passed = passed && (getTriangleKeys(gridMesh) == getTriangleKeys(optimizedMesh.mesh));
+
+		//Vertices are sorted by first use
+		uint32_t nextVertex = 0;
+		for (const uint32_t index : optimizedMesh.mesh.indices)
+		{
+			if (index > nextVertex)
+			{
+				passed = false;
+			}
+			else if (index == nextVertex)
+			{
+				nextVertex++;
+			}
+		}
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::MESH_OPTIMIZATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the compact vertex formats : half floats, octahedral normals and quantized positions
+	* must round trip within the precision of their format
+	*/
+	inline sk::SkResult<bool, sk::TestError> vertexQuantizationTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*HALF FLOATS*/
+		const std::array<float, 8> halfValues = { 0.0f, -0.0f, 1.0f, -2.5f, 65504.0f, 6.1035156e-05f, 5.9604645e-08f, 0.33325195f };
+		for (const float value : halfValues)
+		{
+			if (skm::halfToFloat(skm::floatToHalf(value)) != value)
+			{
+				passed = false;
+			}
+		}
+
+		//Ties round to even, overflows go to infinity
+		passed = passed && (skm::floatToHalf(1.0f + 1.0f / 2048.0f) == skm::floatToHalf(1.0f));
+		passed = passed && (skm::floatToHalf(1.0e6f) == 0x7C00u);
+
+		/*OCTAHEDRAL NORMALS*/
+		std::mt19937 generator(7);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+		float maxNormalError = 0.0f;
+		for (uint32_t i = 0; i < 10000; i++)
+		{
+			skm::Vec3 direction(distribution(generator), distribution(generator), distribution(generator));
+			float directionLength = skm::length(direction);
+			if (directionLength < 0.01f)
+			{
+				continue;
+			}
+
+			skm::Vec3 normal(direction.x / directionLength, direction.y / directionLength, direction.z / directionLength);
+			skm::Vec3 decodedNormal = skm::decodeOctahedral(skm::encodeOctahedral(normal));
+
+			//Chord length between the normals, equal to the angle between them for small errors
+			float dx = normal.x - decodedNormal.x;
+			float dy = normal.y - decodedNormal.y;
+			float dz = normal.z - decodedNormal.z;
+			maxNormalError = std::max(maxNormalError, std::sqrt(dx * dx + dy * dy + dz * dz));
+		}
+
+		//0.01 degree in radians
+		passed = passed && (maxNormalError < 1.75e-4f);
+
+		/*QUANTIZED POSITIONS*/
+		sk::Mesh mesh;
+		for (uint32_t i = 0; i < 256; i++)
+		{
+			mesh.vertices.emplace_back(skm::Vec3(distribution(generator) * 10.0f + 3.0f, distribution(generator) * 2.0f, distribution(generator) * 0.5f - 7.0f),
+			                           skm::Vec3(0.0f, 1.0f, 0.0f), skm::Vec3(1.0f, 0.5f, 0.0f));
+		}
+
+		auto halfMeshResult = sk::quantizeMesh<sk::HalfPosition>(mesh);
+		auto quantizedMeshResult = sk::quantizeMesh<sk::QuantizedPosition>(mesh);
+		if (halfMeshResult.error != sk::MeshError::NO_ERROR || quantizedMeshResult.error != sk::MeshError::NO_ERROR)
+		{
+			passed = false;
+		}
+		else
+		{
+			const auto& halfMesh = halfMeshResult.value;
+			const auto& quantizedMesh = quantizedMeshResult.value;
+
+			for (size_t i = 0; i < mesh.vertices.size(); i++)
+			{
+				const skm::Vec3& position = mesh.vertices[i].position;
+				const std::array<float, 3> original = { position.x, position.y, position.z };
+
+				skm::Vec3 halfPosition = halfMesh.vertices[i].position.decode();
+				skm::Vec3 quantizedPosition = quantizedMesh.vertices[i].position.decode();
+				const std::array<float, 3> halfDecoded = { halfPosition.x, halfPosition.y, halfPosition.z };
+				const std::array<float, 3> quantizedDecoded = { quantizedPosition.x, quantizedPosition.y, quantizedPosition.z };
+
+				const std::array<float, 3> halfOffset = { halfMesh.dequantization.offset.x, halfMesh.dequantization.offset.y, halfMesh.dequantization.offset.z };
+				const std::array<float, 3> halfScale = { halfMesh.dequantization.scale.x, halfMesh.dequantization.scale.y, halfMesh.dequantization.scale.z };
+				const std::array<float, 3> quantizedOffset = { quantizedMesh.dequantization.offset.x, quantizedMesh.dequantization.offset.y, quantizedMesh.dequantization.offset.z };
+				const std::array<float, 3> quantizedScale = { quantizedMesh.dequantization.scale.x, quantizedMesh.dequantization.scale.y, quantizedMesh.dequantization.scale.z };
+
+				for (size_t axis = 0; axis < 3; axis++)
+				{
+					//Half floats keep 11 significant bits, unorm16 values are uniformly spaced by 1 / 65535
+					float halfError = std::abs(halfOffset[axis] + halfScale[axis] * halfDecoded[axis] - original[axis]);
+					float quantizedError = std::abs(quantizedOffset[axis] + quantizedScale[axis] * quantizedDecoded[axis] - original[axis]);
+
+					if (halfError > halfScale[axis] / 2048.0f + 1e-5f || quantizedError > quantizedScale[axis] / 65535.0f + 1e-5f)
+					{
+						passed = false;
+					}
+				}
+			}
+
+			passed = passed && (quantizedMesh.vertices[0].color[0] == 255 && quantizedMesh.vertices[0].color[1] == 128 && quantizedMesh.vertices[0].color[2] == 0);
+		}
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::VERTEX_QUANTIZATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Creates an indexed UV sphere of radius 1 centered on the origin, the seam and pole vertices being duplicated*/
+	inline sk::Mesh createSphereMesh(const uint32_t rings, const uint32_t segments)
+	{
+		sk::Mesh sphereMesh;
+		for (uint32_t ring = 0; ring <= rings; ring++)
+		{
+			float theta = static_cast<float>(skm::pi) * ring / rings;
+			for (uint32_t segment = 0; segment <= segments; segment++)
+			{
+				float phi = 2.0f * static_cast<float>(skm::pi) * segment / segments;
+				skm::Vec3 position(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+				sphereMesh.vertices.emplace_back(position, position, skm::Vec3(1.0f, 1.0f, 1.0f));
+			}
+		}
+
+		for (uint32_t ring = 0; ring < rings; ring++)
+		{
+			for (uint32_t segment = 0; segment < segments; segment++)
+			{
+				uint32_t corner = ring * (segments + 1) + segment;
+				sphereMesh.indices.insert(sphereMesh.indices.end(), { corner, corner + 1, corner + segments + 1 });
+				sphereMesh.indices.insert(sphereMesh.indices.end(), { corner + 1, corner + segments + 2, corner + segments + 1 });
+			}
+		}
+
+		return sphereMesh;
+	}
+
+	/*@brief CPU only test of the meshlet generation : the meshlets of a sphere must cover every triangle once, respect their limits,
+	* bound their vertices and only be backface culled when all of their triangles face away from the camera
+	*/
+	inline sk::SkResult<bool, sk::TestError> meshletTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		sk::Mesh sphereMesh = createSphereMesh(48, 96);
+
+		const uint32_t maxVertices = 64;
+		const uint32_t maxTriangles = 124;
+
+		auto buildMeshletsResult = sk::buildMeshlets(sphereMesh, maxVertices, maxTriangles);
+		if (sk::logError(buildMeshletsResult))
+		{
+			result.value = false;
+			result.error = sk::TestError::MESHLET_ERROR;
+			return result;
+		}
+
+		const sk::MeshletMesh& meshletMesh = buildMeshletsResult.value;
+		const std::vector<uint32_t>& indices = meshletMesh.mesh.indices;
+
+		bool passed = true;
+
+		//Same triangles, sorted by meshlet
+		auto getSortedTriangles = [](const std::vector<uint32_t>& triangleIndices)
+		{
+			std::vector<std::array<uint32_t, 3>> triangles;
+			for (size_t i = 0; i + 2 < triangleIndices.size(); i += 3)
+			{
+				triangles.push_back({ triangleIndices[i], triangleIndices[i + 1], triangleIndices[i + 2] });
+			}
+
+			std::sort(triangles.begin(), triangles.end());
+			return triangles;
+		};
+
+		passed = passed && (getSortedTriangles(sphereMesh.indices) == getSortedTriangles(indices));
+
+		uint32_t nextIndex = 0;
+		for (const auto& meshlet : meshletMesh.meshlets)
+		{
+			std::vector<uint32_t> meshletVertices(indices.begin() + meshlet.firstIndex, indices.begin() + meshlet.firstIndex + meshlet.indexCount);
+			std::sort(meshletVertices.begin(), meshletVertices.end());
+			meshletVertices.erase(std::unique(meshletVertices.begin(), meshletVertices.end()), meshletVertices.end());
+
+			passed = passed && (meshlet.firstIndex == nextIndex && meshlet.indexCount % 3 == 0);
+			passed = passed && (meshletVertices.size() <= maxVertices && meshlet.indexCount / 3 <= maxTriangles);
+			nextIndex += meshlet.indexCount;
+
+			for (const uint32_t vertex : meshletVertices)
+			{
+				const skm::Vec3& position = meshletMesh.mesh.vertices[vertex].position;
+				skm::Vec3 offset(position.x - meshlet.boundingSphere.x, position.y - meshlet.boundingSphere.y, position.z - meshlet.boundingSphere.z);
+
+				passed = passed && (skm::length(offset) <= meshlet.boundingSphere.w * 1.0001f);
+			}
+		}
+
+		passed = passed && (nextIndex == indices.size());
+
+		/*BACKFACE CULLING*/
+		const std::array<skm::Vec3, 3> cameraPositions = { skm::Vec3(0.0f, 0.0f, 3.0f), skm::Vec3(2.0f, -1.5f, 0.5f), skm::Vec3(0.0f, 10.0f, 0.0f) };
+		for (const auto& cameraPosition : cameraPositions)
+		{
+			size_t culledMeshlets = 0;
+			for (const auto& meshlet : meshletMesh.meshlets)
+			{
+				if (!sk::isMeshletBackfacing(meshlet, cameraPosition))
+				{
+					continue;
+				}
+
+				culledMeshlets++;
+				for (uint32_t i = meshlet.firstIndex; i < meshlet.firstIndex + meshlet.indexCount; i += 3)
+				{
+					const skm::Vec3& p0 = meshletMesh.mesh.vertices[indices[i]].position;
+					const skm::Vec3& p1 = meshletMesh.mesh.vertices[indices[i + 1]].position;
+					const skm::Vec3& p2 = meshletMesh.mesh.vertices[indices[i + 2]].position;
+
+					skm::Vec3 normal = skm::cross(skm::Vec3(p1.x - p0.x, p1.y - p0.y, p1.z - p0.z), skm::Vec3(p2.x - p0.x, p2.y - p0.y, p2.z - p0.z));
+					skm::Vec3 view(p0.x - cameraPosition.x, p0.y - cameraPosition.y, p0.z - cameraPosition.z);
+
+					passed = passed && (skm::dot(view, normal) >= 0.0f);
+				}
+			}
+
+			//Roughly half of a sphere faces away from an outside camera, most of it must be culled
+			passed = passed && (culledMeshlets * 4 >= meshletMesh.meshlets.size());
+		}
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::MESHLET_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the levels of detail : the chain of a sphere must shrink level after level while staying close to the sphere,
+	* and selectLod() must switch to coarser levels as the sphere moves away from the camera
+	*/
+	inline sk::SkResult<bool, sk::TestError> lodTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		sk::Mesh sphereMesh = createSphereMesh(64, 128);
+
+		auto generateLodChainResult = sk::generateLodChain(sphereMesh, 6, 0.5f);
+		if (sk::logError(generateLodChainResult))
+		{
+			result.value = false;
+			result.error = sk::TestError::LOD_ERROR;
+			return result;
+		}
+
+		const sk::LodMesh& lodMesh = generateLodChainResult.value;
+
+		bool passed = (lodMesh.lods.size() >= 4);
+
+		for (size_t lod = 1; lod < lodMesh.lods.size(); lod++)
+		{
+			const sk::MeshLod& previousLod = lodMesh.lods[lod - 1];
+			const sk::MeshLod& currentLod = lodMesh.lods[lod];
+
+			passed = passed && (currentLod.firstIndex == previousLod.firstIndex + previousLod.indexCount);
+			passed = passed && (currentLod.indexCount < previousLod.indexCount && currentLod.error >= previousLod.error);
+
+			//The center of every triangle stays close to the sphere
+			float maxDeviation = 0.0f;
+			for (uint32_t i = currentLod.firstIndex; i < currentLod.firstIndex + currentLod.indexCount; i += 3)
+			{
+				const skm::Vec3& p0 = lodMesh.mesh.vertices[lodMesh.mesh.indices[i]].position;
+				const skm::Vec3& p1 = lodMesh.mesh.vertices[lodMesh.mesh.indices[i + 1]].position;
+				const skm::Vec3& p2 = lodMesh.mesh.vertices[lodMesh.mesh.indices[i + 2]].position;
+
+				skm::Vec3 center((p0.x + p1.x + p2.x) / 3.0f, (p0.y + p1.y + p2.y) / 3.0f, (p0.z + p1.z + p2.z) / 3.0f);
+				maxDeviation = std::max(maxDeviation, 1.0f - skm::length(center));
+			}
+
+			passed = passed && (maxDeviation < 0.15f);
+		}
+
+		/*SELECTION*/
+		auto projectionResult = skm::perspectiveProjection(skm::toRad(70.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+		passed = passed && !skm::error(projectionResult);
+
+		const skm::Mat4& projection = projectionResult.value;
+		const skm::Mat4 view(1.0f);
+
+		uint32_t previousSelection = 0;
+		for (const float distance : { 1.5f, 5.0f, 20.0f, 80.0f, 320.0f, 1280.0f })
+		{
+			uint32_t selection = sk::selectLod(lodMesh.lods, skm::Vec4(0.0f, 0.0f, distance, 1.0f), 1.0f, view, projection, 1080.0f);
+
+			passed = passed && (selection >= previousSelection);
+			previousSelection = selection;
+		}
+
+		passed = passed && (sk::selectLod(lodMesh.lods, skm::Vec4(0.0f, 0.0f, 0.5f, 1.0f), 1.0f, view, projection, 1080.0f) == 0);
+		passed = passed && (previousSelection == lodMesh.lods.size() - 1);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::LOD_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the instance batching : interleaved instances of a few meshes must come out as one batch per mesh,
+	* each batch holding its instances in queuing order
+	*/
+	inline sk::SkResult<bool, sk::TestError> instanceBatchingTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		const uint32_t meshCount = 3;
+		const uint32_t instanceCount = 3000;
+
+		sk::InstanceBatcher batcher;
+		for (uint32_t i = 0; i < instanceCount; i++)
+		{
+			sk::InstanceData instance;
+			instance.custom = skm::Vec4(static_cast<float>(i), 0.0f, 0.0f, 0.0f);
+
+			batcher.add(vk::Pipeline(nullptr), (i * 7) % meshCount, instance);
+		}
+
+		std::vector<sk::InstanceData> instanceMemory(instanceCount);
+
+		bool passed = (batcher.build(instanceMemory.data(), instanceCount - 1).error == sk::DrawingError::INSTANCE_BUFFER_TOO_SMALL_ERROR);
+
+		auto buildResult = batcher.build(instanceMemory.data(), instanceCount);
+		const std::vector<sk::InstanceBatch>& batches = buildResult.value;
+
+		passed = passed && (buildResult.error == sk::DrawingError::NO_ERROR && batches.size() == meshCount);
+
+		uint32_t nextInstance = 0;
+		for (const auto& batch : batches)
+		{
+			passed = passed && (batch.firstInstance == nextInstance && batch.instanceCount == instanceCount / meshCount);
+			nextInstance += batch.instanceCount;
+
+			for (uint32_t i = batch.firstInstance; i < batch.firstInstance + batch.instanceCount; i++)
+			{
+				uint32_t queuedIndex = static_cast<uint32_t>(instanceMemory[i].custom.x);
+				passed = passed && ((queuedIndex * 7) % meshCount == batch.meshId);
+
+				if (i > batch.firstInstance)
+				{
+					passed = passed && (instanceMemory[i - 1].custom.x < instanceMemory[i].custom.x);
+				}
+			}
+		}
+
+		batcher.clear();
+		passed = passed && (batcher.getInstanceCount() == 0);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::INSTANCE_BATCHING_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the binary mesh files : a meshlet sphere written with writeMeshFile() must be mapped back byte for byte,
+	* truncated or altered copies of the file, out of bounds level of detail and meshlet ranges included, must be rejected by readMeshFile()
+	*/
+	inline sk::SkResult<bool, sk::TestError> meshFileTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		const std::string filename = "soulkan_mesh_file_test.skmesh";
+
+		auto buildMeshletsResult = sk::buildMeshlets(createSphereMesh(32, 64), 64, 124);
+		if (sk::logError(buildMeshletsResult))
+		{
+			result.value = false;
+			result.error = sk::TestError::MESH_FILE_ERROR;
+			return result;
+		}
+
+		const sk::MeshletMesh& meshletMesh = buildMeshletsResult.value;
+
+		auto writeMeshFileResult = sk::writeMeshFile(filename, meshletMesh.mesh, {}, meshletMesh.meshlets);
+		if (sk::logError(writeMeshFileResult))
+		{
+			result.value = false;
+			result.error = sk::TestError::MESH_FILE_ERROR;
+			return result;
+		}
+
+		bool passed = true;
+
+		{
+			sk::MappedFile mappedFile;
+			auto openResult = mappedFile.open(filename);
+			passed = passed && !sk::logError(openResult);
+
+			auto readMeshFileResult = sk::readMeshFile(mappedFile.getData(), mappedFile.getSize());
+			passed = passed && !sk::logError(readMeshFileResult);
+
+			if (passed)
+			{
+				const sk::MeshFileView& meshFile = readMeshFileResult.value;
+				const sk::Mesh& mesh = meshletMesh.mesh;
+
+				passed = passed && (meshFile.pHeader->vertices.count == mesh.vertices.size() && meshFile.pHeader->indices.count == mesh.indices.size());
+				passed = passed && (meshFile.pHeader->meshlets.count == meshletMesh.meshlets.size() && meshFile.pHeader->lods.count == 1);
+				passed = passed && (meshFile.getIndexType() == mesh.getIndexType() && meshFile.getIndexDataSize() == mesh.getIndexBufferSize());
+
+				//Sections are GPU ready : vertices and meshlets are the same bytes, indices the same narrowed indices
+				passed = passed && (std::memcmp(meshFile.getVertexData(), mesh.vertices.data(), mesh.vertices.size() * sizeof(sk::Vertex)) == 0);
+				passed = passed && (std::memcmp(meshFile.getMeshlets(), meshletMesh.meshlets.data(), meshletMesh.meshlets.size() * sizeof(sk::Meshlet)) == 0);
+
+				std::vector<uint8_t> indices(static_cast<size_t>(mesh.getIndexBufferSize()));
+				sk::writeIndices(mesh, indices.data());
+				passed = passed && (std::memcmp(meshFile.getIndexData(), indices.data(), indices.size()) == 0);
+
+				passed = passed && (meshFile.getLods()[0].firstIndex == 0 && meshFile.getLods()[0].indexCount == mesh.indices.size());
+
+				//Unit sphere centered on the origin
+				passed = passed && (std::abs(meshFile.pHeader->boundingSphere[3] - 1.0f) < 1e-3f && std::abs(meshFile.pHeader->boundsMin[1] + 1.0f) < 1e-3f);
+
+				/*CORRUPTED FILES*/
+				std::vector<uint8_t> fileCopy(static_cast<const uint8_t*>(mappedFile.getData()), static_cast<const uint8_t*>(mappedFile.getData()) + mappedFile.getSize());
+
+				passed = passed && (sk::readMeshFile(fileCopy.data(), fileCopy.size() - 1).error == sk::FileError::CORRUPTED_FILE_ERROR);
+				passed = passed && (sk::readMeshFile(fileCopy.data(), 16).error == sk::FileError::CORRUPTED_FILE_ERROR);
+
+				sk::MeshFileHeader* pHeader = reinterpret_cast<sk::MeshFileHeader*>(fileCopy.data());
+
+				//Ranges reaching past the indices or the vertices
+				sk::MeshLod* pLods = reinterpret_cast<sk::MeshLod*>(fileCopy.data() + pHeader->lods.offset);
+				pLods[0].firstIndex = 3;
+				passed = passed && (sk::readMeshFile(fileCopy.data(), fileCopy.size()).error == sk::FileError::CORRUPTED_FILE_ERROR);
+				pLods[0].firstIndex = 0;
+
+				sk::Meshlet* pMeshlets = reinterpret_cast<sk::Meshlet*>(fileCopy.data() + pHeader->meshlets.offset);
+				const sk::Meshlet lastMeshlet = pMeshlets[pHeader->meshlets.count - 1];
+				pMeshlets[pHeader->meshlets.count - 1].indexCount += 3;
+				passed = passed && (sk::readMeshFile(fileCopy.data(), fileCopy.size()).error == sk::FileError::CORRUPTED_FILE_ERROR);
+				pMeshlets[pHeader->meshlets.count - 1] = lastMeshlet;
+
+				pMeshlets[0].vertexOffset = -1;
+				passed = passed && (sk::readMeshFile(fileCopy.data(), fileCopy.size()).error == sk::FileError::CORRUPTED_FILE_ERROR);
+				pMeshlets[0].vertexOffset = static_cast<int32_t>(pHeader->vertices.count + 1);
+				passed = passed && (sk::readMeshFile(fileCopy.data(), fileCopy.size()).error == sk::FileError::CORRUPTED_FILE_ERROR);
+				pMeshlets[0].vertexOffset = 0;
+
+				passed = passed && !sk::logError(sk::readMeshFile(fileCopy.data(), fileCopy.size()));
+
+				pHeader->indices.count = UINT64_MAX / 2;
+				passed = passed && (sk::readMeshFile(fileCopy.data(), fileCopy.size()).error == sk::FileError::CORRUPTED_FILE_ERROR);
+
+				pHeader->version = sk::meshFileVersion + 1;
+				passed = passed && (sk::readMeshFile(fileCopy.data(), fileCopy.size()).error == sk::FileError::UNSUPPORTED_VERSION_ERROR);
+
+				pHeader->magic = 0;
+				passed = passed && (sk::readMeshFile(fileCopy.data(), fileCopy.size()).error == sk::FileError::INVALID_FORMAT_ERROR);
+			}
+		}
+
+		std::remove(filename.c_str());
+
+		sk::MappedFile missingFile;
+		passed = passed && (missingFile.open(filename).error == sk::FileError::FILE_OPENING_ERROR && missingFile.getData() == nullptr);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::MESH_FILE_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the asset import : small OBJ and glTF files are imported, then imported again through the import cache
+	* which must give back the same meshes, names holding line breaks included, while index accessors of signed types are rejected
+	*/
+	inline sk::SkResult<bool, sk::TestError> importTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		const std::string objFilename = "soulkan_import_test.obj";
+		const std::string gltfFilename = "soulkan_import_test.gltf";
+		const std::string binFilename = "soulkan_import_test.bin";
+		const std::string cacheDirectory = "soulkan_import_cache";
+
+		/*SOURCE FILES*/
+		//A quad with normals and a colored triangle using relative indices, the faceless default object is dropped
+		std::ofstream objFile(objFilename, std::ios::trunc);
+		objFile << "# soulkan import test\n"
+		           "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nvn 0 0 1\n"
+		           "o quad\nf 1//1 2//1 3//1 4//1\n"
+		           "o triangle\nv 0 0 1 1 0 0\nv 1 0 1 0 1 0\r\nv 0 1 1 0 0 1\nf -3 -2 -1\n";
+		objFile.close();
+
+		//Quad positions in strip order followed by 16 bits indices, drawn once as an indexed list and once as a strip
+		const std::array<float, 12> quadPositions = { 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 2.0f, 0.0f, 1.0f, 2.0f, 1.0f, 1.0f, 2.0f };
+		const std::array<uint16_t, 6> quadIndices = { 0, 1, 3, 0, 3, 2 };
+
+		std::ofstream binFile(binFilename, std::ios::binary | std::ios::trunc);
+		binFile.write(reinterpret_cast<const char*>(quadPositions.data()), sizeof(quadPositions));
+		binFile.write(reinterpret_cast<const char*>(quadIndices.data()), sizeof(quadIndices));
+		binFile.close();
+
+		std::ofstream gltfFile(gltfFilename, std::ios::trunc);
+		gltfFile << R"({ "asset": { "version": "2.0" }, "buffers": [ { "uri": "soulkan_import_test.bin", "byteLength": 60 } ],
+			"bufferViews": [ { "buffer": 0, "byteOffset": 0, "byteLength": 48 }, { "buffer": 0, "byteOffset": 48, "byteLength": 12 } ],
+			"accessors": [ { "bufferView": 0, "componentType": 5126, "count": 4, "type": "VEC3" }, { "bufferView": 1, "componentType": 5123, "count": 6, "type": "SCALAR" } ],
+			"meshes": [ { "name": "gltf quad", "primitives": [ { "attributes": { "POSITION": 0 }, "indices": 1 }, { "attributes": { "POSITION": 0 }, "mode": 5 } ] } ] })";
+		gltfFile.close();
+
+		bool passed = true;
+
+		/*IMPORT*/
+		sk::ThreadPool threadPool;
+
+		auto objResult = sk::importMeshes(objFilename, threadPool);
+		auto gltfResult = sk::importMeshes(gltfFilename, threadPool, cacheDirectory);
+		passed = passed && !sk::logError(objResult) && !sk::logError(gltfResult);
+
+		if (passed)
+		{
+			const std::vector<sk::ImportedMesh>& objMeshes = objResult.value;
+			passed = passed && (objMeshes.size() == 2 && objMeshes[0].name == "quad" && objMeshes[1].name == "triangle");
+
+			if (passed)
+			{
+				const sk::Mesh& quad = objMeshes[0].mesh;
+				const sk::Mesh& triangle = objMeshes[1].mesh;
+
+				passed = passed && (quad.vertices.size() == 4 && quad.indices.size() == 6 && quad.vertices[0].normal.z == 1.0f);
+				passed = passed && (triangle.vertices.size() == 3 && triangle.indices.size() == 3);
+				passed = passed && (triangle.vertices[1].color.y == 1.0f && std::abs(triangle.vertices[2].normal.z - 1.0f) < 1e-6f);
+				passed = passed && (objMeshes[1].bounds.boundsMin[2] == 1.0f && objMeshes[1].bounds.boundsMax[0] == 1.0f);
+			}
+
+			const std::vector<sk::ImportedMesh>& gltfMeshes = gltfResult.value;
+			passed = passed && (gltfMeshes.size() == 1 && gltfMeshes[0].name == "gltf quad");
+
+			if (passed)
+			{
+				//2 triangles from the list and 2 from the strip, both with computed normals facing +z
+				const sk::Mesh& quad = gltfMeshes[0].mesh;
+				passed = passed && (quad.vertices.size() == 8 && quad.indices.size() == 12);
+				passed = passed && (quad.indices[6] == 4 && quad.indices[9] == 5 && quad.indices[10] == 7);
+
+				for (const auto& vertex : quad.vertices)
+				{
+					passed = passed && (std::abs(vertex.normal.z - 1.0f) < 1e-6f);
+				}
+			}
+		}
+
+		/*IMPORT CACHE*/
+		auto loadGltfResult = sk::loadGltf(gltfFilename);
+		const std::string manifestFilename = sk::getImportCacheFilename(cacheDirectory, loadGltfResult.value.contentHash, ".skmeshes");
+		passed = passed && !sk::logError(loadGltfResult) && std::filesystem::exists(manifestFilename);
+
+		//The mesh renamed in the manifest only comes back from the cache
+		std::ofstream manifestFile(manifestFilename, std::ios::trunc);
+		manifestFile << "1\ncached quad\n";
+		manifestFile.close();
+
+		auto cachedResult = sk::importMeshes(gltfFilename, threadPool, cacheDirectory);
+		passed = passed && !sk::logError(cachedResult);
+
+		if (passed)
+		{
+			const std::vector<sk::ImportedMesh>& meshes = gltfResult.value;
+			const std::vector<sk::ImportedMesh>& cachedMeshes = cachedResult.value;
+
+			passed = passed && (cachedMeshes.size() == meshes.size());
+			for (size_t i = 0; passed && i < meshes.size(); i++)
+			{
+				passed = passed && (cachedMeshes[i].name == "cached quad" && cachedMeshes[i].mesh.indices == meshes[i].mesh.indices);
+				passed = passed && (cachedMeshes[i].mesh.vertices.size() == meshes[i].mesh.vertices.size());
+				passed = passed && (std::memcmp(cachedMeshes[i].mesh.vertices.data(), meshes[i].mesh.vertices.data(), meshes[i].mesh.vertices.size() * sizeof(sk::Vertex)) == 0);
+				passed = passed && (cachedMeshes[i].bounds.boundingSphere == meshes[i].bounds.boundingSphere);
+			}
+		}
+
+		//An implausible mesh count is rejected without being allocated, the asset being imported again
+		manifestFile.open(manifestFilename, std::ios::trunc);
+		manifestFile << "1000000000000\ngltf quad\n";
+		manifestFile.close();
+
+		passed = passed && (sk::readImportCache(cacheDirectory, loadGltfResult.value.contentHash, threadPool).error == sk::ImportError::CACHE_ERROR);
+
+		auto reimportResult = sk::importMeshes(gltfFilename, threadPool, cacheDirectory);
+		passed = passed && !sk::logError(reimportResult) && (reimportResult.value.size() == 1) && (reimportResult.value[0].name == "gltf quad");
+
+		//Line breaks in names are escaped, a manifest line holding a single name
+		if (passed)
+		{
+			sk::ImportedMesh namedMesh = reimportResult.value[0];
+			namedMesh.name = "two\nlines \\n\r";
+
+			passed = !sk::logError(sk::writeImportCache(cacheDirectory, 1, { namedMesh }, threadPool));
+
+			auto namedResult = sk::readImportCache(cacheDirectory, 1, threadPool);
+			passed = passed && !sk::logError(namedResult) && (namedResult.value.size() == 1) && (namedResult.value[0].name == namedMesh.name);
+		}
+
+		/*MALFORMED INPUT*/
+		passed = passed && (sk::parseJson(R"({ "a": [ 1, 2, ] })").error == sk::ImportError::PARSING_ERROR);
+		passed = passed && (sk::parseJson(R"({ "a": [ 1, 2 ] } })").error == sk::ImportError::PARSING_ERROR);
+
+		auto decodeBase64Result = sk::decodeBase64("U291bGthbg==");
+		passed = passed && (std::string(decodeBase64Result.value.begin(), decodeBase64Result.value.end()) == "Soulkan");
+
+		passed = passed && (sk::importMeshes("soulkan_import_test.fbx", threadPool).error == sk::ImportError::UNSUPPORTED_FORMAT_ERROR);
+
+		//Indices must be unsigned, the signed shorts of the buffer being rejected
+		const std::string signedGltfFilename = "soulkan_import_test_signed.gltf";
+
+		gltfFile.open(signedGltfFilename, std::ios::trunc);
+		gltfFile << R"({ "asset": { "version": "2.0" }, "buffers": [ { "uri": "soulkan_import_test.bin", "byteLength": 60 } ],
+			"bufferViews": [ { "buffer": 0, "byteOffset": 0, "byteLength": 48 }, { "buffer": 0, "byteOffset": 48, "byteLength": 12 } ],
+			"accessors": [ { "bufferView": 0, "componentType": 5126, "count": 4, "type": "VEC3" }, { "bufferView": 1, "componentType": 5122, "count": 6, "type": "SCALAR" } ],
+			"meshes": [ { "primitives": [ { "attributes": { "POSITION": 0 }, "indices": 1 } ] } ] })";
+		gltfFile.close();
+
+		passed = passed && (sk::importMeshes(signedGltfFilename, threadPool).error == sk::ImportError::INVALID_ACCESSOR_ERROR);
+
+		std::remove(objFilename.c_str());
+		std::remove(gltfFilename.c_str());
+		std::remove(signedGltfFilename.c_str());
+		std::remove(binFilename.c_str());
+
+		std::error_code errorCode;
+		std::filesystem::remove_all(cacheDirectory, errorCode);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::IMPORT_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the SPIR-V file loading : a compiled shader of the repository and a minimal module must load,
+	* missing, truncated and non SPIR-V files must be rejected
+	*/
+	inline sk::SkResult<bool, sk::TestError> shaderLoadingTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		const std::string shaderFilename = "soulkan_shader_loading_test.spv";
+
+		auto writeWords = [&shaderFilename](const std::vector<uint32_t>& words, const size_t size)
+		{
+			std::ofstream shaderFile(shaderFilename, std::ios::binary | std::ios::trunc);
+			shaderFile.write(reinterpret_cast<const char*>(words.data()), static_cast<std::streamsize>(size));
+		};
+
+		//Header only module : magic number, version 1.0, generator, bound, schema
+		const std::vector<uint32_t> header = { sk::spirvMagicNumber, 0x00010000, 0, 1, 0 };
+
+		bool passed = true;
+
+		auto repositoryShaderResult = sk::loadShaderFileInBuffer("shaders/triangle_mesh.spv");
+		passed = passed && !sk::logError(repositoryShaderResult) && (repositoryShaderResult.value[0] == sk::spirvMagicNumber);
+
+		writeWords(header, header.size() * sizeof(uint32_t));
+		auto headerResult = sk::loadShaderFileInBuffer(shaderFilename);
+		passed = passed && !sk::logError(headerResult) && (headerResult.value == header);
+
+		writeWords(header, header.size() * sizeof(uint32_t) - 1);
+		passed = passed && (sk::loadShaderFileInBuffer(shaderFilename).error == sk::ShaderError::INVALID_SPIRV_ERROR);
+
+		writeWords({ 0x03022307, 0x00010000, 0, 1, 0 }, header.size() * sizeof(uint32_t));
+		passed = passed && (sk::loadShaderFileInBuffer(shaderFilename).error == sk::ShaderError::INVALID_SPIRV_ERROR);
+
+		std::remove(shaderFilename.c_str());
+		passed = passed && (sk::loadShaderFileInBuffer(shaderFilename).error == sk::ShaderError::SHADER_FILE_OPENING_ERROR);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::SHADER_LOADING_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the SPIR-V reflection : the vertex inputs of a compiled shader of the repository, and the resources of a hand assembled
+	* compute module (uniform buffer, runtime array of storage buffers, array of combined image samplers, push constants), must be reflected and merged
+	*/
+	inline sk::SkResult<bool, sk::TestError> reflectionTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*VERTEX SHADER*/
+		auto vertexShaderBufferResult = sk::loadShaderFileInBuffer("shaders/triangle_mesh.spv");
+		auto vertexReflectionResult = sk::reflectShader(sk::retLog(vertexShaderBufferResult));
+		const sk::ShaderReflection& vertexReflection = vertexReflectionResult.value;
+
+		passed = passed && !sk::logError(vertexReflectionResult) && (vertexReflection.stage == vk::ShaderStageFlagBits::eVertex) && (vertexReflection.entryPoint == "main");
+		passed = passed && vertexReflection.bindings.empty() && (vertexReflection.pushConstantSize == 0) && (vertexReflection.vertexInputs.size() == 3);
+		for (uint32_t i = 0; passed && i < vertexReflection.vertexInputs.size(); i++)
+		{
+			passed = (vertexReflection.vertexInputs[i].location == i) && (vertexReflection.vertexInputs[i].format == vk::Format::eR32G32B32Sfloat);
+		}
+
+		//Packed like Vertex, then split into a per vertex and a per instance stream
+		auto vertexInputResult = sk::createReflectedVertexInputDescription(vertexReflection);
+		passed = passed && !sk::logError(vertexInputResult) && (vertexInputResult.value.bindings.size() == 1) && (vertexInputResult.value.bindings[0].stride == sizeof(sk::Vertex));
+		passed = passed && (vertexInputResult.value.attributes.size() == 3) && (vertexInputResult.value.attributes[2].offset == 24);
+
+		auto instancedVertexInputResult = sk::createReflectedVertexInputDescription(vertexReflection, 2);
+		passed = passed && !sk::logError(instancedVertexInputResult) && (instancedVertexInputResult.value.bindings.size() == 2);
+		passed = passed && (instancedVertexInputResult.value.bindings[0].stride == 24) && (instancedVertexInputResult.value.bindings[1].stride == 12);
+		passed = passed && (instancedVertexInputResult.value.bindings[1].inputRate == vk::VertexInputRate::eInstance) && (instancedVertexInputResult.value.attributes[2].offset == 0);
+
+		/*COMPUTE SHADER*/
+		//layout(local_size_x = 64) in;
+		//layout(set = 0, binding = 1) uniform Uniforms { vec4 color; };
+		//layout(set = 1, binding = 0) buffer Colors { vec4 colors[]; } colorBuffers[];
+		//layout(set = 0, binding = 2) uniform sampler2D textures[4];
+		//layout(push_constant) uniform Constants { mat4 transform; vec4 tint; };
+		const std::vector<uint32_t> computeShader = {
+			sk::spirvMagicNumber, 0x00010300, 0, 28, 0,
+			(2 << 16) | 17, 1,                                     //OpCapability Shader
+			(3 << 16) | 14, 0, 1,                                  //OpMemoryModel Logical GLSL450
+			(5 << 16) | 15, 5, 1, 0x6E69616D, 0,                   //OpEntryPoint GLCompute %1 "main"
+			(6 << 16) | 16, 1, 17, 64, 1, 1,                       //OpExecutionMode %1 LocalSize 64 1 1
+			(3 << 16) | 71, 10, 2,                                 //OpDecorate %10 Block
+			(5 << 16) | 72, 10, 0, 35, 0,                          //OpMemberDecorate %10 0 Offset 0
+			(4 << 16) | 71, 11, 34, 0,                             //OpDecorate %11 DescriptorSet 0
+			(4 << 16) | 71, 11, 33, 1,                             //OpDecorate %11 Binding 1
+			(3 << 16) | 71, 12, 2,                                 //OpDecorate %12 Block
+			(5 << 16) | 72, 12, 0, 35, 0,                          //OpMemberDecorate %12 0 Offset 0
+			(4 << 16) | 71, 13, 6, 16,                             //OpDecorate %13 ArrayStride 16
+			(4 << 16) | 71, 14, 34, 1,                             //OpDecorate %14 DescriptorSet 1
+			(4 << 16) | 71, 14, 33, 0,                             //OpDecorate %14 Binding 0
+			(4 << 16) | 71, 15, 34, 0,                             //OpDecorate %15 DescriptorSet 0
+			(4 << 16) | 71, 15, 33, 2,                             //OpDecorate %15 Binding 2
+			(3 << 16) | 71, 16, 2,                                 //OpDecorate %16 Block
+			(5 << 16) | 72, 16, 0, 35, 0,                          //OpMemberDecorate %16 0 Offset 0
+			(4 << 16) | 72, 16, 0, 5,                              //OpMemberDecorate %16 0 ColMajor
+			(5 << 16) | 72, 16, 0, 7, 16,                          //OpMemberDecorate %16 0 MatrixStride 16
+			(5 << 16) | 72, 16, 1, 35, 64,                         //OpMemberDecorate %16 1 Offset 64
+			(2 << 16) | 19, 2,                                     //%2 = OpTypeVoid
+			(3 << 16) | 22, 3, 32,                                 //%3 = OpTypeFloat 32
+			(4 << 16) | 23, 4, 3, 4,                               //%4 = OpTypeVector %3 4
+			(4 << 16) | 24, 5, 4, 4,                               //%5 = OpTypeMatrix %4 4
+			(4 << 16) | 21, 6, 32, 0,                              //%6 = OpTypeInt 32 0
+			(4 << 16) | 43, 6, 7, 4,                               //%7 = OpConstant %6 4
+			(3 << 16) | 30, 10, 4,                                 //%10 = OpTypeStruct %4
+			(3 << 16) | 29, 13, 4,                                 //%13 = OpTypeRuntimeArray %4
+			(3 << 16) | 30, 12, 13,                                //%12 = OpTypeStruct %13
+			(3 << 16) | 29, 27, 12,                                //%27 = OpTypeRuntimeArray %12
+			(9 << 16) | 25, 17, 3, 1, 0, 0, 0, 1, 0,               //%17 = OpTypeImage %3 2D 0 0 0 1 Unknown
+			(3 << 16) | 27, 18, 17,                                //%18 = OpTypeSampledImage %17
+			(4 << 16) | 28, 19, 18, 7,                             //%19 = OpTypeArray %18 %7
+			(4 << 16) | 30, 16, 5, 4,                              //%16 = OpTypeStruct %5 %4
+			(4 << 16) | 32, 20, 2, 10,                             //%20 = OpTypePointer Uniform %10
+			(4 << 16) | 32, 21, 12, 27,                            //%21 = OpTypePointer StorageBuffer %27
+			(4 << 16) | 32, 22, 0, 19,                             //%22 = OpTypePointer UniformConstant %19
+			(4 << 16) | 32, 23, 9, 16,                             //%23 = OpTypePointer PushConstant %16
+			(4 << 16) | 59, 20, 11, 2,                             //%11 = OpVariable %20 Uniform
+			(4 << 16) | 59, 21, 14, 12,                            //%14 = OpVariable %21 StorageBuffer
+			(4 << 16) | 59, 22, 15, 0,                             //%15 = OpVariable %22 UniformConstant
+			(4 << 16) | 59, 23, 24, 9,                             //%24 = OpVariable %23 PushConstant
+			(3 << 16) | 33, 25, 2,                                 //%25 = OpTypeFunction %2
+			(5 << 16) | 54, 2, 1, 0, 25,                           //%1 = OpFunction %2 None %25
+			(2 << 16) | 248, 26,                                   //%26 = OpLabel
+			(1 << 16) | 253,                                       //OpReturn
+			(1 << 16) | 56 };                                      //OpFunctionEnd
+
+		auto computeReflectionResult = sk::reflectShader(computeShader);
+		const sk::ShaderReflection& computeReflection = computeReflectionResult.value;
+
+		passed = passed && !sk::logError(computeReflectionResult) && (computeReflection.stage == vk::ShaderStageFlagBits::eCompute);
+		passed = passed && (computeReflection.localSize == std::array<uint32_t, 3>{ 64, 1, 1 }) && computeReflection.vertexInputs.empty();
+		passed = passed && (computeReflection.pushConstantOffset == 0) && (computeReflection.pushConstantSize == 80) && (computeReflection.bindings.size() == 3);
+		if (passed)
+		{
+			const std::vector<sk::ReflectedBinding>& bindings = computeReflection.bindings;
+			passed = (bindings[0].set == 0) && (bindings[0].binding == 1) && (bindings[0].descriptorType == vk::DescriptorType::eUniformBuffer) && (bindings[0].descriptorCount == 1);
+			passed = passed && (bindings[1].set == 0) && (bindings[1].binding == 2) && (bindings[1].descriptorType == vk::DescriptorType::eCombinedImageSampler) && (bindings[1].descriptorCount == 4);
+			passed = passed && (bindings[2].set == 1) && (bindings[2].binding == 0) && (bindings[2].descriptorType == vk::DescriptorType::eStorageBuffer) && (bindings[2].descriptorCount == 0);
+		}
+
+		passed = passed && (sk::createReflectedVertexInputDescription(computeReflection).error == sk::ReflectionError::UNSUPPORTED_STAGE_ERROR);
+
+		/*MERGING*/
+		sk::ShaderReflection fragmentReflection = computeReflection;
+		fragmentReflection.stage = vk::ShaderStageFlagBits::eFragment;
+
+		auto mergeResult = sk::mergeShaderReflections({ vertexReflection, computeReflection, fragmentReflection });
+		const sk::PipelineLayoutDescription& description = mergeResult.value;
+
+		const vk::ShaderStageFlags sharedStages = vk::ShaderStageFlagBits::eCompute | vk::ShaderStageFlagBits::eFragment;
+		passed = passed && !sk::logError(mergeResult) && (description.setBindings.size() == 2) && (description.setBindings[0].size() == 2) && (description.setBindings[1].size() == 1);
+		passed = passed && (description.pushConstantRanges.size() == 1) && (description.pushConstantRanges[0].size == 80) && (description.pushConstantRanges[0].stageFlags == sharedStages);
+		passed = passed && (description.setBindings[0][0].binding == 1) && (description.setBindings[0][0].stageFlags == sharedStages);
+
+		fragmentReflection.bindings[0].descriptorType = vk::DescriptorType::eStorageBuffer;
+		passed = passed && (sk::mergeShaderReflections({ computeReflection, fragmentReflection }).error == sk::ReflectionError::BINDING_CONFLICT_ERROR);
+
+		/*MALFORMED MODULES*/
+		std::vector<uint32_t> truncatedShader = computeShader;
+		truncatedShader.back() = (2 << 16) | 56;
+		passed = passed && (sk::reflectShader(truncatedShader).error == sk::ReflectionError::INVALID_SPIRV_ERROR);
+		passed = passed && (sk::reflectShader(computeShader.data(), 3 * sizeof(uint32_t)).error == sk::ReflectionError::INVALID_SPIRV_ERROR);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::SHADER_REFLECTION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the specialization constants : values must be packed in constant id order whatever the order they are set in,
+	* replaced values must keep the packing consistent, and the constants declared by a hand assembled module must be reflected and checked
+	*/
+	inline sk::SkResult<bool, sk::TestError> specializationTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*PACKING*/
+		sk::SpecializationConstants constants;
+		constants.set(2, 16u).set(0, true).set(1, 0.5f);
+
+		sk::SpecializationConstants reorderedConstants;
+		reorderedConstants.set(1, 0.5f).set(2, 16u).set(0, true);
+
+		auto getKey = [](const sk::SpecializationConstants& specializationConstants)
+		{
+			std::vector<uint32_t> key;
+			specializationConstants.appendKey(key);
+			return key;
+		};
+
+		const float half = 0.5f;
+		uint32_t halfBits = 0;
+		std::memcpy(&halfBits, &half, sizeof(halfBits));
+
+		const std::vector<uint32_t> expectedKey = { 3, 0, 4, 1, 1, 4, halfBits, 2, 4, 16 };
+		passed = passed && (getKey(constants) == expectedKey) && (getKey(reorderedConstants) == expectedKey) && (constants.getData() == reorderedConstants.getData());
+
+		const vk::SpecializationInfo specializationInfo = constants.getSpecializationInfo();
+		passed = passed && (specializationInfo.mapEntryCount == 3) && (specializationInfo.dataSize == 12) && (specializationInfo.pData == constants.getData().data());
+		passed = passed && (constants.getEntries()[1].offset == 4) && (constants.getEntries()[2].offset == 8);
+
+		//A constant changing type moves the following values, setting it back gives the original packing
+		constants.set(1, 2.0);
+		passed = passed && (constants.getData().size() == 16) && (constants.getEntries()[1].size == 8) && (constants.getEntries()[2].offset == 12);
+
+		uint32_t lastValue = 0;
+		std::memcpy(&lastValue, constants.getData().data() + constants.getEntries()[2].offset, sizeof(lastValue));
+		passed = passed && (lastValue == 16);
+
+		constants.set(1, 0.5f);
+		passed = passed && (getKey(constants) == expectedKey) && sk::SpecializationConstants().isEmpty();
+
+		/*REFLECTION*/
+		//layout(constant_id = 0) const bool useColor = true;
+		//layout(constant_id = 2) const uint sampleCount = 16;
+		//layout(constant_id = 1) const float intensity = 1.0f;
+		const std::vector<uint32_t> fragmentShader = {
+			sk::spirvMagicNumber, 0x00010000, 0, 11, 0,
+			(2 << 16) | 17, 1,                                     //OpCapability Shader
+			(3 << 16) | 14, 0, 1,                                  //OpMemoryModel Logical GLSL450
+			(5 << 16) | 15, 4, 1, 0x6E69616D, 0,                   //OpEntryPoint Fragment %1 "main"
+			(3 << 16) | 16, 1, 7,                                  //OpExecutionMode %1 OriginUpperLeft
+			(4 << 16) | 71, 5, 1, 0,                               //OpDecorate %5 SpecId 0
+			(4 << 16) | 71, 6, 1, 2,                               //OpDecorate %6 SpecId 2
+			(4 << 16) | 71, 7, 1, 1,                               //OpDecorate %7 SpecId 1
+			(2 << 16) | 19, 2,                                     //%2 = OpTypeVoid
+			(2 << 16) | 20, 3,                                     //%3 = OpTypeBool
+			(4 << 16) | 21, 4, 32, 0,                              //%4 = OpTypeInt 32 0
+			(3 << 16) | 22, 8, 32,                                 //%8 = OpTypeFloat 32
+			(3 << 16) | 48, 3, 5,                                  //%5 = OpSpecConstantTrue %3
+			(4 << 16) | 50, 4, 6, 16,                              //%6 = OpSpecConstant %4 16
+			(4 << 16) | 50, 8, 7, 0x3F800000,                      //%7 = OpSpecConstant %8 1.0
+			(3 << 16) | 33, 9, 2,                                  //%9 = OpTypeFunction %2
+			(5 << 16) | 54, 2, 1, 0, 9,                            //%1 = OpFunction %2 None %9
+			(2 << 16) | 248, 10,                                   //%10 = OpLabel
+			(1 << 16) | 253,                                       //OpReturn
+			(1 << 16) | 56 };                                      //OpFunctionEnd
+
+		auto reflectionResult = sk::reflectShader(fragmentShader);
+		const std::vector<sk::ReflectedSpecializationConstant>& reflectedConstants = reflectionResult.value.specializationConstants;
+
+		passed = passed && !sk::logError(reflectionResult) && (reflectionResult.value.stage == vk::ShaderStageFlagBits::eFragment) && (reflectedConstants.size() == 3);
+		for (uint32_t i = 0; passed && i < reflectedConstants.size(); i++)
+		{
+			passed = (reflectedConstants[i].constantId == i) && (reflectedConstants[i].size == 4);
+		}
+
+		passed = passed && (reflectedConstants[0].defaultValue == 1) && (reflectedConstants[1].defaultValue == 0x3F800000) && (reflectedConstants[2].defaultValue == 16);
+
+		passed = passed && !sk::logError(sk::checkSpecializationConstants(reflectionResult.value, constants));
+		passed = passed && (sk::checkSpecializationConstants(reflectionResult.value, sk::SpecializationConstants().set(3, 1u)).error == sk::ReflectionError::UNKNOWN_SPECIALIZATION_CONSTANT_ERROR);
+		passed = passed && (sk::checkSpecializationConstants(reflectionResult.value, sk::SpecializationConstants().set(1, 1.0)).error == sk::ReflectionError::SPECIALIZATION_CONSTANT_SIZE_ERROR);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::SPECIALIZATION_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the descriptor allocator : pool sizes computed from ratios, growth of the pool chain and keys of the immutable sets
+	*/
+	inline sk::SkResult<bool, sk::TestError> descriptorAllocatorTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*POOL SIZES*/
+		const std::vector<sk::DescriptorPoolRatio> ratios = {
+			{ vk::DescriptorType::eUniformBuffer,        2.0f },
+			{ vk::DescriptorType::eCombinedImageSampler, 0.25f },
+			{ vk::DescriptorType::eSampler,              0.001f },
+			{ vk::DescriptorType::eStorageBuffer,        0.0f }
+		};
+
+		const std::vector<vk::DescriptorPoolSize> poolSizes = sk::computeDescriptorPoolSizes(ratios, 64);
+		passed = passed && (poolSizes.size() == ratios.size());
+
+		//Rounded up, and never empty so that a type with a tiny ratio can still be allocated
+		const std::vector<uint32_t> expectedCounts = { 128, 16, 1, 1 };
+		for (size_t i = 0; passed && i < poolSizes.size(); i++)
+		{
+			passed = (poolSizes[i].type == ratios[i].descriptorType) && (poolSizes[i].descriptorCount == expectedCounts[i]);
+		}
+
+		//Doubling the sets of a pool doubles its descriptors
+		const std::vector<vk::DescriptorPoolSize> grownPoolSizes = sk::computeDescriptorPoolSizes(ratios, 128);
+		passed = passed && (grownPoolSizes[0].descriptorCount == 256) && (grownPoolSizes[1].descriptorCount == 32);
+
+		for (const vk::DescriptorPoolSize& poolSize : sk::computeDescriptorPoolSizes(sk::getDefaultDescriptorPoolRatios(), 1))
+		{
+			passed = passed && (poolSize.descriptorCount >= 1);
+		}
+
+		/*DESCRIPTOR TYPES*/
+		passed = passed && sk::isImageDescriptorType(vk::DescriptorType::eCombinedImageSampler) && sk::isImageDescriptorType(vk::DescriptorType::eStorageImage);
+		passed = passed && !sk::isImageDescriptorType(vk::DescriptorType::eUniformBuffer) && !sk::isImageDescriptorType(vk::DescriptorType::eStorageBufferDynamic);
+
+		/*POOL CHAIN GROWTH*/
+		//Each pool created once the previous ones are exhausted holds twice as many sets, up to the limit
+		const std::vector<uint32_t> expectedSetCounts = { 2, 4, 8, 8 };
+		uint32_t setCount = 0;
+		for (size_t i = 0; passed && i < expectedSetCounts.size(); i++)
+		{
+			setCount = sk::getNextDescriptorPoolSetCount(setCount, 2, 8);
+			passed = (setCount == expectedSetCounts[i]);
+		}
+
+		passed = passed && (sk::getNextDescriptorPoolSetCount(0xC0000000u, 64, 0xFFFFFFFFu) == 0xFFFFFFFFu);
+
+		/*IMMUTABLE SET KEYS*/
+		const vk::DescriptorSetLayout layout = vk::DescriptorSetLayout(reinterpret_cast<VkDescriptorSetLayout>(uint64_t(0x10)));
+		const vk::Buffer buffer = vk::Buffer(reinterpret_cast<VkBuffer>(uint64_t(0x20)));
+		const vk::ImageView imageView = vk::ImageView(reinterpret_cast<VkImageView>(uint64_t(0x30)));
+
+		sk::DescriptorBinding bufferBinding = {};
+		bufferBinding.binding = 0;
+		bufferBinding.buffer = buffer;
+		bufferBinding.range = 256;
+
+		sk::DescriptorBinding imageBinding = {};
+		imageBinding.binding = 1;
+		imageBinding.descriptorType = vk::DescriptorType::eSampledImage;
+		imageBinding.imageView = imageView;
+
+		//The same resources given in another order share a set, other resources or ranges do not
+		const std::vector<uint32_t> key = sk::getDescriptorSetKey(layout, { bufferBinding, imageBinding });
+		passed = passed && (key == sk::getDescriptorSetKey(layout, { imageBinding, bufferBinding }));
+
+		sk::DescriptorBinding offsetBufferBinding = bufferBinding;
+		offsetBufferBinding.offset = 256;
+		passed = passed && (key != sk::getDescriptorSetKey(layout, { offsetBufferBinding, imageBinding }));
+
+		sk::DescriptorBinding otherImageBinding = imageBinding;
+		otherImageBinding.imageView = vk::ImageView(reinterpret_cast<VkImageView>(uint64_t(0x40)));
+		passed = passed && (key != sk::getDescriptorSetKey(layout, { bufferBinding, otherImageBinding }));
+		passed = passed && (key != sk::getDescriptorSetKey(vk::DescriptorSetLayout(reinterpret_cast<VkDescriptorSetLayout>(uint64_t(0x50))), { bufferBinding, imageBinding }));
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::DESCRIPTOR_ALLOCATOR_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Test of the descriptor allocator on a device : pool chain growth when pools are exhausted, reuse of the pools reset with
+	* their frame, sharing of the immutable sets and reuse of the released ones
+	*
+	* @param device The logical device the descriptor pools are created on
+	*/
+	inline sk::SkResult<bool, sk::TestError> descriptorAllocatorDeviceTest(const vk::Device& device)
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*RESOURCES*/
+		auto createDescriptorSetLayoutResult = sk::createDescriptorSetLayout(device, { vk::DescriptorSetLayoutBinding(0, vk::DescriptorType::eSampler, 1, vk::ShaderStageFlagBits::eFragment) });
+		vk::DescriptorSetLayout layout = sk::retLog(createDescriptorSetLayoutResult);
+		passed = !sk::error(createDescriptorSetLayoutResult);
+
+		std::vector<vk::Sampler> samplers;
+		try
+		{
+			for (uint32_t i = 0; passed && i < 2; i++)
+			{
+				samplers.push_back(device.createSampler(vk::SamplerCreateInfo()));
+			}
+		}
+		catch (vk::SystemError err)
+		{
+			passed = false;
+		}
+
+		//Two sets in the first pool, at most eight in a pool
+		sk::DescriptorAllocator allocator(device, 2, { { vk::DescriptorType::eSampler, 1.0f } }, 2, 8);
+
+		auto allocateSets = [&allocator, &layout](const uint32_t setCount)
+		{
+			bool allocated = true;
+			for (uint32_t i = 0; allocated && i < setCount; i++)
+			{
+				allocated = !sk::error(allocator.allocate(layout));
+			}
+
+			return allocated;
+		};
+
+		auto getSamplerSet = [&allocator, &layout](const vk::Sampler& sampler)
+		{
+			sk::DescriptorBinding binding = {};
+			binding.descriptorType = vk::DescriptorType::eSampler;
+			binding.sampler = sampler;
+
+			return sk::retLog(allocator.getImmutableSet(layout, { binding }));
+		};
+
+		if (passed)
+		{
+			/*POOL CHAIN GROWTH*/
+			//Seven sets exhaust the pools of two and four sets, the third pool holding eight
+			passed = !sk::error(allocator.beginFrame(0)) && allocateSets(7) && (allocator.getPoolCount() == 3);
+
+			/*IMMUTABLE SETS*/
+			const vk::DescriptorSet firstSet = getSamplerSet(samplers[0]);
+			const vk::DescriptorSet secondSet = getSamplerSet(samplers[1]);
+
+			passed = passed && firstSet && secondSet && (firstSet != secondSet);
+			passed = passed && (getSamplerSet(samplers[0]) == firstSet) && (allocator.getImmutableSetCount() == 2);
+
+			//The persistent chain got its own pool
+			const size_t poolCount = allocator.getPoolCount();
+			passed = passed && (poolCount == 4);
+
+			auto releaseResult = allocator.releaseImmutableSets(samplers[0]);
+			passed = passed && !sk::error(releaseResult) && (releaseResult.value == 1) && (allocator.getImmutableSetCount() == 1);
+			passed = passed && (sk::retLog(allocator.releaseImmutableSets(samplers[0])) == 0);
+
+			/*FRAME RESET*/
+			//Once the frame starts again its pools are reset and reused, and the set released during it can be rewritten
+			passed = passed && !sk::error(allocator.beginFrame(1)) && !sk::error(allocator.beginFrame(0));
+			passed = passed && allocateSets(7) && (allocator.getPoolCount() == poolCount);
+
+			passed = passed && (getSamplerSet(samplers[0]) == firstSet) && (allocator.getImmutableSetCount() == 2) && (allocator.getPoolCount() == poolCount);
+		}
+
+		passed = !sk::error(allocator.destroyPools()) && passed;
+		passed = passed && (allocator.getPoolCount() == 0) && (allocator.getImmutableSetCount() == 0);
+
+		for (const vk::Sampler& sampler : samplers)
+		{
+			device.destroySampler(sampler);
+		}
+
+		if (layout)
+		{
+			sk::logError(sk::destroyDescriptorSetLayout(device, layout));
+		}
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::DESCRIPTOR_ALLOCATOR_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the bindless slots : stable indices until exhaustion, released slots recycled only once the frames that may
+	* still use them ended, the layout of the draw indices push constant, arrays checked against the update after bind limits and
+	* registrations rejected before the set is created
+	*/
+	inline sk::SkResult<bool, sk::TestError> bindlessTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*STABLE INDICES*/
+		sk::DescriptorSlotAllocator slotAllocator(4, 2);
+		slotAllocator.beginFrame(0);
+
+		std::vector<uint32_t> slots;
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			auto allocateResult = slotAllocator.allocate();
+			passed = passed && !sk::logError(allocateResult) && (allocateResult.value == i);
+			slots.push_back(allocateResult.value);
+		}
+
+		passed = passed && (slotAllocator.allocate().error == sk::DescriptorError::BINDLESS_SLOTS_EXHAUSTED_ERROR) && (slotAllocator.getUsedCount() == 4);
+
+		/*DEFERRED RECYCLING*/
+		//Released during frame 0, the slot must survive frame 1 since frame 0 may still be executing
+		passed = passed && !sk::logError(slotAllocator.release(slots[1])) && !slotAllocator.isUsed(slots[1]);
+		passed = passed && (slotAllocator.release(slots[1]).error == sk::DescriptorError::INVALID_BINDLESS_INDEX_ERROR);
+		passed = passed && (slotAllocator.release(7).error == sk::DescriptorError::INVALID_BINDLESS_INDEX_ERROR);
+
+		slotAllocator.beginFrame(1);
+		passed = passed && (slotAllocator.allocate().error == sk::DescriptorError::BINDLESS_SLOTS_EXHAUSTED_ERROR);
+
+		slotAllocator.beginFrame(2);
+		auto recycledResult = slotAllocator.allocate();
+		passed = passed && !sk::logError(recycledResult) && (recycledResult.value == slots[1]) && (slotAllocator.getUsedCount() == 4);
+
+		//The other slots kept their indices
+		passed = passed && slotAllocator.isUsed(slots[0]) && slotAllocator.isUsed(slots[2]) && slotAllocator.isUsed(slots[3]);
+
+		passed = passed && (sk::getBindlessPushConstantRange().size == 16) && (sizeof(sk::BindlessDrawIndices) == 4 * sizeof(uint32_t));
+
+		/*LIMITS*/
+		vk::PhysicalDeviceDescriptorIndexingPropertiesEXT descriptorIndexingProperties = {};
+		descriptorIndexingProperties.maxDescriptorSetUpdateAfterBindSampledImages = 1024;
+		descriptorIndexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages = 1024;
+		descriptorIndexingProperties.maxDescriptorSetUpdateAfterBindStorageBuffers = 256;
+		descriptorIndexingProperties.maxPerStageDescriptorUpdateAfterBindStorageBuffers = 128;
+		descriptorIndexingProperties.maxDescriptorSetUpdateAfterBindSamplers = 16;
+		descriptorIndexingProperties.maxPerStageDescriptorUpdateAfterBindSamplers = 16;
+		descriptorIndexingProperties.maxPerStageUpdateAfterBindResources = 1100;
+
+		passed = passed && sk::retLog(sk::checkBindlessDescriptorLimits(descriptorIndexingProperties, 1024, 64, 12));
+		//The per stage limit is the lowest one, every array being visible to every stage
+		passed = passed && (sk::checkBindlessDescriptorLimits(descriptorIndexingProperties, 512, 200, 16).error == sk::DescriptorError::BINDLESS_LIMIT_EXCEEDED_ERROR);
+		passed = passed && (sk::checkBindlessDescriptorLimits(descriptorIndexingProperties, 512, 64, 32).error == sk::DescriptorError::BINDLESS_LIMIT_EXCEEDED_ERROR);
+		passed = passed && (sk::checkBindlessDescriptorLimits(descriptorIndexingProperties, 1024, 128, 16).error == sk::DescriptorError::BINDLESS_LIMIT_EXCEEDED_ERROR);
+
+		/*UNCREATED SET*/
+		sk::BindlessDescriptorSet bindlessDescriptorSet(vk::Device(nullptr), 4, 4, 4);
+		passed = passed && (bindlessDescriptorSet.registerSampler(vk::Sampler(nullptr)).error == sk::DescriptorError::BINDLESS_SET_NOT_CREATED_ERROR);
+		passed = passed && (bindlessDescriptorSet.getResourceCount(sk::BindlessResourceType::SAMPLER) == 0);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::BINDLESS_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Test of the bindless descriptor set on a device : a storage buffer and a sampled image registered at the first indices of their
+	* arrays, their indices recycled once released, registrations rejected after destruction
+	*
+	* @param skDevice The device the set and the resources are created on
+	* @param descriptorIndexing True if the device was created with enableDescriptorIndexing(), the test being skipped otherwise
+	*/
+	inline sk::SkResult<bool, sk::TestError> bindlessDeviceTest(sk::Device& skDevice, const bool descriptorIndexing)
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		//Update after bind descriptors need the features of enableDescriptorIndexing()
+		if (!descriptorIndexing)
+		{
+			return result;
+		}
+
+		vk::Device device = skDevice.get();
+		vk::PhysicalDevice physicalDevice = skDevice.getPhysicalDevice().get();
+
+		/*RESOURCES*/
+		const vk::Format format = vk::Format::eR8G8B8A8Unorm;
+
+		vk::Buffer buffer = sk::retLog(sk::createBuffer(device, 256, vk::BufferUsageFlagBits::eStorageBuffer, vk::SharingMode::eExclusive));
+		sk::MemoryAllocator allocator(physicalDevice, device);
+
+		bool passed = buffer && !sk::logError(allocator.allocateBind(buffer, vk::MemoryPropertyFlagBits::eDeviceLocal));
+
+		vk::ImageCreateInfo imageCreateInfo = {};
+		imageCreateInfo.imageType = vk::ImageType::e2D;
+		imageCreateInfo.format = format;
+		imageCreateInfo.extent = vk::Extent3D(64, 64, 1);
+		imageCreateInfo.mipLevels = 1;
+		imageCreateInfo.arrayLayers = 1;
+		imageCreateInfo.samples = vk::SampleCountFlagBits::e1;
+		imageCreateInfo.tiling = vk::ImageTiling::eOptimal;
+		imageCreateInfo.usage = vk::ImageUsageFlagBits::eSampled;
+		imageCreateInfo.sharingMode = vk::SharingMode::eExclusive;
+		imageCreateInfo.initialLayout = vk::ImageLayout::eUndefined;
+
+		vk::Image image = nullptr;
+		vk::ImageView imageView = nullptr;
+
+		try
+		{
+			image = device.createImage(imageCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			passed = false;
+		}
+
+		passed = passed && !sk::logError(allocator.allocateBind(image, vk::MemoryPropertyFlagBits::eDeviceLocal));
+
+		vk::ImageViewCreateInfo imageViewCreateInfo = {};
+		imageViewCreateInfo.image = image;
+		imageViewCreateInfo.viewType = vk::ImageViewType::e2D;
+		imageViewCreateInfo.format = format;
+		imageViewCreateInfo.subresourceRange = vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1);
+
+		try
+		{
+			imageView = (passed ? device.createImageView(imageViewCreateInfo) : vk::ImageView(nullptr));
+		}
+		catch (vk::SystemError err)
+		{
+			passed = false;
+		}
+
+		/*REGISTRATION*/
+		//Small arrays, within the limits guaranteed by every device supporting descriptor indexing
+		sk::BindlessDescriptorSet bindlessDescriptorSet(device, 64, 64, 8, 1);
+		passed = passed && sk::retLog(bindlessDescriptorSet.create(physicalDevice));
+		passed = passed && bindlessDescriptorSet.getDescriptorSetLayout() && bindlessDescriptorSet.getDescriptorSet();
+
+		auto registerStorageBufferResult = bindlessDescriptorSet.registerStorageBuffer(buffer);
+		auto registerSampledImageResult = bindlessDescriptorSet.registerSampledImage(imageView);
+		passed = passed && !sk::logError(registerStorageBufferResult) && (registerStorageBufferResult.value == 0);
+		passed = passed && !sk::logError(registerSampledImageResult) && (registerSampledImageResult.value == 0);
+		passed = passed && (bindlessDescriptorSet.getResourceCount(sk::BindlessResourceType::STORAGE_BUFFER) == 1)
+			&& (bindlessDescriptorSet.getResourceCount(sk::BindlessResourceType::SAMPLED_IMAGE) == 1);
+
+		/*RECYCLING*/
+		//With a single frame in flight, a released index comes back at the next frame
+		passed = passed && !sk::logError(bindlessDescriptorSet.release(sk::BindlessResourceType::STORAGE_BUFFER, registerStorageBufferResult.value));
+		bindlessDescriptorSet.beginFrame(0);
+		passed = passed && (sk::retLog(bindlessDescriptorSet.registerStorageBuffer(buffer, 0, 128)) == registerStorageBufferResult.value);
+
+		passed = !sk::logError(bindlessDescriptorSet.destroy()) && passed;
+		passed = passed && (bindlessDescriptorSet.registerStorageBuffer(buffer).error == sk::DescriptorError::BINDLESS_SET_NOT_CREATED_ERROR);
+
+		if (imageView)
+		{
+			device.destroyImageView(imageView);
+		}
+
+		if (image)
+		{
+			device.destroyImage(image);
+		}
+
+		if (buffer)
+		{
+			sk::logError(sk::destroyBuffer(device, buffer));
+		}
+
+		passed = !sk::logError(allocator.freeAllMemory()) && passed;
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::BINDLESS_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the frame ring allocator : aligned allocations bumped in the region of the current frame, full regions rejected,
+	* regions reused once their frame starts again and rings too large for dynamic offsets detected
+	*/
+	inline sk::SkResult<bool, sk::TestError> frameRingTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*ALIGNMENT*/
+		passed = passed && (sk::retLog(sk::getAlignedOffset(256, 0)) == 0) && (sk::retLog(sk::getAlignedOffset(256, 1)) == 256);
+		passed = passed && (sk::retLog(sk::getAlignedOffset(256, 256)) == 256) && (sk::retLog(sk::getAlignedOffset(64, 200)) == 256);
+
+		/*REGIONS*/
+		//1000 bytes rounded up to 1024, every draw taking a whole 256 bytes slot
+		sk::FrameRingAllocator ringAllocator(1000, 2, 256);
+		passed = passed && (ringAllocator.getFrameSize() == 1024) && (ringAllocator.getBufferSize() == 2048);
+
+		ringAllocator.beginFrame(0);
+		for (vk::DeviceSize i = 0; i < 4; i++)
+		{
+			auto allocateResult = ringAllocator.allocate(sizeof(sk::DrawData));
+			passed = passed && !sk::logError(allocateResult) && (allocateResult.value == i * 256);
+		}
+
+		passed = passed && (ringAllocator.allocate(sizeof(sk::DrawData)).error == sk::BufferError::RING_BUFFER_FULL_ERROR);
+		passed = passed && (ringAllocator.getFrameUsage() == 3 * 256 + sizeof(sk::DrawData));
+
+		//The next frame writes into its own region, never into the one the GPU may still read
+		ringAllocator.beginFrame(1);
+		auto secondFrameResult = ringAllocator.allocate(16);
+		passed = passed && !sk::logError(secondFrameResult) && (secondFrameResult.value == 1024);
+
+		ringAllocator.beginFrame(2);
+		auto thirdFrameResult = ringAllocator.allocate(16);
+		passed = passed && !sk::logError(thirdFrameResult) && (thirdFrameResult.value == 0) && (ringAllocator.getFrameUsage() == 16);
+
+		//Dynamic offsets being 32 bits, a uniform ring holds at most 4 GiB
+		passed = passed && sk::isDynamicOffsetRange(sk::FrameRingAllocator(vk::DeviceSize(1) << 31, 2, 256).getBufferSize());
+		passed = passed && !sk::isDynamicOffsetRange(sk::FrameRingAllocator(vk::DeviceSize(1) << 31, 3, 256).getBufferSize());
+
+		/*DRAW DATA*/
+		sk::DrawData drawData(skm::translation(1.f, 2.f, 3.f), 7);
+		passed = passed && (drawData.materialIndex == 7) && (sk::getDrawPushConstantRange().size == sizeof(sk::DrawData));
+		passed = passed && (offsetof(sk::DrawData, materialIndex) == 64);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::FRAME_RING_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the render graph : pass sorting and culling, merging of passes into subpasses, barriers and load/store operations
+	* deduced from the uses, recompilation after a change and cycle detection
+	*/
+	inline sk::SkResult<bool, sk::TestError> renderGraphTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*GRAPH*/
+		//Passes declared out of order, the debug pass writing an image nobody reads
+		sk::RenderGraph renderGraph;
+		const vk::Extent2D extent = { 1280, 720 };
+
+		const uint32_t swapchain = renderGraph.importSwapchainImage("swapchain", vk::Format::eB8G8R8A8Srgb, extent);
+		const uint32_t shadowMap = renderGraph.addImage("shadowMap", vk::Format::eD32Sfloat, { 2048, 2048 });
+		const uint32_t albedo = renderGraph.addImage("albedo", vk::Format::eR8G8B8A8Unorm, extent);
+		const uint32_t depth = renderGraph.addImage("depth", vk::Format::eD32Sfloat, extent);
+		const uint32_t hdr = renderGraph.addImage("hdr", vk::Format::eR16G16B16A16Sfloat, extent);
+		const uint32_t debug = renderGraph.addImage("debug", vk::Format::eR8G8B8A8Unorm, extent);
+		const uint32_t particles = renderGraph.addBuffer("particles", 65536);
+
+		passed = passed && !sk::logError(renderGraph.setClearValue(shadowMap, vk::ClearValue()));
+		passed = passed && !sk::logError(renderGraph.setClearValue(albedo, vk::ClearValue()));
+		passed = passed && !sk::logError(renderGraph.setClearValue(depth, vk::ClearValue()));
+
+		const uint32_t debugPass = renderGraph.addPass("debug", sk::RenderGraphPassType::GRAPHICS, nullptr);
+		const uint32_t shadowPass = renderGraph.addPass("shadow", sk::RenderGraphPassType::GRAPHICS, nullptr);
+		const uint32_t particlePass = renderGraph.addPass("particles", sk::RenderGraphPassType::COMPUTE, nullptr);
+		const uint32_t postPass = renderGraph.addPass("post", sk::RenderGraphPassType::GRAPHICS, nullptr);
+		const uint32_t gbufferPass = renderGraph.addPass("gbuffer", sk::RenderGraphPassType::GRAPHICS, nullptr);
+		const uint32_t lightingPass = renderGraph.addPass("lighting", sk::RenderGraphPassType::GRAPHICS, nullptr);
+
+		passed = passed && sk::retLog(renderGraph.use(debugPass, debug, sk::RenderGraphUsage::COLOR_ATTACHMENT));
+		passed = passed && sk::retLog(renderGraph.use(shadowPass, shadowMap, sk::RenderGraphUsage::DEPTH_ATTACHMENT));
+		passed = passed && sk::retLog(renderGraph.use(particlePass, depth, sk::RenderGraphUsage::SAMPLED));
+		passed = passed && sk::retLog(renderGraph.use(particlePass, particles, sk::RenderGraphUsage::STORAGE_WRITE));
+		passed = passed && sk::retLog(renderGraph.use(postPass, hdr, sk::RenderGraphUsage::SAMPLED));
+		passed = passed && sk::retLog(renderGraph.use(postPass, particles, sk::RenderGraphUsage::VERTEX_READ));
+		passed = passed && sk::retLog(renderGraph.use(postPass, swapchain, sk::RenderGraphUsage::COLOR_ATTACHMENT));
+		passed = passed && sk::retLog(renderGraph.use(gbufferPass, albedo, sk::RenderGraphUsage::COLOR_ATTACHMENT));
+		passed = passed && sk::retLog(renderGraph.use(gbufferPass, depth, sk::RenderGraphUsage::DEPTH_ATTACHMENT));
+		passed = passed && sk::retLog(renderGraph.use(lightingPass, albedo, sk::RenderGraphUsage::INPUT_ATTACHMENT));
+		passed = passed && sk::retLog(renderGraph.use(lightingPass, depth, sk::RenderGraphUsage::DEPTH_READ_ONLY));
+		passed = passed && sk::retLog(renderGraph.use(lightingPass, shadowMap, sk::RenderGraphUsage::SAMPLED));
+		passed = passed && sk::retLog(renderGraph.use(lightingPass, hdr, sk::RenderGraphUsage::COLOR_ATTACHMENT));
+
+		//Attachments belong to graphics passes, a resource is used once per pass
+		passed = passed && (renderGraph.use(particlePass, hdr, sk::RenderGraphUsage::COLOR_ATTACHMENT).error == sk::RenderGraphError::INVALID_USAGE_ERROR);
+		passed = passed && (renderGraph.use(postPass, hdr, sk::RenderGraphUsage::STORAGE_READ).error == sk::RenderGraphError::INVALID_USAGE_ERROR);
+		passed = passed && (renderGraph.execute(vk::CommandBuffer()).error == sk::RenderGraphError::NOT_COMPILED_ERROR);
+
+		passed = passed && sk::retLog(renderGraph.compile());
+
+		/*SORT AND CULLING*/
+		//The lighting pass runs right after the gbuffer pass to share its render pass
+		const std::vector<uint32_t> expectedOrder = { shadowPass, gbufferPass, lightingPass, particlePass, postPass };
+		passed = passed && (renderGraph.getSortedPasses() == expectedOrder) && renderGraph.isPassCulled(debugPass) && !renderGraph.isPassCulled(shadowPass);
+
+		const std::vector<sk::RenderGraphPassGroup>& groups = renderGraph.getPassGroups();
+		passed = passed && (groups.size() == 4);
+
+		if (passed)
+		{
+			/*SHADOW*/
+			passed = passed && groups[0].usesRenderPass && (groups[0].attachments.size() == 1) && (groups[0].barriers.barriers.size() == 1);
+			passed = passed && (groups[0].attachments[0].loadOp == vk::AttachmentLoadOp::eClear) && (groups[0].attachments[0].storeOp == vk::AttachmentStoreOp::eStore);
+
+			/*GBUFFER AND LIGHTING*/
+			const sk::RenderGraphPassGroup& deferredGroup = groups[1];
+			passed = passed && deferredGroup.usesRenderPass && (deferredGroup.passes.size() == 2) && (deferredGroup.attachments.size() == 3);
+			passed = passed && (deferredGroup.barriers.barriers.size() == 4);
+
+			for (const sk::RenderGraphBarrier& barrier : deferredGroup.barriers.barriers)
+			{
+				if (barrier.resource == shadowMap)
+				{
+					passed = passed && (barrier.oldLayout == vk::ImageLayout::eDepthStencilAttachmentOptimal) && (barrier.newLayout == vk::ImageLayout::eShaderReadOnlyOptimal);
+					passed = passed && (barrier.srcAccess == vk::AccessFlags(vk::AccessFlagBits::eDepthStencilAttachmentWrite));
+				}
+				else
+				{
+					passed = passed && (barrier.oldLayout == vk::ImageLayout::eUndefined);
+				}
+			}
+
+			for (const sk::RenderGraphAttachment& attachment : deferredGroup.attachments)
+			{
+				if (attachment.resource == albedo)
+				{
+					//Only read inside the render pass : never written to memory
+					passed = passed && (attachment.loadOp == vk::AttachmentLoadOp::eClear) && (attachment.storeOp == vk::AttachmentStoreOp::eDontCare);
+					passed = passed && (attachment.finalLayout == vk::ImageLayout::eShaderReadOnlyOptimal) && (attachment.lastSubpass == 1);
+				}
+				else if (attachment.resource == depth)
+				{
+					passed = passed && (attachment.storeOp == vk::AttachmentStoreOp::eStore) && (attachment.finalLayout == vk::ImageLayout::eDepthStencilReadOnlyOptimal);
+				}
+				else
+				{
+					passed = passed && (attachment.resource == hdr) && (attachment.loadOp == vk::AttachmentLoadOp::eDontCare) && (attachment.storeOp == vk::AttachmentStoreOp::eStore);
+				}
+			}
+
+			passed = passed && (deferredGroup.subpassDependencies.size() == 1);
+			if (passed)
+			{
+				const vk::SubpassDependency& subpassDependency = deferredGroup.subpassDependencies[0];
+				passed = passed && (subpassDependency.srcSubpass == 0) && (subpassDependency.dstSubpass == 1);
+				passed = passed && static_cast<bool>(subpassDependency.srcAccessMask & vk::AccessFlagBits::eColorAttachmentWrite);
+				passed = passed && static_cast<bool>(subpassDependency.dstAccessMask & vk::AccessFlagBits::eInputAttachmentRead);
+			}
+
+			/*PARTICLES*/
+			//The first write of a buffer waits for nothing
+			passed = passed && !groups[2].usesRenderPass && (groups[2].barriers.barriers.size() == 1) && (groups[2].barriers.barriers[0].resource == depth);
+			passed = passed && (groups[2].barriers.dstStages == vk::PipelineStageFlags(vk::PipelineStageFlagBits::eComputeShader));
+
+			/*POST*/
+			passed = passed && (groups[3].barriers.barriers.size() == 3) && static_cast<bool>(groups[3].barriers.srcStages & vk::PipelineStageFlagBits::eComputeShader);
+			passed = passed && static_cast<bool>(groups[3].barriers.dstStages & vk::PipelineStageFlagBits::eVertexInput);
+
+			const sk::RenderGraphBarrierBatch& finalBarriers = renderGraph.getFinalBarriers();
+			passed = passed && (finalBarriers.barriers.size() == 1) && (finalBarriers.barriers[0].resource == swapchain);
+			passed = passed && (finalBarriers.barriers[0].oldLayout == vk::ImageLayout::eColorAttachmentOptimal) && (finalBarriers.barriers[0].newLayout == vk::ImageLayout::ePresentSrcKHR);
+		}
+
+		/*RECOMPILATION*/
+		//A clear value changes the load operation of the image : the graph must be compiled again
+		passed = passed && !sk::logError(renderGraph.setClearValue(hdr, vk::ClearValue()));
+		passed = passed && (renderGraph.execute(vk::CommandBuffer()).error == sk::RenderGraphError::NOT_COMPILED_ERROR);
+		passed = passed && sk::retLog(renderGraph.compile()) && (renderGraph.getPassGroups().size() == 4);
+
+		if (passed)
+		{
+			for (const sk::RenderGraphAttachment& attachment : renderGraph.getPassGroups()[1].attachments)
+			{
+				passed = passed && ((attachment.resource != hdr) || (attachment.loadOp == vk::AttachmentLoadOp::eClear));
+			}
+		}
+
+		//No framebuffer was created without device
+		auto releaseImageViewsResult = renderGraph.releaseImageViews({ vk::ImageView() });
+		passed = passed && !sk::logError(releaseImageViewsResult) && (releaseImageViewsResult.value == 0);
+
+		/*CYCLE*/
+		sk::RenderGraph cyclicGraph;
+		const uint32_t first = cyclicGraph.addBuffer("first", 256);
+		const uint32_t second = cyclicGraph.addBuffer("second", 256);
+		const uint32_t firstPass = cyclicGraph.addPass("firstPass", sk::RenderGraphPassType::COMPUTE, nullptr, true);
+		const uint32_t secondPass = cyclicGraph.addPass("secondPass", sk::RenderGraphPassType::COMPUTE, nullptr, true);
+
+		passed = passed && sk::retLog(cyclicGraph.use(firstPass, first, sk::RenderGraphUsage::STORAGE_READ));
+		passed = passed && sk::retLog(cyclicGraph.use(firstPass, second, sk::RenderGraphUsage::STORAGE_WRITE));
+		passed = passed && sk::retLog(cyclicGraph.use(secondPass, second, sk::RenderGraphUsage::STORAGE_READ));
+		passed = passed && sk::retLog(cyclicGraph.use(secondPass, first, sk::RenderGraphUsage::STORAGE_WRITE));
+		passed = passed && (cyclicGraph.compile().error == sk::RenderGraphError::DEPENDENCY_CYCLE_ERROR);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::RENDER_GRAPH_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the transient aliasing : placement of resources with disjoint lifetimes, memory saved on the render targets
+	* of a 4K frame, and the aliasing barriers the render graph records before the first use of an aliased image
+	*/
+	inline sk::SkResult<bool, sk::TestError> transientAliasingTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*PLACEMENT*/
+		//The third resource lives after the first one and takes its place
+		std::vector<sk::TransientAllocationRequest> requests = { { 1000, 256, 0, 1 }, { 1000, 256, 0, 1 }, { 1000, 256, 2, 3 } };
+		auto planResult = sk::planTransientAliasing(requests);
+		passed = passed && !sk::logError(planResult);
+		passed = passed && (planResult.value.offsets == std::vector<vk::DeviceSize>{ 0, 1024, 0 }) && (planResult.value.size == 2024) && (planResult.value.unaliasedSize == 3048);
+		passed = passed && (planResult.value.aliases.size() == 1) && (planResult.value.aliases[0].a == 2) && (planResult.value.aliases[0].b == 0);
+
+		requests.push_back({ 16, 16, 3, 2 });
+		passed = passed && (sk::planTransientAliasing(requests).error == sk::AllocationError::INVALID_TRANSIENT_LIFETIME_ERROR);
+
+		//Render targets of a 4K frame (gbuffer, ambient occlusion, lighting, bloom chain, post processing), lifetimes in pass groups
+		const vk::DeviceSize pixels = 3840 * 2160;
+		const std::vector<sk::TransientAllocationRequest> frameRequests = {
+			{ pixels * 4, 65536, 0, 1 },    //albedo
+			{ pixels * 8, 65536, 0, 1 },    //normals
+			{ pixels * 4, 65536, 0, 2 },    //depth
+			{ pixels, 65536, 1, 2 },        //ambient occlusion
+			{ pixels, 65536, 2, 3 },        //blurred ambient occlusion
+			{ pixels * 8, 65536, 3, 4 },    //hdr
+			{ pixels * 2, 65536, 4, 5 },    //bloom 1/2
+			{ pixels / 2, 65536, 5, 6 },    //bloom 1/4
+			{ pixels / 8, 65536, 6, 7 },    //bloom 1/8
+			{ pixels * 8, 65536, 7, 8 },    //bloom composite
+			{ pixels * 8, 65536, 8, 9 },    //depth of field
+			{ pixels * 8, 65536, 9, 10 },   //motion blur
+			{ pixels * 4, 65536, 10, 11 },  //tonemapped
+			{ pixels * 4, 65536, 11, 12 }   //antialiased
+		};
+
+		auto framePlanResult = sk::planTransientAliasing(frameRequests);
+		passed = passed && !sk::logError(framePlanResult) && (framePlanResult.value.size * 2 <= framePlanResult.value.unaliasedSize);
+
+		for (size_t i = 0; i < frameRequests.size() && passed; i++)
+		{
+			for (size_t j = i + 1; j < frameRequests.size(); j++)
+			{
+				const bool aliveTogether = (frameRequests[i].firstUse <= frameRequests[j].lastUse && frameRequests[j].firstUse <= frameRequests[i].lastUse);
+				const bool sharedMemory = (framePlanResult.value.offsets[i] < framePlanResult.value.offsets[j] + frameRequests[j].size
+					&& framePlanResult.value.offsets[j] < framePlanResult.value.offsets[i] + frameRequests[i].size);
+
+				passed = passed && !(aliveTogether && sharedMemory) && (framePlanResult.value.offsets[i] % frameRequests[i].alignment == 0);
+			}
+		}
+
+		/*RENDER GRAPH*/
+		sk::RenderGraph renderGraph;
+		const vk::Extent2D extent = { 1280, 720 };
+
+		const uint32_t swapchain = renderGraph.importSwapchainImage("swapchain", vk::Format::eB8G8R8A8Srgb, extent);
+		const uint32_t scene = renderGraph.addImage("scene", vk::Format::eR16G16B16A16Sfloat, extent);
+		const uint32_t blurred = renderGraph.addImage("blurred", vk::Format::eR16G16B16A16Sfloat, extent);
+		const uint32_t overlay = renderGraph.addImage("overlay", vk::Format::eR16G16B16A16Sfloat, extent);
+
+		const uint32_t scenePass = renderGraph.addPass("scene", sk::RenderGraphPassType::GRAPHICS, nullptr);
+		const uint32_t blurPass = renderGraph.addPass("blur", sk::RenderGraphPassType::GRAPHICS, nullptr);
+		const uint32_t compositePass = renderGraph.addPass("composite", sk::RenderGraphPassType::GRAPHICS, nullptr);
+
+		passed = passed && sk::retLog(renderGraph.use(scenePass, scene, sk::RenderGraphUsage::COLOR_ATTACHMENT));
+		passed = passed && sk::retLog(renderGraph.use(blurPass, scene, sk::RenderGraphUsage::SAMPLED));
+		passed = passed && sk::retLog(renderGraph.use(blurPass, blurred, sk::RenderGraphUsage::COLOR_ATTACHMENT));
+		passed = passed && sk::retLog(renderGraph.use(compositePass, blurred, sk::RenderGraphUsage::SAMPLED));
+		passed = passed && sk::retLog(renderGraph.use(compositePass, overlay, sk::RenderGraphUsage::COLOR_ATTACHMENT));
+		passed = passed && sk::retLog(renderGraph.use(compositePass, swapchain, sk::RenderGraphUsage::COLOR_ATTACHMENT));
+		passed = passed && sk::retLog(renderGraph.compile());
+
+		const sk::RenderGraphLifetime sceneLifetime = sk::retLog(renderGraph.getResourceLifetime(scene));
+		const sk::RenderGraphLifetime overlayLifetime = sk::retLog(renderGraph.getResourceLifetime(overlay));
+		passed = passed && (sceneLifetime.firstGroup == 0) && (sceneLifetime.lastGroup == 1) && (overlayLifetime.firstGroup == 2) && (overlayLifetime.lastGroup == 2);
+
+		//The overlay never leaves its render pass, the scene is sampled
+		passed = passed && renderGraph.isTransientAttachment(overlay) && !renderGraph.isTransientAttachment(scene) && !renderGraph.isTransientAttachment(swapchain);
+		passed = passed && static_cast<bool>(sk::retLog(renderGraph.getImageUsage(overlay)) & vk::ImageUsageFlagBits::eTransientAttachment);
+		passed = passed && (sk::retLog(renderGraph.getImageUsage(scene)) == (vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eSampled));
+
+		//Once aliased, the first use of the overlay waits for the blur pass sampling the scene
+		passed = passed && (renderGraph.getPassGroups().size() == 3) && !(renderGraph.getPassGroups()[2].barriers.srcStages & vk::PipelineStageFlagBits::eFragmentShader);
+		passed = passed && sk::retLog(renderGraph.addAliasDependency(overlay, scene));
+		passed = passed && sk::retLog(renderGraph.compile());
+		passed = passed && (renderGraph.getPassGroups().size() == 3) && static_cast<bool>(renderGraph.getPassGroups()[2].barriers.srcStages & vk::PipelineStageFlagBits::eFragmentShader);
+
+		passed = passed && sk::retLog(renderGraph.addAliasDependency(blurred, scene));
+		passed = passed && (renderGraph.compile().error == sk::RenderGraphError::ALIASED_LIFETIME_ERROR);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::TRANSIENT_ALIASING_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Test of the transient memory allocator on a device : images whose lifetimes do not overlap are bound to overlapping ranges of one pool,
+	* an image alive during both of them getting its own range, transient attachments going to lazily allocated memory when the device has some
+	*
+	* @param skDevice The device the images and their memory are created on
+	*/
+	inline sk::SkResult<bool, sk::TestError> transientAliasingDeviceTest(sk::Device& skDevice)
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		vk::Device device = skDevice.get();
+		vk::PhysicalDevice physicalDevice = skDevice.getPhysicalDevice().get();
+
+		/*IMAGES*/
+		vk::ImageCreateInfo imageCreateInfo = {};
+		imageCreateInfo.imageType = vk::ImageType::e2D;
+		imageCreateInfo.format = vk::Format::eR8G8B8A8Unorm;
+		imageCreateInfo.extent = vk::Extent3D(256, 256, 1);
+		imageCreateInfo.mipLevels = 1;
+		imageCreateInfo.arrayLayers = 1;
+		imageCreateInfo.samples = vk::SampleCountFlagBits::e1;
+		imageCreateInfo.tiling = vk::ImageTiling::eOptimal;
+		imageCreateInfo.usage = vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransientAttachment;
+		imageCreateInfo.sharingMode = vk::SharingMode::eExclusive;
+		imageCreateInfo.initialLayout = vk::ImageLayout::eUndefined;
+
+		std::vector<vk::Image> images;
+		try
+		{
+			for (uint32_t i = 0; i < 3; i++)
+			{
+				images.push_back(device.createImage(imageCreateInfo));
+			}
+		}
+		catch (vk::SystemError err)
+		{
+			passed = false;
+		}
+
+		sk::TransientMemoryAllocator allocator(physicalDevice, device);
+
+		if (passed)
+		{
+			/*ALIASING*/
+			//The first image lives in group 0, the second one in group 1, the third one in both
+			auto allocateBindResult = allocator.allocateBind({ { images[0], 0, 0, true }, { images[1], 1, 1, true }, { images[2], 0, 1, true } });
+			const std::vector<sk::Pair<uint32_t, uint32_t>>& aliases = allocateBindResult.value;
+			passed = !sk::logError(allocateBindResult) && (aliases.size() == 1) && (aliases[0].a == 1) && (aliases[0].b == 0);
+			passed = passed && (sk::retLog(allocator.getNumberOfPools()) == 1) && (sk::retLog(allocator.getAllocatedSize()) < sk::retLog(allocator.getUnaliasedSize()));
+			passed = passed && (allocator.getImageAllocation(3).error == sk::AllocationError::INVALID_TRANSIENT_IMAGE_ERROR);
+
+			std::vector<sk::Pair<uint64_t, uint64_t>> ranges;
+			for (uint32_t i = 0; passed && i < images.size(); i++)
+			{
+				auto getImageAllocationResult = allocator.getImageAllocation(i);
+				sk::MemoryPool* pPool = sk::retLog(allocator.getPoolById(getImageAllocationResult.value.a));
+				sk::MemoryBlock* pBlock = (pPool ? sk::retLog(pPool->getBlockById(getImageAllocationResult.value.b)) : nullptr);
+
+				passed = !sk::logError(getImageAllocationResult) && (getImageAllocationResult.value.a == 0) && pBlock;
+				if (passed)
+				{
+					const uint64_t origin = sk::retLog(pBlock->getOrigin());
+					ranges.emplace_back(origin, origin + static_cast<uint64_t>(sk::retLog(pBlock->getSize())));
+				}
+			}
+
+			auto overlap = [&ranges](const uint32_t first, const uint32_t second)
+			{
+				return (ranges[first].a < ranges[second].b) && (ranges[second].a < ranges[first].b);
+			};
+
+			passed = passed && overlap(0, 1) && !overlap(0, 2) && !overlap(1, 2);
+
+			/*LAZILY ALLOCATED MEMORY*/
+			//Transient attachments fall back to device local memory on GPUs without lazily allocated memory
+			const vk::MemoryRequirements memoryRequirements = device.getImageMemoryRequirements(images[0]);
+			const bool lazilyAllocated = !sk::error(sk::getMemoryTypeIndex(physicalDevice, memoryRequirements.memoryTypeBits,
+				vk::MemoryPropertyFlagBits::eDeviceLocal | vk::MemoryPropertyFlagBits::eLazilyAllocated));
+
+			sk::MemoryPool* pPool = sk::retLog(allocator.getPoolById(0));
+			passed = passed && pPool;
+			passed = passed && (static_cast<bool>(sk::retLog(pPool->getMemoryType()).propertyFlags & vk::MemoryPropertyFlagBits::eLazilyAllocated) == lazilyAllocated);
+		}
+
+		for (const vk::Image& image : images)
+		{
+			device.destroyImage(image);
+		}
+
+		passed = !sk::logError(allocator.freeAllMemory()) && passed;
+		passed = passed && (sk::retLog(allocator.getNumberOfPools()) == 0) && (allocator.getImageAllocation(0).error == sk::AllocationError::INVALID_TRANSIENT_IMAGE_ERROR);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::TRANSIENT_ALIASING_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the render targets : the highest supported sample count must be picked, multisampled color and depth attachments
+	* must never be stored while the resolved swapchain image is, and framebuffer attachments must be ordered as the render pass expects them
+	*/
+	inline sk::SkResult<bool, sk::TestError> renderTargetTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*SAMPLE COUNT*/
+		const vk::SampleCountFlags sampleCounts = vk::SampleCountFlagBits::e1 | vk::SampleCountFlagBits::e2 | vk::SampleCountFlagBits::e4 | vk::SampleCountFlagBits::e8;
+		passed = passed && (sk::getHighestSampleCount(sampleCounts, vk::SampleCountFlagBits::e4) == vk::SampleCountFlagBits::e4);
+		passed = passed && (sk::getHighestSampleCount(sampleCounts, vk::SampleCountFlagBits::e64) == vk::SampleCountFlagBits::e8);
+		passed = passed && (sk::getHighestSampleCount(vk::SampleCountFlagBits::e1, vk::SampleCountFlagBits::e8) == vk::SampleCountFlagBits::e1);
+
+		/*ATTACHMENTS*/
+		//Depth only : the swapchain image is rendered into and stored, depth is never stored
+		auto depthAttachmentsResult = sk::createRenderTargetAttachmentDescriptions(vk::Format::eB8G8R8A8Srgb, vk::Format::eD32Sfloat, vk::SampleCountFlagBits::e1);
+		const std::vector<vk::AttachmentDescription>& depthAttachments = depthAttachmentsResult.value;
+		passed = passed && !sk::logError(depthAttachmentsResult) && (depthAttachments.size() == 2);
+		passed = passed && (depthAttachments[0].storeOp == vk::AttachmentStoreOp::eStore) && (depthAttachments[0].finalLayout == vk::ImageLayout::ePresentSrcKHR);
+		passed = passed && (depthAttachments[1].format == vk::Format::eD32Sfloat) && (depthAttachments[1].storeOp == vk::AttachmentStoreOp::eDontCare);
+
+		//MSAA : multisampled color and depth stay on tile, only the resolved swapchain image is stored
+		auto msaaAttachmentsResult = sk::createRenderTargetAttachmentDescriptions(vk::Format::eB8G8R8A8Srgb, vk::Format::eD32Sfloat, vk::SampleCountFlagBits::e4);
+		const std::vector<vk::AttachmentDescription>& msaaAttachments = msaaAttachmentsResult.value;
+		passed = passed && !sk::logError(msaaAttachmentsResult) && (msaaAttachments.size() == 3);
+		passed = passed && (msaaAttachments[0].samples == vk::SampleCountFlagBits::e4) && (msaaAttachments[0].storeOp == vk::AttachmentStoreOp::eDontCare);
+		passed = passed && (msaaAttachments[1].samples == vk::SampleCountFlagBits::e4) && (msaaAttachments[1].storeOp == vk::AttachmentStoreOp::eDontCare);
+		passed = passed && (msaaAttachments[2].samples == vk::SampleCountFlagBits::e1) && (msaaAttachments[2].storeOp == vk::AttachmentStoreOp::eStore);
+		passed = passed && (msaaAttachments[2].finalLayout == vk::ImageLayout::ePresentSrcKHR);
+
+		passed = passed && (sk::createRenderTargetAttachmentDescriptions(vk::Format::eB8G8R8A8Srgb, vk::Format::eUndefined, vk::SampleCountFlagBits::e4).value.size() == 2);
+
+		/*FRAMEBUFFERS*/
+		const std::vector<vk::ImageView> swapchainImageViews = { reinterpret_cast<VkImageView>(uint64_t(1)), reinterpret_cast<VkImageView>(uint64_t(2)) };
+		const vk::ImageView colorImageView = reinterpret_cast<VkImageView>(uint64_t(3));
+		const vk::ImageView depthImageView = reinterpret_cast<VkImageView>(uint64_t(4));
+
+		auto msaaFramebuffersResult = sk::getRenderTargetFramebufferAttachments(swapchainImageViews, colorImageView, depthImageView);
+		passed = passed && !sk::logError(msaaFramebuffersResult) && (msaaFramebuffersResult.value.size() == 2);
+		passed = passed && (msaaFramebuffersResult.value[1] == std::vector<vk::ImageView>{ colorImageView, depthImageView, swapchainImageViews[1] });
+
+		auto depthFramebuffersResult = sk::getRenderTargetFramebufferAttachments(swapchainImageViews, vk::ImageView(nullptr), depthImageView);
+		passed = passed && (depthFramebuffersResult.value[0] == std::vector<vk::ImageView>{ swapchainImageViews[0], depthImageView });
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::RENDER_TARGET_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the GPU profiler : timestamp deltas across a 32 bits wrap around, and zones resolved from their timestamps with
+	* their nesting depth, open zones being skipped and timestamps still in flight or missing being reported
+	*/
+	inline sk::SkResult<bool, sk::TestError> gpuProfilerTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*TIMESTAMPS*/
+		passed = passed && (sk::retLog(sk::getTimestampDuration(1000, 2001000, 64, 0.5f)) == 1.0);
+
+		//32 bits counters wrap around during the zone
+		passed = passed && (sk::retLog(sk::getTimestampDuration(0xFFFFFF00, 0x100, 32, 1.0f)) == 0.000512);
+		passed = passed && (sk::getTimestampDuration(0, 1, 0, 1.0f).error == sk::GpuProfilerError::TIMESTAMPS_NOT_SUPPORTED_ERROR);
+
+		/*ZONES*/
+		//A frame zone holding a shadow pass, then a lighting zone left open
+		std::vector<sk::GpuZoneQueries> zones(3);
+		zones[0].name = "frame";
+		zones[0].beginQuery = 0;
+		zones[0].endQuery = 3;
+		zones[1].name = "shadows";
+		zones[1].depth = 1;
+		zones[1].beginQuery = 1;
+		zones[1].endQuery = 2;
+		zones[2].name = "lighting";
+		zones[2].beginQuery = 4;
+
+		//(timestamp, availability) pairs, in nanoseconds with a period of 1
+		std::vector<uint64_t> queryResults = { 1000000, 1, 1500000, 1, 3500000, 1, 5000000, 1, 5000000, 0 };
+
+		auto resolveGpuZonesResult = sk::resolveGpuZones(zones, queryResults, 64, 1.0f);
+		const std::vector<sk::GpuZoneTiming>& timings = resolveGpuZonesResult.value;
+		passed = passed && !sk::logError(resolveGpuZonesResult) && (timings.size() == 2);
+		passed = passed && (timings[0].name == "frame") && (timings[0].depth == 0) && (timings[0].milliseconds == 4.0);
+		passed = passed && (timings[1].name == "shadows") && (timings[1].depth == 1) && (timings[1].milliseconds == 2.0);
+
+		//Timestamps still in flight are never waited for
+		queryResults[7] = 0;
+		passed = passed && (sk::resolveGpuZones(zones, queryResults, 64, 1.0f).error == sk::GpuProfilerError::RESULTS_NOT_AVAILABLE_ERROR);
+		passed = passed && (sk::resolveGpuZones(zones, std::vector<uint64_t>(4, 1), 64, 1.0f).error == sk::GpuProfilerError::QUERY_RESULTS_ERROR);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::GPU_PROFILER_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief Test of the GPU profiler on a device : frames of a render graph clearing an image are timed, the next beginFrame() reading back
+	* the zone of the previous frame and the zone of its pass nested in it
+	*
+	* @param skDevice The device the queue, the image and the query pools are created on
+	* @param queueFamilyIndexes The queue family indexes the device was created with
+	*/
+	inline sk::SkResult<bool, sk::TestError> gpuProfilerDeviceTest(sk::Device& skDevice, const std::array<uint32_t, 6>& queueFamilyIndexes)
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		vk::Device device = skDevice.get();
+		vk::PhysicalDevice physicalDevice = skDevice.getPhysicalDevice().get();
+
+		sk::Queue generalQueue = skDevice.getQueue(sk::QueueFamilyType::GENERAL, queueFamilyIndexes, 0);
+
+		//One frame in flight, its fence being waited on before the next frame reads its timings back
+		sk::GpuProfiler profiler(physicalDevice, device, generalQueue.getFamilyIndex(), 1, 8);
+
+		//A queue family without timestamps has nothing to be timed
+		if (!profiler.isSupported())
+		{
+			return result;
+		}
+
+		/*RESOURCES*/
+		vk::CommandPool commandPool = sk::retLog(sk::createCommandPool(device, queueFamilyIndexes, sk::QueueFamilyType::GENERAL));
+		vk::CommandBuffer commandBuffer = (commandPool ? sk::retLog(sk::allocateCommandBuffer(device, commandPool)) : vk::CommandBuffer(nullptr));
+		vk::Fence fence = sk::retLog(sk::createFence(device));
+
+		bool passed = generalQueue.get() && commandBuffer && fence;
+
+		const vk::Format format = vk::Format::eR8G8B8A8Unorm;
+		const vk::Extent2D extent = vk::Extent2D(64, 64);
+
+		vk::ImageCreateInfo imageCreateInfo = {};
+		imageCreateInfo.imageType = vk::ImageType::e2D;
+		imageCreateInfo.format = format;
+		imageCreateInfo.extent = vk::Extent3D(extent.width, extent.height, 1);
+		imageCreateInfo.mipLevels = 1;
+		imageCreateInfo.arrayLayers = 1;
+		imageCreateInfo.samples = vk::SampleCountFlagBits::e1;
+		imageCreateInfo.tiling = vk::ImageTiling::eOptimal;
+		imageCreateInfo.usage = vk::ImageUsageFlagBits::eColorAttachment;
+		imageCreateInfo.sharingMode = vk::SharingMode::eExclusive;
+		imageCreateInfo.initialLayout = vk::ImageLayout::eUndefined;
+
+		vk::Image image = nullptr;
+		vk::ImageView imageView = nullptr;
+		sk::MemoryAllocator allocator(physicalDevice, device);
+
+		try
+		{
+			image = device.createImage(imageCreateInfo);
+		}
+		catch (vk::SystemError err)
+		{
+			passed = false;
+		}
+
+		passed = passed && !sk::logError(allocator.allocateBind(image, vk::MemoryPropertyFlagBits::eDeviceLocal));
+
+		vk::ImageViewCreateInfo imageViewCreateInfo = {};
+		imageViewCreateInfo.image = image;
+		imageViewCreateInfo.viewType = vk::ImageViewType::e2D;
+		imageViewCreateInfo.format = format;
+		imageViewCreateInfo.subresourceRange = vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1);
+
+		try
+		{
+			imageView = (passed ? device.createImageView(imageViewCreateInfo) : vk::ImageView(nullptr));
+		}
+		catch (vk::SystemError err)
+		{
+			passed = false;
+		}
+
+		/*RENDER GRAPH*/
+		sk::RenderGraph renderGraph(device);
+
+		const uint32_t target = renderGraph.importImage("target", format, extent, vk::ImageLayout::eUndefined, vk::ImageLayout::eColorAttachmentOptimal);
+		const uint32_t clearPass = renderGraph.addPass("clear", sk::RenderGraphPassType::GRAPHICS, nullptr);
+
+		passed = passed && !sk::logError(renderGraph.setClearValue(target, vk::ClearValue())) && sk::retLog(renderGraph.setImage(target, image, imageView));
+		passed = passed && sk::retLog(renderGraph.use(clearPass, target, sk::RenderGraphUsage::COLOR_ATTACHMENT)) && sk::retLog(renderGraph.markOutput(target));
+		passed = passed && sk::retLog(renderGraph.compile());
+
+		/*FRAMES*/
+		//The first frame creates the query pool, the second one reads the timings of the first back
+		for (uint32_t frame = 0; passed && frame < 2; frame++)
+		{
+			passed = !sk::error(sk::beginCommandBuffer(commandBuffer)) && !sk::logError(profiler.beginFrame(commandBuffer, 0));
+			passed = passed && !sk::logError(profiler.beginZone(commandBuffer, "frame"));
+			passed = passed && sk::retLog(renderGraph.execute(commandBuffer, &profiler));
+			passed = passed && !sk::logError(profiler.endZone(commandBuffer)) && !sk::error(sk::endCommandBuffer(commandBuffer));
+
+			try
+			{
+				if (passed)
+				{
+					device.resetFences(fence);
+					passed = !sk::logError(sk::queueSubmit(generalQueue.get(), { commandBuffer }, {}, {}, {}, fence));
+					passed = passed && (device.waitForFences(fence, VK_TRUE, std::numeric_limits<uint64_t>::max()) == vk::Result::eSuccess);
+				}
+			}
+			catch (vk::SystemError err)
+			{
+				passed = false;
+			}
+		}
+
+		/*TIMINGS*/
+		const std::vector<sk::GpuZoneTiming>& timings = profiler.getTimings();
+		passed = passed && (timings.size() == 2);
+		passed = passed && (timings[0].name == "frame") && (timings[0].depth == 0) && (timings[1].name == "clear") && (timings[1].depth == 1);
+		passed = passed && (timings[1].milliseconds <= timings[0].milliseconds) && (profiler.getFrameTime() == timings[0].milliseconds);
+
+		//The submissions may still be pending when a step failed
+		device.waitIdle();
+
+		passed = !sk::logError(renderGraph.destroy()) && passed;
+		passed = !sk::logError(profiler.destroy()) && passed;
+
+		if (imageView)
+		{
+			device.destroyImageView(imageView);
+		}
+
+		if (image)
+		{
+			device.destroyImage(image);
+		}
+
+		sk::logError(allocator.freeAllMemory());
+
+		if (fence)
+		{
+			sk::logError(sk::destroyFence(device, fence));
+		}
+
+		if (commandPool)
+		{
+			sk::logError(sk::destroyCommandPool(device, commandPool));
+		}
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::GPU_PROFILER_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the draw group queries : pipeline statistics and occlusion results read back with their availability are turned
+	* into the statistics of the ended groups, results not written yet or missing being reported
+	*/
+	inline sk::SkResult<bool, sk::TestError> drawQueryTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		const vk::QueryPipelineStatisticFlags statisticFlags = vk::QueryPipelineStatisticFlagBits::eVertexShaderInvocations | vk::QueryPipelineStatisticFlagBits::eFragmentShaderInvocations;
+		passed = passed && (sk::getPipelineStatisticCount(statisticFlags) == 2) && (sk::getPipelineStatisticCount(sk::getDefaultPipelineStatisticFlags()) == 6);
+
+		/*RESULTS*/
+		//Opaque geometry with occlusion, a particle system without, then a group left open
+		std::vector<sk::DrawGroupQueries> groups(3);
+		groups[0].name = "opaque";
+		groups[0].occlusion = true;
+		groups[0].ended = true;
+		groups[1].name = "particles";
+		groups[1].ended = true;
+		groups[2].name = "open";
+
+		//(vertex invocations, fragment invocations, availability) per group, (samples passed, availability) per group
+		std::vector<uint64_t> statisticResults = { 3000, 250000, 1, 400, 900000, 1, 0, 0, 0 };
+		std::vector<uint64_t> occlusionResults = { 120000, 1, 0, 0, 0, 0 };
+
+		auto resolveResult = sk::resolveDrawGroupQueries(groups, statisticFlags, statisticResults, occlusionResults);
+		const std::vector<sk::DrawGroupStatistics>& statistics = resolveResult.value;
+		passed = passed && !sk::logError(resolveResult) && (statistics.size() == 2);
+		passed = passed && (statistics[0].name == "opaque") && (statistics[0].vertexShaderInvocations == 3000) && (statistics[0].fragmentShaderInvocations == 250000);
+		passed = passed && statistics[0].occlusionQueried && (statistics[0].samplesPassed == 120000) && (statistics[0].clippingPrimitives == 0);
+		passed = passed && (statistics[1].name == "particles") && (statistics[1].fragmentShaderInvocations == 900000) && !statistics[1].occlusionQueried;
+
+		//Without pipeline statistics (feature not enabled) only occlusion is reported
+		auto occlusionOnlyResult = sk::resolveDrawGroupQueries(groups, vk::QueryPipelineStatisticFlags(), std::vector<uint64_t>(), occlusionResults);
+		passed = passed && !sk::logError(occlusionOnlyResult) && (occlusionOnlyResult.value[0].samplesPassed == 120000) && (occlusionOnlyResult.value[0].fragmentShaderInvocations == 0);
+
+		//Results still in flight are never waited for
+		occlusionResults[1] = 0;
+		passed = passed && (sk::resolveDrawGroupQueries(groups, statisticFlags, statisticResults, occlusionResults).error == sk::DrawQueryError::RESULTS_NOT_AVAILABLE_ERROR);
+		passed = passed && (sk::resolveDrawGroupQueries(groups, statisticFlags, std::vector<uint64_t>(3, 1), occlusionResults).error == sk::DrawQueryError::QUERY_RESULTS_ERROR);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::DRAW_QUERY_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the trace : clock calibration across a 32 bits wrap around and without its extension, JSON escaping,
+	* per thread scope rings recorded by several threads, and the Chrome trace output
+	*/
+	inline sk::SkResult<bool, sk::TestError> traceTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*CLOCK*/
+		sk::GpuClockCalibration calibration = {};
+		calibration.cpuTime = 1000000;
+		calibration.gpuTimestamp = 0xFFFFFF00;
+		calibration.timestampPeriod = 2.0f;
+		calibration.timestampValidBits = 32;
+
+		//Timestamps after the calibration, across a 32 bits wrap around, then before it
+		passed = passed && (sk::getGpuTraceTime(calibration, 0xFFFFFF00) == 1000000);
+		passed = passed && (sk::getGpuTraceTime(calibration, 0x100) == 1000000 + 2 * 0x200);
+		passed = passed && (sk::getGpuTraceTime(calibration, 0xFFFFFE00) == 1000000 - 2 * 0x100);
+
+		//Without VK_EXT_calibrated_timestamps the dispatcher holds no function of the extension, the device is never reached
+		vk::DispatchLoaderDynamic dispatcher;
+		passed = passed && (sk::calibrateGpuClock(vk::PhysicalDevice(nullptr), vk::Device(nullptr), 64, dispatcher).error == sk::TraceError::CALIBRATION_EXTENSION_NOT_ENABLED_ERROR);
+
+		//The extension is added once
+		std::vector<const char*> deviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+		sk::enableCalibratedTimestamps(deviceExtensions);
+		sk::enableCalibratedTimestamps(deviceExtensions);
+		passed = passed && (deviceExtensions.size() == 2) && (std::strcmp(deviceExtensions[1], VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME) == 0);
+
+		/*JSON*/
+		std::string json;
+		sk::appendJsonString(json, "a\"b\\c\n\x01");
+		passed = passed && (json == "\"a\\\"b\\\\c\\n\\u0001\"");
+
+		/*RECORDER*/
+		//Four threads record more scopes than their rings hold while frames are marked
+		sk::TraceRecorder recorder(64, 16, 16);
+		recorder.setThreadName("Main \"thread\"");
+		recorder.markFrame(0);
+		{
+			sk::TraceScope scope(recorder, "Record");
+		}
+
+		//Threads stay alive until every one registered, a thread id being reused only after its thread ended
+		std::atomic<uint32_t> registeredThreads{ 0 };
+		std::vector<std::thread> threads;
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			threads.emplace_back([&recorder, &registeredThreads]()
+				{
+					recorder.recordScope("Worker", sk::getTraceTime(), sk::getTraceTime());
+					registeredThreads++;
+					while (registeredThreads.load() < 4)
+					{
+						std::this_thread::yield();
+					}
+
+					for (uint32_t j = 0; j < 1000; j++)
+					{
+						sk::TraceScope scope(recorder, "Worker");
+					}
+				});
+		}
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		recorder.markFrame(1);
+		recorder.recordScope("Submit", sk::getTraceTime(), sk::getTraceTime());
+
+		sk::GpuZoneTiming timing = {};
+		timing.name = "Shadows";
+		timing.beginTimestamp = 100;
+		timing.endTimestamp = 600;
+
+		sk::GpuClockCalibration gpuCalibration = {};
+		gpuCalibration.cpuTime = sk::getTraceTime();
+		gpuCalibration.gpuTimestamp = 100;
+		recorder.recordGpuZones({ timing }, gpuCalibration);
+
+		auto captureResult = recorder.capture(0, 1);
+		const sk::TraceCapture& capture = captureResult.value;
+		passed = passed && !sk::logError(captureResult) && (capture.threadNames.size() == 5) && (capture.threadNames[0] == "Main \"thread\"") && (capture.frames.size() == 2);
+
+		//Rings keep the last 64 scopes of each thread
+		size_t workerCount = 0;
+		size_t gpuCount = 0;
+		for (const sk::TraceEvent& event : capture.events)
+		{
+			workerCount += (event.name == "Worker" && event.processId == 0 && event.threadId >= 1 && event.threadId <= 4 && event.end >= event.begin);
+			gpuCount += (event.name == "Shadows" && event.processId == 1 && event.end - event.begin == 500);
+		}
+		passed = passed && (workerCount == 4 * 64) && (gpuCount == 1) && (capture.events.size() == 4 * 64 + 3);
+
+		passed = passed && (recorder.capture(2, 3).error == sk::TraceError::INVALID_FRAME_RANGE_ERROR) && (recorder.capture(1, 0).error == sk::TraceError::INVALID_FRAME_RANGE_ERROR);
+
+		/*CHROME TRACE*/
+		sk::TraceCapture smallCapture = {};
+		smallCapture.threadNames = { "Main" };
+		smallCapture.frames.emplace_back(7, 5000);
+		smallCapture.events.push_back(sk::TraceEvent{ "Draw", 0, 0, 6500, 9000 });
+
+		auto writeChromeTraceResult = sk::writeChromeTrace(smallCapture);
+		const std::string& trace = writeChromeTraceResult.value;
+		passed = passed && !sk::logError(writeChromeTraceResult);
+		passed = passed && (trace.find("{\"ph\":\"X\",\"name\":\"Draw\",\"pid\":0,\"tid\":0,\"ts\":1.500,\"dur\":2.500}") != std::string::npos);
+		passed = passed && (trace.find("\"name\":\"Frame 7\",\"pid\":0,\"tid\":0,\"ts\":0.000}") != std::string::npos);
+		passed = passed && (trace.find("\"name\":\"thread_name\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"Main\"}") != std::string::npos);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::TRACE_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the frame statistics : percentiles of sorted frame times, a ring keeping only its last frames, CPU and GPU
+	* summaries with their histograms and the CSV and JSON sinks
+	*/
+	inline sk::SkResult<bool, sk::TestError> frameStatisticsTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		/*PERCENTILES*/
+		std::vector<double> sortedTimes;
+		for (uint32_t i = 1; i <= 100; i++)
+		{
+			sortedTimes.push_back(static_cast<double>(i));
+		}
+
+		passed = passed && (sk::retLog(sk::getPercentile(sortedTimes, 50.0)) == 50.0) && (sk::retLog(sk::getPercentile(sortedTimes, 99.0)) == 99.0);
+		passed = passed && (sk::retLog(sk::getPercentile(sortedTimes, 0.0)) == 1.0) && (sk::retLog(sk::getPercentile(sortedTimes, 100.0)) == 100.0);
+		passed = passed && (sk::getPercentile(std::vector<double>(), 50.0).error == sk::FrameStatisticsError::NO_FRAME_ERROR);
+		passed = passed && (sk::getPercentile(sortedTimes, 101.0).error == sk::FrameStatisticsError::INVALID_PERCENTILE_ERROR);
+		passed = passed && (sk::summarizeFrameTimes(sortedTimes, 16.0, 0.0, 10).error == sk::FrameStatisticsError::INVALID_HISTOGRAM_ERROR);
+
+		/*RING*/
+		//A ring of 100 frames after 110 frames : 10 ms frames with one 50 ms stutter, the GPU time measured on even frames only
+		sk::FrameStatistics frameStatistics(100, 16.0, 5.0, 4);
+		passed = passed && (frameStatistics.getReport().error == sk::FrameStatisticsError::NO_FRAME_ERROR);
+
+		for (uint32_t i = 0; i < 110; i++)
+		{
+			passed = passed && sk::retLog(frameStatistics.recordFrame(i == 60 ? 50.0 : 10.0, i % 2 == 0 ? 8.0 : -1.0));
+		}
+
+		const std::vector<sk::FrameSample> frames = frameStatistics.getFrames();
+		passed = passed && (frames.size() == 100) && (frames.front().frameNumber == 10) && (frames.back().frameNumber == 109) && (frameStatistics.getLastFrame().frameNumber == 109);
+
+		auto getReportResult = frameStatistics.getReport();
+		const sk::FrameStatisticsReport& report = getReportResult.value;
+		passed = passed && !sk::logError(getReportResult) && (report.firstFrame == 10) && (report.lastFrame == 109) && (report.framesOverBudget == 1);
+
+		//The mean barely moves while the maximum shows the stutter
+		passed = passed && (report.cpu.frameCount == 100) && (std::abs(report.cpu.mean - 10.4) < 1e-9) && (report.cpu.p50 == 10.0) && (report.cpu.p99 == 10.0) && (report.cpu.max == 50.0);
+		passed = passed && (report.cpu.histogram == std::vector<uint32_t>({ 0, 0, 99, 1 }));
+		passed = passed && (report.gpu.frameCount == 50) && (report.gpu.p99 == 8.0) && (report.gpu.framesOverBudget == 0) && (report.gpu.histogram == std::vector<uint32_t>({ 0, 50, 0, 0 }));
+
+		/*SINKS*/
+		auto csvResult = sk::writeFrameStatisticsReport(report, sk::FrameStatisticsFormat::CSV);
+		passed = passed && !sk::logError(csvResult) && (csvResult.value.find("statistic,cpu,gpu\nframes,100,50\nframes_over_budget,1,0\n") == 0);
+		passed = passed && (csvResult.value.find("max_ms,50.000000,8.000000\n") != std::string::npos);
+
+		auto jsonResult = sk::writeFrameStatisticsReport(report, sk::FrameStatisticsFormat::JSON);
+		passed = passed && !sk::logError(jsonResult) && (jsonResult.value.find("\"frames_over_budget\":1,\"cpu\":{\"frames\":100,") != std::string::npos);
+		passed = passed && (jsonResult.value.find("\"p99_ms\":10.000000,\"max_ms\":50.000000,\"histogram\":[0,0,99,1]}") != std::string::npos);
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::FRAME_STATISTICS_ERROR;
+		}
+
+		return result;
+	}
+
+	/*@brief CPU only test of the dynamic state : states set while recording and device extensions for every combination of supported features
+	*/
+	inline sk::SkResult<bool, sk::TestError> dynamicStateTest()
+	{
+		sk::SkResult result(static_cast<bool>(true), sk::TestError::NO_ERROR);
+
+		bool passed = true;
+
+		const std::vector<vk::DynamicState> extendedDynamicStates = { vk::DynamicState::eCullModeEXT, vk::DynamicState::eFrontFaceEXT, vk::DynamicState::ePrimitiveTopologyEXT,
+			vk::DynamicState::eDepthTestEnableEXT, vk::DynamicState::eDepthWriteEnableEXT, vk::DynamicState::eDepthCompareOpEXT };
+
+		for (uint32_t combination = 0; passed && combination < 4; combination++)
+		{
+			sk::DynamicStateSupport support = {};
+			support.extendedDynamicState = (combination & 1) != 0;
+			support.dynamicRendering = (combination & 2) != 0;
+
+			/*DYNAMIC STATES*/
+			//Viewport and scissor are always dynamic, the extended states only with their extension, each state given once
+			const std::vector<vk::DynamicState> dynamicStates = sk::getDynamicStates(support);
+			passed = (dynamicStates.size() == (support.extendedDynamicState ? 2 + extendedDynamicStates.size() : 2));
+			passed = passed && (dynamicStates[0] == vk::DynamicState::eViewport) && (dynamicStates[1] == vk::DynamicState::eScissor);
+
+			for (const vk::DynamicState dynamicState : extendedDynamicStates)
+			{
+				passed = passed && (std::count(dynamicStates.begin(), dynamicStates.end(), dynamicState) == (support.extendedDynamicState ? 1 : 0));
+			}
+
+			/*DEVICE EXTENSIONS*/
+			//Dynamic rendering is never enabled with vulkan headers lacking VK_KHR_dynamic_rendering
+#ifdef VK_KHR_dynamic_rendering
+			const bool dynamicRenderingEnabled = support.dynamicRendering;
+#else
+			const bool dynamicRenderingEnabled = false;
+#endif
+
+			sk::DynamicStateFeatures features = {};
+			std::vector<const char*> deviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+			int previousFeatures = 0;
+
+			const void* pNextFeatures = sk::enableDynamicState(support, features, deviceExtensions, &previousFeatures);
+
+			auto hasExtension = [&deviceExtensions](const std::string_view extensionName)
+			{
+				return std::any_of(deviceExtensions.begin(), deviceExtensions.end(), [&extensionName](const char* deviceExtension) { return extensionName == deviceExtension; });
+			};
+
+			passed = passed && (deviceExtensions.size() == 1 + (support.extendedDynamicState ? 1 : 0) + (dynamicRenderingEnabled ? 1 : 0));
+			passed = passed && (hasExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME) == support.extendedDynamicState);
+
+			//The previous chain stays reachable, untouched when nothing is enabled
+			passed = passed && ((pNextFeatures == &previousFeatures) == (!support.extendedDynamicState && !dynamicRenderingEnabled));
+
+			if (support.extendedDynamicState)
+			{
+				passed = passed && (features.extendedDynamicStateFeatures.extendedDynamicState == VK_TRUE) && (features.extendedDynamicStateFeatures.pNext == &previousFeatures);
+				passed = passed && (pNextFeatures == &features.extendedDynamicStateFeatures || dynamicRenderingEnabled);
+			}
+		}
+
+		if (!passed)
+		{
+			result.value = false;
+			result.error = sk::TestError::DYNAMIC_STATE_ERROR;
+		}
+
+		return result;
+	}
+
 	inline sk::SkResult<sk::SkTestData, sk::TestError> mainSoulkanTest(bool debug)
 	{
 		sk::SkResult result(sk::SkTestData(), sk::TestError::NO_ERROR);
@@ -17,8 +2730,10 @@ namespace SOULKAN_NAMESPACE
 		auto initStart = std::chrono::steady_clock::now();
 
 		double frameNumber = 0;
-		double averageFramesPerSecond = 0;
-		double averageFrametime = 0;
+
+		//Percentiles cover the last 65536 frames, every frame time being streamed to a CSV file as well
+		sk::FrameStatistics frameStatistics(1 << 16);
+		sk::logError(frameStatistics.openSink("frame_statistics.csv", sk::FrameStatisticsFormat::CSV));
 
 		static sk::DeletionQueue deletionQueue;
 
@@ -35,11 +2750,11 @@ namespace SOULKAN_NAMESPACE
 		if (debug)
 		{
 			static std::vector<const char*> validationLayers = { "VK_LAYER_KHRONOS_validation", "VK_LAYER_LUNARG_api_dump" };
-			skInstance = sk::Instance("Soulkan", "Soulkan", std::vector<const char*>(), validationLayers);
+			skInstance = sk::Instance("Soulkan", "Soulkan", std::vector<const char*>(), validationLayers, VK_API_VERSION_1_1);
 		}
 		else
 		{
-			skInstance = sk::Instance("Soulkan", "Soulkan");
+			skInstance = sk::Instance("Soulkan", "Soulkan", std::vector<const char*>(), std::vector<const char*>(), VK_API_VERSION_1_1);
 		}
 
 		static vk::Instance instance = skInstance.get();
@@ -55,11 +2770,52 @@ namespace SOULKAN_NAMESPACE
 
 		/*DEVICE*/
 		static std::vector<const char*> deviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
-		static Device skDevice = skPhysicalDevice.createDevice(queueFamilyIndexes, deviceExtensions);
+
+		//Descriptor indexing is queried through vulkan 1.1, hence the version of the instance
+		static vk::PhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures = {};
+		static const bool descriptorIndexing = sk::retLog(sk::getDescriptorIndexingSupport(physicalDevice));
+		static const void* pNextFeatures = (descriptorIndexing ? sk::enableDescriptorIndexing(descriptorIndexingFeatures, deviceExtensions) : nullptr);
+
+		static Device skDevice = skPhysicalDevice.createDevice(queueFamilyIndexes, deviceExtensions, vk::PhysicalDeviceFeatures(), pNextFeatures);
 		static vk::Device device = skDevice.get();
 
 		deletionQueue.push_func([=]() { skDevice.destroy(); });
 
+		/*DESCRIPTOR ALLOCATOR*/
+		static auto descriptorAllocatorDeviceTestResult = sk::descriptorAllocatorDeviceTest(device);
+		if (!sk::retLog(descriptorAllocatorDeviceTestResult))
+		{
+			result.error = sk::TestError::DESCRIPTOR_ALLOCATOR_ERROR;
+		}
+
+		/*BINDLESS*/
+		static auto bindlessDeviceTestResult = sk::bindlessDeviceTest(skDevice, descriptorIndexing);
+		if (!sk::retLog(bindlessDeviceTestResult))
+		{
+			result.error = sk::TestError::BINDLESS_ERROR;
+		}
+
+		/*COMPUTE QUEUE*/
+		static auto queueOwnershipDeviceTestResult = sk::queueOwnershipDeviceTest(skDevice, queueFamilyIndexes);
+		if (!sk::retLog(queueOwnershipDeviceTestResult))
+		{
+			result.error = sk::TestError::QUEUE_FAMILY_ERROR;
+		}
+
+		/*GPU PROFILER*/
+		static auto gpuProfilerDeviceTestResult = sk::gpuProfilerDeviceTest(skDevice, queueFamilyIndexes);
+		if (!sk::retLog(gpuProfilerDeviceTestResult))
+		{
+			result.error = sk::TestError::GPU_PROFILER_ERROR;
+		}
+
+		/*TRANSIENT ALIASING*/
+		static auto transientAliasingDeviceTestResult = sk::transientAliasingDeviceTest(skDevice);
+		if (!sk::retLog(transientAliasingDeviceTestResult))
+		{
+			result.error = sk::TestError::TRANSIENT_ALIASING_ERROR;
+		}
+
 		/*QUEUE*/
 		sk::Queue skQueue = skDevice.getQueue(QueueFamilyType::GENERAL, queueFamilyIndexes, 0);
 		static vk::Queue generalQueue = skQueue.get();
@@ -122,25 +2878,40 @@ namespace SOULKAN_NAMESPACE
 
 		/*GRAPHICS PIPELINE*/
 
-		static auto createPipelineLayoutResult = createPipelineLayout(device);
-		static vk::PipelineLayout pipelineLayout = retLog(createPipelineLayoutResult);
-
-		deletionQueue.push_func([=]() { sk::logError(sk::destroyPipelineLayout(device, pipelineLayout)); });
-
 		static std::vector<std::string> shaderFilenames = { "shaders/triangle_mesh.spv", "shaders/colored_triangle.spv" };
 		static std::vector<vk::ShaderStageFlagBits> shaderStageFlags = { vk::ShaderStageFlagBits::eVertex, vk::ShaderStageFlagBits::eFragment };
 		static std::vector<std::string> entryNames = { "main", "main" };
 
 		/*SHADERS*/
-		static auto vertexShaderModuleResult = createShaderModule(device, shaderFilenames[0]);
+		static sk::ShaderModuleCache shaderModuleCache(device);
+
+		static auto vertexShaderModuleResult = shaderModuleCache.getShaderModule(shaderFilenames[0]);
 		static vk::ShaderModule vertexShaderModule = retLog(vertexShaderModuleResult);
-		static auto fragmentShaderModuleResult = createShaderModule(device, shaderFilenames[1]);
+		static auto fragmentShaderModuleResult = shaderModuleCache.getShaderModule(shaderFilenames[1]);
 		static vk::ShaderModule fragmentShaderModule = retLog(fragmentShaderModuleResult);
 
 		static std::vector<vk::ShaderModule> shaderModules = { vertexShaderModule, fragmentShaderModule };
 
-		deletionQueue.push_func([=]() { sk::logError(sk::destroyShaderModule(device, vertexShaderModule)); });
-		deletionQueue.push_func([=]() { sk::logError(sk::destroyShaderModule(device, fragmentShaderModule)); });
+		deletionQueue.push_func([=]() { sk::logError(shaderModuleCache.destroyShaderModules()); });
+
+		/*REFLECTION*/
+		static auto vertexShaderBufferResult = sk::loadShaderFileInBuffer(shaderFilenames[0]);
+		static auto vertexShaderReflectionResult = sk::reflectShader(sk::retLog(vertexShaderBufferResult));
+		static sk::ShaderReflection vertexShaderReflection = sk::retLog(vertexShaderReflectionResult);
+
+		static auto fragmentShaderBufferResult = sk::loadShaderFileInBuffer(shaderFilenames[1]);
+		static auto fragmentShaderReflectionResult = sk::reflectShader(sk::retLog(fragmentShaderBufferResult));
+		static sk::ShaderReflection fragmentShaderReflection = sk::retLog(fragmentShaderReflectionResult);
+
+		static auto mergeShaderReflectionsResult = sk::mergeShaderReflections({ vertexShaderReflection, fragmentShaderReflection });
+		static sk::PipelineLayoutDescription pipelineLayoutDescription = sk::retLog(mergeShaderReflectionsResult);
+
+		static sk::PipelineLayoutCache pipelineLayoutCache(device);
+
+		static auto getPipelineLayoutResult = pipelineLayoutCache.getPipelineLayout(pipelineLayoutDescription);
+		static vk::PipelineLayout pipelineLayout = sk::retLog(getPipelineLayoutResult).pipelineLayout;
+
+		deletionQueue.push_func([=]() { sk::logError(pipelineLayoutCache.destroyLayouts()); });
 
 		/*MESH*/
 		static auto createTriangleMeshResult = sk::createTriangleMesh();
@@ -149,17 +2920,20 @@ namespace SOULKAN_NAMESPACE
 		std::vector<sk::Vertex> triangleMeshVertices = triangleMesh.vertices;
 
 		/*VERTEX INPUT DESCRIPTIONS*/
-		static auto vertexInputBindingDescriptionResult = triangleMeshVertices[0].getInputBindingDescription();
-		static vk::VertexInputBindingDescription vertexInputBindingDescription = sk::retLog(vertexInputBindingDescriptionResult);
-		static std::vector<vk::VertexInputBindingDescription> vertexInputBindingDescriptions = { vertexInputBindingDescription };
+		static auto vertexInputDescriptionResult = sk::createReflectedVertexInputDescription(vertexShaderReflection);
+		static sk::VertexInputDescription vertexInputDescription = sk::retLog(vertexInputDescriptionResult);
+
+		static std::vector<vk::VertexInputBindingDescription> vertexInputBindingDescriptions = vertexInputDescription.bindings;
+		static std::vector<vk::VertexInputAttributeDescription> vertexInputAttributeDescriptions = vertexInputDescription.attributes;
 
-		static auto vertexInputAttributeDescriptionsResult = triangleMeshVertices[0].getInputAttributeDescriptions();
-		static std::vector<vk::VertexInputAttributeDescription> vertexInputAttributeDescriptions = sk::retLog(vertexInputAttributeDescriptionsResult);
+		static sk::PipelineVariantCache pipelineVariantCache(device, shaderModuleCache);
 
-		static auto createGraphicsPipelineResult = createGraphicsPipeline(device, renderPass, pipelineLayout, extent, shaderStageFlags, shaderModules, entryNames, vertexInputBindingDescriptions, vertexInputAttributeDescriptions);
-		static vk::Pipeline graphicsPipeline    = retLog(createGraphicsPipelineResult);
+		//Viewport and scissor are recorded by drawFrame(), the pipeline does not depend on the extent
+		static auto getGraphicsPipelineResult = pipelineVariantCache.getDynamicGraphicsPipeline(renderPass, sk::RenderingFormats(), pipelineLayout, shaderStageFlags, shaderModules, entryNames,
+			vertexInputBindingDescriptions, vertexInputAttributeDescriptions, sk::DynamicStateSupport());
+		static vk::Pipeline graphicsPipeline    = retLog(getGraphicsPipelineResult);
 
-		deletionQueue.push_func([=]() { sk::logError(sk::destroyPipeline(device, graphicsPipeline)); });
+		deletionQueue.push_func([=]() { sk::logError(pipelineVariantCache.destroyPipelines()); });
 
 		/*BUFFER*/
 		static auto createVertexBufferResult = sk::createVertexBuffer(device, triangleMeshVertices, vk::SharingMode::eExclusive);
@@ -168,6 +2942,11 @@ namespace SOULKAN_NAMESPACE
 
 		deletionQueue.push_func([=]() { sk::logError(sk::destroyBuffer(device, vertexBuffer)); });
 
+		static auto createIndexBufferResult = sk::createIndexBuffer(device, triangleMesh, vk::SharingMode::eExclusive);
+		static vk::Buffer indexBuffer = sk::retLog(createIndexBufferResult);
+
+		deletionQueue.push_func([=]() { sk::logError(sk::destroyBuffer(device, indexBuffer)); });
+
 		/*MEMORY ALLOCATOR*/
 		static sk::MemoryAllocator* pAllocator = new sk::MemoryAllocator(physicalDevice, device);
 
@@ -190,7 +2969,15 @@ namespace SOULKAN_NAMESPACE
 
 		static auto unmapResult = pPool->unmap();
 
-		std::vector<sk::Vertex> verticesToBeDrawn = std::move(triangleMeshVertices);
+		static auto allocateBindIndexResult = pAllocator->allocateBind(indexBuffer, vk::MemoryPropertyFlagBits::eDeviceLocal | vk::MemoryPropertyFlagBits::eHostVisible);
+		static sk::Pair<uint32_t, uint32_t> indexPoolIdBlockId = sk::retLog(allocateBindIndexResult);
+
+		static sk::MemoryPool* pIndexPool = sk::retLog(pAllocator->getPoolById(indexPoolIdBlockId.a));
+		static sk::MemoryBlock* pIndexBlock = sk::retLog(pIndexPool->getBlockById(indexPoolIdBlockId.b));
+
+		static void* pIndexData = sk::retLog(pIndexPool->map(pIndexBlock));
+		sk::logError(sk::writeIndices(triangleMesh, pIndexData));
+		static auto unmapIndexResult = pIndexPool->unmap();
 
 		skm::Mat4 translation = skm::translation(1.f, 2.f, 3.f);
 		std::cout << translation.asString() << std::endl;
@@ -205,20 +2992,17 @@ namespace SOULKAN_NAMESPACE
 
 		auto initEnd = std::chrono::steady_clock::now();
 		auto frameStart = std::chrono::steady_clock::now();
+		frameStatistics.endFrame();
 		while (!glfwWindowShouldClose(pWindow))
 		{
 			glfwPollEvents();
 
-			sk::draw(device, generalCommandBuffer, swapchain, generalQueue, graphicsPipeline, renderFence, presentSemaphore, renderSemaphore, renderPass, extent, framebuffers, vertexBuffers, verticesToBeDrawn, frameNumber);
+			sk::draw(device, generalCommandBuffer, swapchain, generalQueue, graphicsPipeline, renderFence, presentSemaphore, renderSemaphore, renderPass, extent, framebuffers, vertexBuffers, indexBuffer, triangleMesh, frameNumber);
 
-			auto now = std::chrono::steady_clock::now();
-			std::chrono::duration<double> delta = now - frameStart;
+			sk::logError(frameStatistics.endFrame());
 
-			double framesPerSecond = skm::retLog(skm::getFramePerSecond(frameNumber, delta));
-			double frametime       = skm::retLog(skm::getFrametime(framesPerSecond));
-
-			averageFramesPerSecond += framesPerSecond;
-			averageFrametime += frametime;
+			double frametime       = frameStatistics.getLastFrame().cpuMilliseconds;
+			double framesPerSecond = (frametime > 0.0 ? 1000.0 / frametime : 0.0);
 
 			std::string title = ("Frame " + std::to_string(frameNumber).substr(0, 10) + " (" + std::to_string(framesPerSecond).substr(0, 5) + 
 				                          " fps or frametime : " + std::to_string(frametime).substr(0, 5) + " ms) DEBUG : ");
@@ -227,8 +3011,12 @@ namespace SOULKAN_NAMESPACE
 			glfwSetWindowTitle(pWindow, title.c_str());
 		}
 
-		averageFramesPerSecond /= frameNumber;
-		averageFrametime /= frameNumber;
+		std::chrono::duration<double> frameLoopDelta = std::chrono::steady_clock::now() - frameStart;
+		double averageFramesPerSecond = skm::retLog(skm::getFramePerSecond(frameNumber, frameLoopDelta));
+		double averageFrametime       = (frameNumber > 0 ? frameLoopDelta.count() * 1000.0 / frameNumber : 0.0);
+
+		frameStatistics.closeSink();
+		sk::FrameStatisticsReport report = sk::retLog(frameStatistics.getReport());
 
 		auto testEnd = std::chrono::steady_clock::now();
 		auto delta   = testEnd - initStart;
@@ -246,7 +3034,8 @@ namespace SOULKAN_NAMESPACE
 
 		deletionQueue.flush();
 
-		result.value = std::move(sk::SkTestData(frameNumber, timeElapsed, initTimeElapsed, averageFramesPerSecond, averageFrametime));
+		result.value = std::move(sk::SkTestData(frameNumber, timeElapsed, initTimeElapsed, averageFramesPerSecond, averageFrametime, report.cpu.frameCount,
+			report.cpu.p50, report.cpu.p95, report.cpu.p99, report.cpu.max, report.framesOverBudget));
 		result.value.initTimeElapsed = initTimeElapsed;
 		return result;
 	}